@@ -0,0 +1,379 @@
+#include "CallTreeProfiler.hpp"
+#include "NameCache.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <unordered_map>
+
+namespace Broadsword {
+
+namespace {
+
+uint64_t Now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t NameKey(const SDK::FName& name) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(name.ComparisonIndex)) << 32) | name.Number;
+}
+
+// Child lookup key: parent node + identity of the callee
+struct ChildKey {
+    int32_t parent;
+    uint64_t a;
+    uint64_t b;
+
+    bool operator==(const ChildKey& other) const {
+        return parent == other.parent && a == other.a && b == other.b;
+    }
+};
+
+struct ChildKeyHash {
+    size_t operator()(const ChildKey& key) const {
+        uint64_t h = key.a * 0x9E3779B97F4A7C15ull;
+        h ^= (key.b + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+        h ^= static_cast<uint64_t>(static_cast<uint32_t>(key.parent)) * 0x165667B19E3779F9ull;
+        return static_cast<size_t>(h ^ (h >> 29));
+    }
+};
+
+} // namespace
+
+/**
+ * Call trees of one thread
+ *
+ * Nodes are created parent-first, so a node's parent always has a lower
+ * index. The thread records into `working` without locks; when a top-level
+ * call returns it folds `working` into `completed` under `mutex`, which
+ * EndFrame() only holds long enough to take `completed`.
+ */
+struct CallTreeProfiler::ThreadTree {
+    static constexpr size_t MaxNodes = 1 << 16;
+    static constexpr size_t MaxDepth = 256;
+
+    struct Node {
+        SDK::FName name;
+        SDK::FName outerName;
+        bool hasOuter = false;
+        uint64_t function = 0; // UFunction address
+        int32_t parent = -1;
+        uint32_t calls = 0;
+        uint64_t inclusiveNs = 0;
+    };
+
+    struct Frame {
+        int32_t node;
+        uint64_t start;
+    };
+
+    struct Tree {
+        std::vector<Node> nodes; // 0 = root
+        std::unordered_map<ChildKey, int32_t, ChildKeyHash> children; // Keyed by UFunction address
+
+        void Clear() {
+            nodes.clear();
+            children.clear();
+        }
+    };
+
+    // Owner thread only
+    Tree working;
+    std::vector<Frame> stack;
+    uint64_t workingSample = 0;
+
+    // Guarded by mutex
+    std::mutex mutex;
+    Tree completed;
+    uint64_t completedSample = 0;
+
+    void HandOff();
+};
+
+void CallTreeProfiler::ThreadTree::HandOff() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Left over from a sample EndFrame() already collected (the call outlived its frame)
+    if (completedSample != workingSample) {
+        completed.Clear();
+        completedSample = workingSample;
+    }
+
+    if (completed.nodes.empty()) {
+        std::swap(completed, working);
+        working.Clear();
+        return;
+    }
+
+    std::vector<int32_t> remap(working.nodes.size(), -1);
+    remap[0] = 0;
+    for (size_t i = 1; i < working.nodes.size(); i++) {
+        const Node& node = working.nodes[i];
+        int32_t parent = remap[node.parent];
+        if (parent < 0) {
+            continue;
+        }
+
+        ChildKey key{parent, node.function, NameKey(node.name)};
+        auto it = completed.children.find(key);
+        if (it == completed.children.end()) {
+            if (completed.nodes.size() >= MaxNodes) {
+                continue;
+            }
+            Node created = node;
+            created.parent = parent;
+            created.calls = 0;
+            created.inclusiveNs = 0;
+            it = completed.children.emplace(key, static_cast<int32_t>(completed.nodes.size())).first;
+            completed.nodes.push_back(created);
+        }
+
+        remap[i] = it->second;
+        completed.nodes[it->second].calls += node.calls;
+        completed.nodes[it->second].inclusiveNs += node.inclusiveNs;
+    }
+    working.Clear();
+}
+
+CallTreeProfiler& CallTreeProfiler::Get() {
+    static CallTreeProfiler instance;
+    return instance;
+}
+
+void CallTreeProfiler::SetEnabled(bool enabled) {
+    s_Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+CallTreeProfiler::ThreadTree& CallTreeProfiler::LocalTree() {
+    thread_local ThreadTree* tree = nullptr;
+    if (!tree) {
+        // Owned by m_Trees for the life of the process
+        auto owned = std::make_unique<ThreadTree>();
+        owned->stack.reserve(ThreadTree::MaxDepth);
+        tree = owned.get();
+
+        std::lock_guard<std::mutex> lock(m_TreesMutex);
+        m_Trees.push_back(std::move(owned));
+    }
+    return *tree;
+}
+
+CallTreeProfiler::Scope::Scope(SDK::UFunction* function) {
+    CallTreeProfiler& profiler = CallTreeProfiler::Get();
+    ThreadTree& tree = profiler.LocalTree();
+
+    ThreadTree::Tree& working = tree.working;
+
+    bool topLevel = tree.stack.empty();
+    if (topLevel) {
+        // Acquire pairs with EndFrame() arming the sample, so m_SampleId is the new one
+        if (!profiler.m_Recording.load(std::memory_order_acquire)) {
+            return;
+        }
+        tree.workingSample = profiler.m_SampleId.load(std::memory_order_relaxed);
+        if (working.nodes.empty()) {
+            working.nodes.emplace_back();
+        }
+    } else if (tree.stack.size() >= ThreadTree::MaxDepth) {
+        return;
+    }
+
+    int32_t parent = topLevel ? 0 : tree.stack.back().node;
+    ChildKey key{parent, reinterpret_cast<uintptr_t>(function), NameKey(function->Name)};
+
+    auto it = working.children.find(key);
+    if (it == working.children.end()) {
+        if (working.nodes.size() >= ThreadTree::MaxNodes) {
+            return;
+        }
+
+        ThreadTree::Node node;
+        node.name = function->Name;
+        if (function->Outer) {
+            node.outerName = function->Outer->Name;
+            node.hasOuter = true;
+        }
+        node.function = reinterpret_cast<uintptr_t>(function);
+        node.parent = parent;
+
+        it = working.children.emplace(key, static_cast<int32_t>(working.nodes.size())).first;
+        working.nodes.push_back(node);
+    }
+
+    tree.stack.push_back({it->second, Now()});
+    m_Tree = &tree;
+}
+
+CallTreeProfiler::Scope::~Scope() {
+    if (!m_Tree) {
+        return;
+    }
+
+    ThreadTree::Frame frame = m_Tree->stack.back();
+    m_Tree->stack.pop_back();
+
+    ThreadTree::Node& node = m_Tree->working.nodes[frame.node];
+    node.calls++;
+    node.inclusiveNs += Now() - frame.start;
+
+    if (m_Tree->stack.empty()) {
+        m_Tree->HandOff();
+    }
+}
+
+void CallTreeProfiler::EndFrame() {
+    if (!IsEnabled() && !m_Recording.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    m_FrameCount++;
+
+    if (m_Recording.load(std::memory_order_relaxed)) {
+        m_Recording.store(false, std::memory_order_relaxed);
+        Collect();
+        m_LastSampleFrame = m_FrameCount;
+    }
+
+    // Arm the next sampled frame
+    if (IsEnabled() && m_FrameCount % m_SampleInterval == 0) {
+        m_SampleId.fetch_add(1, std::memory_order_relaxed);
+        m_Recording.store(true, std::memory_order_release);
+    }
+}
+
+void CallTreeProfiler::Collect() {
+    struct MergeNode {
+        SDK::FName name;
+        SDK::FName outerName;
+        bool hasOuter = false;
+        int32_t parent = -1;
+        uint32_t calls = 0;
+        uint64_t inclusiveNs = 0;
+        std::vector<int32_t> children;
+    };
+
+    // Threads share one tree - the same call path on two threads is one node
+    std::vector<MergeNode> merged(1);
+    std::unordered_map<ChildKey, int32_t, ChildKeyHash> mergedChildren;
+    std::vector<int32_t> remap;
+
+    uint64_t sample = m_SampleId.load(std::memory_order_relaxed);
+    ThreadTree::Tree taken;
+
+    {
+        std::lock_guard<std::mutex> treesLock(m_TreesMutex);
+
+        for (const auto& tree : m_Trees) {
+            // Only the top-level calls that already returned - never waits for one still running
+            {
+                std::lock_guard<std::mutex> treeLock(tree->mutex);
+                taken.Clear();
+                if (tree->completedSample == sample) {
+                    std::swap(taken, tree->completed);
+                }
+                tree->completed.Clear();
+            }
+
+            remap.assign(taken.nodes.size(), 0);
+            for (size_t i = 1; i < taken.nodes.size(); i++) {
+                const ThreadTree::Node& node = taken.nodes[i];
+                int32_t parent = remap[node.parent];
+                ChildKey key{parent, node.hasOuter ? NameKey(node.outerName) : 0, NameKey(node.name)};
+
+                auto it = mergedChildren.find(key);
+                if (it == mergedChildren.end()) {
+                    MergeNode created;
+                    created.name = node.name;
+                    created.outerName = node.outerName;
+                    created.hasOuter = node.hasOuter;
+                    created.parent = parent;
+
+                    it = mergedChildren.emplace(key, static_cast<int32_t>(merged.size())).first;
+                    merged[parent].children.push_back(it->second);
+                    merged.push_back(std::move(created));
+                }
+
+                remap[i] = it->second;
+                merged[it->second].calls += node.calls;
+                merged[it->second].inclusiveNs += node.inclusiveNs;
+            }
+        }
+    }
+
+    for (int32_t child : merged[0].children) {
+        merged[0].inclusiveNs += merged[child].inclusiveNs;
+    }
+
+    // Flatten depth-first, hottest child first
+    m_LastTree.clear();
+    m_LastTree.reserve(merged.size());
+
+    std::vector<std::pair<int32_t, int32_t>> pending = {{0, -1}}; // merged index, output parent
+    while (!pending.empty()) {
+        auto [index, parent] = pending.back();
+        pending.pop_back();
+
+        MergeNode& source = merged[index];
+
+        CallTreeNode node;
+        if (index == 0) {
+            node.name = "Frame";
+        } else {
+            if (source.hasOuter) {
+                NameCache::Append(source.outerName, node.name);
+                node.name += '.';
+            }
+            NameCache::Append(source.name, node.name);
+        }
+        node.parent = parent;
+        node.depth = parent >= 0 ? m_LastTree[parent].depth + 1 : 0;
+        node.calls = source.calls;
+        node.inclusiveNs = source.inclusiveNs;
+
+        uint64_t childrenNs = 0;
+        for (int32_t child : source.children) {
+            childrenNs += merged[child].inclusiveNs;
+        }
+        node.exclusiveNs = node.inclusiveNs - std::min(childrenNs, node.inclusiveNs);
+
+        int32_t outputIndex = static_cast<int32_t>(m_LastTree.size());
+        if (parent >= 0) {
+            m_LastTree[parent].children.push_back(outputIndex);
+        }
+        m_LastTree.push_back(std::move(node));
+
+        // Pushed coldest first so the hottest child is visited next
+        std::sort(source.children.begin(), source.children.end(), [&merged](int32_t a, int32_t b) {
+            return merged[a].inclusiveNs < merged[b].inclusiveNs;
+        });
+        for (int32_t child : source.children) {
+            pending.push_back({child, outputIndex});
+        }
+    }
+}
+
+bool CallTreeProfiler::ExportFolded(const std::string& path) const {
+    if (m_LastTree.empty()) {
+        return false;
+    }
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // Depth-first order - a node's stack is its parent's stack plus its own name
+    std::vector<std::string> stacks(m_LastTree.size());
+    for (size_t i = 0; i < m_LastTree.size(); i++) {
+        const CallTreeNode& node = m_LastTree[i];
+        stacks[i] = node.parent >= 0 ? stacks[node.parent] + ";" + node.name : node.name;
+
+        if (node.exclusiveNs > 0) {
+            file << stacks[i] << ' ' << node.exclusiveNs << '\n';
+        }
+    }
+
+    return file.good();
+}
+
+} // namespace Broadsword
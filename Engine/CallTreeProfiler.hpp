@@ -0,0 +1,133 @@
+#pragma once
+
+#include "../Engine/SDK/SDK.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * One node of an aggregated ProcessEvent call tree
+ *
+ * A node is one call path (root -> ... -> function); every call made along
+ * that path during the sampled frame is folded into it.
+ */
+struct CallTreeNode {
+    std::string name;            // "Outer.Function" (root: "Frame")
+    int32_t parent = -1;         // Index into the tree, -1 for the root
+    int32_t depth = 0;           // Root = 0
+    std::vector<int32_t> children;
+    uint32_t calls = 0;
+    uint64_t inclusiveNs = 0;    // Time inside the call, nested calls included
+    uint64_t exclusiveNs = 0;    // inclusiveNs minus the children's inclusiveNs
+};
+
+/**
+ * CallTreeProfiler - Hierarchical Blueprint/UFunction profiler built on ProcessEvent nesting
+ *
+ * Every Nth frame (the sample interval) the ProcessEvent detour records
+ * enter/exit of each call. Nested ProcessEvent calls become children of the
+ * call they happen in, so the tree shows which top-level event (for
+ * example a ReceiveTick) is responsible for the time spent below it.
+ *
+ * Each calling thread builds its own tree without locks and hands it off
+ * when its top-level call returns; EndFrame() merges the handed-off trees
+ * into one snapshot and never waits for a call still running (a top-level
+ * call that outlives its sampled frame is left out). Non-sampled frames
+ * cost one thread-local check per call; disabled, one relaxed atomic load.
+ *
+ * Thread Safety:
+ * - IsEnabled() and Scope are used by the detour on any thread
+ * - Everything else is game thread only
+ *
+ * Usage:
+ *   CallTreeProfiler::Get().SetSampleInterval(30);
+ *   CallTreeProfiler::Get().SetEnabled(true);
+ *   // ... later
+ *   const auto& tree = CallTreeProfiler::Get().GetLastTree();
+ *   CallTreeProfiler::Get().ExportFolded("Broadsword_CallTree.folded");
+ */
+class CallTreeProfiler {
+public:
+    static CallTreeProfiler& Get();
+
+    CallTreeProfiler(const CallTreeProfiler&) = delete;
+    CallTreeProfiler& operator=(const CallTreeProfiler&) = delete;
+
+    static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+    void SetEnabled(bool enabled);
+
+    /**
+     * Record one frame out of every `frames` (1 = every frame)
+     */
+    void SetSampleInterval(uint32_t frames) { m_SampleInterval = frames > 0 ? frames : 1; }
+    uint32_t GetSampleInterval() const { return m_SampleInterval; }
+
+    /**
+     * Finish the frame: merge a sampled frame into the snapshot, arm the next sample
+     *
+     * Call once per frame on the game thread.
+     */
+    void EndFrame();
+
+    /**
+     * Tree of the last sampled frame
+     *
+     * @return Nodes in depth-first order, node 0 is the root (empty before the first sample)
+     */
+    const std::vector<CallTreeNode>& GetLastTree() const { return m_LastTree; }
+    uint64_t GetLastSampleFrame() const { return m_LastSampleFrame; }
+
+    /**
+     * Write the last tree as folded stacks ("Frame;Caller;Callee <exclusive ns>" per line),
+     * the input format of flamegraph.pl and speedscope
+     *
+     * @param path Output file
+     * @return false if there is no tree or the file could not be written
+     */
+    bool ExportFolded(const std::string& path) const;
+
+private:
+    struct ThreadTree;
+
+public:
+    /**
+     * Records one ProcessEvent call for as long as it lives (detour only)
+     */
+    class Scope {
+    public:
+        explicit Scope(SDK::UFunction* function);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ThreadTree* m_Tree = nullptr; // Set when this call was recorded
+    };
+
+private:
+    CallTreeProfiler() = default;
+
+    ThreadTree& LocalTree();
+    void Collect();
+
+    static inline std::atomic<bool> s_Enabled = false;
+    std::atomic<bool> m_Recording = false; // Current frame is sampled
+    std::atomic<uint64_t> m_SampleId = 0;  // Bumped when a sample is armed
+
+    std::mutex m_TreesMutex; // Guards m_Trees (not the trees themselves)
+    std::vector<std::unique_ptr<ThreadTree>> m_Trees;
+
+    // Game thread only
+    uint32_t m_SampleInterval = 60;
+    uint64_t m_FrameCount = 0;
+    uint64_t m_LastSampleFrame = 0;
+    std::vector<CallTreeNode> m_LastTree;
+};
+
+} // namespace Broadsword
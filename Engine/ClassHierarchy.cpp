@@ -0,0 +1,293 @@
+#include "ClassHierarchy.hpp"
+#include "ObjectScan.hpp"
+#include "../Engine/SDK/SDK/CoreUObject_classes.hpp"
+#include "../Foundation/Threading/EpochReclaimer.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace Broadsword {
+
+namespace {
+
+size_t HashPointer(const void* pointer) {
+    uint64_t value = reinterpret_cast<uintptr_t>(pointer) >> 4;
+    value *= 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(value ^ (value >> 32));
+}
+
+const SDK::UClass* SuperOf(const SDK::UClass* objectClass) {
+    return static_cast<const SDK::UClass*>(objectClass->Super);
+}
+
+} // namespace
+
+ClassHierarchy& ClassHierarchy::Get() {
+    static ClassHierarchy instance;
+    return instance;
+}
+
+const ClassHierarchy::Node* ClassHierarchy::Numbering::Find(const SDK::UClass* objectClass) const {
+    if (nodes.empty()) {
+        return nullptr;
+    }
+
+    size_t mask = nodes.size() - 1;
+    for (size_t position = HashPointer(objectClass) & mask;; position = (position + 1) & mask) {
+        const Node& node = nodes[position];
+        if (node.objectClass == objectClass) {
+            return &node;
+        }
+        if (!node.objectClass) {
+            return nullptr;
+        }
+    }
+}
+
+ClassHierarchy::Node& ClassHierarchy::Numbering::Insert(const SDK::UClass* objectClass) {
+    size_t mask = nodes.size() - 1;
+    size_t position = HashPointer(objectClass) & mask;
+    while (nodes[position].objectClass && nodes[position].objectClass != objectClass) {
+        position = (position + 1) & mask;
+    }
+
+    Node& node = nodes[position];
+    if (!node.objectClass) {
+        node.objectClass = objectClass;
+        count++;
+    }
+    return node;
+}
+
+void ClassHierarchy::Update() {
+    m_FramesSinceRenumber++;
+
+    const Numbering* current = m_Current.load(std::memory_order_relaxed);
+    if (!current) {
+        Renumber();
+        return;
+    }
+
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t count = objects->Num();
+
+    std::vector<const SDK::UClass*> created;
+    for (int32_t i = m_ScanCursor; i < count; i++) {
+        SDK::UObject* object = objects->GetByIndex(i);
+        if (object && object->HasTypeFlag(SDK::EClassCastFlags::Class)) {
+            created.push_back(static_cast<const SDK::UClass*>(object));
+        }
+    }
+    m_ScanCursor = count;
+
+    if (!created.empty() && !InsertClasses(created)) {
+        Renumber();
+        return;
+    }
+
+    // A lookup found a class that still isn't numbered (created in a reused slot,
+    // or re-parented) - walk everything, at most every RenumberIntervalFrames
+    const SDK::UClass* missed = m_Missed.load(std::memory_order_relaxed);
+    if (missed && m_FramesSinceRenumber >= RenumberIntervalFrames) {
+        const Node* node = m_Current.load(std::memory_order_relaxed)->Find(missed);
+        if (!node || m_Reparented.load(std::memory_order_relaxed)) {
+            Renumber();
+        } else {
+            m_Missed.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+}
+
+void ClassHierarchy::Shutdown() {
+    Publish(nullptr);
+    m_NextChild.clear();
+    m_ScanCursor = 0;
+    m_Missed.store(nullptr, std::memory_order_relaxed);
+}
+
+bool ClassHierarchy::IsA(const SDK::UClass* objectClass, const SDK::UClass* base) const {
+    if (!objectClass || !base) {
+        return false;
+    }
+    if (objectClass == base) {
+        return true;
+    }
+
+    {
+        Foundation::EpochReclaimer::Guard guard;
+        if (const Numbering* numbering = m_Current.load(std::memory_order_acquire)) {
+            const Node* node = numbering->Find(objectClass);
+            const Node* baseNode = numbering->Find(base);
+            if (node && baseNode && node->super == objectClass->Super && baseNode->super == base->Super) {
+                return baseNode->pre <= node->pre && node->pre <= baseNode->post;
+            }
+
+            // Not numbered yet (or re-parented) - numbered by a later Update()
+            m_Missed.store(node ? base : objectClass, std::memory_order_relaxed);
+            if (node && baseNode) {
+                m_Reparented.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    m_Fallbacks.fetch_add(1, std::memory_order_relaxed);
+
+    for (const SDK::UClass* current = SuperOf(objectClass); current; current = SuperOf(current)) {
+        if (current == base) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ClassHierarchy::IsA(const SDK::UObject* object, const SDK::UClass* base) const {
+    return object && IsA(object->Class, base);
+}
+
+ClassHierarchy::Stats ClassHierarchy::GetStats() const {
+    Foundation::EpochReclaimer::Guard guard;
+    const Numbering* numbering = m_Current.load(std::memory_order_acquire);
+    return {numbering ? numbering->count : 0, m_Renumbers, m_Insertions, m_Fallbacks.load(std::memory_order_relaxed)};
+}
+
+void ClassHierarchy::Renumber() {
+    m_Renumbers++;
+    m_FramesSinceRenumber = 0;
+    m_Missed.store(nullptr, std::memory_order_relaxed);
+    m_Reparented.store(false, std::memory_order_relaxed);
+
+    m_ScanCursor = SDK::UObject::GObjects->Num();
+
+    ObjectScanFilter filter;
+    filter.castFlags = SDK::EClassCastFlags::Class;
+
+    std::vector<const SDK::UClass*> classes;
+    for (SDK::UObject* object : ObjectScan::Get().Find(filter)) {
+        classes.push_back(static_cast<const SDK::UClass*>(object));
+    }
+
+    // Children of each class; classes whose Super isn't a live class are roots
+    std::unordered_map<const SDK::UClass*, std::vector<const SDK::UClass*>> children;
+    children.reserve(classes.size());
+    for (const SDK::UClass* objectClass : classes) {
+        children[objectClass];
+    }
+
+    std::vector<const SDK::UClass*> roots;
+    for (const SDK::UClass* objectClass : classes) {
+        auto parent = children.find(SuperOf(objectClass));
+        if (parent != children.end() && parent->first != objectClass) {
+            parent->second.push_back(objectClass);
+        } else {
+            roots.push_back(objectClass);
+        }
+    }
+
+    auto* numbering = new Numbering();
+    numbering->nodes.resize(std::bit_ceil(std::max<size_t>(1024, classes.size() * 2)));
+    m_NextChild.clear();
+
+    // Iterative pre/post-order walk
+    struct Frame {
+        const SDK::UClass* objectClass;
+        size_t nextChild;
+    };
+    std::vector<Frame> stack;
+    uint32_t counter = 0;
+
+    for (const SDK::UClass* root : roots) {
+        stack.push_back({root, 0});
+        Node& rootNode = numbering->Insert(root);
+        rootNode.super = root->Super;
+        rootNode.pre = counter++;
+
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            const auto& list = children[frame.objectClass];
+
+            if (frame.nextChild < list.size()) {
+                const SDK::UClass* child = list[frame.nextChild++];
+                Node& node = numbering->Insert(child);
+                node.super = child->Super;
+                node.pre = counter++;
+                stack.push_back({child, 0});
+                continue;
+            }
+
+            // Classes with many subclasses tend to get more (Blueprints of Actor, Character...)
+            m_NextChild[frame.objectClass] = counter;
+            counter += WalkSlack + static_cast<uint32_t>(list.size()) * MaxInsertSpan * 4;
+            numbering->Insert(frame.objectClass).post = counter++;
+            stack.pop_back();
+        }
+    }
+
+    Publish(numbering);
+}
+
+bool ClassHierarchy::InsertClasses(std::vector<const SDK::UClass*>& classes) {
+    const Numbering* current = m_Current.load(std::memory_order_relaxed);
+
+    // Parents before children
+    auto depth = [](const SDK::UClass* objectClass) {
+        size_t levels = 0;
+        for (; objectClass; objectClass = SuperOf(objectClass)) {
+            levels++;
+        }
+        return levels;
+    };
+    std::stable_sort(classes.begin(), classes.end(),
+        [&](const SDK::UClass* a, const SDK::UClass* b) { return depth(a) < depth(b); });
+
+    auto* numbering = new Numbering();
+    numbering->nodes.resize(std::bit_ceil(std::max(current->nodes.size(), (current->count + classes.size()) * 2)));
+    for (const Node& node : current->nodes) {
+        if (node.objectClass) {
+            numbering->Insert(node.objectClass) = node;
+        }
+    }
+
+    for (const SDK::UClass* objectClass : classes) {
+        if (numbering->Find(objectClass)) {
+            continue; // Numbered by an earlier walk
+        }
+
+        const SDK::UClass* super = SuperOf(objectClass);
+        const Node* parent = super ? numbering->Find(super) : nullptr;
+        auto next = super ? m_NextChild.find(super) : m_NextChild.end();
+        if (!parent || parent->super != super->Super || next == m_NextChild.end()) {
+            delete numbering;
+            return false;
+        }
+
+        // A share of the parent's remaining slack, leaving room for its own children
+        uint32_t slack = parent->post - next->second;
+        uint32_t span = std::min(MaxInsertSpan, slack / 4);
+        if (span < 2) {
+            delete numbering;
+            return false;
+        }
+
+        uint32_t pre = next->second;
+        uint32_t post = pre + span - 1;
+        next->second = post + 1;
+
+        Node& node = numbering->Insert(objectClass);
+        node.super = objectClass->Super;
+        node.pre = pre;
+        node.post = post;
+        m_NextChild[objectClass] = pre + 1;
+        m_Insertions++;
+    }
+
+    Publish(numbering);
+    return true;
+}
+
+void ClassHierarchy::Publish(Numbering* numbering) {
+    const Numbering* previous = m_Current.exchange(numbering, std::memory_order_acq_rel);
+    if (previous) {
+        Foundation::EpochReclaimer::Get().Retire(const_cast<Numbering*>(previous));
+    }
+}
+
+} // namespace Broadsword
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "../Engine/SDK/SDK/Basic.hpp"
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * ClassHierarchy - Constant-time UClass subclass checks
+ *
+ * SDK UObject::IsA(UClass*) walks the Super chain on every call. ClassHierarchy
+ * numbers every UClass in GObjects with a pre/post-order (Euler tour) walk of
+ * the class tree, so "A derives from B" becomes
+ * B.pre <= A.pre && A.pre <= B.post.
+ *
+ * Numbering:
+ * - A full walk leaves slack after each class's children
+ * - Update() (once per frame) scans newly created GObjects slots for classes
+ *   and numbers each into its parent's slack (Blueprint classes load as leaves)
+ * - The tree is renumbered when a parent runs out of slack, a class's parent
+ *   isn't numbered, or a lookup missed a class the scan didn't find (e.g.
+ *   created in a reused slot)
+ *
+ * Each numbering is an immutable snapshot published to readers with an
+ * atomic pointer and freed through EpochReclaimer. Classes that aren't
+ * numbered yet, or whose Super changed, fall back to walking Super.
+ *
+ * Thread Safety:
+ * - IsA() can be called from any thread
+ * - Update() and Shutdown() run on the game thread
+ *
+ * Usage:
+ *   if (ClassHierarchy::Get().IsA(object, SDK::APawn::StaticClass())) { ... }
+ */
+class ClassHierarchy {
+public:
+    struct Stats {
+        size_t classes = 0;        // Classes in the current numbering
+        uint64_t renumbers = 0;    // Full walks of the class tree
+        uint64_t insertions = 0;   // Classes numbered into their parent's slack
+        uint64_t fallbacks = 0;    // IsA() calls that walked Super instead
+    };
+
+    static ClassHierarchy& Get();
+
+    ClassHierarchy(const ClassHierarchy&) = delete;
+    ClassHierarchy& operator=(const ClassHierarchy&) = delete;
+
+    /**
+     * Number classes created since the last call
+     *
+     * Call once per frame on the game thread.
+     */
+    void Update();
+
+    /**
+     * Drop the numbering (IsA() walks Super until the next Update())
+     */
+    void Shutdown();
+
+    /**
+     * Whether objectClass is base or derives from it
+     */
+    bool IsA(const SDK::UClass* objectClass, const SDK::UClass* base) const;
+
+    /**
+     * Whether object's class is base or derives from it
+     */
+    bool IsA(const SDK::UObject* object, const SDK::UClass* base) const;
+
+    Stats GetStats() const;
+
+private:
+    ClassHierarchy() = default;
+
+    struct Node {
+        const SDK::UClass* objectClass = nullptr; // nullptr = empty slot
+        const void* super = nullptr;              // Super when numbered
+        uint32_t pre = 0;
+        uint32_t post = 0;
+    };
+
+    // Open-addressed class -> Node table, immutable once published
+    struct Numbering {
+        std::vector<Node> nodes;
+        size_t count = 0;
+
+        const Node* Find(const SDK::UClass* objectClass) const;
+        Node& Insert(const SDK::UClass* objectClass);
+    };
+
+    // Slack left after each class's children by a full walk (plus room for four times
+    // as many children again), and the most a new class takes
+    static constexpr uint32_t WalkSlack = 256;
+    static constexpr uint32_t MaxInsertSpan = 32;
+
+    // Fewest frames between full walks triggered by lookups that missed
+    static constexpr uint32_t RenumberIntervalFrames = 30;
+
+    void Renumber();
+    bool InsertClasses(std::vector<const SDK::UClass*>& classes);
+    void Publish(Numbering* numbering);
+
+    std::atomic<const Numbering*> m_Current = nullptr;
+
+    // Last class IsA() couldn't find, and whether a numbered class changed Super
+    mutable std::atomic<const SDK::UClass*> m_Missed = nullptr;
+    mutable std::atomic<bool> m_Reparented = false;
+
+    // Game thread only: next free number under each class (end of its last child)
+    std::unordered_map<const SDK::UClass*, uint32_t> m_NextChild;
+    int32_t m_ScanCursor = 0;
+    uint32_t m_FramesSinceRenumber = 0;
+
+    uint64_t m_Renumbers = 0;
+    uint64_t m_Insertions = 0;
+    mutable std::atomic<uint64_t> m_Fallbacks = 0;
+};
+
+} // namespace Broadsword
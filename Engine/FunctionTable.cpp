@@ -0,0 +1,173 @@
+#include "FunctionTable.hpp"
+#include "NameCache.hpp"
+#include "../Engine/SDK/SDK/CoreUObject_classes.hpp"
+#include "../Foundation/Threading/IdleScheduler.hpp"
+#include <algorithm>
+#include <charconv>
+
+namespace Broadsword {
+
+namespace {
+
+// FNV-1a, continued across pieces of one name
+uint64_t Fnv(uint64_t hash, std::string_view text) {
+    for (char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+constexpr uint64_t FnvBasis = 0xCBF29CE484222325ull;
+
+uint64_t NameKey(const SDK::FName& name) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(name.ComparisonIndex)) << 32) | name.Number;
+}
+
+} // namespace
+
+FunctionTable& FunctionTable::Get() {
+    static FunctionTable instance;
+    return instance;
+}
+
+void FunctionTable::Initialize() {
+    if (m_PrewarmTask || m_Prewarmed) {
+        return;
+    }
+
+    m_PrewarmTask = Foundation::IdleScheduler::Get().Post("Function table prewarm", [this]() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return Prewarm(PrewarmSliceObjects);
+    });
+}
+
+void FunctionTable::Shutdown() {
+    if (m_PrewarmTask) {
+        Foundation::IdleScheduler::Get().Unregister(m_PrewarmTask);
+        m_PrewarmTask = 0;
+    }
+}
+
+SDK::UFunction* FunctionTable::Find(const SDK::UStruct* objectClass, std::string_view className,
+                                    std::string_view functionName) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Lookups++;
+
+    for (const SDK::UStruct* owner = objectClass; owner; owner = owner->Super) {
+        if (!NameCache::Equals(owner->Name, className)) {
+            continue;
+        }
+
+        if (SDK::UFunction* function = FindDeclared(owner, functionName)) {
+            return function;
+        }
+    }
+
+    return nullptr;
+}
+
+FunctionTable::Stats FunctionTable::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return {m_Classes.size(), m_Functions, m_Lookups, m_Rebuilds, m_Prewarmed};
+}
+
+uint64_t FunctionTable::NameHash(std::string_view text) {
+    return Fnv(FnvBasis, text);
+}
+
+uint64_t FunctionTable::NameHash(const SDK::FName& name) {
+    uint64_t hash = Fnv(FnvBasis, name.View());
+    if (name.Number > 0) {
+        char digits[16];
+        digits[0] = '_';
+        auto result = std::to_chars(digits + 1, digits + sizeof(digits), name.Number - 1);
+        hash = Fnv(hash, std::string_view(digits, result.ptr - digits));
+    }
+    return hash;
+}
+
+const FunctionTable::ClassFunctions& FunctionTable::TableOf(const SDK::UStruct* owner, bool onDemand) {
+    ClassFunctions& table = m_Classes[owner];
+
+    uint64_t nameKey = NameKey(owner->Name);
+    if (table.built && table.nameKey == nameKey && table.children == owner->Children) {
+        return table;
+    }
+
+    if (onDemand) {
+        m_Rebuilds++;
+    }
+
+    m_Functions -= table.entries.size();
+    table.nameKey = nameKey;
+    table.children = owner->Children;
+    table.entries.clear();
+    table.built = true;
+
+    for (SDK::UField* field = owner->Children; field; field = field->Next) {
+        if (field->HasTypeFlag(SDK::EClassCastFlags::Function)) {
+            table.entries.push_back({NameHash(field->Name), static_cast<SDK::UFunction*>(field)});
+        }
+    }
+
+    std::sort(table.entries.begin(), table.entries.end(),
+        [](const Entry& a, const Entry& b) { return a.hash < b.hash; });
+    m_Functions += table.entries.size();
+    return table;
+}
+
+SDK::UFunction* FunctionTable::FindDeclared(const SDK::UStruct* owner, std::string_view functionName) {
+    uint64_t hash = NameHash(functionName);
+
+    // Rebuilt at most once if the table doesn't match the class anymore
+    for (int attempt = 0; attempt < 2; attempt++) {
+        const ClassFunctions& table = TableOf(owner, true);
+
+        auto it = std::lower_bound(table.entries.begin(), table.entries.end(), hash,
+            [](const Entry& entry, uint64_t value) { return entry.hash < value; });
+
+        bool stale = false;
+        for (; it != table.entries.end() && it->hash == hash; ++it) {
+            SDK::UFunction* function = it->function;
+            if (function->Outer != owner) {
+                stale = true;
+                break;
+            }
+            if (NameCache::Equals(function->Name, functionName)) {
+                return function;
+            }
+        }
+
+        if (!stale) {
+            return nullptr;
+        }
+        m_Classes[owner].built = false;
+    }
+
+    return nullptr;
+}
+
+bool FunctionTable::Prewarm(int32_t maxObjects) {
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t count = objects->Num();
+    int32_t end = count - m_PrewarmCursor > maxObjects ? m_PrewarmCursor + maxObjects : count;
+
+    for (int32_t i = m_PrewarmCursor; i < end; i++) {
+        SDK::UObject* object = objects->GetByIndex(i);
+        if (object && object->HasTypeFlag(SDK::EClassCastFlags::Class)) {
+            TableOf(static_cast<SDK::UStruct*>(object), false);
+        }
+    }
+
+    m_PrewarmCursor = end;
+    if (m_PrewarmCursor < count) {
+        return true;
+    }
+
+    m_Prewarmed = true;
+    m_PrewarmTask = 0;
+    return false;
+}
+
+} // namespace Broadsword
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "../Engine/SDK/SDK/Basic.hpp"
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace SDK {
+class UField;
+class UStruct;
+}
+
+namespace Broadsword {
+
+/**
+ * FunctionTable - Hashed per-class UFunction lookup
+ *
+ * Every generated SDK wrapper resolves its UFunction once through
+ * UClass::GetFunction("Willie_BP_C", "TakeDamage") into a function-local
+ * static. The generated GetFunction walked Super and Children comparing
+ * freshly built name strings, so the first call of each wrapper hitched the
+ * frame it ran on. It now forwards here.
+ *
+ * Each class gets a table of its declared functions keyed by a hash of the
+ * function name, built from its Children list the first time it is
+ * needed. Initialize() also posts an idle-time prewarm that builds the
+ * tables of every loaded class in one sliced sweep over GObjects. By the
+ * time a wrapper first runs, its static is filled with a single hash lookup.
+ *
+ * A table is rebuilt if its class's FName or first child changed (the
+ * class was unloaded and its memory reused), and every hit is checked
+ * against the function's outer and name.
+ *
+ * Thread Safety:
+ * - Find() can be called from any thread (one mutex, held for the lookup)
+ * - Initialize() and Shutdown() run on the game thread
+ *
+ * Usage:
+ *   SDK::UFunction* function = FunctionTable::Get().Find(object->Class, "Willie_BP_C", "TakeDamage");
+ */
+class FunctionTable {
+public:
+    struct Stats {
+        size_t classes = 0;      // Classes with a built table
+        size_t functions = 0;    // Functions across those tables
+        uint64_t lookups = 0;
+        uint64_t rebuilds = 0;   // Tables built or rebuilt on demand (not by the prewarm)
+        bool prewarmed = false;  // Prewarm sweep has finished
+    };
+
+    static FunctionTable& Get();
+
+    FunctionTable(const FunctionTable&) = delete;
+    FunctionTable& operator=(const FunctionTable&) = delete;
+
+    /**
+     * Post the idle-time prewarm sweep over GObjects
+     */
+    void Initialize();
+    void Shutdown();
+
+    /**
+     * UClass::GetFunction(): function named functionName declared on the
+     * class named className, searched from objectClass up its Super chain
+     *
+     * @return Function, or nullptr if none matches
+     */
+    SDK::UFunction* Find(const SDK::UStruct* objectClass, std::string_view className, std::string_view functionName);
+
+    Stats GetStats() const;
+
+private:
+    FunctionTable() = default;
+
+    struct Entry {
+        uint64_t hash;
+        SDK::UFunction* function;
+    };
+
+    // Declared functions of one class, sorted by hash
+    struct ClassFunctions {
+        uint64_t nameKey = 0;
+        const SDK::UField* children = nullptr;
+        std::vector<Entry> entries;
+        bool built = false;
+    };
+
+    static constexpr int32_t PrewarmSliceObjects = 4096;
+
+    static uint64_t NameHash(std::string_view text);
+    static uint64_t NameHash(const SDK::FName& name);
+
+    const ClassFunctions& TableOf(const SDK::UStruct* owner, bool onDemand);
+    SDK::UFunction* FindDeclared(const SDK::UStruct* owner, std::string_view functionName);
+    bool Prewarm(int32_t maxObjects);
+
+    mutable std::mutex m_Mutex;
+    std::unordered_map<const SDK::UStruct*, ClassFunctions> m_Classes;
+    size_t m_Functions = 0;
+
+    uint32_t m_PrewarmTask = 0;
+    int32_t m_PrewarmCursor = 0;
+    bool m_Prewarmed = false;
+
+    uint64_t m_Lookups = 0;
+    uint64_t m_Rebuilds = 0;
+};
+
+} // namespace Broadsword
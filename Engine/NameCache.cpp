@@ -0,0 +1,167 @@
+#include "NameCache.hpp"
+#include <charconv>
+#include <cstring>
+
+namespace Broadsword {
+
+namespace {
+
+uint64_t Hash(int32_t comparisonIndex) {
+    uint64_t value = static_cast<uint32_t>(comparisonIndex);
+    value *= 0x9E3779B97F4A7C15ull;
+    return value ^ (value >> 29);
+}
+
+} // namespace
+
+NameCache& NameCache::Get() {
+    static NameCache instance;
+    return instance;
+}
+
+NameCache::NameCache() {
+    auto table = std::make_unique<Table>();
+    table->mask = InitialCapacity - 1;
+    table->slots = std::make_unique<std::atomic<const Entry*>[]>(InitialCapacity);
+    m_Table.store(table.get(), std::memory_order_release);
+    m_Tables.push_back(std::move(table));
+}
+
+std::string_view NameCache::Raw(int32_t comparisonIndex) {
+    const Entry* entry = Find(comparisonIndex);
+    if (!entry) {
+        entry = Intern(comparisonIndex);
+    }
+    return {Text(entry), entry->length};
+}
+
+std::string_view NameCache::View(int32_t comparisonIndex) {
+    const Entry* entry = Find(comparisonIndex);
+    if (!entry) {
+        entry = Intern(comparisonIndex);
+    }
+    return {Text(entry) + entry->viewOffset, entry->length - entry->viewOffset};
+}
+
+void NameCache::Append(const SDK::FName& name, std::string& out) {
+    out += Get().View(name.ComparisonIndex);
+
+    if (name.Number > 0) {
+        char digits[16];
+        auto result = std::to_chars(digits, digits + sizeof(digits), name.Number - 1);
+        out += '_';
+        out.append(digits, result.ptr);
+    }
+}
+
+bool NameCache::Equals(const SDK::FName& name, std::string_view text) {
+    std::string_view base = Get().View(name.ComparisonIndex);
+    if (name.Number == 0) {
+        return text == base;
+    }
+
+    // "Base_<Number - 1>"
+    if (text.size() <= base.size() + 1 || !text.starts_with(base) || text[base.size()] != '_') {
+        return false;
+    }
+
+    char digits[16];
+    auto result = std::to_chars(digits, digits + sizeof(digits), name.Number - 1);
+    return text.substr(base.size() + 1) == std::string_view(digits, result.ptr - digits);
+}
+
+size_t NameCache::GetCount() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Count;
+}
+
+size_t NameCache::GetArenaBytes() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_ArenaBytes;
+}
+
+const NameCache::Entry* NameCache::Find(int32_t comparisonIndex) const {
+    const Table* table = m_Table.load(std::memory_order_acquire);
+
+    for (size_t position = Hash(comparisonIndex) & table->mask;; position = (position + 1) & table->mask) {
+        const Entry* entry = table->slots[position].load(std::memory_order_acquire);
+        if (!entry || entry->comparisonIndex == comparisonIndex) {
+            return entry;
+        }
+    }
+}
+
+const NameCache::Entry* NameCache::Intern(int32_t comparisonIndex) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    // Another thread may have interned it while we waited
+    if (const Entry* entry = Find(comparisonIndex)) {
+        return entry;
+    }
+
+    SDK::FName name;
+    name.ComparisonIndex = comparisonIndex;
+    name.Number = 0;
+    std::string text = name.GetRawString();
+
+    size_t slash = text.rfind('/');
+
+    auto* entry = static_cast<Entry*>(Allocate(sizeof(Entry) + text.size() + 1));
+    entry->comparisonIndex = comparisonIndex;
+    entry->length = static_cast<uint32_t>(text.size());
+    entry->viewOffset = slash == std::string::npos ? 0 : static_cast<uint32_t>(slash + 1);
+    std::memcpy(entry + 1, text.c_str(), text.size() + 1);
+
+    Table* table = m_Table.load(std::memory_order_relaxed);
+    if ((m_Count + 1) * 2 > table->mask + 1) {
+        // Readers keep using the old table until they load the new one
+        auto grown = std::make_unique<Table>();
+        grown->mask = (table->mask + 1) * 2 - 1;
+        grown->slots = std::make_unique<std::atomic<const Entry*>[]>(grown->mask + 1);
+        for (size_t i = 0; i <= table->mask; i++) {
+            if (const Entry* existing = table->slots[i].load(std::memory_order_relaxed)) {
+                Insert(*grown, existing);
+            }
+        }
+
+        table = grown.get();
+        m_Tables.push_back(std::move(grown));
+        m_Table.store(table, std::memory_order_release);
+    }
+
+    Insert(*table, entry);
+    m_Count++;
+    return entry;
+}
+
+void NameCache::Insert(Table& table, const Entry* entry) {
+    size_t position = Hash(entry->comparisonIndex) & table.mask;
+    while (table.slots[position].load(std::memory_order_relaxed)) {
+        position = (position + 1) & table.mask;
+    }
+    table.slots[position].store(entry, std::memory_order_release);
+}
+
+void* NameCache::Allocate(size_t bytes) {
+    bytes = (bytes + alignof(Entry) - 1) & ~(alignof(Entry) - 1);
+
+    if (bytes > m_Remaining) {
+        size_t blockBytes = bytes > ArenaBlockBytes ? bytes : ArenaBlockBytes;
+        m_Blocks.push_back(std::make_unique<char[]>(blockBytes));
+        m_Cursor = m_Blocks.back().get();
+        m_Remaining = blockBytes;
+        m_ArenaBytes += blockBytes;
+    }
+
+    void* memory = m_Cursor;
+    m_Cursor += bytes;
+    m_Remaining -= bytes;
+    return memory;
+}
+
+} // namespace Broadsword
+
+// SDK FName::View() - declared in the patched Basic.hpp
+std::string_view SDK::FName::View() const {
+    return Broadsword::NameCache::Get().View(ComparisonIndex);
+}
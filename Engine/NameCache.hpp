@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../Engine/SDK/SDK/Basic.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * NameCache - Process-wide FName text cache
+ *
+ * FName::GetRawString() calls the engine's AppendString into a temporary
+ * FString and converts it to a new std::string every time. NameCache asks
+ * the engine once per ComparisonIndex, keeps the UTF-8 text in an
+ * append-only arena and hands out string_views into it. SDK FName::View()
+ * and FName::ToString() (and so UObject::GetName()) go through it.
+ *
+ * Lookups are an open-addressed table of entry pointers read with acquire
+ * loads - no lock, no allocation. Misses take a mutex, call the engine once
+ * and publish the entry; growing publishes a new table (old tables are kept,
+ * so readers never see freed memory).
+ *
+ * Views stay valid for the lifetime of the process.
+ *
+ * Thread Safety:
+ * - Everything can be called from any thread
+ *
+ * Usage:
+ *   std::string_view name = object->Name.View();         // "Willie_BP_C"
+ *   std::string_view raw = NameCache::Get().Raw(index);  // "/Game/Character/Willie_BP_C"
+ *
+ *   std::string fullName;
+ *   NameCache::Append(object->Name, fullName);            // "Root_2" (with the number suffix)
+ */
+class NameCache {
+public:
+    static NameCache& Get();
+
+    NameCache(const NameCache&) = delete;
+    NameCache& operator=(const NameCache&) = delete;
+
+    /**
+     * Engine text of a name entry, as FName::GetRawString() returns it for Number 0
+     */
+    std::string_view Raw(int32_t comparisonIndex);
+
+    /**
+     * Raw() after its last '/' - FName::ToString() without the number suffix
+     */
+    std::string_view View(int32_t comparisonIndex);
+
+    /**
+     * Append FName::ToString() text (View() plus "_<Number - 1>" when Number is set)
+     */
+    static void Append(const SDK::FName& name, std::string& out);
+
+    /**
+     * Whether FName::ToString() would equal text, without building it
+     */
+    static bool Equals(const SDK::FName& name, std::string_view text);
+
+    size_t GetCount() const;
+    size_t GetArenaBytes() const;
+
+private:
+    NameCache();
+
+    // Arena record, followed by the NUL-terminated text
+    struct Entry {
+        int32_t comparisonIndex;
+        uint32_t length;
+        uint32_t viewOffset; // Start of View() within the text
+    };
+
+    struct Table {
+        size_t mask;
+        std::unique_ptr<std::atomic<const Entry*>[]> slots;
+    };
+
+    static constexpr size_t InitialCapacity = 1u << 14;
+    static constexpr size_t ArenaBlockBytes = 1u << 16;
+
+    static const char* Text(const Entry* entry) { return reinterpret_cast<const char*>(entry + 1); }
+
+    const Entry* Find(int32_t comparisonIndex) const;
+    const Entry* Intern(int32_t comparisonIndex);
+    void* Allocate(size_t bytes);
+    void Insert(Table& table, const Entry* entry);
+
+    std::atomic<Table*> m_Table = nullptr;
+
+    mutable std::mutex m_Mutex;
+    std::vector<std::unique_ptr<Table>> m_Tables; // Current table last; older ones may still be read
+    std::vector<std::unique_ptr<char[]>> m_Blocks;
+    char* m_Cursor = nullptr;
+    size_t m_Remaining = 0;
+    size_t m_Count = 0;
+    size_t m_ArenaBytes = 0;
+};
+
+} // namespace Broadsword
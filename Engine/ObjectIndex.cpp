@@ -0,0 +1,389 @@
+#include "ObjectIndex.hpp"
+#include "NameCache.hpp"
+#include "ObjectPath.hpp"
+#include "../Engine/SDK/SDK/CoreUObject_classes.hpp"
+#include "../Foundation/Threading/IdleScheduler.hpp"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <tuple>
+
+namespace Broadsword {
+
+namespace {
+
+// splitmix64 finalizer
+uint64_t Mix(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ull;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBull;
+    value ^= value >> 31;
+    return value;
+}
+
+int32_t OuterIndex(const SDK::UObject* object) {
+    return object->Outer ? object->Outer->Index : -1;
+}
+
+} // namespace
+
+ObjectIndex& ObjectIndex::Get() {
+    static ObjectIndex instance;
+    return instance;
+}
+
+void ObjectIndex::Initialize() {
+    if (m_IdleTask) {
+        return;
+    }
+
+    m_IdleTask = Foundation::IdleScheduler::Get().Register("Object index sweep", std::chrono::milliseconds(1000),
+        [this]() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return Sweep(SweepSliceObjects);
+        });
+}
+
+void ObjectIndex::Shutdown() {
+    if (m_IdleTask) {
+        Foundation::IdleScheduler::Get().Unregister(m_IdleTask);
+        m_IdleTask = 0;
+    }
+}
+
+void ObjectIndex::Update() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_RefreshedThisFrame = false;
+    CatchUp(UpdateSliceObjects);
+}
+
+SDK::UObject* ObjectIndex::FindByName(std::string_view name, SDK::EClassCastFlags requiredType) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Lookups++;
+
+    CatchUp(std::numeric_limits<int32_t>::max());
+    SDK::UObject* object = Lookup(name, requiredType);
+
+    // Maybe created in a reused slot the sweep hasn't reached - re-check once per frame
+    if (!object && !m_RefreshedThisFrame) {
+        Refresh();
+        object = Lookup(name, requiredType);
+    }
+
+    if (!object) {
+        m_Misses++;
+    }
+    return object;
+}
+
+SDK::UObject* ObjectIndex::FindByFullName(std::string_view fullName, SDK::EClassCastFlags requiredType) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Lookups++;
+
+    CatchUp(std::numeric_limits<int32_t>::max());
+    SDK::UObject* object = LookupPath(fullName, requiredType);
+
+    if (!object && !m_RefreshedThisFrame) {
+        Refresh();
+        object = LookupPath(fullName, requiredType);
+    }
+
+    if (!object) {
+        m_Misses++;
+    }
+    return object;
+}
+
+ObjectIndex::Stats ObjectIndex::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return {static_cast<int32_t>(m_Slots.size()), m_SeenNames.size(), m_Lookups, m_Misses, m_Refreshes};
+}
+
+uint64_t ObjectIndex::NameKey(const SDK::FName& name) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(name.ComparisonIndex)) << 32) | name.Number;
+}
+
+uint64_t ObjectIndex::PathHash(uint64_t nameKey, int32_t outerIndex) {
+    return Mix(nameKey ^ Mix(static_cast<uint64_t>(static_cast<uint32_t>(outerIndex)) + 1));
+}
+
+void ObjectIndex::HashTable::Reset(size_t capacity) {
+    entries.assign(capacity, Entry{0, -1});
+    used = 0;
+}
+
+void ObjectIndex::HashTable::Insert(uint64_t hash, int32_t index) {
+    size_t mask = entries.size() - 1;
+    size_t position = hash & mask;
+    while (entries[position].index >= 0) {
+        position = (position + 1) & mask;
+    }
+
+    entries[position] = {static_cast<uint32_t>(hash >> 32), index};
+    used++;
+}
+
+template<typename Fn>
+void ObjectIndex::HashTable::ForEach(uint64_t hash, Fn&& fn) const {
+    if (entries.empty()) {
+        return;
+    }
+
+    size_t mask = entries.size() - 1;
+    uint32_t tag = static_cast<uint32_t>(hash >> 32);
+    for (size_t position = hash & mask; entries[position].index >= 0; position = (position + 1) & mask) {
+        if (entries[position].tag == tag) {
+            fn(entries[position].index);
+        }
+    }
+}
+
+void ObjectIndex::CatchUp(int32_t maxObjects) {
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t begin = static_cast<int32_t>(m_Slots.size());
+    int32_t count = objects->Num();
+    if (begin >= count) {
+        return;
+    }
+
+    int32_t end = count - begin > maxObjects ? begin + maxObjects : count;
+    m_Slots.resize(end);
+
+    for (int32_t i = begin; i < end; i++) {
+        if (SDK::UObject* object = objects->GetByIndex(i)) {
+            IndexSlot(i, object);
+        }
+    }
+}
+
+bool ObjectIndex::Sweep(int32_t maxObjects) {
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t count = static_cast<int32_t>(m_Slots.size());
+    int32_t end = std::min(count, m_SweepCursor + maxObjects);
+
+    // Full check (pointer, name and outer) - also catches renamed objects
+    for (int32_t i = m_SweepCursor; i < end; i++) {
+        if (SDK::UObject* object = objects->GetByIndex(i)) {
+            IndexSlot(i, object);
+        } else {
+            m_Slots[i] = {};
+        }
+    }
+
+    m_SweepCursor = end;
+    if (m_SweepCursor >= count) {
+        m_SweepCursor = 0;
+        return false;
+    }
+    return true;
+}
+
+void ObjectIndex::Refresh() {
+    m_RefreshedThisFrame = true;
+    m_Refreshes++;
+
+    // Pointer check only - a reused slot holds a different object
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t count = static_cast<int32_t>(m_Slots.size());
+    for (int32_t i = 0; i < count; i++) {
+        SDK::UObject* object = objects->GetByIndex(i);
+        if (object == m_Slots[i].object) {
+            continue;
+        }
+
+        if (object) {
+            IndexSlot(i, object);
+        } else {
+            m_Slots[i] = {};
+        }
+    }
+}
+
+bool ObjectIndex::IndexSlot(int32_t index, SDK::UObject* object) {
+    Slot slot{object, NameKey(object->Name), OuterIndex(object)};
+    Slot& current = m_Slots[index];
+    if (current.object == slot.object && current.nameKey == slot.nameKey && current.outerIndex == slot.outerIndex) {
+        return false;
+    }
+
+    current = slot;
+    RememberName(object->Name.ComparisonIndex);
+
+    if ((m_ByName.used + 1) * 2 > m_ByName.entries.size()) {
+        Rebuild();
+        return true;
+    }
+
+    m_ByName.Insert(Mix(slot.nameKey), index);
+    m_ByPath.Insert(PathHash(slot.nameKey, slot.outerIndex), index);
+    return true;
+}
+
+void ObjectIndex::Rebuild() {
+    size_t live = 0;
+    for (const Slot& slot : m_Slots) {
+        live += slot.object != nullptr;
+    }
+
+    // Stale entries are dropped - only current slots are reinserted
+    size_t capacity = std::bit_ceil(std::max<size_t>(1024, live * 4));
+    m_ByName.Reset(capacity);
+    m_ByPath.Reset(capacity);
+
+    for (int32_t i = 0; i < static_cast<int32_t>(m_Slots.size()); i++) {
+        const Slot& slot = m_Slots[i];
+        if (slot.object) {
+            m_ByName.Insert(Mix(slot.nameKey), i);
+            m_ByPath.Insert(PathHash(slot.nameKey, slot.outerIndex), i);
+        }
+    }
+}
+
+bool ObjectIndex::IsCurrent(int32_t index) const {
+    const Slot& slot = m_Slots[index];
+    SDK::UObject* object = SDK::UObject::GObjects->GetByIndex(index);
+    return object && object == slot.object && NameKey(object->Name) == slot.nameKey &&
+           OuterIndex(object) == slot.outerIndex;
+}
+
+void ObjectIndex::RememberName(int32_t comparisonIndex) {
+    if (m_SeenNames.insert(comparisonIndex).second) {
+        m_NameIds.emplace(NameCache::Get().View(comparisonIndex), comparisonIndex);
+    }
+}
+
+void ObjectIndex::CandidateKeys(std::string_view name, std::vector<uint64_t>& keys) const {
+    keys.clear();
+
+    auto [first, last] = m_NameIds.equal_range(name);
+    for (auto it = first; it != last; ++it) {
+        keys.push_back(static_cast<uint64_t>(static_cast<uint32_t>(it->second)) << 32);
+    }
+
+    // "Foo_3" may also be "Foo" with Number 4 (no leading zeros, like the engine's split)
+    size_t underscore = name.rfind('_');
+    if (underscore == std::string_view::npos || underscore + 1 >= name.size()) {
+        return;
+    }
+
+    std::string_view digits = name.substr(underscore + 1);
+    if (digits.size() > 1 && digits[0] == '0') {
+        return;
+    }
+
+    uint32_t number = 0;
+    auto result = std::from_chars(digits.data(), digits.data() + digits.size(), number);
+    if (result.ec != std::errc() || result.ptr != digits.data() + digits.size() || number == UINT32_MAX) {
+        return;
+    }
+
+    std::tie(first, last) = m_NameIds.equal_range(name.substr(0, underscore));
+    for (auto it = first; it != last; ++it) {
+        keys.push_back((static_cast<uint64_t>(static_cast<uint32_t>(it->second)) << 32) | (number + 1));
+    }
+}
+
+void ObjectIndex::RememberPrefix(uint64_t prefixHash, int32_t outerIndex) {
+    // Entries for outers that died are only replaced, so start over past the bound
+    if (m_OuterByPrefix.size() >= MaxCachedPrefixes) {
+        m_OuterByPrefix.clear();
+    }
+    m_OuterByPrefix[prefixHash] = outerIndex;
+}
+
+SDK::UObject* ObjectIndex::Lookup(std::string_view name, SDK::EClassCastFlags requiredType) {
+    std::vector<uint64_t> keys;
+    CandidateKeys(name, keys);
+
+    int32_t best = -1;
+    for (uint64_t key : keys) {
+        m_ByName.ForEach(Mix(key), [&](int32_t index) {
+            if ((best < 0 || index < best) && m_Slots[index].nameKey == key && IsCurrent(index) &&
+                m_Slots[index].object->HasTypeFlag(requiredType)) {
+                best = index;
+            }
+        });
+    }
+
+    return best >= 0 ? m_Slots[best].object : nullptr;
+}
+
+SDK::UObject* ObjectIndex::LookupPath(std::string_view fullName, SDK::EClassCastFlags requiredType) {
+    // "ClassName Outermost.Outer.Name"
+    size_t space = fullName.find(' ');
+    if (space == std::string_view::npos) {
+        return nullptr;
+    }
+
+    std::string_view className = fullName.substr(0, space);
+    std::string_view path = fullName.substr(space + 1);
+
+    // Outer prefix resolved by an earlier lookup - only the last component is left
+    std::vector<int32_t> outers{-1};
+    size_t start = 0;
+
+    size_t lastDot = path.rfind('.');
+    uint64_t prefixHash = 0;
+    if (lastDot != std::string_view::npos) {
+        std::string_view prefix = path.substr(0, lastDot);
+        prefixHash = std::hash<std::string_view>{}(prefix);
+
+        auto cached = m_OuterByPrefix.find(prefixHash);
+        if (cached != m_OuterByPrefix.end() && IsCurrent(cached->second) &&
+            ObjectPath::Get().PathEquals(m_Slots[cached->second].object, prefix)) {
+            outers[0] = cached->second;
+            start = lastDot + 1;
+        }
+    }
+
+    // Resolve one component at a time, keyed by (name, outer)
+    std::vector<int32_t> next;
+    std::vector<uint64_t> keys;
+
+    for (;;) {
+        size_t dot = path.find('.', start);
+        if (dot == std::string_view::npos && start > 0 && outers.size() == 1) {
+            RememberPrefix(prefixHash, outers[0]);
+        }
+        CandidateKeys(path.substr(start, dot == std::string_view::npos ? std::string_view::npos : dot - start), keys);
+
+        next.clear();
+        for (int32_t outer : outers) {
+            for (uint64_t key : keys) {
+                m_ByPath.ForEach(PathHash(key, outer), [&](int32_t index) {
+                    const Slot& slot = m_Slots[index];
+                    if (slot.nameKey == key && slot.outerIndex == outer && IsCurrent(index)) {
+                        next.push_back(index);
+                    }
+                });
+            }
+        }
+
+        if (next.empty()) {
+            return nullptr;
+        }
+        outers.swap(next);
+
+        if (dot == std::string_view::npos) {
+            break;
+        }
+        start = dot + 1;
+    }
+
+    int32_t best = -1;
+    for (int32_t index : outers) {
+        SDK::UObject* object = m_Slots[index].object;
+        if ((best < 0 || index < best) && object->Class && object->HasTypeFlag(requiredType) &&
+            NameCache::Equals(object->Class->Name, className)) {
+            best = index;
+        }
+    }
+
+    return best >= 0 ? m_Slots[best].object : nullptr;
+}
+
+} // namespace Broadsword
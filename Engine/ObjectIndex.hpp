@@ -0,0 +1,171 @@
+#pragma once
+
+#include "../Engine/SDK/SDK/Basic.hpp"
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * ObjectIndex - Hashed name/path index over GObjects
+ *
+ * Backs SDK::UObject::FindObject/FindObjectFast (and so every StaticClass()
+ * first call) instead of a linear GObjects scan that builds a name string per
+ * object. Objects are indexed by FName (ComparisonIndex + Number) and by
+ * FName plus outer, so "Class Package.Outer.Name" resolves one path component
+ * at a time with hash lookups. Resolved outers are remembered by a hash of
+ * their path prefix, so repeat lookups under the same outer check that
+ * prefix against ObjectPath's cache and hash only the last component.
+ *
+ * Name text comes from NameCache (FName::View()); the query string is split
+ * into its possible FNames ("Foo_3" is either "Foo_3" or "Foo" number 4) and
+ * only those keys are looked up.
+ *
+ * Maintenance:
+ * - Update() (once per frame) indexes slots appended to GObjects since the
+ *   last call, in bounded slices; lookups catch up on the rest first
+ * - Slots reused for new objects are picked up by an idle-time sweep, and by
+ *   a full re-check the first time a lookup misses in a frame
+ * - Every hit is validated against the slot's current object, FName and outer
+ *
+ * Engine serial numbers are only assigned once a weak pointer to the object
+ * exists, so slot reuse is detected by object pointer + FName + outer instead.
+ *
+ * Thread Safety:
+ * - Lookups can be called from any thread (one mutex, held for the lookup)
+ * - Initialize(), Shutdown() and Update() run on the game thread
+ *
+ * Usage:
+ *   SDK::UObject* object = ObjectIndex::Get().FindByName("Willie_BP_C", SDK::EClassCastFlags::Class);
+ *   SDK::UObject* actor = ObjectIndex::Get().FindByFullName("Class Engine.Actor", SDK::EClassCastFlags::Class);
+ */
+class ObjectIndex {
+public:
+    struct Stats {
+        int32_t indexedSlots = 0;  // GObjects slots scanned so far
+        size_t names = 0;          // Distinct ComparisonIndex values seen
+        uint64_t lookups = 0;
+        uint64_t misses = 0;       // Lookups that found nothing (after the re-check)
+        uint64_t refreshes = 0;    // Full re-checks triggered by a miss
+    };
+
+    static ObjectIndex& Get();
+
+    ObjectIndex(const ObjectIndex&) = delete;
+    ObjectIndex& operator=(const ObjectIndex&) = delete;
+
+    /**
+     * Register the idle-time sweep for reused slots
+     */
+    void Initialize();
+    void Shutdown();
+
+    /**
+     * Index GObjects slots appended since the last call (a bounded slice)
+     *
+     * Call once per frame on the game thread.
+     */
+    void Update();
+
+    /**
+     * Lowest-index object with this name (UObject::GetName())
+     *
+     * @param name Object name, e.g. "Willie_BP_C"
+     * @param requiredType Object class must have one of these cast flags (SDK HasTypeFlag)
+     * @return Object, or nullptr if none matches
+     */
+    SDK::UObject* FindByName(std::string_view name, SDK::EClassCastFlags requiredType);
+
+    /**
+     * Lowest-index object with this full name (UObject::GetFullName())
+     *
+     * @param fullName "ClassName Outer.Object", e.g. "Class Engine.Actor"
+     * @param requiredType Object class must have one of these cast flags (SDK HasTypeFlag)
+     * @return Object, or nullptr if none matches
+     */
+    SDK::UObject* FindByFullName(std::string_view fullName, SDK::EClassCastFlags requiredType);
+
+    Stats GetStats() const;
+
+private:
+    ObjectIndex() = default;
+
+    // Indexed state of one GObjects slot
+    struct Slot {
+        SDK::UObject* object = nullptr;
+        uint64_t nameKey = 0;
+        int32_t outerIndex = -1;
+    };
+
+    /**
+     * Open-addressed hash -> slot index multimap
+     *
+     * Stores only a hash tag and the slot index; every candidate is checked
+     * against its Slot. Entries for reindexed slots go stale and are dropped
+     * when the table is rebuilt.
+     */
+    struct HashTable {
+        struct Entry {
+            uint32_t tag;
+            int32_t index; // -1 = empty
+        };
+
+        std::vector<Entry> entries;
+        size_t used = 0;
+
+        void Reset(size_t capacity);
+        void Insert(uint64_t hash, int32_t index);
+
+        template<typename Fn>
+        void ForEach(uint64_t hash, Fn&& fn) const;
+    };
+
+    static constexpr int32_t UpdateSliceObjects = 16384;
+    static constexpr int32_t SweepSliceObjects = 4096;
+    static constexpr size_t MaxCachedPrefixes = 1u << 14;
+
+    static uint64_t NameKey(const SDK::FName& name);
+    static uint64_t PathHash(uint64_t nameKey, int32_t outerIndex);
+
+    void CatchUp(int32_t maxObjects);
+    bool Sweep(int32_t maxObjects);
+    void Refresh();
+    bool IndexSlot(int32_t index, SDK::UObject* object);
+    void Rebuild();
+
+    bool IsCurrent(int32_t index) const;
+    void RememberName(int32_t comparisonIndex);
+    void CandidateKeys(std::string_view name, std::vector<uint64_t>& keys) const;
+    void RememberPrefix(uint64_t prefixHash, int32_t outerIndex);
+
+    SDK::UObject* Lookup(std::string_view name, SDK::EClassCastFlags requiredType);
+    SDK::UObject* LookupPath(std::string_view fullName, SDK::EClassCastFlags requiredType);
+
+    mutable std::mutex m_Mutex;
+
+    std::vector<Slot> m_Slots;
+    HashTable m_ByName;
+    HashTable m_ByPath;
+
+    // FName::View() text of every indexed ComparisonIndex -> ComparisonIndex
+    std::unordered_set<int32_t> m_SeenNames;
+    std::unordered_multimap<std::string_view, int32_t> m_NameIds;
+
+    // Hash of "Package.Outer" -> outer slot index, checked with ObjectPath::PathEquals()
+    std::unordered_map<uint64_t, int32_t> m_OuterByPrefix;
+
+    int32_t m_SweepCursor = 0;
+    bool m_RefreshedThisFrame = false;
+    uint32_t m_IdleTask = 0;
+
+    uint64_t m_Lookups = 0;
+    uint64_t m_Misses = 0;
+    uint64_t m_Refreshes = 0;
+};
+
+} // namespace Broadsword
@@ -0,0 +1,155 @@
+#include "ObjectPath.hpp"
+#include "NameCache.hpp"
+#include "../Engine/SDK/SDK/CoreUObject_classes.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace Broadsword {
+
+ObjectPath& ObjectPath::Get() {
+    static ObjectPath instance;
+    return instance;
+}
+
+void ObjectPath::Writer::Append(std::string_view text) {
+    if (length + 1 < capacity) {
+        size_t count = std::min(text.size(), capacity - 1 - length);
+        std::memcpy(buffer + length, text.data(), count);
+    }
+    length += text.size();
+}
+
+void ObjectPath::Writer::Append(const SDK::FName& name) {
+    Append(name.View());
+
+    if (name.Number > 0) {
+        char digits[16];
+        digits[0] = '_';
+        auto result = std::to_chars(digits + 1, digits + sizeof(digits), name.Number - 1);
+        Append(std::string_view(digits, result.ptr - digits));
+    }
+}
+
+size_t ObjectPath::Writer::Finish() {
+    if (capacity > 0) {
+        buffer[std::min(length, capacity - 1)] = '\0';
+    }
+    return length;
+}
+
+size_t ObjectPath::WriteFullName(const SDK::UObject* object, char* buffer, size_t capacity) {
+    Writer writer{buffer, capacity};
+
+    if (!object || !object->Class) {
+        writer.Append("None");
+        return writer.Finish();
+    }
+
+    writer.Append(object->Class->Name);
+    writer.Append(" ");
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        writer.Append(OuterPrefix(object));
+    }
+    writer.Append(object->Name);
+    return writer.Finish();
+}
+
+size_t ObjectPath::WritePath(const SDK::UObject* object, char* buffer, size_t capacity) {
+    Writer writer{buffer, capacity};
+
+    if (!object) {
+        writer.Append("None");
+        return writer.Finish();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        writer.Append(OuterPrefix(object));
+    }
+    writer.Append(object->Name);
+    return writer.Finish();
+}
+
+std::string ObjectPath::GetFullName(const SDK::UObject* object) {
+    char stackBuffer[256];
+    size_t length = WriteFullName(object, stackBuffer, sizeof(stackBuffer));
+    if (length < sizeof(stackBuffer)) {
+        return std::string(stackBuffer, length);
+    }
+
+    // Deep or long paths - format again at the exact size
+    std::string result(length, '\0');
+    WriteFullName(object, result.data(), length + 1);
+    return result;
+}
+
+bool ObjectPath::PathEquals(const SDK::UObject* object, std::string_view path) {
+    if (!object) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        const std::string& prefix = OuterPrefix(object);
+        if (!path.starts_with(prefix)) {
+            return false;
+        }
+        path.remove_prefix(prefix.size());
+    }
+
+    return NameCache::Equals(object->Name, path);
+}
+
+ObjectPath::Stats ObjectPath::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return {m_Prefixes.size(), m_Hits, m_Misses};
+}
+
+uint64_t ObjectPath::ChainKey(const SDK::UObject* outer) {
+    uint64_t key = 0x9E3779B97F4A7C15ull;
+    for (; outer; outer = outer->Outer) {
+        uint64_t name = (static_cast<uint64_t>(static_cast<uint32_t>(outer->Name.ComparisonIndex)) << 32) |
+                        outer->Name.Number;
+        key = (key ^ reinterpret_cast<uintptr_t>(outer)) * 0xBF58476D1CE4E5B9ull;
+        key = (key ^ name) * 0x94D049BB133111EBull;
+        key ^= key >> 31;
+    }
+    return key;
+}
+
+const std::string& ObjectPath::OuterPrefix(const SDK::UObject* object) {
+    if (!object->Outer) {
+        return m_Empty;
+    }
+
+    // Outers that died leave their entries behind - start over past the bound
+    if (m_Prefixes.size() >= MaxPrefixes) {
+        m_Prefixes.clear();
+    }
+
+    return PrefixOf(object->Outer);
+}
+
+const std::string& ObjectPath::PrefixOf(const SDK::UObject* outer) {
+    uint64_t chainKey = ChainKey(outer);
+
+    auto it = m_Prefixes.find(outer);
+    if (it != m_Prefixes.end() && it->second.chainKey == chainKey) {
+        m_Hits++;
+        return it->second.text;
+    }
+    m_Misses++;
+
+    std::string text = outer->Outer ? PrefixOf(outer->Outer) : std::string();
+    NameCache::Append(outer->Name, text);
+    text += '.';
+
+    Prefix& prefix = m_Prefixes[outer];
+    prefix.chainKey = chainKey;
+    prefix.text = std::move(text);
+    return prefix.text;
+}
+
+} // namespace Broadsword
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "../Engine/SDK/SDK/Basic.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Broadsword {
+
+/**
+ * ObjectPath - Object path formatting with cached outer prefixes
+ *
+ * The generated UObject::GetFullName() prepended every outer's name to a
+ * temporary string in a loop - quadratic copying and a name lookup per
+ * level on every call - and now forwards here. ObjectPath keeps the
+ * "Package.Outer." prefix of each outer it has formatted and writes names
+ * into a caller-supplied buffer using interned text (NameCache), so
+ * formatting an object under a known outer does not allocate.
+ *
+ * A cached prefix is keyed by the outer and validated against a hash of its
+ * outer chain (object pointers and FNames), walked on every use. Outers
+ * that are renamed, moved or reused for another object get a fresh prefix.
+ *
+ * Thread Safety:
+ * - Everything can be called from any thread (one mutex, held while a prefix is copied)
+ *
+ * Usage:
+ *   char buffer[256];
+ *   size_t length = ObjectPath::Get().WriteFullName(object, buffer, sizeof(buffer));
+ *   // buffer = "Class Engine.Actor"; length > sizeof(buffer) - 1 means it was cut short
+ *
+ *   if (ObjectPath::Get().PathEquals(object, "Engine.Actor")) { ... }
+ */
+class ObjectPath {
+public:
+    struct Stats {
+        size_t prefixes = 0;   // Outers with a cached prefix
+        uint64_t hits = 0;
+        uint64_t misses = 0;   // Prefixes built (first use, or the outer chain changed)
+    };
+
+    static ObjectPath& Get();
+
+    ObjectPath(const ObjectPath&) = delete;
+    ObjectPath& operator=(const ObjectPath&) = delete;
+
+    /**
+     * Write "ClassName Package.Outer.Object" (UObject::GetFullName())
+     *
+     * Like snprintf: writes at most capacity - 1 characters plus a NUL and
+     * returns the full length, so a larger result means the buffer was too small.
+     *
+     * @param object Object to format ("None" if null or classless)
+     * @param buffer Destination, may be null if capacity is 0
+     * @param capacity Size of buffer in bytes
+     * @return Length of the full name, excluding the NUL
+     */
+    size_t WriteFullName(const SDK::UObject* object, char* buffer, size_t capacity);
+
+    /**
+     * Write "Package.Outer.Object" - WriteFullName() without the class name
+     */
+    size_t WritePath(const SDK::UObject* object, char* buffer, size_t capacity);
+
+    /**
+     * UObject::GetFullName() as a std::string
+     */
+    std::string GetFullName(const SDK::UObject* object);
+
+    /**
+     * Whether WritePath() would produce path, without formatting it
+     *
+     * Compares the cached outer prefix, then the object's own name.
+     */
+    bool PathEquals(const SDK::UObject* object, std::string_view path);
+
+    Stats GetStats() const;
+
+private:
+    ObjectPath() = default;
+
+    struct Prefix {
+        uint64_t chainKey = 0;
+        std::string text; // "Package.Outer." - empty for objects without an outer
+    };
+
+    // Bound on cached prefixes; outers that died are dropped on the next clear
+    static constexpr size_t MaxPrefixes = 1u << 16;
+
+    // Buffer cursor that counts what didn't fit
+    struct Writer {
+        char* buffer;
+        size_t capacity;
+        size_t length = 0;
+
+        void Append(std::string_view text);
+        void Append(const SDK::FName& name);
+        size_t Finish();
+    };
+
+    static uint64_t ChainKey(const SDK::UObject* outer);
+
+    const std::string& PrefixOf(const SDK::UObject* outer);
+    const std::string& OuterPrefix(const SDK::UObject* object);
+
+    mutable std::mutex m_Mutex;
+    std::unordered_map<const SDK::UObject*, Prefix> m_Prefixes;
+    std::string m_Empty;
+
+    uint64_t m_Hits = 0;
+    uint64_t m_Misses = 0;
+};
+
+} // namespace Broadsword
@@ -0,0 +1,121 @@
+#include "ObjectScan.hpp"
+#include "ClassHierarchy.hpp"
+#include "../Engine/SDK/SDK/CoreUObject_classes.hpp"
+#include "../Foundation/Threading/WorkerPool.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace Broadsword {
+
+ObjectScan& ObjectScan::Get() {
+    static ObjectScan instance;
+    return instance;
+}
+
+int32_t ObjectScan::Snapshot() {
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t count = std::min(objects->Num(), objects->NumChunks * SDK::TUObjectArray::ElementsPerChunk);
+    return std::max(count, 0);
+}
+
+size_t ObjectScan::RangeCount(int32_t count) {
+    return (static_cast<size_t>(count) + RangeSlots - 1) / RangeSlots;
+}
+
+template<typename Visit>
+void ObjectScan::Scan(const ObjectScanFilter& filter, int32_t count, Visit&& visit) {
+    auto start = std::chrono::steady_clock::now();
+
+    SDK::FUObjectItem** chunkTable = SDK::UObject::GObjects->GetDecrytedObjPtr();
+    bool checkFlags = filter.castFlags != SDK::EClassCastFlags::None;
+
+    // Ranges are RangeSlots apart from 0; a pool that isn't running hands over the whole span
+    Foundation::WorkerPool::Get().ParallelFor(0, count, RangeSlots, [&](size_t begin, size_t end) {
+        for (size_t rangeBegin = begin; rangeBegin < end; rangeBegin += RangeSlots) {
+            size_t rangeEnd = std::min(rangeBegin + RangeSlots, end);
+            size_t range = rangeBegin / RangeSlots;
+
+            int32_t chunkIndex = static_cast<int32_t>(rangeBegin / SDK::TUObjectArray::ElementsPerChunk);
+            SDK::FUObjectItem* chunk = chunkTable[chunkIndex];
+            if (!chunk) {
+                continue;
+            }
+            size_t chunkBase = static_cast<size_t>(chunkIndex) * SDK::TUObjectArray::ElementsPerChunk;
+
+            for (size_t index = rangeBegin; index < rangeEnd; index++) {
+                SDK::UObject* object = chunk[index - chunkBase].Object;
+                if (!object || !object->Class) {
+                    continue;
+                }
+                if (checkFlags && !object->HasTypeFlag(filter.castFlags)) {
+                    continue;
+                }
+                if (!filter.includeDefaultObjects &&
+                    static_cast<bool>(object->Flags & SDK::EObjectFlags::ClassDefaultObject)) {
+                    continue;
+                }
+                if (filter.objectClass && !ClassHierarchy::Get().IsA(object->Class, filter.objectClass)) {
+                    continue;
+                }
+                if (filter.predicate && !filter.predicate(object)) {
+                    continue;
+                }
+                visit(range, object);
+            }
+        }
+    });
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    m_Scans.fetch_add(1, std::memory_order_relaxed);
+    m_Slots.fetch_add(static_cast<uint64_t>(count), std::memory_order_relaxed);
+    m_LastScanUs.store(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(),
+                       std::memory_order_relaxed);
+}
+
+std::vector<SDK::UObject*> ObjectScan::Find(const ObjectScanFilter& filter) {
+    int32_t count = Snapshot();
+    std::vector<std::vector<SDK::UObject*>> ranges(RangeCount(count));
+
+    // Each range is written by one thread only
+    Scan(filter, count, [&](size_t range, SDK::UObject* object) {
+        ranges[range].push_back(object);
+    });
+
+    size_t total = 0;
+    for (const auto& range : ranges) {
+        total += range.size();
+    }
+
+    std::vector<SDK::UObject*> results;
+    results.reserve(total);
+    for (const auto& range : ranges) {
+        results.insert(results.end(), range.begin(), range.end());
+    }
+    return results;
+}
+
+size_t ObjectScan::Count(const ObjectScanFilter& filter) {
+    int32_t count = Snapshot();
+    // One cache line per range so neighbouring ranges don't share one
+    struct alignas(64) Tally {
+        size_t matches = 0;
+    };
+    std::vector<Tally> ranges(RangeCount(count));
+
+    Scan(filter, count, [&](size_t range, SDK::UObject*) {
+        ranges[range].matches++;
+    });
+
+    size_t total = 0;
+    for (const Tally& tally : ranges) {
+        total += tally.matches;
+    }
+    return total;
+}
+
+ObjectScan::Stats ObjectScan::GetStats() const {
+    return {m_Scans.load(std::memory_order_relaxed), m_Slots.load(std::memory_order_relaxed),
+            m_LastScanUs.load(std::memory_order_relaxed)};
+}
+
+} // namespace Broadsword
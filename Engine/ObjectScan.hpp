@@ -0,0 +1,96 @@
+#pragma once
+
+#include "../Engine/SDK/SDK/Basic.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * What a GObjects scan keeps
+ *
+ * Checks run cheapest first, and every field left at its default matches
+ * anything:
+ * - castFlags:   object->Class has one of these cast flags (SDK HasTypeFlag)
+ * - objectClass: object->IsA(objectClass), answered by ClassHierarchy
+ * - predicate:   anything else; runs on worker threads, so it may only read
+ *                object memory (no ProcessEvent, no engine calls)
+ */
+struct ObjectScanFilter {
+    SDK::EClassCastFlags castFlags = SDK::EClassCastFlags::None;
+    const SDK::UClass* objectClass = nullptr;
+    std::function<bool(SDK::UObject*)> predicate;
+    bool includeDefaultObjects = true;
+};
+
+/**
+ * ObjectScan - Parallel scan of GObjects
+ *
+ * "Find every object of class X" and dumps over GObjects visit hundreds of
+ * thousands of slots. ObjectScan splits the array's chunks
+ * (TUObjectArray::ElementsPerChunk slots each) into quarter-chunk ranges and
+ * spreads them across the WorkerPool. The calling thread scans ranges too.
+ * Each range walks its chunk's items directly and keeps its own result list.
+ * The lists are concatenated in range order, so results come out in
+ * GObjects index order like a linear scan.
+ *
+ * The scan covers the NumElements snapshot taken when it starts. It must run
+ * on the game thread in the frame (the caller blocks until the scan is done,
+ * so garbage collection can't free objects under the workers). This is the
+ * one sanctioned exception to "workers never touch the SDK" - they only read.
+ *
+ * Thread Safety:
+ * - Find()/Count() are game thread only
+ *
+ * Usage:
+ *   auto pawns = ObjectScan::Get().Find({.objectClass = SDK::APawn::StaticClass(),
+ *                                        .includeDefaultObjects = false});
+ *
+ *   size_t functions = ObjectScan::Get().Count({.castFlags = SDK::EClassCastFlags::Function});
+ */
+class ObjectScan {
+public:
+    struct Stats {
+        uint64_t scans = 0;
+        uint64_t slots = 0;         // Slots visited across all scans
+        uint64_t lastScanUs = 0;    // Wall time of the last scan
+    };
+
+    static ObjectScan& Get();
+
+    ObjectScan(const ObjectScan&) = delete;
+    ObjectScan& operator=(const ObjectScan&) = delete;
+
+    /**
+     * Every object passing the filter, in GObjects index order
+     */
+    std::vector<SDK::UObject*> Find(const ObjectScanFilter& filter);
+
+    /**
+     * Number of objects passing the filter
+     */
+    size_t Count(const ObjectScanFilter& filter);
+
+    Stats GetStats() const;
+
+private:
+    ObjectScan() = default;
+
+    // Ranges never straddle a chunk
+    static constexpr int32_t RangeSlots = SDK::TUObjectArray::ElementsPerChunk / 4;
+
+    // Slots to scan: NumElements now, within the allocated chunks
+    static int32_t Snapshot();
+    static size_t RangeCount(int32_t count);
+
+    template<typename Visit>
+    void Scan(const ObjectScanFilter& filter, int32_t count, Visit&& visit);
+
+    std::atomic<uint64_t> m_Scans = 0;
+    std::atomic<uint64_t> m_Slots = 0;
+    std::atomic<uint64_t> m_LastScanUs = 0;
+};
+
+} // namespace Broadsword
@@ -0,0 +1,137 @@
+#include "ParamLayout.hpp"
+#include "../Foundation/Threading/EpochReclaimer.hpp"
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+namespace Broadsword {
+
+namespace {
+
+// Published UFunction -> layout map, replaced copy-on-write. Layouts belong to the
+// cache (retired one by one), not to the snapshot that lists them.
+struct Snapshot {
+    std::unordered_map<SDK::UFunction*, const ParamLayout*> layouts;
+};
+
+std::atomic<const Snapshot*> g_Snapshot = nullptr;
+std::mutex g_WriteMutex;
+
+uint64_t NameKey(const SDK::FName& name) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(name.ComparisonIndex)) << 32) | name.Number;
+}
+
+const ParamLayout* Lookup(const Snapshot* snapshot, SDK::UFunction* function) {
+    if (!snapshot) {
+        return nullptr;
+    }
+    auto it = snapshot->layouts.find(function);
+    return it != snapshot->layouts.end() ? it->second : nullptr;
+}
+
+} // namespace
+
+const ParamLayout& ParamLayout::Get(SDK::UFunction* function) {
+    {
+        Foundation::EpochReclaimer::Guard guard;
+        const ParamLayout* layout = Lookup(g_Snapshot.load(std::memory_order_acquire), function);
+        if (layout && layout->IsFor(function)) {
+            return *layout;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(g_WriteMutex);
+    const Snapshot* current = g_Snapshot.load(std::memory_order_relaxed);
+
+    // Built by another thread while this one waited
+    const ParamLayout* stale = Lookup(current, function);
+    if (stale && stale->IsFor(function)) {
+        return *stale;
+    }
+
+    // Same address but a different function (old one was garbage collected) - replace it
+    auto* next = current ? new Snapshot(*current) : new Snapshot();
+    const ParamLayout* layout = Build(function).release();
+    next->layouts[function] = layout;
+
+    g_Snapshot.store(next, std::memory_order_release);
+    if (current) {
+        Foundation::EpochReclaimer::Get().Retire(const_cast<Snapshot*>(current));
+    }
+    if (stale) {
+        Foundation::EpochReclaimer::Get().Retire(const_cast<ParamLayout*>(stale));
+    }
+
+    return *layout;
+}
+
+void ParamLayout::ClearCache() {
+    std::lock_guard<std::mutex> lock(g_WriteMutex);
+
+    const Snapshot* previous = g_Snapshot.exchange(nullptr, std::memory_order_acq_rel);
+    if (!previous) {
+        return;
+    }
+
+    for (const auto& [function, layout] : previous->layouts) {
+        Foundation::EpochReclaimer::Get().Retire(const_cast<ParamLayout*>(layout));
+    }
+    Foundation::EpochReclaimer::Get().Retire(const_cast<Snapshot*>(previous));
+}
+
+bool ParamLayout::IsFor(SDK::UFunction* function) const {
+    return m_FunctionIndex == function->Index && m_FunctionName == NameKey(function->Name);
+}
+
+const ParamInfo* ParamLayout::Find(std::string_view name) const {
+    for (const ParamInfo& param : m_Params) {
+        if (param.name == name) {
+            return &param;
+        }
+    }
+    return nullptr;
+}
+
+int32_t ParamLayout::ParmsSize(const SDK::UFunction* function) {
+    // uint16 ParmsSize, inside the SDK's Pad_B4 (after FunctionFlags and uint8 NumParms)
+    constexpr size_t ParmsSizeOffset = 0xB6;
+    static_assert(ParmsSizeOffset >= offsetof(SDK::UFunction, FunctionFlags) + sizeof(uint32_t) &&
+                  ParmsSizeOffset + sizeof(uint16_t) <= offsetof(SDK::UFunction, ExecFunction));
+
+    uint16_t size;
+    std::memcpy(&size, reinterpret_cast<const uint8_t*>(function) + ParmsSizeOffset, sizeof(size));
+    return size;
+}
+
+std::unique_ptr<ParamLayout> ParamLayout::Build(SDK::UFunction* function) {
+    std::unique_ptr<ParamLayout> layout(new ParamLayout());
+    layout->m_FunctionIndex = function->Index;
+    layout->m_FunctionName = NameKey(function->Name);
+    layout->m_ParamsSize = function->Size;
+
+    // ChildProperties lists parameters in declaration order (locals of BP functions follow,
+    // without the Parm flag)
+    for (SDK::FField* field = function->ChildProperties; field; field = field->Next) {
+        auto* property = static_cast<SDK::FProperty*>(field);
+        if ((property->PropertyFlags & static_cast<uint64_t>(SDK::EPropertyFlags::Parm)) == 0) {
+            continue;
+        }
+
+        ParamInfo info;
+        info.name = field->Name.ToString();
+        info.type = field->ClassPrivate ? field->ClassPrivate->Name.ToString() : std::string();
+        info.offset = property->Offset;
+        info.size = property->ElementSize * (property->ArrayDim > 0 ? property->ArrayDim : 1);
+        info.flags = property->PropertyFlags;
+
+        if (info.IsReturn()) {
+            layout->m_ReturnIndex = static_cast<int32_t>(layout->m_Params.size());
+        }
+
+        layout->m_Params.push_back(std::move(info));
+    }
+
+    return layout;
+}
+
+} // namespace Broadsword
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "../Engine/SDK/SDK.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * ParamInfo - One parameter of a UFunction's ProcessEvent parameter block
+ */
+struct ParamInfo {
+    std::string name;     // Parameter name (e.g., "DamageAmount", "ReturnValue")
+    std::string type;     // Property class name (e.g., "FloatProperty", "StructProperty")
+    int32_t offset = 0;   // Byte offset inside the params block
+    int32_t size = 0;     // ElementSize * ArrayDim
+    uint64_t flags = 0;   // EPropertyFlags
+
+    bool IsReturn() const { return (flags & static_cast<uint64_t>(SDK::EPropertyFlags::ReturnParm)) != 0; }
+
+    // Out-params (non-const reference or by-ref output) - written by the original
+    bool IsOutput() const {
+        return IsReturn() ||
+               ((flags & static_cast<uint64_t>(SDK::EPropertyFlags::OutParm)) != 0 &&
+                (flags & static_cast<uint64_t>(SDK::EPropertyFlags::ConstParm)) == 0);
+    }
+
+    // Everything the caller passes in (const refs count as inputs)
+    bool IsInput() const { return !IsOutput() || (flags & static_cast<uint64_t>(SDK::EPropertyFlags::ReferenceParm)) != 0; }
+};
+
+/**
+ * ParamLayout - Cached parameter layout of a UFunction
+ *
+ * Built once per UFunction by walking its ChildProperties FProperty chain,
+ * then reused for every call. Gives hooks offsets, sizes and flags for
+ * inputs, outputs and the return value without hand-computed offsets.
+ *
+ * Thread Safety:
+ * - Get() can be called from any thread: lookups read a published snapshot,
+ *   a miss builds the layout under a mutex
+ * - A built layout is immutable. One replaced (its UFunction was garbage
+ *   collected and the address reused) or dropped by ClearCache() is freed
+ *   through EpochReclaimer, so use it inside a guard - hook callbacks already
+ *   run inside the dispatch guard
+ *
+ * Usage:
+ *   const ParamLayout& layout = ParamLayout::Get(function);
+ *   if (const ParamInfo* ret = layout.ReturnValue()) {
+ *       // ret->offset, ret->size
+ *   }
+ */
+class ParamLayout {
+public:
+    /**
+     * Get the cached layout for a UFunction (built on first use)
+     *
+     * @param function UFunction (must not be null)
+     * @return Layout, valid until the function is garbage collected (see Thread Safety)
+     */
+    static const ParamLayout& Get(SDK::UFunction* function);
+
+    /**
+     * Drop all cached layouts
+     */
+    static void ClearCache();
+
+    const std::vector<ParamInfo>& Params() const { return m_Params; }
+
+    /**
+     * Find a parameter by name
+     *
+     * @param name Parameter name as declared in the SDK Params struct
+     * @return Parameter, or nullptr if the function has no such parameter
+     */
+    const ParamInfo* Find(std::string_view name) const;
+
+    /**
+     * Get the return value parameter
+     *
+     * @return Parameter, or nullptr for functions returning void
+     */
+    const ParamInfo* ReturnValue() const { return m_ReturnIndex >= 0 ? &m_Params[m_ReturnIndex] : nullptr; }
+
+    // Size of the whole params block (UStruct::Size)
+    int32_t ParamsSize() const { return m_ParamsSize; }
+
+    /**
+     * Bytes a caller passes to ProcessEvent (UFunction::ParmsSize)
+     *
+     * UStruct::Size also counts a Blueprint function's locals, which native
+     * callers don't allocate - copy this many bytes out of a params block.
+     *
+     * @param function UFunction (must not be null)
+     */
+    static int32_t ParmsSize(const SDK::UFunction* function);
+
+private:
+    ParamLayout() = default;
+
+    static std::unique_ptr<ParamLayout> Build(SDK::UFunction* function);
+
+    // Built from this function (not an earlier one at the same address)
+    bool IsFor(SDK::UFunction* function) const;
+
+    std::vector<ParamInfo> m_Params;   // Declaration order
+    int32_t m_ReturnIndex = -1;
+    int32_t m_ParamsSize = 0;
+
+    // Identity of the function this was built from (pointers can be reused after GC)
+    int32_t m_FunctionIndex = -1;
+    uint64_t m_FunctionName = 0;
+};
+
+/**
+ * ParamView - Zero-copy typed view of a ProcessEvent params block
+ *
+ * Accessors return pointers straight into the params memory, so writes in a
+ * pre-hook change what the original sees and reads in a post-hook see what
+ * the original wrote (out-params, return value). A lookup whose name is
+ * missing, or whose size doesn't match sizeof(T), returns nullptr.
+ *
+ * Usage:
+ *   ctx.hooks.HookPost("GetHealth", [](SDK::UObject* obj, ParamView params) {
+ *       if (float* health = params.Return<float>()) {
+ *           *health = 100.0f;
+ *       }
+ *   });
+ */
+class ParamView {
+public:
+    ParamView(const ParamLayout* layout, void* params)
+        : m_Layout(layout), m_Params(static_cast<uint8_t*>(params)) {}
+
+    template<typename T>
+    T* Get(std::string_view name) const {
+        return m_Layout ? Get<T>(m_Layout->Find(name)) : nullptr;
+    }
+
+    template<typename T>
+    T* Get(const ParamInfo* info) const {
+        if (!info || !m_Params || info->size != static_cast<int32_t>(sizeof(T))) {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(m_Params + info->offset);
+    }
+
+    template<typename T>
+    T* Return() const {
+        return m_Layout ? Get<T>(m_Layout->ReturnValue()) : nullptr;
+    }
+
+    // Whole params block as the SDK Params struct
+    template<typename ParamsType>
+    ParamsType* As() const {
+        if (!m_Layout || m_Layout->ParamsSize() != static_cast<int32_t>(sizeof(ParamsType))) {
+            return nullptr;
+        }
+        return reinterpret_cast<ParamsType*>(m_Params);
+    }
+
+    void* Raw() const { return m_Params; }
+    const ParamLayout* Layout() const { return m_Layout; }
+
+private:
+    const ParamLayout* m_Layout;
+    uint8_t* m_Params;
+};
+
+} // namespace Broadsword
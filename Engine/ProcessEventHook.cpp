@@ -1,15 +1,59 @@
 #include "ProcessEventHook.hpp"
+#include "CallTreeProfiler.hpp"
+#include "ClassHierarchy.hpp"
+#include "NameCache.hpp"
+#include "ProcessEventStats.hpp"
+#include "ProcessEventTrace.hpp"
 #include "../Foundation/Hooks/VTableHook.hpp"
+#include "../Foundation/Threading/EpochReclaimer.hpp"
+#include "../Foundation/Threading/GameThreadExecutor.hpp"
+#include "../Foundation/Threading/IdleScheduler.hpp"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 
 namespace Broadsword {
 
+namespace {
+
+// GObjects slots visited per idle slice
+constexpr int32_t ScanSliceObjects = 4096;
+
+// FUObjectItem is { UObject* Object; int32 Flags; int32 ClusterRootIndex; int32 SerialNumber; }
+// (the SDK only names Object and pads the rest)
+constexpr size_t SerialNumberOffset = 0x10;
+
+size_t HashVTable(void** vtable) {
+    uint64_t value = reinterpret_cast<uintptr_t>(vtable) >> 3;
+    value *= 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(value ^ (value >> 32));
+}
+
+} // namespace
+
 ProcessEventHook& ProcessEventHook::Get() {
     static ProcessEventHook instance;
     return instance;
 }
 
+int32_t ProcessEventHook::ObjectSerialNumber(int32_t index) {
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    if (index < 0 || index >= objects->Num()) {
+        return -1;
+    }
+
+    SDK::FUObjectItem* chunk = objects->GetDecrytedObjPtr()[index / SDK::TUObjectArray::ElementsPerChunk];
+    if (!chunk) {
+        return -1;
+    }
+
+    const uint8_t* item = reinterpret_cast<const uint8_t*>(&chunk[index % SDK::TUObjectArray::ElementsPerChunk]);
+    return *reinterpret_cast<const int32_t*>(item + SerialNumberOffset);
+}
+
 void ProcessEventHook::Initialize() {
+    std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
+
     if (m_Initialized) {
         std::cerr << "[ProcessEventHook] Already initialized\n";
         return;
@@ -17,141 +61,771 @@ void ProcessEventHook::Initialize() {
 
     std::cout << "[ProcessEventHook] Initializing ProcessEvent hook...\n";
 
-    // Get any UObject instance to access ProcessEvent VMT
-    // We'll hook the ProcessEvent function in the UObject VMT
-    // For now, we'll use a placeholder approach - this would need
-    // to be implemented with actual VMT hooking once we have
-    // access to a UObject instance
+    // Every UObject class vtable gets its slot swapped, keeping what it held - overrides
+    // (AActor::ProcessEvent and below) stay in the call path and reach the base through Super
+    m_OriginalProcessEvent = reinterpret_cast<ProcessEventFunc>(
+        SDK::InSDKUtils::GetImageBase() + SDK::Offsets::ProcessEvent);
+
+    if (!m_Originals) {
+        m_Originals = std::make_unique<VTableOriginal[]>(MaxVTableSlots);
+    }
+
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t count = objects->Num();
+
+    // Detours read the bitmaps unguarded - allocate once, at the array's capacity
+    if (!m_HookedBits.words) {
+        int32_t capacity = std::max(objects->MaxElements, count);
+        m_HookedBits.Allocate(capacity);
+        m_SeenBits.Allocate(capacity);
+    }
+
+    // Hooks added before the hook was installed
+    if (!m_NameIds.empty()) {
+        ResolveAll();
+    }
+    Publish();
+
+    for (int32_t i = 0; i < count; i++) {
+        if (SDK::UObject* object = objects->GetByIndex(i)) {
+            PatchVTable(object);
+        }
+    }
+    m_ScanCursor = count;
+
+    // Classes loaded later are picked up in idle time
+    m_IdleTask = Foundation::IdleScheduler::Get().Register("ProcessEvent hook scan", std::chrono::milliseconds(250),
+        [this]() { return ScanObjects(ScanSliceObjects); });
 
-    // TODO: Implement actual VMT hook
-    // For now, just mark as initialized
     m_Initialized = true;
 
-    std::cout << "[ProcessEventHook] ProcessEvent hook initialized\n";
+    std::cout << "[ProcessEventHook] ProcessEvent hook initialized (" << m_PatchedVTables.size()
+              << " vtables patched)\n";
 }
 
 void ProcessEventHook::Shutdown() {
-    if (!m_Initialized) {
-        return;
-    }
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
 
-    std::cout << "[ProcessEventHook] Shutting down ProcessEvent hook...\n";
+        if (!m_Initialized) {
+            return;
+        }
 
-    // Restore original ProcessEvent
-    if (m_OriginalProcessEvent) {
-        // TODO: Restore VMT
-        m_OriginalProcessEvent = nullptr;
-    }
+        std::cout << "[ProcessEventHook] Shutting down ProcessEvent hook...\n";
 
-    // Clear all hooks
-    ClearAllHooks();
+        Foundation::IdleScheduler::Get().Unregister(m_IdleTask);
+        m_IdleTask = 0;
 
-    m_Initialized = false;
+        // Restore each vtable's own ProcessEvent (m_Originals stays for detours still running)
+        for (void** vtable : m_PatchedVTables) {
+            Foundation::VTableHook::SwapSlot(vtable, SDK::Offsets::ProcessEventIdx,
+                                             reinterpret_cast<void*>(FindOriginal(vtable)));
+        }
+        m_PatchedVTables.clear();
+        m_CheckedVTables.clear();
+
+        // Clear all hooks
+        ClearAllHooks();
+
+        m_Initialized = false;
+    }
+
+    // Let calls still inside the detour finish, then free what they were using
+    Foundation::EpochReclaimer::Get().Synchronize();
 
     std::cout << "[ProcessEventHook] ProcessEvent hook shutdown complete\n";
 }
 
-size_t ProcessEventHook::AddHook(std::string_view functionName, HookCallback callback) {
-    size_t hookId = m_NextHookId++;
+size_t ProcessEventHook::AddHook(std::string_view functionName, HookCallback callback, const HookFilter& filter) {
+    return Add(functionName, std::move(callback), nullptr, filter);
+}
+
+size_t ProcessEventHook::AddPostHook(std::string_view functionName, PostHookCallback callback, const HookFilter& filter) {
+    return Add(functionName, nullptr, std::move(callback), filter);
+}
+
+size_t ProcessEventHook::Add(std::string_view functionName, HookCallback pre, PostHookCallback post, const HookFilter& filter) {
+    auto hook = std::make_shared<Hook>();
+    hook->pre = std::move(pre);
+    hook->post = std::move(post);
+    hook->filter = filter;
+    hook->functionOwner = filter.functionOwner;
+    hook->filter.functionOwner = hook->functionOwner;
+    hook->filtered = !filter.IsEmpty();
+    bool isPost = static_cast<bool>(hook->post);
 
-    Hook hook;
-    hook.id = hookId;
-    hook.functionName = functionName;
-    hook.callback = std::move(callback);
+    std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
+
+    size_t hookId = m_NextHookId++;
+    hook->id = hookId;
 
     std::string funcNameStr(functionName);
-    m_Hooks[funcNameStr].push_back(std::move(hook));
+    auto nameIt = m_NameIds.find(funcNameStr);
+    bool newName = nameIt == m_NameIds.end();
+
+    uint32_t nameId;
+    std::vector<std::shared_ptr<Hook>> hooks;
+    if (newName) {
+        // Reuse a released slot - published tables keep their own copy of the list vector
+        auto freeIt = std::find(m_Lists.begin(), m_Lists.end(), nullptr);
+        nameId = static_cast<uint32_t>(freeIt - m_Lists.begin());
+        if (freeIt == m_Lists.end()) {
+            m_Lists.emplace_back();
+            m_BoundCounts.push_back(0);
+        }
+
+        m_Lists[nameId] = std::make_shared<const HookList>(HookList{funcNameStr, {}});
+        m_NameIds.emplace(funcNameStr, nameId);
+        m_HasNames.store(true, std::memory_order_relaxed);
+    } else {
+        nameId = nameIt->second;
+        hooks = m_Lists[nameId]->hooks;
+    }
+
+    hooks.push_back(std::move(hook));
+    SetHooks(nameId, std::move(hooks));
+    m_HookNames.emplace(hookId, nameId);
+
+    // Functions already checked against the old name set may match the new name
+    if (newName) {
+        m_NameMemo.clear();
+        m_SeenBits.Clear();
+
+        // Walking GObjects is only safe on the game thread - from anywhere else the walk is
+        // queued there, and calls in between bind on first sight (m_SeenBits was just cleared)
+        if (m_Initialized) {
+            if (Foundation::GameThreadExecutor::Get().IsGameThread()) {
+                ResolveAll();
+            } else {
+                QueueResolveAll();
+            }
+        }
+    }
+
+    Publish();
 
-    std::cout << "[ProcessEventHook] Added hook " << hookId << " for function: " << functionName << "\n";
+    std::cout << "[ProcessEventHook] Added " << (isPost ? "post-hook " : "hook ") << hookId << " for function: " << functionName
+              << " (" << m_BoundCounts[nameId] << " resolved)\n";
 
     return hookId;
 }
 
 void ProcessEventHook::RemoveHook(size_t hookId) {
-    for (auto& [functionName, hooks] : m_Hooks) {
-        auto it = std::remove_if(hooks.begin(), hooks.end(),
-            [hookId](const Hook& hook) { return hook.id == hookId; });
+    std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
 
-        if (it != hooks.end()) {
-            hooks.erase(it, hooks.end());
-            std::cout << "[ProcessEventHook] Removed hook " << hookId << "\n";
-            return;
-        }
+    auto it = m_HookNames.find(hookId);
+    if (it == m_HookNames.end()) {
+        std::cerr << "[ProcessEventHook] Hook " << hookId << " not found\n";
+        return;
+    }
+
+    uint32_t nameId = it->second;
+    m_HookNames.erase(it);
+
+    std::vector<std::shared_ptr<Hook>> hooks = m_Lists[nameId]->hooks;
+    std::erase_if(hooks, [hookId](const std::shared_ptr<Hook>& hook) { return hook->id == hookId; });
+
+    if (hooks.empty()) {
+        ReleaseName(nameId);
+    } else {
+        SetHooks(nameId, std::move(hooks));
     }
 
-    std::cerr << "[ProcessEventHook] Hook " << hookId << " not found\n";
+    Publish();
+
+    std::cout << "[ProcessEventHook] Removed hook " << hookId << "\n";
 }
 
 void ProcessEventHook::RemoveHooksForFunction(std::string_view functionName) {
+    std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
+
     std::string funcNameStr(functionName);
-    auto it = m_Hooks.find(funcNameStr);
+    auto it = m_NameIds.find(funcNameStr);
+
+    if (it != m_NameIds.end()) {
+        uint32_t nameId = it->second;
+        size_t count = m_Lists[nameId]->hooks.size();
+        for (const auto& hook : m_Lists[nameId]->hooks) {
+            m_HookNames.erase(hook->id);
+        }
+
+        ReleaseName(nameId);
+        Publish();
 
-    if (it != m_Hooks.end()) {
-        size_t count = it->second.size();
-        m_Hooks.erase(it);
         std::cout << "[ProcessEventHook] Removed " << count << " hooks for function: " << functionName << "\n";
     }
 }
 
 void ProcessEventHook::ClearAllHooks() {
-    size_t totalHooks = 0;
-    for (const auto& [functionName, hooks] : m_Hooks) {
-        totalHooks += hooks.size();
+    std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
+
+    size_t totalHooks = m_HookNames.size();
+
+    for (uint32_t nameId = 0; nameId < m_Lists.size(); nameId++) {
+        if (m_Lists[nameId]) {
+            ReleaseName(nameId);
+        }
     }
+    m_HookNames.clear();
 
-    m_Hooks.clear();
+    Publish();
 
     std::cout << "[ProcessEventHook] Cleared all " << totalHooks << " hooks\n";
 }
 
 size_t ProcessEventHook::GetHookCount(std::string_view functionName) const {
+    std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
+
     std::string funcNameStr(functionName);
-    auto it = m_Hooks.find(funcNameStr);
+    auto it = m_NameIds.find(funcNameStr);
+    return it != m_NameIds.end() ? m_Lists[it->second]->hooks.size() : 0;
+}
+
+size_t ProcessEventHook::GetResolvedCount(std::string_view functionName) const {
+    std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
+
+    std::string funcNameStr(functionName);
+    auto it = m_NameIds.find(funcNameStr);
+    return it != m_NameIds.end() ? m_BoundCounts[it->second] : 0;
+}
 
-    if (it != m_Hooks.end()) {
-        return it->second.size();
+bool ProcessEventHook::ScanObjects(int32_t maxObjects) {
+    std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
+
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t count = objects->Num();
+
+    // Caught up - start another sweep (catches functions loaded into reused slots)
+    if (m_ScanCursor >= count) {
+        m_ScanCursor = 0;
     }
 
-    return 0;
+    int32_t end = std::min(count, m_ScanCursor + maxObjects);
+    bool resolve = !m_NameIds.empty();
+
+    for (int32_t i = m_ScanCursor; i < end; i++) {
+        SDK::UObject* object = objects->GetByIndex(i);
+        if (!object) {
+            continue;
+        }
+
+        PatchVTable(object);
+
+        if (resolve && object->HasTypeFlag(SDK::EClassCastFlags::Function)) {
+            Resolve(static_cast<SDK::UFunction*>(object));
+        }
+    }
+
+    if (m_Dirty) {
+        Publish();
+    }
+
+    m_ScanCursor = end;
+    return end < count;
 }
 
 void ProcessEventHook::ProcessEventDetour(SDK::UObject* object, SDK::UFunction* function, void* params) {
-    if (!function) {
-        // No function, call original
-        if (m_OriginalProcessEvent) {
-            m_OriginalProcessEvent(object, function, params);
+    if (function && ProcessEventTrace::IsEnabled()) {
+        ProcessEventTrace::Get().Record(object, function, params);
+    }
+
+    // Nested ProcessEvent calls become children of this one in the call tree
+    if (function && CallTreeProfiler::IsEnabled()) {
+        CallTreeProfiler::Scope scope(function);
+        Invoke(object, function, params);
+        return;
+    }
+
+    Invoke(object, function, params);
+}
+
+void ProcessEventHook::Invoke(SDK::UObject* object, SDK::UFunction* function, void* params) {
+    bool hooked = false;
+
+    if (function) {
+        int32_t index = function->Index;
+
+        // First call of a function we haven't checked yet (loaded since the last scan)
+        if (!m_HookedBits.Test(index, false) && m_HasNames.load(std::memory_order_relaxed) &&
+            !m_SeenBits.Test(index, true)) {
+            TryResolve(function, false);
         }
+
+        hooked = m_HookedBits.Test(index, false);
+
+        if (ProcessEventStats::IsEnabled()) {
+            TimedCall(object, function, params, hooked);
+            return;
+        }
+    }
+
+    if (hooked) {
+        Dispatch(object, function, params, nullptr);
         return;
     }
 
-    // Get function name
-    std::string functionName = function->GetName();
+    // Unhooked - straight through
+    OriginalFor(object)(object, function, params);
+}
+
+void ProcessEventHook::TimedCall(SDK::UObject* object, SDK::UFunction* function, void* params, bool hooked) {
+    uint64_t start = ProcessEventStats::Now();
+    uint64_t originalNs = 0;
 
-    // Check if we have hooks for this function
-    auto it = m_Hooks.find(functionName);
+    if (hooked) {
+        Dispatch(object, function, params, &originalNs);
+    } else {
+        OriginalFor(object)(object, function, params);
+    }
+
+    uint64_t totalNs = ProcessEventStats::Now() - start;
+    if (!hooked) {
+        originalNs = totalNs;
+    }
+
+    // Hook time is everything the dispatch added around the original
+    ProcessEventStats::Get().Record(function, originalNs, totalNs - std::min(originalNs, totalNs), hooked);
+}
+
+void ProcessEventHook::CallOriginal(SDK::UObject* object, SDK::UFunction* function, void* params, uint64_t* originalNs) {
+    ProcessEventFunc original = OriginalFor(object);
+    if (!originalNs) {
+        original(object, function, params);
+        return;
+    }
+
+    uint64_t start = ProcessEventStats::Now();
+    original(object, function, params);
+    *originalNs = ProcessEventStats::Now() - start;
+}
+
+void ProcessEventHook::Dispatch(SDK::UObject* object, SDK::UFunction* function, void* params, uint64_t* originalNs) {
+    // Everything reached through the table stays alive until the guard is left
+    Foundation::EpochReclaimer::Guard guard;
+
+    const Table* table = m_Table.load(std::memory_order_acquire);
+    const Binding* binding = table->Find(function->Index);
+
+    // Index reused by a different UFunction since it was bound
+    if (binding && binding->function != function) {
+        binding = nullptr;
+        if (TryResolve(function, true)) {
+            table = m_Table.load(std::memory_order_acquire);
+            binding = table->Find(function->Index);
+        }
+    }
+
+    if (!binding) {
+        CallOriginal(object, function, params, originalNs);
+        return;
+    }
+
+    const HookList& list = *table->lists[binding->nameId];
     bool shouldCallOriginal = true;
 
-    if (it != m_Hooks.end()) {
-        // Call all hooks for this function
-        for (const auto& hook : it->second) {
-            try {
-                bool result = hook.callback(object, function, params);
-                if (!result) {
-                    // Hook returned false, don't call original
-                    shouldCallOriginal = false;
-                }
-            } catch (const std::exception& e) {
-                std::cerr << "[ProcessEventHook] Exception in hook for " << functionName << ": " << e.what() << "\n";
-            } catch (...) {
-                std::cerr << "[ProcessEventHook] Unknown exception in hook for " << functionName << "\n";
+    // Hooks added or removed during dispatch take effect from the next call
+    for (const auto& hook : list.hooks) {
+        if (!hook->pre || (hook->filtered && !Matches(*hook, object, function))) {
+            continue;
+        }
+
+        try {
+            bool result = hook->pre(object, function, params);
+            if (!result) {
+                // Hook returned false, don't call original
+                shouldCallOriginal = false;
             }
+        } catch (const std::exception& e) {
+            std::cerr << "[ProcessEventHook] Exception in hook for " << list.name << ": " << e.what() << "\n";
+        } catch (...) {
+            std::cerr << "[ProcessEventHook] Unknown exception in hook for " << list.name << "\n";
         }
     }
 
     // Call original function if not blocked
-    if (shouldCallOriginal && m_OriginalProcessEvent) {
-        m_OriginalProcessEvent(object, function, params);
+    if (shouldCallOriginal) {
+        CallOriginal(object, function, params, originalNs);
+    }
+
+    // Post-hooks see what the original wrote (out-params, return value)
+    for (const auto& hook : list.hooks) {
+        if (!hook->post || (hook->filtered && !Matches(*hook, object, function))) {
+            continue;
+        }
+
+        try {
+            hook->post(object, function, params);
+        } catch (const std::exception& e) {
+            std::cerr << "[ProcessEventHook] Exception in post-hook for " << list.name << ": " << e.what() << "\n";
+        } catch (...) {
+            std::cerr << "[ProcessEventHook] Unknown exception in post-hook for " << list.name << "\n";
+        }
+    }
+}
+
+bool ProcessEventHook::Matches(Hook& hook, SDK::UObject* object, SDK::UFunction* function) {
+    const HookFilter& filter = hook.filter;
+
+    if (!object) {
+        return false;
     }
+
+    if (!filter.functionOwner.empty()) {
+        // Same-named functions of other classes share the hook list - compare once per UFunction
+        int cached = hook.functionCache.Find(function);
+        if (cached < 0) {
+            bool result = DeclaredOn(hook, function);
+            hook.functionCache.Store(function, result);
+            cached = result;
+        }
+        if (!cached) {
+            return false;
+        }
+    }
+
+    if (filter.instance && object != filter.instance) {
+        return false;
+    }
+
+    if (filter.weakInstance.ObjectIndex >= 0) {
+        if (object->Index != filter.weakInstance.ObjectIndex || ObjectSerialNumber(object->Index) != filter.weakInstance.ObjectSerialNumber) {
+            return false;
+        }
+    }
+
+    if (filter.outer && object->Outer != filter.outer) {
+        return false;
+    }
+
+    if (filter.objectClass) {
+        // Objects reaching one hooked function come from few classes - remember the answers
+        SDK::UClass* objectClass = object->Class;
+        int cached = hook.classCache.Find(objectClass);
+        if (cached >= 0) {
+            return cached;
+        }
+
+        bool result = ClassHierarchy::Get().IsA(objectClass, filter.objectClass);
+        hook.classCache.Store(objectClass, result);
+        return result;
+    }
+
+    return true;
+}
+
+bool ProcessEventHook::DeclaredOn(Hook& hook, SDK::UFunction* function) {
+    auto outerClass = [](const SDK::UStruct* candidate) -> SDK::UClass* {
+        SDK::UObject* outer = candidate->Outer;
+        return outer && outer->HasTypeFlag(SDK::EClassCastFlags::Class) ? static_cast<SDK::UClass*>(outer) : nullptr;
+    };
+
+    // The descriptor class, found once by name among the classes the function is declared on
+    SDK::UClass* ownerClass = hook.ownerClass.load(std::memory_order_acquire);
+    if (!ownerClass || !NameCache::Equals(ownerClass->Name, hook.functionOwner)) {
+        ownerClass = nullptr;
+        for (const SDK::UStruct* current = function; current && !ownerClass; current = current->Super) {
+            for (SDK::UClass* candidate = outerClass(current); candidate;
+                 candidate = static_cast<SDK::UClass*>(candidate->Super)) {
+                if (NameCache::Equals(candidate->Name, hook.functionOwner)) {
+                    ownerClass = candidate;
+                    break;
+                }
+            }
+        }
+        if (!ownerClass) {
+            return false;
+        }
+        hook.ownerClass.store(ownerClass, std::memory_order_release);
+    }
+
+    // Declared on the class or a subclass (an override), or overrides a function that is -
+    // Blueprint implementations of interface functions have the interface's function as Super
+    for (const SDK::UStruct* current = function; current; current = current->Super) {
+        SDK::UClass* declaredOn = outerClass(current);
+        if (declaredOn && ClassHierarchy::Get().IsA(declaredOn, ownerClass)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int ProcessEventHook::ResultCache::Find(const void* key) const {
+    uintptr_t keyBits = reinterpret_cast<uintptr_t>(key);
+    if (!keyBits) {
+        return -1;
+    }
+
+    for (const auto& entry : entries) {
+        uintptr_t cached = entry.load(std::memory_order_relaxed);
+        if ((cached & ~uintptr_t(1)) == keyBits) {
+            return static_cast<int>(cached & 1);
+        }
+    }
+    return -1;
+}
+
+void ProcessEventHook::ResultCache::Store(const void* key, bool result) {
+    uint32_t slot = next.fetch_add(1, std::memory_order_relaxed) % Size;
+    entries[slot].store(reinterpret_cast<uintptr_t>(key) | (result ? 1 : 0), std::memory_order_relaxed);
+}
+
+const ProcessEventHook::Binding* ProcessEventHook::Table::Find(int32_t index) const {
+    auto it = std::lower_bound(bindings.begin(), bindings.end(), index,
+        [](const Binding& binding, int32_t value) { return binding.index < value; });
+
+    return it != bindings.end() && it->index == index ? &*it : nullptr;
+}
+
+void ProcessEventHook::Bitmap::Allocate(int32_t capacity) {
+    wordCount = (static_cast<size_t>(std::max(capacity, 0)) + 63) / 64;
+    words = std::make_unique<std::atomic<uint64_t>[]>(wordCount);
+}
+
+void ProcessEventHook::Bitmap::Set(int32_t index, bool value) {
+    size_t word = static_cast<size_t>(index) >> 6;
+    if (word >= wordCount) {
+        return;
+    }
+
+    uint64_t mask = 1ull << (index & 63);
+    if (value) {
+        words[word].fetch_or(mask, std::memory_order_release);
+    } else {
+        words[word].fetch_and(~mask, std::memory_order_release);
+    }
+}
+
+void ProcessEventHook::Bitmap::Clear() {
+    for (size_t i = 0; i < wordCount; i++) {
+        words[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+bool ProcessEventHook::TryResolve(SDK::UFunction* function, bool rebind) {
+    // Never block a ProcessEvent call on a writer - the next call retries
+    std::unique_lock<std::recursive_mutex> lock(m_WriteMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return false;
+    }
+
+    if (rebind) {
+        Unbind(function->Index);
+    }
+    Resolve(function);
+
+    if (m_Dirty) {
+        Publish();
+    }
+    return true;
+}
+
+void ProcessEventHook::Resolve(SDK::UFunction* function) {
+    int32_t index = function->Index;
+    if (index < 0) {
+        return;
+    }
+
+    // Function names repeat a lot across classes - each distinct FName is stringified once
+    uint64_t key = NameKey(function->Name);
+    auto memoIt = m_NameMemo.find(key);
+
+    int32_t nameId;
+    if (memoIt != m_NameMemo.end()) {
+        nameId = memoIt->second;
+    } else {
+        auto nameIt = m_NameIds.find(function->GetName());
+        nameId = nameIt != m_NameIds.end() ? static_cast<int32_t>(nameIt->second) : NoName;
+        m_NameMemo.emplace(key, nameId);
+    }
+
+    m_SeenBits.Set(index, true);
+
+    if (nameId != NoName) {
+        Bind(function, static_cast<uint32_t>(nameId));
+    }
+}
+
+void ProcessEventHook::Bind(SDK::UFunction* function, uint32_t nameId) {
+    int32_t index = function->Index;
+
+    auto it = std::lower_bound(m_Bindings.begin(), m_Bindings.end(), index,
+        [](const Binding& binding, int32_t value) { return binding.index < value; });
+
+    if (it != m_Bindings.end() && it->index == index) {
+        if (it->function == function && it->nameId == nameId) {
+            return;
+        }
+
+        // Slot reused - drop the stale binding first
+        Unbind(index);
+        it = std::lower_bound(m_Bindings.begin(), m_Bindings.end(), index,
+            [](const Binding& binding, int32_t value) { return binding.index < value; });
+    }
+
+    // The hooked bit is set by Publish(), once the binding is visible
+    m_Bindings.insert(it, Binding{index, function, nameId});
+    m_BoundCounts[nameId]++;
+    m_Dirty = true;
+}
+
+void ProcessEventHook::Unbind(int32_t index) {
+    auto it = std::lower_bound(m_Bindings.begin(), m_Bindings.end(), index,
+        [](const Binding& binding, int32_t value) { return binding.index < value; });
+
+    if (it == m_Bindings.end() || it->index != index) {
+        return;
+    }
+
+    m_BoundCounts[it->nameId]--;
+    m_Bindings.erase(it);
+    m_HookedBits.Set(index, false);
+    m_SeenBits.Set(index, false);
+    m_Dirty = true;
+}
+
+void ProcessEventHook::ResolveAll() {
+    SDK::TUObjectArray* objects = SDK::UObject::GObjects.GetTypedPtr();
+    int32_t count = objects->Num();
+
+    for (int32_t i = 0; i < count; i++) {
+        SDK::UObject* object = objects->GetByIndex(i);
+        if (object && object->HasTypeFlag(SDK::EClassCastFlags::Function)) {
+            Resolve(static_cast<SDK::UFunction*>(object));
+        }
+    }
+}
+
+void ProcessEventHook::QueueResolveAll() {
+    if (m_ResolveQueued) {
+        return;
+    }
+    m_ResolveQueued = true;
+
+    Foundation::GameThreadExecutor::Get().QueueAction([this]() {
+        std::lock_guard<std::recursive_mutex> lock(m_WriteMutex);
+        m_ResolveQueued = false;
+
+        if (m_Initialized && !m_NameIds.empty()) {
+            ResolveAll();
+            if (m_Dirty) {
+                Publish();
+            }
+        }
+    });
+}
+
+void ProcessEventHook::PatchVTable(SDK::UObject* object) {
+    void** vtable = static_cast<void**>(object->VTable);
+    if (!vtable) {
+        return;
+    }
+
+    // Thousands of objects share a handful of vtables - each is inspected once
+    auto it = std::lower_bound(m_CheckedVTables.begin(), m_CheckedVTables.end(), vtable);
+    if (it != m_CheckedVTables.end() && *it == vtable) {
+        return;
+    }
+    m_CheckedVTables.insert(it, vtable);
+
+    void* current = vtable[SDK::Offsets::ProcessEventIdx];
+    if (!current || current == reinterpret_cast<void*>(&ProcessEventTrampoline)) {
+        return;
+    }
+
+    // Record the original before the slot can route a call to the trampoline
+    // (kept at most half full so probes stay short and always end)
+    void** stored = nullptr;
+    size_t mask = MaxVTableSlots - 1;
+    size_t position = HashVTable(vtable) & mask;
+    while ((stored = m_Originals[position].vtable.load(std::memory_order_relaxed)) && stored != vtable) {
+        position = (position + 1) & mask;
+    }
+    if (!stored) {
+        if (m_OriginalCount >= MaxVTableSlots / 2) {
+            std::cerr << "[ProcessEventHook] Too many vtables, not patching " << object->Class->GetName() << "\n";
+            return;
+        }
+        m_OriginalCount++;
+    }
+    m_Originals[position].original.store(reinterpret_cast<ProcessEventFunc>(current), std::memory_order_relaxed);
+    m_Originals[position].vtable.store(vtable, std::memory_order_release);
+
+    void* previous = Foundation::VTableHook::SwapSlot(vtable, SDK::Offsets::ProcessEventIdx,
+                                                      reinterpret_cast<void*>(&ProcessEventTrampoline));
+    if (previous) {
+        m_PatchedVTables.push_back(vtable);
+    } else {
+        std::cerr << "[ProcessEventHook] Failed to patch vtable for " << object->Class->GetName() << "\n";
+    }
+}
+
+ProcessEventHook::ProcessEventFunc ProcessEventHook::OriginalFor(const SDK::UObject* object) const {
+    return object ? FindOriginal(static_cast<void**>(object->VTable)) : m_OriginalProcessEvent;
+}
+
+ProcessEventHook::ProcessEventFunc ProcessEventHook::FindOriginal(void** vtable) const {
+    if (!m_Originals) {
+        return m_OriginalProcessEvent;
+    }
+
+    size_t mask = MaxVTableSlots - 1;
+    for (size_t position = HashVTable(vtable) & mask;; position = (position + 1) & mask) {
+        void** stored = m_Originals[position].vtable.load(std::memory_order_acquire);
+        if (stored == vtable) {
+            return m_Originals[position].original.load(std::memory_order_relaxed);
+        }
+        if (!stored) {
+            return m_OriginalProcessEvent;
+        }
+    }
+}
+
+void ProcessEventHook::SetHooks(uint32_t nameId, std::vector<std::shared_ptr<Hook>> hooks) {
+    // Copy-on-write - published tables keep pointing at the old list
+    auto list = std::make_shared<HookList>();
+    list->name = m_Lists[nameId]->name;
+    list->hooks = std::move(hooks);
+    m_Lists[nameId] = std::move(list);
+    m_Dirty = true;
+}
+
+void ProcessEventHook::ReleaseName(uint32_t nameId) {
+    // Unbind every function resolved to this name (bound UFunctions may have been
+    // garbage collected since - only the stored index is used)
+    std::erase_if(m_Bindings, [this, nameId](const Binding& binding) {
+        if (binding.nameId != nameId) {
+            return false;
+        }
+        m_HookedBits.Set(binding.index, false);
+        return true;
+    });
+    m_BoundCounts[nameId] = 0;
+
+    // Memo entries pointing at this name now mean "no hook"
+    for (auto& [key, id] : m_NameMemo) {
+        if (id == static_cast<int32_t>(nameId)) {
+            id = NoName;
+        }
+    }
+
+    m_NameIds.erase(m_Lists[nameId]->name);
+    m_Lists[nameId] = nullptr;
+    m_HasNames.store(!m_NameIds.empty(), std::memory_order_relaxed);
+    m_Dirty = true;
+}
+
+void ProcessEventHook::Publish() {
+    auto* table = new Table{m_Bindings, m_Lists};
+    Table* previous = m_Table.exchange(table, std::memory_order_acq_rel);
+    m_Dirty = false;
+
+    // Bits go up only now that the table holding the binding is visible
+    for (const Binding& binding : m_Bindings) {
+        m_HookedBits.Set(binding.index, true);
+    }
+
+    // Detours that loaded the previous table may still be walking it
+    Foundation::EpochReclaimer::Get().Retire(previous);
 }
 
 void ProcessEventHook::ProcessEventTrampoline(SDK::UObject* object, SDK::UFunction* function, void* params) {
@@ -1,7 +1,11 @@
 #pragma once
 
 #include "../Engine/SDK/SDK.hpp"
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -9,22 +13,83 @@
 
 namespace Broadsword {
 
+/**
+ * Declarative hook filter
+ *
+ * Evaluated by the detour before the callback is invoked, so non-matching
+ * calls never pay for a std::function call. Every field left at its default
+ * matches anything; non-default fields must all match.
+ *
+ * - objectClass:  object->IsA(objectClass) - subclasses match too
+ * - instance:     exactly this object
+ * - weakInstance: exactly this object while it is alive (index + serial
+ *                 number, so a new object reusing the slot doesn't match)
+ * - outer:        object->Outer == outer
+ * - functionOwner: only the UFunction declared on the class or interface with
+ *                 this name, or an override of it in a subclass or
+ *                 implementing class (a hooked name alone matches that
+ *                 function on every class); copied when the hook is added
+ */
+struct HookFilter {
+    SDK::UClass* objectClass = nullptr;
+    SDK::UObject* instance = nullptr;
+    SDK::FWeakObjectPtr weakInstance = {-1, 0};
+    SDK::UObject* outer = nullptr;
+    std::string_view functionOwner = {};
+
+    bool IsEmpty() const {
+        return objectClass == nullptr && instance == nullptr && weakInstance.ObjectIndex < 0 && outer == nullptr &&
+               functionOwner.empty();
+    }
+};
+
 /**
  * ProcessEventHook - Hook UObject::ProcessEvent for function interception
  *
  * Allows mods to intercept any UFunction call in the game.
- * Uses VMT (Virtual Method Table) hooking to redirect ProcessEvent calls.
+ * Uses VMT (Virtual Method Table) hooking to redirect ProcessEvent calls:
+ * slot Offsets::ProcessEventIdx is patched in every UObject class vtable,
+ * and each call is passed on to what that vtable's slot held before (the
+ * engine's UObject::ProcessEvent, or an override such as AActor's).
  *
  * Features:
  * - Hook by function name (e.g., "TakeDamage", "OnDeath")
  * - Multiple hooks per function
  * - Return false from callback to block original function
- * - Type-safe parameter access via void* casting
+ * - Post-hooks run after the original (read return values and out-params)
+ * - Declarative filters (class, instance, outer) checked before any callback
+ * - Type-safe parameter access via void* casting, or ParamView (see ParamLayout.hpp)
+ *
+ * Dispatch:
+ * - Hook names are resolved to UFunction* once: when the hook is added
+ *   (full GObjects scan), and for classes loaded later (idle-time scan of
+ *   new GObjects slots, plus a one-time check the first time an unknown
+ *   UFunction reaches the detour)
+ * - Unhooked calls are rejected with one bit test in a bitmap indexed by
+ *   UObject::Index - no name lookup, no allocation
+ * - Hooked calls are dispatched from a flat array sorted by UObject::Index
+ * - With ProcessEventStats enabled, every call is timed and recorded
+ * - With CallTreeProfiler enabled, sampled frames record call nesting
+ *
+ * Dispatch table:
+ * - Bindings and hook lists live in an immutable Table published through an
+ *   atomic pointer. Writers copy, modify and publish a new Table under a
+ *   mutex; the old one is retired to Foundation::EpochReclaimer and deleted
+ *   once no detour can still be reading it
+ * - The detour takes an epoch guard and reads the table with one acquire
+ *   load - no locks, no reference counting
+ * - Hook IDs map straight to their hooked name, so removal doesn't search
  *
  * Thread Safety:
- * - All methods MUST be called from game thread
- * - ProcessEvent is called on game thread
- * - No synchronization needed (single-threaded)
+ * - Add/Remove/Clear and the queries can be called from any thread. Off the
+ *   game thread, binding a new name to every matching UFunction is queued to
+ *   the game thread (GameThreadExecutor); until then functions bind on their
+ *   first call
+ * - ProcessEvent may run on any thread; the detour never blocks (resolving a
+ *   UFunction on first sight is skipped while a writer holds the lock)
+ * - A removed hook is not invoked by calls that start after removal returns;
+ *   calls already in flight may still finish running it
+ * - Initialize(), Shutdown() and ScanObjects() run on the game thread
  *
  * Usage:
  *   // Hook TakeDamage function
@@ -46,6 +111,7 @@ namespace Broadsword {
 class ProcessEventHook {
 public:
     using HookCallback = std::function<bool(SDK::UObject*, SDK::UFunction*, void*)>;
+    using PostHookCallback = std::function<void(SDK::UObject*, SDK::UFunction*, void*)>;
 
     static ProcessEventHook& Get();
 
@@ -73,13 +139,32 @@ public:
      *
      * @param functionName Name of UFunction to hook (e.g., "TakeDamage")
      * @param callback Hook callback function
+     * @param filter Only invoke callback for matching objects
      * @return Hook ID for later removal
      */
-    size_t AddHook(std::string_view functionName, HookCallback callback);
+    size_t AddHook(std::string_view functionName, HookCallback callback, const HookFilter& filter = {});
+
+    /**
+     * Add post-hook for a function name
+     *
+     * Runs after the original ProcessEvent returns, so params hold the
+     * return value and out-params. Also runs when a pre-hook blocked the
+     * original (params then hold whatever the pre-hooks left there).
+     *
+     * @param functionName Name of UFunction to hook (e.g., "GetHealth")
+     * @param callback Post-hook callback function
+     * @param filter Only invoke callback for matching objects
+     * @return Hook ID for later removal (shares the ID space with AddHook)
+     */
+    size_t AddPostHook(std::string_view functionName, PostHookCallback callback, const HookFilter& filter = {});
 
     /**
      * Remove hook by ID
      *
+     * Safe to call from any thread and from inside a hook callback (including
+     * the hook being removed). The callback itself is destroyed once no
+     * in-flight call can still reach it.
+     *
      * @param hookId Hook ID returned from AddHook
      */
     void RemoveHook(size_t hookId);
@@ -100,10 +185,38 @@ public:
      * Get number of hooks for a function
      *
      * @param functionName Name of UFunction
-     * @return Number of registered hooks
+     * @return Number of registered hooks (pre and post)
      */
     size_t GetHookCount(std::string_view functionName) const;
 
+    /**
+     * Get number of UFunctions currently bound to a hooked name
+     *
+     * @param functionName Name of UFunction
+     * @return Number of resolved UFunction objects (0 if not loaded yet)
+     */
+    size_t GetResolvedCount(std::string_view functionName) const;
+
+    /**
+     * Scan a slice of GObjects for newly loaded classes and functions
+     *
+     * Patches new class vtables and binds new UFunctions to hooked names.
+     * Registered as an idle task by Initialize(); once it reaches the end of
+     * GObjects it wraps around, so reused object slots are picked up too.
+     *
+     * @param maxObjects Number of GObjects slots to visit
+     * @return true if the scan has not caught up with GObjects yet
+     */
+    bool ScanObjects(int32_t maxObjects);
+
+    /**
+     * Serial number of a GObjects slot (bumped when the slot is reused)
+     *
+     * @param index UObject::Index
+     * @return Serial number, or -1 if the index is out of range
+     */
+    static int32_t ObjectSerialNumber(int32_t index);
+
 private:
     ProcessEventHook() = default;
 
@@ -111,8 +224,8 @@ private:
      * Hook function that replaces ProcessEvent
      *
      * This is the actual hooked function that gets called instead of
-     * the original ProcessEvent. It invokes all registered callbacks
-     * and conditionally calls the original function.
+     * the original ProcessEvent. It invokes all registered callbacks,
+     * conditionally calls the original function, then runs post-hooks.
      *
      * @param object UObject instance
      * @param function UFunction being called
@@ -121,22 +234,167 @@ private:
     void ProcessEventDetour(SDK::UObject* object, SDK::UFunction* function, void* params);
 
     /**
-     * Original ProcessEvent function pointer
-     * Set during Initialize() via VMT hook
+     * Engine UObject::ProcessEvent
+     * Set during Initialize(); the original for vtables we didn't patch
      */
     using ProcessEventFunc = void (*)(SDK::UObject*, SDK::UFunction*, void*);
     ProcessEventFunc m_OriginalProcessEvent = nullptr;
 
+    /**
+     * Patched vtable -> what its ProcessEvent slot held before
+     *
+     * AActor (and every Blueprint actor) overrides ProcessEvent, so each vtable
+     * keeps its own original. Insert-only open addressing, allocated once and
+     * kept across Shutdown() so the detour reads it without a guard: original
+     * is stored before vtable is published.
+     */
+    struct VTableOriginal {
+        std::atomic<void**> vtable = nullptr;
+        std::atomic<ProcessEventFunc> original = nullptr;
+    };
+    static constexpr size_t MaxVTableSlots = 1 << 16;
+
+    ProcessEventFunc OriginalFor(const SDK::UObject* object) const;
+    ProcessEventFunc FindOriginal(void** vtable) const;
+
+    /**
+     * Recent filter answers, packed as pointer | result (low bit) - races only cost a miss
+     */
+    struct ResultCache {
+        static constexpr size_t Size = 8;
+        std::atomic<uintptr_t> entries[Size] = {};
+        std::atomic<uint32_t> next = 0;
+
+        // -1 if not cached
+        int Find(const void* key) const;
+        void Store(const void* key, bool result);
+    };
+
     /**
      * Hook storage
+     *
+     * Shared between the writer state and every Table that lists it, so a
+     * hook outlives its removal until the last table holding it is reclaimed.
+     * Immutable once published, except the result caches. Exactly one of
+     * pre/post is set.
      */
     struct Hook {
         size_t id;
-        std::string functionName;
-        HookCallback callback;
+        HookCallback pre;
+        PostHookCallback post;
+        HookFilter filter;
+        bool filtered = false;
+        std::string functionOwner; // Storage behind filter.functionOwner
+
+        ResultCache classCache;    // Object class -> passes filter.objectClass
+        ResultCache functionCache; // UFunction -> declared on filter.functionOwner
+        std::atomic<SDK::UClass*> ownerClass = nullptr; // filter.functionOwner, once found
+    };
+
+    /**
+     * Hooks registered for one function name (immutable once published)
+     */
+    struct HookList {
+        std::string name;
+        std::vector<std::shared_ptr<Hook>> hooks;
     };
 
-    std::unordered_map<std::string, std::vector<Hook>> m_Hooks;
+    /**
+     * Dispatch entry (bindings are sorted by index)
+     */
+    struct Binding {
+        int32_t index;
+        SDK::UFunction* function;
+        uint32_t nameId;
+    };
+
+    /**
+     * Published dispatch table - never modified after publication
+     */
+    struct Table {
+        std::vector<Binding> bindings;
+        std::vector<std::shared_ptr<const HookList>> lists; // By name ID
+
+        const Binding* Find(int32_t index) const;
+    };
+
+    static constexpr int32_t NoName = -1;
+
+    static uint64_t NameKey(const SDK::FName& name) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(name.ComparisonIndex)) << 32) | name.Number;
+    }
+
+    /**
+     * Fixed-size atomic bitmap indexed by UObject::Index
+     *
+     * Sized from GObjects MaxElements in Initialize() and never reallocated
+     * (detours read it without a guard). Indices past the end read as set
+     * when `outOfRange` is true.
+     */
+    struct Bitmap {
+        std::unique_ptr<std::atomic<uint64_t>[]> words;
+        size_t wordCount = 0;
+
+        void Allocate(int32_t capacity);
+        bool Test(int32_t index, bool outOfRange) const {
+            size_t word = static_cast<size_t>(index) >> 6;
+            if (word >= wordCount) {
+                return outOfRange;
+            }
+            return (words[word].load(std::memory_order_acquire) >> (index & 63)) & 1;
+        }
+        void Set(int32_t index, bool value);
+        void Clear();
+    };
+
+    size_t Add(std::string_view functionName, HookCallback pre, PostHookCallback post, const HookFilter& filter);
+    static bool Matches(Hook& hook, SDK::UObject* object, SDK::UFunction* function);
+    static bool DeclaredOn(Hook& hook, SDK::UFunction* function);
+    void Invoke(SDK::UObject* object, SDK::UFunction* function, void* params);
+
+    // originalNs: when non-null, receives the time spent in the original (ProcessEventStats)
+    void Dispatch(SDK::UObject* object, SDK::UFunction* function, void* params, uint64_t* originalNs);
+    void CallOriginal(SDK::UObject* object, SDK::UFunction* function, void* params, uint64_t* originalNs);
+    void TimedCall(SDK::UObject* object, SDK::UFunction* function, void* params, bool hooked);
+
+    // Writer side - m_WriteMutex held
+    void Resolve(SDK::UFunction* function);
+    void Bind(SDK::UFunction* function, uint32_t nameId);
+    void Unbind(int32_t index);
+    void ResolveAll();
+    void QueueResolveAll();
+    void PatchVTable(SDK::UObject* object);
+    void ReleaseName(uint32_t nameId);
+    void SetHooks(uint32_t nameId, std::vector<std::shared_ptr<Hook>> hooks);
+    void Publish();
+
+    // Detour side - resolves under try_lock, false if a writer holds the lock
+    bool TryResolve(SDK::UFunction* function, bool rebind);
+
+    // Published state (read by the detour)
+    std::atomic<Table*> m_Table = nullptr;
+    Bitmap m_HookedBits;                 // Function index has a binding
+    Bitmap m_SeenBits;                   // Function index was checked against m_NameIds
+    std::atomic<bool> m_HasNames = false;
+
+    // Writer state
+    mutable std::recursive_mutex m_WriteMutex; // Recursive: deleting a retired hook may remove others
+    std::vector<std::shared_ptr<const HookList>> m_Lists; // By name ID, null = free slot
+    std::vector<size_t> m_BoundCounts;                    // By name ID
+    std::unordered_map<std::string, uint32_t> m_NameIds;  // Live names only
+    std::unordered_map<size_t, uint32_t> m_HookNames;     // Hook ID -> name ID
+    std::unordered_map<uint64_t, int32_t> m_NameMemo;     // FName -> name ID or NoName
+    std::vector<Binding> m_Bindings;
+    bool m_Dirty = false;                                 // Writer state differs from m_Table
+    bool m_ResolveQueued = false;                         // ResolveAll() waiting on the game thread
+
+    std::unique_ptr<VTableOriginal[]> m_Originals; // MaxVTableSlots entries
+    size_t m_OriginalCount = 0;
+    std::vector<void**> m_PatchedVTables;
+    std::vector<void**> m_CheckedVTables; // Sorted, patched or not
+    int32_t m_ScanCursor = 0;
+    uint32_t m_IdleTask = 0;
+
     size_t m_NextHookId = 1;
 
     bool m_Initialized = false;
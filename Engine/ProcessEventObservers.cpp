@@ -0,0 +1,233 @@
+#include "ProcessEventObservers.hpp"
+#include "ParamLayout.hpp"
+#include "../Foundation/Threading/WorkerPool.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace Broadsword {
+
+namespace {
+
+constexpr uint32_t AlignUp(uint32_t size) {
+    return (size + 15u) & ~15u;
+}
+
+} // namespace
+
+SDK::UObject* ObservedCall::Object() const {
+    if (object.ObjectIndex < 0 || ProcessEventHook::ObjectSerialNumber(object.ObjectIndex) != object.ObjectSerialNumber) {
+        return nullptr;
+    }
+    return SDK::UObject::GObjects->GetByIndex(object.ObjectIndex);
+}
+
+ProcessEventObservers& ProcessEventObservers::Get() {
+    static ProcessEventObservers instance;
+    return instance;
+}
+
+size_t ProcessEventObservers::Add(std::string_view functionName, Callback callback, ObserverPhase phase,
+                                  const HookFilter& filter) {
+    auto observer = std::make_shared<Observer>();
+    observer->phase = phase;
+    observer->callback = std::move(callback);
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (auto& active : m_Active) {
+            if (!active.load(std::memory_order_relaxed)) {
+                m_Buffers.push_back(std::make_unique<Buffer>());
+                active.store(m_Buffers.back().get(), std::memory_order_release);
+            }
+        }
+    }
+
+    // The hook keeps the observer alive; calls before the ID is set are skipped
+    size_t observerId = ProcessEventHook::Get().AddPostHook(
+        functionName,
+        [this, observer](SDK::UObject* object, SDK::UFunction* function, void* params) {
+            Record(*observer, object, function, params);
+        },
+        filter);
+    observer->id.store(observerId, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto observers = std::make_shared<ObserverMap>(*m_Observers);
+    (*observers)[observerId] = std::move(observer);
+    m_Observers = std::move(observers);
+    return observerId;
+}
+
+bool ProcessEventObservers::Remove(size_t observerId) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Observers->contains(observerId)) {
+            return false;
+        }
+
+        auto observers = std::make_shared<ObserverMap>(*m_Observers);
+        observers->erase(observerId);
+        m_Observers = std::move(observers);
+    }
+
+    ProcessEventHook::Get().RemoveHook(observerId);
+    return true;
+}
+
+void ProcessEventObservers::Clear() {
+    std::shared_ptr<const ObserverMap> removed;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        removed = std::move(m_Observers);
+        m_Observers = std::make_shared<ObserverMap>();
+    }
+
+    for (const auto& [observerId, observer] : *removed) {
+        ProcessEventHook::Get().RemoveHook(observerId);
+    }
+}
+
+void ProcessEventObservers::Record(const Observer& observer, SDK::UObject* object, SDK::UFunction* function,
+                                   void* params) {
+    size_t observerId = observer.id.load(std::memory_order_acquire);
+    std::atomic<Buffer*>& active = m_Active[static_cast<size_t>(observer.phase)];
+    if (observerId == 0 || !object) {
+        return;
+    }
+
+    // Native callers only allocate the parameters - a Blueprint function's Size also counts its
+    // locals. Room for those is kept (zeroed) so the block still matches the SDK Params struct.
+    uint32_t paramSize = params ? static_cast<uint32_t>(ParamLayout::ParmsSize(function)) : 0;
+    uint32_t blockSize = params ? std::max(paramSize, static_cast<uint32_t>(std::max(function->Size, 0))) : 0;
+    uint32_t size = AlignUp(static_cast<uint32_t>(sizeof(Entry)) + blockSize);
+
+    // Register as a writer of the buffer that is still active afterwards,
+    // so Flush() can't drain it under us
+    Buffer* buffer;
+    for (;;) {
+        buffer = active.load(std::memory_order_acquire);
+        buffer->writers.fetch_add(1, std::memory_order_seq_cst);
+        if (active.load(std::memory_order_seq_cst) == buffer) {
+            break;
+        }
+        buffer->writers.fetch_sub(1, std::memory_order_release);
+    }
+
+    unsigned char* data = buffer->data[0].bytes;
+    uint32_t offset = buffer->used.fetch_add(size, std::memory_order_relaxed);
+
+    if (offset + size > BufferBytes || offset + size < offset) {
+        // Full for this frame - mark the end so the reader skips the unused tail
+        if (offset <= BufferBytes - sizeof(Entry)) {
+            reinterpret_cast<Entry*>(data + offset)->size = 0;
+        }
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        Entry* entry = reinterpret_cast<Entry*>(data + offset);
+        entry->observerId = observerId;
+        entry->function = function;
+        entry->object = {object->Index, ProcessEventHook::ObjectSerialNumber(object->Index)};
+        entry->paramSize = paramSize;
+        entry->blockSize = blockSize;
+        entry->size = size;
+        if (paramSize) {
+            std::memcpy(entry + 1, params, paramSize);
+        }
+        if (blockSize > paramSize) {
+            std::memset(reinterpret_cast<unsigned char*>(entry + 1) + paramSize, 0, blockSize - paramSize);
+        }
+    }
+
+    buffer->writers.fetch_sub(1, std::memory_order_release);
+}
+
+void ProcessEventObservers::Flush(ObserverPhase phase) {
+    std::atomic<Buffer*>& active = m_Active[static_cast<size_t>(phase)];
+    Buffer* buffer = active.load(std::memory_order_acquire);
+    if (!buffer || buffer->used.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    active.store(AcquireBuffer(), std::memory_order_seq_cst);
+
+    // Producers that registered before the swap finish a memcpy at most
+    while (buffer->writers.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+
+    std::shared_ptr<const ObserverMap> observers = Snapshot();
+
+    if (phase == ObserverPhase::Worker) {
+        Foundation::WorkerPool::Get().Submit([this, observers = std::move(observers), buffer]() {
+            Deliver(*observers, *buffer);
+            ReleaseBuffer(buffer);
+        });
+        return;
+    }
+
+    Deliver(*observers, *buffer);
+    ReleaseBuffer(buffer);
+}
+
+void ProcessEventObservers::Deliver(const ObserverMap& observers, Buffer& buffer) {
+    const unsigned char* data = buffer.data[0].bytes;
+    uint32_t end = std::min(buffer.used.load(std::memory_order_relaxed), BufferBytes);
+    uint64_t delivered = 0;
+
+    for (uint32_t offset = 0; offset + sizeof(Entry) <= end;) {
+        const Entry* entry = reinterpret_cast<const Entry*>(data + offset);
+        if (entry->size == 0) {
+            break;
+        }
+        offset += entry->size;
+
+        auto it = observers.find(entry->observerId);
+        if (it == observers.end()) {
+            continue; // Removed since the call was queued
+        }
+
+        ObservedCall call{entry->object, entry->function, entry + 1, entry->paramSize, entry->blockSize};
+        try {
+            it->second->callback(call);
+            delivered++;
+        } catch (const std::exception& e) {
+            std::cerr << "[ProcessEventObservers] Exception in observer " << entry->observerId << ": " << e.what() << "\n";
+        } catch (...) {
+            std::cerr << "[ProcessEventObservers] Unknown exception in observer " << entry->observerId << "\n";
+        }
+    }
+
+    m_Delivered.fetch_add(delivered, std::memory_order_relaxed);
+}
+
+ProcessEventObservers::Buffer* ProcessEventObservers::AcquireBuffer() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_FreeBuffers.empty()) {
+        m_Buffers.push_back(std::make_unique<Buffer>());
+        return m_Buffers.back().get();
+    }
+
+    Buffer* buffer = m_FreeBuffers.back();
+    m_FreeBuffers.pop_back();
+    return buffer;
+}
+
+void ProcessEventObservers::ReleaseBuffer(Buffer* buffer) {
+    buffer->used.store(0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_FreeBuffers.push_back(buffer);
+}
+
+std::shared_ptr<const ProcessEventObservers::ObserverMap> ProcessEventObservers::Snapshot() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Observers;
+}
+
+ProcessEventObservers::Stats ProcessEventObservers::GetStats() const {
+    return {m_Delivered.load(std::memory_order_relaxed), m_Dropped.load(std::memory_order_relaxed)};
+}
+
+} // namespace Broadsword
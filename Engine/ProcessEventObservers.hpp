@@ -0,0 +1,196 @@
+#pragma once
+
+#include "ProcessEventHook.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * When queued observer callbacks run
+ */
+enum class ObserverPhase : uint8_t {
+    FrameStart, // Game thread, before actor tracking, timers and queued actions
+    FrameEnd,   // Game thread, after OnFrameEvent
+    Worker      // WorkerPool thread, handed off at frame end - pure data only
+};
+
+/**
+ * One observed ProcessEvent call, as copied by the detour
+ *
+ * params points at a copy of the parameter block taken after the original
+ * ran (return value and out-params included). It lives until the callback
+ * returns. Only the parameters (UFunction::ParmsSize) are copied; a Blueprint
+ * function's locals, which the SDK Params struct also lists, read as zero.
+ */
+struct ObservedCall {
+    SDK::FWeakObjectPtr object; // Index + serial number of the calling object
+    SDK::UFunction* function;
+    const void* params;
+    uint32_t paramSize; // Bytes copied from the caller (UFunction::ParmsSize)
+    uint32_t blockSize; // Size of the block at params (UStruct::Size, locals zeroed)
+
+    /**
+     * Calling object, if it still exists
+     *
+     * Game-thread phases only - a Worker callback must not touch the object.
+     */
+    SDK::UObject* Object() const;
+
+    /**
+     * Parameter copy as the SDK Params struct
+     *
+     * @return nullptr if the block size doesn't match ParamsType
+     */
+    template<typename ParamsType>
+    const ParamsType* As() const {
+        return blockSize == sizeof(ParamsType) ? static_cast<const ParamsType*>(params) : nullptr;
+    }
+};
+
+/**
+ * ProcessEventObservers - Deferred, read-only ProcessEvent hooks
+ *
+ * Observers are for hooks that only look: logging hits, counting damage.
+ * Inside ProcessEvent an observer costs one post-hook that copies the
+ * parameter block and the object's index/serial into a lock-free ring - no
+ * mod code runs there. The callbacks run later, in a batch, at the phase
+ * they chose: FrameStart or FrameEnd on the game thread, or on a worker
+ * (frame-end handoff) for callbacks that only need the copied data.
+ *
+ * Rings:
+ * - One per phase. A producer reserves space with one fetch_add and copies;
+ *   when a ring is full for this frame the call is dropped and counted
+ * - Flush() swaps in an empty buffer, waits for writers still copying into
+ *   the old one (they never block), then delivers its calls in order
+ * - Worker buffers are handed to the job and recycled when it finishes
+ *
+ * Thread Safety:
+ * - Add/Remove/Clear can be called from any thread
+ * - Observed calls may come from any thread
+ * - Flush() is game thread only
+ * - A removed observer isn't invoked by flushes that start after Remove
+ *   returns; calls already queued for it are dropped
+ *
+ * Usage:
+ *   size_t id = ProcessEventObservers::Get().Add("ReceiveAnyDamage",
+ *       [](const ObservedCall& call) {
+ *           // call.As<SDK::Params::...>(), call.Object()
+ *       }, ObserverPhase::FrameEnd);
+ *
+ *   ProcessEventObservers::Get().Remove(id);
+ */
+class ProcessEventObservers {
+public:
+    using Callback = std::function<void(const ObservedCall&)>;
+
+    struct Stats {
+        uint64_t delivered = 0; // Calls passed to callbacks
+        uint64_t dropped = 0;   // Calls that didn't fit into their frame's ring
+    };
+
+    // Bytes per ring buffer (one frame of calls per phase)
+    static constexpr uint32_t BufferBytes = 1u << 20;
+
+    static ProcessEventObservers& Get();
+
+    ProcessEventObservers(const ProcessEventObservers&) = delete;
+    ProcessEventObservers& operator=(const ProcessEventObservers&) = delete;
+
+    /**
+     * Observe a UFunction by name
+     *
+     * @param functionName Name of UFunction to observe (e.g., "ReceiveAnyDamage")
+     * @param callback Runs once per observed call at the chosen phase
+     * @param phase When (and on which thread) the callback runs
+     * @param filter Only queue calls from matching objects (see HookFilter)
+     * @return Observer ID - a ProcessEventHook hook ID, remove it with Remove()
+     */
+    size_t Add(std::string_view functionName, Callback callback, ObserverPhase phase = ObserverPhase::FrameEnd,
+               const HookFilter& filter = {});
+
+    /**
+     * Remove an observer and its hook
+     *
+     * @param observerId ID returned from Add()
+     * @return false if no such observer
+     */
+    bool Remove(size_t observerId);
+
+    /**
+     * Remove all observers
+     */
+    void Clear();
+
+    /**
+     * Deliver the calls queued for a phase
+     *
+     * FrameStart/FrameEnd run their callbacks here; Worker submits them to
+     * the WorkerPool. Cheap when nothing was queued.
+     *
+     * @param phase Phase to flush
+     */
+    void Flush(ObserverPhase phase);
+
+    Stats GetStats() const;
+
+private:
+    ProcessEventObservers() = default;
+
+    struct Observer {
+        std::atomic<size_t> id = 0; // 0 until the hook is registered
+        ObserverPhase phase;
+        Callback callback;
+    };
+
+    using ObserverMap = std::unordered_map<size_t, std::shared_ptr<Observer>>;
+
+    // Ring record header, followed by blockSize bytes (paramSize copied, the rest zeroed)
+    struct alignas(16) Entry {
+        size_t observerId;
+        SDK::UFunction* function;
+        SDK::FWeakObjectPtr object;
+        uint32_t paramSize;
+        uint32_t blockSize;
+        uint32_t size; // Header + block rounded up to 16, 0 = end of buffer
+    };
+
+    struct alignas(16) Block {
+        unsigned char bytes[16];
+    };
+
+    struct Buffer {
+        std::unique_ptr<Block[]> data = std::make_unique<Block[]>(BufferBytes / sizeof(Block));
+        std::atomic<uint32_t> used = 0;    // Bytes reserved, may run past BufferBytes
+        std::atomic<uint32_t> writers = 0; // Producers still copying
+    };
+
+    static constexpr size_t PhaseCount = 3;
+
+    void Record(const Observer& observer, SDK::UObject* object, SDK::UFunction* function, void* params);
+    void Deliver(const ObserverMap& observers, Buffer& buffer);
+
+    Buffer* AcquireBuffer();
+    void ReleaseBuffer(Buffer* buffer);
+
+    // Copy-on-write - Flush() and worker jobs keep the snapshot they started with
+    std::shared_ptr<const ObserverMap> Snapshot() const;
+
+    mutable std::mutex m_Mutex;
+    std::shared_ptr<const ObserverMap> m_Observers = std::make_shared<ObserverMap>();
+    std::vector<std::unique_ptr<Buffer>> m_Buffers; // Every buffer ever allocated
+    std::vector<Buffer*> m_FreeBuffers;
+
+    std::atomic<Buffer*> m_Active[PhaseCount] = {};
+
+    std::atomic<uint64_t> m_Delivered = 0;
+    std::atomic<uint64_t> m_Dropped = 0;
+};
+
+} // namespace Broadsword
@@ -0,0 +1,461 @@
+#include "ProcessEventStats.hpp"
+#include "NameCache.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+
+namespace Broadsword {
+
+uint32_t LatencyHistogram::BucketFor(uint64_t ns) {
+    if (ns < SubBuckets) {
+        return static_cast<uint32_t>(ns);
+    }
+
+    uint32_t exponent = static_cast<uint32_t>(std::bit_width(ns)) - 1;
+    if (exponent >= MaxExponent) {
+        return BucketCount - 1;
+    }
+
+    uint32_t sub = static_cast<uint32_t>(ns >> (exponent - SubBucketBits)) & (SubBuckets - 1);
+    return SubBuckets + (exponent - SubBucketBits) * SubBuckets + sub;
+}
+
+uint64_t LatencyHistogram::BucketLowerBound(uint32_t bucket) {
+    if (bucket < SubBuckets) {
+        return bucket;
+    }
+
+    uint32_t exponent = (bucket - SubBuckets) / SubBuckets + SubBucketBits;
+    uint32_t sub = (bucket - SubBuckets) % SubBuckets;
+    return (1ull << exponent) + sub * (1ull << (exponent - SubBucketBits));
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+    for (uint32_t i = 0; i < BucketCount; i++) {
+        counts[i] += other.counts[i];
+    }
+    count += other.count;
+}
+
+uint64_t LatencyHistogram::Percentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    uint64_t target = static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * count));
+    target = std::max<uint64_t>(target, 1);
+
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < BucketCount; i++) {
+        seen += counts[i];
+        if (seen >= target) {
+            return i + 1 < BucketCount ? BucketLowerBound(i + 1) - 1 : BucketLowerBound(i);
+        }
+    }
+    return BucketLowerBound(BucketCount - 1);
+}
+
+/**
+ * Counters of one UFunction on one thread
+ *
+ * The atomics are written by the owning thread only (plain load + store, no
+ * read-modify-write) and read by EndFrame(). The seen* fields belong to
+ * EndFrame() and hold the values already folded into the aggregate.
+ *
+ * The owner retires an entry when its function is replaced or on Reset() and
+ * never writes it again; EndFrame() folds what is left, zeroes it and hands it
+ * back through the block's free list.
+ */
+struct ProcessEventStats::ThreadEntry {
+    enum State : uint8_t { Live, Retired, Free };
+
+    std::atomic<uint8_t> state = Live;
+    SDK::UFunction* function = nullptr;
+    SDK::FName name;
+    SDK::FName outerName;
+    bool hasOuter = false;
+
+    std::atomic<uint64_t> calls = 0;
+    std::atomic<uint64_t> originalNs = 0;
+    std::atomic<uint64_t> hookNs = 0;
+    std::array<std::atomic<uint32_t>, LatencyHistogram::BucketCount> original = {};
+    std::array<std::atomic<uint32_t>, LatencyHistogram::BucketCount> hook = {};
+
+    uint64_t seenCalls = 0;
+    uint64_t seenOriginalNs = 0;
+    uint64_t seenHookNs = 0;
+    std::array<uint32_t, LatencyHistogram::BucketCount> seenOriginal = {};
+    std::array<uint32_t, LatencyHistogram::BucketCount> seenHook = {};
+};
+
+/**
+ * Per-thread function table
+ *
+ * Entry storage is append-only: the owner fills entries[n] and then publishes
+ * entryCount = n + 1, so EndFrame() can walk [0, entryCount) without locks.
+ * Recycled entries come back through freeList before new storage is taken.
+ * The lookup index is owner-only.
+ */
+struct ProcessEventStats::ThreadBlock {
+    static constexpr size_t MaxEntries = 4096;
+    static constexpr size_t LookupSize = MaxEntries * 2; // Power of two, never more than half full
+
+    struct Slot {
+        SDK::UFunction* function = nullptr;
+        ThreadEntry* entry = nullptr;
+    };
+
+    std::unique_ptr<Slot[]> lookup = std::make_unique<Slot[]>(LookupSize);
+    std::unique_ptr<std::unique_ptr<ThreadEntry>[]> entries = std::make_unique<std::unique_ptr<ThreadEntry>[]>(MaxEntries);
+    std::atomic<uint32_t> entryCount = 0;
+    std::atomic<uint64_t> dropped = 0;
+    uint32_t generation = 0; // Last Reset() generation the owner acted on
+
+    std::mutex freeMutex; // Guards freeList (owner pops, EndFrame() pushes)
+    std::vector<ThreadEntry*> freeList;
+};
+
+namespace {
+
+// Single-writer increment - no lock prefix on the hot path
+template<typename T>
+void Bump(std::atomic<T>& counter, T amount = 1) {
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+bool SameName(const SDK::FName& a, const SDK::FName& b) {
+    return a.ComparisonIndex == b.ComparisonIndex && a.Number == b.Number;
+}
+
+double Micros(uint64_t ns) {
+    return static_cast<double>(ns) / 1000.0;
+}
+
+} // namespace
+
+ProcessEventStats& ProcessEventStats::Get() {
+    static ProcessEventStats instance;
+    return instance;
+}
+
+void ProcessEventStats::SetEnabled(bool enabled) {
+    s_Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+ProcessEventStats::ThreadBlock& ProcessEventStats::LocalBlock() {
+    thread_local ThreadBlock* block = nullptr;
+    if (!block) {
+        // Owned by m_Blocks for the life of the process (EndFrame may still read it after the thread exits)
+        auto owned = std::make_unique<ThreadBlock>();
+        block = owned.get();
+
+        std::lock_guard<std::mutex> lock(m_BlocksMutex);
+        m_Blocks.push_back(std::move(owned));
+    }
+    return *block;
+}
+
+ProcessEventStats::ThreadEntry* ProcessEventStats::FindOrAdd(ThreadBlock& block, SDK::UFunction* function) {
+    // Reset() asked every thread to give its entries back
+    uint32_t generation = m_Generation.load(std::memory_order_relaxed);
+    if (block.generation != generation) {
+        block.generation = generation;
+
+        uint32_t count = block.entryCount.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < count; i++) {
+            ThreadEntry& entry = *block.entries[i];
+            if (entry.state.load(std::memory_order_relaxed) == ThreadEntry::Live) {
+                entry.state.store(ThreadEntry::Retired, std::memory_order_release);
+            }
+        }
+        std::fill_n(block.lookup.get(), ThreadBlock::LookupSize, ThreadBlock::Slot{});
+    }
+
+    auto newEntry = [&block, function]() -> ThreadEntry* {
+        ThreadEntry* entry = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(block.freeMutex);
+            if (!block.freeList.empty()) {
+                entry = block.freeList.back();
+                block.freeList.pop_back();
+            }
+        }
+
+        uint32_t count = block.entryCount.load(std::memory_order_relaxed);
+        bool fresh = !entry;
+        if (fresh) {
+            if (count >= ThreadBlock::MaxEntries) {
+                return nullptr;
+            }
+            block.entries[count] = std::make_unique<ThreadEntry>();
+            entry = block.entries[count].get();
+        }
+
+        entry->function = function;
+        entry->name = function->Name;
+        entry->hasOuter = function->Outer != nullptr;
+        entry->outerName = entry->hasOuter ? function->Outer->Name : SDK::FName();
+        entry->state.store(ThreadEntry::Live, std::memory_order_release);
+
+        if (fresh) {
+            block.entryCount.store(count + 1, std::memory_order_release);
+        }
+        return entry;
+    };
+
+    size_t mask = ThreadBlock::LookupSize - 1;
+    size_t index = static_cast<size_t>((reinterpret_cast<uintptr_t>(function) >> 4) * 0x9E3779B97F4A7C15ull) & mask;
+
+    for (;;) {
+        ThreadBlock::Slot& slot = block.lookup[index];
+
+        if (slot.function == function) {
+            if (slot.entry && SameName(slot.entry->name, function->Name)) {
+                return slot.entry;
+            }
+
+            // Same address, different function (the old one was garbage collected)
+            if (slot.entry) {
+                slot.entry->state.store(ThreadEntry::Retired, std::memory_order_release);
+            }
+            slot.entry = newEntry();
+            return slot.entry;
+        }
+
+        if (!slot.function) {
+            ThreadEntry* entry = newEntry();
+            if (entry) {
+                slot = {function, entry};
+            }
+            return entry;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+void ProcessEventStats::Record(SDK::UFunction* function, uint64_t originalNs, uint64_t hookNs, bool hooked) {
+    ThreadBlock& block = LocalBlock();
+    ThreadEntry* entry = FindOrAdd(block, function);
+    if (!entry) {
+        Bump<uint64_t>(block.dropped);
+        return;
+    }
+
+    Bump<uint64_t>(entry->calls);
+    Bump(entry->originalNs, originalNs);
+    Bump<uint32_t>(entry->original[LatencyHistogram::BucketFor(originalNs)]);
+
+    if (hooked) {
+        Bump(entry->hookNs, hookNs);
+        Bump<uint32_t>(entry->hook[LatencyHistogram::BucketFor(hookNs)]);
+    }
+}
+
+void ProcessEventStats::EndFrame() {
+    if (!IsEnabled()) {
+        return;
+    }
+
+    m_FrameCount++;
+    m_FrameCalls = 0;
+
+    // Frame stats only cover the frame that just ended
+    for (FunctionStats* stats : m_TouchedLastFrame) {
+        stats->frameCalls = 0;
+        stats->frameOriginalNs = 0;
+        stats->frameHookNs = 0;
+        stats->frameOriginal.Clear();
+        stats->frameHook.Clear();
+    }
+    m_TouchedLastFrame.clear();
+
+    std::lock_guard<std::mutex> lock(m_BlocksMutex);
+
+    for (const auto& block : m_Blocks) {
+        uint32_t count = block->entryCount.load(std::memory_order_acquire);
+
+        for (uint32_t i = 0; i < count; i++) {
+            ThreadEntry& entry = *block->entries[i];
+
+            uint8_t state = entry.state.load(std::memory_order_acquire);
+            if (state == ThreadEntry::Free) {
+                continue;
+            }
+
+            Fold(entry);
+
+            // The owner stopped writing it - what was left is folded, hand it back
+            if (state == ThreadEntry::Retired) {
+                Recycle(*block, entry);
+            }
+        }
+    }
+}
+
+void ProcessEventStats::Fold(ThreadEntry& entry) {
+    uint64_t calls = entry.calls.load(std::memory_order_relaxed);
+    if (calls == entry.seenCalls) {
+        return;
+    }
+
+    // Name resolved once per entry
+    auto statsIt = m_EntryStats.find(&entry);
+    if (statsIt == m_EntryStats.end()) {
+        std::string name;
+        if (entry.hasOuter) {
+            NameCache::Append(entry.outerName, name);
+            name += '.';
+        }
+        NameCache::Append(entry.name, name);
+        FunctionStats& created = m_Functions[name];
+        created.name = std::move(name);
+        statsIt = m_EntryStats.emplace(&entry, &created).first;
+    }
+    FunctionStats& stats = *statsIt->second;
+
+    if (stats.frameCalls == 0) {
+        m_TouchedLastFrame.push_back(&stats);
+    }
+
+    uint64_t deltaCalls = calls - entry.seenCalls;
+    entry.seenCalls = calls;
+    stats.frameCalls += deltaCalls;
+    stats.totalCalls += deltaCalls;
+    m_FrameCalls += deltaCalls;
+
+    uint64_t originalNs = entry.originalNs.load(std::memory_order_relaxed);
+    stats.frameOriginalNs += originalNs - entry.seenOriginalNs;
+    stats.totalOriginalNs += originalNs - entry.seenOriginalNs;
+    entry.seenOriginalNs = originalNs;
+
+    uint64_t hookNs = entry.hookNs.load(std::memory_order_relaxed);
+    stats.frameHookNs += hookNs - entry.seenHookNs;
+    stats.totalHookNs += hookNs - entry.seenHookNs;
+    entry.seenHookNs = hookNs;
+
+    for (uint32_t b = 0; b < LatencyHistogram::BucketCount; b++) {
+        uint32_t original = entry.original[b].load(std::memory_order_relaxed);
+        if (uint32_t delta = original - entry.seenOriginal[b]) {
+            entry.seenOriginal[b] = original;
+            stats.frameOriginal.counts[b] += delta;
+            stats.frameOriginal.count += delta;
+            stats.totalOriginal.counts[b] += delta;
+            stats.totalOriginal.count += delta;
+        }
+
+        uint32_t hook = entry.hook[b].load(std::memory_order_relaxed);
+        if (uint32_t delta = hook - entry.seenHook[b]) {
+            entry.seenHook[b] = hook;
+            stats.frameHook.counts[b] += delta;
+            stats.frameHook.count += delta;
+            stats.totalHook.counts[b] += delta;
+            stats.totalHook.count += delta;
+        }
+    }
+}
+
+void ProcessEventStats::Recycle(ThreadBlock& block, ThreadEntry& entry) {
+    m_EntryStats.erase(&entry);
+
+    entry.calls.store(0, std::memory_order_relaxed);
+    entry.originalNs.store(0, std::memory_order_relaxed);
+    entry.hookNs.store(0, std::memory_order_relaxed);
+    for (uint32_t b = 0; b < LatencyHistogram::BucketCount; b++) {
+        entry.original[b].store(0, std::memory_order_relaxed);
+        entry.hook[b].store(0, std::memory_order_relaxed);
+    }
+    entry.seenCalls = 0;
+    entry.seenOriginalNs = 0;
+    entry.seenHookNs = 0;
+    entry.seenOriginal = {};
+    entry.seenHook = {};
+    entry.state.store(ThreadEntry::Free, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(block.freeMutex);
+    block.freeList.push_back(&entry);
+}
+
+void ProcessEventStats::Reset() {
+    m_Functions.clear();
+    m_EntryStats.clear();
+    m_TouchedLastFrame.clear();
+    m_FrameCount = 0;
+    m_FrameCalls = 0;
+
+    // Every thread retires its entries on its next call; EndFrame() recycles them
+    m_Generation.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_BlocksMutex);
+    m_DroppedAtReset = 0;
+    for (const auto& block : m_Blocks) {
+        m_DroppedAtReset += block->dropped.load(std::memory_order_relaxed);
+    }
+}
+
+std::vector<const ProcessEventStats::FunctionStats*> ProcessEventStats::GetTop(size_t count, SortBy sort) const {
+    std::vector<const FunctionStats*> result;
+    result.reserve(m_Functions.size());
+    for (const auto& [name, stats] : m_Functions) {
+        result.push_back(&stats);
+    }
+
+    auto key = [sort](const FunctionStats* stats) -> uint64_t {
+        switch (sort) {
+            case SortBy::FrameTime:  return stats->frameOriginalNs + stats->frameHookNs;
+            case SortBy::FrameCalls: return stats->frameCalls;
+            case SortBy::TotalTime:  return stats->totalOriginalNs + stats->totalHookNs;
+            case SortBy::TotalCalls: return stats->totalCalls;
+        }
+        return 0;
+    };
+
+    count = std::min(count, result.size());
+    std::partial_sort(result.begin(), result.begin() + count, result.end(),
+        [&key](const FunctionStats* a, const FunctionStats* b) { return key(a) > key(b); });
+    result.resize(count);
+    return result;
+}
+
+bool ProcessEventStats::ExportCsv(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "function,total_calls,total_original_us,total_hook_us,"
+            "original_p50_us,original_p99_us,original_max_us,"
+            "hook_p50_us,hook_p99_us,hook_max_us,"
+            "frame_calls,frame_original_us,frame_hook_us\n";
+
+    for (const FunctionStats* stats : GetTop(m_Functions.size(), SortBy::TotalTime)) {
+        file << stats->name << ','
+             << stats->totalCalls << ','
+             << Micros(stats->totalOriginalNs) << ','
+             << Micros(stats->totalHookNs) << ','
+             << Micros(stats->totalOriginal.Percentile(50)) << ','
+             << Micros(stats->totalOriginal.Percentile(99)) << ','
+             << Micros(stats->totalOriginal.Percentile(100)) << ','
+             << Micros(stats->totalHook.Percentile(50)) << ','
+             << Micros(stats->totalHook.Percentile(99)) << ','
+             << Micros(stats->totalHook.Percentile(100)) << ','
+             << stats->frameCalls << ','
+             << Micros(stats->frameOriginalNs) << ','
+             << Micros(stats->frameHookNs) << '\n';
+    }
+
+    return file.good();
+}
+
+uint64_t ProcessEventStats::GetDroppedCalls() const {
+    std::lock_guard<std::mutex> lock(m_BlocksMutex);
+
+    uint64_t dropped = 0;
+    for (const auto& block : m_Blocks) {
+        dropped += block->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped - m_DroppedAtReset;
+}
+
+} // namespace Broadsword
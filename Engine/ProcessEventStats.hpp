@@ -0,0 +1,200 @@
+#pragma once
+
+#include "../Engine/SDK/SDK.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * LatencyHistogram - Compact log-linear (HDR-style) nanosecond histogram
+ *
+ * Each power of two is split into 4 linear sub-buckets, so any recorded
+ * value is known to within 25% over the whole 1ns..18min range in 156
+ * counters. Values past the range land in the last bucket.
+ */
+struct LatencyHistogram {
+    static constexpr uint32_t SubBucketBits = 2;
+    static constexpr uint32_t SubBuckets = 1u << SubBucketBits;
+    static constexpr uint32_t MaxExponent = 40; // Values up to 2^40 ns
+    static constexpr uint32_t BucketCount = SubBuckets + (MaxExponent - SubBucketBits) * SubBuckets;
+
+    std::array<uint32_t, BucketCount> counts = {};
+    uint64_t count = 0;
+
+    static uint32_t BucketFor(uint64_t ns);
+    static uint64_t BucketLowerBound(uint32_t bucket);
+
+    void Add(uint64_t ns) {
+        counts[BucketFor(ns)]++;
+        count++;
+    }
+
+    void Merge(const LatencyHistogram& other);
+    void Clear() { *this = {}; }
+
+    /**
+     * Value at a percentile
+     *
+     * @param percentile 0..100
+     * @return Upper bound of the bucket holding that percentile (0 if empty)
+     */
+    uint64_t Percentile(double percentile) const;
+};
+
+/**
+ * ProcessEventStats - Optional per-UFunction ProcessEvent instrumentation
+ *
+ * When enabled, the ProcessEvent detour times every call and records, per
+ * function, the call count plus a LatencyHistogram of time spent in the
+ * original ProcessEvent and (hooked functions only) in hook callbacks.
+ * Original time is inclusive - it contains nested ProcessEvent calls.
+ *
+ * Recording is lock-free: every calling thread owns a block of counters that
+ * only it writes. EndFrame() (game thread, once per frame) folds the deltas
+ * of all threads into per-function frame and running totals.
+ *
+ * A thread tracks up to 4096 functions at once; calls past that are counted
+ * by GetDroppedCalls(). Entries of garbage-collected functions are reused, and
+ * Reset() empties every thread's table.
+ *
+ * Disabled, the detour pays a single relaxed atomic load.
+ *
+ * Thread Safety:
+ * - IsEnabled()/Record() are called from the detour on any thread
+ * - Everything else is game thread only
+ *
+ * Usage:
+ *   ProcessEventStats::Get().SetEnabled(true);
+ *   // ... frames later
+ *   for (const auto* stats : ProcessEventStats::Get().GetTop(20, ProcessEventStats::SortBy::FrameTime)) {
+ *       // stats->name, stats->frameCalls, stats->frameOriginal.Percentile(99)
+ *   }
+ *   ProcessEventStats::Get().ExportCsv("Broadsword_ProcessEvent.csv");
+ */
+class ProcessEventStats {
+public:
+    /**
+     * Aggregated counters of one UFunction
+     */
+    struct FunctionStats {
+        std::string name; // "Outer.Function"
+
+        // Last completed frame
+        uint64_t frameCalls = 0;
+        uint64_t frameOriginalNs = 0;
+        uint64_t frameHookNs = 0;
+        LatencyHistogram frameOriginal;
+        LatencyHistogram frameHook;
+
+        // Since enabled / last Reset()
+        uint64_t totalCalls = 0;
+        uint64_t totalOriginalNs = 0;
+        uint64_t totalHookNs = 0;
+        LatencyHistogram totalOriginal;
+        LatencyHistogram totalHook;
+    };
+
+    enum class SortBy {
+        FrameTime,  // Original + hook time in the last frame
+        FrameCalls,
+        TotalTime,
+        TotalCalls
+    };
+
+    static ProcessEventStats& Get();
+
+    ProcessEventStats(const ProcessEventStats&) = delete;
+    ProcessEventStats& operator=(const ProcessEventStats&) = delete;
+
+    static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+    void SetEnabled(bool enabled);
+
+    static uint64_t Now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * Record one ProcessEvent call (detour hot path, any thread)
+     *
+     * @param function UFunction that was called
+     * @param originalNs Time spent in the original ProcessEvent (0 if blocked)
+     * @param hookNs Time spent in pre- and post-hooks
+     * @param hooked Whether hooks ran (hookNs is only recorded for hooked calls)
+     */
+    void Record(SDK::UFunction* function, uint64_t originalNs, uint64_t hookNs, bool hooked);
+
+    /**
+     * Fold every thread's counters into the frame and total stats
+     *
+     * Call once per frame on the game thread. Cheap when disabled.
+     */
+    void EndFrame();
+
+    /**
+     * Drop aggregated stats and the dropped count
+     *
+     * Each thread gives its function table back on its next call, so functions
+     * seen since (e.g., after a level change) get entries again.
+     */
+    void Reset();
+
+    /**
+     * Hottest functions
+     *
+     * @param count Maximum number of entries
+     * @param sort Ranking key
+     * @return Pointers valid until the next EndFrame() or Reset()
+     */
+    std::vector<const FunctionStats*> GetTop(size_t count, SortBy sort) const;
+
+    /**
+     * Write all aggregated stats as CSV (one row per function, times in microseconds)
+     *
+     * @param path Output file
+     * @return false if the file could not be written
+     */
+    bool ExportCsv(const std::string& path) const;
+
+    size_t GetFunctionCount() const { return m_Functions.size(); }
+    uint64_t GetFrameCount() const { return m_FrameCount; }
+    uint64_t GetFrameCalls() const { return m_FrameCalls; }
+
+    // Calls not recorded since the last Reset() because a thread's function table was full
+    uint64_t GetDroppedCalls() const;
+
+private:
+    ProcessEventStats() = default;
+
+    struct ThreadEntry;
+    struct ThreadBlock;
+
+    ThreadBlock& LocalBlock();
+    ThreadEntry* FindOrAdd(ThreadBlock& block, SDK::UFunction* function);
+    void Fold(ThreadEntry& entry);
+    void Recycle(ThreadBlock& block, ThreadEntry& entry);
+
+    static inline std::atomic<bool> s_Enabled = false;
+
+    mutable std::mutex m_BlocksMutex; // Guards m_Blocks (not the counters inside)
+    std::vector<std::unique_ptr<ThreadBlock>> m_Blocks;
+    std::atomic<uint32_t> m_Generation = 0; // Bumped by Reset(), checked by each owner thread
+    uint64_t m_DroppedAtReset = 0;          // Guarded by m_BlocksMutex
+
+    // Game thread only
+    std::unordered_map<std::string, FunctionStats> m_Functions;   // By name - reloaded functions keep their stats
+    std::unordered_map<const ThreadEntry*, FunctionStats*> m_EntryStats;
+    std::vector<FunctionStats*> m_TouchedLastFrame;
+    uint64_t m_FrameCount = 0;
+    uint64_t m_FrameCalls = 0;
+};
+
+} // namespace Broadsword
@@ -0,0 +1,193 @@
+#include "ProcessEventTrace.hpp"
+#include "NameCache.hpp"
+#include "ParamLayout.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace Broadsword {
+
+namespace {
+
+uint64_t NameKey(const SDK::FName& name) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(name.ComparisonIndex)) << 32) | name.Number;
+}
+
+} // namespace
+
+ProcessEventTrace& ProcessEventTrace::Get() {
+    static ProcessEventTrace instance;
+    return instance;
+}
+
+bool ProcessEventTrace::Start(const std::string& path, bool captureParams) {
+    if (m_File.is_open()) {
+        return false;
+    }
+
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_File.is_open()) {
+        std::cerr << "[ProcessEventTrace] Could not create " << path << "\n";
+        return false;
+    }
+
+    TraceFormat::FileHeader header;
+    header.flags = captureParams ? TraceFormat::HasParams : 0;
+    m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    m_Path = path;
+    m_BytesWritten = sizeof(header);
+    m_Frame = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Buffer.clear();
+        m_Functions.clear();
+        m_Classes.clear();
+        m_NextFunctionId = 1;
+        m_NextClassId = 1;
+        m_CaptureParams = captureParams;
+        m_CallCount.store(0, std::memory_order_relaxed);
+        m_DroppedCalls.store(0, std::memory_order_relaxed);
+
+        Append(TraceFormat::Record::Frame);
+        Append(m_Frame);
+    }
+
+    s_Enabled.store(true, std::memory_order_relaxed);
+
+    std::cout << "[ProcessEventTrace] Capturing to " << path << (captureParams ? " (with parameters)\n" : "\n");
+    return true;
+}
+
+void ProcessEventTrace::Stop() {
+    if (!m_File.is_open()) {
+        return;
+    }
+
+    s_Enabled.store(false, std::memory_order_relaxed);
+
+    // Calls that passed the IsEnabled() check before the store still land in the buffer
+    WriteBuffer();
+    m_File.close();
+
+    std::cout << "[ProcessEventTrace] Captured " << GetCallCount() << " calls over " << m_Frame
+              << " frames (" << m_BytesWritten << " bytes, " << GetDroppedCalls() << " dropped)\n";
+}
+
+void ProcessEventTrace::Record(SDK::UObject* object, SDK::UFunction* function, void* params) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    // Stopped between the caller's IsEnabled() check and here
+    if (!s_Enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // Parameters only - a Blueprint function's Size also counts locals the caller never allocated
+    uint32_t paramBytes = (m_CaptureParams && params) ? static_cast<uint32_t>(ParamLayout::ParmsSize(function)) : 0;
+    if (m_Buffer.size() + sizeof(TraceFormat::CallRecord) + paramBytes > MaxBufferBytes) {
+        m_DroppedCalls.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    TraceFormat::CallRecord call;
+    call.function = FunctionId(function);
+    call.objectClass = (object && object->Class) ? ClassId(object->Class) : 0;
+    call.paramBytes = paramBytes;
+
+    Append(TraceFormat::Record::Call);
+    Append(call);
+    if (paramBytes > 0) {
+        Append(params, paramBytes);
+    }
+
+    m_CallCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ProcessEventTrace::EndFrame() {
+    if (!m_File.is_open()) {
+        return;
+    }
+
+    WriteBuffer();
+
+    if (m_BytesWritten >= MaxFileBytes || !m_File.good()) {
+        std::cerr << "[ProcessEventTrace] Stopping capture: " << (m_File.good() ? "size limit reached" : "write failed")
+                  << "\n";
+        Stop();
+    }
+}
+
+void ProcessEventTrace::WriteBuffer() {
+    {
+        // Swap under the lock, write outside it
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_WriteBuffer.swap(m_Buffer);
+        m_Buffer.clear();
+        m_Buffer.reserve(sizeof(TraceFormat::Record) + sizeof(m_Frame));
+
+        m_Frame++;
+        Append(TraceFormat::Record::Frame);
+        Append(m_Frame);
+    }
+
+    m_File.write(reinterpret_cast<const char*>(m_WriteBuffer.data()), static_cast<std::streamsize>(m_WriteBuffer.size()));
+    m_BytesWritten += m_WriteBuffer.size();
+    m_WriteBuffer.clear();
+}
+
+uint32_t ProcessEventTrace::FunctionId(SDK::UFunction* function) {
+    uint64_t nameKey = NameKey(function->Name);
+
+    auto it = m_Functions.find(function);
+    if (it != m_Functions.end() && it->second.nameKey == nameKey) {
+        return it->second.id;
+    }
+
+    uint32_t id = m_NextFunctionId++;
+    m_Functions[function] = Identity{id, nameKey};
+
+    std::string name;
+    if (function->Outer) {
+        NameCache::Append(function->Outer->Name, name);
+        name += '.';
+    }
+    NameCache::Append(function->Name, name);
+
+    Append(TraceFormat::Record::Function);
+    Append(id);
+    Append(static_cast<uint32_t>(ParamLayout::ParmsSize(function)));
+    AppendName(name);
+
+    return id;
+}
+
+uint32_t ProcessEventTrace::ClassId(SDK::UClass* objectClass) {
+    uint64_t nameKey = NameKey(objectClass->Name);
+
+    auto it = m_Classes.find(objectClass);
+    if (it != m_Classes.end() && it->second.nameKey == nameKey) {
+        return it->second.id;
+    }
+
+    uint32_t id = m_NextClassId++;
+    m_Classes[objectClass] = Identity{id, nameKey};
+
+    Append(TraceFormat::Record::Class);
+    Append(id);
+    AppendName(objectClass->Name.ToString());
+
+    return id;
+}
+
+void ProcessEventTrace::Append(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+}
+
+void ProcessEventTrace::AppendName(const std::string& name) {
+    uint16_t length = static_cast<uint16_t>(std::min<size_t>(name.size(), UINT16_MAX));
+    Append(length);
+    Append(name.data(), length);
+}
+
+} // namespace Broadsword
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "../Engine/SDK/SDK.hpp"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * Binary layout of a ProcessEvent trace (.bstrace)
+ *
+ * A FileHeader followed by records, each starting with a one-byte Record tag.
+ * Integers are little-endian and unaligned. Functions and classes are sent
+ * once, the first time they are seen, and referred to by ID afterwards:
+ *
+ *   Frame     u64 frame                            Calls below happened in this frame
+ *   Function  u32 id, u32 paramSize, u16 length, name ("Outer.Function")
+ *   Class     u32 id, u16 length, name
+ *   Call      u32 function, u32 objectClass, u32 paramBytes, paramBytes x u8
+ *
+ * paramSize is the function's UFunction::ParmsSize (parameters, without a
+ * Blueprint function's locals). paramBytes is 0 unless the trace was captured
+ * with parameters, in which case it is the function's paramSize. Calls are in entry order - a nested
+ * ProcessEvent call follows the call it happened in.
+ */
+namespace TraceFormat {
+
+constexpr uint32_t Magic = 0x52545342; // "BSTR"
+constexpr uint16_t Version = 1;
+
+enum class Record : uint8_t {
+    Frame = 1,
+    Function = 2,
+    Class = 3,
+    Call = 4
+};
+
+enum HeaderFlags : uint16_t {
+    HasParams = 1 << 0
+};
+
+#pragma pack(push, 1)
+struct FileHeader {
+    uint32_t magic = Magic;
+    uint16_t version = Version;
+    uint16_t flags = 0;
+};
+
+struct CallRecord {
+    uint32_t function;
+    uint32_t objectClass;
+    uint32_t paramBytes;
+};
+#pragma pack(pop)
+
+} // namespace TraceFormat
+
+/**
+ * ProcessEventTrace - Streams ProcessEvent calls to a compact binary trace
+ *
+ * While capturing, the detour appends one 13-byte record per call (plus the
+ * parameter block when parameters are captured) to an in-memory buffer.
+ * EndFrame() hands the buffer to the file and starts the next frame, so the
+ * detour itself never touches the disk. Traces are played back by
+ * Tools/TraceReplay to measure dispatch overhead outside the game.
+ *
+ * Parameter bytes are copied raw - pointers and FStrings inside them are
+ * meaningless once the process is gone.
+ *
+ * Not capturing, the detour pays a single relaxed atomic load.
+ *
+ * Thread Safety:
+ * - IsEnabled()/Record() are called from the detour on any thread
+ * - Everything else is game thread only
+ *
+ * Usage:
+ *   ProcessEventTrace::Get().Start("Broadsword_ProcessEvent.bstrace", false);
+ *   // ... frames later
+ *   ProcessEventTrace::Get().Stop();
+ */
+class ProcessEventTrace {
+public:
+    static ProcessEventTrace& Get();
+
+    ProcessEventTrace(const ProcessEventTrace&) = delete;
+    ProcessEventTrace& operator=(const ProcessEventTrace&) = delete;
+
+    static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * Start capturing into a new file (replaces an existing one)
+     *
+     * @param path Output file
+     * @param captureParams Also store each call's parameter block
+     * @return false if already capturing or the file could not be created
+     */
+    bool Start(const std::string& path, bool captureParams);
+
+    /**
+     * Write what is buffered and close the file
+     */
+    void Stop();
+
+    /**
+     * Record one ProcessEvent call (detour hot path, any thread)
+     */
+    void Record(SDK::UObject* object, SDK::UFunction* function, void* params);
+
+    /**
+     * Write the frame's calls and start the next frame
+     *
+     * Call once per frame on the game thread. Stops the capture once the
+     * file reaches MaxFileBytes.
+     */
+    void EndFrame();
+
+    bool IsCapturingParams() const { return m_CaptureParams; }
+    const std::string& GetPath() const { return m_Path; }
+    uint64_t GetCallCount() const { return m_CallCount.load(std::memory_order_relaxed); }
+    uint64_t GetDroppedCalls() const { return m_DroppedCalls.load(std::memory_order_relaxed); }
+    uint64_t GetBytesWritten() const { return m_BytesWritten; }
+    uint64_t GetFrameCount() const { return m_Frame; }
+
+    static constexpr size_t MaxBufferBytes = 64ull << 20; // Per frame - calls past it are dropped
+    static constexpr uint64_t MaxFileBytes = 4ull << 30;
+
+private:
+    ProcessEventTrace() = default;
+
+    struct Identity {
+        uint32_t id;
+        uint64_t nameKey; // Detects a new object at a reused address
+    };
+
+    // m_Mutex held
+    uint32_t FunctionId(SDK::UFunction* function);
+    uint32_t ClassId(SDK::UClass* objectClass);
+    void Append(const void* data, size_t size);
+    template<typename T>
+    void Append(const T& value) { Append(&value, sizeof(T)); }
+    void AppendName(const std::string& name);
+    void WriteBuffer();
+
+    static inline std::atomic<bool> s_Enabled = false;
+
+    std::mutex m_Mutex; // Guards the buffer and ID maps
+    std::vector<uint8_t> m_Buffer;
+    std::unordered_map<SDK::UFunction*, Identity> m_Functions;
+    std::unordered_map<SDK::UClass*, Identity> m_Classes;
+    uint32_t m_NextFunctionId = 1;
+    uint32_t m_NextClassId = 1; // 0 = no object
+    bool m_CaptureParams = false;
+    std::atomic<uint64_t> m_CallCount = 0;
+    std::atomic<uint64_t> m_DroppedCalls = 0;
+
+    // Game thread only
+    std::ofstream m_File;
+    std::string m_Path;
+    std::vector<uint8_t> m_WriteBuffer;
+    uint64_t m_BytesWritten = 0;
+    uint64_t m_Frame = 0;
+};
+
+} // namespace Broadsword
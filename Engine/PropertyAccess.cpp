@@ -0,0 +1,219 @@
+#include "PropertyAccess.hpp"
+#include "NameCache.hpp"
+#include "../Engine/SDK/SDK/CoreUObject_classes.hpp"
+#include <bit>
+#include <charconv>
+
+namespace Broadsword {
+
+namespace {
+
+// FNV-1a, continued across pieces of one name
+uint64_t Fnv(uint64_t hash, std::string_view text) {
+    for (char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+constexpr uint64_t FnvBasis = 0xCBF29CE484222325ull;
+
+uint64_t NameHash(const SDK::FName& name) {
+    uint64_t hash = Fnv(FnvBasis, name.View());
+    if (name.Number > 0) {
+        char digits[16];
+        digits[0] = '_';
+        auto result = std::to_chars(digits + 1, digits + sizeof(digits), name.Number - 1);
+        hash = Fnv(hash, std::string_view(digits, result.ptr - digits));
+    }
+    return hash;
+}
+
+uint64_t NameKey(const SDK::FName& name) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(name.ComparisonIndex)) << 32) | name.Number;
+}
+
+size_t SlotHash(const SDK::UStruct* owner, uint64_t nameHash) {
+    uint64_t value = (reinterpret_cast<uintptr_t>(owner) >> 4) ^ nameHash;
+    value *= 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(value ^ (value >> 32));
+}
+
+} // namespace
+
+std::string_view PropertyInfo::TypeName() const {
+    return property && property->ClassPrivate ? property->ClassPrivate->Name.View() : std::string_view();
+}
+
+PropertyAccess& PropertyAccess::Get() {
+    static PropertyAccess instance;
+    return instance;
+}
+
+const SDK::UStruct* PropertyAccess::ClassOf(const SDK::UObject* object) {
+    return object ? object->Class : nullptr;
+}
+
+const PropertyInfo* PropertyAccess::Find(const SDK::UObject* object, std::string_view name) {
+    return Find(ClassOf(object), name);
+}
+
+const PropertyInfo* PropertyAccess::Find(const SDK::UStruct* owner, std::string_view name) {
+    if (!owner) {
+        return nullptr;
+    }
+    m_Lookups++;
+
+    uint64_t nameHash = Fnv(FnvBasis, name);
+
+    if (!m_Slots.empty()) {
+        size_t mask = m_Slots.size() - 1;
+        for (size_t position = SlotHash(owner, nameHash) & mask;; position = (position + 1) & mask) {
+            const Slot& slot = m_Slots[position];
+            if (!slot.owner) {
+                break;
+            }
+            if (slot.owner == owner && slot.nameHash == nameHash && slot.ownerIndex == owner->Index &&
+                slot.ownerName == NameKey(owner->Name) && slot.childProperties == owner->ChildProperties &&
+                NameCache::Equals(slot.info->name, name)) {
+                return slot.info;
+            }
+        }
+    }
+
+    // Not cached, or the name doesn't exist - only a changed class gets a rebuild
+    const ClassProperties* properties = nullptr;
+    auto it = m_Classes.find(owner);
+    if (it != m_Classes.end() && it->second->index == owner->Index &&
+        it->second->nameKey == NameKey(owner->Name) && it->second->childProperties == owner->ChildProperties) {
+        properties = it->second.get();
+    } else {
+        properties = &Build(owner);
+    }
+
+    // Just built, or a name the class doesn't have (derived properties are last)
+    for (auto info = properties->properties.rbegin(); info != properties->properties.rend(); ++info) {
+        if (NameCache::Equals(info->name, name)) {
+            return &*info;
+        }
+    }
+    return nullptr;
+}
+
+const std::vector<PropertyInfo>* PropertyAccess::Properties(const SDK::UStruct* owner) {
+    if (!owner) {
+        return nullptr;
+    }
+
+    auto it = m_Classes.find(owner);
+    if (it != m_Classes.end() && it->second->index == owner->Index &&
+        it->second->nameKey == NameKey(owner->Name) && it->second->childProperties == owner->ChildProperties) {
+        return &it->second->properties;
+    }
+    return &Build(owner).properties;
+}
+
+void PropertyAccess::Clear() {
+    m_Slots.clear();
+    m_SlotCount = 0;
+    m_Classes.clear();
+    m_Properties = 0;
+}
+
+PropertyAccess::Stats PropertyAccess::GetStats() const {
+    return {m_Classes.size(), m_Properties, m_Lookups, m_Builds};
+}
+
+const PropertyAccess::ClassProperties& PropertyAccess::Build(const SDK::UStruct* owner) {
+    m_Builds++;
+
+    // Drop what a previous class at this address left behind
+    auto it = m_Classes.find(owner);
+    if (it != m_Classes.end()) {
+        m_Properties -= it->second->properties.size();
+        Rehash(m_Slots.size(), owner);
+        m_Classes.erase(it);
+    }
+
+    auto properties = std::make_unique<ClassProperties>();
+    properties->index = owner->Index;
+    properties->nameKey = NameKey(owner->Name);
+    properties->childProperties = owner->ChildProperties;
+
+    // Supers first, so offsets read in memory order
+    std::vector<const SDK::UStruct*> chain;
+    for (const SDK::UStruct* current = owner; current; current = current->Super) {
+        chain.push_back(current);
+    }
+
+    for (auto level = chain.rbegin(); level != chain.rend(); ++level) {
+        for (const SDK::FField* field = (*level)->ChildProperties; field; field = field->Next) {
+            // Property chains only hold FProperty subclasses
+            const auto* property = static_cast<const SDK::FProperty*>(field);
+
+            PropertyInfo info;
+            info.name = field->Name;
+            info.property = property;
+            info.offset = property->Offset;
+            info.arrayDim = property->ArrayDim > 0 ? property->ArrayDim : 1;
+            info.elementSize = property->ElementSize;
+            info.size = property->ElementSize * info.arrayDim;
+            info.flags = property->PropertyFlags;
+            info.type = field->ClassPrivate ? static_cast<SDK::EClassCastFlags>(field->ClassPrivate->CastFlags)
+                                            : SDK::EClassCastFlags::None;
+
+            if (info.Is(SDK::EClassCastFlags::BoolProperty)) {
+                const auto* boolProperty = static_cast<const SDK::FBoolProperty*>(property);
+                info.byteOffset = boolProperty->ByteOffset;
+                info.byteMask = boolProperty->ByteMask;
+                info.fieldMask = boolProperty->FieldMask;
+            }
+
+            properties->properties.push_back(info);
+        }
+    }
+
+    // Grow before taking pointers into the class's list; keep the table at most half full
+    size_t needed = (m_SlotCount + properties->properties.size()) * 2;
+    if (needed > m_Slots.size()) {
+        Rehash(std::bit_ceil(std::max<size_t>(1024, needed)), nullptr);
+    }
+
+    // A derived class's property wins over a super's one of the same name
+    for (const PropertyInfo& info : properties->properties) {
+        Insert({owner, NameHash(info.name), properties->index, properties->nameKey, properties->childProperties, &info});
+    }
+
+    m_Properties += properties->properties.size();
+    return *m_Classes.emplace(owner, std::move(properties)).first->second;
+}
+
+void PropertyAccess::Insert(const Slot& slot) {
+    size_t mask = m_Slots.size() - 1;
+    size_t position = SlotHash(slot.owner, slot.nameHash) & mask;
+    while (m_Slots[position].owner &&
+           (m_Slots[position].owner != slot.owner || m_Slots[position].nameHash != slot.nameHash ||
+            !(m_Slots[position].info->name == slot.info->name))) {
+        position = (position + 1) & mask;
+    }
+
+    if (!m_Slots[position].owner) {
+        m_SlotCount++;
+    }
+    m_Slots[position] = slot;
+}
+
+void PropertyAccess::Rehash(size_t capacity, const SDK::UStruct* drop) {
+    std::vector<Slot> previous = std::move(m_Slots);
+    m_Slots.assign(capacity, Slot{});
+    m_SlotCount = 0;
+
+    for (const Slot& slot : previous) {
+        if (slot.owner && slot.owner != drop) {
+            Insert(slot);
+        }
+    }
+}
+
+} // namespace Broadsword
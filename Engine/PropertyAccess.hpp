@@ -0,0 +1,286 @@
+#pragma once
+
+#include "../Engine/SDK/SDK/Basic.hpp"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace SDK {
+class UStruct;
+}
+
+namespace Broadsword {
+
+/**
+ * PropertyInfo - One reflected property of a class or struct
+ */
+struct PropertyInfo {
+    SDK::FName name;
+    const SDK::FProperty* property = nullptr;
+    int32_t offset = 0;        // Byte offset inside the object/struct
+    int32_t size = 0;          // ElementSize * ArrayDim
+    int32_t elementSize = 0;
+    int32_t arrayDim = 1;
+    uint64_t flags = 0;        // EPropertyFlags
+    SDK::EClassCastFlags type = SDK::EClassCastFlags::None; // Property class cast flags
+
+    // FBoolProperty masks (bitfield bools share a byte)
+    uint8_t byteOffset = 0;
+    uint8_t byteMask = 0;
+    uint8_t fieldMask = 0;
+
+    bool Is(SDK::EClassCastFlags castFlags) const { return static_cast<bool>(type & castFlags); }
+
+    // Property class name (e.g., "FloatProperty", "StructProperty")
+    std::string_view TypeName() const;
+};
+
+/**
+ * PropertyAccess - Reflection-driven property access by name
+ *
+ * Mods can only touch fields compiled into the Dumper-7 headers, which break on
+ * every game update. PropertyAccess reads the layout from the engine instead:
+ * the first lookup on a class walks UStruct::ChildProperties / FField::Next of
+ * the class and its supers once, and caches every property's offset, size and
+ * type. Lookups after that are one probe of a flat (open-addressed) table keyed
+ * by (class, name hash), so a typed read is one hash lookup and a memcpy.
+ *
+ * A class whose pointer was reused by a different class (Index/Name changed),
+ * or whose property chain changed, is rebuilt on its next lookup.
+ *
+ * Typed access returns nothing when the property is missing, its size doesn't
+ * match sizeof(T), or its type doesn't: arithmetic T needs the numeric property
+ * of the same width and signedness (float = FloatProperty, double =
+ * DoubleProperty, an enum T or integer T may also read an EnumProperty), and a
+ * pointer T needs an object property. Struct types are matched by size only.
+ * bool reads and writes honor bitfield masks.
+ *
+ * Thread Safety:
+ * - Find(), Properties() and the by-name accessors are game thread only
+ * - A PropertyInfo stays valid until its class is rebuilt or Clear() runs, and
+ *   the static Read()/Write() overloads taking one can be called from any
+ *   thread (e.g., an ObjectScan predicate)
+ *
+ * Usage:
+ *   auto& props = PropertyAccess::Get();
+ *   if (auto health = props.Read<float>(pawn, "Health")) { ... }
+ *   props.Write(pawn, "bCanBeDamaged", false);
+ *
+ *   // Resolve once, then raw loads
+ *   const PropertyInfo* health = props.Find(SDK::APawn::StaticClass(), "Health");
+ *   auto values = props.ReadAll<float>(pawns, "Health");
+ */
+class PropertyAccess {
+public:
+    struct Stats {
+        size_t classes = 0;       // Classes/structs with a cached layout
+        size_t properties = 0;    // Cached properties (inherited ones counted per class)
+        uint64_t lookups = 0;
+        uint64_t builds = 0;      // Layouts built or rebuilt
+    };
+
+    static PropertyAccess& Get();
+
+    PropertyAccess(const PropertyAccess&) = delete;
+    PropertyAccess& operator=(const PropertyAccess&) = delete;
+
+    /**
+     * Find a property declared on owner or one of its supers
+     *
+     * @param owner UClass or UScriptStruct
+     * @param name Property name ("Health", "Value_1")
+     * @return Property, or nullptr if owner is null or has no such property
+     */
+    const PropertyInfo* Find(const SDK::UStruct* owner, std::string_view name);
+
+    /**
+     * Find a property on an object's class
+     */
+    const PropertyInfo* Find(const SDK::UObject* object, std::string_view name);
+
+    /**
+     * Every property of owner, supers' first, in declaration order
+     *
+     * @return Properties, or nullptr if owner is null
+     */
+    const std::vector<PropertyInfo>* Properties(const SDK::UStruct* owner);
+
+    /**
+     * Drop all cached layouts (invalidates every PropertyInfo)
+     */
+    void Clear();
+
+    Stats GetStats() const;
+
+    /**
+     * Whether a property can be accessed as T (size, and type for non-struct T)
+     */
+    template<typename T>
+    static bool Matches(const PropertyInfo* info) {
+        // Any of the expected classes (the SDK's operator& tests for all of them)
+        constexpr auto expected = static_cast<uint64_t>(ExpectedType<T>());
+        return info->size == static_cast<int32_t>(sizeof(T)) &&
+               (expected == 0 || (static_cast<uint64_t>(info->type) & expected) != 0);
+    }
+
+    template<typename T>
+    static T* Ptr(void* container, const PropertyInfo* info) {
+        if (!container || !info || !Matches<T>(info)) {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(static_cast<uint8_t*>(container) + info->offset);
+    }
+
+    template<typename T>
+    static std::optional<T> Read(const void* container, const PropertyInfo* info) {
+        static_assert(std::is_trivially_copyable_v<T>, "Read() copies raw bytes");
+        if (!container || !info) {
+            return std::nullopt;
+        }
+
+        const auto* data = static_cast<const uint8_t*>(container) + info->offset;
+        if constexpr (std::is_same_v<T, bool>) {
+            if (info->Is(SDK::EClassCastFlags::BoolProperty)) {
+                return (data[info->byteOffset] & info->fieldMask) != 0;
+            }
+        }
+
+        if (!Matches<T>(info)) {
+            return std::nullopt;
+        }
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    static bool Write(void* container, const PropertyInfo* info, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Write() copies raw bytes");
+        if (!container || !info) {
+            return false;
+        }
+
+        auto* data = static_cast<uint8_t*>(container) + info->offset;
+        if constexpr (std::is_same_v<T, bool>) {
+            if (info->Is(SDK::EClassCastFlags::BoolProperty)) {
+                uint8_t& byte = data[info->byteOffset];
+                byte = static_cast<uint8_t>((byte & ~info->fieldMask) | (value ? info->byteMask : 0));
+                return true;
+            }
+        }
+
+        if (!Matches<T>(info)) {
+            return false;
+        }
+        std::memcpy(data, &value, sizeof(T));
+        return true;
+    }
+
+    template<typename T>
+    std::optional<T> Read(const SDK::UObject* object, std::string_view name) {
+        return Read<T>(static_cast<const void*>(object), Find(object, name));
+    }
+
+    template<typename T>
+    bool Write(SDK::UObject* object, std::string_view name, const T& value) {
+        return Write<T>(static_cast<void*>(object), Find(object, name), value);
+    }
+
+    /**
+     * Read one property from many objects
+     *
+     * Resolves the name once per run of objects sharing a class (ObjectScan
+     * results group naturally), so the rest are raw loads.
+     *
+     * @return One value per object; empty where the object is null or lacks the property
+     */
+    template<typename T>
+    std::vector<std::optional<T>> ReadAll(std::span<SDK::UObject* const> objects, std::string_view name) {
+        std::vector<std::optional<T>> values;
+        values.reserve(objects.size());
+
+        const SDK::UStruct* lastClass = nullptr;
+        const PropertyInfo* info = nullptr;
+        for (SDK::UObject* object : objects) {
+            const SDK::UStruct* objectClass = ClassOf(object);
+            if (objectClass != lastClass) {
+                info = Find(objectClass, name);
+                lastClass = objectClass;
+            }
+            values.push_back(objectClass ? Read<T>(static_cast<const void*>(object), info) : std::nullopt);
+        }
+        return values;
+    }
+
+private:
+    PropertyAccess() = default;
+
+    // Property class(es) a T may be read from; None = any (structs match by size)
+    template<typename T>
+    static constexpr SDK::EClassCastFlags ExpectedType() {
+        using Flags = SDK::EClassCastFlags;
+        if constexpr (std::is_same_v<T, bool>) {
+            return Flags::BoolProperty;
+        } else if constexpr (std::is_enum_v<T>) {
+            return ExpectedType<std::underlying_type_t<T>>() | Flags::EnumProperty;
+        } else if constexpr (std::is_integral_v<T>) {
+            constexpr bool isSigned = std::is_signed_v<T>;
+            if constexpr (sizeof(T) == 1) {
+                return (isSigned ? Flags::Int8Property : Flags::ByteProperty) | Flags::EnumProperty;
+            } else if constexpr (sizeof(T) == 2) {
+                return (isSigned ? Flags::Int16Property : Flags::UInt16Property) | Flags::EnumProperty;
+            } else if constexpr (sizeof(T) == 4) {
+                return (isSigned ? Flags::IntProperty : Flags::UInt32Property) | Flags::EnumProperty;
+            } else {
+                return (isSigned ? Flags::Int64Property : Flags::UInt64Property) | Flags::EnumProperty;
+            }
+        } else if constexpr (std::is_same_v<T, float>) {
+            return Flags::FloatProperty;
+        } else if constexpr (std::is_same_v<T, double>) {
+            return Flags::DoubleProperty; // Includes LargeWorldCoordinatesRealProperty
+        } else if constexpr (std::is_pointer_v<T>) {
+            return Flags::ObjectPropertyBase;
+        } else {
+            return Flags::None;
+        }
+    }
+
+    struct ClassProperties {
+        int32_t index = -1;               // Owner's GObjects index when built
+        uint64_t nameKey = 0;             // Owner's FName when built
+        const SDK::FField* childProperties = nullptr;
+        std::vector<PropertyInfo> properties;
+    };
+
+    // (owner, name hash) -> property; owner nullptr = empty slot
+    struct Slot {
+        const SDK::UStruct* owner = nullptr;
+        uint64_t nameHash = 0;
+        int32_t ownerIndex = -1;
+        uint64_t ownerName = 0;
+        const SDK::FField* childProperties = nullptr;
+        const PropertyInfo* info = nullptr;
+    };
+
+    static const SDK::UStruct* ClassOf(const SDK::UObject* object);
+
+    const ClassProperties& Build(const SDK::UStruct* owner);
+    void Insert(const Slot& slot);
+    void Rehash(size_t capacity, const SDK::UStruct* drop);
+
+    std::vector<Slot> m_Slots;
+    size_t m_SlotCount = 0;
+    std::unordered_map<const SDK::UStruct*, std::unique_ptr<ClassProperties>> m_Classes;
+
+    size_t m_Properties = 0;
+    uint64_t m_Lookups = 0;
+    uint64_t m_Builds = 0;
+};
+
+} // namespace Broadsword
@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ABP_CopyPose1_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ABP_CopyPose1_classes.hpp"
+#include "../SDK/ABP_CopyPose1_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose1_C, AnimGraph, "ABP_CopyPose1_C", "AnimGraph", SDK::Params::ABP_CopyPose1_C_AnimGraph)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose1_C, BlueprintBeginPlay, "ABP_CopyPose1_C", "BlueprintBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose1_C, BlueprintInitializeAnimation, "ABP_CopyPose1_C", "BlueprintInitializeAnimation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose1_C, BlueprintUpdateAnimation, "ABP_CopyPose1_C", "BlueprintUpdateAnimation", SDK::Params::ABP_CopyPose1_C_BlueprintUpdateAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose1_C, ExecuteUbergraph_ABP_CopyPose1, "ABP_CopyPose1_C", "ExecuteUbergraph_ABP_CopyPose1", SDK::Params::ABP_CopyPose1_C_ExecuteUbergraph_ABP_CopyPose1)
+// clang-format on
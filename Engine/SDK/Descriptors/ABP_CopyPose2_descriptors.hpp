@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ABP_CopyPose2_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ABP_CopyPose2_classes.hpp"
+#include "../SDK/ABP_CopyPose2_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose2_C, AnimGraph, "ABP_CopyPose2_C", "AnimGraph", SDK::Params::ABP_CopyPose2_C_AnimGraph)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose2_C, BlueprintBeginPlay, "ABP_CopyPose2_C", "BlueprintBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose2_C, BlueprintInitializeAnimation, "ABP_CopyPose2_C", "BlueprintInitializeAnimation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose2_C, BlueprintUpdateAnimation, "ABP_CopyPose2_C", "BlueprintUpdateAnimation", SDK::Params::ABP_CopyPose2_C_BlueprintUpdateAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose2_C, ExecuteUbergraph_ABP_CopyPose2, "ABP_CopyPose2_C", "ExecuteUbergraph_ABP_CopyPose2", SDK::Params::ABP_CopyPose2_C_ExecuteUbergraph_ABP_CopyPose2)
+// clang-format on
@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ABP_CopyPose_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ABP_CopyPose_classes.hpp"
+#include "../SDK/ABP_CopyPose_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose_C, AnimGraph, "ABP_CopyPose_C", "AnimGraph", SDK::Params::ABP_CopyPose_C_AnimGraph)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose_C, BlueprintBeginPlay, "ABP_CopyPose_C", "BlueprintBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose_C, BlueprintInitializeAnimation, "ABP_CopyPose_C", "BlueprintInitializeAnimation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose_C, BlueprintUpdateAnimation, "ABP_CopyPose_C", "BlueprintUpdateAnimation", SDK::Params::ABP_CopyPose_C_BlueprintUpdateAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_CopyPose_C, ExecuteUbergraph_ABP_CopyPose, "ABP_CopyPose_C", "ExecuteUbergraph_ABP_CopyPose", SDK::Params::ABP_CopyPose_C_ExecuteUbergraph_ABP_CopyPose)
+// clang-format on
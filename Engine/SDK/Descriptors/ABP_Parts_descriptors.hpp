@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ABP_Parts_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ABP_Parts_classes.hpp"
+#include "../SDK/ABP_Parts_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Parts_C, AnimGraph, "ABP_Parts_C", "AnimGraph", SDK::Params::ABP_Parts_C_AnimGraph)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Parts_C, BlueprintBeginPlay, "ABP_Parts_C", "BlueprintBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Parts_C, BlueprintInitializeAnimation, "ABP_Parts_C", "BlueprintInitializeAnimation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Parts_C, BlueprintUpdateAnimation, "ABP_Parts_C", "BlueprintUpdateAnimation", SDK::Params::ABP_Parts_C_BlueprintUpdateAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Parts_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Parts_AnimGraphNode_TwoWayBlend_4F1E5A824D23E69605A424860020F3BF, "ABP_Parts_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Parts_AnimGraphNode_TwoWayBlend_4F1E5A824D23E69605A424860020F3BF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Parts_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Parts_AnimGraphNode_TwoWayBlend_8891B42B473E6ED5862E26A9705F4AC6, "ABP_Parts_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Parts_AnimGraphNode_TwoWayBlend_8891B42B473E6ED5862E26A9705F4AC6", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Parts_C, ExecuteUbergraph_ABP_Parts, "ABP_Parts_C", "ExecuteUbergraph_ABP_Parts", SDK::Params::ABP_Parts_C_ExecuteUbergraph_ABP_Parts)
+// clang-format on
@@ -0,0 +1,430 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ABP_Willie_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ABP_Willie_classes.hpp"
+#include "../SDK/ABP_Willie_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, AnimGraph, "ABP_Willie_C", "AnimGraph", SDK::Params::ABP_Willie_C_AnimGraph)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, BlueprintBeginPlay, "ABP_Willie_C", "BlueprintBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, BlueprintInitializeAnimation, "ABP_Willie_C", "BlueprintInitializeAnimation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, BlueprintUpdateAnimation, "ABP_Willie_C", "BlueprintUpdateAnimation", SDK::Params::ABP_Willie_C_BlueprintUpdateAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_1ADB603E490318E516C9349847DCFA3F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_1ADB603E490318E516C9349847DCFA3F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_4B882F4A4653DDA2135FFFA1FC336E07, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_4B882F4A4653DDA2135FFFA1FC336E07", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_4D96595B4E1CBE769929CB946760B925, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_4D96595B4E1CBE769929CB946760B925", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_5AA35AC449BC6328D915B7ADF1C5E06B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_5AA35AC449BC6328D915B7ADF1C5E06B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_5D27DC7D49DE6E005F880E99061206A9, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_5D27DC7D49DE6E005F880E99061206A9", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_5EDBBA404E849F1EDBFD34AEED0C8A56, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_5EDBBA404E849F1EDBFD34AEED0C8A56", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_8E49CF824ED168916DF829BB54AC4EAE, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_8E49CF824ED168916DF829BB54AC4EAE", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_A3A0F3454FFB5D2483DC1A93F5988794, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyAdditive_A3A0F3454FFB5D2483DC1A93F5988794", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_4971F82D4CFEA6D6A8DEE88B072CA7FD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_4971F82D4CFEA6D6A8DEE88B072CA7FD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_5163F821424CB1EECD063E991DACC8A7, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_5163F821424CB1EECD063E991DACC8A7", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_51E80EC24E761A6E198295AA5167E96C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_51E80EC24E761A6E198295AA5167E96C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_8C6AE93442CA3B3186BA308F243CCFEC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_8C6AE93442CA3B3186BA308F243CCFEC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_96637A854812AEA40FB849B5B897074E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_96637A854812AEA40FB849B5B897074E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_B9FC387F43488B271963658AA025EC3C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_B9FC387F43488B271963658AA025EC3C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_BBD6E0F24F6E48A80A578786F8BF1E76, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_BBD6E0F24F6E48A80A578786F8BF1E76", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_FD95F83A468F752F276B28AF1788D864, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ApplyMeshSpaceAdditive_FD95F83A468F752F276B28AF1788D864", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_016A13C74EB9D8176F3DAC9FCA5D3D58, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_016A13C74EB9D8176F3DAC9FCA5D3D58", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_053ADE944A372DE9BD7D2EABBFA1F7E0, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_053ADE944A372DE9BD7D2EABBFA1F7E0", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_05531FD34BDC5BE38E35FBA0D3C1965B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_05531FD34BDC5BE38E35FBA0D3C1965B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_0F5DF9B24445F3D9C7D6038313BBB769, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_0F5DF9B24445F3D9C7D6038313BBB769", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_1131C1DD4FA34EEB89E34A90D0497CDC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_1131C1DD4FA34EEB89E34A90D0497CDC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_131DC6FF4A9985DF8A3B048E02097DD5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_131DC6FF4A9985DF8A3B048E02097DD5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_2200C9974757B91BDF1F1E8FF4D3309A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_2200C9974757B91BDF1F1E8FF4D3309A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_224ABD534F15943E20A199AA675A4DB2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_224ABD534F15943E20A199AA675A4DB2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_2777FFED405F37DFAF6F92BD15DB014F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_2777FFED405F37DFAF6F92BD15DB014F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_2BC5A518477AC7F5D2CCF0BDA26848DB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_2BC5A518477AC7F5D2CCF0BDA26848DB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_3C7A574449CF6C15F857D6959A52718B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_3C7A574449CF6C15F857D6959A52718B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_4159FAB241DFB201C8BD67BE8159E98F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_4159FAB241DFB201C8BD67BE8159E98F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_4401F37C4523B753297F92A68750FA39, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_4401F37C4523B753297F92A68750FA39", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_49CB03614A9F8349A17BDABCC26EE139, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_49CB03614A9F8349A17BDABCC26EE139", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_4B8EFF2F4D14FD38314C48AFCDF82BB5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_4B8EFF2F4D14FD38314C48AFCDF82BB5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_55DD12A34D744756F01F74AC14735202, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_55DD12A34D744756F01F74AC14735202", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_64C96096494EF760AA3208831D986B03, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_64C96096494EF760AA3208831D986B03", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_6812EFC94C0A4956C2AD76B320CF8F1D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_6812EFC94C0A4956C2AD76B320CF8F1D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_6B21BCD94FFE34AB957E9692B550089F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_6B21BCD94FFE34AB957E9692B550089F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_6E8BA66544941FF98D54AD8B784A5D2C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_6E8BA66544941FF98D54AD8B784A5D2C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_711A74B34CF274C8068597B06CA9813A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_711A74B34CF274C8068597B06CA9813A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_72A546ED44906076063EA2B32F09B6EA, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_72A546ED44906076063EA2B32F09B6EA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_7478DEB84DB722CB3B9DBCBABF1E0711, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_7478DEB84DB722CB3B9DBCBABF1E0711", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_756955244474BFBADD4B1E904E7DA2C1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_756955244474BFBADD4B1E904E7DA2C1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_7B6290B64C3E2DC9953D35BBBADFD7C1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_7B6290B64C3E2DC9953D35BBBADFD7C1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_7CFFFF474FAADE4290F613A2EDEF8AA5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_7CFFFF474FAADE4290F613A2EDEF8AA5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_8CD882B44C99D6FDE6DFB9B5171DB7BF, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_8CD882B44C99D6FDE6DFB9B5171DB7BF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_8D7F8A28477BEA530766ECA66DF0994E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_8D7F8A28477BEA530766ECA66DF0994E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_8DEC81924CF34BD62C2223A53566927E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_8DEC81924CF34BD62C2223A53566927E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_916A2493415AF475D87D159E4F8E8937, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_916A2493415AF475D87D159E4F8E8937", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_97EC39DD4FD308BD87E4DC8F42E28C23, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_97EC39DD4FD308BD87E4DC8F42E28C23", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_983102074AB7E71C5EA82D8191A8B697, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_983102074AB7E71C5EA82D8191A8B697", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_994FE6FF4D4980D8C7925ABD5DCB71D8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_994FE6FF4D4980D8C7925ABD5DCB71D8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_99D6F2F4467A7E95CD0CFBB1D729741C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_99D6F2F4467A7E95CD0CFBB1D729741C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_9ABDEBC3441E1E9CECE5E79670C7FDC8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_9ABDEBC3441E1E9CECE5E79670C7FDC8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_9F67C2DE4ED81BE4D3E6EE8822D23B1F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_9F67C2DE4ED81BE4D3E6EE8822D23B1F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_A46A14684EC634C4750A72987528A073, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_A46A14684EC634C4750A72987528A073", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_A60C4C9C47B71FB1B59685A6FDE15523, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_A60C4C9C47B71FB1B59685A6FDE15523", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_A67566E64B28E30048BAF08A595BA99D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_A67566E64B28E30048BAF08A595BA99D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_A6E7D4B44BC44B89F3FA4C944483B32E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_A6E7D4B44BC44B89F3FA4C944483B32E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_AA1A7C0F43E597949A4D6999ACD80C71, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_AA1A7C0F43E597949A4D6999ACD80C71", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_ACF70273499E0A2BF24EA1AE7DAB0774, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_ACF70273499E0A2BF24EA1AE7DAB0774", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_B0059B9B43A1E1DD411992A0E10D64AD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_B0059B9B43A1E1DD411992A0E10D64AD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_B1347CDE495CFF82CB76588BFF9C5805, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_B1347CDE495CFF82CB76588BFF9C5805", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_B583A050493ABB05CF1AD98C0476CD7C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_B583A050493ABB05CF1AD98C0476CD7C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_B808B4A84BF95108BE74F5A3D8321520, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_B808B4A84BF95108BE74F5A3D8321520", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_BA47D18B41AA59E12F24D8BE107E1FE2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_BA47D18B41AA59E12F24D8BE107E1FE2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_BD1D7CCF47F8759D76C4FBBAC7296DC2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_BD1D7CCF47F8759D76C4FBBAC7296DC2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_C232AF0447AD05C337ED9892E87CF0D1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_C232AF0447AD05C337ED9892E87CF0D1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_C728F90946F2617645822BB500C5047E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_C728F90946F2617645822BB500C5047E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_C85DAD634E084C85FA2707A436E30D68, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_C85DAD634E084C85FA2707A436E30D68", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_C88A4D534FB392C097C321A6B85093E3, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_C88A4D534FB392C097C321A6B85093E3", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_CC82374A45928AE51D9683924ABFF297, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_CC82374A45928AE51D9683924ABFF297", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_D8054D89453656A37F935CBC11495B2B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_D8054D89453656A37F935CBC11495B2B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_DAF791644B250AFA8D7C489ECDDEE43E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_DAF791644B250AFA8D7C489ECDDEE43E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_DCDC8AC644B2EFA7B2F823AC92E9C53A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_DCDC8AC644B2EFA7B2F823AC92E9C53A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_E581D11744DBC0289212ACB96A86DF52, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_E581D11744DBC0289212ACB96A86DF52", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_ED3DBB3E43A1541FF96A718D8AB801CD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_ED3DBB3E43A1541FF96A718D8AB801CD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_F19FD3D54E3052EB8A62369582FE0D24, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_F19FD3D54E3052EB8A62369582FE0D24", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_FDE9222A470DF1E28A99E6BA5A06CF38, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByBool_FDE9222A470DF1E28A99E6BA5A06CF38", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByInt_8DBE37A346F89E1EC918DEA3FA95BD92, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendListByInt_8DBE37A346F89E1EC918DEA3FA95BD92", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0082C2974E4ADEEE33036A85D258B7DB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0082C2974E4ADEEE33036A85D258B7DB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0157B734487DCD81EC57F39AB734F850, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0157B734487DCD81EC57F39AB734F850", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_023EBD574C44D4E0EF0C6A8D924FBA9D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_023EBD574C44D4E0EF0C6A8D924FBA9D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0274FC164B981A477A997BA90B562F9F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0274FC164B981A477A997BA90B562F9F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_028A71EF41D67A3183FD6AAA040D65AE, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_028A71EF41D67A3183FD6AAA040D65AE", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0673596E441DB20F6432CF8F49ABA3D6, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0673596E441DB20F6432CF8F49ABA3D6", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_06AAF20842A401D8B3B795BC645DC0E4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_06AAF20842A401D8B3B795BC645DC0E4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_07943D0C4FF70D357D44529408EC015D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_07943D0C4FF70D357D44529408EC015D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_08122E304BC4C77EABF8D4BEDCE65159, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_08122E304BC4C77EABF8D4BEDCE65159", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0FBADD394713D708ED1BEF834A5C6577, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_0FBADD394713D708ED1BEF834A5C6577", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_11C9C3294F1372EB57CA45A9C9625463, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_11C9C3294F1372EB57CA45A9C9625463", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_12304B8445F51DEE2A2A738BA4444ED5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_12304B8445F51DEE2A2A738BA4444ED5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_12F58D8344C24CA87753F7AD365C060B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_12F58D8344C24CA87753F7AD365C060B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_130E303F47EF7C355C1DA99A10404822, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_130E303F47EF7C355C1DA99A10404822", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_14FEB74D437D7CDBFD923FB553AC49CF, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_14FEB74D437D7CDBFD923FB553AC49CF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_15CCCD0F4E2C6E5C08F68EB0E4BA9358, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_15CCCD0F4E2C6E5C08F68EB0E4BA9358", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_19A721FC4E5F390B9FF5E2AA8B470126, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_19A721FC4E5F390B9FF5E2AA8B470126", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_19CF77294457704FE619C683271587D2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_19CF77294457704FE619C683271587D2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1A82F09A4AFB374C24E339AED2C0F7F2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1A82F09A4AFB374C24E339AED2C0F7F2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1AC01C0F458EA00C83118F816FF8376B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1AC01C0F458EA00C83118F816FF8376B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1CEC70564BC0B7DC88B51E8C12DC8F0E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1CEC70564BC0B7DC88B51E8C12DC8F0E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1E3B96564EBBC2A60B27CA96AD724651, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1E3B96564EBBC2A60B27CA96AD724651", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1F6114DA43D7271C296D6F8E15A005D5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_1F6114DA43D7271C296D6F8E15A005D5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2063F7AC4986AF38B7C83BAEBD31EEE0, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2063F7AC4986AF38B7C83BAEBD31EEE0", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_20F897C1434705CE743A7280737C5AED, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_20F897C1434705CE743A7280737C5AED", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_211E7770408F72065E2E88A0DECCDCCC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_211E7770408F72065E2E88A0DECCDCCC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_26A80F374BCC898D1804AB9FE67F48E4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_26A80F374BCC898D1804AB9FE67F48E4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2729F385498D27CD66BD7CB473CA4946, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2729F385498D27CD66BD7CB473CA4946", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_273829A8442A64BBC427468420E25C8D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_273829A8442A64BBC427468420E25C8D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2AC65EA24808F4CE882F47BB04409E99, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2AC65EA24808F4CE882F47BB04409E99", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2B59E82A47EB16FA6F7F73BF2E58D7DA, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2B59E82A47EB16FA6F7F73BF2E58D7DA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2C0F425E411AA9C281C831A03241B301, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2C0F425E411AA9C281C831A03241B301", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2D80242B4C07CDE698F1F490007B7EB5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2D80242B4C07CDE698F1F490007B7EB5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2F6289AF49DDA288494C49A2CA24E712, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_2F6289AF49DDA288494C49A2CA24E712", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_30560FA54E354797019A7DBB3D580E73, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_30560FA54E354797019A7DBB3D580E73", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_31783E884ED2CAB91850279F80E62573, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_31783E884ED2CAB91850279F80E62573", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_32127BB94E082562A536E59011EA051A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_32127BB94E082562A536E59011EA051A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_32F347A84D9FEEDE520C0DA7D71C31E8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_32F347A84D9FEEDE520C0DA7D71C31E8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_333C0A3C45FCDA53A9311DAD08B469EB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_333C0A3C45FCDA53A9311DAD08B469EB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_340D54A44685FF32328892B2EA022DF3, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_340D54A44685FF32328892B2EA022DF3", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_34CBECB84E60202403202F9C326D6C85, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_34CBECB84E60202403202F9C326D6C85", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_34F56942441B515EF78C7F8BF2C8DF8F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_34F56942441B515EF78C7F8BF2C8DF8F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_35172AA44033A64DBA12C0B335256166, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_35172AA44033A64DBA12C0B335256166", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_35DC3561425532BB2BA0D99F244475FD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_35DC3561425532BB2BA0D99F244475FD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_364225BD49BADD33FC144FA980DB0D10, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_364225BD49BADD33FC144FA980DB0D10", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_381786C7448130609AF4428E6BA9B3A4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_381786C7448130609AF4428E6BA9B3A4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3910C69B4F70197997D163BA55462B58, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3910C69B4F70197997D163BA55462B58", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_39A981E0499A166CFD833EA6E1C0EAB4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_39A981E0499A166CFD833EA6E1C0EAB4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3A7E66E442B5A2A907E810A78DF3817A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3A7E66E442B5A2A907E810A78DF3817A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3B826A5E4BD6F178705A4AA0BF0EE284, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3B826A5E4BD6F178705A4AA0BF0EE284", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3BBC9BC74939835A1308BCBD8ED2CC3C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3BBC9BC74939835A1308BCBD8ED2CC3C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3C5A9E2043CAD63DD84452A235AEB884, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3C5A9E2043CAD63DD84452A235AEB884", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3D38DE5F4B5C48A5F5EB12A29E51F487, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3D38DE5F4B5C48A5F5EB12A29E51F487", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3DB48B3B4383B82C17F125AA40FCA016, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_3DB48B3B4383B82C17F125AA40FCA016", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_41EFB9E34C34DDBAC0C0A2B3A7B03E1E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_41EFB9E34C34DDBAC0C0A2B3A7B03E1E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_42E1191F4976D40FFA8060871DB57546, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_42E1191F4976D40FFA8060871DB57546", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_433DA2864ACDE282FCBBB2954C511330, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_433DA2864ACDE282FCBBB2954C511330", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_46D7A2654AA37981917D9DA243B41DB5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_46D7A2654AA37981917D9DA243B41DB5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_47055CEA4A89EE15379B7FB67B6D02CF, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_47055CEA4A89EE15379B7FB67B6D02CF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_4791BC6E47BD46C1F9D35EBC9D903840, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_4791BC6E47BD46C1F9D35EBC9D903840", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_488E588549C8356CCCF327B8B394D2DA, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_488E588549C8356CCCF327B8B394D2DA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_4B5A86F14AF3548ADB5CC6A91B33043A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_4B5A86F14AF3548ADB5CC6A91B33043A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_4B6C8A4F4C8B129F29CE178D015B9F27, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_4B6C8A4F4C8B129F29CE178D015B9F27", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_4E96376D4F78267205F667A3384EEAED, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_4E96376D4F78267205F667A3384EEAED", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_50B6448D4B90DFB65701D7B72E856D86, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_50B6448D4B90DFB65701D7B72E856D86", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_515BF94A405EF519362B74A01151892B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_515BF94A405EF519362B74A01151892B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_5186650B48EA5D0713DFE59330101D03, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_5186650B48EA5D0713DFE59330101D03", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_52A934D24C49E39D1BC4CF9EE0217923, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_52A934D24C49E39D1BC4CF9EE0217923", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_53D131A049A52E3E2C25FBB491F5F390, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_53D131A049A52E3E2C25FBB491F5F390", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_599A731349C332E9BE0E9D972CA45657, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_599A731349C332E9BE0E9D972CA45657", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_5DB1068346AA313096B024A7EABADF07, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_5DB1068346AA313096B024A7EABADF07", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_5E93FB5D46D5F3816EF3139E40D8945C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_5E93FB5D46D5F3816EF3139E40D8945C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_60888B8544A820F362E631A9AF977578, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_60888B8544A820F362E631A9AF977578", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6230548A46D1491DF0E00ABB440FA34C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6230548A46D1491DF0E00ABB440FA34C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6247C0E74C02CCE9EC5A54A3E7202D9C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6247C0E74C02CCE9EC5A54A3E7202D9C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_640444D24E61416C12B56B86CC01C35E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_640444D24E61416C12B56B86CC01C35E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_64CB609544C16CE3501687BB77A9BE98, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_64CB609544C16CE3501687BB77A9BE98", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6642709C4FD5F01FEA9E8A96F4793007, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6642709C4FD5F01FEA9E8A96F4793007", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6CA7D38F4303D890F3A3AC925FD5ABBC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6CA7D38F4303D890F3A3AC925FD5ABBC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6D781FB1424708C1AB16ABB7CBD9C348, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6D781FB1424708C1AB16ABB7CBD9C348", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6FE70A434238188038C445B6D185C627, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_6FE70A434238188038C445B6D185C627", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_708977874B518DB3F39014859828E057, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_708977874B518DB3F39014859828E057", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7522790A45332841BA00AAA45C1E8FAB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7522790A45332841BA00AAA45C1E8FAB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7790E8A24409E9CC75009F8F7E8B5697, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7790E8A24409E9CC75009F8F7E8B5697", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_77C38D4F4BD308DAC92A399C409F4D96, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_77C38D4F4BD308DAC92A399C409F4D96", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7A1296B04CE50DC91308B2928DAC0EDF, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7A1296B04CE50DC91308B2928DAC0EDF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7A6D93534FE386A649CC10825A627C5D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7A6D93534FE386A649CC10825A627C5D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7AADF142412B9FD7964B1184D104A0D4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7AADF142412B9FD7964B1184D104A0D4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7D77A4B846325085F3607CA970EC924B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7D77A4B846325085F3607CA970EC924B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7D7E531F48A2669DAAE0E49E5BB694AC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7D7E531F48A2669DAAE0E49E5BB694AC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7EE8B8144950F68555E6E4ACC15ADBF3, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_7EE8B8144950F68555E6E4ACC15ADBF3", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_83653F22419524CA24059193D286FB43, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_83653F22419524CA24059193D286FB43", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_83E752C34D427A48812481AD239D77BC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_83E752C34D427A48812481AD239D77BC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_84CA3A834264819779E0C78BEA493AB6, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_84CA3A834264819779E0C78BEA493AB6", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_87BA84EE43717808B40931B1DA209DB7, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_87BA84EE43717808B40931B1DA209DB7", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_8B03057F43F5713EB50B9DB5B7B44AF9, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_8B03057F43F5713EB50B9DB5B7B44AF9", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_8DAA63B042946112CFBF1F8E6EA9F202, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_8DAA63B042946112CFBF1F8E6EA9F202", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_8EA29E0E4D5079E11E7A8FB923D1A5C0, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_8EA29E0E4D5079E11E7A8FB923D1A5C0", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_92020DBA4380523CBCF8108F3141F111, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_92020DBA4380523CBCF8108F3141F111", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_9353711844443EA5FDD9E4B969EF2036, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_9353711844443EA5FDD9E4B969EF2036", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_943C2008456FD23FE51001B0A74C905F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_943C2008456FD23FE51001B0A74C905F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_94CD695D439728FB6273D99C7AEB5355, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_94CD695D439728FB6273D99C7AEB5355", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_959AF61A479D2351A7D35DBAB8567296, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_959AF61A479D2351A7D35DBAB8567296", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_96BF31BF4415417DE254B68EDFAD8DC6, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_96BF31BF4415417DE254B68EDFAD8DC6", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_97301F9D4A75DC4722F80BA7487750D1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_97301F9D4A75DC4722F80BA7487750D1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_982F88CF4F2825FBD7ED859E0C000675, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_982F88CF4F2825FBD7ED859E0C000675", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_983124B546FAFEC3FF099DBE50790F99, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_983124B546FAFEC3FF099DBE50790F99", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_9B64CA6F4CF4E54C110DFB9D068BDC72, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_9B64CA6F4CF4E54C110DFB9D068BDC72", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_9D19DE194F23ABCB682A3F82CC2812DD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_9D19DE194F23ABCB682A3F82CC2812DD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_9E32CCA24E643527E31CAB9879DED02D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_9E32CCA24E643527E31CAB9879DED02D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_A3869E044989C814AD250CAA4BF640C8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_A3869E044989C814AD250CAA4BF640C8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_A5D26D014355F732C9BB93B5B7F27862, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_A5D26D014355F732C9BB93B5B7F27862", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_A753EFC546E7D519C37C56BFB7F8A2BA, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_A753EFC546E7D519C37C56BFB7F8A2BA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_A8765AC54B09818AE89C1D822EB49E40, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_A8765AC54B09818AE89C1D822EB49E40", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_AC0E99734E803EB4D5DC1F9D34E907B2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_AC0E99734E803EB4D5DC1F9D34E907B2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_AECEA43A4AAAE88578F80B87AD73CAF9, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_AECEA43A4AAAE88578F80B87AD73CAF9", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B17A78E04546F18A77D233AF48F98188, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B17A78E04546F18A77D233AF48F98188", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B3F860BB4CC789A9266391951851467C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B3F860BB4CC789A9266391951851467C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B4C20B7F4DA65B36ACA19699AA4E4AB1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B4C20B7F4DA65B36ACA19699AA4E4AB1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B4D15C0046416DECF1CF8DB5F54258BE, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B4D15C0046416DECF1CF8DB5F54258BE", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B5F4121743AC3B6ADD2A6B996CE6B4E1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B5F4121743AC3B6ADD2A6B996CE6B4E1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B620DB3D40A6BFA767C4F9902A01EDB9, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B620DB3D40A6BFA767C4F9902A01EDB9", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B7D358F5470B74AE33387A851CE48895, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B7D358F5470B74AE33387A851CE48895", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B845E00F419F20B5E4CE5A9BA8B262C0, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B845E00F419F20B5E4CE5A9BA8B262C0", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B90666F641474A9A8D49DF8EF766CFA1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B90666F641474A9A8D49DF8EF766CFA1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B9456F7D400E66FA3AB9FB843F53F4C8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_B9456F7D400E66FA3AB9FB843F53F4C8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_BD12E5824D0ECC50A878B38F96E0AD07, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_BD12E5824D0ECC50A878B38F96E0AD07", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_BDD16B534AD4F26FA2D769B81A0F8673, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_BDD16B534AD4F26FA2D769B81A0F8673", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_BEDE2C64479928D538C08997AB11D3E1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_BEDE2C64479928D538C08997AB11D3E1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_BF9C3C8E4C68067F469DE087917B2326, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_BF9C3C8E4C68067F469DE087917B2326", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_C173F3A2430936644169E1A3DE06E8DA, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_C173F3A2430936644169E1A3DE06E8DA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_C9A1BFE14F92548C1CA5909DD08A850B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_C9A1BFE14F92548C1CA5909DD08A850B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_CB3A1C3646159F3CE759D8BCED5E279A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_CB3A1C3646159F3CE759D8BCED5E279A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_CD636ABF4C9B24DF5E47C4AB891171A1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_CD636ABF4C9B24DF5E47C4AB891171A1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_CD68C7DE43B0182BD6A8B28E4BD6C487, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_CD68C7DE43B0182BD6A8B28E4BD6C487", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_CFDD17964257132EC564EBA58B37F128, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_CFDD17964257132EC564EBA58B37F128", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D0F8C94C4FD027E4F4773AB022FC0BFA, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D0F8C94C4FD027E4F4773AB022FC0BFA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D4320AB3420FEE4FA3751FBF8053076C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D4320AB3420FEE4FA3751FBF8053076C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D500254F467B27FF847E969994A6AE53, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D500254F467B27FF847E969994A6AE53", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D5DE34CB4F0791501716D0B1945099EB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D5DE34CB4F0791501716D0B1945099EB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D658068D41D652AE106FF9BF1F794C1B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D658068D41D652AE106FF9BF1F794C1B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D6A7BC4E4A5BDF2F1D1BCD86AE19D9E1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D6A7BC4E4A5BDF2F1D1BCD86AE19D9E1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D821F93047D757966F2CD99EDB2619EC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D821F93047D757966F2CD99EDB2619EC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D89278634214CEE589F3548DACF9068D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D89278634214CEE589F3548DACF9068D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D98B11354CD5E851A4378EA7ADCEE67E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_D98B11354CD5E851A4378EA7ADCEE67E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_DA5196A743A91C3D1B85129E77E0CFCD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_DA5196A743A91C3D1B85129E77E0CFCD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_DDD337494202E9DABD1D01BC266A24A5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_DDD337494202E9DABD1D01BC266A24A5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_DE336ED746AC300EE53B6CA3B8348428, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_DE336ED746AC300EE53B6CA3B8348428", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E2A03E6243BD61BE452A2397CA535049, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E2A03E6243BD61BE452A2397CA535049", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E6014F3A4071E1E81E587C8FFDD72572, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E6014F3A4071E1E81E587C8FFDD72572", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E6CE5660401AD267C5EA009DB802040A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E6CE5660401AD267C5EA009DB802040A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E82C11E6492FC1D44FE5BE875E8A363A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E82C11E6492FC1D44FE5BE875E8A363A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E85DC3FB422C95738B9DCCB09B4F4320, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E85DC3FB422C95738B9DCCB09B4F4320", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E8CE9247414A28B9E3B8EE97B2F1B771, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_E8CE9247414A28B9E3B8EE97B2F1B771", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EA0FEC6A4E427450C3AE6F946DD4AE9D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EA0FEC6A4E427450C3AE6F946DD4AE9D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EAA83063481BC7787AC7A5AA12D961DD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EAA83063481BC7787AC7A5AA12D961DD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EDEFA41C4C797B0D91DEAA817DF889E2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EDEFA41C4C797B0D91DEAA817DF889E2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EE1B1D964DAD7228F4342E8916EB9433, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EE1B1D964DAD7228F4342E8916EB9433", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EF4BF69143085CCE0797048B2717A308, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_EF4BF69143085CCE0797048B2717A308", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F1835AA649DF13E08C0A65A78E4B07CC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F1835AA649DF13E08C0A65A78E4B07CC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F197B6604C6855734CD9F590C51C9650, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F197B6604C6855734CD9F590C51C9650", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F23BAC6F4DC55F2D7A2B0FA8BA82CE9B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F23BAC6F4DC55F2D7A2B0FA8BA82CE9B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F28BEB814146172D83147FA174ADC649, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F28BEB814146172D83147FA174ADC649", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F2ADAB2F4EB94BB93B13B68ED94F47A0, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F2ADAB2F4EB94BB93B13B68ED94F47A0", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F3A5423645FB564AE7CE0BA7BE5065F4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F3A5423645FB564AE7CE0BA7BE5065F4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F5F0A5E14184E07232E85DA844DBB157, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F5F0A5E14184E07232E85DA844DBB157", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F75639634B22A641D5FA6CB29441FB8F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F75639634B22A641D5FA6CB29441FB8F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F7DB8DBC4FB96FA9A9557B9980F390E7, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F7DB8DBC4FB96FA9A9557B9980F390E7", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F83BDCD543ACD9ECABCC51868DA17D3D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F83BDCD543ACD9ECABCC51868DA17D3D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F8E77F004FA36506A521C1BE9B9DBA9D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_F8E77F004FA36506A521C1BE9B9DBA9D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_FBD3B436421A510CC4F6018EBAA89A92, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_FBD3B436421A510CC4F6018EBAA89A92", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_FC2600BF4FED88EAA48CB2914B2678D6, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_FC2600BF4FED88EAA48CB2914B2678D6", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_FE80A05F49A351B73C1AFCAB649849B9, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_FE80A05F49A351B73C1AFCAB649849B9", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_FFFCB3CA412462EBB89990A2B172BA9B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_BlendSpacePlayer_FFFCB3CA412462EBB89990A2B172BA9B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_231FA567494D7E9B5F149ABB7155BC7A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_231FA567494D7E9B5F149ABB7155BC7A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_2C1C1D3F460A155A0151CEAB524700F8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_2C1C1D3F460A155A0151CEAB524700F8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_2CA9C032477E7035E93B1EAF4406A541, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_2CA9C032477E7035E93B1EAF4406A541", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_37ED9D5048A7F12FFB621A9A88BC84D8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_37ED9D5048A7F12FFB621A9A88BC84D8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_681E427643E36B78C84DE095AD28AC80, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_681E427643E36B78C84DE095AD28AC80", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_78CCBFD94CDBEAC880725B82A1FDF43A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_78CCBFD94CDBEAC880725B82A1FDF43A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_88B094EF43AB303BF032A9BA8BE95489, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_88B094EF43AB303BF032A9BA8BE95489", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_8CF345104BF9FB25BE7D7E97B0F32548, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_8CF345104BF9FB25BE7D7E97B0F32548", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_99EFE8A945D33D1908F87CA807CDDA7E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_99EFE8A945D33D1908F87CA807CDDA7E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_A4C135C84F98F89B44A3A5B1A08C72DE, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_A4C135C84F98F89B44A3A5B1A08C72DE", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_AD00B0994C49086B16EDC8AF0B95D81F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_AD00B0994C49086B16EDC8AF0B95D81F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_B412380C4770AD954211F29AE3FEEBEB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_B412380C4770AD954211F29AE3FEEBEB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_BEB718B147F9B832A67AAF9F6F77E1CA, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_BEB718B147F9B832A67AAF9F6F77E1CA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_C5A81058483CEC93D8D576BCAED80DF1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_C5A81058483CEC93D8D576BCAED80DF1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_C6C281C94BD57C87D295F4A527C3CD23, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_C6C281C94BD57C87D295F4A527C3CD23", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_C7CBBA3E4A1E227E60C8A79A5AF95701, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_C7CBBA3E4A1E227E60C8A79A5AF95701", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_CC70184B4F0816DDDE47C8B7FA46507B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_CC70184B4F0816DDDE47C8B7FA46507B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_D493490046FE6A573190FCA049B01EA2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_D493490046FE6A573190FCA049B01EA2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_DE0E9FB24B81E08BD186AC8428DF573D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_DE0E9FB24B81E08BD186AC8428DF573D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_E6DDB45A4ED1ECB5B781C5886B8F3B8C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_ModifyBone_E6DDB45A4ED1ECB5B781C5886B8F3B8C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_1F6245564CBFAC9D7A51888A13B19C11, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_1F6245564CBFAC9D7A51888A13B19C11", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_33CC977A41BF7D75C29FA0B02F624DF8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_33CC977A41BF7D75C29FA0B02F624DF8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_4D79EF3F43CBF8429510E6AE466D4D15, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_4D79EF3F43CBF8429510E6AE466D4D15", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_87FEF334484D88F071C6DDAEEC493A70, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_87FEF334484D88F071C6DDAEEC493A70", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_D06658CE4F7472A54985C0A41D62FFD0, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_D06658CE4F7472A54985C0A41D62FFD0", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_D0B841924FEA29DC3604E1A097AD78B3, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_D0B841924FEA29DC3604E1A097AD78B3", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_D48F41A243BBE19599311B9F55CD889D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_D48F41A243BBE19599311B9F55CD889D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_D8EC28B640BEF7A055B700AD18474FCF, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_RotationOffsetBlendSpace_D8EC28B640BEF7A055B700AD18474FCF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_SequenceEvaluator_000D97934C4E2EF88BF5ABA9CC80F625, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_SequenceEvaluator_000D97934C4E2EF88BF5ABA9CC80F625", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_SequenceEvaluator_615210D342000F3DBC03CDB8633CD362, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_SequenceEvaluator_615210D342000F3DBC03CDB8633CD362", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_06DDB89C460E3788AB4083BAD5082479, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_06DDB89C460E3788AB4083BAD5082479", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_08DE4C47429B477E85F31987BC4A1550, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_08DE4C47429B477E85F31987BC4A1550", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_0B304A02448CAF0F969E82BDD9B99678, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_0B304A02448CAF0F969E82BDD9B99678", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_0D54A1734912952F7BA5AEB41F15F02E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_0D54A1734912952F7BA5AEB41F15F02E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_0D8444E84FA00C1076E571BD661175D6, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_0D8444E84FA00C1076E571BD661175D6", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_0F89A5AA438C799B6D5837ACA562FC6C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_0F89A5AA438C799B6D5837ACA562FC6C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_1589521E43C8B19E9745D390BCBEC4FE, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_1589521E43C8B19E9745D390BCBEC4FE", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_174D2F214EA71798B9637D8E6802CD2B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_174D2F214EA71798B9637D8E6802CD2B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_17F06C2844A7A65930273890D459B3B1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_17F06C2844A7A65930273890D459B3B1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_18205F214BECDF173E6DB1BB5B91960C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_18205F214BECDF173E6DB1BB5B91960C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_1A42DA084EC2000AA81849AB3DDB2299, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_1A42DA084EC2000AA81849AB3DDB2299", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_1B8D479F4EE0C2F86018988755C29061, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_1B8D479F4EE0C2F86018988755C29061", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_1D0CD55347A13AFC086E7FBE5102426C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_1D0CD55347A13AFC086E7FBE5102426C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_203DFAFB45AE5EABCE4503939061441B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_203DFAFB45AE5EABCE4503939061441B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_21F59DA54B245DA8A64BBC973F95AC00, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_21F59DA54B245DA8A64BBC973F95AC00", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_2236448B4CF86CA5FB234A91DD082AF1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_2236448B4CF86CA5FB234A91DD082AF1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_261F6FE24B9A20840B0378BD18239A2E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_261F6FE24B9A20840B0378BD18239A2E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_26CF77D54B21D01B17FA2B943EDB10FE, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_26CF77D54B21D01B17FA2B943EDB10FE", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_2D31DFF341E03E707A933E9E6E081E9A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_2D31DFF341E03E707A933E9E6E081E9A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_2E8672EC454DEF79474C4F8689A33BFD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_2E8672EC454DEF79474C4F8689A33BFD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_300DF7DC421D5033BC624CA7067CA27F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_300DF7DC421D5033BC624CA7067CA27F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_30D5C52943476CDCD12038842BE8B9C7, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_30D5C52943476CDCD12038842BE8B9C7", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_31EF3C834A7B844F1B3483A44D4E4CD7, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_31EF3C834A7B844F1B3483A44D4E4CD7", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3449077C4EE155D4970D558654771B33, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3449077C4EE155D4970D558654771B33", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_348D7E0640CF6B3A70569CB56992872E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_348D7E0640CF6B3A70569CB56992872E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3822401241846CC8A0B350BF925B92EF, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3822401241846CC8A0B350BF925B92EF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_388EE4074BCCBEF4D017DA83A560D52A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_388EE4074BCCBEF4D017DA83A560D52A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3944D10248D6D77AFF5F0C8CBEC73B74, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3944D10248D6D77AFF5F0C8CBEC73B74", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3B85590B46B631AC8ACD0BB157043C16, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3B85590B46B631AC8ACD0BB157043C16", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3C96939A45D7B605AD84EA8BEB4F6A21, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3C96939A45D7B605AD84EA8BEB4F6A21", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3E9381434E1977419FC919A21475FF08, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3E9381434E1977419FC919A21475FF08", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3EA233C34F7EE4AB1FE94E95F878BFDB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_3EA233C34F7EE4AB1FE94E95F878BFDB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_402D70F14F50B273482ACA950460F8C4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_402D70F14F50B273482ACA950460F8C4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_41BB986B439287FF86093CB5DC14A32F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_41BB986B439287FF86093CB5DC14A32F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_46F36914453FE6461C5EB0BBCEE50D56, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_46F36914453FE6461C5EB0BBCEE50D56", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4A0C81F84808D11E8F7CF5957ED357A5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4A0C81F84808D11E8F7CF5957ED357A5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4B4892054F77CB982C47EDB684AC2265, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4B4892054F77CB982C47EDB684AC2265", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4F6D2C3C4A3A95BED2A92093453A15CF, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4F6D2C3C4A3A95BED2A92093453A15CF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4F8309C94883D6BF5C22DDA800AE03FE, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4F8309C94883D6BF5C22DDA800AE03FE", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4FE5C8654959357CC49786AC02576F04, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_4FE5C8654959357CC49786AC02576F04", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_551BE46E45CC0BF9E8EA33B421CCE2E4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_551BE46E45CC0BF9E8EA33B421CCE2E4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_5702B9694A74AC86058CA3975C47CEC5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_5702B9694A74AC86058CA3975C47CEC5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_5761A16F49714D9583DAEFB3BB2F7AFC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_5761A16F49714D9583DAEFB3BB2F7AFC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_57CE9B324631DAD40DA5FEACF21A8C1D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_57CE9B324631DAD40DA5FEACF21A8C1D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_596FD9F64661F2804EB180A842BFA644, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_596FD9F64661F2804EB180A842BFA644", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_5D9F98E34CF0ECD0A4CA64BA05291277, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_5D9F98E34CF0ECD0A4CA64BA05291277", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_5F90F8F547EB7B1568620992E192A304, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_5F90F8F547EB7B1568620992E192A304", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_641019BA4A49DFAE4AB2BD901E0A0CD4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_641019BA4A49DFAE4AB2BD901E0A0CD4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_6757DB1640F6186591EF058AB9B12FAF, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_6757DB1640F6186591EF058AB9B12FAF", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_69CE931F4B51D9FDA643DCB2BF4D7B52, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_69CE931F4B51D9FDA643DCB2BF4D7B52", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_69D6F27448C55683A770BDA4BF0D4627, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_69D6F27448C55683A770BDA4BF0D4627", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_6A5EB9FD4A57870B1DD6059605E9A7E2, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_6A5EB9FD4A57870B1DD6059605E9A7E2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_6FEB36CB486754541DBB65819BAB0A3F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_6FEB36CB486754541DBB65819BAB0A3F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7430575341F8716009BB8B8A144C7C8C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7430575341F8716009BB8B8A144C7C8C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7571302F47C48EB6DA9601AAA4DF27AE, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7571302F47C48EB6DA9601AAA4DF27AE", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7678D3BC4C16B24EB9F206B74767ADCC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7678D3BC4C16B24EB9F206B74767ADCC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_78FF841C4B580594EF34C9BF0C73F89A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_78FF841C4B580594EF34C9BF0C73F89A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_79F463DF46663C8DFC7FCDA70AC9CC1E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_79F463DF46663C8DFC7FCDA70AC9CC1E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7D8ABC184293B46C1ED621968F6D5E23, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7D8ABC184293B46C1ED621968F6D5E23", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7F79B145452DA66ADDBA0CAAB0430A53, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_7F79B145452DA66ADDBA0CAAB0430A53", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8035F63341DE469647236EBD1B23E0EB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8035F63341DE469647236EBD1B23E0EB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_809B311A4612E51E8F845696814543A5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_809B311A4612E51E8F845696814543A5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_82FAF7A64E11103A99B5349FD7176C5B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_82FAF7A64E11103A99B5349FD7176C5B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_83F2A74140F248AE90E244B551653623, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_83F2A74140F248AE90E244B551653623", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8506301A4CCA333CF0977C86D5200BDC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8506301A4CCA333CF0977C86D5200BDC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8539D7184FC4AF8CA71C1E98B81D9C0A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8539D7184FC4AF8CA71C1E98B81D9C0A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_865628A04EF960C8D631409B65AB9A3C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_865628A04EF960C8D631409B65AB9A3C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_865B0D644B2312BEEA0E8A8FD5886580, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_865B0D644B2312BEEA0E8A8FD5886580", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_88C8B033469E6086E9209B8DC557FDB1, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_88C8B033469E6086E9209B8DC557FDB1", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8B3E7F81445149B0FDBA9EB0AF289366, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8B3E7F81445149B0FDBA9EB0AF289366", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8D1AF90B47D6556A45BC39A157EDB6D8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8D1AF90B47D6556A45BC39A157EDB6D8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8E95AA754B5CB8BC4CC4C0B9D8D26718, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_8E95AA754B5CB8BC4CC4C0B9D8D26718", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_90B634824D3FDE01A456A9B1391995B9, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_90B634824D3FDE01A456A9B1391995B9", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_9169E5164408ED129BCAD3B58E65D81C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_9169E5164408ED129BCAD3B58E65D81C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_926C1B39440D131FF25E30BE8DA81031, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_926C1B39440D131FF25E30BE8DA81031", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_930277A54A712DE640CC72BFCAA158B5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_930277A54A712DE640CC72BFCAA158B5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_95CB2B9C4B89CE89C9D08680B02E1F63, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_95CB2B9C4B89CE89C9D08680B02E1F63", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_9D31D7544C1923831FA6B394518B81A0, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_9D31D7544C1923831FA6B394518B81A0", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_9EEE834F4837F7E704489AAE6BF0299C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_9EEE834F4837F7E704489AAE6BF0299C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A19F7F9B4485755C204500B73BD75637, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A19F7F9B4485755C204500B73BD75637", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A3081FDF426604E61D987481EF69CF4B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A3081FDF426604E61D987481EF69CF4B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A66AAE834039EC66AC370191699B070D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A66AAE834039EC66AC370191699B070D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A740A3CA4C66913213080C9E0A1DA58F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A740A3CA4C66913213080C9E0A1DA58F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A80F497F444B3BCF8CE041A5A75DD7DD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A80F497F444B3BCF8CE041A5A75DD7DD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A94154EC42D170615413579B6F36FEB8, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_A94154EC42D170615413579B6F36FEB8", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_AB388DEE4FDFE01A302D9AB2FE5E1AD3, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_AB388DEE4FDFE01A302D9AB2FE5E1AD3", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_ABC227D54A5D7DE66828DA8895AAAFA7, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_ABC227D54A5D7DE66828DA8895AAAFA7", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_AC0640E94EB4E0A2FF9F5A8CF0A21312, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_AC0640E94EB4E0A2FF9F5A8CF0A21312", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_AC7CC605497D7F7A884081B1CA0006AD, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_AC7CC605497D7F7A884081B1CA0006AD", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_AEBB669244CE38F26D00EBBD275668C4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_AEBB669244CE38F26D00EBBD275668C4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B163ABCD4694D6103BC4C0AC15984480, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B163ABCD4694D6103BC4C0AC15984480", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B17D41A948EF784403533F8BAAEC4246, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B17D41A948EF784403533F8BAAEC4246", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B286B920488DC96214BCB198CA2CBD4C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B286B920488DC96214BCB198CA2CBD4C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B2B0F06E4D254AEB59ACF6A862340252, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B2B0F06E4D254AEB59ACF6A862340252", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B5663B454719B42F10815B9B15A6D4F0, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B5663B454719B42F10815B9B15A6D4F0", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B7A701D947AC3452A4F0E19EB10E667F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_B7A701D947AC3452A4F0E19EB10E667F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_BFE4072D46B77972CE950F99F7476477, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_BFE4072D46B77972CE950F99F7476477", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C0822BFD45280A1CFA5760B1F71435C6, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C0822BFD45280A1CFA5760B1F71435C6", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C17EC81748FD2E7F9CC712A2E3F56F8F, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C17EC81748FD2E7F9CC712A2E3F56F8F", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C1A70A354FEC31F82AF4B8A19629E348, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C1A70A354FEC31F82AF4B8A19629E348", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C33DD4294082A1353F0E52B487622E67, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C33DD4294082A1353F0E52B487622E67", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C4F4197F45CE8D1E0EF6EDBCAD52B5A5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C4F4197F45CE8D1E0EF6EDBCAD52B5A5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C51EC49C447DE00655A8C7B4A1E65F42, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C51EC49C447DE00655A8C7B4A1E65F42", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C677A4FC4C378D03A310CDAC2AED76E4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C677A4FC4C378D03A310CDAC2AED76E4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C6E8B8EB43F3DFDEA4CC9EAED3BBCA63, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C6E8B8EB43F3DFDEA4CC9EAED3BBCA63", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C83AA51B457B9EE789CDB198CDDA68BB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_C83AA51B457B9EE789CDB198CDDA68BB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_CBF25AC14B73DC240CC651A6D973AD00, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_CBF25AC14B73DC240CC651A6D973AD00", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_CDE075004858904C2B5AC09742CEA9EC, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_CDE075004858904C2B5AC09742CEA9EC", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D1A629C14278E7FB79B202BFF78B67F9, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D1A629C14278E7FB79B202BFF78B67F9", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D21FBB40489621EA0F6790919E8B7138, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D21FBB40489621EA0F6790919E8B7138", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D2742C654F3D1662E73ADFA9CA2529E5, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D2742C654F3D1662E73ADFA9CA2529E5", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D2E7CD044F10D4A2055A849A791EF39E, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D2E7CD044F10D4A2055A849A791EF39E", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D56E99494AFAA230EDF810AE624F3731, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D56E99494AFAA230EDF810AE624F3731", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D5E021694C489AA7B19326BD06C287B9, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D5E021694C489AA7B19326BD06C287B9", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D80976B4419AEBED97F26C8429F4C73C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_D80976B4419AEBED97F26C8429F4C73C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DC8F143647B9FC32EAB0C1A0514B07CB, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DC8F143647B9FC32EAB0C1A0514B07CB", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DDA656124A193F547F7C26B8BA3D089D, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DDA656124A193F547F7C26B8BA3D089D", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DDC5BF3C4650981DCB622E8547DFBD61, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DDC5BF3C4650981DCB622E8547DFBD61", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DEA31E1E47E4AD4BD38920B410323FED, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DEA31E1E47E4AD4BD38920B410323FED", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DF5190A1445EA572CFEF88901683A624, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_DF5190A1445EA572CFEF88901683A624", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_E0F970674E91D788BC01A69C9CABABB3, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_E0F970674E91D788BC01A69C9CABABB3", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_E4EA35D84DBB909300DD7F9E9FB5CE51, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_E4EA35D84DBB909300DD7F9E9FB5CE51", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F27D530E44D2B5C46C8350ACBAA2D343, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F27D530E44D2B5C46C8350ACBAA2D343", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F3AEA104458D31F7E091B892BF5EDDA7, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F3AEA104458D31F7E091B892BF5EDDA7", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F52C2984471322A36DE26FA1FC64D7C4, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F52C2984471322A36DE26FA1FC64D7C4", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F76D583E40B23B4C8748479CC007A45B, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F76D583E40B23B4C8748479CC007A45B", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F8FAD59B435B95AC53B9D69B234A2AE7, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F8FAD59B435B95AC53B9D69B234A2AE7", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F92EDBF84C2E51FEA195F8886A702D7A, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F92EDBF84C2E51FEA195F8886A702D7A", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F95517C2433788AE8C5CA1855B98DC96, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_F95517C2433788AE8C5CA1855B98DC96", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_FAFF30944A7F5E89ECE38A956AA2D658, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_FAFF30944A7F5E89ECE38A956AA2D658", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_FE8D53CC4C0B433BDF21C68815AF959C, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_FE8D53CC4C0B433BDF21C68815AF959C", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_FF16A82B4DD02D31D553788FEABA4925, "ABP_Willie_C", "EvaluateGraphExposedInputs_ExecuteUbergraph_ABP_Willie_AnimGraphNode_TwoWayBlend_FF16A82B4DD02D31D553788FEABA4925", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UABP_Willie_C, ExecuteUbergraph_ABP_Willie, "ABP_Willie_C", "ExecuteUbergraph_ABP_Willie", SDK::Params::ABP_Willie_C_ExecuteUbergraph_ABP_Willie)
+// clang-format on
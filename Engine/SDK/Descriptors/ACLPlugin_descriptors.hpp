@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ACLPlugin_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ACLPlugin_classes.hpp"
+#include "../SDK/ACLPlugin_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationCompressionLibraryDatabase, GetVisualFidelity, "AnimationCompressionLibraryDatabase", "GetVisualFidelity", SDK::Params::AnimationCompressionLibraryDatabase_GetVisualFidelity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationCompressionLibraryDatabase, SetVisualFidelity, "AnimationCompressionLibraryDatabase", "SetVisualFidelity", SDK::Params::AnimationCompressionLibraryDatabase_SetVisualFidelity)
+// clang-format on
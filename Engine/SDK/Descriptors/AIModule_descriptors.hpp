@@ -0,0 +1,231 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AIModule_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AIModule_classes.hpp"
+#include "../SDK/AIModule_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryContext_BlueprintBase, ProvideActorsSet, "EnvQueryContext_BlueprintBase", "ProvideActorsSet", SDK::Params::EnvQueryContext_BlueprintBase_ProvideActorsSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryContext_BlueprintBase, ProvideLocationsSet, "EnvQueryContext_BlueprintBase", "ProvideLocationsSet", SDK::Params::EnvQueryContext_BlueprintBase_ProvideLocationsSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryContext_BlueprintBase, ProvideSingleActor, "EnvQueryContext_BlueprintBase", "ProvideSingleActor", SDK::Params::EnvQueryContext_BlueprintBase_ProvideSingleActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryContext_BlueprintBase, ProvideSingleLocation, "EnvQueryContext_BlueprintBase", "ProvideSingleLocation", SDK::Params::EnvQueryContext_BlueprintBase_ProvideSingleLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIAsyncTaskBlueprintProxy, OnMoveCompleted, "AIAsyncTaskBlueprintProxy", "OnMoveCompleted", SDK::Params::AIAsyncTaskBlueprintProxy_OnMoveCompleted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryGenerator_BlueprintBase, AddGeneratedActor, "EnvQueryGenerator_BlueprintBase", "AddGeneratedActor", SDK::Params::EnvQueryGenerator_BlueprintBase_AddGeneratedActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryGenerator_BlueprintBase, AddGeneratedVector, "EnvQueryGenerator_BlueprintBase", "AddGeneratedVector", SDK::Params::EnvQueryGenerator_BlueprintBase_AddGeneratedVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryGenerator_BlueprintBase, DoItemGeneration, "EnvQueryGenerator_BlueprintBase", "DoItemGeneration", SDK::Params::EnvQueryGenerator_BlueprintBase_DoItemGeneration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryGenerator_BlueprintBase, DoItemGenerationFromActors, "EnvQueryGenerator_BlueprintBase", "DoItemGenerationFromActors", SDK::Params::EnvQueryGenerator_BlueprintBase_DoItemGenerationFromActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryGenerator_BlueprintBase, GetQuerier, "EnvQueryGenerator_BlueprintBase", "GetQuerier", SDK::Params::EnvQueryGenerator_BlueprintBase_GetQuerier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionStimuliSourceComponent, RegisterForSense, "AIPerceptionStimuliSourceComponent", "RegisterForSense", SDK::Params::AIPerceptionStimuliSourceComponent_RegisterForSense)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionStimuliSourceComponent, RegisterWithPerceptionSystem, "AIPerceptionStimuliSourceComponent", "RegisterWithPerceptionSystem", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionStimuliSourceComponent, UnregisterFromPerceptionSystem, "AIPerceptionStimuliSourceComponent", "UnregisterFromPerceptionSystem", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionStimuliSourceComponent, UnregisterFromSense, "AIPerceptionStimuliSourceComponent", "UnregisterFromSense", SDK::Params::AIPerceptionStimuliSourceComponent_UnregisterFromSense)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnAction, CreateActionInstance, "PawnAction", "CreateActionInstance", SDK::Params::PawnAction_CreateActionInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnAction, Finish, "PawnAction", "Finish", SDK::Params::PawnAction_Finish)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnAction, GetActionPriority, "PawnAction", "GetActionPriority", SDK::Params::PawnAction_GetActionPriority)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnActionsComponent, K2_PerformAction, "PawnActionsComponent", "K2_PerformAction", SDK::Params::PawnActionsComponent_K2_PerformAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnActionsComponent, K2_AbortAction, "PawnActionsComponent", "K2_AbortAction", SDK::Params::PawnActionsComponent_K2_AbortAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnActionsComponent, K2_ForceAbortAction, "PawnActionsComponent", "K2_ForceAbortAction", SDK::Params::PawnActionsComponent_K2_ForceAbortAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnActionsComponent, K2_PushAction, "PawnActionsComponent", "K2_PushAction", SDK::Params::PawnActionsComponent_K2_PushAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnAction_BlueprintBase, ActionFinished, "PawnAction_BlueprintBase", "ActionFinished", SDK::Params::PawnAction_BlueprintBase_ActionFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnAction_BlueprintBase, ActionPause, "PawnAction_BlueprintBase", "ActionPause", SDK::Params::PawnAction_BlueprintBase_ActionPause)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnAction_BlueprintBase, ActionResume, "PawnAction_BlueprintBase", "ActionResume", SDK::Params::PawnAction_BlueprintBase_ActionResume)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnAction_BlueprintBase, ActionStart, "PawnAction_BlueprintBase", "ActionStart", SDK::Params::PawnAction_BlueprintBase_ActionStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnAction_BlueprintBase, ActionTick, "PawnAction_BlueprintBase", "ActionTick", SDK::Params::PawnAction_BlueprintBase_ActionTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, ClaimTaskResource, "AIController", "ClaimTaskResource", SDK::Params::AIController_ClaimTaskResource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, GetAIPerceptionComponent, "AIController", "GetAIPerceptionComponent", SDK::Params::AIController_GetAIPerceptionComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, K2_ClearFocus, "AIController", "K2_ClearFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, K2_SetFocalPoint, "AIController", "K2_SetFocalPoint", SDK::Params::AIController_K2_SetFocalPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, K2_SetFocus, "AIController", "K2_SetFocus", SDK::Params::AIController_K2_SetFocus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, MoveToActor, "AIController", "MoveToActor", SDK::Params::AIController_MoveToActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, MoveToLocation, "AIController", "MoveToLocation", SDK::Params::AIController_MoveToLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, OnGameplayTaskResourcesClaimed, "AIController", "OnGameplayTaskResourcesClaimed", SDK::Params::AIController_OnGameplayTaskResourcesClaimed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, OnUsingBlackBoard, "AIController", "OnUsingBlackBoard", SDK::Params::AIController_OnUsingBlackBoard)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, RunBehaviorTree, "AIController", "RunBehaviorTree", SDK::Params::AIController_RunBehaviorTree)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, SetMoveBlockDetection, "AIController", "SetMoveBlockDetection", SDK::Params::AIController_SetMoveBlockDetection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, SetPathFollowingComponent, "AIController", "SetPathFollowingComponent", SDK::Params::AIController_SetPathFollowingComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, UnclaimTaskResource, "AIController", "UnclaimTaskResource", SDK::Params::AIController_UnclaimTaskResource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, UseBlackboard, "AIController", "UseBlackboard", SDK::Params::AIController_UseBlackboard)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, GetDeprecatedActionsComponent, "AIController", "GetDeprecatedActionsComponent", SDK::Params::AIController_GetDeprecatedActionsComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, GetFocalPoint, "AIController", "GetFocalPoint", SDK::Params::AIController_GetFocalPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, GetFocalPointOnActor, "AIController", "GetFocalPointOnActor", SDK::Params::AIController_GetFocalPointOnActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, GetFocusActor, "AIController", "GetFocusActor", SDK::Params::AIController_GetFocusActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, GetImmediateMoveDestination, "AIController", "GetImmediateMoveDestination", SDK::Params::AIController_GetImmediateMoveDestination)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, GetMoveStatus, "AIController", "GetMoveStatus", SDK::Params::AIController_GetMoveStatus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, GetPathFollowingComponent, "AIController", "GetPathFollowingComponent", SDK::Params::AIController_GetPathFollowingComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAIController, HasPartialPath, "AIController", "HasPartialPath", SDK::Params::AIController_HasPartialPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISystem, AIIgnorePlayers, "AISystem", "AIIgnorePlayers", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISystem, AILoggingVerbose, "AISystem", "AILoggingVerbose", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPathFollowingComponent, OnActorBump, "PathFollowingComponent", "OnActorBump", SDK::Params::PathFollowingComponent_OnActorBump)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPathFollowingComponent, OnNavDataRegistered, "PathFollowingComponent", "OnNavDataRegistered", SDK::Params::PathFollowingComponent_OnNavDataRegistered)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPathFollowingComponent, GetPathActionType, "PathFollowingComponent", "GetPathActionType", SDK::Params::PathFollowingComponent_GetPathActionType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPathFollowingComponent, GetPathDestination, "PathFollowingComponent", "GetPathDestination", SDK::Params::PathFollowingComponent_GetPathDestination)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBrainComponent, RestartLogic, "BrainComponent", "RestartLogic", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBrainComponent, StartLogic, "BrainComponent", "StartLogic", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBrainComponent, StopLogic, "BrainComponent", "StopLogic", SDK::Params::BrainComponent_StopLogic)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBrainComponent, IsPaused, "BrainComponent", "IsPaused", SDK::Params::BrainComponent_IsPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBrainComponent, IsRunning, "BrainComponent", "IsRunning", SDK::Params::BrainComponent_IsRunning)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBehaviorTreeComponent, AddCooldownTagDuration, "BehaviorTreeComponent", "AddCooldownTagDuration", SDK::Params::BehaviorTreeComponent_AddCooldownTagDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBehaviorTreeComponent, SetDynamicSubtree, "BehaviorTreeComponent", "SetDynamicSubtree", SDK::Params::BehaviorTreeComponent_SetDynamicSubtree)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBehaviorTreeComponent, GetTagCooldownEndTime, "BehaviorTreeComponent", "GetTagCooldownEndTime", SDK::Params::BehaviorTreeComponent_GetTagCooldownEndTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBlackboardAssetProvider, GetBlackboardAsset, "BlackboardAssetProvider", "GetBlackboardAsset", SDK::Params::BlackboardAssetProvider_GetBlackboardAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, ClearValue, "BlackboardComponent", "ClearValue", SDK::Params::BlackboardComponent_ClearValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsBool, "BlackboardComponent", "SetValueAsBool", SDK::Params::BlackboardComponent_SetValueAsBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsClass, "BlackboardComponent", "SetValueAsClass", SDK::Params::BlackboardComponent_SetValueAsClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsEnum, "BlackboardComponent", "SetValueAsEnum", SDK::Params::BlackboardComponent_SetValueAsEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsFloat, "BlackboardComponent", "SetValueAsFloat", SDK::Params::BlackboardComponent_SetValueAsFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsInt, "BlackboardComponent", "SetValueAsInt", SDK::Params::BlackboardComponent_SetValueAsInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsName, "BlackboardComponent", "SetValueAsName", SDK::Params::BlackboardComponent_SetValueAsName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsObject, "BlackboardComponent", "SetValueAsObject", SDK::Params::BlackboardComponent_SetValueAsObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsRotator, "BlackboardComponent", "SetValueAsRotator", SDK::Params::BlackboardComponent_SetValueAsRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsString, "BlackboardComponent", "SetValueAsString", SDK::Params::BlackboardComponent_SetValueAsString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, SetValueAsVector, "BlackboardComponent", "SetValueAsVector", SDK::Params::BlackboardComponent_SetValueAsVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetLocationFromEntry, "BlackboardComponent", "GetLocationFromEntry", SDK::Params::BlackboardComponent_GetLocationFromEntry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetRotationFromEntry, "BlackboardComponent", "GetRotationFromEntry", SDK::Params::BlackboardComponent_GetRotationFromEntry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsBool, "BlackboardComponent", "GetValueAsBool", SDK::Params::BlackboardComponent_GetValueAsBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsClass, "BlackboardComponent", "GetValueAsClass", SDK::Params::BlackboardComponent_GetValueAsClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsEnum, "BlackboardComponent", "GetValueAsEnum", SDK::Params::BlackboardComponent_GetValueAsEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsFloat, "BlackboardComponent", "GetValueAsFloat", SDK::Params::BlackboardComponent_GetValueAsFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsInt, "BlackboardComponent", "GetValueAsInt", SDK::Params::BlackboardComponent_GetValueAsInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsName, "BlackboardComponent", "GetValueAsName", SDK::Params::BlackboardComponent_GetValueAsName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsObject, "BlackboardComponent", "GetValueAsObject", SDK::Params::BlackboardComponent_GetValueAsObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsRotator, "BlackboardComponent", "GetValueAsRotator", SDK::Params::BlackboardComponent_GetValueAsRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsString, "BlackboardComponent", "GetValueAsString", SDK::Params::BlackboardComponent_GetValueAsString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, GetValueAsVector, "BlackboardComponent", "GetValueAsVector", SDK::Params::BlackboardComponent_GetValueAsVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlackboardComponent, IsVectorValueSet, "BlackboardComponent", "IsVectorValueSet", SDK::Params::BlackboardComponent_IsVectorValueSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Hearing, ReportNoiseEvent, "AISense_Hearing", "ReportNoiseEvent", SDK::Params::AISense_Hearing_ReportNoiseEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, ClearBlackboardValue, "BTFunctionLibrary", "ClearBlackboardValue", SDK::Params::BTFunctionLibrary_ClearBlackboardValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, ClearBlackboardValueAsVector, "BTFunctionLibrary", "ClearBlackboardValueAsVector", SDK::Params::BTFunctionLibrary_ClearBlackboardValueAsVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsActor, "BTFunctionLibrary", "GetBlackboardValueAsActor", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsBool, "BTFunctionLibrary", "GetBlackboardValueAsBool", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsClass, "BTFunctionLibrary", "GetBlackboardValueAsClass", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsEnum, "BTFunctionLibrary", "GetBlackboardValueAsEnum", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsFloat, "BTFunctionLibrary", "GetBlackboardValueAsFloat", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsInt, "BTFunctionLibrary", "GetBlackboardValueAsInt", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsName, "BTFunctionLibrary", "GetBlackboardValueAsName", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsObject, "BTFunctionLibrary", "GetBlackboardValueAsObject", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsRotator, "BTFunctionLibrary", "GetBlackboardValueAsRotator", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsString, "BTFunctionLibrary", "GetBlackboardValueAsString", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetBlackboardValueAsVector, "BTFunctionLibrary", "GetBlackboardValueAsVector", SDK::Params::BTFunctionLibrary_GetBlackboardValueAsVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetOwnerComponent, "BTFunctionLibrary", "GetOwnerComponent", SDK::Params::BTFunctionLibrary_GetOwnerComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, GetOwnersBlackboard, "BTFunctionLibrary", "GetOwnersBlackboard", SDK::Params::BTFunctionLibrary_GetOwnersBlackboard)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsBool, "BTFunctionLibrary", "SetBlackboardValueAsBool", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsClass, "BTFunctionLibrary", "SetBlackboardValueAsClass", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsEnum, "BTFunctionLibrary", "SetBlackboardValueAsEnum", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsFloat, "BTFunctionLibrary", "SetBlackboardValueAsFloat", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsInt, "BTFunctionLibrary", "SetBlackboardValueAsInt", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsName, "BTFunctionLibrary", "SetBlackboardValueAsName", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsObject, "BTFunctionLibrary", "SetBlackboardValueAsObject", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsRotator, "BTFunctionLibrary", "SetBlackboardValueAsRotator", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsString, "BTFunctionLibrary", "SetBlackboardValueAsString", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, SetBlackboardValueAsVector, "BTFunctionLibrary", "SetBlackboardValueAsVector", SDK::Params::BTFunctionLibrary_SetBlackboardValueAsVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, StartUsingExternalEvent, "BTFunctionLibrary", "StartUsingExternalEvent", SDK::Params::BTFunctionLibrary_StartUsingExternalEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTFunctionLibrary, StopUsingExternalEvent, "BTFunctionLibrary", "StopUsingExternalEvent", SDK::Params::BTFunctionLibrary_StopUsingExternalEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, PerformConditionCheck, "BTDecorator_BlueprintBase", "PerformConditionCheck", SDK::Params::BTDecorator_BlueprintBase_PerformConditionCheck)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, PerformConditionCheckAI, "BTDecorator_BlueprintBase", "PerformConditionCheckAI", SDK::Params::BTDecorator_BlueprintBase_PerformConditionCheckAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveExecutionFinish, "BTDecorator_BlueprintBase", "ReceiveExecutionFinish", SDK::Params::BTDecorator_BlueprintBase_ReceiveExecutionFinish)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveExecutionFinishAI, "BTDecorator_BlueprintBase", "ReceiveExecutionFinishAI", SDK::Params::BTDecorator_BlueprintBase_ReceiveExecutionFinishAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveExecutionStart, "BTDecorator_BlueprintBase", "ReceiveExecutionStart", SDK::Params::BTDecorator_BlueprintBase_ReceiveExecutionStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveExecutionStartAI, "BTDecorator_BlueprintBase", "ReceiveExecutionStartAI", SDK::Params::BTDecorator_BlueprintBase_ReceiveExecutionStartAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveObserverActivated, "BTDecorator_BlueprintBase", "ReceiveObserverActivated", SDK::Params::BTDecorator_BlueprintBase_ReceiveObserverActivated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveObserverActivatedAI, "BTDecorator_BlueprintBase", "ReceiveObserverActivatedAI", SDK::Params::BTDecorator_BlueprintBase_ReceiveObserverActivatedAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveObserverDeactivated, "BTDecorator_BlueprintBase", "ReceiveObserverDeactivated", SDK::Params::BTDecorator_BlueprintBase_ReceiveObserverDeactivated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveObserverDeactivatedAI, "BTDecorator_BlueprintBase", "ReceiveObserverDeactivatedAI", SDK::Params::BTDecorator_BlueprintBase_ReceiveObserverDeactivatedAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveTick, "BTDecorator_BlueprintBase", "ReceiveTick", SDK::Params::BTDecorator_BlueprintBase_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, ReceiveTickAI, "BTDecorator_BlueprintBase", "ReceiveTickAI", SDK::Params::BTDecorator_BlueprintBase_ReceiveTickAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, IsDecoratorExecutionActive, "BTDecorator_BlueprintBase", "IsDecoratorExecutionActive", SDK::Params::BTDecorator_BlueprintBase_IsDecoratorExecutionActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTDecorator_BlueprintBase, IsDecoratorObserverActive, "BTDecorator_BlueprintBase", "IsDecoratorObserverActive", SDK::Params::BTDecorator_BlueprintBase_IsDecoratorObserverActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnSensingComponent, SetPeripheralVisionAngle, "PawnSensingComponent", "SetPeripheralVisionAngle", SDK::Params::PawnSensingComponent_SetPeripheralVisionAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnSensingComponent, SetSensingInterval, "PawnSensingComponent", "SetSensingInterval", SDK::Params::PawnSensingComponent_SetSensingInterval)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnSensingComponent, SetSensingUpdatesEnabled, "PawnSensingComponent", "SetSensingUpdatesEnabled", SDK::Params::PawnSensingComponent_SetSensingUpdatesEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnSensingComponent, GetPeripheralVisionAngle, "PawnSensingComponent", "GetPeripheralVisionAngle", SDK::Params::PawnSensingComponent_GetPeripheralVisionAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPawnSensingComponent, GetPeripheralVisionCosine, "PawnSensingComponent", "GetPeripheralVisionCosine", SDK::Params::PawnSensingComponent_GetPeripheralVisionCosine)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryManager, RunEQSQuery, "EnvQueryManager", "RunEQSQuery", SDK::Params::EnvQueryManager_RunEQSQuery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, ReceiveActivation, "BTService_BlueprintBase", "ReceiveActivation", SDK::Params::BTService_BlueprintBase_ReceiveActivation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, ReceiveActivationAI, "BTService_BlueprintBase", "ReceiveActivationAI", SDK::Params::BTService_BlueprintBase_ReceiveActivationAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, ReceiveDeactivation, "BTService_BlueprintBase", "ReceiveDeactivation", SDK::Params::BTService_BlueprintBase_ReceiveDeactivation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, ReceiveDeactivationAI, "BTService_BlueprintBase", "ReceiveDeactivationAI", SDK::Params::BTService_BlueprintBase_ReceiveDeactivationAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, ReceiveSearchStart, "BTService_BlueprintBase", "ReceiveSearchStart", SDK::Params::BTService_BlueprintBase_ReceiveSearchStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, ReceiveSearchStartAI, "BTService_BlueprintBase", "ReceiveSearchStartAI", SDK::Params::BTService_BlueprintBase_ReceiveSearchStartAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, ReceiveTick, "BTService_BlueprintBase", "ReceiveTick", SDK::Params::BTService_BlueprintBase_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, ReceiveTickAI, "BTService_BlueprintBase", "ReceiveTickAI", SDK::Params::BTService_BlueprintBase_ReceiveTickAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTService_BlueprintBase, IsServiceActive, "BTService_BlueprintBase", "IsServiceActive", SDK::Params::BTService_BlueprintBase_IsServiceActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, FinishAbort, "BTTask_BlueprintBase", "FinishAbort", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, FinishExecute, "BTTask_BlueprintBase", "FinishExecute", SDK::Params::BTTask_BlueprintBase_FinishExecute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, ReceiveAbort, "BTTask_BlueprintBase", "ReceiveAbort", SDK::Params::BTTask_BlueprintBase_ReceiveAbort)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, ReceiveAbortAI, "BTTask_BlueprintBase", "ReceiveAbortAI", SDK::Params::BTTask_BlueprintBase_ReceiveAbortAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, ReceiveExecute, "BTTask_BlueprintBase", "ReceiveExecute", SDK::Params::BTTask_BlueprintBase_ReceiveExecute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, ReceiveExecuteAI, "BTTask_BlueprintBase", "ReceiveExecuteAI", SDK::Params::BTTask_BlueprintBase_ReceiveExecuteAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, ReceiveTick, "BTTask_BlueprintBase", "ReceiveTick", SDK::Params::BTTask_BlueprintBase_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, ReceiveTickAI, "BTTask_BlueprintBase", "ReceiveTickAI", SDK::Params::BTTask_BlueprintBase_ReceiveTickAI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, SetFinishOnMessage, "BTTask_BlueprintBase", "SetFinishOnMessage", SDK::Params::BTTask_BlueprintBase_SetFinishOnMessage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, SetFinishOnMessageWithId, "BTTask_BlueprintBase", "SetFinishOnMessageWithId", SDK::Params::BTTask_BlueprintBase_SetFinishOnMessageWithId)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, IsTaskAborting, "BTTask_BlueprintBase", "IsTaskAborting", SDK::Params::BTTask_BlueprintBase_IsTaskAborting)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBTTask_BlueprintBase, IsTaskExecuting, "BTTask_BlueprintBase", "IsTaskExecuting", SDK::Params::BTTask_BlueprintBase_IsTaskExecuting)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAITask_RunEQS, RunEQS, "AITask_RunEQS", "RunEQS", SDK::Params::AITask_RunEQS_RunEQS)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, CreateMoveToProxyObject, "AIBlueprintHelperLibrary", "CreateMoveToProxyObject", SDK::Params::AIBlueprintHelperLibrary_CreateMoveToProxyObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, GetAIController, "AIBlueprintHelperLibrary", "GetAIController", SDK::Params::AIBlueprintHelperLibrary_GetAIController)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, GetBlackboard, "AIBlueprintHelperLibrary", "GetBlackboard", SDK::Params::AIBlueprintHelperLibrary_GetBlackboard)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, GetCurrentPath, "AIBlueprintHelperLibrary", "GetCurrentPath", SDK::Params::AIBlueprintHelperLibrary_GetCurrentPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, GetCurrentPathIndex, "AIBlueprintHelperLibrary", "GetCurrentPathIndex", SDK::Params::AIBlueprintHelperLibrary_GetCurrentPathIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, GetCurrentPathPoints, "AIBlueprintHelperLibrary", "GetCurrentPathPoints", SDK::Params::AIBlueprintHelperLibrary_GetCurrentPathPoints)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, GetNextNavLinkIndex, "AIBlueprintHelperLibrary", "GetNextNavLinkIndex", SDK::Params::AIBlueprintHelperLibrary_GetNextNavLinkIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, IsValidAIDirection, "AIBlueprintHelperLibrary", "IsValidAIDirection", SDK::Params::AIBlueprintHelperLibrary_IsValidAIDirection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, IsValidAILocation, "AIBlueprintHelperLibrary", "IsValidAILocation", SDK::Params::AIBlueprintHelperLibrary_IsValidAILocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, IsValidAIRotation, "AIBlueprintHelperLibrary", "IsValidAIRotation", SDK::Params::AIBlueprintHelperLibrary_IsValidAIRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, LockAIResourcesWithAnimation, "AIBlueprintHelperLibrary", "LockAIResourcesWithAnimation", SDK::Params::AIBlueprintHelperLibrary_LockAIResourcesWithAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, SendAIMessage, "AIBlueprintHelperLibrary", "SendAIMessage", SDK::Params::AIBlueprintHelperLibrary_SendAIMessage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, SimpleMoveToActor, "AIBlueprintHelperLibrary", "SimpleMoveToActor", SDK::Params::AIBlueprintHelperLibrary_SimpleMoveToActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, SimpleMoveToLocation, "AIBlueprintHelperLibrary", "SimpleMoveToLocation", SDK::Params::AIBlueprintHelperLibrary_SimpleMoveToLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, SpawnAIFromClass, "AIBlueprintHelperLibrary", "SpawnAIFromClass", SDK::Params::AIBlueprintHelperLibrary_SpawnAIFromClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIBlueprintHelperLibrary, UnlockAIResourcesWithAnimation, "AIBlueprintHelperLibrary", "UnlockAIResourcesWithAnimation", SDK::Params::AIBlueprintHelperLibrary_UnlockAIResourcesWithAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryInstanceBlueprintWrapper, SetNamedParam, "EnvQueryInstanceBlueprintWrapper", "SetNamedParam", SDK::Params::EnvQueryInstanceBlueprintWrapper_SetNamedParam)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryInstanceBlueprintWrapper, GetItemScore, "EnvQueryInstanceBlueprintWrapper", "GetItemScore", SDK::Params::EnvQueryInstanceBlueprintWrapper_GetItemScore)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryInstanceBlueprintWrapper, GetQueryResultsAsActors, "EnvQueryInstanceBlueprintWrapper", "GetQueryResultsAsActors", SDK::Params::EnvQueryInstanceBlueprintWrapper_GetQueryResultsAsActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryInstanceBlueprintWrapper, GetQueryResultsAsLocations, "EnvQueryInstanceBlueprintWrapper", "GetQueryResultsAsLocations", SDK::Params::EnvQueryInstanceBlueprintWrapper_GetQueryResultsAsLocations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryInstanceBlueprintWrapper, GetResultsAsActors, "EnvQueryInstanceBlueprintWrapper", "GetResultsAsActors", SDK::Params::EnvQueryInstanceBlueprintWrapper_GetResultsAsActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnvQueryInstanceBlueprintWrapper, GetResultsAsLocations, "EnvQueryInstanceBlueprintWrapper", "GetResultsAsLocations", SDK::Params::EnvQueryInstanceBlueprintWrapper_GetResultsAsLocations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCrowdFollowingComponent, SuspendCrowdSteering, "CrowdFollowingComponent", "SuspendCrowdSteering", SDK::Params::CrowdFollowingComponent_SuspendCrowdSteering)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANavLinkProxy, ReceiveSmartLinkReached, "NavLinkProxy", "ReceiveSmartLinkReached", SDK::Params::NavLinkProxy_ReceiveSmartLinkReached)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANavLinkProxy, ResumePathFollowing, "NavLinkProxy", "ResumePathFollowing", SDK::Params::NavLinkProxy_ResumePathFollowing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANavLinkProxy, SetSmartLinkEnabled, "NavLinkProxy", "SetSmartLinkEnabled", SDK::Params::NavLinkProxy_SetSmartLinkEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANavLinkProxy, HasMovingAgents, "NavLinkProxy", "HasMovingAgents", SDK::Params::NavLinkProxy_HasMovingAgents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANavLinkProxy, IsSmartLinkEnabled, "NavLinkProxy", "IsSmartLinkEnabled", SDK::Params::NavLinkProxy_IsSmartLinkEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavLocalGridManager, AddLocalNavigationGridForBox, "NavLocalGridManager", "AddLocalNavigationGridForBox", SDK::Params::NavLocalGridManager_AddLocalNavigationGridForBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavLocalGridManager, AddLocalNavigationGridForCapsule, "NavLocalGridManager", "AddLocalNavigationGridForCapsule", SDK::Params::NavLocalGridManager_AddLocalNavigationGridForCapsule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavLocalGridManager, AddLocalNavigationGridForPoint, "NavLocalGridManager", "AddLocalNavigationGridForPoint", SDK::Params::NavLocalGridManager_AddLocalNavigationGridForPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavLocalGridManager, AddLocalNavigationGridForPoints, "NavLocalGridManager", "AddLocalNavigationGridForPoints", SDK::Params::NavLocalGridManager_AddLocalNavigationGridForPoints)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavLocalGridManager, FindLocalNavigationGridPath, "NavLocalGridManager", "FindLocalNavigationGridPath", SDK::Params::NavLocalGridManager_FindLocalNavigationGridPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavLocalGridManager, RemoveLocalNavigationGrid, "NavLocalGridManager", "RemoveLocalNavigationGrid", SDK::Params::NavLocalGridManager_RemoveLocalNavigationGrid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavLocalGridManager, SetLocalNavigationGridDensity, "NavLocalGridManager", "SetLocalNavigationGridDensity", SDK::Params::NavLocalGridManager_SetLocalNavigationGridDensity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, ForgetAll, "AIPerceptionComponent", "ForgetAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, GetActorsPerception, "AIPerceptionComponent", "GetActorsPerception", SDK::Params::AIPerceptionComponent_GetActorsPerception)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, OnOwnerEndPlay, "AIPerceptionComponent", "OnOwnerEndPlay", SDK::Params::AIPerceptionComponent_OnOwnerEndPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, RequestStimuliListenerUpdate, "AIPerceptionComponent", "RequestStimuliListenerUpdate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, SetSenseEnabled, "AIPerceptionComponent", "SetSenseEnabled", SDK::Params::AIPerceptionComponent_SetSenseEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, GetCurrentlyPerceivedActors, "AIPerceptionComponent", "GetCurrentlyPerceivedActors", SDK::Params::AIPerceptionComponent_GetCurrentlyPerceivedActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, GetKnownPerceivedActors, "AIPerceptionComponent", "GetKnownPerceivedActors", SDK::Params::AIPerceptionComponent_GetKnownPerceivedActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, GetPerceivedHostileActors, "AIPerceptionComponent", "GetPerceivedHostileActors", SDK::Params::AIPerceptionComponent_GetPerceivedHostileActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, GetPerceivedHostileActorsBySense, "AIPerceptionComponent", "GetPerceivedHostileActorsBySense", SDK::Params::AIPerceptionComponent_GetPerceivedHostileActorsBySense)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionComponent, IsSenseEnabled, "AIPerceptionComponent", "IsSenseEnabled", SDK::Params::AIPerceptionComponent_IsSenseEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionSystem, GetSenseClassForStimulus, "AIPerceptionSystem", "GetSenseClassForStimulus", SDK::Params::AIPerceptionSystem_GetSenseClassForStimulus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionSystem, RegisterPerceptionStimuliSource, "AIPerceptionSystem", "RegisterPerceptionStimuliSource", SDK::Params::AIPerceptionSystem_RegisterPerceptionStimuliSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionSystem, ReportPerceptionEvent, "AIPerceptionSystem", "ReportPerceptionEvent", SDK::Params::AIPerceptionSystem_ReportPerceptionEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionSystem, OnPerceptionStimuliSourceEndPlay, "AIPerceptionSystem", "OnPerceptionStimuliSourceEndPlay", SDK::Params::AIPerceptionSystem_OnPerceptionStimuliSourceEndPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAIPerceptionSystem, ReportEvent, "AIPerceptionSystem", "ReportEvent", SDK::Params::AIPerceptionSystem_ReportEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Blueprint, K2_OnNewPawn, "AISense_Blueprint", "K2_OnNewPawn", SDK::Params::AISense_Blueprint_K2_OnNewPawn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Blueprint, OnListenerRegistered, "AISense_Blueprint", "OnListenerRegistered", SDK::Params::AISense_Blueprint_OnListenerRegistered)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Blueprint, OnListenerUnregistered, "AISense_Blueprint", "OnListenerUnregistered", SDK::Params::AISense_Blueprint_OnListenerUnregistered)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Blueprint, OnListenerUpdated, "AISense_Blueprint", "OnListenerUpdated", SDK::Params::AISense_Blueprint_OnListenerUpdated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Blueprint, OnUpdate, "AISense_Blueprint", "OnUpdate", SDK::Params::AISense_Blueprint_OnUpdate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Blueprint, GetAllListenerActors, "AISense_Blueprint", "GetAllListenerActors", SDK::Params::AISense_Blueprint_GetAllListenerActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Blueprint, GetAllListenerComponents, "AISense_Blueprint", "GetAllListenerComponents", SDK::Params::AISense_Blueprint_GetAllListenerComponents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Damage, ReportDamageEvent, "AISense_Damage", "ReportDamageEvent", SDK::Params::AISense_Damage_ReportDamageEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Prediction, RequestControllerPredictionEvent, "AISense_Prediction", "RequestControllerPredictionEvent", SDK::Params::AISense_Prediction_RequestControllerPredictionEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Prediction, RequestPawnPredictionEvent, "AISense_Prediction", "RequestPawnPredictionEvent", SDK::Params::AISense_Prediction_RequestPawnPredictionEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAISense_Touch, ReportTouchEvent, "AISense_Touch", "ReportTouchEvent", SDK::Params::AISense_Touch_ReportTouchEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAITask_MoveTo, AIMoveTo, "AITask_MoveTo", "AIMoveTo", SDK::Params::AITask_MoveTo_AIMoveTo)
+// clang-format on
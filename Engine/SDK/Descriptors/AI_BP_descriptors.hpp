@@ -0,0 +1,20 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AI_BP_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AI_BP_classes.hpp"
+#include "../SDK/AI_BP_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAI_BP_C, Attack, "AI_BP_C", "Attack", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAI_BP_C, Dash_Event, "AI_BP_C", "Dash Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAI_BP_C, ExecuteUbergraph_AI_BP, "AI_BP_C", "ExecuteUbergraph_AI_BP", SDK::Params::AI_BP_C_ExecuteUbergraph_AI_BP)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAI_BP_C, Minus_Attack_Intent, "AI_BP_C", "Minus Attack Intent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAI_BP_C, ReceiveBeginPlay, "AI_BP_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAI_BP_C, ReceiveTick, "AI_BP_C", "ReceiveTick", SDK::Params::AI_BP_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAI_BP_C, Stop_That_Blade, "AI_BP_C", "Stop That Blade", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AAI_BP_C, UserConstructionScript, "AI_BP_C", "UserConstructionScript", void)
+// clang-format on
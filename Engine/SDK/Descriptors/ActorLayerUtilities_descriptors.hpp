@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ActorLayerUtilities_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ActorLayerUtilities_classes.hpp"
+#include "../SDK/ActorLayerUtilities_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULayersBlueprintLibrary, AddActorToLayer, "LayersBlueprintLibrary", "AddActorToLayer", SDK::Params::LayersBlueprintLibrary_AddActorToLayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULayersBlueprintLibrary, GetActors, "LayersBlueprintLibrary", "GetActors", SDK::Params::LayersBlueprintLibrary_GetActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULayersBlueprintLibrary, RemoveActorFromLayer, "LayersBlueprintLibrary", "RemoveActorFromLayer", SDK::Params::LayersBlueprintLibrary_RemoveActorFromLayer)
+// clang-format on
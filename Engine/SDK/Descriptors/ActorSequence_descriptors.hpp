@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ActorSequence_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ActorSequence_classes.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UActorSequenceComponent, PauseSequence, "ActorSequenceComponent", "PauseSequence", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UActorSequenceComponent, PlaySequence, "ActorSequenceComponent", "PlaySequence", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UActorSequenceComponent, StopSequence, "ActorSequenceComponent", "StopSequence", void)
+// clang-format on
@@ -0,0 +1,32 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AdvancedWidgets_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AdvancedWidgets_classes.hpp"
+#include "../SDK/AdvancedWidgets_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetAngularOffset, "RadialSlider", "SetAngularOffset", SDK::Params::RadialSlider_SetAngularOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetCenterBackgroundColor, "RadialSlider", "SetCenterBackgroundColor", SDK::Params::RadialSlider_SetCenterBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetCustomDefaultValue, "RadialSlider", "SetCustomDefaultValue", SDK::Params::RadialSlider_SetCustomDefaultValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetHandStartEndRatio, "RadialSlider", "SetHandStartEndRatio", SDK::Params::RadialSlider_SetHandStartEndRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetLocked, "RadialSlider", "SetLocked", SDK::Params::RadialSlider_SetLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetShowSliderHand, "RadialSlider", "SetShowSliderHand", SDK::Params::RadialSlider_SetShowSliderHand)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetShowSliderHandle, "RadialSlider", "SetShowSliderHandle", SDK::Params::RadialSlider_SetShowSliderHandle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetSliderBarColor, "RadialSlider", "SetSliderBarColor", SDK::Params::RadialSlider_SetSliderBarColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetSliderHandleColor, "RadialSlider", "SetSliderHandleColor", SDK::Params::RadialSlider_SetSliderHandleColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetSliderHandleEndAngle, "RadialSlider", "SetSliderHandleEndAngle", SDK::Params::RadialSlider_SetSliderHandleEndAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetSliderHandleStartAngle, "RadialSlider", "SetSliderHandleStartAngle", SDK::Params::RadialSlider_SetSliderHandleStartAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetSliderProgressColor, "RadialSlider", "SetSliderProgressColor", SDK::Params::RadialSlider_SetSliderProgressColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetSliderRange, "RadialSlider", "SetSliderRange", SDK::Params::RadialSlider_SetSliderRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetStepSize, "RadialSlider", "SetStepSize", SDK::Params::RadialSlider_SetStepSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetUseVerticalDrag, "RadialSlider", "SetUseVerticalDrag", SDK::Params::RadialSlider_SetUseVerticalDrag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetValue, "RadialSlider", "SetValue", SDK::Params::RadialSlider_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, SetValueTags, "RadialSlider", "SetValueTags", SDK::Params::RadialSlider_SetValueTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, GetCustomDefaultValue, "RadialSlider", "GetCustomDefaultValue", SDK::Params::RadialSlider_GetCustomDefaultValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, GetNormalizedSliderHandlePosition, "RadialSlider", "GetNormalizedSliderHandlePosition", SDK::Params::RadialSlider_GetNormalizedSliderHandlePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialSlider, GetValue, "RadialSlider", "GetValue", SDK::Params::RadialSlider_GetValue)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AndroidFileServer_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AndroidFileServer_classes.hpp"
+#include "../SDK/AndroidFileServer_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAndroidFileServerBPLibrary, IsFileServerRunning, "AndroidFileServerBPLibrary", "IsFileServerRunning", SDK::Params::AndroidFileServerBPLibrary_IsFileServerRunning)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAndroidFileServerBPLibrary, StartFileServer, "AndroidFileServerBPLibrary", "StartFileServer", SDK::Params::AndroidFileServerBPLibrary_StartFileServer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAndroidFileServerBPLibrary, StopFileServer, "AndroidFileServerBPLibrary", "StopFileServer", SDK::Params::AndroidFileServerBPLibrary_StopFileServer)
+// clang-format on
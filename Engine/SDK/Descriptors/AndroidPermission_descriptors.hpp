@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AndroidPermission_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AndroidPermission_classes.hpp"
+#include "../SDK/AndroidPermission_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAndroidPermissionFunctionLibrary, AcquirePermissions, "AndroidPermissionFunctionLibrary", "AcquirePermissions", SDK::Params::AndroidPermissionFunctionLibrary_AcquirePermissions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAndroidPermissionFunctionLibrary, CheckPermission, "AndroidPermissionFunctionLibrary", "CheckPermission", SDK::Params::AndroidPermissionFunctionLibrary_CheckPermission)
+// clang-format on
@@ -0,0 +1,122 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AnimGraphRuntime_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AnimGraphRuntime_classes.hpp"
+#include "../SDK/AnimGraphRuntime_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNodeRigidBodyLibrary, ConvertToRigidBodyAnimNode, "AnimNodeRigidBodyLibrary", "ConvertToRigidBodyAnimNode", SDK::Params::AnimNodeRigidBodyLibrary_ConvertToRigidBodyAnimNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNodeRigidBodyLibrary, ConvertToRigidBodyAnimNodePure, "AnimNodeRigidBodyLibrary", "ConvertToRigidBodyAnimNodePure", SDK::Params::AnimNodeRigidBodyLibrary_ConvertToRigidBodyAnimNodePure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNodeRigidBodyLibrary, SetOverridePhysicsAsset, "AnimNodeRigidBodyLibrary", "SetOverridePhysicsAsset", SDK::Params::AnimNodeRigidBodyLibrary_SetOverridePhysicsAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpaceLibrary, ConvertToBlendSpace, "BlendSpaceLibrary", "ConvertToBlendSpace", SDK::Params::BlendSpaceLibrary_ConvertToBlendSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpaceLibrary, ConvertToBlendSpacePure, "BlendSpaceLibrary", "ConvertToBlendSpacePure", SDK::Params::BlendSpaceLibrary_ConvertToBlendSpacePure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpaceLibrary, GetFilteredPosition, "BlendSpaceLibrary", "GetFilteredPosition", SDK::Params::BlendSpaceLibrary_GetFilteredPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpaceLibrary, GetPosition, "BlendSpaceLibrary", "GetPosition", SDK::Params::BlendSpaceLibrary_GetPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpaceLibrary, SnapToPosition, "BlendSpaceLibrary", "SnapToPosition", SDK::Params::BlendSpaceLibrary_SnapToPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ISequencerAnimationOverride, AllowsCinematicOverride, "SequencerAnimationOverride", "AllowsCinematicOverride", SDK::Params::SequencerAnimationOverride_AllowsCinematicOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ISequencerAnimationOverride, GetSequencerAnimSlotNames, "SequencerAnimationOverride", "GetSequencerAnimSlotNames", SDK::Params::SequencerAnimationOverride_GetSequencerAnimSlotNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, ConvertToAnimationStateMachine, "AnimationStateMachineLibrary", "ConvertToAnimationStateMachine", SDK::Params::AnimationStateMachineLibrary_ConvertToAnimationStateMachine)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, ConvertToAnimationStateMachinePure, "AnimationStateMachineLibrary", "ConvertToAnimationStateMachinePure", SDK::Params::AnimationStateMachineLibrary_ConvertToAnimationStateMachinePure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, ConvertToAnimationStateResult, "AnimationStateMachineLibrary", "ConvertToAnimationStateResult", SDK::Params::AnimationStateMachineLibrary_ConvertToAnimationStateResult)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, ConvertToAnimationStateResultPure, "AnimationStateMachineLibrary", "ConvertToAnimationStateResultPure", SDK::Params::AnimationStateMachineLibrary_ConvertToAnimationStateResultPure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, GetRelevantAnimTimeRemaining, "AnimationStateMachineLibrary", "GetRelevantAnimTimeRemaining", SDK::Params::AnimationStateMachineLibrary_GetRelevantAnimTimeRemaining)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, GetRelevantAnimTimeRemainingFraction, "AnimationStateMachineLibrary", "GetRelevantAnimTimeRemainingFraction", SDK::Params::AnimationStateMachineLibrary_GetRelevantAnimTimeRemainingFraction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, GetState, "AnimationStateMachineLibrary", "GetState", SDK::Params::AnimationStateMachineLibrary_GetState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, IsStateBlendingIn, "AnimationStateMachineLibrary", "IsStateBlendingIn", SDK::Params::AnimationStateMachineLibrary_IsStateBlendingIn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, IsStateBlendingOut, "AnimationStateMachineLibrary", "IsStateBlendingOut", SDK::Params::AnimationStateMachineLibrary_IsStateBlendingOut)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationStateMachineLibrary, SetState, "AnimationStateMachineLibrary", "SetState", SDK::Params::AnimationStateMachineLibrary_SetState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, ConvertToComponentSpacePoseContext, "AnimExecutionContextLibrary", "ConvertToComponentSpacePoseContext", SDK::Params::AnimExecutionContextLibrary_ConvertToComponentSpacePoseContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, ConvertToInitializationContext, "AnimExecutionContextLibrary", "ConvertToInitializationContext", SDK::Params::AnimExecutionContextLibrary_ConvertToInitializationContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, ConvertToPoseContext, "AnimExecutionContextLibrary", "ConvertToPoseContext", SDK::Params::AnimExecutionContextLibrary_ConvertToPoseContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, ConvertToUpdateContext, "AnimExecutionContextLibrary", "ConvertToUpdateContext", SDK::Params::AnimExecutionContextLibrary_ConvertToUpdateContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, GetAnimInstance, "AnimExecutionContextLibrary", "GetAnimInstance", SDK::Params::AnimExecutionContextLibrary_GetAnimInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, GetAnimNodeReference, "AnimExecutionContextLibrary", "GetAnimNodeReference", SDK::Params::AnimExecutionContextLibrary_GetAnimNodeReference)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, GetCurrentWeight, "AnimExecutionContextLibrary", "GetCurrentWeight", SDK::Params::AnimExecutionContextLibrary_GetCurrentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, GetDeltaTime, "AnimExecutionContextLibrary", "GetDeltaTime", SDK::Params::AnimExecutionContextLibrary_GetDeltaTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimExecutionContextLibrary, IsActive, "AnimExecutionContextLibrary", "IsActive", SDK::Params::AnimExecutionContextLibrary_IsActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendListBaseLibrary, ConvertToBlendListBase, "BlendListBaseLibrary", "ConvertToBlendListBase", SDK::Params::BlendListBaseLibrary_ConvertToBlendListBase)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendListBaseLibrary, ResetNode, "BlendListBaseLibrary", "ResetNode", SDK::Params::BlendListBaseLibrary_ResetNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, ConvertToBlendSpacePlayer, "BlendSpacePlayerLibrary", "ConvertToBlendSpacePlayer", SDK::Params::BlendSpacePlayerLibrary_ConvertToBlendSpacePlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, ConvertToBlendSpacePlayerPure, "BlendSpacePlayerLibrary", "ConvertToBlendSpacePlayerPure", SDK::Params::BlendSpacePlayerLibrary_ConvertToBlendSpacePlayerPure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, GetBlendSpace, "BlendSpacePlayerLibrary", "GetBlendSpace", SDK::Params::BlendSpacePlayerLibrary_GetBlendSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, GetLoop, "BlendSpacePlayerLibrary", "GetLoop", SDK::Params::BlendSpacePlayerLibrary_GetLoop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, GetPlayRate, "BlendSpacePlayerLibrary", "GetPlayRate", SDK::Params::BlendSpacePlayerLibrary_GetPlayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, GetPosition, "BlendSpacePlayerLibrary", "GetPosition", SDK::Params::BlendSpacePlayerLibrary_GetPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, GetStartPosition, "BlendSpacePlayerLibrary", "GetStartPosition", SDK::Params::BlendSpacePlayerLibrary_GetStartPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, SetBlendSpace, "BlendSpacePlayerLibrary", "SetBlendSpace", SDK::Params::BlendSpacePlayerLibrary_SetBlendSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, SetBlendSpaceWithInertialBlending, "BlendSpacePlayerLibrary", "SetBlendSpaceWithInertialBlending", SDK::Params::BlendSpacePlayerLibrary_SetBlendSpaceWithInertialBlending)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, SetLoop, "BlendSpacePlayerLibrary", "SetLoop", SDK::Params::BlendSpacePlayerLibrary_SetLoop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, SetPlayRate, "BlendSpacePlayerLibrary", "SetPlayRate", SDK::Params::BlendSpacePlayerLibrary_SetPlayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, SetResetPlayTimeWhenBlendSpaceChanges, "BlendSpacePlayerLibrary", "SetResetPlayTimeWhenBlendSpaceChanges", SDK::Params::BlendSpacePlayerLibrary_SetResetPlayTimeWhenBlendSpaceChanges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, ShouldResetPlayTimeWhenBlendSpaceChanges, "BlendSpacePlayerLibrary", "ShouldResetPlayTimeWhenBlendSpaceChanges", SDK::Params::BlendSpacePlayerLibrary_ShouldResetPlayTimeWhenBlendSpaceChanges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlendSpacePlayerLibrary, SnapToPosition, "BlendSpacePlayerLibrary", "SnapToPosition", SDK::Params::BlendSpacePlayerLibrary_SnapToPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, CalculateDirection, "KismetAnimationLibrary", "CalculateDirection", SDK::Params::KismetAnimationLibrary_CalculateDirection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_CalculateVelocityFromPositionHistory, "KismetAnimationLibrary", "K2_CalculateVelocityFromPositionHistory", SDK::Params::KismetAnimationLibrary_K2_CalculateVelocityFromPositionHistory)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_CalculateVelocityFromSockets, "KismetAnimationLibrary", "K2_CalculateVelocityFromSockets", SDK::Params::KismetAnimationLibrary_K2_CalculateVelocityFromSockets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_DirectionBetweenSockets, "KismetAnimationLibrary", "K2_DirectionBetweenSockets", SDK::Params::KismetAnimationLibrary_K2_DirectionBetweenSockets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_DistanceBetweenTwoSocketsAndMapRange, "KismetAnimationLibrary", "K2_DistanceBetweenTwoSocketsAndMapRange", SDK::Params::KismetAnimationLibrary_K2_DistanceBetweenTwoSocketsAndMapRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_EndProfilingTimer, "KismetAnimationLibrary", "K2_EndProfilingTimer", SDK::Params::KismetAnimationLibrary_K2_EndProfilingTimer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_LookAt, "KismetAnimationLibrary", "K2_LookAt", SDK::Params::KismetAnimationLibrary_K2_LookAt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_MakePerlinNoiseAndRemap, "KismetAnimationLibrary", "K2_MakePerlinNoiseAndRemap", SDK::Params::KismetAnimationLibrary_K2_MakePerlinNoiseAndRemap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_MakePerlinNoiseVectorAndRemap, "KismetAnimationLibrary", "K2_MakePerlinNoiseVectorAndRemap", SDK::Params::KismetAnimationLibrary_K2_MakePerlinNoiseVectorAndRemap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_StartProfilingTimer, "KismetAnimationLibrary", "K2_StartProfilingTimer", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetAnimationLibrary, K2_TwoBoneIK, "KismetAnimationLibrary", "K2_TwoBoneIK", SDK::Params::KismetAnimationLibrary_K2_TwoBoneIK)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULayeredBoneBlendLibrary, ConvertToLayeredBlendPerBonePure, "LayeredBoneBlendLibrary", "ConvertToLayeredBlendPerBonePure", SDK::Params::LayeredBoneBlendLibrary_ConvertToLayeredBlendPerBonePure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULayeredBoneBlendLibrary, ConvertToLayeredBoneBlend, "LayeredBoneBlendLibrary", "ConvertToLayeredBoneBlend", SDK::Params::LayeredBoneBlendLibrary_ConvertToLayeredBoneBlend)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULayeredBoneBlendLibrary, GetNumPoses, "LayeredBoneBlendLibrary", "GetNumPoses", SDK::Params::LayeredBoneBlendLibrary_GetNumPoses)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULayeredBoneBlendLibrary, SetBlendMask, "LayeredBoneBlendLibrary", "SetBlendMask", SDK::Params::LayeredBoneBlendLibrary_SetBlendMask)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULinkedAnimGraphLibrary, ConvertToLinkedAnimGraph, "LinkedAnimGraphLibrary", "ConvertToLinkedAnimGraph", SDK::Params::LinkedAnimGraphLibrary_ConvertToLinkedAnimGraph)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULinkedAnimGraphLibrary, ConvertToLinkedAnimGraphPure, "LinkedAnimGraphLibrary", "ConvertToLinkedAnimGraphPure", SDK::Params::LinkedAnimGraphLibrary_ConvertToLinkedAnimGraphPure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULinkedAnimGraphLibrary, GetLinkedAnimInstance, "LinkedAnimGraphLibrary", "GetLinkedAnimInstance", SDK::Params::LinkedAnimGraphLibrary_GetLinkedAnimInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULinkedAnimGraphLibrary, HasLinkedAnimInstance, "LinkedAnimGraphLibrary", "HasLinkedAnimInstance", SDK::Params::LinkedAnimGraphLibrary_HasLinkedAnimInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorAnimLibrary, ConvertToMirrorNode, "MirrorAnimLibrary", "ConvertToMirrorNode", SDK::Params::MirrorAnimLibrary_ConvertToMirrorNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorAnimLibrary, ConvertToMirrorNodePure, "MirrorAnimLibrary", "ConvertToMirrorNodePure", SDK::Params::MirrorAnimLibrary_ConvertToMirrorNodePure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorAnimLibrary, GetMirror, "MirrorAnimLibrary", "GetMirror", SDK::Params::MirrorAnimLibrary_GetMirror)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorAnimLibrary, GetMirrorDataTable, "MirrorAnimLibrary", "GetMirrorDataTable", SDK::Params::MirrorAnimLibrary_GetMirrorDataTable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorAnimLibrary, GetMirrorTransitionBlendTime, "MirrorAnimLibrary", "GetMirrorTransitionBlendTime", SDK::Params::MirrorAnimLibrary_GetMirrorTransitionBlendTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorAnimLibrary, SetMirror, "MirrorAnimLibrary", "SetMirror", SDK::Params::MirrorAnimLibrary_SetMirror)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorAnimLibrary, SetMirrorTransitionBlendTime, "MirrorAnimLibrary", "SetMirrorTransitionBlendTime", SDK::Params::MirrorAnimLibrary_SetMirrorTransitionBlendTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModifyCurveAnimLibrary, ConvertToModifyCurveNode, "ModifyCurveAnimLibrary", "ConvertToModifyCurveNode", SDK::Params::ModifyCurveAnimLibrary_ConvertToModifyCurveNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModifyCurveAnimLibrary, ConvertToModifyCurveNodePure, "ModifyCurveAnimLibrary", "ConvertToModifyCurveNodePure", SDK::Params::ModifyCurveAnimLibrary_ConvertToModifyCurveNodePure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModifyCurveAnimLibrary, GetAlpha, "ModifyCurveAnimLibrary", "GetAlpha", SDK::Params::ModifyCurveAnimLibrary_GetAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModifyCurveAnimLibrary, GetApplyMode, "ModifyCurveAnimLibrary", "GetApplyMode", SDK::Params::ModifyCurveAnimLibrary_GetApplyMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModifyCurveAnimLibrary, SetAlpha, "ModifyCurveAnimLibrary", "SetAlpha", SDK::Params::ModifyCurveAnimLibrary_SetAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModifyCurveAnimLibrary, SetApplyMode, "ModifyCurveAnimLibrary", "SetApplyMode", SDK::Params::ModifyCurveAnimLibrary_SetApplyMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModifyCurveAnimLibrary, SetCurveMap, "ModifyCurveAnimLibrary", "SetCurveMap", SDK::Params::ModifyCurveAnimLibrary_SetCurveMap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayMontageCallbackProxy, CreateProxyObjectForPlayMontage, "PlayMontageCallbackProxy", "CreateProxyObjectForPlayMontage", SDK::Params::PlayMontageCallbackProxy_CreateProxyObjectForPlayMontage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayMontageCallbackProxy, OnMontageBlendingOut, "PlayMontageCallbackProxy", "OnMontageBlendingOut", SDK::Params::PlayMontageCallbackProxy_OnMontageBlendingOut)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayMontageCallbackProxy, OnMontageEnded, "PlayMontageCallbackProxy", "OnMontageEnded", SDK::Params::PlayMontageCallbackProxy_OnMontageEnded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayMontageCallbackProxy, OnNotifyBeginReceived, "PlayMontageCallbackProxy", "OnNotifyBeginReceived", SDK::Params::PlayMontageCallbackProxy_OnNotifyBeginReceived)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayMontageCallbackProxy, OnNotifyEndReceived, "PlayMontageCallbackProxy", "OnNotifyEndReceived", SDK::Params::PlayMontageCallbackProxy_OnNotifyEndReceived)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, AdvanceTime, "SequenceEvaluatorLibrary", "AdvanceTime", SDK::Params::SequenceEvaluatorLibrary_AdvanceTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, ConvertToSequenceEvaluator, "SequenceEvaluatorLibrary", "ConvertToSequenceEvaluator", SDK::Params::SequenceEvaluatorLibrary_ConvertToSequenceEvaluator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, ConvertToSequenceEvaluatorPure, "SequenceEvaluatorLibrary", "ConvertToSequenceEvaluatorPure", SDK::Params::SequenceEvaluatorLibrary_ConvertToSequenceEvaluatorPure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, GetAccumulatedTime, "SequenceEvaluatorLibrary", "GetAccumulatedTime", SDK::Params::SequenceEvaluatorLibrary_GetAccumulatedTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, GetSequence, "SequenceEvaluatorLibrary", "GetSequence", SDK::Params::SequenceEvaluatorLibrary_GetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, SetExplicitFrame, "SequenceEvaluatorLibrary", "SetExplicitFrame", SDK::Params::SequenceEvaluatorLibrary_SetExplicitFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, SetExplicitTime, "SequenceEvaluatorLibrary", "SetExplicitTime", SDK::Params::SequenceEvaluatorLibrary_SetExplicitTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, SetSequence, "SequenceEvaluatorLibrary", "SetSequence", SDK::Params::SequenceEvaluatorLibrary_SetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceEvaluatorLibrary, SetSequenceWithInertialBlending, "SequenceEvaluatorLibrary", "SetSequenceWithInertialBlending", SDK::Params::SequenceEvaluatorLibrary_SetSequenceWithInertialBlending)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, ComputePlayRateFromDuration, "SequencePlayerLibrary", "ComputePlayRateFromDuration", SDK::Params::SequencePlayerLibrary_ComputePlayRateFromDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, ConvertToSequencePlayer, "SequencePlayerLibrary", "ConvertToSequencePlayer", SDK::Params::SequencePlayerLibrary_ConvertToSequencePlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, ConvertToSequencePlayerPure, "SequencePlayerLibrary", "ConvertToSequencePlayerPure", SDK::Params::SequencePlayerLibrary_ConvertToSequencePlayerPure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, GetAccumulatedTime, "SequencePlayerLibrary", "GetAccumulatedTime", SDK::Params::SequencePlayerLibrary_GetAccumulatedTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, GetLoopAnimation, "SequencePlayerLibrary", "GetLoopAnimation", SDK::Params::SequencePlayerLibrary_GetLoopAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, GetPlayRate, "SequencePlayerLibrary", "GetPlayRate", SDK::Params::SequencePlayerLibrary_GetPlayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, GetSequence, "SequencePlayerLibrary", "GetSequence", SDK::Params::SequencePlayerLibrary_GetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, GetSequencePure, "SequencePlayerLibrary", "GetSequencePure", SDK::Params::SequencePlayerLibrary_GetSequencePure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, GetStartPosition, "SequencePlayerLibrary", "GetStartPosition", SDK::Params::SequencePlayerLibrary_GetStartPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, SetAccumulatedTime, "SequencePlayerLibrary", "SetAccumulatedTime", SDK::Params::SequencePlayerLibrary_SetAccumulatedTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, SetPlayRate, "SequencePlayerLibrary", "SetPlayRate", SDK::Params::SequencePlayerLibrary_SetPlayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, SetSequence, "SequencePlayerLibrary", "SetSequence", SDK::Params::SequencePlayerLibrary_SetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, SetSequenceWithInertialBlending, "SequencePlayerLibrary", "SetSequenceWithInertialBlending", SDK::Params::SequencePlayerLibrary_SetSequenceWithInertialBlending)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencePlayerLibrary, SetStartPosition, "SequencePlayerLibrary", "SetStartPosition", SDK::Params::SequencePlayerLibrary_SetStartPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USkeletalControlLibrary, ConvertToSkeletalControl, "SkeletalControlLibrary", "ConvertToSkeletalControl", SDK::Params::SkeletalControlLibrary_ConvertToSkeletalControl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USkeletalControlLibrary, ConvertToSkeletalControlPure, "SkeletalControlLibrary", "ConvertToSkeletalControlPure", SDK::Params::SkeletalControlLibrary_ConvertToSkeletalControlPure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USkeletalControlLibrary, GetAlpha, "SkeletalControlLibrary", "GetAlpha", SDK::Params::SkeletalControlLibrary_GetAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USkeletalControlLibrary, SetAlpha, "SkeletalControlLibrary", "SetAlpha", SDK::Params::SkeletalControlLibrary_SetAlpha)
+// clang-format on
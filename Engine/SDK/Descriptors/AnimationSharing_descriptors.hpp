@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AnimationSharing_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AnimationSharing_classes.hpp"
+#include "../SDK/AnimationSharing_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationSharingStateProcessor, GetAnimationStateEnum, "AnimationSharingStateProcessor", "GetAnimationStateEnum", SDK::Params::AnimationSharingStateProcessor_GetAnimationStateEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationSharingStateProcessor, ProcessActorState, "AnimationSharingStateProcessor", "ProcessActorState", SDK::Params::AnimationSharingStateProcessor_ProcessActorState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimSharingStateInstance, GetInstancedActors, "AnimSharingStateInstance", "GetInstancedActors", SDK::Params::AnimSharingStateInstance_GetInstancedActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationSharingManager, AnimationSharingEnabled, "AnimationSharingManager", "AnimationSharingEnabled", SDK::Params::AnimationSharingManager_AnimationSharingEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationSharingManager, CreateAnimationSharingManager, "AnimationSharingManager", "CreateAnimationSharingManager", SDK::Params::AnimationSharingManager_CreateAnimationSharingManager)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationSharingManager, GetAnimationSharingManager, "AnimationSharingManager", "GetAnimationSharingManager", SDK::Params::AnimationSharingManager_GetAnimationSharingManager)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimationSharingManager, RegisterActorWithSkeletonBP, "AnimationSharingManager", "RegisterActorWithSkeletonBP", SDK::Params::AnimationSharingManager_RegisterActorWithSkeletonBP)
+// clang-format on
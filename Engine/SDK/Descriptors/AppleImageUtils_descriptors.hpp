@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AppleImageUtils_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AppleImageUtils_classes.hpp"
+#include "../SDK/AppleImageUtils_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAppleImageUtilsBaseAsyncTaskBlueprintProxy, CreateProxyObjectForConvertToHEIF, "AppleImageUtilsBaseAsyncTaskBlueprintProxy", "CreateProxyObjectForConvertToHEIF", SDK::Params::AppleImageUtilsBaseAsyncTaskBlueprintProxy_CreateProxyObjectForConvertToHEIF)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAppleImageUtilsBaseAsyncTaskBlueprintProxy, CreateProxyObjectForConvertToJPEG, "AppleImageUtilsBaseAsyncTaskBlueprintProxy", "CreateProxyObjectForConvertToJPEG", SDK::Params::AppleImageUtilsBaseAsyncTaskBlueprintProxy_CreateProxyObjectForConvertToJPEG)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAppleImageUtilsBaseAsyncTaskBlueprintProxy, CreateProxyObjectForConvertToPNG, "AppleImageUtilsBaseAsyncTaskBlueprintProxy", "CreateProxyObjectForConvertToPNG", SDK::Params::AppleImageUtilsBaseAsyncTaskBlueprintProxy_CreateProxyObjectForConvertToPNG)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAppleImageUtilsBaseAsyncTaskBlueprintProxy, CreateProxyObjectForConvertToTIFF, "AppleImageUtilsBaseAsyncTaskBlueprintProxy", "CreateProxyObjectForConvertToTIFF", SDK::Params::AppleImageUtilsBaseAsyncTaskBlueprintProxy_CreateProxyObjectForConvertToTIFF)
+// clang-format on
@@ -0,0 +1,30 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Arena_Cutting_Map_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Arena_Cutting_Map_classes.hpp"
+#include "../SDK/Arena_Cutting_Map_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, Baron_Waves_Spawn, "Arena_Cutting_Map_C", "Baron Waves Spawn", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, BndEvt__Arena_Cutting_Map_TriggerVolume_0_K2Node_ActorBoundEvent_0_ActorBeginOverlapSignature__DelegateSignature, "Arena_Cutting_Map_C", "BndEvt__Arena_Cutting_Map_TriggerVolume_0_K2Node_ActorBoundEvent_0_ActorBeginOverlapSignature__DelegateSignature", SDK::Params::Arena_Cutting_Map_C_BndEvt__Arena_Cutting_Map_TriggerVolume_0_K2Node_ActorBoundEvent_0_ActorBeginOverlapSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, BndEvt__Arena_Cutting_Map_TriggerVolume_1_K2Node_ActorBoundEvent_1_ActorBeginOverlapSignature__DelegateSignature, "Arena_Cutting_Map_C", "BndEvt__Arena_Cutting_Map_TriggerVolume_1_K2Node_ActorBoundEvent_1_ActorBeginOverlapSignature__DelegateSignature", SDK::Params::Arena_Cutting_Map_C_BndEvt__Arena_Cutting_Map_TriggerVolume_1_K2Node_ActorBoundEvent_1_ActorBeginOverlapSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, BndEvt__Arena_Cutting_Map_TriggerVolume_2_K2Node_ActorBoundEvent_2_ActorBeginOverlapSignature__DelegateSignature, "Arena_Cutting_Map_C", "BndEvt__Arena_Cutting_Map_TriggerVolume_2_K2Node_ActorBoundEvent_2_ActorBeginOverlapSignature__DelegateSignature", SDK::Params::Arena_Cutting_Map_C_BndEvt__Arena_Cutting_Map_TriggerVolume_2_K2Node_ActorBoundEvent_2_ActorBeginOverlapSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, BndEvt__Arena_Cutting_Map_TriggerVolume_3_K2Node_ActorBoundEvent_3_ActorBeginOverlapSignature__DelegateSignature, "Arena_Cutting_Map_C", "BndEvt__Arena_Cutting_Map_TriggerVolume_3_K2Node_ActorBoundEvent_3_ActorBeginOverlapSignature__DelegateSignature", SDK::Params::Arena_Cutting_Map_C_BndEvt__Arena_Cutting_Map_TriggerVolume_3_K2Node_ActorBoundEvent_3_ActorBeginOverlapSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, BndEvt__Arena_Cutting_Map_TriggerVolume_4_K2Node_ActorBoundEvent_5_ActorBeginOverlapSignature__DelegateSignature, "Arena_Cutting_Map_C", "BndEvt__Arena_Cutting_Map_TriggerVolume_4_K2Node_ActorBoundEvent_5_ActorBeginOverlapSignature__DelegateSignature", SDK::Params::Arena_Cutting_Map_C_BndEvt__Arena_Cutting_Map_TriggerVolume_4_K2Node_ActorBoundEvent_5_ActorBeginOverlapSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, BndEvt__Arena_Cutting_Map_TriggerVolume_5_K2Node_ActorBoundEvent_4_ActorBeginOverlapSignature__DelegateSignature, "Arena_Cutting_Map_C", "BndEvt__Arena_Cutting_Map_TriggerVolume_5_K2Node_ActorBoundEvent_4_ActorBeginOverlapSignature__DelegateSignature", SDK::Params::Arena_Cutting_Map_C_BndEvt__Arena_Cutting_Map_TriggerVolume_5_K2Node_ActorBoundEvent_4_ActorBeginOverlapSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, Clean_Blood, "Arena_Cutting_Map_C", "Clean Blood", SDK::Params::Arena_Cutting_Map_C_Clean_Blood)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, Clear_Old_Actors, "Arena_Cutting_Map_C", "Clear Old Actors", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, ExecuteUbergraph_Arena_Cutting_Map, "Arena_Cutting_Map_C", "ExecuteUbergraph_Arena_Cutting_Map", SDK::Params::Arena_Cutting_Map_C_ExecuteUbergraph_Arena_Cutting_Map)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, LevelReset, "Arena_Cutting_Map_C", "LevelReset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, ReceiveBeginPlay, "Arena_Cutting_Map_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, ReceiveTick, "Arena_Cutting_Map_C", "ReceiveTick", SDK::Params::Arena_Cutting_Map_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, Spawn_Trash, "Arena_Cutting_Map_C", "Spawn Trash", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, Timeline_0__FinishedFunc, "Arena_Cutting_Map_C", "Timeline_0__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, Timeline_0__UpdateFunc, "Arena_Cutting_Map_C", "Timeline_0__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, Timeline_1__FinishedFunc, "Arena_Cutting_Map_C", "Timeline_1__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AArena_Cutting_Map_C, Timeline_1__UpdateFunc, "Arena_Cutting_Map_C", "Timeline_1__UpdateFunc", void)
+// clang-format on
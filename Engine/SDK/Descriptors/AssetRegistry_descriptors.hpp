@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AssetRegistry_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AssetRegistry_classes.hpp"
+#include "../SDK/AssetRegistry_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, CreateAssetData, "AssetRegistryHelpers", "CreateAssetData", SDK::Params::AssetRegistryHelpers_CreateAssetData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, FindAssetNativeClass, "AssetRegistryHelpers", "FindAssetNativeClass", SDK::Params::AssetRegistryHelpers_FindAssetNativeClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, GetAsset, "AssetRegistryHelpers", "GetAsset", SDK::Params::AssetRegistryHelpers_GetAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, GetAssetRegistry, "AssetRegistryHelpers", "GetAssetRegistry", SDK::Params::AssetRegistryHelpers_GetAssetRegistry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, GetBlueprintAssets, "AssetRegistryHelpers", "GetBlueprintAssets", SDK::Params::AssetRegistryHelpers_GetBlueprintAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, GetClass, "AssetRegistryHelpers", "GetClass", SDK::Params::AssetRegistryHelpers_GetClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, GetExportTextName, "AssetRegistryHelpers", "GetExportTextName", SDK::Params::AssetRegistryHelpers_GetExportTextName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, GetFullName, "AssetRegistryHelpers", "GetFullName", SDK::Params::AssetRegistryHelpers_GetFullName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, GetTagValue, "AssetRegistryHelpers", "GetTagValue", SDK::Params::AssetRegistryHelpers_GetTagValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, IsAssetLoaded, "AssetRegistryHelpers", "IsAssetLoaded", SDK::Params::AssetRegistryHelpers_IsAssetLoaded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, IsRedirector, "AssetRegistryHelpers", "IsRedirector", SDK::Params::AssetRegistryHelpers_IsRedirector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, IsUAsset, "AssetRegistryHelpers", "IsUAsset", SDK::Params::AssetRegistryHelpers_IsUAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, IsValid, "AssetRegistryHelpers", "IsValid", SDK::Params::AssetRegistryHelpers_IsValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, SetFilterTagsAndValues, "AssetRegistryHelpers", "SetFilterTagsAndValues", SDK::Params::AssetRegistryHelpers_SetFilterTagsAndValues)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetRegistryHelpers, ToSoftObjectPath, "AssetRegistryHelpers", "ToSoftObjectPath", SDK::Params::AssetRegistryHelpers_ToSoftObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, PrioritizeSearchPath, "AssetRegistry", "PrioritizeSearchPath", SDK::Params::AssetRegistry_PrioritizeSearchPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, ScanFilesSynchronous, "AssetRegistry", "ScanFilesSynchronous", SDK::Params::AssetRegistry_ScanFilesSynchronous)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, ScanModifiedAssetFiles, "AssetRegistry", "ScanModifiedAssetFiles", SDK::Params::AssetRegistry_ScanModifiedAssetFiles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, ScanPathsSynchronous, "AssetRegistry", "ScanPathsSynchronous", SDK::Params::AssetRegistry_ScanPathsSynchronous)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, SearchAllAssets, "AssetRegistry", "SearchAllAssets", SDK::Params::AssetRegistry_SearchAllAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, WaitForCompletion, "AssetRegistry", "WaitForCompletion", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, WaitForPackage, "AssetRegistry", "WaitForPackage", SDK::Params::AssetRegistry_WaitForPackage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAllAssets, "AssetRegistry", "GetAllAssets", SDK::Params::AssetRegistry_GetAllAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAllCachedPaths, "AssetRegistry", "GetAllCachedPaths", SDK::Params::AssetRegistry_GetAllCachedPaths)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAncestorClassNames, "AssetRegistry", "GetAncestorClassNames", SDK::Params::AssetRegistry_GetAncestorClassNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAssetByObjectPath, "AssetRegistry", "GetAssetByObjectPath", SDK::Params::AssetRegistry_GetAssetByObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAssets, "AssetRegistry", "GetAssets", SDK::Params::AssetRegistry_GetAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAssetsByClass, "AssetRegistry", "GetAssetsByClass", SDK::Params::AssetRegistry_GetAssetsByClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAssetsByPackageName, "AssetRegistry", "GetAssetsByPackageName", SDK::Params::AssetRegistry_GetAssetsByPackageName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAssetsByPath, "AssetRegistry", "GetAssetsByPath", SDK::Params::AssetRegistry_GetAssetsByPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetAssetsByPaths, "AssetRegistry", "GetAssetsByPaths", SDK::Params::AssetRegistry_GetAssetsByPaths)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetDerivedClassNames, "AssetRegistry", "GetDerivedClassNames", SDK::Params::AssetRegistry_GetDerivedClassNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, GetSubPaths, "AssetRegistry", "GetSubPaths", SDK::Params::AssetRegistry_GetSubPaths)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, HasAssets, "AssetRegistry", "HasAssets", SDK::Params::AssetRegistry_HasAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, IsLoadingAssets, "AssetRegistry", "IsLoadingAssets", SDK::Params::AssetRegistry_IsLoadingAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, IsSearchAllAssets, "AssetRegistry", "IsSearchAllAssets", SDK::Params::AssetRegistry_IsSearchAllAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, IsSearchAsync, "AssetRegistry", "IsSearchAsync", SDK::Params::AssetRegistry_IsSearchAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, K2_GetAssetByObjectPath, "AssetRegistry", "K2_GetAssetByObjectPath", SDK::Params::AssetRegistry_K2_GetAssetByObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, K2_GetDependencies, "AssetRegistry", "K2_GetDependencies", SDK::Params::AssetRegistry_K2_GetDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, K2_GetReferencers, "AssetRegistry", "K2_GetReferencers", SDK::Params::AssetRegistry_K2_GetReferencers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, RunAssetsThroughFilter, "AssetRegistry", "RunAssetsThroughFilter", SDK::Params::AssetRegistry_RunAssetsThroughFilter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAssetRegistry, UseFilterToExcludeAssets, "AssetRegistry", "UseFilterToExcludeAssets", SDK::Params::AssetRegistry_UseFilterToExcludeAssets)
+// clang-format on
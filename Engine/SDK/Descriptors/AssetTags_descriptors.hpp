@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AssetTags_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AssetTags_classes.hpp"
+#include "../SDK/AssetTags_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetTagsSubsystem, CollectionExists, "AssetTagsSubsystem", "CollectionExists", SDK::Params::AssetTagsSubsystem_CollectionExists)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetTagsSubsystem, GetAssetsInCollection, "AssetTagsSubsystem", "GetAssetsInCollection", SDK::Params::AssetTagsSubsystem_GetAssetsInCollection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetTagsSubsystem, GetCollections, "AssetTagsSubsystem", "GetCollections", SDK::Params::AssetTagsSubsystem_GetCollections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetTagsSubsystem, GetCollectionsContainingAsset, "AssetTagsSubsystem", "GetCollectionsContainingAsset", SDK::Params::AssetTagsSubsystem_GetCollectionsContainingAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetTagsSubsystem, GetCollectionsContainingAssetData, "AssetTagsSubsystem", "GetCollectionsContainingAssetData", SDK::Params::AssetTagsSubsystem_GetCollectionsContainingAssetData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetTagsSubsystem, GetCollectionsContainingAssetPtr, "AssetTagsSubsystem", "GetCollectionsContainingAssetPtr", SDK::Params::AssetTagsSubsystem_GetCollectionsContainingAssetPtr)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAssetTagsSubsystem, K2_GetCollectionsContainingAsset, "AssetTagsSubsystem", "K2_GetCollectionsContainingAsset", SDK::Params::AssetTagsSubsystem_K2_GetCollectionsContainingAsset)
+// clang-format on
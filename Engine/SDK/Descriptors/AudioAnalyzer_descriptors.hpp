@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AudioAnalyzer_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AudioAnalyzer_classes.hpp"
+#include "../SDK/AudioAnalyzer_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioAnalyzer, StartAnalyzing, "AudioAnalyzer", "StartAnalyzing", SDK::Params::AudioAnalyzer_StartAnalyzing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioAnalyzer, StopAnalyzing, "AudioAnalyzer", "StopAnalyzing", SDK::Params::AudioAnalyzer_StopAnalyzing)
+// clang-format on
@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AudioCapture_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AudioCapture_classes.hpp"
+#include "../SDK/AudioCapture_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioCapture, GetAudioCaptureDeviceInfo, "AudioCapture", "GetAudioCaptureDeviceInfo", SDK::Params::AudioCapture_GetAudioCaptureDeviceInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioCapture, IsCapturingAudio, "AudioCapture", "IsCapturingAudio", SDK::Params::AudioCapture_IsCapturingAudio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioCapture, StartCapturingAudio, "AudioCapture", "StartCapturingAudio", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioCapture, StopCapturingAudio, "AudioCapture", "StopCapturingAudio", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioCaptureFunctionLibrary, CreateAudioCapture, "AudioCaptureFunctionLibrary", "CreateAudioCapture", SDK::Params::AudioCaptureFunctionLibrary_CreateAudioCapture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioCaptureBlueprintLibrary, Conv_AudioInputDeviceInfoToString, "AudioCaptureBlueprintLibrary", "Conv_AudioInputDeviceInfoToString", SDK::Params::AudioCaptureBlueprintLibrary_Conv_AudioInputDeviceInfoToString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioCaptureBlueprintLibrary, GetAvailableAudioInputDevices, "AudioCaptureBlueprintLibrary", "GetAvailableAudioInputDevices", SDK::Params::AudioCaptureBlueprintLibrary_GetAvailableAudioInputDevices)
+// clang-format on
@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AudioExtensions_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AudioExtensions_classes.hpp"
+#include "../SDK/AudioExtensions_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, ResetParameters, "AudioParameterControllerInterface", "ResetParameters", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetBoolArrayParameter, "AudioParameterControllerInterface", "SetBoolArrayParameter", SDK::Params::AudioParameterControllerInterface_SetBoolArrayParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetBoolParameter, "AudioParameterControllerInterface", "SetBoolParameter", SDK::Params::AudioParameterControllerInterface_SetBoolParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetFloatArrayParameter, "AudioParameterControllerInterface", "SetFloatArrayParameter", SDK::Params::AudioParameterControllerInterface_SetFloatArrayParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetFloatParameter, "AudioParameterControllerInterface", "SetFloatParameter", SDK::Params::AudioParameterControllerInterface_SetFloatParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetIntArrayParameter, "AudioParameterControllerInterface", "SetIntArrayParameter", SDK::Params::AudioParameterControllerInterface_SetIntArrayParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetIntParameter, "AudioParameterControllerInterface", "SetIntParameter", SDK::Params::AudioParameterControllerInterface_SetIntParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetObjectArrayParameter, "AudioParameterControllerInterface", "SetObjectArrayParameter", SDK::Params::AudioParameterControllerInterface_SetObjectArrayParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetObjectParameter, "AudioParameterControllerInterface", "SetObjectParameter", SDK::Params::AudioParameterControllerInterface_SetObjectParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetParameters_Blueprint, "AudioParameterControllerInterface", "SetParameters_Blueprint", SDK::Params::AudioParameterControllerInterface_SetParameters_Blueprint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetStringArrayParameter, "AudioParameterControllerInterface", "SetStringArrayParameter", SDK::Params::AudioParameterControllerInterface_SetStringArrayParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetStringParameter, "AudioParameterControllerInterface", "SetStringParameter", SDK::Params::AudioParameterControllerInterface_SetStringParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioParameterControllerInterface, SetTriggerParameter, "AudioParameterControllerInterface", "SetTriggerParameter", SDK::Params::AudioParameterControllerInterface_SetTriggerParameter)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AudioLinkEngine_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AudioLinkEngine_classes.hpp"
+#include "../SDK/AudioLinkEngine_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioLinkBlueprintInterface, PlayLink, "AudioLinkBlueprintInterface", "PlayLink", SDK::Params::AudioLinkBlueprintInterface_PlayLink)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioLinkBlueprintInterface, SetLinkSound, "AudioLinkBlueprintInterface", "SetLinkSound", SDK::Params::AudioLinkBlueprintInterface_SetLinkSound)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioLinkBlueprintInterface, StopLink, "AudioLinkBlueprintInterface", "StopLink", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IAudioLinkBlueprintInterface, IsLinkPlaying, "AudioLinkBlueprintInterface", "IsLinkPlaying", SDK::Params::AudioLinkBlueprintInterface_IsLinkPlaying)
+// clang-format on
@@ -0,0 +1,123 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AudioMixer_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AudioMixer_classes.hpp"
+#include "../SDK/AudioMixer_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDynamicsProcessorPreset, ResetKey, "SubmixEffectDynamicsProcessorPreset", "ResetKey", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDynamicsProcessorPreset, SetAudioBus, "SubmixEffectDynamicsProcessorPreset", "SetAudioBus", SDK::Params::SubmixEffectDynamicsProcessorPreset_SetAudioBus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDynamicsProcessorPreset, SetExternalSubmix, "SubmixEffectDynamicsProcessorPreset", "SetExternalSubmix", SDK::Params::SubmixEffectDynamicsProcessorPreset_SetExternalSubmix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDynamicsProcessorPreset, SetSettings, "SubmixEffectDynamicsProcessorPreset", "SetSettings", SDK::Params::SubmixEffectDynamicsProcessorPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, AddMasterSubmixEffect, "AudioMixerBlueprintLibrary", "AddMasterSubmixEffect", SDK::Params::AudioMixerBlueprintLibrary_AddMasterSubmixEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, AddSourceEffectToPresetChain, "AudioMixerBlueprintLibrary", "AddSourceEffectToPresetChain", SDK::Params::AudioMixerBlueprintLibrary_AddSourceEffectToPresetChain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, AddSubmixEffect, "AudioMixerBlueprintLibrary", "AddSubmixEffect", SDK::Params::AudioMixerBlueprintLibrary_AddSubmixEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, ClearMasterSubmixEffects, "AudioMixerBlueprintLibrary", "ClearMasterSubmixEffects", SDK::Params::AudioMixerBlueprintLibrary_ClearMasterSubmixEffects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, ClearSubmixEffectChainOverride, "AudioMixerBlueprintLibrary", "ClearSubmixEffectChainOverride", SDK::Params::AudioMixerBlueprintLibrary_ClearSubmixEffectChainOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, ClearSubmixEffects, "AudioMixerBlueprintLibrary", "ClearSubmixEffects", SDK::Params::AudioMixerBlueprintLibrary_ClearSubmixEffects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, Conv_AudioOutputDeviceInfoToString, "AudioMixerBlueprintLibrary", "Conv_AudioOutputDeviceInfoToString", SDK::Params::AudioMixerBlueprintLibrary_Conv_AudioOutputDeviceInfoToString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, GetAvailableAudioOutputDevices, "AudioMixerBlueprintLibrary", "GetAvailableAudioOutputDevices", SDK::Params::AudioMixerBlueprintLibrary_GetAvailableAudioOutputDevices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, GetCurrentAudioOutputDeviceName, "AudioMixerBlueprintLibrary", "GetCurrentAudioOutputDeviceName", SDK::Params::AudioMixerBlueprintLibrary_GetCurrentAudioOutputDeviceName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, GetMagnitudeForFrequencies, "AudioMixerBlueprintLibrary", "GetMagnitudeForFrequencies", SDK::Params::AudioMixerBlueprintLibrary_GetMagnitudeForFrequencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, GetNumberOfEntriesInSourceEffectChain, "AudioMixerBlueprintLibrary", "GetNumberOfEntriesInSourceEffectChain", SDK::Params::AudioMixerBlueprintLibrary_GetNumberOfEntriesInSourceEffectChain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, GetPhaseForFrequencies, "AudioMixerBlueprintLibrary", "GetPhaseForFrequencies", SDK::Params::AudioMixerBlueprintLibrary_GetPhaseForFrequencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, IsAudioBusActive, "AudioMixerBlueprintLibrary", "IsAudioBusActive", SDK::Params::AudioMixerBlueprintLibrary_IsAudioBusActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, MakeFullSpectrumSpectralAnalysisBandSettings, "AudioMixerBlueprintLibrary", "MakeFullSpectrumSpectralAnalysisBandSettings", SDK::Params::AudioMixerBlueprintLibrary_MakeFullSpectrumSpectralAnalysisBandSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, MakeMusicalSpectralAnalysisBandSettings, "AudioMixerBlueprintLibrary", "MakeMusicalSpectralAnalysisBandSettings", SDK::Params::AudioMixerBlueprintLibrary_MakeMusicalSpectralAnalysisBandSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, MakePresetSpectralAnalysisBandSettings, "AudioMixerBlueprintLibrary", "MakePresetSpectralAnalysisBandSettings", SDK::Params::AudioMixerBlueprintLibrary_MakePresetSpectralAnalysisBandSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, PauseRecordingOutput, "AudioMixerBlueprintLibrary", "PauseRecordingOutput", SDK::Params::AudioMixerBlueprintLibrary_PauseRecordingOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, PrimeSoundCueForPlayback, "AudioMixerBlueprintLibrary", "PrimeSoundCueForPlayback", SDK::Params::AudioMixerBlueprintLibrary_PrimeSoundCueForPlayback)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, PrimeSoundForPlayback, "AudioMixerBlueprintLibrary", "PrimeSoundForPlayback", SDK::Params::AudioMixerBlueprintLibrary_PrimeSoundForPlayback)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, RegisterAudioBusToSubmix, "AudioMixerBlueprintLibrary", "RegisterAudioBusToSubmix", SDK::Params::AudioMixerBlueprintLibrary_RegisterAudioBusToSubmix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, RemoveMasterSubmixEffect, "AudioMixerBlueprintLibrary", "RemoveMasterSubmixEffect", SDK::Params::AudioMixerBlueprintLibrary_RemoveMasterSubmixEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, RemoveSourceEffectFromPresetChain, "AudioMixerBlueprintLibrary", "RemoveSourceEffectFromPresetChain", SDK::Params::AudioMixerBlueprintLibrary_RemoveSourceEffectFromPresetChain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, RemoveSubmixEffect, "AudioMixerBlueprintLibrary", "RemoveSubmixEffect", SDK::Params::AudioMixerBlueprintLibrary_RemoveSubmixEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, RemoveSubmixEffectAtIndex, "AudioMixerBlueprintLibrary", "RemoveSubmixEffectAtIndex", SDK::Params::AudioMixerBlueprintLibrary_RemoveSubmixEffectAtIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, RemoveSubmixEffectPreset, "AudioMixerBlueprintLibrary", "RemoveSubmixEffectPreset", SDK::Params::AudioMixerBlueprintLibrary_RemoveSubmixEffectPreset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, RemoveSubmixEffectPresetAtIndex, "AudioMixerBlueprintLibrary", "RemoveSubmixEffectPresetAtIndex", SDK::Params::AudioMixerBlueprintLibrary_RemoveSubmixEffectPresetAtIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, ReplaceSoundEffectSubmix, "AudioMixerBlueprintLibrary", "ReplaceSoundEffectSubmix", SDK::Params::AudioMixerBlueprintLibrary_ReplaceSoundEffectSubmix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, ReplaceSubmixEffect, "AudioMixerBlueprintLibrary", "ReplaceSubmixEffect", SDK::Params::AudioMixerBlueprintLibrary_ReplaceSubmixEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, ResumeRecordingOutput, "AudioMixerBlueprintLibrary", "ResumeRecordingOutput", SDK::Params::AudioMixerBlueprintLibrary_ResumeRecordingOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, SetBypassSourceEffectChainEntry, "AudioMixerBlueprintLibrary", "SetBypassSourceEffectChainEntry", SDK::Params::AudioMixerBlueprintLibrary_SetBypassSourceEffectChainEntry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, SetSubmixEffectChainOverride, "AudioMixerBlueprintLibrary", "SetSubmixEffectChainOverride", SDK::Params::AudioMixerBlueprintLibrary_SetSubmixEffectChainOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, StartAnalyzingOutput, "AudioMixerBlueprintLibrary", "StartAnalyzingOutput", SDK::Params::AudioMixerBlueprintLibrary_StartAnalyzingOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, StartAudioBus, "AudioMixerBlueprintLibrary", "StartAudioBus", SDK::Params::AudioMixerBlueprintLibrary_StartAudioBus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, StartRecordingOutput, "AudioMixerBlueprintLibrary", "StartRecordingOutput", SDK::Params::AudioMixerBlueprintLibrary_StartRecordingOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, StopAnalyzingOutput, "AudioMixerBlueprintLibrary", "StopAnalyzingOutput", SDK::Params::AudioMixerBlueprintLibrary_StopAnalyzingOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, StopAudioBus, "AudioMixerBlueprintLibrary", "StopAudioBus", SDK::Params::AudioMixerBlueprintLibrary_StopAudioBus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, StopRecordingOutput, "AudioMixerBlueprintLibrary", "StopRecordingOutput", SDK::Params::AudioMixerBlueprintLibrary_StopRecordingOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, SwapAudioOutputDevice, "AudioMixerBlueprintLibrary", "SwapAudioOutputDevice", SDK::Params::AudioMixerBlueprintLibrary_SwapAudioOutputDevice)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, TrimAudioCache, "AudioMixerBlueprintLibrary", "TrimAudioCache", SDK::Params::AudioMixerBlueprintLibrary_TrimAudioCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMixerBlueprintLibrary, UnregisterAudioBusFromSubmix, "AudioMixerBlueprintLibrary", "UnregisterAudioBusFromSubmix", SDK::Params::AudioMixerBlueprintLibrary_UnregisterAudioBusFromSubmix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, GetModulators, "SynthComponent", "GetModulators", SDK::Params::SynthComponent_GetModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetAudioBusSendPostEffect, "SynthComponent", "SetAudioBusSendPostEffect", SDK::Params::SynthComponent_SetAudioBusSendPostEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetAudioBusSendPreEffect, "SynthComponent", "SetAudioBusSendPreEffect", SDK::Params::SynthComponent_SetAudioBusSendPreEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetLowPassFilterEnabled, "SynthComponent", "SetLowPassFilterEnabled", SDK::Params::SynthComponent_SetLowPassFilterEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetLowPassFilterFrequency, "SynthComponent", "SetLowPassFilterFrequency", SDK::Params::SynthComponent_SetLowPassFilterFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetModulationRouting, "SynthComponent", "SetModulationRouting", SDK::Params::SynthComponent_SetModulationRouting)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetOutputToBusOnly, "SynthComponent", "SetOutputToBusOnly", SDK::Params::SynthComponent_SetOutputToBusOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetSourceBusSendPostEffect, "SynthComponent", "SetSourceBusSendPostEffect", SDK::Params::SynthComponent_SetSourceBusSendPostEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetSourceBusSendPreEffect, "SynthComponent", "SetSourceBusSendPreEffect", SDK::Params::SynthComponent_SetSourceBusSendPreEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetSubmixSend, "SynthComponent", "SetSubmixSend", SDK::Params::SynthComponent_SetSubmixSend)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, SetVolumeMultiplier, "SynthComponent", "SetVolumeMultiplier", SDK::Params::SynthComponent_SetVolumeMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, Start, "SynthComponent", "Start", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, Stop, "SynthComponent", "Stop", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, AdjustVolume, "SynthComponent", "AdjustVolume", SDK::Params::SynthComponent_AdjustVolume)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, FadeIn, "SynthComponent", "FadeIn", SDK::Params::SynthComponent_FadeIn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, FadeOut, "SynthComponent", "FadeOut", SDK::Params::SynthComponent_FadeOut)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponent, IsPlaying, "SynthComponent", "IsPlaying", SDK::Params::SynthComponent_IsPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectSubmixEQPreset, SetSettings, "SubmixEffectSubmixEQPreset", "SetSettings", SDK::Params::SubmixEffectSubmixEQPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectReverbPreset, SetSettings, "SubmixEffectReverbPreset", "SetSettings", SDK::Params::SubmixEffectReverbPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectReverbPreset, SetSettingsWithReverbEffect, "SubmixEffectReverbPreset", "SetSettingsWithReverbEffect", SDK::Params::SubmixEffectReverbPreset_SetSettingsWithReverbEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetBeatProgressPercent, "QuartzClockHandle", "GetBeatProgressPercent", SDK::Params::QuartzClockHandle_GetBeatProgressPercent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetCurrentTimestamp, "QuartzClockHandle", "GetCurrentTimestamp", SDK::Params::QuartzClockHandle_GetCurrentTimestamp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetDurationOfQuantizationTypeInSeconds, "QuartzClockHandle", "GetDurationOfQuantizationTypeInSeconds", SDK::Params::QuartzClockHandle_GetDurationOfQuantizationTypeInSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetEstimatedRunTime, "QuartzClockHandle", "GetEstimatedRunTime", SDK::Params::QuartzClockHandle_GetEstimatedRunTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, IsClockRunning, "QuartzClockHandle", "IsClockRunning", SDK::Params::QuartzClockHandle_IsClockRunning)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, NotifyOnQuantizationBoundary, "QuartzClockHandle", "NotifyOnQuantizationBoundary", SDK::Params::QuartzClockHandle_NotifyOnQuantizationBoundary)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, PauseClock, "QuartzClockHandle", "PauseClock", SDK::Params::QuartzClockHandle_PauseClock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, ResetTransport, "QuartzClockHandle", "ResetTransport", SDK::Params::QuartzClockHandle_ResetTransport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, ResetTransportQuantized, "QuartzClockHandle", "ResetTransportQuantized", SDK::Params::QuartzClockHandle_ResetTransportQuantized)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, ResumeClock, "QuartzClockHandle", "ResumeClock", SDK::Params::QuartzClockHandle_ResumeClock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, SetBeatsPerMinute, "QuartzClockHandle", "SetBeatsPerMinute", SDK::Params::QuartzClockHandle_SetBeatsPerMinute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, SetMillisecondsPerTick, "QuartzClockHandle", "SetMillisecondsPerTick", SDK::Params::QuartzClockHandle_SetMillisecondsPerTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, SetSecondsPerTick, "QuartzClockHandle", "SetSecondsPerTick", SDK::Params::QuartzClockHandle_SetSecondsPerTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, SetThirtySecondNotesPerMinute, "QuartzClockHandle", "SetThirtySecondNotesPerMinute", SDK::Params::QuartzClockHandle_SetThirtySecondNotesPerMinute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, SetTicksPerSecond, "QuartzClockHandle", "SetTicksPerSecond", SDK::Params::QuartzClockHandle_SetTicksPerSecond)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, StartClock, "QuartzClockHandle", "StartClock", SDK::Params::QuartzClockHandle_StartClock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, StartOtherClock, "QuartzClockHandle", "StartOtherClock", SDK::Params::QuartzClockHandle_StartOtherClock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, StopClock, "QuartzClockHandle", "StopClock", SDK::Params::QuartzClockHandle_StopClock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, SubscribeToAllQuantizationEvents, "QuartzClockHandle", "SubscribeToAllQuantizationEvents", SDK::Params::QuartzClockHandle_SubscribeToAllQuantizationEvents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, SubscribeToQuantizationEvent, "QuartzClockHandle", "SubscribeToQuantizationEvent", SDK::Params::QuartzClockHandle_SubscribeToQuantizationEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, UnsubscribeFromAllTimeDivisions, "QuartzClockHandle", "UnsubscribeFromAllTimeDivisions", SDK::Params::QuartzClockHandle_UnsubscribeFromAllTimeDivisions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, UnsubscribeFromTimeDivision, "QuartzClockHandle", "UnsubscribeFromTimeDivision", SDK::Params::QuartzClockHandle_UnsubscribeFromTimeDivision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetBeatsPerMinute, "QuartzClockHandle", "GetBeatsPerMinute", SDK::Params::QuartzClockHandle_GetBeatsPerMinute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetMillisecondsPerTick, "QuartzClockHandle", "GetMillisecondsPerTick", SDK::Params::QuartzClockHandle_GetMillisecondsPerTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetSecondsPerTick, "QuartzClockHandle", "GetSecondsPerTick", SDK::Params::QuartzClockHandle_GetSecondsPerTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetThirtySecondNotesPerMinute, "QuartzClockHandle", "GetThirtySecondNotesPerMinute", SDK::Params::QuartzClockHandle_GetThirtySecondNotesPerMinute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzClockHandle, GetTicksPerSecond, "QuartzClockHandle", "GetTicksPerSecond", SDK::Params::QuartzClockHandle_GetTicksPerSecond)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, CreateNewClock, "QuartzSubsystem", "CreateNewClock", SDK::Params::QuartzSubsystem_CreateNewClock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, DeleteClockByHandle, "QuartzSubsystem", "DeleteClockByHandle", SDK::Params::QuartzSubsystem_DeleteClockByHandle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, DeleteClockByName, "QuartzSubsystem", "DeleteClockByName", SDK::Params::QuartzSubsystem_DeleteClockByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, DoesClockExist, "QuartzSubsystem", "DoesClockExist", SDK::Params::QuartzSubsystem_DoesClockExist)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetAudioRenderThreadToGameThreadAverageLatency, "QuartzSubsystem", "GetAudioRenderThreadToGameThreadAverageLatency", SDK::Params::QuartzSubsystem_GetAudioRenderThreadToGameThreadAverageLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetAudioRenderThreadToGameThreadMaxLatency, "QuartzSubsystem", "GetAudioRenderThreadToGameThreadMaxLatency", SDK::Params::QuartzSubsystem_GetAudioRenderThreadToGameThreadMaxLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetAudioRenderThreadToGameThreadMinLatency, "QuartzSubsystem", "GetAudioRenderThreadToGameThreadMinLatency", SDK::Params::QuartzSubsystem_GetAudioRenderThreadToGameThreadMinLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetCurrentClockTimestamp, "QuartzSubsystem", "GetCurrentClockTimestamp", SDK::Params::QuartzSubsystem_GetCurrentClockTimestamp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetDurationOfQuantizationTypeInSeconds, "QuartzSubsystem", "GetDurationOfQuantizationTypeInSeconds", SDK::Params::QuartzSubsystem_GetDurationOfQuantizationTypeInSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetEstimatedClockRunTime, "QuartzSubsystem", "GetEstimatedClockRunTime", SDK::Params::QuartzSubsystem_GetEstimatedClockRunTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetGameThreadToAudioRenderThreadAverageLatency, "QuartzSubsystem", "GetGameThreadToAudioRenderThreadAverageLatency", SDK::Params::QuartzSubsystem_GetGameThreadToAudioRenderThreadAverageLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetGameThreadToAudioRenderThreadMaxLatency, "QuartzSubsystem", "GetGameThreadToAudioRenderThreadMaxLatency", SDK::Params::QuartzSubsystem_GetGameThreadToAudioRenderThreadMaxLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetGameThreadToAudioRenderThreadMinLatency, "QuartzSubsystem", "GetGameThreadToAudioRenderThreadMinLatency", SDK::Params::QuartzSubsystem_GetGameThreadToAudioRenderThreadMinLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetHandleForClock, "QuartzSubsystem", "GetHandleForClock", SDK::Params::QuartzSubsystem_GetHandleForClock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetRoundTripAverageLatency, "QuartzSubsystem", "GetRoundTripAverageLatency", SDK::Params::QuartzSubsystem_GetRoundTripAverageLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetRoundTripMaxLatency, "QuartzSubsystem", "GetRoundTripMaxLatency", SDK::Params::QuartzSubsystem_GetRoundTripMaxLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, GetRoundTripMinLatency, "QuartzSubsystem", "GetRoundTripMinLatency", SDK::Params::QuartzSubsystem_GetRoundTripMinLatency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, IsClockRunning, "QuartzSubsystem", "IsClockRunning", SDK::Params::QuartzSubsystem_IsClockRunning)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, IsQuartzEnabled, "QuartzSubsystem", "IsQuartzEnabled", SDK::Params::QuartzSubsystem_IsQuartzEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuartzSubsystem, SetQuartzSubsystemTickableWhenPaused, "QuartzSubsystem", "SetQuartzSubsystemTickableWhenPaused", SDK::Params::QuartzSubsystem_SetQuartzSubsystemTickableWhenPaused)
+// clang-format on
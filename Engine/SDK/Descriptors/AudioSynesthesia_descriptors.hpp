@@ -0,0 +1,24 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AudioSynesthesia_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AudioSynesthesia_classes.hpp"
+#include "../SDK/AudioSynesthesia_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstantQAnalyzer, GetCenterFrequencies, "ConstantQAnalyzer", "GetCenterFrequencies", SDK::Params::ConstantQAnalyzer_GetCenterFrequencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstantQAnalyzer, GetNumCenterFrequencies, "ConstantQAnalyzer", "GetNumCenterFrequencies", SDK::Params::ConstantQAnalyzer_GetNumCenterFrequencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstantQNRT, GetChannelConstantQAtTime, "ConstantQNRT", "GetChannelConstantQAtTime", SDK::Params::ConstantQNRT_GetChannelConstantQAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstantQNRT, GetNormalizedChannelConstantQAtTime, "ConstantQNRT", "GetNormalizedChannelConstantQAtTime", SDK::Params::ConstantQNRT_GetNormalizedChannelConstantQAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULoudnessNRT, GetChannelLoudnessAtTime, "LoudnessNRT", "GetChannelLoudnessAtTime", SDK::Params::LoudnessNRT_GetChannelLoudnessAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULoudnessNRT, GetLoudnessAtTime, "LoudnessNRT", "GetLoudnessAtTime", SDK::Params::LoudnessNRT_GetLoudnessAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULoudnessNRT, GetNormalizedChannelLoudnessAtTime, "LoudnessNRT", "GetNormalizedChannelLoudnessAtTime", SDK::Params::LoudnessNRT_GetNormalizedChannelLoudnessAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULoudnessNRT, GetNormalizedLoudnessAtTime, "LoudnessNRT", "GetNormalizedLoudnessAtTime", SDK::Params::LoudnessNRT_GetNormalizedLoudnessAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOnsetNRT, GetChannelOnsetsBetweenTimes, "OnsetNRT", "GetChannelOnsetsBetweenTimes", SDK::Params::OnsetNRT_GetChannelOnsetsBetweenTimes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOnsetNRT, GetNormalizedChannelOnsetsBetweenTimes, "OnsetNRT", "GetNormalizedChannelOnsetsBetweenTimes", SDK::Params::OnsetNRT_GetNormalizedChannelOnsetsBetweenTimes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynesthesiaSpectrumAnalyzer, GetCenterFrequencies, "SynesthesiaSpectrumAnalyzer", "GetCenterFrequencies", SDK::Params::SynesthesiaSpectrumAnalyzer_GetCenterFrequencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynesthesiaSpectrumAnalyzer, GetNumCenterFrequencies, "SynesthesiaSpectrumAnalyzer", "GetNumCenterFrequencies", SDK::Params::SynesthesiaSpectrumAnalyzer_GetNumCenterFrequencies)
+// clang-format on
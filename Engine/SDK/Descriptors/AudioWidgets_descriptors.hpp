@@ -0,0 +1,53 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AudioWidgets_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AudioWidgets_classes.hpp"
+#include "../SDK/AudioWidgets_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, SetBackgroundColor, "AudioMeter", "SetBackgroundColor", SDK::Params::AudioMeter_SetBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, SetMeterBackgroundColor, "AudioMeter", "SetMeterBackgroundColor", SDK::Params::AudioMeter_SetMeterBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, SetMeterChannelInfo, "AudioMeter", "SetMeterChannelInfo", SDK::Params::AudioMeter_SetMeterChannelInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, SetMeterClippingColor, "AudioMeter", "SetMeterClippingColor", SDK::Params::AudioMeter_SetMeterClippingColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, SetMeterPeakColor, "AudioMeter", "SetMeterPeakColor", SDK::Params::AudioMeter_SetMeterPeakColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, SetMeterScaleColor, "AudioMeter", "SetMeterScaleColor", SDK::Params::AudioMeter_SetMeterScaleColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, SetMeterScaleLabelColor, "AudioMeter", "SetMeterScaleLabelColor", SDK::Params::AudioMeter_SetMeterScaleLabelColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, SetMeterValueColor, "AudioMeter", "SetMeterValueColor", SDK::Params::AudioMeter_SetMeterValueColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioMeter, GetMeterChannelInfo, "AudioMeter", "GetMeterChannelInfo", SDK::Params::AudioMeter_GetMeterChannelInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioOscilloscope, StartProcessing, "AudioOscilloscope", "StartProcessing", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioOscilloscope, StopProcessing, "AudioOscilloscope", "StopProcessing", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, GetOutputValue, "AudioRadialSlider", "GetOutputValue", SDK::Params::AudioRadialSlider_GetOutputValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, GetSliderValue, "AudioRadialSlider", "GetSliderValue", SDK::Params::AudioRadialSlider_GetSliderValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetCenterBackgroundColor, "AudioRadialSlider", "SetCenterBackgroundColor", SDK::Params::AudioRadialSlider_SetCenterBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetHandStartEndRatio, "AudioRadialSlider", "SetHandStartEndRatio", SDK::Params::AudioRadialSlider_SetHandStartEndRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetOutputRange, "AudioRadialSlider", "SetOutputRange", SDK::Params::AudioRadialSlider_SetOutputRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetShowLabelOnlyOnHover, "AudioRadialSlider", "SetShowLabelOnlyOnHover", SDK::Params::AudioRadialSlider_SetShowLabelOnlyOnHover)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetShowUnitsText, "AudioRadialSlider", "SetShowUnitsText", SDK::Params::AudioRadialSlider_SetShowUnitsText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetSliderBarColor, "AudioRadialSlider", "SetSliderBarColor", SDK::Params::AudioRadialSlider_SetSliderBarColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetSliderProgressColor, "AudioRadialSlider", "SetSliderProgressColor", SDK::Params::AudioRadialSlider_SetSliderProgressColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetSliderThickness, "AudioRadialSlider", "SetSliderThickness", SDK::Params::AudioRadialSlider_SetSliderThickness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetTextLabelBackgroundColor, "AudioRadialSlider", "SetTextLabelBackgroundColor", SDK::Params::AudioRadialSlider_SetTextLabelBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetUnitsText, "AudioRadialSlider", "SetUnitsText", SDK::Params::AudioRadialSlider_SetUnitsText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetUnitsTextReadOnly, "AudioRadialSlider", "SetUnitsTextReadOnly", SDK::Params::AudioRadialSlider_SetUnitsTextReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetValueTextReadOnly, "AudioRadialSlider", "SetValueTextReadOnly", SDK::Params::AudioRadialSlider_SetValueTextReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioRadialSlider, SetWidgetLayout, "AudioRadialSlider", "SetWidgetLayout", SDK::Params::AudioRadialSlider_SetWidgetLayout)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, GetLinValue, "AudioSliderBase", "GetLinValue", SDK::Params::AudioSliderBase_GetLinValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, GetOutputValue, "AudioSliderBase", "GetOutputValue", SDK::Params::AudioSliderBase_GetOutputValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, GetSliderValue, "AudioSliderBase", "GetSliderValue", SDK::Params::AudioSliderBase_GetSliderValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetShowLabelOnlyOnHover, "AudioSliderBase", "SetShowLabelOnlyOnHover", SDK::Params::AudioSliderBase_SetShowLabelOnlyOnHover)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetShowUnitsText, "AudioSliderBase", "SetShowUnitsText", SDK::Params::AudioSliderBase_SetShowUnitsText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetSliderBackgroundColor, "AudioSliderBase", "SetSliderBackgroundColor", SDK::Params::AudioSliderBase_SetSliderBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetSliderBarColor, "AudioSliderBase", "SetSliderBarColor", SDK::Params::AudioSliderBase_SetSliderBarColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetSliderThumbColor, "AudioSliderBase", "SetSliderThumbColor", SDK::Params::AudioSliderBase_SetSliderThumbColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetTextLabelBackgroundColor, "AudioSliderBase", "SetTextLabelBackgroundColor", SDK::Params::AudioSliderBase_SetTextLabelBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetUnitsText, "AudioSliderBase", "SetUnitsText", SDK::Params::AudioSliderBase_SetUnitsText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetUnitsTextReadOnly, "AudioSliderBase", "SetUnitsTextReadOnly", SDK::Params::AudioSliderBase_SetUnitsTextReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetValueTextReadOnly, "AudioSliderBase", "SetValueTextReadOnly", SDK::Params::AudioSliderBase_SetValueTextReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioSliderBase, SetWidgetBackgroundColor, "AudioSliderBase", "SetWidgetBackgroundColor", SDK::Params::AudioSliderBase_SetWidgetBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioVectorscope, StartProcessing, "AudioVectorscope", "StartProcessing", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAudioVectorscope, StopProcessing, "AudioVectorscope", "StopProcessing", void)
+// clang-format on
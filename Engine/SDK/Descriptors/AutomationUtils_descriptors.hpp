@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from AutomationUtils_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/AutomationUtils_classes.hpp"
+#include "../SDK/AutomationUtils_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutomationUtilsBlueprintLibrary, TakeGameplayAutomationScreenshot, "AutomationUtilsBlueprintLibrary", "TakeGameplayAutomationScreenshot", SDK::Params::AutomationUtilsBlueprintLibrary_TakeGameplayAutomationScreenshot)
+// clang-format on
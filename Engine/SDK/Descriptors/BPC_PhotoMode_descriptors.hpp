@@ -0,0 +1,33 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPC_PhotoMode_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPC_PhotoMode_classes.hpp"
+#include "../SDK/BPC_PhotoMode_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, Calculate_Weight_by_Ref, "BPC_PhotoMode_C", "Calculate Weight by Ref", SDK::Params::BPC_PhotoMode_C_Calculate_Weight_by_Ref)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, Create_Post_Process, "BPC_PhotoMode_C", "Create Post Process", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, ExecuteUbergraph_BPC_PhotoMode, "BPC_PhotoMode_C", "ExecuteUbergraph_BPC_PhotoMode", SDK::Params::BPC_PhotoMode_C_ExecuteUbergraph_BPC_PhotoMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, Get_Active_Camera, "BPC_PhotoMode_C", "Get Active Camera", SDK::Params::BPC_PhotoMode_C_Get_Active_Camera)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, GetCameraLocation, "BPC_PhotoMode_C", "GetCameraLocation", SDK::Params::BPC_PhotoMode_C_GetCameraLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, GetCameraManager, "BPC_PhotoMode_C", "GetCameraManager", SDK::Params::BPC_PhotoMode_C_GetCameraManager)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, getScreenshotPath, "BPC_PhotoMode_C", "getScreenshotPath", SDK::Params::BPC_PhotoMode_C_getScreenshotPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, GetSliderCameraDistance, "BPC_PhotoMode_C", "GetSliderCameraDistance", SDK::Params::BPC_PhotoMode_C_GetSliderCameraDistance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, GetSliderFOV, "BPC_PhotoMode_C", "GetSliderFOV", SDK::Params::BPC_PhotoMode_C_GetSliderFOV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, GetSliderRoll, "BPC_PhotoMode_C", "GetSliderRoll", SDK::Params::BPC_PhotoMode_C_GetSliderRoll)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, IconSelector___Gallery, "BPC_PhotoMode_C", "IconSelector - Gallery", SDK::Params::BPC_PhotoMode_C_IconSelector___Gallery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, IconSelector___Photo_Mode_Menu, "BPC_PhotoMode_C", "IconSelector - Photo Mode Menu", SDK::Params::BPC_PhotoMode_C_IconSelector___Photo_Mode_Menu)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, InitWidgets, "BPC_PhotoMode_C", "InitWidgets", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, OpenGallery, "BPC_PhotoMode_C", "OpenGallery", SDK::Params::BPC_PhotoMode_C_OpenGallery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, Photo_Mode, "BPC_PhotoMode_C", "Photo Mode", SDK::Params::BPC_PhotoMode_C_Photo_Mode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, ReceiveBeginPlay, "BPC_PhotoMode_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, ResetGallery, "BPC_PhotoMode_C", "ResetGallery", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, ResetPhotoMode, "BPC_PhotoMode_C", "ResetPhotoMode", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, UnpausedGameAxisMovementControl, "BPC_PhotoMode_C", "UnpausedGameAxisMovementControl", SDK::Params::BPC_PhotoMode_C_UnpausedGameAxisMovementControl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, UpdateOutputFolder, "BPC_PhotoMode_C", "UpdateOutputFolder", SDK::Params::BPC_PhotoMode_C_UpdateOutputFolder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_PhotoMode_C, UpdateReferences, "BPC_PhotoMode_C", "UpdateReferences", SDK::Params::BPC_PhotoMode_C_UpdateReferences)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPC_RuntimeVertexPaintAndDetectionComponent_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPC_RuntimeVertexPaintAndDetectionComponent_classes.hpp"
+#include "../SDK/BPC_RuntimeVertexPaintAndDetectionComponent_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPC_RuntimeVertexPaintAndDetectionComponent_C, ExecuteUbergraph_BPC_RuntimeVertexPaintAndDetectionComponent, "BPC_RuntimeVertexPaintAndDetectionComponent_C", "ExecuteUbergraph_BPC_RuntimeVertexPaintAndDetectionComponent", SDK::Params::BPC_RuntimeVertexPaintAndDetectionComponent_C_ExecuteUbergraph_BPC_RuntimeVertexPaintAndDetectionComponent)
+// clang-format on
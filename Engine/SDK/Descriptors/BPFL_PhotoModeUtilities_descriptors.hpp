@@ -0,0 +1,28 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPFL_PhotoModeUtilities_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPFL_PhotoModeUtilities_classes.hpp"
+#include "../SDK/BPFL_PhotoModeUtilities_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, Directory_Path_Correction, "BPFL_PhotoModeUtilities_C", "Directory Path Correction", SDK::Params::BPFL_PhotoModeUtilities_C_Directory_Path_Correction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, Get_Default_Screen_Resolution, "BPFL_PhotoModeUtilities_C", "Get Default Screen Resolution", SDK::Params::BPFL_PhotoModeUtilities_C_Get_Default_Screen_Resolution)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, Get_Screenshot_File, "BPFL_PhotoModeUtilities_C", "Get Screenshot File", SDK::Params::BPFL_PhotoModeUtilities_C_Get_Screenshot_File)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, GetAllImersedPostProcess, "BPFL_PhotoModeUtilities_C", "GetAllImersedPostProcess", SDK::Params::BPFL_PhotoModeUtilities_C_GetAllImersedPostProcess)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, Hide_HUD_When_Using_Photo_Mode, "BPFL_PhotoModeUtilities_C", "Hide HUD When Using Photo Mode", SDK::Params::BPFL_PhotoModeUtilities_C_Hide_HUD_When_Using_Photo_Mode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, HighResScreenshot__without_UI_, "BPFL_PhotoModeUtilities_C", "HighResScreenshot (without UI)", SDK::Params::BPFL_PhotoModeUtilities_C_HighResScreenshot__without_UI_)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, isGalleryOpened, "BPFL_PhotoModeUtilities_C", "isGalleryOpened", SDK::Params::BPFL_PhotoModeUtilities_C_isGalleryOpened)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, isPhotoModeOpened, "BPFL_PhotoModeUtilities_C", "isPhotoModeOpened", SDK::Params::BPFL_PhotoModeUtilities_C_isPhotoModeOpened)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, isPhotoModeOrGalleryOpened, "BPFL_PhotoModeUtilities_C", "isPhotoModeOrGalleryOpened", SDK::Params::BPFL_PhotoModeUtilities_C_isPhotoModeOrGalleryOpened)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, LoadPhotos, "BPFL_PhotoModeUtilities_C", "LoadPhotos", SDK::Params::BPFL_PhotoModeUtilities_C_LoadPhotos)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, MakeThumbnail, "BPFL_PhotoModeUtilities_C", "MakeThumbnail", SDK::Params::BPFL_PhotoModeUtilities_C_MakeThumbnail)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, Nearest_Distance_To_Box_With_Transform, "BPFL_PhotoModeUtilities_C", "Nearest Distance To Box With Transform", SDK::Params::BPFL_PhotoModeUtilities_C_Nearest_Distance_To_Box_With_Transform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, NormalizeScreenshotPath, "BPFL_PhotoModeUtilities_C", "NormalizeScreenshotPath", SDK::Params::BPFL_PhotoModeUtilities_C_NormalizeScreenshotPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, SaveAllPhotos, "BPFL_PhotoModeUtilities_C", "SaveAllPhotos", SDK::Params::BPFL_PhotoModeUtilities_C_SaveAllPhotos)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, SavePhoto, "BPFL_PhotoModeUtilities_C", "SavePhoto", SDK::Params::BPFL_PhotoModeUtilities_C_SavePhoto)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBPFL_PhotoModeUtilities_C, Screenshot__with_UI_, "BPFL_PhotoModeUtilities_C", "Screenshot (with UI)", SDK::Params::BPFL_PhotoModeUtilities_C_Screenshot__with_UI_)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_ApplySettings_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_ApplySettings_classes.hpp"
+#include "../SDK/BPI_ApplySettings_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_ApplySettings_C, Apply_Settings, "BPI_ApplySettings_C", "Apply Settings", SDK::Params::BPI_ApplySettings_C_Apply_Settings)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_CanParry_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_CanParry_classes.hpp"
+#include "../SDK/BPI_CanParry_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_CanParry_C, Send_Threat_Location_R, "BPI_CanParry_C", "Send Threat Location R", SDK::Params::BPI_CanParry_C_Send_Threat_Location_R)
+// clang-format on
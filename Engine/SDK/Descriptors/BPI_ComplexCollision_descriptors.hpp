@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_ComplexCollision_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_ComplexCollision_classes.hpp"
+#include "../SDK/BPI_ComplexCollision_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_ComplexCollision_C, Deal_Complex_Damage, "BPI_ComplexCollision_C", "Deal Complex Damage", SDK::Params::BPI_ComplexCollision_C_Deal_Complex_Damage)
+// clang-format on
@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_Data_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_Data_classes.hpp"
+#include "../SDK/BPI_Data_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_Data_C, SendPhotoData, "BPI_Data_C", "SendPhotoData", SDK::Params::BPI_Data_C_SendPhotoData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_Data_C, TabToOpen, "BPI_Data_C", "TabToOpen", SDK::Params::BPI_Data_C_TabToOpen)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_Dismember_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_Dismember_classes.hpp"
+#include "../SDK/BPI_Dismember_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_Dismember_C, Dismember_Cut, "BPI_Dismember_C", "Dismember Cut", SDK::Params::BPI_Dismember_C_Dismember_Cut)
+// clang-format on
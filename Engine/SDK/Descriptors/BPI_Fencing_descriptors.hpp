@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_Fencing_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_Fencing_classes.hpp"
+#include "../SDK/BPI_Fencing_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_Fencing_C, StopThatBlade, "BPI_Fencing_C", "StopThatBlade", SDK::Params::BPI_Fencing_C_StopThatBlade)
+// clang-format on
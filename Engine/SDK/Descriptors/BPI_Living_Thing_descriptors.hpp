@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_Living_Thing_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_Living_Thing_classes.hpp"
+#include "../SDK/BPI_Living_Thing_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_Living_Thing_C, Attach_Decal, "BPI_Living_Thing_C", "Attach Decal", SDK::Params::BPI_Living_Thing_C_Attach_Decal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_Living_Thing_C, Get_Damage, "BPI_Living_Thing_C", "Get Damage", SDK::Params::BPI_Living_Thing_C_Get_Damage)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_VertexPaint_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_VertexPaint_classes.hpp"
+#include "../SDK/BPI_VertexPaint_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_VertexPaint_C, Box_Vertex_Paint, "BPI_VertexPaint_C", "Box Vertex Paint", SDK::Params::BPI_VertexPaint_C_Box_Vertex_Paint)
+// clang-format on
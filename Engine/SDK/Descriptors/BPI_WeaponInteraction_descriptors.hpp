@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BPI_WeaponInteraction_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BPI_WeaponInteraction_classes.hpp"
+#include "../SDK/BPI_WeaponInteraction_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IBPI_WeaponInteraction_C, Weapon_HIt, "BPI_WeaponInteraction_C", "Weapon HIt", SDK::Params::BPI_WeaponInteraction_C_Weapon_HIt)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Armor_Body_Brestplate_A_T2_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Armor_Body_Brestplate_A_T2_classes.hpp"
+#include "../SDK/BP_Armor_Body_Brestplate_A_T2_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Body_Brestplate_A_T2_C, ExecuteUbergraph_BP_Armor_Body_Brestplate_A_T2, "BP_Armor_Body_Brestplate_A_T2_C", "ExecuteUbergraph_BP_Armor_Body_Brestplate_A_T2", SDK::Params::BP_Armor_Body_Brestplate_A_T2_C_ExecuteUbergraph_BP_Armor_Body_Brestplate_A_T2)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Body_Brestplate_A_T2_C, ReceiveBeginPlay, "BP_Armor_Body_Brestplate_A_T2_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Body_Brestplate_A_T2_C, ReceiveTick, "BP_Armor_Body_Brestplate_A_T2_C", "ReceiveTick", SDK::Params::BP_Armor_Body_Brestplate_A_T2_C_ReceiveTick)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Armor_Legs_Hosen_Arming_A_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Armor_Legs_Hosen_Arming_A_classes.hpp"
+#include "../SDK/BP_Armor_Legs_Hosen_Arming_A_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Legs_Hosen_Arming_A_C, UserConstructionScript, "BP_Armor_Legs_Hosen_Arming_A_C", "UserConstructionScript", void)
+// clang-format on
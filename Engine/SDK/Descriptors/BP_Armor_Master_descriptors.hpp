@@ -0,0 +1,18 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Armor_Master_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Armor_Master_classes.hpp"
+#include "../SDK/BP_Armor_Master_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Master_C, BndEvt__BP_Armor_Master_Armor_Mesh_Static_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "BP_Armor_Master_C", "BndEvt__BP_Armor_Master_Armor Mesh Static_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Armor_Master_C_BndEvt__BP_Armor_Master_Armor_Mesh_Static_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Master_C, BndEvt__BP_Armor_Master_Armor_Mesh_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "BP_Armor_Master_C", "BndEvt__BP_Armor_Master_Armor Mesh_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Armor_Master_C_BndEvt__BP_Armor_Master_Armor_Mesh_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Master_C, ExecuteUbergraph_BP_Armor_Master, "BP_Armor_Master_C", "ExecuteUbergraph_BP_Armor_Master", SDK::Params::BP_Armor_Master_C_ExecuteUbergraph_BP_Armor_Master)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Master_C, ReceiveBeginPlay, "BP_Armor_Master_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Master_C, ReceiveTick, "BP_Armor_Master_C", "ReceiveTick", SDK::Params::BP_Armor_Master_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Armor_Master_C, UserConstructionScript, "BP_Armor_Master_C", "UserConstructionScript", void)
+// clang-format on
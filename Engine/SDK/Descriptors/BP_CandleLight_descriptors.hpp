@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_CandleLight_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_CandleLight_classes.hpp"
+#include "../SDK/BP_CandleLight_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CandleLight_C, ExecuteUbergraph_BP_CandleLight, "BP_CandleLight_C", "ExecuteUbergraph_BP_CandleLight", SDK::Params::BP_CandleLight_C_ExecuteUbergraph_BP_CandleLight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CandleLight_C, ReceiveBeginPlay, "BP_CandleLight_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CandleLight_C, Timeline__FinishedFunc, "BP_CandleLight_C", "Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CandleLight_C, Timeline__UpdateFunc, "BP_CandleLight_C", "Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CandleLight_C, UserConstructionScript, "BP_CandleLight_C", "UserConstructionScript", void)
+// clang-format on
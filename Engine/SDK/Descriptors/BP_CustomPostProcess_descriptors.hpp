@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_CustomPostProcess_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_CustomPostProcess_classes.hpp"
+#include "../SDK/BP_CustomPostProcess_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CustomPostProcess_C, ExecuteUbergraph_BP_CustomPostProcess, "BP_CustomPostProcess_C", "ExecuteUbergraph_BP_CustomPostProcess", SDK::Params::BP_CustomPostProcess_C_ExecuteUbergraph_BP_CustomPostProcess)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CustomPostProcess_C, getPostProcess, "BP_CustomPostProcess_C", "getPostProcess", SDK::Params::BP_CustomPostProcess_C_getPostProcess)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CustomPostProcess_C, UpdatePostProcess, "BP_CustomPostProcess_C", "UpdatePostProcess", SDK::Params::BP_CustomPostProcess_C_UpdatePostProcess)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_CustomPostProcess_C, UserConstructionScript, "BP_CustomPostProcess_C", "UserConstructionScript", void)
+// clang-format on
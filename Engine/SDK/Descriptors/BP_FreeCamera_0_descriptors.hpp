@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_FreeCamera_0_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_FreeCamera_0_classes.hpp"
+#include "../SDK/BP_FreeCamera_0_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_FreeCamera_C, ExecuteUbergraph_BP_FreeCamera, "BP_FreeCamera_C", "ExecuteUbergraph_BP_FreeCamera", SDK::Params::BP_FreeCamera_C_ExecuteUbergraph_BP_FreeCamera)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_FreeCamera_C, ReceiveBeginPlay, "BP_FreeCamera_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_FreeCamera_C, ReceiveTick, "BP_FreeCamera_C", "ReceiveTick", SDK::Params::BP_FreeCamera_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_FreeCamera_C, UserConstructionScript, "BP_FreeCamera_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,30 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_HalfSwordGameMode_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_HalfSwordGameMode_classes.hpp"
+#include "../SDK/BP_HalfSwordGameMode_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, Abyss_Starts, "BP_HalfSwordGameMode_C", "Abyss Starts", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, Add_Rank_Points, "BP_HalfSwordGameMode_C", "Add Rank Points", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, Clear_Save_Game_Event, "BP_HalfSwordGameMode_C", "Clear Save Game Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, DED, "BP_HalfSwordGameMode_C", "DED", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, ExecuteUbergraph_BP_HalfSwordGameMode, "BP_HalfSwordGameMode_C", "ExecuteUbergraph_BP_HalfSwordGameMode", SDK::Params::BP_HalfSwordGameMode_C_ExecuteUbergraph_BP_HalfSwordGameMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, GM_CT, "BP_HalfSwordGameMode_C", "GM CT", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, GM_Duel, "BP_HalfSwordGameMode_C", "GM Duel", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, GM_FFA, "BP_HalfSwordGameMode_C", "GM FFA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, GM_OVA, "BP_HalfSwordGameMode_C", "GM OVA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, GM_TDM, "BP_HalfSwordGameMode_C", "GM TDM", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, Load_Game_Event, "BP_HalfSwordGameMode_C", "Load Game Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, Minus_Enemy, "BP_HalfSwordGameMode_C", "Minus Enemy", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, OnAudioFinished_Event, "BP_HalfSwordGameMode_C", "OnAudioFinished_Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, ReceiveBeginPlay, "BP_HalfSwordGameMode_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, ReceiveTick, "BP_HalfSwordGameMode_C", "ReceiveTick", SDK::Params::BP_HalfSwordGameMode_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, Restart_Music, "BP_HalfSwordGameMode_C", "Restart Music", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, Save_Game_Event, "BP_HalfSwordGameMode_C", "Save Game Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_HalfSwordGameMode_C, UserConstructionScript, "BP_HalfSwordGameMode_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Prop_Training_Dummy_001_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Prop_Training_Dummy_001_classes.hpp"
+#include "../SDK/BP_Prop_Training_Dummy_001_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Prop_Training_Dummy_001_C, BndEvt__Barrel_BP_SM_Barrel_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "BP_Prop_Training_Dummy_001_C", "BndEvt__Barrel_BP_SM_Barrel_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Prop_Training_Dummy_001_C_BndEvt__Barrel_BP_SM_Barrel_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Prop_Training_Dummy_001_C, ExecuteUbergraph_BP_Prop_Training_Dummy_001, "BP_Prop_Training_Dummy_001_C", "ExecuteUbergraph_BP_Prop_Training_Dummy_001", SDK::Params::BP_Prop_Training_Dummy_001_C_ExecuteUbergraph_BP_Prop_Training_Dummy_001)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_ScreenshotManager_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_ScreenshotManager_classes.hpp"
+#include "../SDK/BP_ScreenshotManager_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_ScreenshotManager_C, ExecuteUbergraph_BP_ScreenshotManager, "BP_ScreenshotManager_C", "ExecuteUbergraph_BP_ScreenshotManager", SDK::Params::BP_ScreenshotManager_C_ExecuteUbergraph_BP_ScreenshotManager)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_ScreenshotManager_C, ReceiveTick, "BP_ScreenshotManager_C", "ReceiveTick", SDK::Params::BP_ScreenshotManager_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_ScreenshotManager_C, TakeScreenshot, "BP_ScreenshotManager_C", "TakeScreenshot", SDK::Params::BP_ScreenshotManager_C_TakeScreenshot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_ScreenshotManager_C, UserConstructionScript, "BP_ScreenshotManager_C", "UserConstructionScript", void)
+// clang-format on
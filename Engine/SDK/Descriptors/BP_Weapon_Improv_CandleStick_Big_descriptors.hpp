@@ -0,0 +1,18 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Weapon_Improv_CandleStick_Big_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Weapon_Improv_CandleStick_Big_classes.hpp"
+#include "../SDK/BP_Weapon_Improv_CandleStick_Big_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Big_C, BndEvt__BP_Weapon_Improv_CandleStick_Big_Candle_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "BP_Weapon_Improv_CandleStick_Big_C", "BndEvt__BP_Weapon_Improv_CandleStick_Big_Candle_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Weapon_Improv_CandleStick_Big_C_BndEvt__BP_Weapon_Improv_CandleStick_Big_Candle_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Big_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "BP_Weapon_Improv_CandleStick_Big_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Weapon_Improv_CandleStick_Big_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Big_C, ExecuteUbergraph_BP_Weapon_Improv_CandleStick_Big, "BP_Weapon_Improv_CandleStick_Big_C", "ExecuteUbergraph_BP_Weapon_Improv_CandleStick_Big", SDK::Params::BP_Weapon_Improv_CandleStick_Big_C_ExecuteUbergraph_BP_Weapon_Improv_CandleStick_Big)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Big_C, ReceiveBeginPlay, "BP_Weapon_Improv_CandleStick_Big_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Big_C, ReceiveTick, "BP_Weapon_Improv_CandleStick_Big_C", "ReceiveTick", SDK::Params::BP_Weapon_Improv_CandleStick_Big_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Big_C, UserConstructionScript, "BP_Weapon_Improv_CandleStick_Big_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Weapon_Improv_CandleStick_Small_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Weapon_Improv_CandleStick_Small_classes.hpp"
+#include "../SDK/BP_Weapon_Improv_CandleStick_Small_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Small_C, BndEvt__BP_Weapon_Improv_CandleStick_Big_Candle_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "BP_Weapon_Improv_CandleStick_Small_C", "BndEvt__BP_Weapon_Improv_CandleStick_Big_Candle_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Weapon_Improv_CandleStick_Small_C_BndEvt__BP_Weapon_Improv_CandleStick_Big_Candle_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Small_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "BP_Weapon_Improv_CandleStick_Small_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Weapon_Improv_CandleStick_Small_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Small_C, ExecuteUbergraph_BP_Weapon_Improv_CandleStick_Small, "BP_Weapon_Improv_CandleStick_Small_C", "ExecuteUbergraph_BP_Weapon_Improv_CandleStick_Small", SDK::Params::BP_Weapon_Improv_CandleStick_Small_C_ExecuteUbergraph_BP_Weapon_Improv_CandleStick_Small)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Small_C, ReceiveBeginPlay, "BP_Weapon_Improv_CandleStick_Small_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Improv_CandleStick_Small_C, UserConstructionScript, "BP_Weapon_Improv_CandleStick_Small_C", "UserConstructionScript", void)
+// clang-format on
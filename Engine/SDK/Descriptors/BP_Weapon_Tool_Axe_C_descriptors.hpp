@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Weapon_Tool_Axe_C_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Weapon_Tool_Axe_C_classes.hpp"
+#include "../SDK/BP_Weapon_Tool_Axe_C_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Axe_C_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "BP_Weapon_Tool_Axe_C_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Weapon_Tool_Axe_C_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Axe_C_C, ExecuteUbergraph_BP_Weapon_Tool_Axe_C, "BP_Weapon_Tool_Axe_C_C", "ExecuteUbergraph_BP_Weapon_Tool_Axe_C", SDK::Params::BP_Weapon_Tool_Axe_C_C_ExecuteUbergraph_BP_Weapon_Tool_Axe_C)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Axe_C_C, UserConstructionScript, "BP_Weapon_Tool_Axe_C_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Weapon_Tool_Knife_A_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Weapon_Tool_Knife_A_classes.hpp"
+#include "../SDK/BP_Weapon_Tool_Knife_A_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Knife_A_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "BP_Weapon_Tool_Knife_A_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Weapon_Tool_Knife_A_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Knife_A_C, ExecuteUbergraph_BP_Weapon_Tool_Knife_A, "BP_Weapon_Tool_Knife_A_C", "ExecuteUbergraph_BP_Weapon_Tool_Knife_A", SDK::Params::BP_Weapon_Tool_Knife_A_C_ExecuteUbergraph_BP_Weapon_Tool_Knife_A)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Knife_A_C, ReceiveBeginPlay, "BP_Weapon_Tool_Knife_A_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Knife_A_C, UserConstructionScript, "BP_Weapon_Tool_Knife_A_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Weapon_Tool_Scissors_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Weapon_Tool_Scissors_classes.hpp"
+#include "../SDK/BP_Weapon_Tool_Scissors_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Scissors_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "BP_Weapon_Tool_Scissors_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Weapon_Tool_Scissors_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Scissors_C, ExecuteUbergraph_BP_Weapon_Tool_Scissors, "BP_Weapon_Tool_Scissors_C", "ExecuteUbergraph_BP_Weapon_Tool_Scissors", SDK::Params::BP_Weapon_Tool_Scissors_C_ExecuteUbergraph_BP_Weapon_Tool_Scissors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Scissors_C, ReceiveBeginPlay, "BP_Weapon_Tool_Scissors_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Scissors_C, UserConstructionScript, "BP_Weapon_Tool_Scissors_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from BP_Weapon_Tool_Sickle_D_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/BP_Weapon_Tool_Sickle_D_classes.hpp"
+#include "../SDK/BP_Weapon_Tool_Sickle_D_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Sickle_D_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "BP_Weapon_Tool_Sickle_D_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::BP_Weapon_Tool_Sickle_D_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Sickle_D_C, ExecuteUbergraph_BP_Weapon_Tool_Sickle_D, "BP_Weapon_Tool_Sickle_D_C", "ExecuteUbergraph_BP_Weapon_Tool_Sickle_D", SDK::Params::BP_Weapon_Tool_Sickle_D_C_ExecuteUbergraph_BP_Weapon_Tool_Sickle_D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABP_Weapon_Tool_Sickle_D_C, UserConstructionScript, "BP_Weapon_Tool_Sickle_D_C", "UserConstructionScript", void)
+// clang-format on
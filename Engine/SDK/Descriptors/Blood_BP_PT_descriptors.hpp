@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Blood_BP_PT_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Blood_BP_PT_classes.hpp"
+#include "../SDK/Blood_BP_PT_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABlood_BP_PT_C, BndEvt__Willie_BP_BPC_RuntimeVertexPaintAndDetectionComponent_K2Node_ComponentBoundEvent_2_VertexColorGetClosestVertexData__DelegateSignature, "Blood_BP_PT_C", "BndEvt__Willie_BP_BPC_RuntimeVertexPaintAndDetectionComponent_K2Node_ComponentBoundEvent_2_VertexColorGetClosestVertexData__DelegateSignature", SDK::Params::Blood_BP_PT_C_BndEvt__Willie_BP_BPC_RuntimeVertexPaintAndDetectionComponent_K2Node_ComponentBoundEvent_2_VertexColorGetClosestVertexData__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABlood_BP_PT_C, ExecuteUbergraph_Blood_BP_PT, "Blood_BP_PT_C", "ExecuteUbergraph_Blood_BP_PT", SDK::Params::Blood_BP_PT_C_ExecuteUbergraph_Blood_BP_PT)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABlood_BP_PT_C, Get_Vertex_Color_On_Surface_Event, "Blood_BP_PT_C", "Get Vertex Color On Surface Event", SDK::Params::Blood_BP_PT_C_Get_Vertex_Color_On_Surface_Event)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABlood_BP_PT_C, ReceiveBeginPlay, "Blood_BP_PT_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABlood_BP_PT_C, ReceiveParticleData, "Blood_BP_PT_C", "ReceiveParticleData", SDK::Params::Blood_BP_PT_C_ReceiveParticleData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABlood_BP_PT_C, ReceiveTick, "Blood_BP_PT_C", "ReceiveTick", SDK::Params::Blood_BP_PT_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ABlood_BP_PT_C, UserConstructionScript, "Blood_BP_PT_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from CableComponent_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/CableComponent_classes.hpp"
+#include "../SDK/CableComponent_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCableComponent, SetAttachEndTo, "CableComponent", "SetAttachEndTo", SDK::Params::CableComponent_SetAttachEndTo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCableComponent, SetAttachEndToComponent, "CableComponent", "SetAttachEndToComponent", SDK::Params::CableComponent_SetAttachEndToComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCableComponent, GetAttachedActor, "CableComponent", "GetAttachedActor", SDK::Params::CableComponent_GetAttachedActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCableComponent, GetAttachedComponent, "CableComponent", "GetAttachedComponent", SDK::Params::CableComponent_GetAttachedComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCableComponent, GetCableParticleLocations, "CableComponent", "GetCableParticleLocations", SDK::Params::CableComponent_GetCableParticleLocations)
+// clang-format on
@@ -0,0 +1,22 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ChaosCaching_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ChaosCaching_classes.hpp"
+#include "../SDK/ChaosCaching_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, EnablePlayback, "ChaosCacheManager", "EnablePlayback", SDK::Params::ChaosCacheManager_EnablePlayback)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, EnablePlaybackByCache, "ChaosCacheManager", "EnablePlaybackByCache", SDK::Params::ChaosCacheManager_EnablePlaybackByCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, ResetAllComponentTransforms, "ChaosCacheManager", "ResetAllComponentTransforms", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, ResetSingleTransform, "ChaosCacheManager", "ResetSingleTransform", SDK::Params::ChaosCacheManager_ResetSingleTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, SetCacheCollection, "ChaosCacheManager", "SetCacheCollection", SDK::Params::ChaosCacheManager_SetCacheCollection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, SetCurrentTime, "ChaosCacheManager", "SetCurrentTime", SDK::Params::ChaosCacheManager_SetCurrentTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, SetStartTime, "ChaosCacheManager", "SetStartTime", SDK::Params::ChaosCacheManager_SetStartTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, TriggerAll, "ChaosCacheManager", "TriggerAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, TriggerComponent, "ChaosCacheManager", "TriggerComponent", SDK::Params::ChaosCacheManager_TriggerComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosCacheManager, TriggerComponentByCache, "ChaosCacheManager", "TriggerComponentByCache", SDK::Params::ChaosCacheManager_TriggerComponentByCache)
+// clang-format on
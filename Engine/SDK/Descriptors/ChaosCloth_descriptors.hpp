@@ -0,0 +1,27 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ChaosCloth_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ChaosCloth_classes.hpp"
+#include "../SDK/ChaosCloth_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, ResetAndTeleport, "ChaosClothingInteractor", "ResetAndTeleport", SDK::Params::ChaosClothingInteractor_ResetAndTeleport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetAerodynamics, "ChaosClothingInteractor", "SetAerodynamics", SDK::Params::ChaosClothingInteractor_SetAerodynamics)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetAnimDrive, "ChaosClothingInteractor", "SetAnimDrive", SDK::Params::ChaosClothingInteractor_SetAnimDrive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetAnimDriveLinear, "ChaosClothingInteractor", "SetAnimDriveLinear", SDK::Params::ChaosClothingInteractor_SetAnimDriveLinear)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetBackstop, "ChaosClothingInteractor", "SetBackstop", SDK::Params::ChaosClothingInteractor_SetBackstop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetCollision, "ChaosClothingInteractor", "SetCollision", SDK::Params::ChaosClothingInteractor_SetCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetDamping, "ChaosClothingInteractor", "SetDamping", SDK::Params::ChaosClothingInteractor_SetDamping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetGravity, "ChaosClothingInteractor", "SetGravity", SDK::Params::ChaosClothingInteractor_SetGravity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetLongRangeAttachment, "ChaosClothingInteractor", "SetLongRangeAttachment", SDK::Params::ChaosClothingInteractor_SetLongRangeAttachment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetLongRangeAttachmentLinear, "ChaosClothingInteractor", "SetLongRangeAttachmentLinear", SDK::Params::ChaosClothingInteractor_SetLongRangeAttachmentLinear)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetMaterial, "ChaosClothingInteractor", "SetMaterial", SDK::Params::ChaosClothingInteractor_SetMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetMaterialLinear, "ChaosClothingInteractor", "SetMaterialLinear", SDK::Params::ChaosClothingInteractor_SetMaterialLinear)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetPressure, "ChaosClothingInteractor", "SetPressure", SDK::Params::ChaosClothingInteractor_SetPressure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetVelocityScale, "ChaosClothingInteractor", "SetVelocityScale", SDK::Params::ChaosClothingInteractor_SetVelocityScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosClothingInteractor, SetWind, "ChaosClothingInteractor", "SetWind", SDK::Params::ChaosClothingInteractor_SetWind)
+// clang-format on
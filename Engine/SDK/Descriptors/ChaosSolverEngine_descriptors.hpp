@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ChaosSolverEngine_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ChaosSolverEngine_classes.hpp"
+#include "../SDK/ChaosSolverEngine_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosSolverEngineBlueprintLibrary, ConvertPhysicsCollisionToHitResult, "ChaosSolverEngineBlueprintLibrary", "ConvertPhysicsCollisionToHitResult", SDK::Params::ChaosSolverEngineBlueprintLibrary_ConvertPhysicsCollisionToHitResult)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosSolverActor, SetAsCurrentWorldSolver, "ChaosSolverActor", "SetAsCurrentWorldSolver", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AChaosSolverActor, SetSolverActive, "ChaosSolverActor", "SetSolverActive", SDK::Params::ChaosSolverActor_SetSolverActive)
+// clang-format on
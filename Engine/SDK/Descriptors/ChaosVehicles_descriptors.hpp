@@ -0,0 +1,87 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ChaosVehicles_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ChaosVehicles_classes.hpp"
+#include "../SDK/ChaosVehicles_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, DecreaseThrottleInput, "ChaosVehicleMovementComponent", "DecreaseThrottleInput", SDK::Params::ChaosVehicleMovementComponent_DecreaseThrottleInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, EnableSelfRighting, "ChaosVehicleMovementComponent", "EnableSelfRighting", SDK::Params::ChaosVehicleMovementComponent_EnableSelfRighting)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetBrakeInput, "ChaosVehicleMovementComponent", "GetBrakeInput", SDK::Params::ChaosVehicleMovementComponent_GetBrakeInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetSteeringInput, "ChaosVehicleMovementComponent", "GetSteeringInput", SDK::Params::ChaosVehicleMovementComponent_GetSteeringInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetThrottleInput, "ChaosVehicleMovementComponent", "GetThrottleInput", SDK::Params::ChaosVehicleMovementComponent_GetThrottleInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, IncreaseThrottleInput, "ChaosVehicleMovementComponent", "IncreaseThrottleInput", SDK::Params::ChaosVehicleMovementComponent_IncreaseThrottleInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, ResetVehicle, "ChaosVehicleMovementComponent", "ResetVehicle", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, ServerUpdateState, "ChaosVehicleMovementComponent", "ServerUpdateState", SDK::Params::ChaosVehicleMovementComponent_ServerUpdateState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetBrakeInput, "ChaosVehicleMovementComponent", "SetBrakeInput", SDK::Params::ChaosVehicleMovementComponent_SetBrakeInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetChangeDownInput, "ChaosVehicleMovementComponent", "SetChangeDownInput", SDK::Params::ChaosVehicleMovementComponent_SetChangeDownInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetChangeUpInput, "ChaosVehicleMovementComponent", "SetChangeUpInput", SDK::Params::ChaosVehicleMovementComponent_SetChangeUpInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetHandbrakeInput, "ChaosVehicleMovementComponent", "SetHandbrakeInput", SDK::Params::ChaosVehicleMovementComponent_SetHandbrakeInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetParked, "ChaosVehicleMovementComponent", "SetParked", SDK::Params::ChaosVehicleMovementComponent_SetParked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetPitchInput, "ChaosVehicleMovementComponent", "SetPitchInput", SDK::Params::ChaosVehicleMovementComponent_SetPitchInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetRequiresControllerForInputs, "ChaosVehicleMovementComponent", "SetRequiresControllerForInputs", SDK::Params::ChaosVehicleMovementComponent_SetRequiresControllerForInputs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetRollInput, "ChaosVehicleMovementComponent", "SetRollInput", SDK::Params::ChaosVehicleMovementComponent_SetRollInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetSleeping, "ChaosVehicleMovementComponent", "SetSleeping", SDK::Params::ChaosVehicleMovementComponent_SetSleeping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetSteeringInput, "ChaosVehicleMovementComponent", "SetSteeringInput", SDK::Params::ChaosVehicleMovementComponent_SetSteeringInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetTargetGear, "ChaosVehicleMovementComponent", "SetTargetGear", SDK::Params::ChaosVehicleMovementComponent_SetTargetGear)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetThrottleInput, "ChaosVehicleMovementComponent", "SetThrottleInput", SDK::Params::ChaosVehicleMovementComponent_SetThrottleInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetUseAutomaticGears, "ChaosVehicleMovementComponent", "SetUseAutomaticGears", SDK::Params::ChaosVehicleMovementComponent_SetUseAutomaticGears)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, SetYawInput, "ChaosVehicleMovementComponent", "SetYawInput", SDK::Params::ChaosVehicleMovementComponent_SetYawInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetCurrentGear, "ChaosVehicleMovementComponent", "GetCurrentGear", SDK::Params::ChaosVehicleMovementComponent_GetCurrentGear)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetForwardSpeed, "ChaosVehicleMovementComponent", "GetForwardSpeed", SDK::Params::ChaosVehicleMovementComponent_GetForwardSpeed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetForwardSpeedMPH, "ChaosVehicleMovementComponent", "GetForwardSpeedMPH", SDK::Params::ChaosVehicleMovementComponent_GetForwardSpeedMPH)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetHandbrakeInput, "ChaosVehicleMovementComponent", "GetHandbrakeInput", SDK::Params::ChaosVehicleMovementComponent_GetHandbrakeInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetTargetGear, "ChaosVehicleMovementComponent", "GetTargetGear", SDK::Params::ChaosVehicleMovementComponent_GetTargetGear)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, GetUseAutoGears, "ChaosVehicleMovementComponent", "GetUseAutoGears", SDK::Params::ChaosVehicleMovementComponent_GetUseAutoGears)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleMovementComponent, IsParked, "ChaosVehicleMovementComponent", "IsParked", SDK::Params::ChaosVehicleMovementComponent_IsParked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, GetAxleType, "ChaosVehicleWheel", "GetAxleType", SDK::Params::ChaosVehicleWheel_GetAxleType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, GetRotationAngle, "ChaosVehicleWheel", "GetRotationAngle", SDK::Params::ChaosVehicleWheel_GetRotationAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, GetRotationAngularVelocity, "ChaosVehicleWheel", "GetRotationAngularVelocity", SDK::Params::ChaosVehicleWheel_GetRotationAngularVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, GetSteerAngle, "ChaosVehicleWheel", "GetSteerAngle", SDK::Params::ChaosVehicleWheel_GetSteerAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, GetSuspensionAxis, "ChaosVehicleWheel", "GetSuspensionAxis", SDK::Params::ChaosVehicleWheel_GetSuspensionAxis)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, GetSuspensionOffset, "ChaosVehicleWheel", "GetSuspensionOffset", SDK::Params::ChaosVehicleWheel_GetSuspensionOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, GetWheelAngularVelocity, "ChaosVehicleWheel", "GetWheelAngularVelocity", SDK::Params::ChaosVehicleWheel_GetWheelAngularVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, GetWheelRadius, "ChaosVehicleWheel", "GetWheelRadius", SDK::Params::ChaosVehicleWheel_GetWheelRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosVehicleWheel, IsInAir, "ChaosVehicleWheel", "IsInAir", SDK::Params::ChaosVehicleWheel_IsInAir)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, BreakWheeledSnapshot, "ChaosWheeledVehicleMovementComponent", "BreakWheeledSnapshot", SDK::Params::ChaosWheeledVehicleMovementComponent_BreakWheeledSnapshot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, BreakWheelSnapshot, "ChaosWheeledVehicleMovementComponent", "BreakWheelSnapshot", SDK::Params::ChaosWheeledVehicleMovementComponent_BreakWheelSnapshot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, BreakWheelStatus, "ChaosWheeledVehicleMovementComponent", "BreakWheelStatus", SDK::Params::ChaosWheeledVehicleMovementComponent_BreakWheelStatus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, MakeWheeledSnapshot, "ChaosWheeledVehicleMovementComponent", "MakeWheeledSnapshot", SDK::Params::ChaosWheeledVehicleMovementComponent_MakeWheeledSnapshot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, MakeWheelSnapshot, "ChaosWheeledVehicleMovementComponent", "MakeWheelSnapshot", SDK::Params::ChaosWheeledVehicleMovementComponent_MakeWheelSnapshot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, MakeWheelStatus, "ChaosWheeledVehicleMovementComponent", "MakeWheelStatus", SDK::Params::ChaosWheeledVehicleMovementComponent_MakeWheelStatus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, EnableMechanicalSim, "ChaosWheeledVehicleMovementComponent", "EnableMechanicalSim", SDK::Params::ChaosWheeledVehicleMovementComponent_EnableMechanicalSim)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, EnableSuspension, "ChaosWheeledVehicleMovementComponent", "EnableSuspension", SDK::Params::ChaosWheeledVehicleMovementComponent_EnableSuspension)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, EnableWheelFriction, "ChaosWheeledVehicleMovementComponent", "EnableWheelFriction", SDK::Params::ChaosWheeledVehicleMovementComponent_EnableWheelFriction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetABSEnabled, "ChaosWheeledVehicleMovementComponent", "SetABSEnabled", SDK::Params::ChaosWheeledVehicleMovementComponent_SetABSEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetAffectedByBrake, "ChaosWheeledVehicleMovementComponent", "SetAffectedByBrake", SDK::Params::ChaosWheeledVehicleMovementComponent_SetAffectedByBrake)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetAffectedByEngine, "ChaosWheeledVehicleMovementComponent", "SetAffectedByEngine", SDK::Params::ChaosWheeledVehicleMovementComponent_SetAffectedByEngine)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetAffectedByHandbrake, "ChaosWheeledVehicleMovementComponent", "SetAffectedByHandbrake", SDK::Params::ChaosWheeledVehicleMovementComponent_SetAffectedByHandbrake)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetAffectedBySteering, "ChaosWheeledVehicleMovementComponent", "SetAffectedBySteering", SDK::Params::ChaosWheeledVehicleMovementComponent_SetAffectedBySteering)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetBrakeTorque, "ChaosWheeledVehicleMovementComponent", "SetBrakeTorque", SDK::Params::ChaosWheeledVehicleMovementComponent_SetBrakeTorque)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetDifferentialFrontRearSplit, "ChaosWheeledVehicleMovementComponent", "SetDifferentialFrontRearSplit", SDK::Params::ChaosWheeledVehicleMovementComponent_SetDifferentialFrontRearSplit)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetDownforceCoefficient, "ChaosWheeledVehicleMovementComponent", "SetDownforceCoefficient", SDK::Params::ChaosWheeledVehicleMovementComponent_SetDownforceCoefficient)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetDragCoefficient, "ChaosWheeledVehicleMovementComponent", "SetDragCoefficient", SDK::Params::ChaosWheeledVehicleMovementComponent_SetDragCoefficient)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetDriveTorque, "ChaosWheeledVehicleMovementComponent", "SetDriveTorque", SDK::Params::ChaosWheeledVehicleMovementComponent_SetDriveTorque)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetMaxEngineTorque, "ChaosWheeledVehicleMovementComponent", "SetMaxEngineTorque", SDK::Params::ChaosWheeledVehicleMovementComponent_SetMaxEngineTorque)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetSnapshot, "ChaosWheeledVehicleMovementComponent", "SetSnapshot", SDK::Params::ChaosWheeledVehicleMovementComponent_SetSnapshot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetSuspensionParams, "ChaosWheeledVehicleMovementComponent", "SetSuspensionParams", SDK::Params::ChaosWheeledVehicleMovementComponent_SetSuspensionParams)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetTorqueCombineMethod, "ChaosWheeledVehicleMovementComponent", "SetTorqueCombineMethod", SDK::Params::ChaosWheeledVehicleMovementComponent_SetTorqueCombineMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetTractionControlEnabled, "ChaosWheeledVehicleMovementComponent", "SetTractionControlEnabled", SDK::Params::ChaosWheeledVehicleMovementComponent_SetTractionControlEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetWheelClass, "ChaosWheeledVehicleMovementComponent", "SetWheelClass", SDK::Params::ChaosWheeledVehicleMovementComponent_SetWheelClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetWheelFrictionMultiplier, "ChaosWheeledVehicleMovementComponent", "SetWheelFrictionMultiplier", SDK::Params::ChaosWheeledVehicleMovementComponent_SetWheelFrictionMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetWheelHandbrakeTorque, "ChaosWheeledVehicleMovementComponent", "SetWheelHandbrakeTorque", SDK::Params::ChaosWheeledVehicleMovementComponent_SetWheelHandbrakeTorque)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetWheelMaxBrakeTorque, "ChaosWheeledVehicleMovementComponent", "SetWheelMaxBrakeTorque", SDK::Params::ChaosWheeledVehicleMovementComponent_SetWheelMaxBrakeTorque)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetWheelMaxSteerAngle, "ChaosWheeledVehicleMovementComponent", "SetWheelMaxSteerAngle", SDK::Params::ChaosWheeledVehicleMovementComponent_SetWheelMaxSteerAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetWheelRadius, "ChaosWheeledVehicleMovementComponent", "SetWheelRadius", SDK::Params::ChaosWheeledVehicleMovementComponent_SetWheelRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, SetWheelSlipGraphMultiplier, "ChaosWheeledVehicleMovementComponent", "SetWheelSlipGraphMultiplier", SDK::Params::ChaosWheeledVehicleMovementComponent_SetWheelSlipGraphMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, GetEngineMaxRotationSpeed, "ChaosWheeledVehicleMovementComponent", "GetEngineMaxRotationSpeed", SDK::Params::ChaosWheeledVehicleMovementComponent_GetEngineMaxRotationSpeed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, GetEngineRotationSpeed, "ChaosWheeledVehicleMovementComponent", "GetEngineRotationSpeed", SDK::Params::ChaosWheeledVehicleMovementComponent_GetEngineRotationSpeed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, GetNumWheels, "ChaosWheeledVehicleMovementComponent", "GetNumWheels", SDK::Params::ChaosWheeledVehicleMovementComponent_GetNumWheels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, GetSnapshot, "ChaosWheeledVehicleMovementComponent", "GetSnapshot", SDK::Params::ChaosWheeledVehicleMovementComponent_GetSnapshot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosWheeledVehicleMovementComponent, GetWheelState, "ChaosWheeledVehicleMovementComponent", "GetWheelState", SDK::Params::ChaosWheeledVehicleMovementComponent_GetWheelState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVehicleAnimationInstance, GetVehicle, "VehicleAnimationInstance", "GetVehicle", SDK::Params::VehicleAnimationInstance_GetVehicle)
+// clang-format on
@@ -0,0 +1,47 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from CinematicCamera_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/CinematicCamera_classes.hpp"
+#include "../SDK/CinematicCamera_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ACameraRig_Rail, GetRailSplineComponent, "CameraRig_Rail", "GetRailSplineComponent", SDK::Params::CameraRig_Rail_GetRailSplineComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ACineCameraActor, GetCineCameraComponent, "CineCameraActor", "GetCineCameraComponent", SDK::Params::CineCameraActor_GetCineCameraComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, GetFilmbackPresetsCopy, "CineCameraComponent", "GetFilmbackPresetsCopy", SDK::Params::CineCameraComponent_GetFilmbackPresetsCopy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, GetLensPresetsCopy, "CineCameraComponent", "GetLensPresetsCopy", SDK::Params::CineCameraComponent_GetLensPresetsCopy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetCropPresetByName, "CineCameraComponent", "SetCropPresetByName", SDK::Params::CineCameraComponent_SetCropPresetByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetCropSettings, "CineCameraComponent", "SetCropSettings", SDK::Params::CineCameraComponent_SetCropSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetCurrentAperture, "CineCameraComponent", "SetCurrentAperture", SDK::Params::CineCameraComponent_SetCurrentAperture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetCurrentFocalLength, "CineCameraComponent", "SetCurrentFocalLength", SDK::Params::CineCameraComponent_SetCurrentFocalLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetCustomNearClippingPlane, "CineCameraComponent", "SetCustomNearClippingPlane", SDK::Params::CineCameraComponent_SetCustomNearClippingPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetFilmback, "CineCameraComponent", "SetFilmback", SDK::Params::CineCameraComponent_SetFilmback)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetFilmbackPresetByName, "CineCameraComponent", "SetFilmbackPresetByName", SDK::Params::CineCameraComponent_SetFilmbackPresetByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetFocusSettings, "CineCameraComponent", "SetFocusSettings", SDK::Params::CineCameraComponent_SetFocusSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetLensPresetByName, "CineCameraComponent", "SetLensPresetByName", SDK::Params::CineCameraComponent_SetLensPresetByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, SetLensSettings, "CineCameraComponent", "SetLensSettings", SDK::Params::CineCameraComponent_SetLensSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, GetCropPresetName, "CineCameraComponent", "GetCropPresetName", SDK::Params::CineCameraComponent_GetCropPresetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, GetDefaultFilmbackPresetName, "CineCameraComponent", "GetDefaultFilmbackPresetName", SDK::Params::CineCameraComponent_GetDefaultFilmbackPresetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, GetFilmbackPresetName, "CineCameraComponent", "GetFilmbackPresetName", SDK::Params::CineCameraComponent_GetFilmbackPresetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, GetHorizontalFieldOfView, "CineCameraComponent", "GetHorizontalFieldOfView", SDK::Params::CineCameraComponent_GetHorizontalFieldOfView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, GetLensPresetName, "CineCameraComponent", "GetLensPresetName", SDK::Params::CineCameraComponent_GetLensPresetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraComponent, GetVerticalFieldOfView, "CineCameraComponent", "GetVerticalFieldOfView", SDK::Params::CineCameraComponent_GetVerticalFieldOfView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, GetCineCameraSettings, "CineCameraSettings", "GetCineCameraSettings", SDK::Params::CineCameraSettings_GetCineCameraSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, GetCropPresetByName, "CineCameraSettings", "GetCropPresetByName", SDK::Params::CineCameraSettings_GetCropPresetByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, GetFilmbackPresetByName, "CineCameraSettings", "GetFilmbackPresetByName", SDK::Params::CineCameraSettings_GetFilmbackPresetByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, GetLensPresetByName, "CineCameraSettings", "GetLensPresetByName", SDK::Params::CineCameraSettings_GetLensPresetByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, SetCropPresets, "CineCameraSettings", "SetCropPresets", SDK::Params::CineCameraSettings_SetCropPresets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, SetDefaultCropPresetName, "CineCameraSettings", "SetDefaultCropPresetName", SDK::Params::CineCameraSettings_SetDefaultCropPresetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, SetDefaultFilmbackPreset, "CineCameraSettings", "SetDefaultFilmbackPreset", SDK::Params::CineCameraSettings_SetDefaultFilmbackPreset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, SetDefaultLensFocalLength, "CineCameraSettings", "SetDefaultLensFocalLength", SDK::Params::CineCameraSettings_SetDefaultLensFocalLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, SetDefaultLensFStop, "CineCameraSettings", "SetDefaultLensFStop", SDK::Params::CineCameraSettings_SetDefaultLensFStop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, SetDefaultLensPresetName, "CineCameraSettings", "SetDefaultLensPresetName", SDK::Params::CineCameraSettings_SetDefaultLensPresetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, SetFilmbackPresets, "CineCameraSettings", "SetFilmbackPresets", SDK::Params::CineCameraSettings_SetFilmbackPresets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, SetLensPresets, "CineCameraSettings", "SetLensPresets", SDK::Params::CineCameraSettings_SetLensPresets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, GetCropPresetNames, "CineCameraSettings", "GetCropPresetNames", SDK::Params::CineCameraSettings_GetCropPresetNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, GetFilmbackPresetNames, "CineCameraSettings", "GetFilmbackPresetNames", SDK::Params::CineCameraSettings_GetFilmbackPresetNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCineCameraSettings, GetLensPresetNames, "CineCameraSettings", "GetLensPresetNames", SDK::Params::CineCameraSettings_GetLensPresetNames)
+// clang-format on
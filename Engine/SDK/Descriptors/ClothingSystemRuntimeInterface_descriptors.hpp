@@ -0,0 +1,27 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ClothingSystemRuntimeInterface_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ClothingSystemRuntimeInterface_classes.hpp"
+#include "../SDK/ClothingSystemRuntimeInterface_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, ClothConfigUpdated, "ClothingSimulationInteractor", "ClothConfigUpdated", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, DisableGravityOverride, "ClothingSimulationInteractor", "DisableGravityOverride", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, EnableGravityOverride, "ClothingSimulationInteractor", "EnableGravityOverride", SDK::Params::ClothingSimulationInteractor_EnableGravityOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, PhysicsAssetUpdated, "ClothingSimulationInteractor", "PhysicsAssetUpdated", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, SetAnimDriveSpringStiffness, "ClothingSimulationInteractor", "SetAnimDriveSpringStiffness", SDK::Params::ClothingSimulationInteractor_SetAnimDriveSpringStiffness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, SetMaxNumIterations, "ClothingSimulationInteractor", "SetMaxNumIterations", SDK::Params::ClothingSimulationInteractor_SetMaxNumIterations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, SetNumIterations, "ClothingSimulationInteractor", "SetNumIterations", SDK::Params::ClothingSimulationInteractor_SetNumIterations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, SetNumSubsteps, "ClothingSimulationInteractor", "SetNumSubsteps", SDK::Params::ClothingSimulationInteractor_SetNumSubsteps)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, GetClothingInteractor, "ClothingSimulationInteractor", "GetClothingInteractor", SDK::Params::ClothingSimulationInteractor_GetClothingInteractor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, GetNumCloths, "ClothingSimulationInteractor", "GetNumCloths", SDK::Params::ClothingSimulationInteractor_GetNumCloths)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, GetNumDynamicParticles, "ClothingSimulationInteractor", "GetNumDynamicParticles", SDK::Params::ClothingSimulationInteractor_GetNumDynamicParticles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, GetNumIterations, "ClothingSimulationInteractor", "GetNumIterations", SDK::Params::ClothingSimulationInteractor_GetNumIterations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, GetNumKinematicParticles, "ClothingSimulationInteractor", "GetNumKinematicParticles", SDK::Params::ClothingSimulationInteractor_GetNumKinematicParticles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, GetNumSubsteps, "ClothingSimulationInteractor", "GetNumSubsteps", SDK::Params::ClothingSimulationInteractor_GetNumSubsteps)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractor, GetSimulationTime, "ClothingSimulationInteractor", "GetSimulationTime", SDK::Params::ClothingSimulationInteractor_GetSimulationTime)
+// clang-format on
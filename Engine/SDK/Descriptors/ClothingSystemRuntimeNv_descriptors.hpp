@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ClothingSystemRuntimeNv_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ClothingSystemRuntimeNv_classes.hpp"
+#include "../SDK/ClothingSystemRuntimeNv_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UClothingSimulationInteractorNv, SetAnimDriveDamperStiffness, "ClothingSimulationInteractorNv", "SetAnimDriveDamperStiffness", SDK::Params::ClothingSimulationInteractorNv_SetAnimDriveDamperStiffness)
+// clang-format on
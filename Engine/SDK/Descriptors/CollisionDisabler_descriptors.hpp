@@ -0,0 +1,27 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from CollisionDisabler_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/CollisionDisabler_classes.hpp"
+#include "../SDK/CollisionDisabler_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, CancelModifyCollision, "CollisionDisablerFunctionLibrary", "CancelModifyCollision", SDK::Params::CollisionDisablerFunctionLibrary_CancelModifyCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, DisableCollision, "CollisionDisablerFunctionLibrary", "DisableCollision", SDK::Params::CollisionDisablerFunctionLibrary_DisableCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, DisableCollision_SingleBodyVsSingleBody, "CollisionDisablerFunctionLibrary", "DisableCollision_SingleBodyVsSingleBody", SDK::Params::CollisionDisablerFunctionLibrary_DisableCollision_SingleBodyVsSingleBody)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, DisableCollision_SkeletalVsSingleBody, "CollisionDisablerFunctionLibrary", "DisableCollision_SkeletalVsSingleBody", SDK::Params::CollisionDisablerFunctionLibrary_DisableCollision_SkeletalVsSingleBody)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, DisableCollision_SkeletalVsSkeletal, "CollisionDisablerFunctionLibrary", "DisableCollision_SkeletalVsSkeletal", SDK::Params::CollisionDisablerFunctionLibrary_DisableCollision_SkeletalVsSkeletal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, EnableCollision, "CollisionDisablerFunctionLibrary", "EnableCollision", SDK::Params::CollisionDisablerFunctionLibrary_EnableCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, EnableCollision_SingleBodyVsSingleBody, "CollisionDisablerFunctionLibrary", "EnableCollision_SingleBodyVsSingleBody", SDK::Params::CollisionDisablerFunctionLibrary_EnableCollision_SingleBodyVsSingleBody)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, EnableCollision_SkeletalVsSingleBody, "CollisionDisablerFunctionLibrary", "EnableCollision_SkeletalVsSingleBody", SDK::Params::CollisionDisablerFunctionLibrary_EnableCollision_SkeletalVsSingleBody)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, EnableCollision_SkeletalVsSkeletal, "CollisionDisablerFunctionLibrary", "EnableCollision_SkeletalVsSkeletal", SDK::Params::CollisionDisablerFunctionLibrary_EnableCollision_SkeletalVsSkeletal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, GatherAllPhysicalBones, "CollisionDisablerFunctionLibrary", "GatherAllPhysicalBones", SDK::Params::CollisionDisablerFunctionLibrary_GatherAllPhysicalBones)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, GatherAllPhysicalBonesFrom, "CollisionDisablerFunctionLibrary", "GatherAllPhysicalBonesFrom", SDK::Params::CollisionDisablerFunctionLibrary_GatherAllPhysicalBonesFrom)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, GatherAllPhysicalComponents, "CollisionDisablerFunctionLibrary", "GatherAllPhysicalComponents", SDK::Params::CollisionDisablerFunctionLibrary_GatherAllPhysicalComponents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, IsCollisionDisabled, "CollisionDisablerFunctionLibrary", "IsCollisionDisabled", SDK::Params::CollisionDisablerFunctionLibrary_IsCollisionDisabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, IsCollisionModified, "CollisionDisablerFunctionLibrary", "IsCollisionModified", SDK::Params::CollisionDisablerFunctionLibrary_IsCollisionModified)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCollisionDisablerFunctionLibrary, ModifyCollision, "CollisionDisablerFunctionLibrary", "ModifyCollision", SDK::Params::CollisionDisablerFunctionLibrary_ModifyCollision)
+// clang-format on
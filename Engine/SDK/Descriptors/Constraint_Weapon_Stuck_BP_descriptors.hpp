@@ -0,0 +1,23 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Constraint_Weapon_Stuck_BP_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Constraint_Weapon_Stuck_BP_classes.hpp"
+#include "../SDK/Constraint_Weapon_Stuck_BP_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, Add_Out_Point_Scene, "Constraint_Weapon_Stuck_BP_C", "Add Out Point Scene", SDK::Params::Constraint_Weapon_Stuck_BP_C_Add_Out_Point_Scene)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, BndEvt__Constraint_Weapon_Stuck_BP_Box_K2Node_ComponentBoundEvent_0_ComponentBeginOverlapSignature__DelegateSignature, "Constraint_Weapon_Stuck_BP_C", "BndEvt__Constraint_Weapon_Stuck_BP_Box_K2Node_ComponentBoundEvent_0_ComponentBeginOverlapSignature__DelegateSignature", SDK::Params::Constraint_Weapon_Stuck_BP_C_BndEvt__Constraint_Weapon_Stuck_BP_Box_K2Node_ComponentBoundEvent_0_ComponentBeginOverlapSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, BndEvt__Constraint_Weapon_Stuck_BP_Box_K2Node_ComponentBoundEvent_1_ComponentEndOverlapSignature__DelegateSignature, "Constraint_Weapon_Stuck_BP_C", "BndEvt__Constraint_Weapon_Stuck_BP_Box_K2Node_ComponentBoundEvent_1_ComponentEndOverlapSignature__DelegateSignature", SDK::Params::Constraint_Weapon_Stuck_BP_C_BndEvt__Constraint_Weapon_Stuck_BP_Box_K2Node_ComponentBoundEvent_1_ComponentEndOverlapSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, Call_Dismember, "Constraint_Weapon_Stuck_BP_C", "Call Dismember", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, Check_Dismember_2, "Constraint_Weapon_Stuck_BP_C", "Check Dismember 2", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, ExecuteUbergraph_Constraint_Weapon_Stuck_BP, "Constraint_Weapon_Stuck_BP_C", "ExecuteUbergraph_Constraint_Weapon_Stuck_BP", SDK::Params::Constraint_Weapon_Stuck_BP_C_ExecuteUbergraph_Constraint_Weapon_Stuck_BP)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, NewFunction, "Constraint_Weapon_Stuck_BP_C", "NewFunction", SDK::Params::Constraint_Weapon_Stuck_BP_C_NewFunction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, ReceiveBeginPlay, "Constraint_Weapon_Stuck_BP_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, ReceiveTick, "Constraint_Weapon_Stuck_BP_C", "ReceiveTick", SDK::Params::Constraint_Weapon_Stuck_BP_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, Release_Constraint, "Constraint_Weapon_Stuck_BP_C", "Release Constraint", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Weapon_Stuck_BP_C, Renew_Costrained_Bone, "Constraint_Weapon_Stuck_BP_C", "Renew Costrained Bone", void)
+// clang-format on
@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Constraint_Zero_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Constraint_Zero_classes.hpp"
+#include "../SDK/Constraint_Zero_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Zero_C, Destroy_Self, "Constraint_Zero_C", "Destroy Self", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Zero_C, ExecuteUbergraph_Constraint_Zero, "Constraint_Zero_C", "ExecuteUbergraph_Constraint_Zero", SDK::Params::Constraint_Zero_C_ExecuteUbergraph_Constraint_Zero)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Zero_C, ReceiveBeginPlay, "Constraint_Zero_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Zero_C, ReceiveTick, "Constraint_Zero_C", "ReceiveTick", SDK::Params::Constraint_Zero_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AConstraint_Zero_C, UserConstructionScript, "Constraint_Zero_C", "UserConstructionScript", void)
+// clang-format on
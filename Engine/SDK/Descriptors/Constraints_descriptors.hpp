@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Constraints_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Constraints_classes.hpp"
+#include "../SDK/Constraints_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstraintsScriptingLibrary, AddConstraint, "ConstraintsScriptingLibrary", "AddConstraint", SDK::Params::ConstraintsScriptingLibrary_AddConstraint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstraintsScriptingLibrary, CreateFromType, "ConstraintsScriptingLibrary", "CreateFromType", SDK::Params::ConstraintsScriptingLibrary_CreateFromType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstraintsScriptingLibrary, CreateTransformableComponentHandle, "ConstraintsScriptingLibrary", "CreateTransformableComponentHandle", SDK::Params::ConstraintsScriptingLibrary_CreateTransformableComponentHandle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstraintsScriptingLibrary, CreateTransformableHandle, "ConstraintsScriptingLibrary", "CreateTransformableHandle", SDK::Params::ConstraintsScriptingLibrary_CreateTransformableHandle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstraintsScriptingLibrary, GetConstraintsArray, "ConstraintsScriptingLibrary", "GetConstraintsArray", SDK::Params::ConstraintsScriptingLibrary_GetConstraintsArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstraintsScriptingLibrary, RemoveConstraint, "ConstraintsScriptingLibrary", "RemoveConstraint", SDK::Params::ConstraintsScriptingLibrary_RemoveConstraint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConstraintsScriptingLibrary, RemoveThisConstraint, "ConstraintsScriptingLibrary", "RemoveThisConstraint", SDK::Params::ConstraintsScriptingLibrary_RemoveThisConstraint)
+// clang-format on
@@ -0,0 +1,333 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ControlRig_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ControlRig_classes.hpp"
+#include "../SDK/ControlRig_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigShapeLibraryLink, SetShapeLibrary, "ControlRigShapeLibraryLink", "SetShapeLibrary", SDK::Params::ControlRigShapeLibraryLink_SetShapeLibrary)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigShapeLibraryLink, GetShapeLibrary, "ControlRigShapeLibraryLink", "GetShapeLibrary", SDK::Params::ControlRigShapeLibraryLink_GetShapeLibrary)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, FindControlRigs, "ControlRig", "FindControlRigs", SDK::Params::ControlRig_FindControlRigs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, ClearControlSelection, "ControlRig", "ClearControlSelection", SDK::Params::ControlRig_ClearControlSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, GetHierarchy, "ControlRig", "GetHierarchy", SDK::Params::ControlRig_GetHierarchy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, RequestConstruction, "ControlRig", "RequestConstruction", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, SelectControl, "ControlRig", "SelectControl", SDK::Params::ControlRig_SelectControl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, SetInteractionRig, "ControlRig", "SetInteractionRig", SDK::Params::ControlRig_SetInteractionRig)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, SetInteractionRigClass, "ControlRig", "SetInteractionRigClass", SDK::Params::ControlRig_SetInteractionRigClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, CreateTransformableControlHandle, "ControlRig", "CreateTransformableControlHandle", SDK::Params::ControlRig_CreateTransformableControlHandle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, CurrentControlSelection, "ControlRig", "CurrentControlSelection", SDK::Params::ControlRig_CurrentControlSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, GetHostingActor, "ControlRig", "GetHostingActor", SDK::Params::ControlRig_GetHostingActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, GetInteractionRig, "ControlRig", "GetInteractionRig", SDK::Params::ControlRig_GetInteractionRig)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, GetInteractionRigClass, "ControlRig", "GetInteractionRigClass", SDK::Params::ControlRig_GetInteractionRigClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, IsControlSelected, "ControlRig", "IsControlSelected", SDK::Params::ControlRig_IsControlSelected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRig, SupportsBackwardsSolve, "ControlRig", "SupportsBackwardsSolve", SDK::Params::ControlRig_SupportsBackwardsSolve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetEulerTransformFromControlValue, "RigHierarchy", "GetEulerTransformFromControlValue", SDK::Params::RigHierarchy_GetEulerTransformFromControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetFloatFromControlValue, "RigHierarchy", "GetFloatFromControlValue", SDK::Params::RigHierarchy_GetFloatFromControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetIntFromControlValue, "RigHierarchy", "GetIntFromControlValue", SDK::Params::RigHierarchy_GetIntFromControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetRotatorFromControlValue, "RigHierarchy", "GetRotatorFromControlValue", SDK::Params::RigHierarchy_GetRotatorFromControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetTransformFromControlValue, "RigHierarchy", "GetTransformFromControlValue", SDK::Params::RigHierarchy_GetTransformFromControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetTransformNoScaleFromControlValue, "RigHierarchy", "GetTransformNoScaleFromControlValue", SDK::Params::RigHierarchy_GetTransformNoScaleFromControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetVector2DFromControlValue, "RigHierarchy", "GetVector2DFromControlValue", SDK::Params::RigHierarchy_GetVector2DFromControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetVectorFromControlValue, "RigHierarchy", "GetVectorFromControlValue", SDK::Params::RigHierarchy_GetVectorFromControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromBool, "RigHierarchy", "MakeControlValueFromBool", SDK::Params::RigHierarchy_MakeControlValueFromBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromEulerTransform, "RigHierarchy", "MakeControlValueFromEulerTransform", SDK::Params::RigHierarchy_MakeControlValueFromEulerTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromFloat, "RigHierarchy", "MakeControlValueFromFloat", SDK::Params::RigHierarchy_MakeControlValueFromFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromInt, "RigHierarchy", "MakeControlValueFromInt", SDK::Params::RigHierarchy_MakeControlValueFromInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromRotator, "RigHierarchy", "MakeControlValueFromRotator", SDK::Params::RigHierarchy_MakeControlValueFromRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromTransform, "RigHierarchy", "MakeControlValueFromTransform", SDK::Params::RigHierarchy_MakeControlValueFromTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromTransformNoScale, "RigHierarchy", "MakeControlValueFromTransformNoScale", SDK::Params::RigHierarchy_MakeControlValueFromTransformNoScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromVector, "RigHierarchy", "MakeControlValueFromVector", SDK::Params::RigHierarchy_MakeControlValueFromVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, MakeControlValueFromVector2D, "RigHierarchy", "MakeControlValueFromVector2D", SDK::Params::RigHierarchy_MakeControlValueFromVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, CopyHierarchy, "RigHierarchy", "CopyHierarchy", SDK::Params::RigHierarchy_CopyHierarchy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, CopyPose, "RigHierarchy", "CopyPose", SDK::Params::RigHierarchy_CopyPose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetController, "RigHierarchy", "GetController", SDK::Params::RigHierarchy_GetController)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetRuleManager, "RigHierarchy", "GetRuleManager", SDK::Params::RigHierarchy_GetRuleManager)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, RemoveAllMetadata, "RigHierarchy", "RemoveAllMetadata", SDK::Params::RigHierarchy_RemoveAllMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, RemoveMetadata, "RigHierarchy", "RemoveMetadata", SDK::Params::RigHierarchy_RemoveMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, Reset, "RigHierarchy", "Reset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, ResetCurveValues, "RigHierarchy", "ResetCurveValues", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, ResetPoseToInitial, "RigHierarchy", "ResetPoseToInitial", SDK::Params::RigHierarchy_ResetPoseToInitial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, ResetToDefault, "RigHierarchy", "ResetToDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, RestoreConnectorsFromStates, "RigHierarchy", "RestoreConnectorsFromStates", SDK::Params::RigHierarchy_RestoreConnectorsFromStates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, RestoreSocketsFromStates, "RigHierarchy", "RestoreSocketsFromStates", SDK::Params::RigHierarchy_RestoreSocketsFromStates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SendAutoKeyEvent, "RigHierarchy", "SendAutoKeyEvent", SDK::Params::RigHierarchy_SendAutoKeyEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetBoolArrayMetadata, "RigHierarchy", "SetBoolArrayMetadata", SDK::Params::RigHierarchy_SetBoolArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetBoolMetadata, "RigHierarchy", "SetBoolMetadata", SDK::Params::RigHierarchy_SetBoolMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetConnectorSettings, "RigHierarchy", "SetConnectorSettings", SDK::Params::RigHierarchy_SetConnectorSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetConnectorSettingsByIndex, "RigHierarchy", "SetConnectorSettingsByIndex", SDK::Params::RigHierarchy_SetConnectorSettingsByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlOffsetTransform, "RigHierarchy", "SetControlOffsetTransform", SDK::Params::RigHierarchy_SetControlOffsetTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlOffsetTransformByIndex, "RigHierarchy", "SetControlOffsetTransformByIndex", SDK::Params::RigHierarchy_SetControlOffsetTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlPreferredEulerAngles, "RigHierarchy", "SetControlPreferredEulerAngles", SDK::Params::RigHierarchy_SetControlPreferredEulerAngles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlPreferredEulerAnglesByIndex, "RigHierarchy", "SetControlPreferredEulerAnglesByIndex", SDK::Params::RigHierarchy_SetControlPreferredEulerAnglesByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlPreferredRotationOrder, "RigHierarchy", "SetControlPreferredRotationOrder", SDK::Params::RigHierarchy_SetControlPreferredRotationOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlPreferredRotationOrderByIndex, "RigHierarchy", "SetControlPreferredRotationOrderByIndex", SDK::Params::RigHierarchy_SetControlPreferredRotationOrderByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlPreferredRotator, "RigHierarchy", "SetControlPreferredRotator", SDK::Params::RigHierarchy_SetControlPreferredRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlPreferredRotatorByIndex, "RigHierarchy", "SetControlPreferredRotatorByIndex", SDK::Params::RigHierarchy_SetControlPreferredRotatorByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlSettings, "RigHierarchy", "SetControlSettings", SDK::Params::RigHierarchy_SetControlSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlSettingsByIndex, "RigHierarchy", "SetControlSettingsByIndex", SDK::Params::RigHierarchy_SetControlSettingsByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlShapeTransform, "RigHierarchy", "SetControlShapeTransform", SDK::Params::RigHierarchy_SetControlShapeTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlShapeTransformByIndex, "RigHierarchy", "SetControlShapeTransformByIndex", SDK::Params::RigHierarchy_SetControlShapeTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlValue, "RigHierarchy", "SetControlValue", SDK::Params::RigHierarchy_SetControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlValueByIndex, "RigHierarchy", "SetControlValueByIndex", SDK::Params::RigHierarchy_SetControlValueByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlVisibility, "RigHierarchy", "SetControlVisibility", SDK::Params::RigHierarchy_SetControlVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetControlVisibilityByIndex, "RigHierarchy", "SetControlVisibilityByIndex", SDK::Params::RigHierarchy_SetControlVisibilityByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetCurveValue, "RigHierarchy", "SetCurveValue", SDK::Params::RigHierarchy_SetCurveValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetCurveValueByIndex, "RigHierarchy", "SetCurveValueByIndex", SDK::Params::RigHierarchy_SetCurveValueByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetFloatArrayMetadata, "RigHierarchy", "SetFloatArrayMetadata", SDK::Params::RigHierarchy_SetFloatArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetFloatMetadata, "RigHierarchy", "SetFloatMetadata", SDK::Params::RigHierarchy_SetFloatMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetGlobalTransform, "RigHierarchy", "SetGlobalTransform", SDK::Params::RigHierarchy_SetGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetGlobalTransformByIndex, "RigHierarchy", "SetGlobalTransformByIndex", SDK::Params::RigHierarchy_SetGlobalTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetInt32ArrayMetadata, "RigHierarchy", "SetInt32ArrayMetadata", SDK::Params::RigHierarchy_SetInt32ArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetInt32Metadata, "RigHierarchy", "SetInt32Metadata", SDK::Params::RigHierarchy_SetInt32Metadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetLinearColorArrayMetadata, "RigHierarchy", "SetLinearColorArrayMetadata", SDK::Params::RigHierarchy_SetLinearColorArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetLinearColorMetadata, "RigHierarchy", "SetLinearColorMetadata", SDK::Params::RigHierarchy_SetLinearColorMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetLocalTransform, "RigHierarchy", "SetLocalTransform", SDK::Params::RigHierarchy_SetLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetLocalTransformByIndex, "RigHierarchy", "SetLocalTransformByIndex", SDK::Params::RigHierarchy_SetLocalTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetNameArrayMetadata, "RigHierarchy", "SetNameArrayMetadata", SDK::Params::RigHierarchy_SetNameArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetNameMetadata, "RigHierarchy", "SetNameMetadata", SDK::Params::RigHierarchy_SetNameMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetParentWeight, "RigHierarchy", "SetParentWeight", SDK::Params::RigHierarchy_SetParentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetParentWeightArray, "RigHierarchy", "SetParentWeightArray", SDK::Params::RigHierarchy_SetParentWeightArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetPose_ForBlueprint, "RigHierarchy", "SetPose_ForBlueprint", SDK::Params::RigHierarchy_SetPose_ForBlueprint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetQuatArrayMetadata, "RigHierarchy", "SetQuatArrayMetadata", SDK::Params::RigHierarchy_SetQuatArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetQuatMetadata, "RigHierarchy", "SetQuatMetadata", SDK::Params::RigHierarchy_SetQuatMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetRigElementKeyArrayMetadata, "RigHierarchy", "SetRigElementKeyArrayMetadata", SDK::Params::RigHierarchy_SetRigElementKeyArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetRigElementKeyMetadata, "RigHierarchy", "SetRigElementKeyMetadata", SDK::Params::RigHierarchy_SetRigElementKeyMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetRotatorArrayMetadata, "RigHierarchy", "SetRotatorArrayMetadata", SDK::Params::RigHierarchy_SetRotatorArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetRotatorMetadata, "RigHierarchy", "SetRotatorMetadata", SDK::Params::RigHierarchy_SetRotatorMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetTag, "RigHierarchy", "SetTag", SDK::Params::RigHierarchy_SetTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetTransformArrayMetadata, "RigHierarchy", "SetTransformArrayMetadata", SDK::Params::RigHierarchy_SetTransformArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetTransformMetadata, "RigHierarchy", "SetTransformMetadata", SDK::Params::RigHierarchy_SetTransformMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetVectorArrayMetadata, "RigHierarchy", "SetVectorArrayMetadata", SDK::Params::RigHierarchy_SetVectorArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SetVectorMetadata, "RigHierarchy", "SetVectorMetadata", SDK::Params::RigHierarchy_SetVectorMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SwitchToDefaultParent, "RigHierarchy", "SwitchToDefaultParent", SDK::Params::RigHierarchy_SwitchToDefaultParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SwitchToParent, "RigHierarchy", "SwitchToParent", SDK::Params::RigHierarchy_SwitchToParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SwitchToWorldSpace, "RigHierarchy", "SwitchToWorldSpace", SDK::Params::RigHierarchy_SwitchToWorldSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, UnsetCurveValue, "RigHierarchy", "UnsetCurveValue", SDK::Params::RigHierarchy_UnsetCurveValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, UnsetCurveValueByIndex, "RigHierarchy", "UnsetCurveValueByIndex", SDK::Params::RigHierarchy_UnsetCurveValueByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, Contains_ForBlueprint, "RigHierarchy", "Contains_ForBlueprint", SDK::Params::RigHierarchy_Contains_ForBlueprint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, FindBone_ForBlueprintOnly, "RigHierarchy", "FindBone_ForBlueprintOnly", SDK::Params::RigHierarchy_FindBone_ForBlueprintOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, FindControl_ForBlueprintOnly, "RigHierarchy", "FindControl_ForBlueprintOnly", SDK::Params::RigHierarchy_FindControl_ForBlueprintOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, FindNull_ForBlueprintOnly, "RigHierarchy", "FindNull_ForBlueprintOnly", SDK::Params::RigHierarchy_FindNull_ForBlueprintOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetAllKeys_ForBlueprint, "RigHierarchy", "GetAllKeys_ForBlueprint", SDK::Params::RigHierarchy_GetAllKeys_ForBlueprint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetBoneKeys, "RigHierarchy", "GetBoneKeys", SDK::Params::RigHierarchy_GetBoneKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetBoolArrayMetadata, "RigHierarchy", "GetBoolArrayMetadata", SDK::Params::RigHierarchy_GetBoolArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetBoolMetadata, "RigHierarchy", "GetBoolMetadata", SDK::Params::RigHierarchy_GetBoolMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetChildren, "RigHierarchy", "GetChildren", SDK::Params::RigHierarchy_GetChildren)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetConnectorKeys, "RigHierarchy", "GetConnectorKeys", SDK::Params::RigHierarchy_GetConnectorKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetConnectorStates, "RigHierarchy", "GetConnectorStates", SDK::Params::RigHierarchy_GetConnectorStates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlKeys, "RigHierarchy", "GetControlKeys", SDK::Params::RigHierarchy_GetControlKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlPreferredEulerAngles, "RigHierarchy", "GetControlPreferredEulerAngles", SDK::Params::RigHierarchy_GetControlPreferredEulerAngles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlPreferredEulerAnglesByIndex, "RigHierarchy", "GetControlPreferredEulerAnglesByIndex", SDK::Params::RigHierarchy_GetControlPreferredEulerAnglesByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlPreferredEulerRotationOrder, "RigHierarchy", "GetControlPreferredEulerRotationOrder", SDK::Params::RigHierarchy_GetControlPreferredEulerRotationOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlPreferredEulerRotationOrderByIndex, "RigHierarchy", "GetControlPreferredEulerRotationOrderByIndex", SDK::Params::RigHierarchy_GetControlPreferredEulerRotationOrderByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlPreferredRotator, "RigHierarchy", "GetControlPreferredRotator", SDK::Params::RigHierarchy_GetControlPreferredRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlPreferredRotatorByIndex, "RigHierarchy", "GetControlPreferredRotatorByIndex", SDK::Params::RigHierarchy_GetControlPreferredRotatorByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlValue, "RigHierarchy", "GetControlValue", SDK::Params::RigHierarchy_GetControlValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetControlValueByIndex, "RigHierarchy", "GetControlValueByIndex", SDK::Params::RigHierarchy_GetControlValueByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetCurveKeys, "RigHierarchy", "GetCurveKeys", SDK::Params::RigHierarchy_GetCurveKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetCurveValue, "RigHierarchy", "GetCurveValue", SDK::Params::RigHierarchy_GetCurveValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetCurveValueByIndex, "RigHierarchy", "GetCurveValueByIndex", SDK::Params::RigHierarchy_GetCurveValueByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetDefaultParent, "RigHierarchy", "GetDefaultParent", SDK::Params::RigHierarchy_GetDefaultParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetFirstParent, "RigHierarchy", "GetFirstParent", SDK::Params::RigHierarchy_GetFirstParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetFloatArrayMetadata, "RigHierarchy", "GetFloatArrayMetadata", SDK::Params::RigHierarchy_GetFloatArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetFloatMetadata, "RigHierarchy", "GetFloatMetadata", SDK::Params::RigHierarchy_GetFloatMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetGlobalControlOffsetTransform, "RigHierarchy", "GetGlobalControlOffsetTransform", SDK::Params::RigHierarchy_GetGlobalControlOffsetTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetGlobalControlOffsetTransformByIndex, "RigHierarchy", "GetGlobalControlOffsetTransformByIndex", SDK::Params::RigHierarchy_GetGlobalControlOffsetTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetGlobalControlShapeTransform, "RigHierarchy", "GetGlobalControlShapeTransform", SDK::Params::RigHierarchy_GetGlobalControlShapeTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetGlobalControlShapeTransformByIndex, "RigHierarchy", "GetGlobalControlShapeTransformByIndex", SDK::Params::RigHierarchy_GetGlobalControlShapeTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetGlobalTransform, "RigHierarchy", "GetGlobalTransform", SDK::Params::RigHierarchy_GetGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetGlobalTransformByIndex, "RigHierarchy", "GetGlobalTransformByIndex", SDK::Params::RigHierarchy_GetGlobalTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetIndex_ForBlueprint, "RigHierarchy", "GetIndex_ForBlueprint", SDK::Params::RigHierarchy_GetIndex_ForBlueprint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetInt32ArrayMetadata, "RigHierarchy", "GetInt32ArrayMetadata", SDK::Params::RigHierarchy_GetInt32ArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetInt32Metadata, "RigHierarchy", "GetInt32Metadata", SDK::Params::RigHierarchy_GetInt32Metadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetKey, "RigHierarchy", "GetKey", SDK::Params::RigHierarchy_GetKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetKeys, "RigHierarchy", "GetKeys", SDK::Params::RigHierarchy_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetLinearColorArrayMetadata, "RigHierarchy", "GetLinearColorArrayMetadata", SDK::Params::RigHierarchy_GetLinearColorArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetLinearColorMetadata, "RigHierarchy", "GetLinearColorMetadata", SDK::Params::RigHierarchy_GetLinearColorMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetLocalControlShapeTransform, "RigHierarchy", "GetLocalControlShapeTransform", SDK::Params::RigHierarchy_GetLocalControlShapeTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetLocalControlShapeTransformByIndex, "RigHierarchy", "GetLocalControlShapeTransformByIndex", SDK::Params::RigHierarchy_GetLocalControlShapeTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetLocalIndex_ForBlueprint, "RigHierarchy", "GetLocalIndex_ForBlueprint", SDK::Params::RigHierarchy_GetLocalIndex_ForBlueprint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetLocalTransform, "RigHierarchy", "GetLocalTransform", SDK::Params::RigHierarchy_GetLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetLocalTransformByIndex, "RigHierarchy", "GetLocalTransformByIndex", SDK::Params::RigHierarchy_GetLocalTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetMetadataNames, "RigHierarchy", "GetMetadataNames", SDK::Params::RigHierarchy_GetMetadataNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetMetadataType, "RigHierarchy", "GetMetadataType", SDK::Params::RigHierarchy_GetMetadataType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetModulePath, "RigHierarchy", "GetModulePath", SDK::Params::RigHierarchy_GetModulePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetModulePathFName, "RigHierarchy", "GetModulePathFName", SDK::Params::RigHierarchy_GetModulePathFName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetNameArrayMetadata, "RigHierarchy", "GetNameArrayMetadata", SDK::Params::RigHierarchy_GetNameArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetNameMetadata, "RigHierarchy", "GetNameMetadata", SDK::Params::RigHierarchy_GetNameMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetNameSpace, "RigHierarchy", "GetNameSpace", SDK::Params::RigHierarchy_GetNameSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetNameSpaceFName, "RigHierarchy", "GetNameSpaceFName", SDK::Params::RigHierarchy_GetNameSpaceFName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetNullKeys, "RigHierarchy", "GetNullKeys", SDK::Params::RigHierarchy_GetNullKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetNumberOfParents, "RigHierarchy", "GetNumberOfParents", SDK::Params::RigHierarchy_GetNumberOfParents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetParents, "RigHierarchy", "GetParents", SDK::Params::RigHierarchy_GetParents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetParentTransform, "RigHierarchy", "GetParentTransform", SDK::Params::RigHierarchy_GetParentTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetParentTransformByIndex, "RigHierarchy", "GetParentTransformByIndex", SDK::Params::RigHierarchy_GetParentTransformByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetParentWeight, "RigHierarchy", "GetParentWeight", SDK::Params::RigHierarchy_GetParentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetParentWeightArray, "RigHierarchy", "GetParentWeightArray", SDK::Params::RigHierarchy_GetParentWeightArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetPose, "RigHierarchy", "GetPose", SDK::Params::RigHierarchy_GetPose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetPreviousName, "RigHierarchy", "GetPreviousName", SDK::Params::RigHierarchy_GetPreviousName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetPreviousParent, "RigHierarchy", "GetPreviousParent", SDK::Params::RigHierarchy_GetPreviousParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetQuatArrayMetadata, "RigHierarchy", "GetQuatArrayMetadata", SDK::Params::RigHierarchy_GetQuatArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetQuatMetadata, "RigHierarchy", "GetQuatMetadata", SDK::Params::RigHierarchy_GetQuatMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetReferenceKeys, "RigHierarchy", "GetReferenceKeys", SDK::Params::RigHierarchy_GetReferenceKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetRigElementKeyArrayMetadata, "RigHierarchy", "GetRigElementKeyArrayMetadata", SDK::Params::RigHierarchy_GetRigElementKeyArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetRigElementKeyMetadata, "RigHierarchy", "GetRigElementKeyMetadata", SDK::Params::RigHierarchy_GetRigElementKeyMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetRigidBodyKeys, "RigHierarchy", "GetRigidBodyKeys", SDK::Params::RigHierarchy_GetRigidBodyKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetRootElementKeys, "RigHierarchy", "GetRootElementKeys", SDK::Params::RigHierarchy_GetRootElementKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetRotatorArrayMetadata, "RigHierarchy", "GetRotatorArrayMetadata", SDK::Params::RigHierarchy_GetRotatorArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetRotatorMetadata, "RigHierarchy", "GetRotatorMetadata", SDK::Params::RigHierarchy_GetRotatorMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetSelectedKeys, "RigHierarchy", "GetSelectedKeys", SDK::Params::RigHierarchy_GetSelectedKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetSocketKeys, "RigHierarchy", "GetSocketKeys", SDK::Params::RigHierarchy_GetSocketKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetSocketStates, "RigHierarchy", "GetSocketStates", SDK::Params::RigHierarchy_GetSocketStates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetTags, "RigHierarchy", "GetTags", SDK::Params::RigHierarchy_GetTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetTransformArrayMetadata, "RigHierarchy", "GetTransformArrayMetadata", SDK::Params::RigHierarchy_GetTransformArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetTransformMetadata, "RigHierarchy", "GetTransformMetadata", SDK::Params::RigHierarchy_GetTransformMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetVectorArrayMetadata, "RigHierarchy", "GetVectorArrayMetadata", SDK::Params::RigHierarchy_GetVectorArrayMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, GetVectorMetadata, "RigHierarchy", "GetVectorMetadata", SDK::Params::RigHierarchy_GetVectorMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, HasTag, "RigHierarchy", "HasTag", SDK::Params::RigHierarchy_HasTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, IsControllerAvailable, "RigHierarchy", "IsControllerAvailable", SDK::Params::RigHierarchy_IsControllerAvailable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, IsCurveValueSet, "RigHierarchy", "IsCurveValueSet", SDK::Params::RigHierarchy_IsCurveValueSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, IsCurveValueSetByIndex, "RigHierarchy", "IsCurveValueSetByIndex", SDK::Params::RigHierarchy_IsCurveValueSetByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, IsParentedTo, "RigHierarchy", "IsParentedTo", SDK::Params::RigHierarchy_IsParentedTo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, IsProcedural, "RigHierarchy", "IsProcedural", SDK::Params::RigHierarchy_IsProcedural)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, IsSelected, "RigHierarchy", "IsSelected", SDK::Params::RigHierarchy_IsSelected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, IsSelectedByIndex, "RigHierarchy", "IsSelectedByIndex", SDK::Params::RigHierarchy_IsSelectedByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, IsValidIndex, "RigHierarchy", "IsValidIndex", SDK::Params::RigHierarchy_IsValidIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, Num, "RigHierarchy", "Num", SDK::Params::RigHierarchy_Num)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchy, SortKeys, "RigHierarchy", "SortKeys", SDK::Params::RigHierarchy_SortKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNodeControlRigLibrary, ConvertToControlRig, "AnimNodeControlRigLibrary", "ConvertToControlRig", SDK::Params::AnimNodeControlRigLibrary_ConvertToControlRig)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNodeControlRigLibrary, ConvertToControlRigPure, "AnimNodeControlRigLibrary", "ConvertToControlRigPure", SDK::Params::AnimNodeControlRigLibrary_ConvertToControlRigPure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNodeControlRigLibrary, SetControlRigClass, "AnimNodeControlRigLibrary", "SetControlRigClass", SDK::Params::AnimNodeControlRigLibrary_SetControlRigClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, AddMappedCompleteSkeletalMesh, "ControlRigComponent", "AddMappedCompleteSkeletalMesh", SDK::Params::ControlRigComponent_AddMappedCompleteSkeletalMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, AddMappedComponents, "ControlRigComponent", "AddMappedComponents", SDK::Params::ControlRigComponent_AddMappedComponents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, AddMappedElements, "ControlRigComponent", "AddMappedElements", SDK::Params::ControlRigComponent_AddMappedElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, AddMappedSkeletalMesh, "ControlRigComponent", "AddMappedSkeletalMesh", SDK::Params::ControlRigComponent_AddMappedSkeletalMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, CanExecute, "ControlRigComponent", "CanExecute", SDK::Params::ControlRigComponent_CanExecute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, ClearMappedElements, "ControlRigComponent", "ClearMappedElements", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, DoesElementExist, "ControlRigComponent", "DoesElementExist", SDK::Params::ControlRigComponent_DoesElementExist)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetBoneTransform, "ControlRigComponent", "GetBoneTransform", SDK::Params::ControlRigComponent_GetBoneTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlBool, "ControlRigComponent", "GetControlBool", SDK::Params::ControlRigComponent_GetControlBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlFloat, "ControlRigComponent", "GetControlFloat", SDK::Params::ControlRigComponent_GetControlFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlInt, "ControlRigComponent", "GetControlInt", SDK::Params::ControlRigComponent_GetControlInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlOffset, "ControlRigComponent", "GetControlOffset", SDK::Params::ControlRigComponent_GetControlOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlPosition, "ControlRigComponent", "GetControlPosition", SDK::Params::ControlRigComponent_GetControlPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlRig, "ControlRigComponent", "GetControlRig", SDK::Params::ControlRigComponent_GetControlRig)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlRotator, "ControlRigComponent", "GetControlRotator", SDK::Params::ControlRigComponent_GetControlRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlScale, "ControlRigComponent", "GetControlScale", SDK::Params::ControlRigComponent_GetControlScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlTransform, "ControlRigComponent", "GetControlTransform", SDK::Params::ControlRigComponent_GetControlTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetControlVector2D, "ControlRigComponent", "GetControlVector2D", SDK::Params::ControlRigComponent_GetControlVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetElementNames, "ControlRigComponent", "GetElementNames", SDK::Params::ControlRigComponent_GetElementNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetInitialBoneTransform, "ControlRigComponent", "GetInitialBoneTransform", SDK::Params::ControlRigComponent_GetInitialBoneTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetInitialSpaceTransform, "ControlRigComponent", "GetInitialSpaceTransform", SDK::Params::ControlRigComponent_GetInitialSpaceTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetSpaceTransform, "ControlRigComponent", "GetSpaceTransform", SDK::Params::ControlRigComponent_GetSpaceTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, Initialize, "ControlRigComponent", "Initialize", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, OnPostConstruction, "ControlRigComponent", "OnPostConstruction", SDK::Params::ControlRigComponent_OnPostConstruction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, OnPostForwardsSolve, "ControlRigComponent", "OnPostForwardsSolve", SDK::Params::ControlRigComponent_OnPostForwardsSolve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, OnPostInitialize, "ControlRigComponent", "OnPostInitialize", SDK::Params::ControlRigComponent_OnPostInitialize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, OnPreConstruction, "ControlRigComponent", "OnPreConstruction", SDK::Params::ControlRigComponent_OnPreConstruction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, OnPreForwardsSolve, "ControlRigComponent", "OnPreForwardsSolve", SDK::Params::ControlRigComponent_OnPreForwardsSolve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, OnPreInitialize, "ControlRigComponent", "OnPreInitialize", SDK::Params::ControlRigComponent_OnPreInitialize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetBoneInitialTransformsFromSkeletalMesh, "ControlRigComponent", "SetBoneInitialTransformsFromSkeletalMesh", SDK::Params::ControlRigComponent_SetBoneInitialTransformsFromSkeletalMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetBoneTransform, "ControlRigComponent", "SetBoneTransform", SDK::Params::ControlRigComponent_SetBoneTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlBool, "ControlRigComponent", "SetControlBool", SDK::Params::ControlRigComponent_SetControlBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlFloat, "ControlRigComponent", "SetControlFloat", SDK::Params::ControlRigComponent_SetControlFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlInt, "ControlRigComponent", "SetControlInt", SDK::Params::ControlRigComponent_SetControlInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlOffset, "ControlRigComponent", "SetControlOffset", SDK::Params::ControlRigComponent_SetControlOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlPosition, "ControlRigComponent", "SetControlPosition", SDK::Params::ControlRigComponent_SetControlPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlRigClass, "ControlRigComponent", "SetControlRigClass", SDK::Params::ControlRigComponent_SetControlRigClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlRotator, "ControlRigComponent", "SetControlRotator", SDK::Params::ControlRigComponent_SetControlRotator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlScale, "ControlRigComponent", "SetControlScale", SDK::Params::ControlRigComponent_SetControlScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlTransform, "ControlRigComponent", "SetControlTransform", SDK::Params::ControlRigComponent_SetControlTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetControlVector2D, "ControlRigComponent", "SetControlVector2D", SDK::Params::ControlRigComponent_SetControlVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetInitialBoneTransform, "ControlRigComponent", "SetInitialBoneTransform", SDK::Params::ControlRigComponent_SetInitialBoneTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetInitialSpaceTransform, "ControlRigComponent", "SetInitialSpaceTransform", SDK::Params::ControlRigComponent_SetInitialSpaceTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetMappedElements, "ControlRigComponent", "SetMappedElements", SDK::Params::ControlRigComponent_SetMappedElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, SetObjectBinding, "ControlRigComponent", "SetObjectBinding", SDK::Params::ControlRigComponent_SetObjectBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, Update, "ControlRigComponent", "Update", SDK::Params::ControlRigComponent_Update)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigComponent, GetAbsoluteTime, "ControlRigComponent", "GetAbsoluteTime", SDK::Params::ControlRigComponent_GetAbsoluteTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigControlActor, Clear, "ControlRigControlActor", "Clear", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigControlActor, Refresh, "ControlRigControlActor", "Refresh", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigControlActor, ResetControlActor, "ControlRigControlActor", "ResetControlActor", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, OnEnabledChanged, "ControlRigShapeActor", "OnEnabledChanged", SDK::Params::ControlRigShapeActor_OnEnabledChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, OnHoveredChanged, "ControlRigShapeActor", "OnHoveredChanged", SDK::Params::ControlRigShapeActor_OnHoveredChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, OnManipulatingChanged, "ControlRigShapeActor", "OnManipulatingChanged", SDK::Params::ControlRigShapeActor_OnManipulatingChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, OnSelectionChanged, "ControlRigShapeActor", "OnSelectionChanged", SDK::Params::ControlRigShapeActor_OnSelectionChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, OnTransformChanged, "ControlRigShapeActor", "OnTransformChanged", SDK::Params::ControlRigShapeActor_OnTransformChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, SetEnabled, "ControlRigShapeActor", "SetEnabled", SDK::Params::ControlRigShapeActor_SetEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, SetGlobalTransform, "ControlRigShapeActor", "SetGlobalTransform", SDK::Params::ControlRigShapeActor_SetGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, SetHovered, "ControlRigShapeActor", "SetHovered", SDK::Params::ControlRigShapeActor_SetHovered)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, SetSelectable, "ControlRigShapeActor", "SetSelectable", SDK::Params::ControlRigShapeActor_SetSelectable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, SetSelected, "ControlRigShapeActor", "SetSelected", SDK::Params::ControlRigShapeActor_SetSelected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, GetGlobalTransform, "ControlRigShapeActor", "GetGlobalTransform", SDK::Params::ControlRigShapeActor_GetGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, IsEnabled, "ControlRigShapeActor", "IsEnabled", SDK::Params::ControlRigShapeActor_IsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, IsHovered, "ControlRigShapeActor", "IsHovered", SDK::Params::ControlRigShapeActor_IsHovered)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AControlRigShapeActor, IsSelectedInEditor, "ControlRigShapeActor", "IsSelectedInEditor", SDK::Params::ControlRigShapeActor_IsSelectedInEditor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, CreateNewAsset, "ControlRigTestData", "CreateNewAsset", SDK::Params::ControlRigTestData_CreateNewAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, Record, "ControlRigTestData", "Record", SDK::Params::ControlRigTestData_Record)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, ReleaseReplay, "ControlRigTestData", "ReleaseReplay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, SetupReplay, "ControlRigTestData", "SetupReplay", SDK::Params::ControlRigTestData_SetupReplay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, GetFrameIndexForTime, "ControlRigTestData", "GetFrameIndexForTime", SDK::Params::ControlRigTestData_GetFrameIndexForTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, GetPlaybackMode, "ControlRigTestData", "GetPlaybackMode", SDK::Params::ControlRigTestData_GetPlaybackMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, GetTimeRange, "ControlRigTestData", "GetTimeRange", SDK::Params::ControlRigTestData_GetTimeRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, IsRecording, "ControlRigTestData", "IsRecording", SDK::Params::ControlRigTestData_IsRecording)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTestData, IsReplaying, "ControlRigTestData", "IsReplaying", SDK::Params::ControlRigTestData_IsReplaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, AddModule, "ModularRigController", "AddModule", SDK::Params::ModularRigController_AddModule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, AutoConnectModules, "ModularRigController", "AutoConnectModules", SDK::Params::ModularRigController_AutoConnectModules)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, AutoConnectSecondaryConnectors, "ModularRigController", "AutoConnectSecondaryConnectors", SDK::Params::ModularRigController_AutoConnectSecondaryConnectors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, BindModuleVariable, "ModularRigController", "BindModuleVariable", SDK::Params::ModularRigController_BindModuleVariable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, CanConnectConnectorToElement, "ModularRigController", "CanConnectConnectorToElement", SDK::Params::ModularRigController_CanConnectConnectorToElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, ConnectConnectorToElement, "ModularRigController", "ConnectConnectorToElement", SDK::Params::ModularRigController_ConnectConnectorToElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, DeleteModule, "ModularRigController", "DeleteModule", SDK::Params::ModularRigController_DeleteModule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, DisconnectConnector, "ModularRigController", "DisconnectConnector", SDK::Params::ModularRigController_DisconnectConnector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, DisconnectCyclicConnectors, "ModularRigController", "DisconnectCyclicConnectors", SDK::Params::ModularRigController_DisconnectCyclicConnectors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, MirrorModule, "ModularRigController", "MirrorModule", SDK::Params::ModularRigController_MirrorModule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, RenameModule, "ModularRigController", "RenameModule", SDK::Params::ModularRigController_RenameModule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, ReparentModule, "ModularRigController", "ReparentModule", SDK::Params::ModularRigController_ReparentModule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, SetConfigValueInModule, "ModularRigController", "SetConfigValueInModule", SDK::Params::ModularRigController_SetConfigValueInModule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, SetModuleShortName, "ModularRigController", "SetModuleShortName", SDK::Params::ModularRigController_SetModuleShortName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularRigController, UnBindModuleVariable, "ModularRigController", "UnBindModuleVariable", SDK::Params::ModularRigController_UnBindModuleVariable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddAnimationChannel_ForBlueprint, "RigHierarchyController", "AddAnimationChannel_ForBlueprint", SDK::Params::RigHierarchyController_AddAnimationChannel_ForBlueprint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddBone, "RigHierarchyController", "AddBone", SDK::Params::RigHierarchyController_AddBone)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddConnector, "RigHierarchyController", "AddConnector", SDK::Params::RigHierarchyController_AddConnector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddControl_ForBlueprint, "RigHierarchyController", "AddControl_ForBlueprint", SDK::Params::RigHierarchyController_AddControl_ForBlueprint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddCurve, "RigHierarchyController", "AddCurve", SDK::Params::RigHierarchyController_AddCurve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddNull, "RigHierarchyController", "AddNull", SDK::Params::RigHierarchyController_AddNull)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddParent, "RigHierarchyController", "AddParent", SDK::Params::RigHierarchyController_AddParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddRigidBody, "RigHierarchyController", "AddRigidBody", SDK::Params::RigHierarchyController_AddRigidBody)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, AddSocket, "RigHierarchyController", "AddSocket", SDK::Params::RigHierarchyController_AddSocket)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, ClearSelection, "RigHierarchyController", "ClearSelection", SDK::Params::RigHierarchyController_ClearSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, DeselectElement, "RigHierarchyController", "DeselectElement", SDK::Params::RigHierarchyController_DeselectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, DuplicateElements, "RigHierarchyController", "DuplicateElements", SDK::Params::RigHierarchyController_DuplicateElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, ImportBones, "RigHierarchyController", "ImportBones", SDK::Params::RigHierarchyController_ImportBones)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, ImportCurves, "RigHierarchyController", "ImportCurves", SDK::Params::RigHierarchyController_ImportCurves)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, ImportFromText, "RigHierarchyController", "ImportFromText", SDK::Params::RigHierarchyController_ImportFromText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, MirrorElements, "RigHierarchyController", "MirrorElements", SDK::Params::RigHierarchyController_MirrorElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, RemoveAllParents, "RigHierarchyController", "RemoveAllParents", SDK::Params::RigHierarchyController_RemoveAllParents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, RemoveElement, "RigHierarchyController", "RemoveElement", SDK::Params::RigHierarchyController_RemoveElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, RemoveParent, "RigHierarchyController", "RemoveParent", SDK::Params::RigHierarchyController_RemoveParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, RenameElement, "RigHierarchyController", "RenameElement", SDK::Params::RigHierarchyController_RenameElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, ReorderElement, "RigHierarchyController", "ReorderElement", SDK::Params::RigHierarchyController_ReorderElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, SelectElement, "RigHierarchyController", "SelectElement", SDK::Params::RigHierarchyController_SelectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, SetDisplayName, "RigHierarchyController", "SetDisplayName", SDK::Params::RigHierarchyController_SetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, SetHierarchy, "RigHierarchyController", "SetHierarchy", SDK::Params::RigHierarchyController_SetHierarchy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, SetParent, "RigHierarchyController", "SetParent", SDK::Params::RigHierarchyController_SetParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, SetSelection, "RigHierarchyController", "SetSelection", SDK::Params::RigHierarchyController_SetSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, ExportSelectionToText, "RigHierarchyController", "ExportSelectionToText", SDK::Params::RigHierarchyController_ExportSelectionToText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, ExportToText, "RigHierarchyController", "ExportToText", SDK::Params::RigHierarchyController_ExportToText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, GetControlSettings, "RigHierarchyController", "GetControlSettings", SDK::Params::RigHierarchyController_GetControlSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, GetHierarchy, "RigHierarchyController", "GetHierarchy", SDK::Params::RigHierarchyController_GetHierarchy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigHierarchyController, SetControlSettings, "RigHierarchyController", "SetControlSettings", SDK::Params::RigHierarchyController_SetControlSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigPoseAsset, GetCurrentPose, "ControlRigPoseAsset", "GetCurrentPose", SDK::Params::ControlRigPoseAsset_GetCurrentPose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigPoseAsset, PastePose, "ControlRigPoseAsset", "PastePose", SDK::Params::ControlRigPoseAsset_PastePose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigPoseAsset, ReplaceControlName, "ControlRigPoseAsset", "ReplaceControlName", SDK::Params::ControlRigPoseAsset_ReplaceControlName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigPoseAsset, SavePose, "ControlRigPoseAsset", "SavePose", SDK::Params::ControlRigPoseAsset_SavePose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigPoseAsset, SelectControls, "ControlRigPoseAsset", "SelectControls", SDK::Params::ControlRigPoseAsset_SelectControls)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigPoseAsset, DoesMirrorMatch, "ControlRigPoseAsset", "DoesMirrorMatch", SDK::Params::ControlRigPoseAsset_DoesMirrorMatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigPoseAsset, GetControlNames, "ControlRigPoseAsset", "GetControlNames", SDK::Params::ControlRigPoseAsset_GetControlNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigWorkflowOptions, EnsureAtLeastOneRigElementSelected, "ControlRigWorkflowOptions", "EnsureAtLeastOneRigElementSelected", SDK::Params::ControlRigWorkflowOptions_EnsureAtLeastOneRigElementSelected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UControlRigTransformWorkflowOptions, ProvideWorkflows, "ControlRigTransformWorkflowOptions", "ProvideWorkflows", SDK::Params::ControlRigTransformWorkflowOptions_ProvideWorkflows)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from CoreUObject_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/CoreUObject_classes.hpp"
+#include "../SDK/CoreUObject_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UObject, ExecuteUbergraph, "Object", "ExecuteUbergraph", SDK::Params::Object_ExecuteUbergraph)
+// clang-format on
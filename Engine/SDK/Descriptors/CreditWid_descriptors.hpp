@@ -0,0 +1,18 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from CreditWid_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/CreditWid_classes.hpp"
+#include "../SDK/CreditWid_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreditWid_C, BndEvt__CreditWid_BackButton_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "CreditWid_C", "BndEvt__CreditWid_BackButton_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreditWid_C, BndEvt__CreditWid_BackButton_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature, "CreditWid_C", "BndEvt__CreditWid_BackButton_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreditWid_C, BndEvt__CreditWid_BackButton_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature, "CreditWid_C", "BndEvt__CreditWid_BackButton_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreditWid_C, ExecuteUbergraph_CreditWid, "CreditWid_C", "ExecuteUbergraph_CreditWid", SDK::Params::CreditWid_C_ExecuteUbergraph_CreditWid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreditWid_C, GetLastOpenedWidget, "CreditWid_C", "GetLastOpenedWidget", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreditWid_C, SetLastOpenedWidget, "CreditWid_C", "SetLastOpenedWidget", SDK::Params::CreditWid_C_SetLastOpenedWidget)
+// clang-format on
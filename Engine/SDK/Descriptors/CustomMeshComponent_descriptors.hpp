@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from CustomMeshComponent_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/CustomMeshComponent_classes.hpp"
+#include "../SDK/CustomMeshComponent_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCustomMeshComponent, AddCustomMeshTriangles, "CustomMeshComponent", "AddCustomMeshTriangles", SDK::Params::CustomMeshComponent_AddCustomMeshTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCustomMeshComponent, ClearCustomMeshTriangles, "CustomMeshComponent", "ClearCustomMeshTriangles", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCustomMeshComponent, SetCustomMeshTriangles, "CustomMeshComponent", "SetCustomMeshTriangles", SDK::Params::CustomMeshComponent_SetCustomMeshTriangles)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from DataflowEngine_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/DataflowEngine_classes.hpp"
+#include "../SDK/DataflowEngine_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDataflowBlueprintLibrary, EvaluateTerminalNodeByName, "DataflowBlueprintLibrary", "EvaluateTerminalNodeByName", SDK::Params::DataflowBlueprintLibrary_EvaluateTerminalNodeByName)
+// clang-format on
@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from DatasmithContent_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/DatasmithContent_classes.hpp"
+#include "../SDK/DatasmithContent_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDatasmithContentBlueprintLibrary, GetDatasmithUserData, "DatasmithContentBlueprintLibrary", "GetDatasmithUserData", SDK::Params::DatasmithContentBlueprintLibrary_GetDatasmithUserData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDatasmithContentBlueprintLibrary, GetDatasmithUserDataKeysAndValuesForValue, "DatasmithContentBlueprintLibrary", "GetDatasmithUserDataKeysAndValuesForValue", SDK::Params::DatasmithContentBlueprintLibrary_GetDatasmithUserDataKeysAndValuesForValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDatasmithContentBlueprintLibrary, GetDatasmithUserDataValueForKey, "DatasmithContentBlueprintLibrary", "GetDatasmithUserDataValueForKey", SDK::Params::DatasmithContentBlueprintLibrary_GetDatasmithUserDataValueForKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDatasmithContentBlueprintLibrary, GetDatasmithUserDataValuesForKey, "DatasmithContentBlueprintLibrary", "GetDatasmithUserDataValuesForKey", SDK::Params::DatasmithContentBlueprintLibrary_GetDatasmithUserDataValuesForKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ADatasmithImportedSequencesActor, PlayLevelSequence, "DatasmithImportedSequencesActor", "PlayLevelSequence", SDK::Params::DatasmithImportedSequencesActor_PlayLevelSequence)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from EngineSettings_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/EngineSettings_classes.hpp"
+#include "../SDK/EngineSettings_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameMapsSettings, GetGameMapsSettings, "GameMapsSettings", "GetGameMapsSettings", SDK::Params::GameMapsSettings_GetGameMapsSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameMapsSettings, SetSkipAssigningGamepadToPlayer1, "GameMapsSettings", "SetSkipAssigningGamepadToPlayer1", SDK::Params::GameMapsSettings_SetSkipAssigningGamepadToPlayer1)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameMapsSettings, GetSkipAssigningGamepadToPlayer1, "GameMapsSettings", "GetSkipAssigningGamepadToPlayer1", SDK::Params::GameMapsSettings_GetSkipAssigningGamepadToPlayer1)
+// clang-format on
@@ -0,0 +1,20 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from EngineUserSettings_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/EngineUserSettings_classes.hpp"
+#include "../SDK/EngineUserSettings_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEngineUserSettingsBPLibrary, GetCurrentFeatureLevel, "EngineUserSettingsBPLibrary", "GetCurrentFeatureLevel", SDK::Params::EngineUserSettingsBPLibrary_GetCurrentFeatureLevel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEngineUserSettingsBPLibrary, GetCurrentRHI, "EngineUserSettingsBPLibrary", "GetCurrentRHI", SDK::Params::EngineUserSettingsBPLibrary_GetCurrentRHI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEngineUserSettingsBPLibrary, GetMaxFeatureLevel, "EngineUserSettingsBPLibrary", "GetMaxFeatureLevel", SDK::Params::EngineUserSettingsBPLibrary_GetMaxFeatureLevel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEngineUserSettingsBPLibrary, GetPreferredFeatureLevel, "EngineUserSettingsBPLibrary", "GetPreferredFeatureLevel", SDK::Params::EngineUserSettingsBPLibrary_GetPreferredFeatureLevel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEngineUserSettingsBPLibrary, GetPreferredRHI, "EngineUserSettingsBPLibrary", "GetPreferredRHI", SDK::Params::EngineUserSettingsBPLibrary_GetPreferredRHI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEngineUserSettingsBPLibrary, SetGameUserSettingsIniValue, "EngineUserSettingsBPLibrary", "SetGameUserSettingsIniValue", SDK::Params::EngineUserSettingsBPLibrary_SetGameUserSettingsIniValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEngineUserSettingsBPLibrary, SetPreferredFeatureLevel, "EngineUserSettingsBPLibrary", "SetPreferredFeatureLevel", SDK::Params::EngineUserSettingsBPLibrary_SetPreferredFeatureLevel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEngineUserSettingsBPLibrary, SetPreferredRHI, "EngineUserSettingsBPLibrary", "SetPreferredRHI", SDK::Params::EngineUserSettingsBPLibrary_SetPreferredRHI)
+// clang-format on
@@ -0,0 +1,113 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from EnhancedInput_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/EnhancedInput_classes.hpp"
+#include "../SDK/EnhancedInput_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, ResetMappingToDefault, "EnhancedPlayerMappableKeyProfile", "ResetMappingToDefault", SDK::Params::EnhancedPlayerMappableKeyProfile_ResetMappingToDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, ResetToDefault, "EnhancedPlayerMappableKeyProfile", "ResetToDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, SetDisplayName, "EnhancedPlayerMappableKeyProfile", "SetDisplayName", SDK::Params::EnhancedPlayerMappableKeyProfile_SetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, DoesMappingPassQueryOptions, "EnhancedPlayerMappableKeyProfile", "DoesMappingPassQueryOptions", SDK::Params::EnhancedPlayerMappableKeyProfile_DoesMappingPassQueryOptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, DumpProfileToLog, "EnhancedPlayerMappableKeyProfile", "DumpProfileToLog", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, GetMappedKeysInRow, "EnhancedPlayerMappableKeyProfile", "GetMappedKeysInRow", SDK::Params::EnhancedPlayerMappableKeyProfile_GetMappedKeysInRow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, GetMappingNamesForKey, "EnhancedPlayerMappableKeyProfile", "GetMappingNamesForKey", SDK::Params::EnhancedPlayerMappableKeyProfile_GetMappingNamesForKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, GetPlayerMappingRows, "EnhancedPlayerMappableKeyProfile", "GetPlayerMappingRows", SDK::Params::EnhancedPlayerMappableKeyProfile_GetPlayerMappingRows)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, GetProfileDisplayName, "EnhancedPlayerMappableKeyProfile", "GetProfileDisplayName", SDK::Params::EnhancedPlayerMappableKeyProfile_GetProfileDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, GetProfileIdentifer, "EnhancedPlayerMappableKeyProfile", "GetProfileIdentifer", SDK::Params::EnhancedPlayerMappableKeyProfile_GetProfileIdentifer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, K2_FindKeyMapping, "EnhancedPlayerMappableKeyProfile", "K2_FindKeyMapping", SDK::Params::EnhancedPlayerMappableKeyProfile_K2_FindKeyMapping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, QueryPlayerMappedKeys, "EnhancedPlayerMappableKeyProfile", "QueryPlayerMappedKeys", SDK::Params::EnhancedPlayerMappableKeyProfile_QueryPlayerMappedKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedPlayerMappableKeyProfile, ToString, "EnhancedPlayerMappableKeyProfile", "ToString", SDK::Params::EnhancedPlayerMappableKeyProfile_ToString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, ApplySettings, "EnhancedInputUserSettings", "ApplySettings", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, AsyncSaveSettings, "EnhancedInputUserSettings", "AsyncSaveSettings", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, CreateNewKeyProfile, "EnhancedInputUserSettings", "CreateNewKeyProfile", SDK::Params::EnhancedInputUserSettings_CreateNewKeyProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, MapPlayerKey, "EnhancedInputUserSettings", "MapPlayerKey", SDK::Params::EnhancedInputUserSettings_MapPlayerKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, RegisterInputMappingContext, "EnhancedInputUserSettings", "RegisterInputMappingContext", SDK::Params::EnhancedInputUserSettings_RegisterInputMappingContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, RegisterInputMappingContexts, "EnhancedInputUserSettings", "RegisterInputMappingContexts", SDK::Params::EnhancedInputUserSettings_RegisterInputMappingContexts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, ResetAllPlayerKeysInRow, "EnhancedInputUserSettings", "ResetAllPlayerKeysInRow", SDK::Params::EnhancedInputUserSettings_ResetAllPlayerKeysInRow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, ResetKeyProfileToDefault, "EnhancedInputUserSettings", "ResetKeyProfileToDefault", SDK::Params::EnhancedInputUserSettings_ResetKeyProfileToDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, SaveSettings, "EnhancedInputUserSettings", "SaveSettings", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, SetKeyProfile, "EnhancedInputUserSettings", "SetKeyProfile", SDK::Params::EnhancedInputUserSettings_SetKeyProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, UnMapPlayerKey, "EnhancedInputUserSettings", "UnMapPlayerKey", SDK::Params::EnhancedInputUserSettings_UnMapPlayerKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, UnregisterInputMappingContext, "EnhancedInputUserSettings", "UnregisterInputMappingContext", SDK::Params::EnhancedInputUserSettings_UnregisterInputMappingContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, UnregisterInputMappingContexts, "EnhancedInputUserSettings", "UnregisterInputMappingContexts", SDK::Params::EnhancedInputUserSettings_UnregisterInputMappingContexts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, FindMappingsInRow, "EnhancedInputUserSettings", "FindMappingsInRow", SDK::Params::EnhancedInputUserSettings_FindMappingsInRow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, GetCurrentKeyProfile, "EnhancedInputUserSettings", "GetCurrentKeyProfile", SDK::Params::EnhancedInputUserSettings_GetCurrentKeyProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, GetCurrentKeyProfileIdentifier, "EnhancedInputUserSettings", "GetCurrentKeyProfileIdentifier", SDK::Params::EnhancedInputUserSettings_GetCurrentKeyProfileIdentifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, GetKeyProfileWithIdentifier, "EnhancedInputUserSettings", "GetKeyProfileWithIdentifier", SDK::Params::EnhancedInputUserSettings_GetKeyProfileWithIdentifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputUserSettings, IsMappingContextRegistered, "EnhancedInputUserSettings", "IsMappingContextRegistered", SDK::Params::EnhancedInputUserSettings_IsMappingContextRegistered)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputComponent, GetBoundActionValue, "EnhancedInputComponent", "GetBoundActionValue", SDK::Params::EnhancedInputComponent_GetBoundActionValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, BreakInputActionValue, "EnhancedInputLibrary", "BreakInputActionValue", SDK::Params::EnhancedInputLibrary_BreakInputActionValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, Conv_InputActionValueToAxis1D, "EnhancedInputLibrary", "Conv_InputActionValueToAxis1D", SDK::Params::EnhancedInputLibrary_Conv_InputActionValueToAxis1D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, Conv_InputActionValueToAxis2D, "EnhancedInputLibrary", "Conv_InputActionValueToAxis2D", SDK::Params::EnhancedInputLibrary_Conv_InputActionValueToAxis2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, Conv_InputActionValueToAxis3D, "EnhancedInputLibrary", "Conv_InputActionValueToAxis3D", SDK::Params::EnhancedInputLibrary_Conv_InputActionValueToAxis3D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, Conv_InputActionValueToBool, "EnhancedInputLibrary", "Conv_InputActionValueToBool", SDK::Params::EnhancedInputLibrary_Conv_InputActionValueToBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, Conv_InputActionValueToString, "EnhancedInputLibrary", "Conv_InputActionValueToString", SDK::Params::EnhancedInputLibrary_Conv_InputActionValueToString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, GetBoundActionValue, "EnhancedInputLibrary", "GetBoundActionValue", SDK::Params::EnhancedInputLibrary_GetBoundActionValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, GetFirstPlayerMappableKeySlot, "EnhancedInputLibrary", "GetFirstPlayerMappableKeySlot", SDK::Params::EnhancedInputLibrary_GetFirstPlayerMappableKeySlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, GetFourthPlayerMappableKeySlot, "EnhancedInputLibrary", "GetFourthPlayerMappableKeySlot", SDK::Params::EnhancedInputLibrary_GetFourthPlayerMappableKeySlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, GetMappingName, "EnhancedInputLibrary", "GetMappingName", SDK::Params::EnhancedInputLibrary_GetMappingName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, GetPlayerMappableKeySettings, "EnhancedInputLibrary", "GetPlayerMappableKeySettings", SDK::Params::EnhancedInputLibrary_GetPlayerMappableKeySettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, GetSecondPlayerMappableKeySlot, "EnhancedInputLibrary", "GetSecondPlayerMappableKeySlot", SDK::Params::EnhancedInputLibrary_GetSecondPlayerMappableKeySlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, GetThirdPlayerMappableKeySlot, "EnhancedInputLibrary", "GetThirdPlayerMappableKeySlot", SDK::Params::EnhancedInputLibrary_GetThirdPlayerMappableKeySlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, IsActionKeyMappingPlayerMappable, "EnhancedInputLibrary", "IsActionKeyMappingPlayerMappable", SDK::Params::EnhancedInputLibrary_IsActionKeyMappingPlayerMappable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, MakeInputActionValue, "EnhancedInputLibrary", "MakeInputActionValue", SDK::Params::EnhancedInputLibrary_MakeInputActionValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, MakeInputActionValueOfType, "EnhancedInputLibrary", "MakeInputActionValueOfType", SDK::Params::EnhancedInputLibrary_MakeInputActionValueOfType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputLibrary, RequestRebuildControlMappingsUsingContext, "EnhancedInputLibrary", "RequestRebuildControlMappingsUsingContext", SDK::Params::EnhancedInputLibrary_RequestRebuildControlMappingsUsingContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputPlatformData, GetContextRedirect, "EnhancedInputPlatformData", "GetContextRedirect", SDK::Params::EnhancedInputPlatformData_GetContextRedirect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, AddMappingContext, "EnhancedInputSubsystemInterface", "AddMappingContext", SDK::Params::EnhancedInputSubsystemInterface_AddMappingContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, AddPlayerMappableConfig, "EnhancedInputSubsystemInterface", "AddPlayerMappableConfig", SDK::Params::EnhancedInputSubsystemInterface_AddPlayerMappableConfig)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, ClearAllMappings, "EnhancedInputSubsystemInterface", "ClearAllMappings", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, InjectInputForAction, "EnhancedInputSubsystemInterface", "InjectInputForAction", SDK::Params::EnhancedInputSubsystemInterface_InjectInputForAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, InjectInputForPlayerMapping, "EnhancedInputSubsystemInterface", "InjectInputForPlayerMapping", SDK::Params::EnhancedInputSubsystemInterface_InjectInputForPlayerMapping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, InjectInputVectorForAction, "EnhancedInputSubsystemInterface", "InjectInputVectorForAction", SDK::Params::EnhancedInputSubsystemInterface_InjectInputVectorForAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, InjectInputVectorForPlayerMapping, "EnhancedInputSubsystemInterface", "InjectInputVectorForPlayerMapping", SDK::Params::EnhancedInputSubsystemInterface_InjectInputVectorForPlayerMapping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, K2_AddPlayerMappedKeyInSlot, "EnhancedInputSubsystemInterface", "K2_AddPlayerMappedKeyInSlot", SDK::Params::EnhancedInputSubsystemInterface_K2_AddPlayerMappedKeyInSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, K2_RemovePlayerMappedKeyInSlot, "EnhancedInputSubsystemInterface", "K2_RemovePlayerMappedKeyInSlot", SDK::Params::EnhancedInputSubsystemInterface_K2_RemovePlayerMappedKeyInSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, OnUserKeyProfileChanged, "EnhancedInputSubsystemInterface", "OnUserKeyProfileChanged", SDK::Params::EnhancedInputSubsystemInterface_OnUserKeyProfileChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, OnUserSettingsChanged, "EnhancedInputSubsystemInterface", "OnUserSettingsChanged", SDK::Params::EnhancedInputSubsystemInterface_OnUserSettingsChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, QueryMapKeyInActiveContextSet, "EnhancedInputSubsystemInterface", "QueryMapKeyInActiveContextSet", SDK::Params::EnhancedInputSubsystemInterface_QueryMapKeyInActiveContextSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, QueryMapKeyInContextSet, "EnhancedInputSubsystemInterface", "QueryMapKeyInContextSet", SDK::Params::EnhancedInputSubsystemInterface_QueryMapKeyInContextSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, RemoveAllPlayerMappedKeys, "EnhancedInputSubsystemInterface", "RemoveAllPlayerMappedKeys", SDK::Params::EnhancedInputSubsystemInterface_RemoveAllPlayerMappedKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, RemoveAllPlayerMappedKeysForMapping, "EnhancedInputSubsystemInterface", "RemoveAllPlayerMappedKeysForMapping", SDK::Params::EnhancedInputSubsystemInterface_RemoveAllPlayerMappedKeysForMapping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, RemoveMappingContext, "EnhancedInputSubsystemInterface", "RemoveMappingContext", SDK::Params::EnhancedInputSubsystemInterface_RemoveMappingContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, RemovePlayerMappableConfig, "EnhancedInputSubsystemInterface", "RemovePlayerMappableConfig", SDK::Params::EnhancedInputSubsystemInterface_RemovePlayerMappableConfig)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, RequestRebuildControlMappings, "EnhancedInputSubsystemInterface", "RequestRebuildControlMappings", SDK::Params::EnhancedInputSubsystemInterface_RequestRebuildControlMappings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, StartContinuousInputInjectionForAction, "EnhancedInputSubsystemInterface", "StartContinuousInputInjectionForAction", SDK::Params::EnhancedInputSubsystemInterface_StartContinuousInputInjectionForAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, StartContinuousInputInjectionForPlayerMapping, "EnhancedInputSubsystemInterface", "StartContinuousInputInjectionForPlayerMapping", SDK::Params::EnhancedInputSubsystemInterface_StartContinuousInputInjectionForPlayerMapping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, StopContinuousInputInjectionForAction, "EnhancedInputSubsystemInterface", "StopContinuousInputInjectionForAction", SDK::Params::EnhancedInputSubsystemInterface_StopContinuousInputInjectionForAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, StopContinuousInputInjectionForPlayerMapping, "EnhancedInputSubsystemInterface", "StopContinuousInputInjectionForPlayerMapping", SDK::Params::EnhancedInputSubsystemInterface_StopContinuousInputInjectionForPlayerMapping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, UpdateValueOfContinuousInputInjectionForAction, "EnhancedInputSubsystemInterface", "UpdateValueOfContinuousInputInjectionForAction", SDK::Params::EnhancedInputSubsystemInterface_UpdateValueOfContinuousInputInjectionForAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, UpdateValueOfContinuousInputInjectionForPlayerMapping, "EnhancedInputSubsystemInterface", "UpdateValueOfContinuousInputInjectionForPlayerMapping", SDK::Params::EnhancedInputSubsystemInterface_UpdateValueOfContinuousInputInjectionForPlayerMapping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, GetAllPlayerMappableActionKeyMappings, "EnhancedInputSubsystemInterface", "GetAllPlayerMappableActionKeyMappings", SDK::Params::EnhancedInputSubsystemInterface_GetAllPlayerMappableActionKeyMappings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, GetAllPlayerMappedKeys, "EnhancedInputSubsystemInterface", "GetAllPlayerMappedKeys", SDK::Params::EnhancedInputSubsystemInterface_GetAllPlayerMappedKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, GetUserSettings, "EnhancedInputSubsystemInterface", "GetUserSettings", SDK::Params::EnhancedInputSubsystemInterface_GetUserSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, HasMappingContext, "EnhancedInputSubsystemInterface", "HasMappingContext", SDK::Params::EnhancedInputSubsystemInterface_HasMappingContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, K2_GetPlayerMappedKeyInSlot, "EnhancedInputSubsystemInterface", "K2_GetPlayerMappedKeyInSlot", SDK::Params::EnhancedInputSubsystemInterface_K2_GetPlayerMappedKeyInSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IEnhancedInputSubsystemInterface, QueryKeysMappedToAction, "EnhancedInputSubsystemInterface", "QueryKeysMappedToAction", SDK::Params::EnhancedInputSubsystemInterface_QueryKeysMappedToAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputModifier, GetVisualizationColor, "InputModifier", "GetVisualizationColor", SDK::Params::InputModifier_GetVisualizationColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputModifier, ModifyRaw, "InputModifier", "ModifyRaw", SDK::Params::InputModifier_ModifyRaw)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputWorldSubsystem, AddActorInputComponent, "EnhancedInputWorldSubsystem", "AddActorInputComponent", SDK::Params::EnhancedInputWorldSubsystem_AddActorInputComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEnhancedInputWorldSubsystem, RemoveActorInputComponent, "EnhancedInputWorldSubsystem", "RemoveActorInputComponent", SDK::Params::EnhancedInputWorldSubsystem_RemoveActorInputComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputMappingContext, MapKey, "InputMappingContext", "MapKey", SDK::Params::InputMappingContext_MapKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputMappingContext, UnmapAction, "InputMappingContext", "UnmapAction", SDK::Params::InputMappingContext_UnmapAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputMappingContext, UnmapAll, "InputMappingContext", "UnmapAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputMappingContext, UnmapAllKeysFromAction, "InputMappingContext", "UnmapAllKeysFromAction", SDK::Params::InputMappingContext_UnmapAllKeysFromAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputMappingContext, UnmapKey, "InputMappingContext", "UnmapKey", SDK::Params::InputMappingContext_UnmapKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputTrigger, UpdateState, "InputTrigger", "UpdateState", SDK::Params::InputTrigger_UpdateState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputTrigger, GetTriggerType, "InputTrigger", "GetTriggerType", SDK::Params::InputTrigger_GetTriggerType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputTrigger, IsActuated, "InputTrigger", "IsActuated", SDK::Params::InputTrigger_IsActuated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, ResetToDefault, "PlayerMappableInputConfig", "ResetToDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, GetConfigName, "PlayerMappableInputConfig", "GetConfigName", SDK::Params::PlayerMappableInputConfig_GetConfigName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, GetDisplayName, "PlayerMappableInputConfig", "GetDisplayName", SDK::Params::PlayerMappableInputConfig_GetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, GetKeysBoundToAction, "PlayerMappableInputConfig", "GetKeysBoundToAction", SDK::Params::PlayerMappableInputConfig_GetKeysBoundToAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, GetMappingByName, "PlayerMappableInputConfig", "GetMappingByName", SDK::Params::PlayerMappableInputConfig_GetMappingByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, GetMappingContexts, "PlayerMappableInputConfig", "GetMappingContexts", SDK::Params::PlayerMappableInputConfig_GetMappingContexts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, GetMetadata, "PlayerMappableInputConfig", "GetMetadata", SDK::Params::PlayerMappableInputConfig_GetMetadata)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, GetPlayerMappableKeys, "PlayerMappableInputConfig", "GetPlayerMappableKeys", SDK::Params::PlayerMappableInputConfig_GetPlayerMappableKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlayerMappableInputConfig, IsDeprecated, "PlayerMappableInputConfig", "IsDeprecated", SDK::Params::PlayerMappableInputConfig_IsDeprecated)
+// clang-format on
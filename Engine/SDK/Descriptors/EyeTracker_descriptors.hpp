@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from EyeTracker_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/EyeTracker_classes.hpp"
+#include "../SDK/EyeTracker_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEyeTrackerFunctionLibrary, GetGazeData, "EyeTrackerFunctionLibrary", "GetGazeData", SDK::Params::EyeTrackerFunctionLibrary_GetGazeData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEyeTrackerFunctionLibrary, GetStereoGazeData, "EyeTrackerFunctionLibrary", "GetStereoGazeData", SDK::Params::EyeTrackerFunctionLibrary_GetStereoGazeData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEyeTrackerFunctionLibrary, IsEyeTrackerConnected, "EyeTrackerFunctionLibrary", "IsEyeTrackerConnected", SDK::Params::EyeTrackerFunctionLibrary_IsEyeTrackerConnected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEyeTrackerFunctionLibrary, IsStereoGazeDataAvailable, "EyeTrackerFunctionLibrary", "IsStereoGazeDataAvailable", SDK::Params::EyeTrackerFunctionLibrary_IsStereoGazeDataAvailable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEyeTrackerFunctionLibrary, SetEyeTrackedPlayer, "EyeTrackerFunctionLibrary", "SetEyeTrackedPlayer", SDK::Params::EyeTrackerFunctionLibrary_SetEyeTrackedPlayer)
+// clang-format on
@@ -0,0 +1,42 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from FieldSystemEngine_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/FieldSystemEngine_classes.hpp"
+#include "../SDK/FieldSystemEngine_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, AddFieldCommand, "FieldSystemComponent", "AddFieldCommand", SDK::Params::FieldSystemComponent_AddFieldCommand)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, AddPersistentField, "FieldSystemComponent", "AddPersistentField", SDK::Params::FieldSystemComponent_AddPersistentField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, ApplyLinearForce, "FieldSystemComponent", "ApplyLinearForce", SDK::Params::FieldSystemComponent_ApplyLinearForce)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, ApplyPhysicsField, "FieldSystemComponent", "ApplyPhysicsField", SDK::Params::FieldSystemComponent_ApplyPhysicsField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, ApplyRadialForce, "FieldSystemComponent", "ApplyRadialForce", SDK::Params::FieldSystemComponent_ApplyRadialForce)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, ApplyRadialVectorFalloffForce, "FieldSystemComponent", "ApplyRadialVectorFalloffForce", SDK::Params::FieldSystemComponent_ApplyRadialVectorFalloffForce)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, ApplyStayDynamicField, "FieldSystemComponent", "ApplyStayDynamicField", SDK::Params::FieldSystemComponent_ApplyStayDynamicField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, ApplyStrainField, "FieldSystemComponent", "ApplyStrainField", SDK::Params::FieldSystemComponent_ApplyStrainField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, ApplyUniformVectorFalloffForce, "FieldSystemComponent", "ApplyUniformVectorFalloffForce", SDK::Params::FieldSystemComponent_ApplyUniformVectorFalloffForce)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, RemovePersistentFields, "FieldSystemComponent", "RemovePersistentFields", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemComponent, ResetFieldSystem, "FieldSystemComponent", "ResetFieldSystem", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemMetaDataIteration, SetMetaDataIteration, "FieldSystemMetaDataIteration", "SetMetaDataIteration", SDK::Params::FieldSystemMetaDataIteration_SetMetaDataIteration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemMetaDataProcessingResolution, SetMetaDataaProcessingResolutionType, "FieldSystemMetaDataProcessingResolution", "SetMetaDataaProcessingResolutionType", SDK::Params::FieldSystemMetaDataProcessingResolution_SetMetaDataaProcessingResolutionType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFieldSystemMetaDataFilter, SetMetaDataFilterType, "FieldSystemMetaDataFilter", "SetMetaDataFilterType", SDK::Params::FieldSystemMetaDataFilter_SetMetaDataFilterType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformInteger, SetUniformInteger, "UniformInteger", "SetUniformInteger", SDK::Params::UniformInteger_SetUniformInteger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialIntMask, SetRadialIntMask, "RadialIntMask", "SetRadialIntMask", SDK::Params::RadialIntMask_SetRadialIntMask)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformScalar, SetUniformScalar, "UniformScalar", "SetUniformScalar", SDK::Params::UniformScalar_SetUniformScalar)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWaveScalar, SetWaveScalar, "WaveScalar", "SetWaveScalar", SDK::Params::WaveScalar_SetWaveScalar)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialFalloff, SetRadialFalloff, "RadialFalloff", "SetRadialFalloff", SDK::Params::RadialFalloff_SetRadialFalloff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlaneFalloff, SetPlaneFalloff, "PlaneFalloff", "SetPlaneFalloff", SDK::Params::PlaneFalloff_SetPlaneFalloff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBoxFalloff, SetBoxFalloff, "BoxFalloff", "SetBoxFalloff", SDK::Params::BoxFalloff_SetBoxFalloff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNoiseField, SetNoiseField, "NoiseField", "SetNoiseField", SDK::Params::NoiseField_SetNoiseField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformVector, SetUniformVector, "UniformVector", "SetUniformVector", SDK::Params::UniformVector_SetUniformVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URadialVector, SetRadialVector, "RadialVector", "SetRadialVector", SDK::Params::RadialVector_SetRadialVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URandomVector, SetRandomVector, "RandomVector", "SetRandomVector", SDK::Params::RandomVector_SetRandomVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOperatorField, SetOperatorField, "OperatorField", "SetOperatorField", SDK::Params::OperatorField_SetOperatorField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UToIntegerField, SetToIntegerField, "ToIntegerField", "SetToIntegerField", SDK::Params::ToIntegerField_SetToIntegerField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UToFloatField, SetToFloatField, "ToFloatField", "SetToFloatField", SDK::Params::ToFloatField_SetToFloatField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCullingField, SetCullingField, "CullingField", "SetCullingField", SDK::Params::CullingField_SetCullingField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UReturnResultsTerminal, SetReturnResultsTerminal, "ReturnResultsTerminal", "SetReturnResultsTerminal", SDK::Params::ReturnResultsTerminal_SetReturnResultsTerminal)
+// clang-format on
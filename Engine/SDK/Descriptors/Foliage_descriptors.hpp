@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Foliage_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Foliage_classes.hpp"
+#include "../SDK/Foliage_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFoliageStatistics, FoliageOverlappingBoxCount, "FoliageStatistics", "FoliageOverlappingBoxCount", SDK::Params::FoliageStatistics_FoliageOverlappingBoxCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFoliageStatistics, FoliageOverlappingBoxTransforms, "FoliageStatistics", "FoliageOverlappingBoxTransforms", SDK::Params::FoliageStatistics_FoliageOverlappingBoxTransforms)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFoliageStatistics, FoliageOverlappingSphereCount, "FoliageStatistics", "FoliageOverlappingSphereCount", SDK::Params::FoliageStatistics_FoliageOverlappingSphereCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AInteractiveFoliageActor, CapsuleTouched, "InteractiveFoliageActor", "CapsuleTouched", SDK::Params::InteractiveFoliageActor_CapsuleTouched)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralFoliageSpawner, Simulate, "ProceduralFoliageSpawner", "Simulate", SDK::Params::ProceduralFoliageSpawner_Simulate)
+// clang-format on
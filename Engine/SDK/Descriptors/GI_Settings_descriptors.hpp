@@ -0,0 +1,21 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GI_Settings_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GI_Settings_classes.hpp"
+#include "../SDK/GI_Settings_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, ExecuteUbergraph_GI_Settings, "GI_Settings_C", "ExecuteUbergraph_GI_Settings", SDK::Params::GI_Settings_C_ExecuteUbergraph_GI_Settings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, Play_Music, "GI_Settings_C", "Play Music", SDK::Params::GI_Settings_C_Play_Music)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, Save_Settings, "GI_Settings_C", "Save Settings", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, Set_Foe_Equipment, "GI_Settings_C", "Set Foe Equipment", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, Set_Player_Equipment, "GI_Settings_C", "Set Player Equipment", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, Set_Team_Equipment, "GI_Settings_C", "Set Team Equipment", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, Set_Up_Interface, "GI_Settings_C", "Set Up Interface", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, Set_Up_Sound_Volume, "GI_Settings_C", "Set Up Sound Volume", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGI_Settings_C, Stop_Music, "GI_Settings_C", "Stop Music", void)
+// clang-format on
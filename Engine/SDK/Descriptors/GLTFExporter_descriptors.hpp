@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GLTFExporter_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GLTFExporter_classes.hpp"
+#include "../SDK/GLTFExporter_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGLTFExportOptions, ResetToDefault, "GLTFExportOptions", "ResetToDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGLTFExporter, ExportToGLTF, "GLTFExporter", "ExportToGLTF", SDK::Params::GLTFExporter_ExportToGLTF)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGLTFProxyOptions, ResetToDefault, "GLTFProxyOptions", "ResetToDefault", void)
+// clang-format on
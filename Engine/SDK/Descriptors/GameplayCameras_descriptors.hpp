@@ -0,0 +1,41 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GameplayCameras_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GameplayCameras_classes.hpp"
+#include "../SDK/GameplayCameras_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULegacyCameraShake, StartLegacyCameraShake, "LegacyCameraShake", "StartLegacyCameraShake", SDK::Params::LegacyCameraShake_StartLegacyCameraShake)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULegacyCameraShake, StartLegacyCameraShakeFromSource, "LegacyCameraShake", "StartLegacyCameraShakeFromSource", SDK::Params::LegacyCameraShake_StartLegacyCameraShakeFromSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULegacyCameraShake, BlueprintUpdateCameraShake, "LegacyCameraShake", "BlueprintUpdateCameraShake", SDK::Params::LegacyCameraShake_BlueprintUpdateCameraShake)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULegacyCameraShake, ReceivePlayShake, "LegacyCameraShake", "ReceivePlayShake", SDK::Params::LegacyCameraShake_ReceivePlayShake)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULegacyCameraShake, ReceiveStopShake, "LegacyCameraShake", "ReceiveStopShake", SDK::Params::LegacyCameraShake_ReceiveStopShake)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULegacyCameraShake, ReceiveIsFinished, "LegacyCameraShake", "ReceiveIsFinished", SDK::Params::LegacyCameraShake_ReceiveIsFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULegacyCameraShakeFunctionLibrary, Conv_LegacyCameraShake, "LegacyCameraShakeFunctionLibrary", "Conv_LegacyCameraShake", SDK::Params::LegacyCameraShakeFunctionLibrary_Conv_LegacyCameraShake)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCameraAnimationCameraModifier, GetCameraAnimationCameraModifier, "CameraAnimationCameraModifier", "GetCameraAnimationCameraModifier", SDK::Params::CameraAnimationCameraModifier_GetCameraAnimationCameraModifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCameraAnimationCameraModifier, GetCameraAnimationCameraModifierFromID, "CameraAnimationCameraModifier", "GetCameraAnimationCameraModifierFromID", SDK::Params::CameraAnimationCameraModifier_GetCameraAnimationCameraModifierFromID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCameraAnimationCameraModifier, GetCameraAnimationCameraModifierFromPlayerController, "CameraAnimationCameraModifier", "GetCameraAnimationCameraModifierFromPlayerController", SDK::Params::CameraAnimationCameraModifier_GetCameraAnimationCameraModifierFromPlayerController)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCameraAnimationCameraModifier, PlayCameraAnimation, "CameraAnimationCameraModifier", "PlayCameraAnimation", SDK::Params::CameraAnimationCameraModifier_PlayCameraAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCameraAnimationCameraModifier, StopAllCameraAnimations, "CameraAnimationCameraModifier", "StopAllCameraAnimations", SDK::Params::CameraAnimationCameraModifier_StopAllCameraAnimations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCameraAnimationCameraModifier, StopAllCameraAnimationsOf, "CameraAnimationCameraModifier", "StopAllCameraAnimationsOf", SDK::Params::CameraAnimationCameraModifier_StopAllCameraAnimationsOf)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCameraAnimationCameraModifier, StopCameraAnimation, "CameraAnimationCameraModifier", "StopCameraAnimation", SDK::Params::CameraAnimationCameraModifier_StopCameraAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCameraAnimationCameraModifier, IsCameraAnimationActive, "CameraAnimationCameraModifier", "IsCameraAnimationActive", SDK::Params::CameraAnimationCameraModifier_IsCameraAnimationActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCamerasFunctionLibrary, Conv_CameraAnimationCameraModifier, "GameplayCamerasFunctionLibrary", "Conv_CameraAnimationCameraModifier", SDK::Params::GameplayCamerasFunctionLibrary_Conv_CameraAnimationCameraModifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCamerasFunctionLibrary, Conv_CameraAnimationPlaySpace, "GameplayCamerasFunctionLibrary", "Conv_CameraAnimationPlaySpace", SDK::Params::GameplayCamerasFunctionLibrary_Conv_CameraAnimationPlaySpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCamerasFunctionLibrary, Conv_CameraShakePlaySpace, "GameplayCamerasFunctionLibrary", "Conv_CameraShakePlaySpace", SDK::Params::GameplayCamerasFunctionLibrary_Conv_CameraShakePlaySpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AGameplayCameraActor, GetCameraComponent, "GameplayCameraActor", "GetCameraComponent", SDK::Params::GameplayCameraActor_GetCameraComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AGameplayCameraActor, GetSceneComponent, "GameplayCameraActor", "GetSceneComponent", SDK::Params::GameplayCameraActor_GetSceneComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCameraComponent, ActivateCamera, "GameplayCameraComponent", "ActivateCamera", SDK::Params::GameplayCameraComponent_ActivateCamera)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AGameplayCameraSystemActor, ActivateForPlayer, "GameplayCameraSystemActor", "ActivateForPlayer", SDK::Params::GameplayCameraSystemActor_ActivateForPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AGameplayCameraSystemActor, GetCameraSystemComponent, "GameplayCameraSystemActor", "GetCameraSystemComponent", SDK::Params::GameplayCameraSystemActor_GetCameraSystemComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCameraSystemComponent, GetCameraSystemEvaluator, "GameplayCameraSystemComponent", "GetCameraSystemEvaluator", SDK::Params::GameplayCameraSystemComponent_GetCameraSystemEvaluator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCamerasSubsystem, PlayCameraAnimation, "GameplayCamerasSubsystem", "PlayCameraAnimation", SDK::Params::GameplayCamerasSubsystem_PlayCameraAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCamerasSubsystem, StopAllCameraAnimations, "GameplayCamerasSubsystem", "StopAllCameraAnimations", SDK::Params::GameplayCamerasSubsystem_StopAllCameraAnimations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCamerasSubsystem, StopAllCameraAnimationsOf, "GameplayCamerasSubsystem", "StopAllCameraAnimationsOf", SDK::Params::GameplayCamerasSubsystem_StopAllCameraAnimationsOf)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCamerasSubsystem, StopCameraAnimation, "GameplayCamerasSubsystem", "StopCameraAnimation", SDK::Params::GameplayCamerasSubsystem_StopCameraAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayCamerasSubsystem, IsCameraAnimationActive, "GameplayCamerasSubsystem", "IsCameraAnimationActive", SDK::Params::GameplayCamerasSubsystem_IsCameraAnimationActive)
+// clang-format on
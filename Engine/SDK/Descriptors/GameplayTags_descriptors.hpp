@@ -0,0 +1,49 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GameplayTags_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GameplayTags_classes.hpp"
+#include "../SDK/GameplayTags_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, AddGameplayTag, "BlueprintGameplayTagLibrary", "AddGameplayTag", SDK::Params::BlueprintGameplayTagLibrary_AddGameplayTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, AppendGameplayTagContainers, "BlueprintGameplayTagLibrary", "AppendGameplayTagContainers", SDK::Params::BlueprintGameplayTagLibrary_AppendGameplayTagContainers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, BreakGameplayTagContainer, "BlueprintGameplayTagLibrary", "BreakGameplayTagContainer", SDK::Params::BlueprintGameplayTagLibrary_BreakGameplayTagContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, DoesContainerMatchTagQuery, "BlueprintGameplayTagLibrary", "DoesContainerMatchTagQuery", SDK::Params::BlueprintGameplayTagLibrary_DoesContainerMatchTagQuery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, DoesTagAssetInterfaceHaveTag, "BlueprintGameplayTagLibrary", "DoesTagAssetInterfaceHaveTag", SDK::Params::BlueprintGameplayTagLibrary_DoesTagAssetInterfaceHaveTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, EqualEqual_GameplayTag, "BlueprintGameplayTagLibrary", "EqualEqual_GameplayTag", SDK::Params::BlueprintGameplayTagLibrary_EqualEqual_GameplayTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, EqualEqual_GameplayTagContainer, "BlueprintGameplayTagLibrary", "EqualEqual_GameplayTagContainer", SDK::Params::BlueprintGameplayTagLibrary_EqualEqual_GameplayTagContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, GetAllActorsOfClassMatchingTagQuery, "BlueprintGameplayTagLibrary", "GetAllActorsOfClassMatchingTagQuery", SDK::Params::BlueprintGameplayTagLibrary_GetAllActorsOfClassMatchingTagQuery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, GetDebugStringFromGameplayTag, "BlueprintGameplayTagLibrary", "GetDebugStringFromGameplayTag", SDK::Params::BlueprintGameplayTagLibrary_GetDebugStringFromGameplayTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, GetDebugStringFromGameplayTagContainer, "BlueprintGameplayTagLibrary", "GetDebugStringFromGameplayTagContainer", SDK::Params::BlueprintGameplayTagLibrary_GetDebugStringFromGameplayTagContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, GetNumGameplayTagsInContainer, "BlueprintGameplayTagLibrary", "GetNumGameplayTagsInContainer", SDK::Params::BlueprintGameplayTagLibrary_GetNumGameplayTagsInContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, GetTagName, "BlueprintGameplayTagLibrary", "GetTagName", SDK::Params::BlueprintGameplayTagLibrary_GetTagName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, HasAllMatchingGameplayTags, "BlueprintGameplayTagLibrary", "HasAllMatchingGameplayTags", SDK::Params::BlueprintGameplayTagLibrary_HasAllMatchingGameplayTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, HasAllTags, "BlueprintGameplayTagLibrary", "HasAllTags", SDK::Params::BlueprintGameplayTagLibrary_HasAllTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, HasAnyTags, "BlueprintGameplayTagLibrary", "HasAnyTags", SDK::Params::BlueprintGameplayTagLibrary_HasAnyTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, HasTag, "BlueprintGameplayTagLibrary", "HasTag", SDK::Params::BlueprintGameplayTagLibrary_HasTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, IsGameplayTagValid, "BlueprintGameplayTagLibrary", "IsGameplayTagValid", SDK::Params::BlueprintGameplayTagLibrary_IsGameplayTagValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, IsTagQueryEmpty, "BlueprintGameplayTagLibrary", "IsTagQueryEmpty", SDK::Params::BlueprintGameplayTagLibrary_IsTagQueryEmpty)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MakeGameplayTagContainerFromArray, "BlueprintGameplayTagLibrary", "MakeGameplayTagContainerFromArray", SDK::Params::BlueprintGameplayTagLibrary_MakeGameplayTagContainerFromArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MakeGameplayTagContainerFromTag, "BlueprintGameplayTagLibrary", "MakeGameplayTagContainerFromTag", SDK::Params::BlueprintGameplayTagLibrary_MakeGameplayTagContainerFromTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MakeGameplayTagQuery, "BlueprintGameplayTagLibrary", "MakeGameplayTagQuery", SDK::Params::BlueprintGameplayTagLibrary_MakeGameplayTagQuery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MakeGameplayTagQuery_MatchAllTags, "BlueprintGameplayTagLibrary", "MakeGameplayTagQuery_MatchAllTags", SDK::Params::BlueprintGameplayTagLibrary_MakeGameplayTagQuery_MatchAllTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MakeGameplayTagQuery_MatchAnyTags, "BlueprintGameplayTagLibrary", "MakeGameplayTagQuery_MatchAnyTags", SDK::Params::BlueprintGameplayTagLibrary_MakeGameplayTagQuery_MatchAnyTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MakeGameplayTagQuery_MatchNoTags, "BlueprintGameplayTagLibrary", "MakeGameplayTagQuery_MatchNoTags", SDK::Params::BlueprintGameplayTagLibrary_MakeGameplayTagQuery_MatchNoTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MakeLiteralGameplayTag, "BlueprintGameplayTagLibrary", "MakeLiteralGameplayTag", SDK::Params::BlueprintGameplayTagLibrary_MakeLiteralGameplayTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MakeLiteralGameplayTagContainer, "BlueprintGameplayTagLibrary", "MakeLiteralGameplayTagContainer", SDK::Params::BlueprintGameplayTagLibrary_MakeLiteralGameplayTagContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MatchesAnyTags, "BlueprintGameplayTagLibrary", "MatchesAnyTags", SDK::Params::BlueprintGameplayTagLibrary_MatchesAnyTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, MatchesTag, "BlueprintGameplayTagLibrary", "MatchesTag", SDK::Params::BlueprintGameplayTagLibrary_MatchesTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, NotEqual_GameplayTag, "BlueprintGameplayTagLibrary", "NotEqual_GameplayTag", SDK::Params::BlueprintGameplayTagLibrary_NotEqual_GameplayTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, NotEqual_GameplayTagContainer, "BlueprintGameplayTagLibrary", "NotEqual_GameplayTagContainer", SDK::Params::BlueprintGameplayTagLibrary_NotEqual_GameplayTagContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, NotEqual_TagContainerTagContainer, "BlueprintGameplayTagLibrary", "NotEqual_TagContainerTagContainer", SDK::Params::BlueprintGameplayTagLibrary_NotEqual_TagContainerTagContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, NotEqual_TagTag, "BlueprintGameplayTagLibrary", "NotEqual_TagTag", SDK::Params::BlueprintGameplayTagLibrary_NotEqual_TagTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBlueprintGameplayTagLibrary, RemoveGameplayTag, "BlueprintGameplayTagLibrary", "RemoveGameplayTag", SDK::Params::BlueprintGameplayTagLibrary_RemoveGameplayTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGameplayTagAssetInterface, GetOwnedGameplayTags, "GameplayTagAssetInterface", "GetOwnedGameplayTags", SDK::Params::GameplayTagAssetInterface_GetOwnedGameplayTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGameplayTagAssetInterface, HasAllMatchingGameplayTags, "GameplayTagAssetInterface", "HasAllMatchingGameplayTags", SDK::Params::GameplayTagAssetInterface_HasAllMatchingGameplayTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGameplayTagAssetInterface, HasAnyMatchingGameplayTags, "GameplayTagAssetInterface", "HasAnyMatchingGameplayTags", SDK::Params::GameplayTagAssetInterface_HasAnyMatchingGameplayTags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGameplayTagAssetInterface, HasMatchingGameplayTag, "GameplayTagAssetInterface", "HasMatchingGameplayTag", SDK::Params::GameplayTagAssetInterface_HasMatchingGameplayTag)
+// clang-format on
@@ -0,0 +1,22 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GameplayTasks_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GameplayTasks_classes.hpp"
+#include "../SDK/GameplayTasks_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTask, EndTask, "GameplayTask", "EndTask", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTask, ReadyForActivation, "GameplayTask", "ReadyForActivation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTasksComponent, K2_RunGameplayTask, "GameplayTasksComponent", "K2_RunGameplayTask", SDK::Params::GameplayTasksComponent_K2_RunGameplayTask)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTasksComponent, OnRep_SimulatedTasks, "GameplayTasksComponent", "OnRep_SimulatedTasks", SDK::Params::GameplayTasksComponent_OnRep_SimulatedTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTask_ClaimResource, ClaimResource, "GameplayTask_ClaimResource", "ClaimResource", SDK::Params::GameplayTask_ClaimResource_ClaimResource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTask_ClaimResource, ClaimResources, "GameplayTask_ClaimResource", "ClaimResources", SDK::Params::GameplayTask_ClaimResource_ClaimResources)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTask_SpawnActor, SpawnActor, "GameplayTask_SpawnActor", "SpawnActor", SDK::Params::GameplayTask_SpawnActor_SpawnActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTask_SpawnActor, BeginSpawningActor, "GameplayTask_SpawnActor", "BeginSpawningActor", SDK::Params::GameplayTask_SpawnActor_BeginSpawningActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTask_SpawnActor, FinishSpawningActor, "GameplayTask_SpawnActor", "FinishSpawningActor", SDK::Params::GameplayTask_SpawnActor_FinishSpawningActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameplayTask_WaitDelay, TaskWaitDelay, "GameplayTask_WaitDelay", "TaskWaitDelay", SDK::Params::GameplayTask_WaitDelay_TaskWaitDelay)
+// clang-format on
@@ -0,0 +1,44 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GeometryCache_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GeometryCache_classes.hpp"
+#include "../SDK/GeometryCache_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AGeometryCacheActor, GetGeometryCacheComponent, "GeometryCacheActor", "GetGeometryCacheComponent", SDK::Params::GeometryCacheActor_GetGeometryCacheComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, Pause, "GeometryCacheComponent", "Pause", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, Play, "GeometryCacheComponent", "Play", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, PlayFromStart, "GeometryCacheComponent", "PlayFromStart", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, PlayReversed, "GeometryCacheComponent", "PlayReversed", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, PlayReversedFromEnd, "GeometryCacheComponent", "PlayReversedFromEnd", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, SetExtrapolateFrames, "GeometryCacheComponent", "SetExtrapolateFrames", SDK::Params::GeometryCacheComponent_SetExtrapolateFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, SetGeometryCache, "GeometryCacheComponent", "SetGeometryCache", SDK::Params::GeometryCacheComponent_SetGeometryCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, SetLooping, "GeometryCacheComponent", "SetLooping", SDK::Params::GeometryCacheComponent_SetLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, SetMotionVectorScale, "GeometryCacheComponent", "SetMotionVectorScale", SDK::Params::GeometryCacheComponent_SetMotionVectorScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, SetOverrideWireframeColor, "GeometryCacheComponent", "SetOverrideWireframeColor", SDK::Params::GeometryCacheComponent_SetOverrideWireframeColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, SetPlaybackSpeed, "GeometryCacheComponent", "SetPlaybackSpeed", SDK::Params::GeometryCacheComponent_SetPlaybackSpeed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, SetStartTimeOffset, "GeometryCacheComponent", "SetStartTimeOffset", SDK::Params::GeometryCacheComponent_SetStartTimeOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, SetWireframeOverrideColor, "GeometryCacheComponent", "SetWireframeOverrideColor", SDK::Params::GeometryCacheComponent_SetWireframeOverrideColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, Stop, "GeometryCacheComponent", "Stop", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, TickAtThisTime, "GeometryCacheComponent", "TickAtThisTime", SDK::Params::GeometryCacheComponent_TickAtThisTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetAnimationTime, "GeometryCacheComponent", "GetAnimationTime", SDK::Params::GeometryCacheComponent_GetAnimationTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetDuration, "GeometryCacheComponent", "GetDuration", SDK::Params::GeometryCacheComponent_GetDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetMotionVectorScale, "GeometryCacheComponent", "GetMotionVectorScale", SDK::Params::GeometryCacheComponent_GetMotionVectorScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetNumberOfFrames, "GeometryCacheComponent", "GetNumberOfFrames", SDK::Params::GeometryCacheComponent_GetNumberOfFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetOverrideWireframeColor, "GeometryCacheComponent", "GetOverrideWireframeColor", SDK::Params::GeometryCacheComponent_GetOverrideWireframeColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetPlaybackDirection, "GeometryCacheComponent", "GetPlaybackDirection", SDK::Params::GeometryCacheComponent_GetPlaybackDirection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetPlaybackSpeed, "GeometryCacheComponent", "GetPlaybackSpeed", SDK::Params::GeometryCacheComponent_GetPlaybackSpeed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetStartTimeOffset, "GeometryCacheComponent", "GetStartTimeOffset", SDK::Params::GeometryCacheComponent_GetStartTimeOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, GetWireframeOverrideColor, "GeometryCacheComponent", "GetWireframeOverrideColor", SDK::Params::GeometryCacheComponent_GetWireframeOverrideColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, IsExtrapolatingFrames, "GeometryCacheComponent", "IsExtrapolatingFrames", SDK::Params::GeometryCacheComponent_IsExtrapolatingFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, IsLooping, "GeometryCacheComponent", "IsLooping", SDK::Params::GeometryCacheComponent_IsLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, IsPlaying, "GeometryCacheComponent", "IsPlaying", SDK::Params::GeometryCacheComponent_IsPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheComponent, IsPlayingReversed, "GeometryCacheComponent", "IsPlayingReversed", SDK::Params::GeometryCacheComponent_IsPlayingReversed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheTrack_FlipbookAnimation, AddMeshSample, "GeometryCacheTrack_FlipbookAnimation", "AddMeshSample", SDK::Params::GeometryCacheTrack_FlipbookAnimation_AddMeshSample)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheTrack_TransformAnimation, SetMesh, "GeometryCacheTrack_TransformAnimation", "SetMesh", SDK::Params::GeometryCacheTrack_TransformAnimation_SetMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCacheTrack_TransformGroupAnimation, SetMesh, "GeometryCacheTrack_TransformGroupAnimation", "SetMesh", SDK::Params::GeometryCacheTrack_TransformGroupAnimation_SetMesh)
+// clang-format on
@@ -0,0 +1,86 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GeometryCollectionEngine_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GeometryCollectionEngine_classes.hpp"
+#include "../SDK/GeometryCollectionEngine_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionBlueprintLibrary, SetISMPoolCustomInstanceData, "GeometryCollectionBlueprintLibrary", "SetISMPoolCustomInstanceData", SDK::Params::GeometryCollectionBlueprintLibrary_SetISMPoolCustomInstanceData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionISMPoolSubSystem, OnActorEndPlay, "GeometryCollectionISMPoolSubSystem", "OnActorEndPlay", SDK::Params::GeometryCollectionISMPoolSubSystem_OnActorEndPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, AddChaosSolverActor, "ChaosDestructionListener", "AddChaosSolverActor", SDK::Params::ChaosDestructionListener_AddChaosSolverActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, AddGeometryCollectionActor, "ChaosDestructionListener", "AddGeometryCollectionActor", SDK::Params::ChaosDestructionListener_AddGeometryCollectionActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, RemoveChaosSolverActor, "ChaosDestructionListener", "RemoveChaosSolverActor", SDK::Params::ChaosDestructionListener_RemoveChaosSolverActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, RemoveGeometryCollectionActor, "ChaosDestructionListener", "RemoveGeometryCollectionActor", SDK::Params::ChaosDestructionListener_RemoveGeometryCollectionActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SetBreakingEventEnabled, "ChaosDestructionListener", "SetBreakingEventEnabled", SDK::Params::ChaosDestructionListener_SetBreakingEventEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SetBreakingEventRequestSettings, "ChaosDestructionListener", "SetBreakingEventRequestSettings", SDK::Params::ChaosDestructionListener_SetBreakingEventRequestSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SetCollisionEventEnabled, "ChaosDestructionListener", "SetCollisionEventEnabled", SDK::Params::ChaosDestructionListener_SetCollisionEventEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SetCollisionEventRequestSettings, "ChaosDestructionListener", "SetCollisionEventRequestSettings", SDK::Params::ChaosDestructionListener_SetCollisionEventRequestSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SetRemovalEventEnabled, "ChaosDestructionListener", "SetRemovalEventEnabled", SDK::Params::ChaosDestructionListener_SetRemovalEventEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SetRemovalEventRequestSettings, "ChaosDestructionListener", "SetRemovalEventRequestSettings", SDK::Params::ChaosDestructionListener_SetRemovalEventRequestSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SetTrailingEventEnabled, "ChaosDestructionListener", "SetTrailingEventEnabled", SDK::Params::ChaosDestructionListener_SetTrailingEventEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SetTrailingEventRequestSettings, "ChaosDestructionListener", "SetTrailingEventRequestSettings", SDK::Params::ChaosDestructionListener_SetTrailingEventRequestSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SortBreakingEvents, "ChaosDestructionListener", "SortBreakingEvents", SDK::Params::ChaosDestructionListener_SortBreakingEvents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SortCollisionEvents, "ChaosDestructionListener", "SortCollisionEvents", SDK::Params::ChaosDestructionListener_SortCollisionEvents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SortRemovalEvents, "ChaosDestructionListener", "SortRemovalEvents", SDK::Params::ChaosDestructionListener_SortRemovalEvents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, SortTrailingEvents, "ChaosDestructionListener", "SortTrailingEvents", SDK::Params::ChaosDestructionListener_SortTrailingEvents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UChaosDestructionListener, IsEventListening, "ChaosDestructionListener", "IsEventListening", SDK::Params::ChaosDestructionListener_IsEventListening)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AGeometryCollectionActor, RaycastSingle, "GeometryCollectionActor", "RaycastSingle", SDK::Params::GeometryCollectionActor_RaycastSingle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyAngularVelocity, "GeometryCollectionComponent", "ApplyAngularVelocity", SDK::Params::GeometryCollectionComponent_ApplyAngularVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyAssetDefaults, "GeometryCollectionComponent", "ApplyAssetDefaults", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyBreakingAngularVelocity, "GeometryCollectionComponent", "ApplyBreakingAngularVelocity", SDK::Params::GeometryCollectionComponent_ApplyBreakingAngularVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyBreakingLinearVelocity, "GeometryCollectionComponent", "ApplyBreakingLinearVelocity", SDK::Params::GeometryCollectionComponent_ApplyBreakingLinearVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyExternalStrain, "GeometryCollectionComponent", "ApplyExternalStrain", SDK::Params::GeometryCollectionComponent_ApplyExternalStrain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyInternalStrain, "GeometryCollectionComponent", "ApplyInternalStrain", SDK::Params::GeometryCollectionComponent_ApplyInternalStrain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyKinematicField, "GeometryCollectionComponent", "ApplyKinematicField", SDK::Params::GeometryCollectionComponent_ApplyKinematicField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyLinearVelocity, "GeometryCollectionComponent", "ApplyLinearVelocity", SDK::Params::GeometryCollectionComponent_ApplyLinearVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ApplyPhysicsField, "GeometryCollectionComponent", "ApplyPhysicsField", SDK::Params::GeometryCollectionComponent_ApplyPhysicsField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, CrumbleActiveClusters, "GeometryCollectionComponent", "CrumbleActiveClusters", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, CrumbleCluster, "GeometryCollectionComponent", "CrumbleCluster", SDK::Params::GeometryCollectionComponent_CrumbleCluster)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, EnableRootProxyForCustomRenderer, "GeometryCollectionComponent", "EnableRootProxyForCustomRenderer", SDK::Params::GeometryCollectionComponent_EnableRootProxyForCustomRenderer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetDebugInfo, "GeometryCollectionComponent", "GetDebugInfo", SDK::Params::GeometryCollectionComponent_GetDebugInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetInitialLevel, "GeometryCollectionComponent", "GetInitialLevel", SDK::Params::GeometryCollectionComponent_GetInitialLevel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetMassAndExtents, "GeometryCollectionComponent", "GetMassAndExtents", SDK::Params::GeometryCollectionComponent_GetMassAndExtents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, OnRep_RepData, "GeometryCollectionComponent", "OnRep_RepData", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, OnRep_RepDynamicData, "GeometryCollectionComponent", "OnRep_RepDynamicData", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, OnRep_RepStateData, "GeometryCollectionComponent", "OnRep_RepStateData", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, ReceivePhysicsCollision, "GeometryCollectionComponent", "ReceivePhysicsCollision", SDK::Params::GeometryCollectionComponent_ReceivePhysicsCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, RemoveAllAnchors, "GeometryCollectionComponent", "RemoveAllAnchors", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetAbandonedParticleCollisionProfileName, "GeometryCollectionComponent", "SetAbandonedParticleCollisionProfileName", SDK::Params::GeometryCollectionComponent_SetAbandonedParticleCollisionProfileName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetAnchoredByBox, "GeometryCollectionComponent", "SetAnchoredByBox", SDK::Params::GeometryCollectionComponent_SetAnchoredByBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetAnchoredByIndex, "GeometryCollectionComponent", "SetAnchoredByIndex", SDK::Params::GeometryCollectionComponent_SetAnchoredByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetAnchoredByTransformedBox, "GeometryCollectionComponent", "SetAnchoredByTransformedBox", SDK::Params::GeometryCollectionComponent_SetAnchoredByTransformedBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetDamageModel, "GeometryCollectionComponent", "SetDamageModel", SDK::Params::GeometryCollectionComponent_SetDamageModel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetDamagePropagationData, "GeometryCollectionComponent", "SetDamagePropagationData", SDK::Params::GeometryCollectionComponent_SetDamagePropagationData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetDamageThreshold, "GeometryCollectionComponent", "SetDamageThreshold", SDK::Params::GeometryCollectionComponent_SetDamageThreshold)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetDensityFromPhysicsMaterial, "GeometryCollectionComponent", "SetDensityFromPhysicsMaterial", SDK::Params::GeometryCollectionComponent_SetDensityFromPhysicsMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetEnableDamageFromCollision, "GeometryCollectionComponent", "SetEnableDamageFromCollision", SDK::Params::GeometryCollectionComponent_SetEnableDamageFromCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetGravityGroupIndex, "GeometryCollectionComponent", "SetGravityGroupIndex", SDK::Params::GeometryCollectionComponent_SetGravityGroupIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetLocalRestTransforms, "GeometryCollectionComponent", "SetLocalRestTransforms", SDK::Params::GeometryCollectionComponent_SetLocalRestTransforms)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetNotifyBreaks, "GeometryCollectionComponent", "SetNotifyBreaks", SDK::Params::GeometryCollectionComponent_SetNotifyBreaks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetNotifyCrumblings, "GeometryCollectionComponent", "SetNotifyCrumblings", SDK::Params::GeometryCollectionComponent_SetNotifyCrumblings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetNotifyGlobalBreaks, "GeometryCollectionComponent", "SetNotifyGlobalBreaks", SDK::Params::GeometryCollectionComponent_SetNotifyGlobalBreaks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetNotifyGlobalCollision, "GeometryCollectionComponent", "SetNotifyGlobalCollision", SDK::Params::GeometryCollectionComponent_SetNotifyGlobalCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetNotifyGlobalCrumblings, "GeometryCollectionComponent", "SetNotifyGlobalCrumblings", SDK::Params::GeometryCollectionComponent_SetNotifyGlobalCrumblings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetNotifyGlobalRemovals, "GeometryCollectionComponent", "SetNotifyGlobalRemovals", SDK::Params::GeometryCollectionComponent_SetNotifyGlobalRemovals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetNotifyRemovals, "GeometryCollectionComponent", "SetNotifyRemovals", SDK::Params::GeometryCollectionComponent_SetNotifyRemovals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetOneWayInteractionLevel, "GeometryCollectionComponent", "SetOneWayInteractionLevel", SDK::Params::GeometryCollectionComponent_SetOneWayInteractionLevel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetPerLevelCollisionProfileNames, "GeometryCollectionComponent", "SetPerLevelCollisionProfileNames", SDK::Params::GeometryCollectionComponent_SetPerLevelCollisionProfileNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetPerParticleCollisionProfileName, "GeometryCollectionComponent", "SetPerParticleCollisionProfileName", SDK::Params::GeometryCollectionComponent_SetPerParticleCollisionProfileName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetRestCollection, "GeometryCollectionComponent", "SetRestCollection", SDK::Params::GeometryCollectionComponent_SetRestCollection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetUseMaterialDamageModifiers, "GeometryCollectionComponent", "SetUseMaterialDamageModifiers", SDK::Params::GeometryCollectionComponent_SetUseMaterialDamageModifiers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, SetUseStaticMeshCollisionForTraces, "GeometryCollectionComponent", "SetUseStaticMeshCollisionForTraces", SDK::Params::GeometryCollectionComponent_SetUseStaticMeshCollisionForTraces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetDamageThreshold, "GeometryCollectionComponent", "GetDamageThreshold", SDK::Params::GeometryCollectionComponent_GetDamageThreshold)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetInitialLocalRestTransforms, "GeometryCollectionComponent", "GetInitialLocalRestTransforms", SDK::Params::GeometryCollectionComponent_GetInitialLocalRestTransforms)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetLocalBounds, "GeometryCollectionComponent", "GetLocalBounds", SDK::Params::GeometryCollectionComponent_GetLocalBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetRootCurrentTransform, "GeometryCollectionComponent", "GetRootCurrentTransform", SDK::Params::GeometryCollectionComponent_GetRootCurrentTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetRootIndex, "GeometryCollectionComponent", "GetRootIndex", SDK::Params::GeometryCollectionComponent_GetRootIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetRootInitialTransform, "GeometryCollectionComponent", "GetRootInitialTransform", SDK::Params::GeometryCollectionComponent_GetRootInitialTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, GetUseStaticMeshCollisionForTraces, "GeometryCollectionComponent", "GetUseStaticMeshCollisionForTraces", SDK::Params::GeometryCollectionComponent_GetUseStaticMeshCollisionForTraces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollectionComponent, IsRootBroken, "GeometryCollectionComponent", "IsRootBroken", SDK::Params::GeometryCollectionComponent_IsRootBroken)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollection, SetConvertVertexColorsToSRGB, "GeometryCollection", "SetConvertVertexColorsToSRGB", SDK::Params::GeometryCollection_SetConvertVertexColorsToSRGB)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryCollection, SetEnableNanite, "GeometryCollection", "SetEnableNanite", SDK::Params::GeometryCollection_SetEnableNanite)
+// clang-format on
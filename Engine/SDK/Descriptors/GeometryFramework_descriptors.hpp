@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GeometryFramework_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GeometryFramework_classes.hpp"
+#include "../SDK/GeometryFramework_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, ClearOverrideRenderMaterial, "BaseDynamicMeshComponent", "ClearOverrideRenderMaterial", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, ClearSecondaryRenderMaterial, "BaseDynamicMeshComponent", "ClearSecondaryRenderMaterial", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetDynamicMesh, "BaseDynamicMeshComponent", "GetDynamicMesh", SDK::Params::BaseDynamicMeshComponent_GetDynamicMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetColorOverrideMode, "BaseDynamicMeshComponent", "SetColorOverrideMode", SDK::Params::BaseDynamicMeshComponent_SetColorOverrideMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetConstantOverrideColor, "BaseDynamicMeshComponent", "SetConstantOverrideColor", SDK::Params::BaseDynamicMeshComponent_SetConstantOverrideColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetEnableFlatShading, "BaseDynamicMeshComponent", "SetEnableFlatShading", SDK::Params::BaseDynamicMeshComponent_SetEnableFlatShading)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetEnableRaytracing, "BaseDynamicMeshComponent", "SetEnableRaytracing", SDK::Params::BaseDynamicMeshComponent_SetEnableRaytracing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetEnableWireframeRenderPass, "BaseDynamicMeshComponent", "SetEnableWireframeRenderPass", SDK::Params::BaseDynamicMeshComponent_SetEnableWireframeRenderPass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetOverrideRenderMaterial, "BaseDynamicMeshComponent", "SetOverrideRenderMaterial", SDK::Params::BaseDynamicMeshComponent_SetOverrideRenderMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetSecondaryBuffersVisibility, "BaseDynamicMeshComponent", "SetSecondaryBuffersVisibility", SDK::Params::BaseDynamicMeshComponent_SetSecondaryBuffersVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetSecondaryRenderMaterial, "BaseDynamicMeshComponent", "SetSecondaryRenderMaterial", SDK::Params::BaseDynamicMeshComponent_SetSecondaryRenderMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetShadowsEnabled, "BaseDynamicMeshComponent", "SetShadowsEnabled", SDK::Params::BaseDynamicMeshComponent_SetShadowsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetVertexColorSpaceTransformMode, "BaseDynamicMeshComponent", "SetVertexColorSpaceTransformMode", SDK::Params::BaseDynamicMeshComponent_SetVertexColorSpaceTransformMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, SetViewModeOverridesEnabled, "BaseDynamicMeshComponent", "SetViewModeOverridesEnabled", SDK::Params::BaseDynamicMeshComponent_SetViewModeOverridesEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetColorOverrideMode, "BaseDynamicMeshComponent", "GetColorOverrideMode", SDK::Params::BaseDynamicMeshComponent_GetColorOverrideMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetConstantOverrideColor, "BaseDynamicMeshComponent", "GetConstantOverrideColor", SDK::Params::BaseDynamicMeshComponent_GetConstantOverrideColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetEnableRaytracing, "BaseDynamicMeshComponent", "GetEnableRaytracing", SDK::Params::BaseDynamicMeshComponent_GetEnableRaytracing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetEnableWireframeRenderPass, "BaseDynamicMeshComponent", "GetEnableWireframeRenderPass", SDK::Params::BaseDynamicMeshComponent_GetEnableWireframeRenderPass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetFlatShadingEnabled, "BaseDynamicMeshComponent", "GetFlatShadingEnabled", SDK::Params::BaseDynamicMeshComponent_GetFlatShadingEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetOverrideRenderMaterial, "BaseDynamicMeshComponent", "GetOverrideRenderMaterial", SDK::Params::BaseDynamicMeshComponent_GetOverrideRenderMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetSecondaryBuffersVisibility, "BaseDynamicMeshComponent", "GetSecondaryBuffersVisibility", SDK::Params::BaseDynamicMeshComponent_GetSecondaryBuffersVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetSecondaryRenderMaterial, "BaseDynamicMeshComponent", "GetSecondaryRenderMaterial", SDK::Params::BaseDynamicMeshComponent_GetSecondaryRenderMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetShadowsEnabled, "BaseDynamicMeshComponent", "GetShadowsEnabled", SDK::Params::BaseDynamicMeshComponent_GetShadowsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetVertexColorSpaceTransformMode, "BaseDynamicMeshComponent", "GetVertexColorSpaceTransformMode", SDK::Params::BaseDynamicMeshComponent_GetVertexColorSpaceTransformMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, GetViewModeOverridesEnabled, "BaseDynamicMeshComponent", "GetViewModeOverridesEnabled", SDK::Params::BaseDynamicMeshComponent_GetViewModeOverridesEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBaseDynamicMeshComponent, HasOverrideRenderMaterial, "BaseDynamicMeshComponent", "HasOverrideRenderMaterial", SDK::Params::BaseDynamicMeshComponent_HasOverrideRenderMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, ConfigureMaterialSet, "DynamicMeshComponent", "ConfigureMaterialSet", SDK::Params::DynamicMeshComponent_ConfigureMaterialSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, EnableComplexAsSimpleCollision, "DynamicMeshComponent", "EnableComplexAsSimpleCollision", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, NotifyMeshModified, "DynamicMeshComponent", "NotifyMeshModified", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, NotifyMeshVertexAttributesModified, "DynamicMeshComponent", "NotifyMeshVertexAttributesModified", SDK::Params::DynamicMeshComponent_NotifyMeshVertexAttributesModified)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, SetComplexAsSimpleCollisionEnabled, "DynamicMeshComponent", "SetComplexAsSimpleCollisionEnabled", SDK::Params::DynamicMeshComponent_SetComplexAsSimpleCollisionEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, SetDeferredCollisionUpdatesEnabled, "DynamicMeshComponent", "SetDeferredCollisionUpdatesEnabled", SDK::Params::DynamicMeshComponent_SetDeferredCollisionUpdatesEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, SetDynamicMesh, "DynamicMeshComponent", "SetDynamicMesh", SDK::Params::DynamicMeshComponent_SetDynamicMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, SetTangentsType, "DynamicMeshComponent", "SetTangentsType", SDK::Params::DynamicMeshComponent_SetTangentsType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, UpdateCollision, "DynamicMeshComponent", "UpdateCollision", SDK::Params::DynamicMeshComponent_UpdateCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, ValidateMaterialSlots, "DynamicMeshComponent", "ValidateMaterialSlots", SDK::Params::DynamicMeshComponent_ValidateMaterialSlots)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, GetTangentsType, "DynamicMeshComponent", "GetTangentsType", SDK::Params::DynamicMeshComponent_GetTangentsType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshComponent, GetTangentsTypePure, "DynamicMeshComponent", "GetTangentsTypePure", SDK::Params::DynamicMeshComponent_GetTangentsTypePure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ADynamicMeshActor, AllocateComputeMesh, "DynamicMeshActor", "AllocateComputeMesh", SDK::Params::DynamicMeshActor_AllocateComputeMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ADynamicMeshActor, FreeAllComputeMeshes, "DynamicMeshActor", "FreeAllComputeMeshes", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ADynamicMeshActor, GetComputeMeshPool, "DynamicMeshActor", "GetComputeMeshPool", SDK::Params::DynamicMeshActor_GetComputeMeshPool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ADynamicMeshActor, ReleaseAllComputeMeshes, "DynamicMeshActor", "ReleaseAllComputeMeshes", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ADynamicMeshActor, ReleaseComputeMesh, "DynamicMeshActor", "ReleaseComputeMesh", SDK::Params::DynamicMeshActor_ReleaseComputeMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ADynamicMeshActor, GetDynamicMeshComponent, "DynamicMeshActor", "GetDynamicMeshComponent", SDK::Params::DynamicMeshActor_GetDynamicMeshComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMesh, Reset, "DynamicMesh", "Reset", SDK::Params::DynamicMesh_Reset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMesh, ResetToCube, "DynamicMesh", "ResetToCube", SDK::Params::DynamicMesh_ResetToCube)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMesh, GetTriangleCount, "DynamicMesh", "GetTriangleCount", SDK::Params::DynamicMesh_GetTriangleCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMesh, IsEmpty, "DynamicMesh", "IsEmpty", SDK::Params::DynamicMesh_IsEmpty)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshPool, FreeAllMeshes, "DynamicMeshPool", "FreeAllMeshes", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshPool, RequestMesh, "DynamicMeshPool", "RequestMesh", SDK::Params::DynamicMeshPool_RequestMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshPool, ReturnAllMeshes, "DynamicMeshPool", "ReturnAllMeshes", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicMeshPool, ReturnMesh, "DynamicMeshPool", "ReturnMesh", SDK::Params::DynamicMeshPool_ReturnMesh)
+// clang-format on
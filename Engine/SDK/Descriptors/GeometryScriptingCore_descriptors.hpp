@@ -0,0 +1,508 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GeometryScriptingCore_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GeometryScriptingCore_classes.hpp"
+#include "../SDK/GeometryScriptingCore_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, ApproximateConvexHullsWithSimplerCollisionShapes, "GeometryScriptLibrary_CollisionFunctions", "ApproximateConvexHullsWithSimplerCollisionShapes", SDK::Params::GeometryScriptLibrary_CollisionFunctions_ApproximateConvexHullsWithSimplerCollisionShapes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, CombineSimpleCollision, "GeometryScriptLibrary_CollisionFunctions", "CombineSimpleCollision", SDK::Params::GeometryScriptLibrary_CollisionFunctions_CombineSimpleCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, ComputeNegativeSpace, "GeometryScriptLibrary_CollisionFunctions", "ComputeNegativeSpace", SDK::Params::GeometryScriptLibrary_CollisionFunctions_ComputeNegativeSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, Conv_GeometryScriptSphereCoveringToSphereArray, "GeometryScriptLibrary_CollisionFunctions", "Conv_GeometryScriptSphereCoveringToSphereArray", SDK::Params::GeometryScriptLibrary_CollisionFunctions_Conv_GeometryScriptSphereCoveringToSphereArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, Conv_SphereArrayToGeometryScriptSphereCovering, "GeometryScriptLibrary_CollisionFunctions", "Conv_SphereArrayToGeometryScriptSphereCovering", SDK::Params::GeometryScriptLibrary_CollisionFunctions_Conv_SphereArrayToGeometryScriptSphereCovering)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, GetSimpleCollisionFromComponent, "GeometryScriptLibrary_CollisionFunctions", "GetSimpleCollisionFromComponent", SDK::Params::GeometryScriptLibrary_CollisionFunctions_GetSimpleCollisionFromComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, GetSimpleCollisionFromStaticMesh, "GeometryScriptLibrary_CollisionFunctions", "GetSimpleCollisionFromStaticMesh", SDK::Params::GeometryScriptLibrary_CollisionFunctions_GetSimpleCollisionFromStaticMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, GetSimpleCollisionShapeCount, "GeometryScriptLibrary_CollisionFunctions", "GetSimpleCollisionShapeCount", SDK::Params::GeometryScriptLibrary_CollisionFunctions_GetSimpleCollisionShapeCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, MergeSimpleCollisionShapes, "GeometryScriptLibrary_CollisionFunctions", "MergeSimpleCollisionShapes", SDK::Params::GeometryScriptLibrary_CollisionFunctions_MergeSimpleCollisionShapes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, ResetDynamicMeshCollision, "GeometryScriptLibrary_CollisionFunctions", "ResetDynamicMeshCollision", SDK::Params::GeometryScriptLibrary_CollisionFunctions_ResetDynamicMeshCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, SetDynamicMeshCollisionFromMesh, "GeometryScriptLibrary_CollisionFunctions", "SetDynamicMeshCollisionFromMesh", SDK::Params::GeometryScriptLibrary_CollisionFunctions_SetDynamicMeshCollisionFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, SetSimpleCollisionOfDynamicMeshComponent, "GeometryScriptLibrary_CollisionFunctions", "SetSimpleCollisionOfDynamicMeshComponent", SDK::Params::GeometryScriptLibrary_CollisionFunctions_SetSimpleCollisionOfDynamicMeshComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, SetSimpleCollisionOfStaticMesh, "GeometryScriptLibrary_CollisionFunctions", "SetSimpleCollisionOfStaticMesh", SDK::Params::GeometryScriptLibrary_CollisionFunctions_SetSimpleCollisionOfStaticMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, SetStaticMeshCollisionFromComponent, "GeometryScriptLibrary_CollisionFunctions", "SetStaticMeshCollisionFromComponent", SDK::Params::GeometryScriptLibrary_CollisionFunctions_SetStaticMeshCollisionFromComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, SetStaticMeshCollisionFromMesh, "GeometryScriptLibrary_CollisionFunctions", "SetStaticMeshCollisionFromMesh", SDK::Params::GeometryScriptLibrary_CollisionFunctions_SetStaticMeshCollisionFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, SimplifyConvexHulls, "GeometryScriptLibrary_CollisionFunctions", "SimplifyConvexHulls", SDK::Params::GeometryScriptLibrary_CollisionFunctions_SimplifyConvexHulls)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, StaticMeshHasCustomizedCollision, "GeometryScriptLibrary_CollisionFunctions", "StaticMeshHasCustomizedCollision", SDK::Params::GeometryScriptLibrary_CollisionFunctions_StaticMeshHasCustomizedCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_CollisionFunctions, TransformSimpleCollisionShapes, "GeometryScriptLibrary_CollisionFunctions", "TransformSimpleCollisionShapes", SDK::Params::GeometryScriptLibrary_CollisionFunctions_TransformSimpleCollisionShapes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ContainmentFunctions, ComputeMeshConvexDecomposition, "GeometryScriptLibrary_ContainmentFunctions", "ComputeMeshConvexDecomposition", SDK::Params::GeometryScriptLibrary_ContainmentFunctions_ComputeMeshConvexDecomposition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ContainmentFunctions, ComputeMeshConvexHull, "GeometryScriptLibrary_ContainmentFunctions", "ComputeMeshConvexHull", SDK::Params::GeometryScriptLibrary_ContainmentFunctions_ComputeMeshConvexHull)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ContainmentFunctions, ComputeMeshSweptHull, "GeometryScriptLibrary_ContainmentFunctions", "ComputeMeshSweptHull", SDK::Params::GeometryScriptLibrary_ContainmentFunctions_ComputeMeshSweptHull)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ClearColorList, "GeometryScriptLibrary_ListUtilityFunctions", "ClearColorList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ClearColorList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ClearIndexList, "GeometryScriptLibrary_ListUtilityFunctions", "ClearIndexList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ClearIndexList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ClearScalarList, "GeometryScriptLibrary_ListUtilityFunctions", "ClearScalarList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ClearScalarList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ClearUVList, "GeometryScriptLibrary_ListUtilityFunctions", "ClearUVList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ClearUVList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ClearVectorList, "GeometryScriptLibrary_ListUtilityFunctions", "ClearVectorList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ClearVectorList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertArrayToColorList, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertArrayToColorList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertArrayToColorList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertArrayToIndexList, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertArrayToIndexList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertArrayToIndexList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertArrayToScalarList, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertArrayToScalarList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertArrayToScalarList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertArrayToTriangleList, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertArrayToTriangleList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertArrayToTriangleList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertArrayToUVList, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertArrayToUVList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertArrayToUVList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertArrayToVectorList, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertArrayToVectorList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertArrayToVectorList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertColorListToArray, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertColorListToArray", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertColorListToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertIndexListToArray, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertIndexListToArray", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertIndexListToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertScalarListToArray, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertScalarListToArray", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertScalarListToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertTriangleListToArray, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertTriangleListToArray", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertTriangleListToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertUVListToArray, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertUVListToArray", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertUVListToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ConvertVectorListToArray, "GeometryScriptLibrary_ListUtilityFunctions", "ConvertVectorListToArray", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ConvertVectorListToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, DuplicateColorList, "GeometryScriptLibrary_ListUtilityFunctions", "DuplicateColorList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_DuplicateColorList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, DuplicateIndexList, "GeometryScriptLibrary_ListUtilityFunctions", "DuplicateIndexList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_DuplicateIndexList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, DuplicateScalarList, "GeometryScriptLibrary_ListUtilityFunctions", "DuplicateScalarList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_DuplicateScalarList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, DuplicateUVList, "GeometryScriptLibrary_ListUtilityFunctions", "DuplicateUVList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_DuplicateUVList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, DuplicateVectorList, "GeometryScriptLibrary_ListUtilityFunctions", "DuplicateVectorList", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_DuplicateVectorList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ExtractColorListChannel, "GeometryScriptLibrary_ListUtilityFunctions", "ExtractColorListChannel", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ExtractColorListChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, ExtractColorListChannels, "GeometryScriptLibrary_ListUtilityFunctions", "ExtractColorListChannels", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_ExtractColorListChannels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetColorListItem, "GeometryScriptLibrary_ListUtilityFunctions", "GetColorListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetColorListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetColorListLastIndex, "GeometryScriptLibrary_ListUtilityFunctions", "GetColorListLastIndex", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetColorListLastIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetColorListLength, "GeometryScriptLibrary_ListUtilityFunctions", "GetColorListLength", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetColorListLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetIndexListItem, "GeometryScriptLibrary_ListUtilityFunctions", "GetIndexListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetIndexListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetIndexListLastIndex, "GeometryScriptLibrary_ListUtilityFunctions", "GetIndexListLastIndex", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetIndexListLastIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetIndexListLength, "GeometryScriptLibrary_ListUtilityFunctions", "GetIndexListLength", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetIndexListLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetScalarListItem, "GeometryScriptLibrary_ListUtilityFunctions", "GetScalarListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetScalarListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetScalarListLastIndex, "GeometryScriptLibrary_ListUtilityFunctions", "GetScalarListLastIndex", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetScalarListLastIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetScalarListLength, "GeometryScriptLibrary_ListUtilityFunctions", "GetScalarListLength", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetScalarListLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetTriangleListItem, "GeometryScriptLibrary_ListUtilityFunctions", "GetTriangleListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetTriangleListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetTriangleListLastTriangle, "GeometryScriptLibrary_ListUtilityFunctions", "GetTriangleListLastTriangle", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetTriangleListLastTriangle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetTriangleListLength, "GeometryScriptLibrary_ListUtilityFunctions", "GetTriangleListLength", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetTriangleListLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetUVListItem, "GeometryScriptLibrary_ListUtilityFunctions", "GetUVListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetUVListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetUVListLastIndex, "GeometryScriptLibrary_ListUtilityFunctions", "GetUVListLastIndex", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetUVListLastIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetUVListLength, "GeometryScriptLibrary_ListUtilityFunctions", "GetUVListLength", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetUVListLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetVectorListItem, "GeometryScriptLibrary_ListUtilityFunctions", "GetVectorListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetVectorListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetVectorListLastIndex, "GeometryScriptLibrary_ListUtilityFunctions", "GetVectorListLastIndex", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetVectorListLastIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, GetVectorListLength, "GeometryScriptLibrary_ListUtilityFunctions", "GetVectorListLength", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_GetVectorListLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, SetColorListItem, "GeometryScriptLibrary_ListUtilityFunctions", "SetColorListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_SetColorListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, SetIndexListItem, "GeometryScriptLibrary_ListUtilityFunctions", "SetIndexListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_SetIndexListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, SetScalarListItem, "GeometryScriptLibrary_ListUtilityFunctions", "SetScalarListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_SetScalarListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, SetUVListItem, "GeometryScriptLibrary_ListUtilityFunctions", "SetUVListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_SetUVListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_ListUtilityFunctions, SetVectorListItem, "GeometryScriptLibrary_ListUtilityFunctions", "SetVectorListItem", SDK::Params::GeometryScriptLibrary_ListUtilityFunctions_SetVectorListItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_StaticMeshFunctions, CheckStaticMeshHasAvailableLOD, "GeometryScriptLibrary_StaticMeshFunctions", "CheckStaticMeshHasAvailableLOD", SDK::Params::GeometryScriptLibrary_StaticMeshFunctions_CheckStaticMeshHasAvailableLOD)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_StaticMeshFunctions, CopyMeshFromSkeletalMesh, "GeometryScriptLibrary_StaticMeshFunctions", "CopyMeshFromSkeletalMesh", SDK::Params::GeometryScriptLibrary_StaticMeshFunctions_CopyMeshFromSkeletalMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_StaticMeshFunctions, CopyMeshFromStaticMesh, "GeometryScriptLibrary_StaticMeshFunctions", "CopyMeshFromStaticMesh", SDK::Params::GeometryScriptLibrary_StaticMeshFunctions_CopyMeshFromStaticMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_StaticMeshFunctions, CopyMeshToSkeletalMesh, "GeometryScriptLibrary_StaticMeshFunctions", "CopyMeshToSkeletalMesh", SDK::Params::GeometryScriptLibrary_StaticMeshFunctions_CopyMeshToSkeletalMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_StaticMeshFunctions, CopyMeshToStaticMesh, "GeometryScriptLibrary_StaticMeshFunctions", "CopyMeshToStaticMesh", SDK::Params::GeometryScriptLibrary_StaticMeshFunctions_CopyMeshToStaticMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_StaticMeshFunctions, GetNumStaticMeshLODsOfType, "GeometryScriptLibrary_StaticMeshFunctions", "GetNumStaticMeshLODsOfType", SDK::Params::GeometryScriptLibrary_StaticMeshFunctions_GetNumStaticMeshLODsOfType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_StaticMeshFunctions, GetSectionMaterialListFromStaticMesh, "GeometryScriptLibrary_StaticMeshFunctions", "GetSectionMaterialListFromStaticMesh", SDK::Params::GeometryScriptLibrary_StaticMeshFunctions_GetSectionMaterialListFromStaticMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, BakeTexture, "GeometryScriptLibrary_MeshBakeFunctions", "BakeTexture", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_BakeTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, BakeTextureFromRenderCaptures, "GeometryScriptLibrary_MeshBakeFunctions", "BakeTextureFromRenderCaptures", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_BakeTextureFromRenderCaptures)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, BakeVertex, "GeometryScriptLibrary_MeshBakeFunctions", "BakeVertex", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_BakeVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, ConvertBakeResolutionToInt, "GeometryScriptLibrary_MeshBakeFunctions", "ConvertBakeResolutionToInt", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_ConvertBakeResolutionToInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeAmbientOcclusion, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeAmbientOcclusion", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeAmbientOcclusion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeBentNormal, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeBentNormal", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeBentNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeConstant, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeConstant", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeConstant)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeCurvature, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeCurvature", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeCurvature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeFaceNormal, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeFaceNormal", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeFaceNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeMaterialID, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeMaterialID", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeMaterialID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeMultiTexture, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeMultiTexture", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeMultiTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeObjectNormal, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeObjectNormal", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeObjectNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypePosition, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypePosition", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeTangentNormal, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeTangentNormal", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeTangentNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeTexture, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeTexture", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBakeFunctions, MakeBakeTypeVertexColor, "GeometryScriptLibrary_MeshBakeFunctions", "MakeBakeTypeVertexColor", SDK::Params::GeometryScriptLibrary_MeshBakeFunctions_MakeBakeTypeVertexColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, AddTrianglesToMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "AddTrianglesToMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_AddTrianglesToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, AddTriangleToMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "AddTriangleToMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_AddTriangleToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, AddVertexToMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "AddVertexToMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_AddVertexToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, AddVerticesToMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "AddVerticesToMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_AddVerticesToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, AppendBuffersToMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "AppendBuffersToMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_AppendBuffersToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, AppendMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "AppendMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_AppendMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, AppendMeshRepeated, "GeometryScriptLibrary_MeshBasicEditFunctions", "AppendMeshRepeated", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_AppendMeshRepeated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, AppendMeshTransformed, "GeometryScriptLibrary_MeshBasicEditFunctions", "AppendMeshTransformed", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_AppendMeshTransformed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, DeleteSelectedTrianglesFromMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "DeleteSelectedTrianglesFromMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_DeleteSelectedTrianglesFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, DeleteTriangleFromMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "DeleteTriangleFromMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_DeleteTriangleFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, DeleteTrianglesFromMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "DeleteTrianglesFromMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_DeleteTrianglesFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, DeleteVertexFromMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "DeleteVertexFromMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_DeleteVertexFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, DeleteVerticesFromMesh, "GeometryScriptLibrary_MeshBasicEditFunctions", "DeleteVerticesFromMesh", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_DeleteVerticesFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, DiscardMeshAttributes, "GeometryScriptLibrary_MeshBasicEditFunctions", "DiscardMeshAttributes", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_DiscardMeshAttributes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, SetAllMeshVertexPositions, "GeometryScriptLibrary_MeshBasicEditFunctions", "SetAllMeshVertexPositions", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_SetAllMeshVertexPositions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBasicEditFunctions, SetVertexPosition, "GeometryScriptLibrary_MeshBasicEditFunctions", "SetVertexPosition", SDK::Params::GeometryScriptLibrary_MeshBasicEditFunctions_SetVertexPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, ComputeSmoothBoneWeights, "GeometryScriptLibrary_MeshBoneWeightFunctions", "ComputeSmoothBoneWeights", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_ComputeSmoothBoneWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, CopyBonesFromMesh, "GeometryScriptLibrary_MeshBoneWeightFunctions", "CopyBonesFromMesh", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_CopyBonesFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, DiscardBonesFromMesh, "GeometryScriptLibrary_MeshBoneWeightFunctions", "DiscardBonesFromMesh", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_DiscardBonesFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, GetAllBonesInfo, "GeometryScriptLibrary_MeshBoneWeightFunctions", "GetAllBonesInfo", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_GetAllBonesInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, GetBoneChildren, "GeometryScriptLibrary_MeshBoneWeightFunctions", "GetBoneChildren", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_GetBoneChildren)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, GetBoneIndex, "GeometryScriptLibrary_MeshBoneWeightFunctions", "GetBoneIndex", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_GetBoneIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, GetBoneInfo, "GeometryScriptLibrary_MeshBoneWeightFunctions", "GetBoneInfo", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_GetBoneInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, GetLargestVertexBoneWeight, "GeometryScriptLibrary_MeshBoneWeightFunctions", "GetLargestVertexBoneWeight", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_GetLargestVertexBoneWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, GetMaxBoneWeightIndex, "GeometryScriptLibrary_MeshBoneWeightFunctions", "GetMaxBoneWeightIndex", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_GetMaxBoneWeightIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, GetRootBoneName, "GeometryScriptLibrary_MeshBoneWeightFunctions", "GetRootBoneName", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_GetRootBoneName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, GetVertexBoneWeights, "GeometryScriptLibrary_MeshBoneWeightFunctions", "GetVertexBoneWeights", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_GetVertexBoneWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, MeshCreateBoneWeights, "GeometryScriptLibrary_MeshBoneWeightFunctions", "MeshCreateBoneWeights", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_MeshCreateBoneWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, MeshHasBoneWeights, "GeometryScriptLibrary_MeshBoneWeightFunctions", "MeshHasBoneWeights", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_MeshHasBoneWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, SetAllVertexBoneWeights, "GeometryScriptLibrary_MeshBoneWeightFunctions", "SetAllVertexBoneWeights", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_SetAllVertexBoneWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, SetVertexBoneWeights, "GeometryScriptLibrary_MeshBoneWeightFunctions", "SetVertexBoneWeights", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_SetVertexBoneWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBoneWeightFunctions, TransferBoneWeightsFromMesh, "GeometryScriptLibrary_MeshBoneWeightFunctions", "TransferBoneWeightsFromMesh", SDK::Params::GeometryScriptLibrary_MeshBoneWeightFunctions_TransferBoneWeightsFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBooleanFunctions, ApplyMeshBoolean, "GeometryScriptLibrary_MeshBooleanFunctions", "ApplyMeshBoolean", SDK::Params::GeometryScriptLibrary_MeshBooleanFunctions_ApplyMeshBoolean)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBooleanFunctions, ApplyMeshMirror, "GeometryScriptLibrary_MeshBooleanFunctions", "ApplyMeshMirror", SDK::Params::GeometryScriptLibrary_MeshBooleanFunctions_ApplyMeshMirror)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBooleanFunctions, ApplyMeshPlaneCut, "GeometryScriptLibrary_MeshBooleanFunctions", "ApplyMeshPlaneCut", SDK::Params::GeometryScriptLibrary_MeshBooleanFunctions_ApplyMeshPlaneCut)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBooleanFunctions, ApplyMeshPlaneSlice, "GeometryScriptLibrary_MeshBooleanFunctions", "ApplyMeshPlaneSlice", SDK::Params::GeometryScriptLibrary_MeshBooleanFunctions_ApplyMeshPlaneSlice)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshBooleanFunctions, ApplyMeshSelfUnion, "GeometryScriptLibrary_MeshBooleanFunctions", "ApplyMeshSelfUnion", SDK::Params::GeometryScriptLibrary_MeshBooleanFunctions_ApplyMeshSelfUnion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshComparisonFunctions, IsIntersectingMesh, "GeometryScriptLibrary_MeshComparisonFunctions", "IsIntersectingMesh", SDK::Params::GeometryScriptLibrary_MeshComparisonFunctions_IsIntersectingMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshComparisonFunctions, IsSameMeshAs, "GeometryScriptLibrary_MeshComparisonFunctions", "IsSameMeshAs", SDK::Params::GeometryScriptLibrary_MeshComparisonFunctions_IsSameMeshAs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshComparisonFunctions, MeasureDistancesBetweenMeshes, "GeometryScriptLibrary_MeshComparisonFunctions", "MeasureDistancesBetweenMeshes", SDK::Params::GeometryScriptLibrary_MeshComparisonFunctions_MeasureDistancesBetweenMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDecompositionFunctions, CopyMeshSelectionToMesh, "GeometryScriptLibrary_MeshDecompositionFunctions", "CopyMeshSelectionToMesh", SDK::Params::GeometryScriptLibrary_MeshDecompositionFunctions_CopyMeshSelectionToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDecompositionFunctions, CopyMeshToMesh, "GeometryScriptLibrary_MeshDecompositionFunctions", "CopyMeshToMesh", SDK::Params::GeometryScriptLibrary_MeshDecompositionFunctions_CopyMeshToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDecompositionFunctions, GetSubMeshFromMesh, "GeometryScriptLibrary_MeshDecompositionFunctions", "GetSubMeshFromMesh", SDK::Params::GeometryScriptLibrary_MeshDecompositionFunctions_GetSubMeshFromMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDecompositionFunctions, SplitMeshByComponents, "GeometryScriptLibrary_MeshDecompositionFunctions", "SplitMeshByComponents", SDK::Params::GeometryScriptLibrary_MeshDecompositionFunctions_SplitMeshByComponents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDecompositionFunctions, SplitMeshByMaterialIDs, "GeometryScriptLibrary_MeshDecompositionFunctions", "SplitMeshByMaterialIDs", SDK::Params::GeometryScriptLibrary_MeshDecompositionFunctions_SplitMeshByMaterialIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDecompositionFunctions, SplitMeshByPolygroups, "GeometryScriptLibrary_MeshDecompositionFunctions", "SplitMeshByPolygroups", SDK::Params::GeometryScriptLibrary_MeshDecompositionFunctions_SplitMeshByPolygroups)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDeformFunctions, ApplyBendWarpToMesh, "GeometryScriptLibrary_MeshDeformFunctions", "ApplyBendWarpToMesh", SDK::Params::GeometryScriptLibrary_MeshDeformFunctions_ApplyBendWarpToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDeformFunctions, ApplyDisplaceFromPerVertexVectors, "GeometryScriptLibrary_MeshDeformFunctions", "ApplyDisplaceFromPerVertexVectors", SDK::Params::GeometryScriptLibrary_MeshDeformFunctions_ApplyDisplaceFromPerVertexVectors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDeformFunctions, ApplyDisplaceFromTextureMap, "GeometryScriptLibrary_MeshDeformFunctions", "ApplyDisplaceFromTextureMap", SDK::Params::GeometryScriptLibrary_MeshDeformFunctions_ApplyDisplaceFromTextureMap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDeformFunctions, ApplyFlareWarpToMesh, "GeometryScriptLibrary_MeshDeformFunctions", "ApplyFlareWarpToMesh", SDK::Params::GeometryScriptLibrary_MeshDeformFunctions_ApplyFlareWarpToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDeformFunctions, ApplyIterativeSmoothingToMesh, "GeometryScriptLibrary_MeshDeformFunctions", "ApplyIterativeSmoothingToMesh", SDK::Params::GeometryScriptLibrary_MeshDeformFunctions_ApplyIterativeSmoothingToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDeformFunctions, ApplyMathWarpToMesh, "GeometryScriptLibrary_MeshDeformFunctions", "ApplyMathWarpToMesh", SDK::Params::GeometryScriptLibrary_MeshDeformFunctions_ApplyMathWarpToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDeformFunctions, ApplyPerlinNoiseToMesh, "GeometryScriptLibrary_MeshDeformFunctions", "ApplyPerlinNoiseToMesh", SDK::Params::GeometryScriptLibrary_MeshDeformFunctions_ApplyPerlinNoiseToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshDeformFunctions, ApplyTwistWarpToMesh, "GeometryScriptLibrary_MeshDeformFunctions", "ApplyTwistWarpToMesh", SDK::Params::GeometryScriptLibrary_MeshDeformFunctions_ApplyTwistWarpToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshGeodesicFunctions, CreateSurfacePath, "GeometryScriptLibrary_MeshGeodesicFunctions", "CreateSurfacePath", SDK::Params::GeometryScriptLibrary_MeshGeodesicFunctions_CreateSurfacePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshGeodesicFunctions, GetShortestSurfacePath, "GeometryScriptLibrary_MeshGeodesicFunctions", "GetShortestSurfacePath", SDK::Params::GeometryScriptLibrary_MeshGeodesicFunctions_GetShortestSurfacePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshGeodesicFunctions, GetShortestVertexPath, "GeometryScriptLibrary_MeshGeodesicFunctions", "GetShortestVertexPath", SDK::Params::GeometryScriptLibrary_MeshGeodesicFunctions_GetShortestVertexPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, ClearMaterialIDs, "GeometryScriptLibrary_MeshMaterialFunctions", "ClearMaterialIDs", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_ClearMaterialIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, CompactMaterialIDs, "GeometryScriptLibrary_MeshMaterialFunctions", "CompactMaterialIDs", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_CompactMaterialIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, DeleteTrianglesByMaterialID, "GeometryScriptLibrary_MeshMaterialFunctions", "DeleteTrianglesByMaterialID", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_DeleteTrianglesByMaterialID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, EnableMaterialIDs, "GeometryScriptLibrary_MeshMaterialFunctions", "EnableMaterialIDs", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_EnableMaterialIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, GetAllTriangleMaterialIDs, "GeometryScriptLibrary_MeshMaterialFunctions", "GetAllTriangleMaterialIDs", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_GetAllTriangleMaterialIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, GetMaterialIDsOfTriangles, "GeometryScriptLibrary_MeshMaterialFunctions", "GetMaterialIDsOfTriangles", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_GetMaterialIDsOfTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, GetMaxMaterialID, "GeometryScriptLibrary_MeshMaterialFunctions", "GetMaxMaterialID", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_GetMaxMaterialID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, GetTriangleMaterialID, "GeometryScriptLibrary_MeshMaterialFunctions", "GetTriangleMaterialID", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_GetTriangleMaterialID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, GetTrianglesByMaterialID, "GeometryScriptLibrary_MeshMaterialFunctions", "GetTrianglesByMaterialID", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_GetTrianglesByMaterialID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, RemapMaterialIDs, "GeometryScriptLibrary_MeshMaterialFunctions", "RemapMaterialIDs", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_RemapMaterialIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, RemapToNewMaterialIDsByMaterial, "GeometryScriptLibrary_MeshMaterialFunctions", "RemapToNewMaterialIDsByMaterial", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_RemapToNewMaterialIDsByMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, SetAllTriangleMaterialIDs, "GeometryScriptLibrary_MeshMaterialFunctions", "SetAllTriangleMaterialIDs", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_SetAllTriangleMaterialIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, SetMaterialIDForMeshSelection, "GeometryScriptLibrary_MeshMaterialFunctions", "SetMaterialIDForMeshSelection", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_SetMaterialIDForMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, SetMaterialIDOnTriangles, "GeometryScriptLibrary_MeshMaterialFunctions", "SetMaterialIDOnTriangles", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_SetMaterialIDOnTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, SetPolygroupMaterialID, "GeometryScriptLibrary_MeshMaterialFunctions", "SetPolygroupMaterialID", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_SetPolygroupMaterialID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshMaterialFunctions, SetTriangleMaterialID, "GeometryScriptLibrary_MeshMaterialFunctions", "SetTriangleMaterialID", SDK::Params::GeometryScriptLibrary_MeshMaterialFunctions_SetTriangleMaterialID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshBevelSelection, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshBevelSelection", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshBevelSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshDisconnectFaces, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshDisconnectFaces", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshDisconnectFaces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshDuplicateFaces, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshDuplicateFaces", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshDuplicateFaces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshExtrude_Compatibility_5p0, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshExtrude_Compatibility_5p0", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshExtrude_Compatibility_5p0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshInsetOutsetFaces, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshInsetOutsetFaces", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshInsetOutsetFaces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshLinearExtrudeFaces, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshLinearExtrudeFaces", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshLinearExtrudeFaces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshOffset, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshOffset", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshOffsetFaces, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshOffsetFaces", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshOffsetFaces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshPolygroupBevel, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshPolygroupBevel", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshPolygroupBevel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshModelingFunctions, ApplyMeshShell, "GeometryScriptLibrary_MeshModelingFunctions", "ApplyMeshShell", SDK::Params::GeometryScriptLibrary_MeshModelingFunctions_ApplyMeshShell)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, AutoRepairNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "AutoRepairNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_AutoRepairNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, ComputeSplitNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "ComputeSplitNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_ComputeSplitNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, ComputeTangents, "GeometryScriptLibrary_MeshNormalsFunctions", "ComputeTangents", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_ComputeTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, DiscardTangents, "GeometryScriptLibrary_MeshNormalsFunctions", "DiscardTangents", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_DiscardTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, FlipNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "FlipNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_FlipNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, GetMeshHasTangents, "GeometryScriptLibrary_MeshNormalsFunctions", "GetMeshHasTangents", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_GetMeshHasTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, GetMeshPerVertexNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "GetMeshPerVertexNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_GetMeshPerVertexNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, GetMeshPerVertexTangents, "GeometryScriptLibrary_MeshNormalsFunctions", "GetMeshPerVertexTangents", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_GetMeshPerVertexTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, RecomputeNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "RecomputeNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_RecomputeNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, RecomputeNormalsForMeshSelection, "GeometryScriptLibrary_MeshNormalsFunctions", "RecomputeNormalsForMeshSelection", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_RecomputeNormalsForMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, SetMeshPerVertexNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "SetMeshPerVertexNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_SetMeshPerVertexNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, SetMeshPerVertexTangents, "GeometryScriptLibrary_MeshNormalsFunctions", "SetMeshPerVertexTangents", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_SetMeshPerVertexTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, SetMeshTriangleNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "SetMeshTriangleNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_SetMeshTriangleNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, SetPerFaceNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "SetPerFaceNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_SetPerFaceNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, SetPerVertexNormals, "GeometryScriptLibrary_MeshNormalsFunctions", "SetPerVertexNormals", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_SetPerVertexNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshNormalsFunctions, UpdateVertexNormal, "GeometryScriptLibrary_MeshNormalsFunctions", "UpdateVertexNormal", SDK::Params::GeometryScriptLibrary_MeshNormalsFunctions_UpdateVertexNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, ClearPolygroups, "GeometryScriptLibrary_MeshPolygroupFunctions", "ClearPolygroups", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_ClearPolygroups)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, ComputePolygroupsFromAngleThreshold, "GeometryScriptLibrary_MeshPolygroupFunctions", "ComputePolygroupsFromAngleThreshold", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_ComputePolygroupsFromAngleThreshold)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, ComputePolygroupsFromPolygonDetection, "GeometryScriptLibrary_MeshPolygroupFunctions", "ComputePolygroupsFromPolygonDetection", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_ComputePolygroupsFromPolygonDetection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, ConvertComponentsToPolygroups, "GeometryScriptLibrary_MeshPolygroupFunctions", "ConvertComponentsToPolygroups", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_ConvertComponentsToPolygroups)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, ConvertUVIslandsToPolygroups, "GeometryScriptLibrary_MeshPolygroupFunctions", "ConvertUVIslandsToPolygroups", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_ConvertUVIslandsToPolygroups)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, CopyPolygroupsLayer, "GeometryScriptLibrary_MeshPolygroupFunctions", "CopyPolygroupsLayer", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_CopyPolygroupsLayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, DeleteTrianglesInPolygroup, "GeometryScriptLibrary_MeshPolygroupFunctions", "DeleteTrianglesInPolygroup", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_DeleteTrianglesInPolygroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, EnablePolygroups, "GeometryScriptLibrary_MeshPolygroupFunctions", "EnablePolygroups", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_EnablePolygroups)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, GetAllTrianglePolygroupIDs, "GeometryScriptLibrary_MeshPolygroupFunctions", "GetAllTrianglePolygroupIDs", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_GetAllTrianglePolygroupIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, GetPolygroupIDsInMesh, "GeometryScriptLibrary_MeshPolygroupFunctions", "GetPolygroupIDsInMesh", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_GetPolygroupIDsInMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, GetTrianglePolygroupID, "GeometryScriptLibrary_MeshPolygroupFunctions", "GetTrianglePolygroupID", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_GetTrianglePolygroupID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, GetTrianglesInPolygroup, "GeometryScriptLibrary_MeshPolygroupFunctions", "GetTrianglesInPolygroup", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_GetTrianglesInPolygroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, SetNumExtendedPolygroupLayers, "GeometryScriptLibrary_MeshPolygroupFunctions", "SetNumExtendedPolygroupLayers", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_SetNumExtendedPolygroupLayers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPolygroupFunctions, SetPolygroupForMeshSelection, "GeometryScriptLibrary_MeshPolygroupFunctions", "SetPolygroupForMeshSelection", SDK::Params::GeometryScriptLibrary_MeshPolygroupFunctions_SetPolygroupForMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendBoundingBox, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendBoundingBox", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendBoundingBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendBox, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendBox", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendCapsule, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendCapsule", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendCapsule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendCone, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendCone", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendCone)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendCurvedStairs, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendCurvedStairs", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendCurvedStairs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendCylinder, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendCylinder", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendCylinder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendDelaunayTriangulation2D, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendDelaunayTriangulation2D", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendDelaunayTriangulation2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendDisc, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendDisc", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendDisc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendLinearStairs, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendLinearStairs", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendLinearStairs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendPolygonListTriangulation, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendPolygonListTriangulation", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendPolygonListTriangulation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendRectangle_Compatibility_5_0, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendRectangle_Compatibility_5_0", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendRectangle_Compatibility_5_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendRectangleXY, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendRectangleXY", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendRectangleXY)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendRevolvePath, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendRevolvePath", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendRevolvePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendRevolvePolygon, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendRevolvePolygon", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendRevolvePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendRoundRectangle_Compatibility_5_0, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendRoundRectangle_Compatibility_5_0", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendRoundRectangle_Compatibility_5_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendRoundRectangleXY, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendRoundRectangleXY", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendRoundRectangleXY)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSimpleCollisionShapes, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSimpleCollisionShapes", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSimpleCollisionShapes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSimpleExtrudePolygon, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSimpleExtrudePolygon", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSimpleExtrudePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSimpleSweptPolygon, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSimpleSweptPolygon", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSimpleSweptPolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSphereBox, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSphereBox", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSphereBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSphereCovering, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSphereCovering", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSphereCovering)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSphereLatLong, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSphereLatLong", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSphereLatLong)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSpiralRevolvePolygon, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSpiralRevolvePolygon", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSpiralRevolvePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSweepPolygon, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSweepPolygon", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSweepPolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendSweepPolyline, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendSweepPolyline", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendSweepPolyline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendTorus, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendTorus", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendTorus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendTriangulatedPolygon, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendTriangulatedPolygon", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendTriangulatedPolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendTriangulatedPolygon3D, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendTriangulatedPolygon3D", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendTriangulatedPolygon3D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshPrimitiveFunctions, AppendVoronoiDiagram2D, "GeometryScriptLibrary_MeshPrimitiveFunctions", "AppendVoronoiDiagram2D", SDK::Params::GeometryScriptLibrary_MeshPrimitiveFunctions_AppendVoronoiDiagram2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, ComputeTriangleBarycentricCoords, "GeometryScriptLibrary_MeshQueryFunctions", "ComputeTriangleBarycentricCoords", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_ComputeTriangleBarycentricCoords)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetAllSplitUVsAtVertex, "GeometryScriptLibrary_MeshQueryFunctions", "GetAllSplitUVsAtVertex", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetAllSplitUVsAtVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetAllTriangleIDs, "GeometryScriptLibrary_MeshQueryFunctions", "GetAllTriangleIDs", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetAllTriangleIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetAllTriangleIndices, "GeometryScriptLibrary_MeshQueryFunctions", "GetAllTriangleIndices", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetAllTriangleIndices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetAllVertexIDs, "GeometryScriptLibrary_MeshQueryFunctions", "GetAllVertexIDs", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetAllVertexIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetAllVertexPositions, "GeometryScriptLibrary_MeshQueryFunctions", "GetAllVertexPositions", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetAllVertexPositions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetHasMaterialIDs, "GeometryScriptLibrary_MeshQueryFunctions", "GetHasMaterialIDs", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetHasMaterialIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetHasPolygroups, "GeometryScriptLibrary_MeshQueryFunctions", "GetHasPolygroups", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetHasPolygroups)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetHasTriangleIDGaps, "GeometryScriptLibrary_MeshQueryFunctions", "GetHasTriangleIDGaps", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetHasTriangleIDGaps)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetHasTriangleNormals, "GeometryScriptLibrary_MeshQueryFunctions", "GetHasTriangleNormals", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetHasTriangleNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetHasVertexColors, "GeometryScriptLibrary_MeshQueryFunctions", "GetHasVertexColors", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetHasVertexColors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetHasVertexIDGaps, "GeometryScriptLibrary_MeshQueryFunctions", "GetHasVertexIDGaps", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetHasVertexIDGaps)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetInterpolatedTriangleNormal, "GeometryScriptLibrary_MeshQueryFunctions", "GetInterpolatedTriangleNormal", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetInterpolatedTriangleNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetInterpolatedTriangleNormalTangents, "GeometryScriptLibrary_MeshQueryFunctions", "GetInterpolatedTriangleNormalTangents", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetInterpolatedTriangleNormalTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetInterpolatedTrianglePosition, "GeometryScriptLibrary_MeshQueryFunctions", "GetInterpolatedTrianglePosition", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetInterpolatedTrianglePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetInterpolatedTriangleUV, "GeometryScriptLibrary_MeshQueryFunctions", "GetInterpolatedTriangleUV", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetInterpolatedTriangleUV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetInterpolatedTriangleVertexColor, "GeometryScriptLibrary_MeshQueryFunctions", "GetInterpolatedTriangleVertexColor", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetInterpolatedTriangleVertexColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetIsClosedMesh, "GeometryScriptLibrary_MeshQueryFunctions", "GetIsClosedMesh", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetIsClosedMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetIsDenseMesh, "GeometryScriptLibrary_MeshQueryFunctions", "GetIsDenseMesh", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetIsDenseMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetMeshBoundingBox, "GeometryScriptLibrary_MeshQueryFunctions", "GetMeshBoundingBox", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetMeshBoundingBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetMeshHasAttributeSet, "GeometryScriptLibrary_MeshQueryFunctions", "GetMeshHasAttributeSet", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetMeshHasAttributeSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetMeshInfoString, "GeometryScriptLibrary_MeshQueryFunctions", "GetMeshInfoString", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetMeshInfoString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetMeshVolumeArea, "GeometryScriptLibrary_MeshQueryFunctions", "GetMeshVolumeArea", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetMeshVolumeArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetMeshVolumeAreaCenter, "GeometryScriptLibrary_MeshQueryFunctions", "GetMeshVolumeAreaCenter", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetMeshVolumeAreaCenter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetNumConnectedComponents, "GeometryScriptLibrary_MeshQueryFunctions", "GetNumConnectedComponents", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetNumConnectedComponents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetNumExtendedPolygroupLayers, "GeometryScriptLibrary_MeshQueryFunctions", "GetNumExtendedPolygroupLayers", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetNumExtendedPolygroupLayers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetNumOpenBorderEdges, "GeometryScriptLibrary_MeshQueryFunctions", "GetNumOpenBorderEdges", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetNumOpenBorderEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetNumOpenBorderLoops, "GeometryScriptLibrary_MeshQueryFunctions", "GetNumOpenBorderLoops", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetNumOpenBorderLoops)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetNumTriangleIDs, "GeometryScriptLibrary_MeshQueryFunctions", "GetNumTriangleIDs", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetNumTriangleIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetNumUVSets, "GeometryScriptLibrary_MeshQueryFunctions", "GetNumUVSets", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetNumUVSets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetNumVertexIDs, "GeometryScriptLibrary_MeshQueryFunctions", "GetNumVertexIDs", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetNumVertexIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetTriangleFaceNormal, "GeometryScriptLibrary_MeshQueryFunctions", "GetTriangleFaceNormal", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetTriangleFaceNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetTriangleIndices, "GeometryScriptLibrary_MeshQueryFunctions", "GetTriangleIndices", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetTriangleIndices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetTriangleNormals, "GeometryScriptLibrary_MeshQueryFunctions", "GetTriangleNormals", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetTriangleNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetTriangleNormalTangents, "GeometryScriptLibrary_MeshQueryFunctions", "GetTriangleNormalTangents", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetTriangleNormalTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetTrianglePositions, "GeometryScriptLibrary_MeshQueryFunctions", "GetTrianglePositions", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetTrianglePositions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetTriangleUVs, "GeometryScriptLibrary_MeshQueryFunctions", "GetTriangleUVs", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetTriangleUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetTriangleVertexColors, "GeometryScriptLibrary_MeshQueryFunctions", "GetTriangleVertexColors", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetTriangleVertexColors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetUVSetBoundingBox, "GeometryScriptLibrary_MeshQueryFunctions", "GetUVSetBoundingBox", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetUVSetBoundingBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetVertexConnectedTriangles, "GeometryScriptLibrary_MeshQueryFunctions", "GetVertexConnectedTriangles", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetVertexConnectedTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetVertexConnectedVertices, "GeometryScriptLibrary_MeshQueryFunctions", "GetVertexConnectedVertices", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetVertexConnectedVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetVertexCount, "GeometryScriptLibrary_MeshQueryFunctions", "GetVertexCount", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetVertexCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, GetVertexPosition, "GeometryScriptLibrary_MeshQueryFunctions", "GetVertexPosition", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_GetVertexPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, IsValidTriangleID, "GeometryScriptLibrary_MeshQueryFunctions", "IsValidTriangleID", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_IsValidTriangleID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshQueryFunctions, IsValidVertexID, "GeometryScriptLibrary_MeshQueryFunctions", "IsValidVertexID", SDK::Params::GeometryScriptLibrary_MeshQueryFunctions_IsValidVertexID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RemeshingFunctions, ApplyUniformRemesh, "GeometryScriptLibrary_RemeshingFunctions", "ApplyUniformRemesh", SDK::Params::GeometryScriptLibrary_RemeshingFunctions_ApplyUniformRemesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, CompactMesh, "GeometryScriptLibrary_MeshRepairFunctions", "CompactMesh", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_CompactMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, FillAllMeshHoles, "GeometryScriptLibrary_MeshRepairFunctions", "FillAllMeshHoles", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_FillAllMeshHoles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, RemoveHiddenTriangles, "GeometryScriptLibrary_MeshRepairFunctions", "RemoveHiddenTriangles", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_RemoveHiddenTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, RemoveSmallComponents, "GeometryScriptLibrary_MeshRepairFunctions", "RemoveSmallComponents", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_RemoveSmallComponents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, RemoveUnusedVertices, "GeometryScriptLibrary_MeshRepairFunctions", "RemoveUnusedVertices", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_RemoveUnusedVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, RepairMeshDegenerateGeometry, "GeometryScriptLibrary_MeshRepairFunctions", "RepairMeshDegenerateGeometry", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_RepairMeshDegenerateGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, ResolveMeshTJunctions, "GeometryScriptLibrary_MeshRepairFunctions", "ResolveMeshTJunctions", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_ResolveMeshTJunctions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, SplitMeshBowties, "GeometryScriptLibrary_MeshRepairFunctions", "SplitMeshBowties", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_SplitMeshBowties)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshRepairFunctions, WeldMeshEdges, "GeometryScriptLibrary_MeshRepairFunctions", "WeldMeshEdges", SDK::Params::GeometryScriptLibrary_MeshRepairFunctions_WeldMeshEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSamplingFunctions, ComputeNonUniformPointSampling, "GeometryScriptLibrary_MeshSamplingFunctions", "ComputeNonUniformPointSampling", SDK::Params::GeometryScriptLibrary_MeshSamplingFunctions_ComputeNonUniformPointSampling)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSamplingFunctions, ComputePointSampling, "GeometryScriptLibrary_MeshSamplingFunctions", "ComputePointSampling", SDK::Params::GeometryScriptLibrary_MeshSamplingFunctions_ComputePointSampling)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSamplingFunctions, ComputeRenderCaptureCamerasForBox, "GeometryScriptLibrary_MeshSamplingFunctions", "ComputeRenderCaptureCamerasForBox", SDK::Params::GeometryScriptLibrary_MeshSamplingFunctions_ComputeRenderCaptureCamerasForBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSamplingFunctions, ComputeRenderCapturePointSampling, "GeometryScriptLibrary_MeshSamplingFunctions", "ComputeRenderCapturePointSampling", SDK::Params::GeometryScriptLibrary_MeshSamplingFunctions_ComputeRenderCapturePointSampling)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSamplingFunctions, ComputeVertexWeightedPointSampling, "GeometryScriptLibrary_MeshSamplingFunctions", "ComputeVertexWeightedPointSampling", SDK::Params::GeometryScriptLibrary_MeshSamplingFunctions_ComputeVertexWeightedPointSampling)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, CombineMeshSelections, "GeometryScriptLibrary_MeshSelectionFunctions", "CombineMeshSelections", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_CombineMeshSelections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, ConvertIndexArrayToMeshSelection, "GeometryScriptLibrary_MeshSelectionFunctions", "ConvertIndexArrayToMeshSelection", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_ConvertIndexArrayToMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, ConvertIndexListToMeshSelection, "GeometryScriptLibrary_MeshSelectionFunctions", "ConvertIndexListToMeshSelection", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_ConvertIndexListToMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, ConvertIndexSetToMeshSelection, "GeometryScriptLibrary_MeshSelectionFunctions", "ConvertIndexSetToMeshSelection", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_ConvertIndexSetToMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, ConvertMeshSelection, "GeometryScriptLibrary_MeshSelectionFunctions", "ConvertMeshSelection", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_ConvertMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, ConvertMeshSelectionToIndexArray, "GeometryScriptLibrary_MeshSelectionFunctions", "ConvertMeshSelectionToIndexArray", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_ConvertMeshSelectionToIndexArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, ConvertMeshSelectionToIndexList, "GeometryScriptLibrary_MeshSelectionFunctions", "ConvertMeshSelectionToIndexList", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_ConvertMeshSelectionToIndexList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, CreateSelectAllMeshSelection, "GeometryScriptLibrary_MeshSelectionFunctions", "CreateSelectAllMeshSelection", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_CreateSelectAllMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, DebugPrintMeshSelection, "GeometryScriptLibrary_MeshSelectionFunctions", "DebugPrintMeshSelection", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_DebugPrintMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, ExpandContractMeshSelection, "GeometryScriptLibrary_MeshSelectionFunctions", "ExpandContractMeshSelection", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_ExpandContractMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, ExpandMeshSelectionToConnected, "GeometryScriptLibrary_MeshSelectionFunctions", "ExpandMeshSelectionToConnected", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_ExpandMeshSelectionToConnected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, GetMeshSelectionInfo, "GeometryScriptLibrary_MeshSelectionFunctions", "GetMeshSelectionInfo", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_GetMeshSelectionInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, InvertMeshSelection, "GeometryScriptLibrary_MeshSelectionFunctions", "InvertMeshSelection", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_InvertMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, SelectMeshElementsByNormalAngle, "GeometryScriptLibrary_MeshSelectionFunctions", "SelectMeshElementsByNormalAngle", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_SelectMeshElementsByNormalAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, SelectMeshElementsInBox, "GeometryScriptLibrary_MeshSelectionFunctions", "SelectMeshElementsInBox", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_SelectMeshElementsInBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, SelectMeshElementsInsideMesh, "GeometryScriptLibrary_MeshSelectionFunctions", "SelectMeshElementsInsideMesh", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_SelectMeshElementsInsideMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, SelectMeshElementsInSphere, "GeometryScriptLibrary_MeshSelectionFunctions", "SelectMeshElementsInSphere", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_SelectMeshElementsInSphere)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionFunctions, SelectMeshElementsWithPlane, "GeometryScriptLibrary_MeshSelectionFunctions", "SelectMeshElementsWithPlane", SDK::Params::GeometryScriptLibrary_MeshSelectionFunctions_SelectMeshElementsWithPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionQueryFunctions, GetMeshSelectionBoundaryLoops, "GeometryScriptLibrary_MeshSelectionQueryFunctions", "GetMeshSelectionBoundaryLoops", SDK::Params::GeometryScriptLibrary_MeshSelectionQueryFunctions_GetMeshSelectionBoundaryLoops)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSelectionQueryFunctions, GetMeshSelectionBoundingBox, "GeometryScriptLibrary_MeshSelectionQueryFunctions", "GetMeshSelectionBoundingBox", SDK::Params::GeometryScriptLibrary_MeshSelectionQueryFunctions_GetMeshSelectionBoundingBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSimplifyFunctions, ApplySimplifyToPlanar, "GeometryScriptLibrary_MeshSimplifyFunctions", "ApplySimplifyToPlanar", SDK::Params::GeometryScriptLibrary_MeshSimplifyFunctions_ApplySimplifyToPlanar)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSimplifyFunctions, ApplySimplifyToPolygroupTopology, "GeometryScriptLibrary_MeshSimplifyFunctions", "ApplySimplifyToPolygroupTopology", SDK::Params::GeometryScriptLibrary_MeshSimplifyFunctions_ApplySimplifyToPolygroupTopology)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSimplifyFunctions, ApplySimplifyToTolerance, "GeometryScriptLibrary_MeshSimplifyFunctions", "ApplySimplifyToTolerance", SDK::Params::GeometryScriptLibrary_MeshSimplifyFunctions_ApplySimplifyToTolerance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSimplifyFunctions, ApplySimplifyToTriangleCount, "GeometryScriptLibrary_MeshSimplifyFunctions", "ApplySimplifyToTriangleCount", SDK::Params::GeometryScriptLibrary_MeshSimplifyFunctions_ApplySimplifyToTriangleCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSimplifyFunctions, ApplySimplifyToVertexCount, "GeometryScriptLibrary_MeshSimplifyFunctions", "ApplySimplifyToVertexCount", SDK::Params::GeometryScriptLibrary_MeshSimplifyFunctions_ApplySimplifyToVertexCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSpatial, BuildBVHForMesh, "GeometryScriptLibrary_MeshSpatial", "BuildBVHForMesh", SDK::Params::GeometryScriptLibrary_MeshSpatial_BuildBVHForMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSpatial, FindNearestPointOnMesh, "GeometryScriptLibrary_MeshSpatial", "FindNearestPointOnMesh", SDK::Params::GeometryScriptLibrary_MeshSpatial_FindNearestPointOnMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSpatial, FindNearestRayIntersectionWithMesh, "GeometryScriptLibrary_MeshSpatial", "FindNearestRayIntersectionWithMesh", SDK::Params::GeometryScriptLibrary_MeshSpatial_FindNearestRayIntersectionWithMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSpatial, IsBVHValidForMesh, "GeometryScriptLibrary_MeshSpatial", "IsBVHValidForMesh", SDK::Params::GeometryScriptLibrary_MeshSpatial_IsBVHValidForMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSpatial, IsPointInsideMesh, "GeometryScriptLibrary_MeshSpatial", "IsPointInsideMesh", SDK::Params::GeometryScriptLibrary_MeshSpatial_IsPointInsideMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSpatial, RebuildBVHForMesh, "GeometryScriptLibrary_MeshSpatial", "RebuildBVHForMesh", SDK::Params::GeometryScriptLibrary_MeshSpatial_RebuildBVHForMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSpatial, ResetBVH, "GeometryScriptLibrary_MeshSpatial", "ResetBVH", SDK::Params::GeometryScriptLibrary_MeshSpatial_ResetBVH)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSpatial, SelectMeshElementsInBoxWithBVH, "GeometryScriptLibrary_MeshSpatial", "SelectMeshElementsInBoxWithBVH", SDK::Params::GeometryScriptLibrary_MeshSpatial_SelectMeshElementsInBoxWithBVH)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSubdivideFunctions, ApplyPNTessellation, "GeometryScriptLibrary_MeshSubdivideFunctions", "ApplyPNTessellation", SDK::Params::GeometryScriptLibrary_MeshSubdivideFunctions_ApplyPNTessellation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSubdivideFunctions, ApplySelectiveTessellation, "GeometryScriptLibrary_MeshSubdivideFunctions", "ApplySelectiveTessellation", SDK::Params::GeometryScriptLibrary_MeshSubdivideFunctions_ApplySelectiveTessellation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshSubdivideFunctions, ApplyUniformTessellation, "GeometryScriptLibrary_MeshSubdivideFunctions", "ApplyUniformTessellation", SDK::Params::GeometryScriptLibrary_MeshSubdivideFunctions_ApplyUniformTessellation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, RotateMesh, "GeometryScriptLibrary_MeshTransformFunctions", "RotateMesh", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_RotateMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, RotateMeshSelection, "GeometryScriptLibrary_MeshTransformFunctions", "RotateMeshSelection", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_RotateMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, ScaleMesh, "GeometryScriptLibrary_MeshTransformFunctions", "ScaleMesh", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_ScaleMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, ScaleMeshSelection, "GeometryScriptLibrary_MeshTransformFunctions", "ScaleMeshSelection", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_ScaleMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, TransformMesh, "GeometryScriptLibrary_MeshTransformFunctions", "TransformMesh", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_TransformMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, TransformMeshSelection, "GeometryScriptLibrary_MeshTransformFunctions", "TransformMeshSelection", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_TransformMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, TranslateMesh, "GeometryScriptLibrary_MeshTransformFunctions", "TranslateMesh", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_TranslateMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, TranslateMeshSelection, "GeometryScriptLibrary_MeshTransformFunctions", "TranslateMeshSelection", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_TranslateMeshSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshTransformFunctions, TranslatePivotToLocation, "GeometryScriptLibrary_MeshTransformFunctions", "TranslatePivotToLocation", SDK::Params::GeometryScriptLibrary_MeshTransformFunctions_TranslatePivotToLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, AddUVElementToMesh, "GeometryScriptLibrary_MeshUVFunctions", "AddUVElementToMesh", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_AddUVElementToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, AutoGeneratePatchBuilderMeshUVs, "GeometryScriptLibrary_MeshUVFunctions", "AutoGeneratePatchBuilderMeshUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_AutoGeneratePatchBuilderMeshUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, AutoGenerateXAtlasMeshUVs, "GeometryScriptLibrary_MeshUVFunctions", "AutoGenerateXAtlasMeshUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_AutoGenerateXAtlasMeshUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, ComputeMeshLocalUVParam, "GeometryScriptLibrary_MeshUVFunctions", "ComputeMeshLocalUVParam", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_ComputeMeshLocalUVParam)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, CopyMeshToMeshUVLayer, "GeometryScriptLibrary_MeshUVFunctions", "CopyMeshToMeshUVLayer", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_CopyMeshToMeshUVLayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, CopyMeshUVLayerToMesh, "GeometryScriptLibrary_MeshUVFunctions", "CopyMeshUVLayerToMesh", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_CopyMeshUVLayerToMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, CopyUVSet, "GeometryScriptLibrary_MeshUVFunctions", "CopyUVSet", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_CopyUVSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, GetMeshPerVertexUVs, "GeometryScriptLibrary_MeshUVFunctions", "GetMeshPerVertexUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_GetMeshPerVertexUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, GetMeshTriangleUVElementIDs, "GeometryScriptLibrary_MeshUVFunctions", "GetMeshTriangleUVElementIDs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_GetMeshTriangleUVElementIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, GetMeshUVElementPosition, "GeometryScriptLibrary_MeshUVFunctions", "GetMeshUVElementPosition", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_GetMeshUVElementPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, GetMeshUVSizeInfo, "GeometryScriptLibrary_MeshUVFunctions", "GetMeshUVSizeInfo", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_GetMeshUVSizeInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, RecomputeMeshUVs, "GeometryScriptLibrary_MeshUVFunctions", "RecomputeMeshUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_RecomputeMeshUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, RepackMeshUVs, "GeometryScriptLibrary_MeshUVFunctions", "RepackMeshUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_RepackMeshUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, RotateMeshUVs, "GeometryScriptLibrary_MeshUVFunctions", "RotateMeshUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_RotateMeshUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, ScaleMeshUVs, "GeometryScriptLibrary_MeshUVFunctions", "ScaleMeshUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_ScaleMeshUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, SetMeshTriangleUVElementIDs, "GeometryScriptLibrary_MeshUVFunctions", "SetMeshTriangleUVElementIDs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_SetMeshTriangleUVElementIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, SetMeshTriangleUVs, "GeometryScriptLibrary_MeshUVFunctions", "SetMeshTriangleUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_SetMeshTriangleUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, SetMeshUVElementPosition, "GeometryScriptLibrary_MeshUVFunctions", "SetMeshUVElementPosition", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_SetMeshUVElementPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, SetMeshUVsFromBoxProjection, "GeometryScriptLibrary_MeshUVFunctions", "SetMeshUVsFromBoxProjection", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_SetMeshUVsFromBoxProjection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, SetMeshUVsFromCylinderProjection, "GeometryScriptLibrary_MeshUVFunctions", "SetMeshUVsFromCylinderProjection", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_SetMeshUVsFromCylinderProjection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, SetMeshUVsFromPlanarProjection, "GeometryScriptLibrary_MeshUVFunctions", "SetMeshUVsFromPlanarProjection", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_SetMeshUVsFromPlanarProjection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, SetNumUVSets, "GeometryScriptLibrary_MeshUVFunctions", "SetNumUVSets", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_SetNumUVSets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshUVFunctions, TranslateMeshUVs, "GeometryScriptLibrary_MeshUVFunctions", "TranslateMeshUVs", SDK::Params::GeometryScriptLibrary_MeshUVFunctions_TranslateMeshUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVertexColorFunctions, BlurMeshVertexColors, "GeometryScriptLibrary_MeshVertexColorFunctions", "BlurMeshVertexColors", SDK::Params::GeometryScriptLibrary_MeshVertexColorFunctions_BlurMeshVertexColors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVertexColorFunctions, ConvertMeshVertexColorsLinearToSRGB, "GeometryScriptLibrary_MeshVertexColorFunctions", "ConvertMeshVertexColorsLinearToSRGB", SDK::Params::GeometryScriptLibrary_MeshVertexColorFunctions_ConvertMeshVertexColorsLinearToSRGB)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVertexColorFunctions, ConvertMeshVertexColorsSRGBToLinear, "GeometryScriptLibrary_MeshVertexColorFunctions", "ConvertMeshVertexColorsSRGBToLinear", SDK::Params::GeometryScriptLibrary_MeshVertexColorFunctions_ConvertMeshVertexColorsSRGBToLinear)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVertexColorFunctions, GetMeshPerVertexColors, "GeometryScriptLibrary_MeshVertexColorFunctions", "GetMeshPerVertexColors", SDK::Params::GeometryScriptLibrary_MeshVertexColorFunctions_GetMeshPerVertexColors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVertexColorFunctions, SetMeshConstantVertexColor, "GeometryScriptLibrary_MeshVertexColorFunctions", "SetMeshConstantVertexColor", SDK::Params::GeometryScriptLibrary_MeshVertexColorFunctions_SetMeshConstantVertexColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVertexColorFunctions, SetMeshPerVertexColors, "GeometryScriptLibrary_MeshVertexColorFunctions", "SetMeshPerVertexColors", SDK::Params::GeometryScriptLibrary_MeshVertexColorFunctions_SetMeshPerVertexColors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVertexColorFunctions, SetMeshSelectionVertexColor, "GeometryScriptLibrary_MeshVertexColorFunctions", "SetMeshSelectionVertexColor", SDK::Params::GeometryScriptLibrary_MeshVertexColorFunctions_SetMeshSelectionVertexColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVoxelFunctions, ApplyMeshMorphology, "GeometryScriptLibrary_MeshVoxelFunctions", "ApplyMeshMorphology", SDK::Params::GeometryScriptLibrary_MeshVoxelFunctions_ApplyMeshMorphology)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_MeshVoxelFunctions, ApplyMeshSolidify, "GeometryScriptLibrary_MeshVoxelFunctions", "ApplyMeshSolidify", SDK::Params::GeometryScriptLibrary_MeshVoxelFunctions_ApplyMeshSolidify)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, DownsamplePoints, "GeometryScriptLibrary_PointSetSamplingFunctions", "DownsamplePoints", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_DownsamplePoints)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, FlattenPoints, "GeometryScriptLibrary_PointSetSamplingFunctions", "FlattenPoints", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_FlattenPoints)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, GetPointsFromIndexList, "GeometryScriptLibrary_PointSetSamplingFunctions", "GetPointsFromIndexList", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_GetPointsFromIndexList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, KMeansClusterToArrays, "GeometryScriptLibrary_PointSetSamplingFunctions", "KMeansClusterToArrays", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_KMeansClusterToArrays)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, KMeansClusterToIDs, "GeometryScriptLibrary_PointSetSamplingFunctions", "KMeansClusterToIDs", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_KMeansClusterToIDs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, MakeBoundingBoxFromPoints, "GeometryScriptLibrary_PointSetSamplingFunctions", "MakeBoundingBoxFromPoints", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_MakeBoundingBoxFromPoints)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, OffsetTransforms, "GeometryScriptLibrary_PointSetSamplingFunctions", "OffsetTransforms", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_OffsetTransforms)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, TransformsToPoints, "GeometryScriptLibrary_PointSetSamplingFunctions", "TransformsToPoints", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_TransformsToPoints)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PointSetSamplingFunctions, UnflattenPoints, "GeometryScriptLibrary_PointSetSamplingFunctions", "UnflattenPoints", SDK::Params::GeometryScriptLibrary_PointSetSamplingFunctions_UnflattenPoints)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, AddPolygonVertex, "GeometryScriptLibrary_SimplePolygonFunctions", "AddPolygonVertex", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_AddPolygonVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, Conv_ArrayOfVector2DToGeometryScriptSimplePolygon, "GeometryScriptLibrary_SimplePolygonFunctions", "Conv_ArrayOfVector2DToGeometryScriptSimplePolygon", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_Conv_ArrayOfVector2DToGeometryScriptSimplePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, Conv_ArrayToGeometryScriptSimplePolygon, "GeometryScriptLibrary_SimplePolygonFunctions", "Conv_ArrayToGeometryScriptSimplePolygon", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_Conv_ArrayToGeometryScriptSimplePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, Conv_GeometryScriptSimplePolygonToArray, "GeometryScriptLibrary_SimplePolygonFunctions", "Conv_GeometryScriptSimplePolygonToArray", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_Conv_GeometryScriptSimplePolygonToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, Conv_GeometryScriptSimplePolygonToArrayOfVector2D, "GeometryScriptLibrary_SimplePolygonFunctions", "Conv_GeometryScriptSimplePolygonToArrayOfVector2D", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_Conv_GeometryScriptSimplePolygonToArrayOfVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, ConvertSplineToPolygon, "GeometryScriptLibrary_SimplePolygonFunctions", "ConvertSplineToPolygon", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_ConvertSplineToPolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, GetPolygonArcLength, "GeometryScriptLibrary_SimplePolygonFunctions", "GetPolygonArcLength", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_GetPolygonArcLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, GetPolygonArea, "GeometryScriptLibrary_SimplePolygonFunctions", "GetPolygonArea", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_GetPolygonArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, GetPolygonBounds, "GeometryScriptLibrary_SimplePolygonFunctions", "GetPolygonBounds", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_GetPolygonBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, GetPolygonTangent, "GeometryScriptLibrary_SimplePolygonFunctions", "GetPolygonTangent", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_GetPolygonTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, GetPolygonVertex, "GeometryScriptLibrary_SimplePolygonFunctions", "GetPolygonVertex", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_GetPolygonVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, GetPolygonVertexCount, "GeometryScriptLibrary_SimplePolygonFunctions", "GetPolygonVertexCount", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_GetPolygonVertexCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SimplePolygonFunctions, SetPolygonVertex, "GeometryScriptLibrary_SimplePolygonFunctions", "SetPolygonVertex", SDK::Params::GeometryScriptLibrary_SimplePolygonFunctions_SetPolygonVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, AddPolygonToList, "GeometryScriptLibrary_PolygonListFunctions", "AddPolygonToList", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_AddPolygonToList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, AppendPolygonList, "GeometryScriptLibrary_PolygonListFunctions", "AppendPolygonList", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_AppendPolygonList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, CreatePolygonListFromSimplePolygons, "GeometryScriptLibrary_PolygonListFunctions", "CreatePolygonListFromSimplePolygons", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_CreatePolygonListFromSimplePolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, CreatePolygonListFromSinglePolygon, "GeometryScriptLibrary_PolygonListFunctions", "CreatePolygonListFromSinglePolygon", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_CreatePolygonListFromSinglePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, CreatePolygonsFromOpenPolyPathsOffset, "GeometryScriptLibrary_PolygonListFunctions", "CreatePolygonsFromOpenPolyPathsOffset", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_CreatePolygonsFromOpenPolyPathsOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, CreatePolygonsFromPathOffset, "GeometryScriptLibrary_PolygonListFunctions", "CreatePolygonsFromPathOffset", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_CreatePolygonsFromPathOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonArea, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonArea", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonBounds, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonBounds", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonCount, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonCount", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonHoleCount, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonHoleCount", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonHoleCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonListArea, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonListArea", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonListArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonListBounds, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonListBounds", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonListBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonVertex, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonVertex", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonVertexCount, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonVertexCount", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonVertexCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetPolygonVertices, "GeometryScriptLibrary_PolygonListFunctions", "GetPolygonVertices", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetPolygonVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, GetSimplePolygon, "GeometryScriptLibrary_PolygonListFunctions", "GetSimplePolygon", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_GetSimplePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, PolygonsDifference, "GeometryScriptLibrary_PolygonListFunctions", "PolygonsDifference", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_PolygonsDifference)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, PolygonsExclusiveOr, "GeometryScriptLibrary_PolygonListFunctions", "PolygonsExclusiveOr", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_PolygonsExclusiveOr)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, PolygonsIntersection, "GeometryScriptLibrary_PolygonListFunctions", "PolygonsIntersection", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_PolygonsIntersection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, PolygonsMorphologyClose, "GeometryScriptLibrary_PolygonListFunctions", "PolygonsMorphologyClose", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_PolygonsMorphologyClose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, PolygonsMorphologyOpen, "GeometryScriptLibrary_PolygonListFunctions", "PolygonsMorphologyOpen", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_PolygonsMorphologyOpen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, PolygonsOffset, "GeometryScriptLibrary_PolygonListFunctions", "PolygonsOffset", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_PolygonsOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, PolygonsOffsets, "GeometryScriptLibrary_PolygonListFunctions", "PolygonsOffsets", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_PolygonsOffsets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolygonListFunctions, PolygonsUnion, "GeometryScriptLibrary_PolygonListFunctions", "PolygonsUnion", SDK::Params::GeometryScriptLibrary_PolygonListFunctions_PolygonsUnion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, Conv_ArrayOfVector2DToGeometryScriptPolyPath, "GeometryScriptLibrary_PolyPathFunctions", "Conv_ArrayOfVector2DToGeometryScriptPolyPath", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_Conv_ArrayOfVector2DToGeometryScriptPolyPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, Conv_ArrayToGeometryScriptPolyPath, "GeometryScriptLibrary_PolyPathFunctions", "Conv_ArrayToGeometryScriptPolyPath", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_Conv_ArrayToGeometryScriptPolyPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, Conv_GeometryScriptPolyPathToArray, "GeometryScriptLibrary_PolyPathFunctions", "Conv_GeometryScriptPolyPathToArray", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_Conv_GeometryScriptPolyPathToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, Conv_GeometryScriptPolyPathToArrayOfVector2D, "GeometryScriptLibrary_PolyPathFunctions", "Conv_GeometryScriptPolyPathToArrayOfVector2D", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_Conv_GeometryScriptPolyPathToArrayOfVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, ConvertArrayOfVector2DToPolyPath, "GeometryScriptLibrary_PolyPathFunctions", "ConvertArrayOfVector2DToPolyPath", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_ConvertArrayOfVector2DToPolyPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, ConvertArrayToPolyPath, "GeometryScriptLibrary_PolyPathFunctions", "ConvertArrayToPolyPath", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_ConvertArrayToPolyPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, ConvertPolyPathToArray, "GeometryScriptLibrary_PolyPathFunctions", "ConvertPolyPathToArray", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_ConvertPolyPathToArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, ConvertPolyPathToArrayOfVector2D, "GeometryScriptLibrary_PolyPathFunctions", "ConvertPolyPathToArrayOfVector2D", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_ConvertPolyPathToArrayOfVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, ConvertSplineToPolyPath, "GeometryScriptLibrary_PolyPathFunctions", "ConvertSplineToPolyPath", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_ConvertSplineToPolyPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, CreateArcPath2D, "GeometryScriptLibrary_PolyPathFunctions", "CreateArcPath2D", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_CreateArcPath2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, CreateArcPath3D, "GeometryScriptLibrary_PolyPathFunctions", "CreateArcPath3D", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_CreateArcPath3D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, CreateCirclePath2D, "GeometryScriptLibrary_PolyPathFunctions", "CreateCirclePath2D", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_CreateCirclePath2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, CreateCirclePath3D, "GeometryScriptLibrary_PolyPathFunctions", "CreateCirclePath3D", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_CreateCirclePath3D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, FlattenTo2DOnAxis, "GeometryScriptLibrary_PolyPathFunctions", "FlattenTo2DOnAxis", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_FlattenTo2DOnAxis)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, GetNearestVertexIndex, "GeometryScriptLibrary_PolyPathFunctions", "GetNearestVertexIndex", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_GetNearestVertexIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, GetPolyPathArcLength, "GeometryScriptLibrary_PolyPathFunctions", "GetPolyPathArcLength", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_GetPolyPathArcLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, GetPolyPathLastIndex, "GeometryScriptLibrary_PolyPathFunctions", "GetPolyPathLastIndex", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_GetPolyPathLastIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, GetPolyPathNumVertices, "GeometryScriptLibrary_PolyPathFunctions", "GetPolyPathNumVertices", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_GetPolyPathNumVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, GetPolyPathTangent, "GeometryScriptLibrary_PolyPathFunctions", "GetPolyPathTangent", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_GetPolyPathTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, GetPolyPathVertex, "GeometryScriptLibrary_PolyPathFunctions", "GetPolyPathVertex", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_GetPolyPathVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_PolyPathFunctions, SampleSplineToTransforms, "GeometryScriptLibrary_PolyPathFunctions", "SampleSplineToTransforms", SDK::Params::GeometryScriptLibrary_PolyPathFunctions_SampleSplineToTransforms)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SceneUtilityFunctions, CopyCollisionMeshesFromObject, "GeometryScriptLibrary_SceneUtilityFunctions", "CopyCollisionMeshesFromObject", SDK::Params::GeometryScriptLibrary_SceneUtilityFunctions_CopyCollisionMeshesFromObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SceneUtilityFunctions, CopyMeshFromComponent, "GeometryScriptLibrary_SceneUtilityFunctions", "CopyMeshFromComponent", SDK::Params::GeometryScriptLibrary_SceneUtilityFunctions_CopyMeshFromComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SceneUtilityFunctions, CreateDynamicMeshPool, "GeometryScriptLibrary_SceneUtilityFunctions", "CreateDynamicMeshPool", SDK::Params::GeometryScriptLibrary_SceneUtilityFunctions_CreateDynamicMeshPool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SceneUtilityFunctions, DetermineMeshOcclusion, "GeometryScriptLibrary_SceneUtilityFunctions", "DetermineMeshOcclusion", SDK::Params::GeometryScriptLibrary_SceneUtilityFunctions_DetermineMeshOcclusion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_SceneUtilityFunctions, SetComponentMaterialList, "GeometryScriptLibrary_SceneUtilityFunctions", "SetComponentMaterialList", SDK::Params::GeometryScriptLibrary_SceneUtilityFunctions_SetComponentMaterialList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_TransformFunctions, GetTransformAxisPlane, "GeometryScriptLibrary_TransformFunctions", "GetTransformAxisPlane", SDK::Params::GeometryScriptLibrary_TransformFunctions_GetTransformAxisPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_TransformFunctions, GetTransformAxisRay, "GeometryScriptLibrary_TransformFunctions", "GetTransformAxisRay", SDK::Params::GeometryScriptLibrary_TransformFunctions_GetTransformAxisRay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_TransformFunctions, GetTransformAxisVector, "GeometryScriptLibrary_TransformFunctions", "GetTransformAxisVector", SDK::Params::GeometryScriptLibrary_TransformFunctions_GetTransformAxisVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_TransformFunctions, MakeTransformFromAxes, "GeometryScriptLibrary_TransformFunctions", "MakeTransformFromAxes", SDK::Params::GeometryScriptLibrary_TransformFunctions_MakeTransformFromAxes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_TransformFunctions, MakeTransformFromZAxis, "GeometryScriptLibrary_TransformFunctions", "MakeTransformFromZAxis", SDK::Params::GeometryScriptLibrary_TransformFunctions_MakeTransformFromZAxis)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRayBoxIntersection, "GeometryScriptLibrary_RayFunctions", "GetRayBoxIntersection", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRayBoxIntersection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRayClosestPoint, "GeometryScriptLibrary_RayFunctions", "GetRayClosestPoint", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRayClosestPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRayLineClosestPoint, "GeometryScriptLibrary_RayFunctions", "GetRayLineClosestPoint", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRayLineClosestPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRayParameter, "GeometryScriptLibrary_RayFunctions", "GetRayParameter", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRayParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRayPlaneIntersection, "GeometryScriptLibrary_RayFunctions", "GetRayPlaneIntersection", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRayPlaneIntersection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRayPoint, "GeometryScriptLibrary_RayFunctions", "GetRayPoint", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRayPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRayPointDistance, "GeometryScriptLibrary_RayFunctions", "GetRayPointDistance", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRayPointDistance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRaySegmentClosestPoint, "GeometryScriptLibrary_RayFunctions", "GetRaySegmentClosestPoint", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRaySegmentClosestPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRaySphereIntersection, "GeometryScriptLibrary_RayFunctions", "GetRaySphereIntersection", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRaySphereIntersection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetRayStartEnd, "GeometryScriptLibrary_RayFunctions", "GetRayStartEnd", SDK::Params::GeometryScriptLibrary_RayFunctions_GetRayStartEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, GetTransformedRay, "GeometryScriptLibrary_RayFunctions", "GetTransformedRay", SDK::Params::GeometryScriptLibrary_RayFunctions_GetTransformedRay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, MakeRayFromPointDirection, "GeometryScriptLibrary_RayFunctions", "MakeRayFromPointDirection", SDK::Params::GeometryScriptLibrary_RayFunctions_MakeRayFromPointDirection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_RayFunctions, MakeRayFromPoints, "GeometryScriptLibrary_RayFunctions", "MakeRayFromPoints", SDK::Params::GeometryScriptLibrary_RayFunctions_MakeRayFromPoints)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, FindBoxBoxIntersection, "GeometryScriptLibrary_BoxFunctions", "FindBoxBoxIntersection", SDK::Params::GeometryScriptLibrary_BoxFunctions_FindBoxBoxIntersection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, FindClosestPointOnBox, "GeometryScriptLibrary_BoxFunctions", "FindClosestPointOnBox", SDK::Params::GeometryScriptLibrary_BoxFunctions_FindClosestPointOnBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, GetBoxBoxDistance, "GeometryScriptLibrary_BoxFunctions", "GetBoxBoxDistance", SDK::Params::GeometryScriptLibrary_BoxFunctions_GetBoxBoxDistance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, GetBoxCenterSize, "GeometryScriptLibrary_BoxFunctions", "GetBoxCenterSize", SDK::Params::GeometryScriptLibrary_BoxFunctions_GetBoxCenterSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, GetBoxCorner, "GeometryScriptLibrary_BoxFunctions", "GetBoxCorner", SDK::Params::GeometryScriptLibrary_BoxFunctions_GetBoxCorner)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, GetBoxFaceCenter, "GeometryScriptLibrary_BoxFunctions", "GetBoxFaceCenter", SDK::Params::GeometryScriptLibrary_BoxFunctions_GetBoxFaceCenter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, GetBoxPointDistance, "GeometryScriptLibrary_BoxFunctions", "GetBoxPointDistance", SDK::Params::GeometryScriptLibrary_BoxFunctions_GetBoxPointDistance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, GetBoxVolumeArea, "GeometryScriptLibrary_BoxFunctions", "GetBoxVolumeArea", SDK::Params::GeometryScriptLibrary_BoxFunctions_GetBoxVolumeArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, GetExpandedBox, "GeometryScriptLibrary_BoxFunctions", "GetExpandedBox", SDK::Params::GeometryScriptLibrary_BoxFunctions_GetExpandedBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, GetTransformedBox, "GeometryScriptLibrary_BoxFunctions", "GetTransformedBox", SDK::Params::GeometryScriptLibrary_BoxFunctions_GetTransformedBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, MakeBoxFromCenterExtents, "GeometryScriptLibrary_BoxFunctions", "MakeBoxFromCenterExtents", SDK::Params::GeometryScriptLibrary_BoxFunctions_MakeBoxFromCenterExtents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, MakeBoxFromCenterSize, "GeometryScriptLibrary_BoxFunctions", "MakeBoxFromCenterSize", SDK::Params::GeometryScriptLibrary_BoxFunctions_MakeBoxFromCenterSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, TestBoxBoxIntersection, "GeometryScriptLibrary_BoxFunctions", "TestBoxBoxIntersection", SDK::Params::GeometryScriptLibrary_BoxFunctions_TestBoxBoxIntersection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, TestBoxSphereIntersection, "GeometryScriptLibrary_BoxFunctions", "TestBoxSphereIntersection", SDK::Params::GeometryScriptLibrary_BoxFunctions_TestBoxSphereIntersection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_BoxFunctions, TestPointInsideBox, "GeometryScriptLibrary_BoxFunctions", "TestPointInsideBox", SDK::Params::GeometryScriptLibrary_BoxFunctions_TestPointInsideBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_TextureMapFunctions, SampleTexture2DAtUVPositions, "GeometryScriptLibrary_TextureMapFunctions", "SampleTexture2DAtUVPositions", SDK::Params::GeometryScriptLibrary_TextureMapFunctions_SampleTexture2DAtUVPositions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_TextureMapFunctions, SampleTextureRenderTarget2DAtUVPositions, "GeometryScriptLibrary_TextureMapFunctions", "SampleTextureRenderTarget2DAtUVPositions", SDK::Params::GeometryScriptLibrary_TextureMapFunctions_SampleTextureRenderTarget2DAtUVPositions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ConstantScalarMultiply, "GeometryScriptLibrary_VectorMathFunctions", "ConstantScalarMultiply", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ConstantScalarMultiply)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ConstantScalarMultiplyInPlace, "GeometryScriptLibrary_VectorMathFunctions", "ConstantScalarMultiplyInPlace", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ConstantScalarMultiplyInPlace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ConstantVectorMultiply, "GeometryScriptLibrary_VectorMathFunctions", "ConstantVectorMultiply", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ConstantVectorMultiply)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ConstantVectorMultiplyInPlace, "GeometryScriptLibrary_VectorMathFunctions", "ConstantVectorMultiplyInPlace", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ConstantVectorMultiplyInPlace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ScalarBlend, "GeometryScriptLibrary_VectorMathFunctions", "ScalarBlend", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ScalarBlend)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ScalarBlendInPlace, "GeometryScriptLibrary_VectorMathFunctions", "ScalarBlendInPlace", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ScalarBlendInPlace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ScalarInvert, "GeometryScriptLibrary_VectorMathFunctions", "ScalarInvert", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ScalarInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ScalarInvertInPlace, "GeometryScriptLibrary_VectorMathFunctions", "ScalarInvertInPlace", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ScalarInvertInPlace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ScalarMultiply, "GeometryScriptLibrary_VectorMathFunctions", "ScalarMultiply", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ScalarMultiply)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ScalarMultiplyInPlace, "GeometryScriptLibrary_VectorMathFunctions", "ScalarMultiplyInPlace", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ScalarMultiplyInPlace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ScalarVectorMultiply, "GeometryScriptLibrary_VectorMathFunctions", "ScalarVectorMultiply", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ScalarVectorMultiply)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, ScalarVectorMultiplyInPlace, "GeometryScriptLibrary_VectorMathFunctions", "ScalarVectorMultiplyInPlace", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_ScalarVectorMultiplyInPlace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, VectorBlend, "GeometryScriptLibrary_VectorMathFunctions", "VectorBlend", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_VectorBlend)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, VectorBlendInPlace, "GeometryScriptLibrary_VectorMathFunctions", "VectorBlendInPlace", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_VectorBlendInPlace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, VectorCross, "GeometryScriptLibrary_VectorMathFunctions", "VectorCross", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_VectorCross)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, VectorDot, "GeometryScriptLibrary_VectorMathFunctions", "VectorDot", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_VectorDot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, VectorLength, "GeometryScriptLibrary_VectorMathFunctions", "VectorLength", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_VectorLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, VectorNormalizeInPlace, "GeometryScriptLibrary_VectorMathFunctions", "VectorNormalizeInPlace", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_VectorNormalizeInPlace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGeometryScriptLibrary_VectorMathFunctions, VectorToScalar, "GeometryScriptLibrary_VectorMathFunctions", "VectorToScalar", SDK::Params::GeometryScriptLibrary_VectorMathFunctions_VectorToScalar)
+// clang-format on
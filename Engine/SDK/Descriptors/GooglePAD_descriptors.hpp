@@ -0,0 +1,29 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from GooglePAD_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/GooglePAD_classes.hpp"
+#include "../SDK/GooglePAD_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, CancelDownload, "GooglePADFunctionLibrary", "CancelDownload", SDK::Params::GooglePADFunctionLibrary_CancelDownload)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetAssetPackLocation, "GooglePADFunctionLibrary", "GetAssetPackLocation", SDK::Params::GooglePADFunctionLibrary_GetAssetPackLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetAssetsPath, "GooglePADFunctionLibrary", "GetAssetsPath", SDK::Params::GooglePADFunctionLibrary_GetAssetsPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetBytesDownloaded, "GooglePADFunctionLibrary", "GetBytesDownloaded", SDK::Params::GooglePADFunctionLibrary_GetBytesDownloaded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetDownloadState, "GooglePADFunctionLibrary", "GetDownloadState", SDK::Params::GooglePADFunctionLibrary_GetDownloadState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetDownloadStatus, "GooglePADFunctionLibrary", "GetDownloadStatus", SDK::Params::GooglePADFunctionLibrary_GetDownloadStatus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetShowCellularDataConfirmationStatus, "GooglePADFunctionLibrary", "GetShowCellularDataConfirmationStatus", SDK::Params::GooglePADFunctionLibrary_GetShowCellularDataConfirmationStatus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetShowConfirmationDialogStatus, "GooglePADFunctionLibrary", "GetShowConfirmationDialogStatus", SDK::Params::GooglePADFunctionLibrary_GetShowConfirmationDialogStatus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetStorageMethod, "GooglePADFunctionLibrary", "GetStorageMethod", SDK::Params::GooglePADFunctionLibrary_GetStorageMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, GetTotalBytesToDownload, "GooglePADFunctionLibrary", "GetTotalBytesToDownload", SDK::Params::GooglePADFunctionLibrary_GetTotalBytesToDownload)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, ReleaseAssetPackLocation, "GooglePADFunctionLibrary", "ReleaseAssetPackLocation", SDK::Params::GooglePADFunctionLibrary_ReleaseAssetPackLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, ReleaseDownloadState, "GooglePADFunctionLibrary", "ReleaseDownloadState", SDK::Params::GooglePADFunctionLibrary_ReleaseDownloadState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, RequestDownload, "GooglePADFunctionLibrary", "RequestDownload", SDK::Params::GooglePADFunctionLibrary_RequestDownload)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, RequestInfo, "GooglePADFunctionLibrary", "RequestInfo", SDK::Params::GooglePADFunctionLibrary_RequestInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, RequestRemoval, "GooglePADFunctionLibrary", "RequestRemoval", SDK::Params::GooglePADFunctionLibrary_RequestRemoval)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, ShowCellularDataConfirmation, "GooglePADFunctionLibrary", "ShowCellularDataConfirmation", SDK::Params::GooglePADFunctionLibrary_ShowCellularDataConfirmation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGooglePADFunctionLibrary, ShowConfirmationDialog, "GooglePADFunctionLibrary", "ShowConfirmationDialog", SDK::Params::GooglePADFunctionLibrary_ShowConfirmationDialog)
+// clang-format on
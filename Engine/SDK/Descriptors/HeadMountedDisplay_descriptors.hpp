@@ -0,0 +1,24 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from HeadMountedDisplay_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/HeadMountedDisplay_classes.hpp"
+#include "../SDK/HeadMountedDisplay_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UHandKeypointConversion, Conv_HandKeypointToInt32, "HandKeypointConversion", "Conv_HandKeypointToInt32", SDK::Params::HandKeypointConversion_Conv_HandKeypointToInt32)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, GetHandJointPosition, "MotionControllerComponent", "GetHandJointPosition", SDK::Params::MotionControllerComponent_GetHandJointPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, GetParameterValue, "MotionControllerComponent", "GetParameterValue", SDK::Params::MotionControllerComponent_GetParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, OnMotionControllerUpdated, "MotionControllerComponent", "OnMotionControllerUpdated", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, SetAssociatedPlayerIndex, "MotionControllerComponent", "SetAssociatedPlayerIndex", SDK::Params::MotionControllerComponent_SetAssociatedPlayerIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, SetTrackingMotionSource, "MotionControllerComponent", "SetTrackingMotionSource", SDK::Params::MotionControllerComponent_SetTrackingMotionSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, SetTrackingSource, "MotionControllerComponent", "SetTrackingSource", SDK::Params::MotionControllerComponent_SetTrackingSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, GetAngularVelocity, "MotionControllerComponent", "GetAngularVelocity", SDK::Params::MotionControllerComponent_GetAngularVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, GetLinearAcceleration, "MotionControllerComponent", "GetLinearAcceleration", SDK::Params::MotionControllerComponent_GetLinearAcceleration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, GetLinearVelocity, "MotionControllerComponent", "GetLinearVelocity", SDK::Params::MotionControllerComponent_GetLinearVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, GetTrackingSource, "MotionControllerComponent", "GetTrackingSource", SDK::Params::MotionControllerComponent_GetTrackingSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMotionControllerComponent, IsTracked, "MotionControllerComponent", "IsTracked", SDK::Params::MotionControllerComponent_IsTracked)
+// clang-format on
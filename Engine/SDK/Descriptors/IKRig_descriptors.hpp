@@ -0,0 +1,32 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from IKRig_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/IKRig_classes.hpp"
+#include "../SDK/IKRig_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IIKGoalCreatorInterface, AddIKGoals, "IKGoalCreatorInterface", "AddIKGoals", SDK::Params::IKGoalCreatorInterface_AddIKGoals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRigComponent, ClearAllGoals, "IKRigComponent", "ClearAllGoals", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRigComponent, SetIKRigGoal, "IKRigComponent", "SetIKRigGoal", SDK::Params::IKRigComponent_SetIKRigGoal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRigComponent, SetIKRigGoalPositionAndRotation, "IKRigComponent", "SetIKRigGoalPositionAndRotation", SDK::Params::IKRigComponent_SetIKRigGoalPositionAndRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRigComponent, SetIKRigGoalTransform, "IKRigComponent", "SetIKRigGoalTransform", SDK::Params::IKRigComponent_SetIKRigGoalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, GetChainSettingsFromRetargetAsset, "IKRetargeter", "GetChainSettingsFromRetargetAsset", SDK::Params::IKRetargeter_GetChainSettingsFromRetargetAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, GetChainSettingsFromRetargetProfile, "IKRetargeter", "GetChainSettingsFromRetargetProfile", SDK::Params::IKRetargeter_GetChainSettingsFromRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, GetChainUsingGoalFromRetargetAsset, "IKRetargeter", "GetChainUsingGoalFromRetargetAsset", SDK::Params::IKRetargeter_GetChainUsingGoalFromRetargetAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, GetGlobalSettingsFromRetargetAsset, "IKRetargeter", "GetGlobalSettingsFromRetargetAsset", SDK::Params::IKRetargeter_GetGlobalSettingsFromRetargetAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, GetGlobalSettingsFromRetargetProfile, "IKRetargeter", "GetGlobalSettingsFromRetargetProfile", SDK::Params::IKRetargeter_GetGlobalSettingsFromRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, GetRootSettingsFromRetargetAsset, "IKRetargeter", "GetRootSettingsFromRetargetAsset", SDK::Params::IKRetargeter_GetRootSettingsFromRetargetAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, GetRootSettingsFromRetargetProfile, "IKRetargeter", "GetRootSettingsFromRetargetProfile", SDK::Params::IKRetargeter_GetRootSettingsFromRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, SetChainFKSettingsInRetargetProfile, "IKRetargeter", "SetChainFKSettingsInRetargetProfile", SDK::Params::IKRetargeter_SetChainFKSettingsInRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, SetChainIKSettingsInRetargetProfile, "IKRetargeter", "SetChainIKSettingsInRetargetProfile", SDK::Params::IKRetargeter_SetChainIKSettingsInRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, SetChainSettingsInRetargetProfile, "IKRetargeter", "SetChainSettingsInRetargetProfile", SDK::Params::IKRetargeter_SetChainSettingsInRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, SetChainSpeedPlantSettingsInRetargetProfile, "IKRetargeter", "SetChainSpeedPlantSettingsInRetargetProfile", SDK::Params::IKRetargeter_SetChainSpeedPlantSettingsInRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, SetGlobalSettingsInRetargetProfile, "IKRetargeter", "SetGlobalSettingsInRetargetProfile", SDK::Params::IKRetargeter_SetGlobalSettingsInRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, SetRootSettingsInRetargetProfile, "IKRetargeter", "SetRootSettingsInRetargetProfile", SDK::Params::IKRetargeter_SetRootSettingsInRetargetProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, HasSourceIKRig, "IKRetargeter", "HasSourceIKRig", SDK::Params::IKRetargeter_HasSourceIKRig)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UIKRetargeter, HasTargetIKRig, "IKRetargeter", "HasTargetIKRig", SDK::Params::IKRetargeter_HasTargetIKRig)
+// clang-format on
@@ -0,0 +1,18 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ImageCore_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ImageCore_classes.hpp"
+#include "../SDK/ImageCore_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(USharedImageConstRefBlueprintFns, GetHeight, "SharedImageConstRefBlueprintFns", "GetHeight", SDK::Params::SharedImageConstRefBlueprintFns_GetHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USharedImageConstRefBlueprintFns, GetPixelLinearColor, "SharedImageConstRefBlueprintFns", "GetPixelLinearColor", SDK::Params::SharedImageConstRefBlueprintFns_GetPixelLinearColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USharedImageConstRefBlueprintFns, GetPixelValue, "SharedImageConstRefBlueprintFns", "GetPixelValue", SDK::Params::SharedImageConstRefBlueprintFns_GetPixelValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USharedImageConstRefBlueprintFns, GetSize, "SharedImageConstRefBlueprintFns", "GetSize", SDK::Params::SharedImageConstRefBlueprintFns_GetSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USharedImageConstRefBlueprintFns, GetWidth, "SharedImageConstRefBlueprintFns", "GetWidth", SDK::Params::SharedImageConstRefBlueprintFns_GetWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USharedImageConstRefBlueprintFns, IsValid, "SharedImageConstRefBlueprintFns", "IsValid", SDK::Params::SharedImageConstRefBlueprintFns_IsValid)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ImageWriteQueue_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ImageWriteQueue_classes.hpp"
+#include "../SDK/ImageWriteQueue_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImageWriteBlueprintLibrary, ExportToDisk, "ImageWriteBlueprintLibrary", "ExportToDisk", SDK::Params::ImageWriteBlueprintLibrary_ExportToDisk)
+// clang-format on
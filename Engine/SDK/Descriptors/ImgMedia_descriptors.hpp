@@ -0,0 +1,18 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ImgMedia_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ImgMedia_classes.hpp"
+#include "../SDK/ImgMedia_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImgMediaSource, AddTargetObject, "ImgMediaSource", "AddTargetObject", SDK::Params::ImgMediaSource_AddTargetObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImgMediaSource, RemoveTargetObject, "ImgMediaSource", "RemoveTargetObject", SDK::Params::ImgMediaSource_RemoveTargetObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImgMediaSource, SetSequencePath, "ImgMediaSource", "SetSequencePath", SDK::Params::ImgMediaSource_SetSequencePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImgMediaSource, SetTokenizedSequencePath, "ImgMediaSource", "SetTokenizedSequencePath", SDK::Params::ImgMediaSource_SetTokenizedSequencePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImgMediaSource, GetProxies, "ImgMediaSource", "GetProxies", SDK::Params::ImgMediaSource_GetProxies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImgMediaSource, GetSequencePath, "ImgMediaSource", "GetSequencePath", SDK::Params::ImgMediaSource_GetSequencePath)
+// clang-format on
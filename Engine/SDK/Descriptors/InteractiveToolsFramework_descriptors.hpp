@@ -0,0 +1,36 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from InteractiveToolsFramework_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/InteractiveToolsFramework_classes.hpp"
+#include "../SDK/InteractiveToolsFramework_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGizmoBaseComponent, UpdateHoverState, "GizmoBaseComponent", "UpdateHoverState", SDK::Params::GizmoBaseComponent_UpdateHoverState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGizmoBaseComponent, UpdateWorldLocalState, "GizmoBaseComponent", "UpdateWorldLocalState", SDK::Params::GizmoBaseComponent_UpdateWorldLocalState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoTransformSource, SetTransform, "GizmoTransformSource", "SetTransform", SDK::Params::GizmoTransformSource_SetTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoTransformSource, GetTransform, "GizmoTransformSource", "GetTransform", SDK::Params::GizmoTransformSource_GetTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoAxisSource, GetDirection, "GizmoAxisSource", "GetDirection", SDK::Params::GizmoAxisSource_GetDirection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoAxisSource, GetOrigin, "GizmoAxisSource", "GetOrigin", SDK::Params::GizmoAxisSource_GetOrigin)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoAxisSource, GetTangentVectors, "GizmoAxisSource", "GetTangentVectors", SDK::Params::GizmoAxisSource_GetTangentVectors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoAxisSource, HasTangentVectors, "GizmoAxisSource", "HasTangentVectors", SDK::Params::GizmoAxisSource_HasTangentVectors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoClickTarget, UpdateHoverState, "GizmoClickTarget", "UpdateHoverState", SDK::Params::GizmoClickTarget_UpdateHoverState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoClickTarget, UpdateInteractingState, "GizmoClickTarget", "UpdateInteractingState", SDK::Params::GizmoClickTarget_UpdateInteractingState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoClickMultiTarget, UpdateHittableState, "GizmoClickMultiTarget", "UpdateHittableState", SDK::Params::GizmoClickMultiTarget_UpdateHittableState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoClickMultiTarget, UpdateHoverState, "GizmoClickMultiTarget", "UpdateHoverState", SDK::Params::GizmoClickMultiTarget_UpdateHoverState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoClickMultiTarget, UpdateInteractingState, "GizmoClickMultiTarget", "UpdateInteractingState", SDK::Params::GizmoClickMultiTarget_UpdateInteractingState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoRenderMultiTarget, UpdateVisibilityState, "GizmoRenderMultiTarget", "UpdateVisibilityState", SDK::Params::GizmoRenderMultiTarget_UpdateVisibilityState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoStateTarget, BeginUpdate, "GizmoStateTarget", "BeginUpdate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoStateTarget, EndUpdate, "GizmoStateTarget", "EndUpdate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoFloatParameterSource, BeginModify, "GizmoFloatParameterSource", "BeginModify", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoFloatParameterSource, EndModify, "GizmoFloatParameterSource", "EndModify", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoFloatParameterSource, SetParameter, "GizmoFloatParameterSource", "SetParameter", SDK::Params::GizmoFloatParameterSource_SetParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoFloatParameterSource, GetParameter, "GizmoFloatParameterSource", "GetParameter", SDK::Params::GizmoFloatParameterSource_GetParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoVec2ParameterSource, BeginModify, "GizmoVec2ParameterSource", "BeginModify", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoVec2ParameterSource, EndModify, "GizmoVec2ParameterSource", "EndModify", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoVec2ParameterSource, SetParameter, "GizmoVec2ParameterSource", "SetParameter", SDK::Params::GizmoVec2ParameterSource_SetParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IGizmoVec2ParameterSource, GetParameter, "GizmoVec2ParameterSource", "GetParameter", SDK::Params::GizmoVec2ParameterSource_GetParameter)
+// clang-format on
@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from InterchangeCore_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/InterchangeCore_classes.hpp"
+#include "../SDK/InterchangeCore_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBase, GetFactoryClass, "InterchangeFactoryBase", "GetFactoryClass", SDK::Params::InterchangeFactoryBase_GetFactoryClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceData, SetFilename, "InterchangeSourceData", "SetFilename", SDK::Params::InterchangeSourceData_SetFilename)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceData, GetFilename, "InterchangeSourceData", "GetFilename", SDK::Params::InterchangeSourceData_GetFilename)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineBase, FindOrAddPropertyStates, "InterchangePipelineBase", "FindOrAddPropertyStates", SDK::Params::InterchangePipelineBase_FindOrAddPropertyStates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineBase, ScriptedExecuteExportPipeline, "InterchangePipelineBase", "ScriptedExecuteExportPipeline", SDK::Params::InterchangePipelineBase_ScriptedExecuteExportPipeline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineBase, ScriptedExecutePipeline, "InterchangePipelineBase", "ScriptedExecutePipeline", SDK::Params::InterchangePipelineBase_ScriptedExecutePipeline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineBase, ScriptedExecutePostFactoryPipeline, "InterchangePipelineBase", "ScriptedExecutePostFactoryPipeline", SDK::Params::InterchangePipelineBase_ScriptedExecutePostFactoryPipeline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineBase, ScriptedExecutePostImportPipeline, "InterchangePipelineBase", "ScriptedExecutePostImportPipeline", SDK::Params::InterchangePipelineBase_ScriptedExecutePostImportPipeline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineBase, ScriptedSetReimportSourceIndex, "InterchangePipelineBase", "ScriptedSetReimportSourceIndex", SDK::Params::InterchangePipelineBase_ScriptedSetReimportSourceIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineBase, DoesPropertyStatesExist, "InterchangePipelineBase", "DoesPropertyStatesExist", SDK::Params::InterchangePipelineBase_DoesPropertyStatesExist)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineBase, ScriptedGetPipelineDisplayName, "InterchangePipelineBase", "ScriptedGetPipelineDisplayName", SDK::Params::InterchangePipelineBase_ScriptedGetPipelineDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddBooleanAttribute, "InterchangeBaseNode", "AddBooleanAttribute", SDK::Params::InterchangeBaseNode_AddBooleanAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddDoubleAttribute, "InterchangeBaseNode", "AddDoubleAttribute", SDK::Params::InterchangeBaseNode_AddDoubleAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddFloatAttribute, "InterchangeBaseNode", "AddFloatAttribute", SDK::Params::InterchangeBaseNode_AddFloatAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddGuidAttribute, "InterchangeBaseNode", "AddGuidAttribute", SDK::Params::InterchangeBaseNode_AddGuidAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddInt32Attribute, "InterchangeBaseNode", "AddInt32Attribute", SDK::Params::InterchangeBaseNode_AddInt32Attribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddLinearColorAttribute, "InterchangeBaseNode", "AddLinearColorAttribute", SDK::Params::InterchangeBaseNode_AddLinearColorAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddStringAttribute, "InterchangeBaseNode", "AddStringAttribute", SDK::Params::InterchangeBaseNode_AddStringAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddVector2Attribute, "InterchangeBaseNode", "AddVector2Attribute", SDK::Params::InterchangeBaseNode_AddVector2Attribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, InitializeNode, "InterchangeBaseNode", "InitializeNode", SDK::Params::InterchangeBaseNode_InitializeNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, RemoveAttribute, "InterchangeBaseNode", "RemoveAttribute", SDK::Params::InterchangeBaseNode_RemoveAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, SetAssetName, "InterchangeBaseNode", "SetAssetName", SDK::Params::InterchangeBaseNode_SetAssetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, SetDisplayLabel, "InterchangeBaseNode", "SetDisplayLabel", SDK::Params::InterchangeBaseNode_SetDisplayLabel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, SetEnabled, "InterchangeBaseNode", "SetEnabled", SDK::Params::InterchangeBaseNode_SetEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, SetParentUid, "InterchangeBaseNode", "SetParentUid", SDK::Params::InterchangeBaseNode_SetParentUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, AddTargetNodeUid, "InterchangeBaseNode", "AddTargetNodeUid", SDK::Params::InterchangeBaseNode_AddTargetNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetAssetName, "InterchangeBaseNode", "GetAssetName", SDK::Params::InterchangeBaseNode_GetAssetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetBooleanAttribute, "InterchangeBaseNode", "GetBooleanAttribute", SDK::Params::InterchangeBaseNode_GetBooleanAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetDisplayLabel, "InterchangeBaseNode", "GetDisplayLabel", SDK::Params::InterchangeBaseNode_GetDisplayLabel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetDoubleAttribute, "InterchangeBaseNode", "GetDoubleAttribute", SDK::Params::InterchangeBaseNode_GetDoubleAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetFloatAttribute, "InterchangeBaseNode", "GetFloatAttribute", SDK::Params::InterchangeBaseNode_GetFloatAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetGuidAttribute, "InterchangeBaseNode", "GetGuidAttribute", SDK::Params::InterchangeBaseNode_GetGuidAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetInt32Attribute, "InterchangeBaseNode", "GetInt32Attribute", SDK::Params::InterchangeBaseNode_GetInt32Attribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetLinearColorAttribute, "InterchangeBaseNode", "GetLinearColorAttribute", SDK::Params::InterchangeBaseNode_GetLinearColorAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetNodeContainerType, "InterchangeBaseNode", "GetNodeContainerType", SDK::Params::InterchangeBaseNode_GetNodeContainerType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetParentUid, "InterchangeBaseNode", "GetParentUid", SDK::Params::InterchangeBaseNode_GetParentUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetStringAttribute, "InterchangeBaseNode", "GetStringAttribute", SDK::Params::InterchangeBaseNode_GetStringAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetTargetNodeCount, "InterchangeBaseNode", "GetTargetNodeCount", SDK::Params::InterchangeBaseNode_GetTargetNodeCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetTargetNodeUids, "InterchangeBaseNode", "GetTargetNodeUids", SDK::Params::InterchangeBaseNode_GetTargetNodeUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetUniqueID, "InterchangeBaseNode", "GetUniqueID", SDK::Params::InterchangeBaseNode_GetUniqueID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, GetVector2Attribute, "InterchangeBaseNode", "GetVector2Attribute", SDK::Params::InterchangeBaseNode_GetVector2Attribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, IsEnabled, "InterchangeBaseNode", "IsEnabled", SDK::Params::InterchangeBaseNode_IsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNode, RemoveTargetNodeUid, "InterchangeBaseNode", "RemoveTargetNodeUid", SDK::Params::InterchangeBaseNode_RemoveTargetNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, AddNode, "InterchangeBaseNodeContainer", "AddNode", SDK::Params::InterchangeBaseNodeContainer_AddNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, ComputeChildrenCache, "InterchangeBaseNodeContainer", "ComputeChildrenCache", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, GetNodeChildren, "InterchangeBaseNodeContainer", "GetNodeChildren", SDK::Params::InterchangeBaseNodeContainer_GetNodeChildren)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, LoadFromFile, "InterchangeBaseNodeContainer", "LoadFromFile", SDK::Params::InterchangeBaseNodeContainer_LoadFromFile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, ReplaceNode, "InterchangeBaseNodeContainer", "ReplaceNode", SDK::Params::InterchangeBaseNodeContainer_ReplaceNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, Reset, "InterchangeBaseNodeContainer", "Reset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, ResetChildrenCache, "InterchangeBaseNodeContainer", "ResetChildrenCache", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, SaveToFile, "InterchangeBaseNodeContainer", "SaveToFile", SDK::Params::InterchangeBaseNodeContainer_SaveToFile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, SetNodeParentUid, "InterchangeBaseNodeContainer", "SetNodeParentUid", SDK::Params::InterchangeBaseNodeContainer_SetNodeParentUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, GetFactoryNode, "InterchangeBaseNodeContainer", "GetFactoryNode", SDK::Params::InterchangeBaseNodeContainer_GetFactoryNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, GetNode, "InterchangeBaseNodeContainer", "GetNode", SDK::Params::InterchangeBaseNodeContainer_GetNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, GetNodeChildrenCount, "InterchangeBaseNodeContainer", "GetNodeChildrenCount", SDK::Params::InterchangeBaseNodeContainer_GetNodeChildrenCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, GetNodeChildrenUids, "InterchangeBaseNodeContainer", "GetNodeChildrenUids", SDK::Params::InterchangeBaseNodeContainer_GetNodeChildrenUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, GetNodes, "InterchangeBaseNodeContainer", "GetNodes", SDK::Params::InterchangeBaseNodeContainer_GetNodes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, GetRoots, "InterchangeBaseNodeContainer", "GetRoots", SDK::Params::InterchangeBaseNodeContainer_GetRoots)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseNodeContainer, IsNodeUidValid, "InterchangeBaseNodeContainer", "IsNodeUidValid", SDK::Params::InterchangeBaseNodeContainer_IsNodeUidValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, AddFactoryDependencyUid, "InterchangeFactoryBaseNode", "AddFactoryDependencyUid", SDK::Params::InterchangeFactoryBaseNode_AddFactoryDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, RemoveFactoryDependencyUid, "InterchangeFactoryBaseNode", "RemoveFactoryDependencyUid", SDK::Params::InterchangeFactoryBaseNode_RemoveFactoryDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, SetCustomReferenceObject, "InterchangeFactoryBaseNode", "SetCustomReferenceObject", SDK::Params::InterchangeFactoryBaseNode_SetCustomReferenceObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, SetCustomSubPath, "InterchangeFactoryBaseNode", "SetCustomSubPath", SDK::Params::InterchangeFactoryBaseNode_SetCustomSubPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, SetForceNodeReimport, "InterchangeFactoryBaseNode", "SetForceNodeReimport", SDK::Params::InterchangeFactoryBaseNode_SetForceNodeReimport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, SetReimportStrategyFlags, "InterchangeFactoryBaseNode", "SetReimportStrategyFlags", SDK::Params::InterchangeFactoryBaseNode_SetReimportStrategyFlags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, SetSkipNodeImport, "InterchangeFactoryBaseNode", "SetSkipNodeImport", SDK::Params::InterchangeFactoryBaseNode_SetSkipNodeImport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, UnsetForceNodeReimport, "InterchangeFactoryBaseNode", "UnsetForceNodeReimport", SDK::Params::InterchangeFactoryBaseNode_UnsetForceNodeReimport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, UnsetSkipNodeImport, "InterchangeFactoryBaseNode", "UnsetSkipNodeImport", SDK::Params::InterchangeFactoryBaseNode_UnsetSkipNodeImport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, GetCustomReferenceObject, "InterchangeFactoryBaseNode", "GetCustomReferenceObject", SDK::Params::InterchangeFactoryBaseNode_GetCustomReferenceObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, GetCustomSubPath, "InterchangeFactoryBaseNode", "GetCustomSubPath", SDK::Params::InterchangeFactoryBaseNode_GetCustomSubPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, GetFactoryDependencies, "InterchangeFactoryBaseNode", "GetFactoryDependencies", SDK::Params::InterchangeFactoryBaseNode_GetFactoryDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, GetFactoryDependenciesCount, "InterchangeFactoryBaseNode", "GetFactoryDependenciesCount", SDK::Params::InterchangeFactoryBaseNode_GetFactoryDependenciesCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, GetFactoryDependency, "InterchangeFactoryBaseNode", "GetFactoryDependency", SDK::Params::InterchangeFactoryBaseNode_GetFactoryDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, GetReimportStrategyFlags, "InterchangeFactoryBaseNode", "GetReimportStrategyFlags", SDK::Params::InterchangeFactoryBaseNode_GetReimportStrategyFlags)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, ShouldForceNodeReimport, "InterchangeFactoryBaseNode", "ShouldForceNodeReimport", SDK::Params::InterchangeFactoryBaseNode_ShouldForceNodeReimport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFactoryBaseNode, ShouldSkipNodeImport, "InterchangeFactoryBaseNode", "ShouldSkipNodeImport", SDK::Params::InterchangeFactoryBaseNode_ShouldSkipNodeImport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, InitializeSourceNode, "InterchangeSourceNode", "InitializeSourceNode", SDK::Params::InterchangeSourceNode_InitializeSourceNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, SetCustomAnimatedTimeEnd, "InterchangeSourceNode", "SetCustomAnimatedTimeEnd", SDK::Params::InterchangeSourceNode_SetCustomAnimatedTimeEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, SetCustomAnimatedTimeStart, "InterchangeSourceNode", "SetCustomAnimatedTimeStart", SDK::Params::InterchangeSourceNode_SetCustomAnimatedTimeStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, SetCustomImportUnusedMaterial, "InterchangeSourceNode", "SetCustomImportUnusedMaterial", SDK::Params::InterchangeSourceNode_SetCustomImportUnusedMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, SetCustomSourceFrameRateDenominator, "InterchangeSourceNode", "SetCustomSourceFrameRateDenominator", SDK::Params::InterchangeSourceNode_SetCustomSourceFrameRateDenominator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, SetCustomSourceFrameRateNumerator, "InterchangeSourceNode", "SetCustomSourceFrameRateNumerator", SDK::Params::InterchangeSourceNode_SetCustomSourceFrameRateNumerator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, SetCustomSourceTimelineEnd, "InterchangeSourceNode", "SetCustomSourceTimelineEnd", SDK::Params::InterchangeSourceNode_SetCustomSourceTimelineEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, SetCustomSourceTimelineStart, "InterchangeSourceNode", "SetCustomSourceTimelineStart", SDK::Params::InterchangeSourceNode_SetCustomSourceTimelineStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, GetCustomAnimatedTimeEnd, "InterchangeSourceNode", "GetCustomAnimatedTimeEnd", SDK::Params::InterchangeSourceNode_GetCustomAnimatedTimeEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, GetCustomAnimatedTimeStart, "InterchangeSourceNode", "GetCustomAnimatedTimeStart", SDK::Params::InterchangeSourceNode_GetCustomAnimatedTimeStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, GetCustomImportUnusedMaterial, "InterchangeSourceNode", "GetCustomImportUnusedMaterial", SDK::Params::InterchangeSourceNode_GetCustomImportUnusedMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, GetCustomSourceFrameRateDenominator, "InterchangeSourceNode", "GetCustomSourceFrameRateDenominator", SDK::Params::InterchangeSourceNode_GetCustomSourceFrameRateDenominator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, GetCustomSourceFrameRateNumerator, "InterchangeSourceNode", "GetCustomSourceFrameRateNumerator", SDK::Params::InterchangeSourceNode_GetCustomSourceFrameRateNumerator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, GetCustomSourceTimelineEnd, "InterchangeSourceNode", "GetCustomSourceTimelineEnd", SDK::Params::InterchangeSourceNode_GetCustomSourceTimelineEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSourceNode, GetCustomSourceTimelineStart, "InterchangeSourceNode", "GetCustomSourceTimelineStart", SDK::Params::InterchangeSourceNode_GetCustomSourceTimelineStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, CreateUserDefinedAttribute_Boolean, "InterchangeUserDefinedAttributesAPI", "CreateUserDefinedAttribute_Boolean", SDK::Params::InterchangeUserDefinedAttributesAPI_CreateUserDefinedAttribute_Boolean)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, CreateUserDefinedAttribute_Double, "InterchangeUserDefinedAttributesAPI", "CreateUserDefinedAttribute_Double", SDK::Params::InterchangeUserDefinedAttributesAPI_CreateUserDefinedAttribute_Double)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, CreateUserDefinedAttribute_Float, "InterchangeUserDefinedAttributesAPI", "CreateUserDefinedAttribute_Float", SDK::Params::InterchangeUserDefinedAttributesAPI_CreateUserDefinedAttribute_Float)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, CreateUserDefinedAttribute_FString, "InterchangeUserDefinedAttributesAPI", "CreateUserDefinedAttribute_FString", SDK::Params::InterchangeUserDefinedAttributesAPI_CreateUserDefinedAttribute_FString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, CreateUserDefinedAttribute_Int32, "InterchangeUserDefinedAttributesAPI", "CreateUserDefinedAttribute_Int32", SDK::Params::InterchangeUserDefinedAttributesAPI_CreateUserDefinedAttribute_Int32)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, DuplicateAllUserDefinedAttribute, "InterchangeUserDefinedAttributesAPI", "DuplicateAllUserDefinedAttribute", SDK::Params::InterchangeUserDefinedAttributesAPI_DuplicateAllUserDefinedAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, GetUserDefinedAttribute_Boolean, "InterchangeUserDefinedAttributesAPI", "GetUserDefinedAttribute_Boolean", SDK::Params::InterchangeUserDefinedAttributesAPI_GetUserDefinedAttribute_Boolean)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, GetUserDefinedAttribute_Double, "InterchangeUserDefinedAttributesAPI", "GetUserDefinedAttribute_Double", SDK::Params::InterchangeUserDefinedAttributesAPI_GetUserDefinedAttribute_Double)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, GetUserDefinedAttribute_Float, "InterchangeUserDefinedAttributesAPI", "GetUserDefinedAttribute_Float", SDK::Params::InterchangeUserDefinedAttributesAPI_GetUserDefinedAttribute_Float)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, GetUserDefinedAttribute_FString, "InterchangeUserDefinedAttributesAPI", "GetUserDefinedAttribute_FString", SDK::Params::InterchangeUserDefinedAttributesAPI_GetUserDefinedAttribute_FString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, GetUserDefinedAttribute_Int32, "InterchangeUserDefinedAttributesAPI", "GetUserDefinedAttribute_Int32", SDK::Params::InterchangeUserDefinedAttributesAPI_GetUserDefinedAttribute_Int32)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, GetUserDefinedAttributeInfos, "InterchangeUserDefinedAttributesAPI", "GetUserDefinedAttributeInfos", SDK::Params::InterchangeUserDefinedAttributesAPI_GetUserDefinedAttributeInfos)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeUserDefinedAttributesAPI, RemoveUserDefinedAttribute, "InterchangeUserDefinedAttributesAPI", "RemoveUserDefinedAttribute", SDK::Params::InterchangeUserDefinedAttributesAPI_RemoveUserDefinedAttribute)
+// clang-format on
@@ -0,0 +1,39 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from InterchangeEngine_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/InterchangeEngine_classes.hpp"
+#include "../SDK/InterchangeEngine_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFilePickerBase, ScriptedFilePickerForTranslatorAssetType, "InterchangeFilePickerBase", "ScriptedFilePickerForTranslatorAssetType", SDK::Params::InterchangeFilePickerBase_ScriptedFilePickerForTranslatorAssetType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFilePickerBase, ScriptedFilePickerForTranslatorType, "InterchangeFilePickerBase", "ScriptedFilePickerForTranslatorType", SDK::Params::InterchangeFilePickerBase_ScriptedFilePickerForTranslatorType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineConfigurationBase, ScriptedShowPipelineConfigurationDialog, "InterchangePipelineConfigurationBase", "ScriptedShowPipelineConfigurationDialog", SDK::Params::InterchangePipelineConfigurationBase_ScriptedShowPipelineConfigurationDialog)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineConfigurationBase, ScriptedShowReimportPipelineConfigurationDialog, "InterchangePipelineConfigurationBase", "ScriptedShowReimportPipelineConfigurationDialog", SDK::Params::InterchangePipelineConfigurationBase_ScriptedShowReimportPipelineConfigurationDialog)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineConfigurationBase, ScriptedShowScenePipelineConfigurationDialog, "InterchangePipelineConfigurationBase", "ScriptedShowScenePipelineConfigurationDialog", SDK::Params::InterchangePipelineConfigurationBase_ScriptedShowScenePipelineConfigurationDialog)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, GetNodeContainer, "InterchangeAssetImportData", "GetNodeContainer", SDK::Params::InterchangeAssetImportData_GetNodeContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, GetNumberOfPipelines, "InterchangeAssetImportData", "GetNumberOfPipelines", SDK::Params::InterchangeAssetImportData_GetNumberOfPipelines)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, GetPipelines, "InterchangeAssetImportData", "GetPipelines", SDK::Params::InterchangeAssetImportData_GetPipelines)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, GetStoredFactoryNode, "InterchangeAssetImportData", "GetStoredFactoryNode", SDK::Params::InterchangeAssetImportData_GetStoredFactoryNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, GetStoredNode, "InterchangeAssetImportData", "GetStoredNode", SDK::Params::InterchangeAssetImportData_GetStoredNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, GetTranslatorSettings, "InterchangeAssetImportData", "GetTranslatorSettings", SDK::Params::InterchangeAssetImportData_GetTranslatorSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, ScriptExtractDisplayLabels, "InterchangeAssetImportData", "ScriptExtractDisplayLabels", SDK::Params::InterchangeAssetImportData_ScriptExtractDisplayLabels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, ScriptExtractFilenames, "InterchangeAssetImportData", "ScriptExtractFilenames", SDK::Params::InterchangeAssetImportData_ScriptExtractFilenames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, ScriptGetFirstFilename, "InterchangeAssetImportData", "ScriptGetFirstFilename", SDK::Params::InterchangeAssetImportData_ScriptGetFirstFilename)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, SetNodeContainer, "InterchangeAssetImportData", "SetNodeContainer", SDK::Params::InterchangeAssetImportData_SetNodeContainer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, SetPipelines, "InterchangeAssetImportData", "SetPipelines", SDK::Params::InterchangeAssetImportData_SetPipelines)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAssetImportData, SetTranslatorSettings, "InterchangeAssetImportData", "SetTranslatorSettings", SDK::Params::InterchangeAssetImportData_SetTranslatorSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineStackOverride, AddBlueprintPipeline, "InterchangePipelineStackOverride", "AddBlueprintPipeline", SDK::Params::InterchangePipelineStackOverride_AddBlueprintPipeline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineStackOverride, AddPipeline, "InterchangePipelineStackOverride", "AddPipeline", SDK::Params::InterchangePipelineStackOverride_AddPipeline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineStackOverride, AddPythonPipeline, "InterchangePipelineStackOverride", "AddPythonPipeline", SDK::Params::InterchangePipelineStackOverride_AddPythonPipeline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeManager, CreateSourceData, "InterchangeManager", "CreateSourceData", SDK::Params::InterchangeManager_CreateSourceData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeManager, GetInterchangeManagerScripted, "InterchangeManager", "GetInterchangeManagerScripted", SDK::Params::InterchangeManager_GetInterchangeManagerScripted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeManager, ExportAsset, "InterchangeManager", "ExportAsset", SDK::Params::InterchangeManager_ExportAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeManager, ExportScene, "InterchangeManager", "ExportScene", SDK::Params::InterchangeManager_ExportScene)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeManager, ImportAsset, "InterchangeManager", "ImportAsset", SDK::Params::InterchangeManager_ImportAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeManager, ImportScene, "InterchangeManager", "ImportScene", SDK::Params::InterchangeManager_ImportScene)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeManager, GetRegisteredFactoryClass, "InterchangeManager", "GetRegisteredFactoryClass", SDK::Params::InterchangeManager_GetRegisteredFactoryClass)
+// clang-format on
@@ -0,0 +1,476 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from InterchangeFactoryNodes_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/InterchangeFactoryNodes_classes.hpp"
+#include "../SDK/InterchangeFactoryNodes_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeActorFactoryNode, SetCustomActorClassName, "InterchangeActorFactoryNode", "SetCustomActorClassName", SDK::Params::InterchangeActorFactoryNode_SetCustomActorClassName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeActorFactoryNode, SetCustomGlobalTransform, "InterchangeActorFactoryNode", "SetCustomGlobalTransform", SDK::Params::InterchangeActorFactoryNode_SetCustomGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeActorFactoryNode, SetCustomLocalTransform, "InterchangeActorFactoryNode", "SetCustomLocalTransform", SDK::Params::InterchangeActorFactoryNode_SetCustomLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeActorFactoryNode, SetCustomMobility, "InterchangeActorFactoryNode", "SetCustomMobility", SDK::Params::InterchangeActorFactoryNode_SetCustomMobility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeActorFactoryNode, GetCustomActorClassName, "InterchangeActorFactoryNode", "GetCustomActorClassName", SDK::Params::InterchangeActorFactoryNode_GetCustomActorClassName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeActorFactoryNode, GetCustomGlobalTransform, "InterchangeActorFactoryNode", "GetCustomGlobalTransform", SDK::Params::InterchangeActorFactoryNode_GetCustomGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeActorFactoryNode, GetCustomLocalTransform, "InterchangeActorFactoryNode", "GetCustomLocalTransform", SDK::Params::InterchangeActorFactoryNode_GetCustomLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeActorFactoryNode, GetCustomMobility, "InterchangeActorFactoryNode", "GetCustomMobility", SDK::Params::InterchangeActorFactoryNode_GetCustomMobility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraFactoryNode, SetCustomFocalLength, "InterchangePhysicalCameraFactoryNode", "SetCustomFocalLength", SDK::Params::InterchangePhysicalCameraFactoryNode_SetCustomFocalLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraFactoryNode, SetCustomFocusMethod, "InterchangePhysicalCameraFactoryNode", "SetCustomFocusMethod", SDK::Params::InterchangePhysicalCameraFactoryNode_SetCustomFocusMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraFactoryNode, SetCustomSensorHeight, "InterchangePhysicalCameraFactoryNode", "SetCustomSensorHeight", SDK::Params::InterchangePhysicalCameraFactoryNode_SetCustomSensorHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraFactoryNode, SetCustomSensorWidth, "InterchangePhysicalCameraFactoryNode", "SetCustomSensorWidth", SDK::Params::InterchangePhysicalCameraFactoryNode_SetCustomSensorWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraFactoryNode, GetCustomFocalLength, "InterchangePhysicalCameraFactoryNode", "GetCustomFocalLength", SDK::Params::InterchangePhysicalCameraFactoryNode_GetCustomFocalLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraFactoryNode, GetCustomFocusMethod, "InterchangePhysicalCameraFactoryNode", "GetCustomFocusMethod", SDK::Params::InterchangePhysicalCameraFactoryNode_GetCustomFocusMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraFactoryNode, GetCustomSensorHeight, "InterchangePhysicalCameraFactoryNode", "GetCustomSensorHeight", SDK::Params::InterchangePhysicalCameraFactoryNode_GetCustomSensorHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraFactoryNode, GetCustomSensorWidth, "InterchangePhysicalCameraFactoryNode", "GetCustomSensorWidth", SDK::Params::InterchangePhysicalCameraFactoryNode_GetCustomSensorWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, SetCustomAspectRatio, "InterchangeStandardCameraFactoryNode", "SetCustomAspectRatio", SDK::Params::InterchangeStandardCameraFactoryNode_SetCustomAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, SetCustomFarClipPlane, "InterchangeStandardCameraFactoryNode", "SetCustomFarClipPlane", SDK::Params::InterchangeStandardCameraFactoryNode_SetCustomFarClipPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, SetCustomFieldOfView, "InterchangeStandardCameraFactoryNode", "SetCustomFieldOfView", SDK::Params::InterchangeStandardCameraFactoryNode_SetCustomFieldOfView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, SetCustomNearClipPlane, "InterchangeStandardCameraFactoryNode", "SetCustomNearClipPlane", SDK::Params::InterchangeStandardCameraFactoryNode_SetCustomNearClipPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, SetCustomProjectionMode, "InterchangeStandardCameraFactoryNode", "SetCustomProjectionMode", SDK::Params::InterchangeStandardCameraFactoryNode_SetCustomProjectionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, SetCustomWidth, "InterchangeStandardCameraFactoryNode", "SetCustomWidth", SDK::Params::InterchangeStandardCameraFactoryNode_SetCustomWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, GetCustomAspectRatio, "InterchangeStandardCameraFactoryNode", "GetCustomAspectRatio", SDK::Params::InterchangeStandardCameraFactoryNode_GetCustomAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, GetCustomFarClipPlane, "InterchangeStandardCameraFactoryNode", "GetCustomFarClipPlane", SDK::Params::InterchangeStandardCameraFactoryNode_GetCustomFarClipPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, GetCustomFieldOfView, "InterchangeStandardCameraFactoryNode", "GetCustomFieldOfView", SDK::Params::InterchangeStandardCameraFactoryNode_GetCustomFieldOfView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, GetCustomNearClipPlane, "InterchangeStandardCameraFactoryNode", "GetCustomNearClipPlane", SDK::Params::InterchangeStandardCameraFactoryNode_GetCustomNearClipPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, GetCustomProjectionMode, "InterchangeStandardCameraFactoryNode", "GetCustomProjectionMode", SDK::Params::InterchangeStandardCameraFactoryNode_GetCustomProjectionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraFactoryNode, GetCustomWidth, "InterchangeStandardCameraFactoryNode", "GetCustomWidth", SDK::Params::InterchangeStandardCameraFactoryNode_GetCustomWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalActorFactoryNode, SetCustomDecalMaterialPathName, "InterchangeDecalActorFactoryNode", "SetCustomDecalMaterialPathName", SDK::Params::InterchangeDecalActorFactoryNode_SetCustomDecalMaterialPathName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalActorFactoryNode, SetCustomDecalSize, "InterchangeDecalActorFactoryNode", "SetCustomDecalSize", SDK::Params::InterchangeDecalActorFactoryNode_SetCustomDecalSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalActorFactoryNode, SetCustomSortOrder, "InterchangeDecalActorFactoryNode", "SetCustomSortOrder", SDK::Params::InterchangeDecalActorFactoryNode_SetCustomSortOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalActorFactoryNode, GetCustomDecalMaterialPathName, "InterchangeDecalActorFactoryNode", "GetCustomDecalMaterialPathName", SDK::Params::InterchangeDecalActorFactoryNode_GetCustomDecalMaterialPathName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalActorFactoryNode, GetCustomDecalSize, "InterchangeDecalActorFactoryNode", "GetCustomDecalSize", SDK::Params::InterchangeDecalActorFactoryNode_GetCustomDecalSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalActorFactoryNode, GetCustomSortOrder, "InterchangeDecalActorFactoryNode", "GetCustomSortOrder", SDK::Params::InterchangeDecalActorFactoryNode_GetCustomSortOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalActorFactoryNode, GetObjectClass, "InterchangeDecalActorFactoryNode", "GetObjectClass", SDK::Params::InterchangeDecalActorFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseMaterialFactoryNode, SetCustomIsMaterialImportEnabled, "InterchangeBaseMaterialFactoryNode", "SetCustomIsMaterialImportEnabled", SDK::Params::InterchangeBaseMaterialFactoryNode_SetCustomIsMaterialImportEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseMaterialFactoryNode, GetCustomIsMaterialImportEnabled, "InterchangeBaseMaterialFactoryNode", "GetCustomIsMaterialImportEnabled", SDK::Params::InterchangeBaseMaterialFactoryNode_GetCustomIsMaterialImportEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalMaterialFactoryNode, SetCustomDiffuseTexturePath, "InterchangeDecalMaterialFactoryNode", "SetCustomDiffuseTexturePath", SDK::Params::InterchangeDecalMaterialFactoryNode_SetCustomDiffuseTexturePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalMaterialFactoryNode, SetCustomNormalTexturePath, "InterchangeDecalMaterialFactoryNode", "SetCustomNormalTexturePath", SDK::Params::InterchangeDecalMaterialFactoryNode_SetCustomNormalTexturePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalMaterialFactoryNode, GetCustomDiffuseTexturePath, "InterchangeDecalMaterialFactoryNode", "GetCustomDiffuseTexturePath", SDK::Params::InterchangeDecalMaterialFactoryNode_GetCustomDiffuseTexturePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalMaterialFactoryNode, GetCustomNormalTexturePath, "InterchangeDecalMaterialFactoryNode", "GetCustomNormalTexturePath", SDK::Params::InterchangeDecalMaterialFactoryNode_GetCustomNormalTexturePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalMaterialFactoryNode, GetObjectClass, "InterchangeDecalMaterialFactoryNode", "GetObjectClass", SDK::Params::InterchangeDecalMaterialFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLevelSequenceFactoryNode, AddCustomAnimationTrackUid, "InterchangeLevelSequenceFactoryNode", "AddCustomAnimationTrackUid", SDK::Params::InterchangeLevelSequenceFactoryNode_AddCustomAnimationTrackUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLevelSequenceFactoryNode, RemoveCustomAnimationTrackUid, "InterchangeLevelSequenceFactoryNode", "RemoveCustomAnimationTrackUid", SDK::Params::InterchangeLevelSequenceFactoryNode_RemoveCustomAnimationTrackUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLevelSequenceFactoryNode, SetCustomFrameRate, "InterchangeLevelSequenceFactoryNode", "SetCustomFrameRate", SDK::Params::InterchangeLevelSequenceFactoryNode_SetCustomFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLevelSequenceFactoryNode, GetCustomAnimationTrackUid, "InterchangeLevelSequenceFactoryNode", "GetCustomAnimationTrackUid", SDK::Params::InterchangeLevelSequenceFactoryNode_GetCustomAnimationTrackUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLevelSequenceFactoryNode, GetCustomAnimationTrackUidCount, "InterchangeLevelSequenceFactoryNode", "GetCustomAnimationTrackUidCount", SDK::Params::InterchangeLevelSequenceFactoryNode_GetCustomAnimationTrackUidCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLevelSequenceFactoryNode, GetCustomAnimationTrackUids, "InterchangeLevelSequenceFactoryNode", "GetCustomAnimationTrackUids", SDK::Params::InterchangeLevelSequenceFactoryNode_GetCustomAnimationTrackUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLevelSequenceFactoryNode, GetCustomFrameRate, "InterchangeLevelSequenceFactoryNode", "GetCustomFrameRate", SDK::Params::InterchangeLevelSequenceFactoryNode_GetCustomFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLevelSequenceFactoryNode, GetObjectClass, "InterchangeLevelSequenceFactoryNode", "GetObjectClass", SDK::Params::InterchangeLevelSequenceFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightFactoryNode, SetCustomIntensity, "InterchangeBaseLightFactoryNode", "SetCustomIntensity", SDK::Params::InterchangeBaseLightFactoryNode_SetCustomIntensity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightFactoryNode, SetCustomLightColor, "InterchangeBaseLightFactoryNode", "SetCustomLightColor", SDK::Params::InterchangeBaseLightFactoryNode_SetCustomLightColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightFactoryNode, SetCustomTemperature, "InterchangeBaseLightFactoryNode", "SetCustomTemperature", SDK::Params::InterchangeBaseLightFactoryNode_SetCustomTemperature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightFactoryNode, SetCustomUseTemperature, "InterchangeBaseLightFactoryNode", "SetCustomUseTemperature", SDK::Params::InterchangeBaseLightFactoryNode_SetCustomUseTemperature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightFactoryNode, GetCustomIntensity, "InterchangeBaseLightFactoryNode", "GetCustomIntensity", SDK::Params::InterchangeBaseLightFactoryNode_GetCustomIntensity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightFactoryNode, GetCustomLightColor, "InterchangeBaseLightFactoryNode", "GetCustomLightColor", SDK::Params::InterchangeBaseLightFactoryNode_GetCustomLightColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightFactoryNode, GetCustomTemperature, "InterchangeBaseLightFactoryNode", "GetCustomTemperature", SDK::Params::InterchangeBaseLightFactoryNode_GetCustomTemperature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightFactoryNode, GetCustomUseTemperature, "InterchangeBaseLightFactoryNode", "GetCustomUseTemperature", SDK::Params::InterchangeBaseLightFactoryNode_GetCustomUseTemperature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, SetCustomAttenuationRadius, "InterchangeLightFactoryNode", "SetCustomAttenuationRadius", SDK::Params::InterchangeLightFactoryNode_SetCustomAttenuationRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, SetCustomIESBrightnessScale, "InterchangeLightFactoryNode", "SetCustomIESBrightnessScale", SDK::Params::InterchangeLightFactoryNode_SetCustomIESBrightnessScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, SetCustomIESTexture, "InterchangeLightFactoryNode", "SetCustomIESTexture", SDK::Params::InterchangeLightFactoryNode_SetCustomIESTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, SetCustomIntensityUnits, "InterchangeLightFactoryNode", "SetCustomIntensityUnits", SDK::Params::InterchangeLightFactoryNode_SetCustomIntensityUnits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, SetCustomRotation, "InterchangeLightFactoryNode", "SetCustomRotation", SDK::Params::InterchangeLightFactoryNode_SetCustomRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, SetCustomUseIESBrightness, "InterchangeLightFactoryNode", "SetCustomUseIESBrightness", SDK::Params::InterchangeLightFactoryNode_SetCustomUseIESBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, GetCustomAttenuationRadius, "InterchangeLightFactoryNode", "GetCustomAttenuationRadius", SDK::Params::InterchangeLightFactoryNode_GetCustomAttenuationRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, GetCustomIESBrightnessScale, "InterchangeLightFactoryNode", "GetCustomIESBrightnessScale", SDK::Params::InterchangeLightFactoryNode_GetCustomIESBrightnessScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, GetCustomIESTexture, "InterchangeLightFactoryNode", "GetCustomIESTexture", SDK::Params::InterchangeLightFactoryNode_GetCustomIESTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, GetCustomIntensityUnits, "InterchangeLightFactoryNode", "GetCustomIntensityUnits", SDK::Params::InterchangeLightFactoryNode_GetCustomIntensityUnits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, GetCustomRotation, "InterchangeLightFactoryNode", "GetCustomRotation", SDK::Params::InterchangeLightFactoryNode_GetCustomRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightFactoryNode, GetCustomUseIESBrightness, "InterchangeLightFactoryNode", "GetCustomUseIESBrightness", SDK::Params::InterchangeLightFactoryNode_GetCustomUseIESBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeRectLightFactoryNode, SetCustomSourceHeight, "InterchangeRectLightFactoryNode", "SetCustomSourceHeight", SDK::Params::InterchangeRectLightFactoryNode_SetCustomSourceHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeRectLightFactoryNode, SetCustomSourceWidth, "InterchangeRectLightFactoryNode", "SetCustomSourceWidth", SDK::Params::InterchangeRectLightFactoryNode_SetCustomSourceWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeRectLightFactoryNode, GetCustomSourceHeight, "InterchangeRectLightFactoryNode", "GetCustomSourceHeight", SDK::Params::InterchangeRectLightFactoryNode_GetCustomSourceHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeRectLightFactoryNode, GetCustomSourceWidth, "InterchangeRectLightFactoryNode", "GetCustomSourceWidth", SDK::Params::InterchangeRectLightFactoryNode_GetCustomSourceWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePointLightFactoryNode, SetCustomLightFalloffExponent, "InterchangePointLightFactoryNode", "SetCustomLightFalloffExponent", SDK::Params::InterchangePointLightFactoryNode_SetCustomLightFalloffExponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePointLightFactoryNode, SetCustomUseInverseSquaredFalloff, "InterchangePointLightFactoryNode", "SetCustomUseInverseSquaredFalloff", SDK::Params::InterchangePointLightFactoryNode_SetCustomUseInverseSquaredFalloff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePointLightFactoryNode, GetCustomLightFalloffExponent, "InterchangePointLightFactoryNode", "GetCustomLightFalloffExponent", SDK::Params::InterchangePointLightFactoryNode_GetCustomLightFalloffExponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePointLightFactoryNode, GetCustomUseInverseSquaredFalloff, "InterchangePointLightFactoryNode", "GetCustomUseInverseSquaredFalloff", SDK::Params::InterchangePointLightFactoryNode_GetCustomUseInverseSquaredFalloff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSpotLightFactoryNode, SetCustomInnerConeAngle, "InterchangeSpotLightFactoryNode", "SetCustomInnerConeAngle", SDK::Params::InterchangeSpotLightFactoryNode_SetCustomInnerConeAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSpotLightFactoryNode, SetCustomOuterConeAngle, "InterchangeSpotLightFactoryNode", "SetCustomOuterConeAngle", SDK::Params::InterchangeSpotLightFactoryNode_SetCustomOuterConeAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSpotLightFactoryNode, GetCustomInnerConeAngle, "InterchangeSpotLightFactoryNode", "GetCustomInnerConeAngle", SDK::Params::InterchangeSpotLightFactoryNode_GetCustomInnerConeAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSpotLightFactoryNode, GetCustomOuterConeAngle, "InterchangeSpotLightFactoryNode", "GetCustomOuterConeAngle", SDK::Params::InterchangeSpotLightFactoryNode_GetCustomOuterConeAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicsAssetFactoryNode, InitializePhysicsAssetNode, "InterchangePhysicsAssetFactoryNode", "InitializePhysicsAssetNode", SDK::Params::InterchangePhysicsAssetFactoryNode_InitializePhysicsAssetNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicsAssetFactoryNode, SetCustomSkeletalMeshUid, "InterchangePhysicsAssetFactoryNode", "SetCustomSkeletalMeshUid", SDK::Params::InterchangePhysicsAssetFactoryNode_SetCustomSkeletalMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicsAssetFactoryNode, GetCustomSkeletalMeshUid, "InterchangePhysicsAssetFactoryNode", "GetCustomSkeletalMeshUid", SDK::Params::InterchangePhysicsAssetFactoryNode_GetCustomSkeletalMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicsAssetFactoryNode, GetObjectClass, "InterchangePhysicsAssetFactoryNode", "GetObjectClass", SDK::Params::InterchangePhysicsAssetFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsFactoryNode, AddCustomVariantSetUid, "InterchangeSceneVariantSetsFactoryNode", "AddCustomVariantSetUid", SDK::Params::InterchangeSceneVariantSetsFactoryNode_AddCustomVariantSetUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsFactoryNode, RemoveCustomVariantSetUid, "InterchangeSceneVariantSetsFactoryNode", "RemoveCustomVariantSetUid", SDK::Params::InterchangeSceneVariantSetsFactoryNode_RemoveCustomVariantSetUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsFactoryNode, GetCustomVariantSetUid, "InterchangeSceneVariantSetsFactoryNode", "GetCustomVariantSetUid", SDK::Params::InterchangeSceneVariantSetsFactoryNode_GetCustomVariantSetUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsFactoryNode, GetCustomVariantSetUidCount, "InterchangeSceneVariantSetsFactoryNode", "GetCustomVariantSetUidCount", SDK::Params::InterchangeSceneVariantSetsFactoryNode_GetCustomVariantSetUidCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsFactoryNode, GetCustomVariantSetUids, "InterchangeSceneVariantSetsFactoryNode", "GetCustomVariantSetUids", SDK::Params::InterchangeSceneVariantSetsFactoryNode_GetCustomVariantSetUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsFactoryNode, GetObjectClass, "InterchangeSceneVariantSetsFactoryNode", "GetObjectClass", SDK::Params::InterchangeSceneVariantSetsFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletonFactoryNode, InitializeSkeletonNode, "InterchangeSkeletonFactoryNode", "InitializeSkeletonNode", SDK::Params::InterchangeSkeletonFactoryNode_InitializeSkeletonNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletonFactoryNode, SetCustomRootJointUid, "InterchangeSkeletonFactoryNode", "SetCustomRootJointUid", SDK::Params::InterchangeSkeletonFactoryNode_SetCustomRootJointUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletonFactoryNode, SetCustomSkeletalMeshFactoryNodeUid, "InterchangeSkeletonFactoryNode", "SetCustomSkeletalMeshFactoryNodeUid", SDK::Params::InterchangeSkeletonFactoryNode_SetCustomSkeletalMeshFactoryNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletonFactoryNode, SetCustomUseTimeZeroForBindPose, "InterchangeSkeletonFactoryNode", "SetCustomUseTimeZeroForBindPose", SDK::Params::InterchangeSkeletonFactoryNode_SetCustomUseTimeZeroForBindPose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletonFactoryNode, GetCustomRootJointUid, "InterchangeSkeletonFactoryNode", "GetCustomRootJointUid", SDK::Params::InterchangeSkeletonFactoryNode_GetCustomRootJointUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletonFactoryNode, GetCustomSkeletalMeshFactoryNodeUid, "InterchangeSkeletonFactoryNode", "GetCustomSkeletalMeshFactoryNodeUid", SDK::Params::InterchangeSkeletonFactoryNode_GetCustomSkeletalMeshFactoryNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletonFactoryNode, GetCustomUseTimeZeroForBindPose, "InterchangeSkeletonFactoryNode", "GetCustomUseTimeZeroForBindPose", SDK::Params::InterchangeSkeletonFactoryNode_GetCustomUseTimeZeroForBindPose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletonFactoryNode, GetObjectClass, "InterchangeSkeletonFactoryNode", "GetObjectClass", SDK::Params::InterchangeSkeletonFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, InitializeTextureNode, "InterchangeTextureFactoryNode", "InitializeTextureNode", SDK::Params::InterchangeTextureFactoryNode_InitializeTextureNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAdjustBrightness, "InterchangeTextureFactoryNode", "SetCustomAdjustBrightness", SDK::Params::InterchangeTextureFactoryNode_SetCustomAdjustBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAdjustBrightnessCurve, "InterchangeTextureFactoryNode", "SetCustomAdjustBrightnessCurve", SDK::Params::InterchangeTextureFactoryNode_SetCustomAdjustBrightnessCurve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAdjustHue, "InterchangeTextureFactoryNode", "SetCustomAdjustHue", SDK::Params::InterchangeTextureFactoryNode_SetCustomAdjustHue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAdjustMaxAlpha, "InterchangeTextureFactoryNode", "SetCustomAdjustMaxAlpha", SDK::Params::InterchangeTextureFactoryNode_SetCustomAdjustMaxAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAdjustMinAlpha, "InterchangeTextureFactoryNode", "SetCustomAdjustMinAlpha", SDK::Params::InterchangeTextureFactoryNode_SetCustomAdjustMinAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAdjustRGBCurve, "InterchangeTextureFactoryNode", "SetCustomAdjustRGBCurve", SDK::Params::InterchangeTextureFactoryNode_SetCustomAdjustRGBCurve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAdjustSaturation, "InterchangeTextureFactoryNode", "SetCustomAdjustSaturation", SDK::Params::InterchangeTextureFactoryNode_SetCustomAdjustSaturation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAdjustVibrance, "InterchangeTextureFactoryNode", "SetCustomAdjustVibrance", SDK::Params::InterchangeTextureFactoryNode_SetCustomAdjustVibrance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAllowNonPowerOfTwo, "InterchangeTextureFactoryNode", "SetCustomAllowNonPowerOfTwo", SDK::Params::InterchangeTextureFactoryNode_SetCustomAllowNonPowerOfTwo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomAlphaCoverageThresholds, "InterchangeTextureFactoryNode", "SetCustomAlphaCoverageThresholds", SDK::Params::InterchangeTextureFactoryNode_SetCustomAlphaCoverageThresholds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustombChromaKeyTexture, "InterchangeTextureFactoryNode", "SetCustombChromaKeyTexture", SDK::Params::InterchangeTextureFactoryNode_SetCustombChromaKeyTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustombDoScaleMipsForAlphaCoverage, "InterchangeTextureFactoryNode", "SetCustombDoScaleMipsForAlphaCoverage", SDK::Params::InterchangeTextureFactoryNode_SetCustombDoScaleMipsForAlphaCoverage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustombFlipGreenChannel, "InterchangeTextureFactoryNode", "SetCustombFlipGreenChannel", SDK::Params::InterchangeTextureFactoryNode_SetCustombFlipGreenChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustombPreserveBorder, "InterchangeTextureFactoryNode", "SetCustombPreserveBorder", SDK::Params::InterchangeTextureFactoryNode_SetCustombPreserveBorder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustombUseLegacyGamma, "InterchangeTextureFactoryNode", "SetCustombUseLegacyGamma", SDK::Params::InterchangeTextureFactoryNode_SetCustombUseLegacyGamma)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomChromaKeyColor, "InterchangeTextureFactoryNode", "SetCustomChromaKeyColor", SDK::Params::InterchangeTextureFactoryNode_SetCustomChromaKeyColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomChromaKeyThreshold, "InterchangeTextureFactoryNode", "SetCustomChromaKeyThreshold", SDK::Params::InterchangeTextureFactoryNode_SetCustomChromaKeyThreshold)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomCompositePower, "InterchangeTextureFactoryNode", "SetCustomCompositePower", SDK::Params::InterchangeTextureFactoryNode_SetCustomCompositePower)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomCompositeTextureMode, "InterchangeTextureFactoryNode", "SetCustomCompositeTextureMode", SDK::Params::InterchangeTextureFactoryNode_SetCustomCompositeTextureMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomCompressionNoAlpha, "InterchangeTextureFactoryNode", "SetCustomCompressionNoAlpha", SDK::Params::InterchangeTextureFactoryNode_SetCustomCompressionNoAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomCompressionQuality, "InterchangeTextureFactoryNode", "SetCustomCompressionQuality", SDK::Params::InterchangeTextureFactoryNode_SetCustomCompressionQuality)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomCompressionSettings, "InterchangeTextureFactoryNode", "SetCustomCompressionSettings", SDK::Params::InterchangeTextureFactoryNode_SetCustomCompressionSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomDeferCompression, "InterchangeTextureFactoryNode", "SetCustomDeferCompression", SDK::Params::InterchangeTextureFactoryNode_SetCustomDeferCompression)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomDownscale, "InterchangeTextureFactoryNode", "SetCustomDownscale", SDK::Params::InterchangeTextureFactoryNode_SetCustomDownscale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomDownscaleOptions, "InterchangeTextureFactoryNode", "SetCustomDownscaleOptions", SDK::Params::InterchangeTextureFactoryNode_SetCustomDownscaleOptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomFilter, "InterchangeTextureFactoryNode", "SetCustomFilter", SDK::Params::InterchangeTextureFactoryNode_SetCustomFilter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomLODBias, "InterchangeTextureFactoryNode", "SetCustomLODBias", SDK::Params::InterchangeTextureFactoryNode_SetCustomLODBias)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomLODGroup, "InterchangeTextureFactoryNode", "SetCustomLODGroup", SDK::Params::InterchangeTextureFactoryNode_SetCustomLODGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomLossyCompressionAmount, "InterchangeTextureFactoryNode", "SetCustomLossyCompressionAmount", SDK::Params::InterchangeTextureFactoryNode_SetCustomLossyCompressionAmount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomMaxTextureSize, "InterchangeTextureFactoryNode", "SetCustomMaxTextureSize", SDK::Params::InterchangeTextureFactoryNode_SetCustomMaxTextureSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomMipGenSettings, "InterchangeTextureFactoryNode", "SetCustomMipGenSettings", SDK::Params::InterchangeTextureFactoryNode_SetCustomMipGenSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomMipLoadOptions, "InterchangeTextureFactoryNode", "SetCustomMipLoadOptions", SDK::Params::InterchangeTextureFactoryNode_SetCustomMipLoadOptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomPaddingColor, "InterchangeTextureFactoryNode", "SetCustomPaddingColor", SDK::Params::InterchangeTextureFactoryNode_SetCustomPaddingColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomPowerOfTwoMode, "InterchangeTextureFactoryNode", "SetCustomPowerOfTwoMode", SDK::Params::InterchangeTextureFactoryNode_SetCustomPowerOfTwoMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomPreferCompressedSourceData, "InterchangeTextureFactoryNode", "SetCustomPreferCompressedSourceData", SDK::Params::InterchangeTextureFactoryNode_SetCustomPreferCompressedSourceData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomSRGB, "InterchangeTextureFactoryNode", "SetCustomSRGB", SDK::Params::InterchangeTextureFactoryNode_SetCustomSRGB)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomTranslatedTextureNodeUid, "InterchangeTextureFactoryNode", "SetCustomTranslatedTextureNodeUid", SDK::Params::InterchangeTextureFactoryNode_SetCustomTranslatedTextureNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, SetCustomVirtualTextureStreaming, "InterchangeTextureFactoryNode", "SetCustomVirtualTextureStreaming", SDK::Params::InterchangeTextureFactoryNode_SetCustomVirtualTextureStreaming)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAdjustBrightness, "InterchangeTextureFactoryNode", "GetCustomAdjustBrightness", SDK::Params::InterchangeTextureFactoryNode_GetCustomAdjustBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAdjustBrightnessCurve, "InterchangeTextureFactoryNode", "GetCustomAdjustBrightnessCurve", SDK::Params::InterchangeTextureFactoryNode_GetCustomAdjustBrightnessCurve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAdjustHue, "InterchangeTextureFactoryNode", "GetCustomAdjustHue", SDK::Params::InterchangeTextureFactoryNode_GetCustomAdjustHue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAdjustMaxAlpha, "InterchangeTextureFactoryNode", "GetCustomAdjustMaxAlpha", SDK::Params::InterchangeTextureFactoryNode_GetCustomAdjustMaxAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAdjustMinAlpha, "InterchangeTextureFactoryNode", "GetCustomAdjustMinAlpha", SDK::Params::InterchangeTextureFactoryNode_GetCustomAdjustMinAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAdjustRGBCurve, "InterchangeTextureFactoryNode", "GetCustomAdjustRGBCurve", SDK::Params::InterchangeTextureFactoryNode_GetCustomAdjustRGBCurve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAdjustSaturation, "InterchangeTextureFactoryNode", "GetCustomAdjustSaturation", SDK::Params::InterchangeTextureFactoryNode_GetCustomAdjustSaturation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAdjustVibrance, "InterchangeTextureFactoryNode", "GetCustomAdjustVibrance", SDK::Params::InterchangeTextureFactoryNode_GetCustomAdjustVibrance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAllowNonPowerOfTwo, "InterchangeTextureFactoryNode", "GetCustomAllowNonPowerOfTwo", SDK::Params::InterchangeTextureFactoryNode_GetCustomAllowNonPowerOfTwo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomAlphaCoverageThresholds, "InterchangeTextureFactoryNode", "GetCustomAlphaCoverageThresholds", SDK::Params::InterchangeTextureFactoryNode_GetCustomAlphaCoverageThresholds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustombChromaKeyTexture, "InterchangeTextureFactoryNode", "GetCustombChromaKeyTexture", SDK::Params::InterchangeTextureFactoryNode_GetCustombChromaKeyTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustombDoScaleMipsForAlphaCoverage, "InterchangeTextureFactoryNode", "GetCustombDoScaleMipsForAlphaCoverage", SDK::Params::InterchangeTextureFactoryNode_GetCustombDoScaleMipsForAlphaCoverage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustombFlipGreenChannel, "InterchangeTextureFactoryNode", "GetCustombFlipGreenChannel", SDK::Params::InterchangeTextureFactoryNode_GetCustombFlipGreenChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustombPreserveBorder, "InterchangeTextureFactoryNode", "GetCustombPreserveBorder", SDK::Params::InterchangeTextureFactoryNode_GetCustombPreserveBorder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustombUseLegacyGamma, "InterchangeTextureFactoryNode", "GetCustombUseLegacyGamma", SDK::Params::InterchangeTextureFactoryNode_GetCustombUseLegacyGamma)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomChromaKeyColor, "InterchangeTextureFactoryNode", "GetCustomChromaKeyColor", SDK::Params::InterchangeTextureFactoryNode_GetCustomChromaKeyColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomChromaKeyThreshold, "InterchangeTextureFactoryNode", "GetCustomChromaKeyThreshold", SDK::Params::InterchangeTextureFactoryNode_GetCustomChromaKeyThreshold)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomCompositePower, "InterchangeTextureFactoryNode", "GetCustomCompositePower", SDK::Params::InterchangeTextureFactoryNode_GetCustomCompositePower)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomCompositeTextureMode, "InterchangeTextureFactoryNode", "GetCustomCompositeTextureMode", SDK::Params::InterchangeTextureFactoryNode_GetCustomCompositeTextureMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomCompressionNoAlpha, "InterchangeTextureFactoryNode", "GetCustomCompressionNoAlpha", SDK::Params::InterchangeTextureFactoryNode_GetCustomCompressionNoAlpha)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomCompressionQuality, "InterchangeTextureFactoryNode", "GetCustomCompressionQuality", SDK::Params::InterchangeTextureFactoryNode_GetCustomCompressionQuality)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomCompressionSettings, "InterchangeTextureFactoryNode", "GetCustomCompressionSettings", SDK::Params::InterchangeTextureFactoryNode_GetCustomCompressionSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomDeferCompression, "InterchangeTextureFactoryNode", "GetCustomDeferCompression", SDK::Params::InterchangeTextureFactoryNode_GetCustomDeferCompression)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomDownscale, "InterchangeTextureFactoryNode", "GetCustomDownscale", SDK::Params::InterchangeTextureFactoryNode_GetCustomDownscale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomDownscaleOptions, "InterchangeTextureFactoryNode", "GetCustomDownscaleOptions", SDK::Params::InterchangeTextureFactoryNode_GetCustomDownscaleOptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomFilter, "InterchangeTextureFactoryNode", "GetCustomFilter", SDK::Params::InterchangeTextureFactoryNode_GetCustomFilter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomLODBias, "InterchangeTextureFactoryNode", "GetCustomLODBias", SDK::Params::InterchangeTextureFactoryNode_GetCustomLODBias)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomLODGroup, "InterchangeTextureFactoryNode", "GetCustomLODGroup", SDK::Params::InterchangeTextureFactoryNode_GetCustomLODGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomLossyCompressionAmount, "InterchangeTextureFactoryNode", "GetCustomLossyCompressionAmount", SDK::Params::InterchangeTextureFactoryNode_GetCustomLossyCompressionAmount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomMaxTextureSize, "InterchangeTextureFactoryNode", "GetCustomMaxTextureSize", SDK::Params::InterchangeTextureFactoryNode_GetCustomMaxTextureSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomMipGenSettings, "InterchangeTextureFactoryNode", "GetCustomMipGenSettings", SDK::Params::InterchangeTextureFactoryNode_GetCustomMipGenSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomMipLoadOptions, "InterchangeTextureFactoryNode", "GetCustomMipLoadOptions", SDK::Params::InterchangeTextureFactoryNode_GetCustomMipLoadOptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomPaddingColor, "InterchangeTextureFactoryNode", "GetCustomPaddingColor", SDK::Params::InterchangeTextureFactoryNode_GetCustomPaddingColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomPowerOfTwoMode, "InterchangeTextureFactoryNode", "GetCustomPowerOfTwoMode", SDK::Params::InterchangeTextureFactoryNode_GetCustomPowerOfTwoMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomPreferCompressedSourceData, "InterchangeTextureFactoryNode", "GetCustomPreferCompressedSourceData", SDK::Params::InterchangeTextureFactoryNode_GetCustomPreferCompressedSourceData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomSRGB, "InterchangeTextureFactoryNode", "GetCustomSRGB", SDK::Params::InterchangeTextureFactoryNode_GetCustomSRGB)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomTranslatedTextureNodeUid, "InterchangeTextureFactoryNode", "GetCustomTranslatedTextureNodeUid", SDK::Params::InterchangeTextureFactoryNode_GetCustomTranslatedTextureNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetCustomVirtualTextureStreaming, "InterchangeTextureFactoryNode", "GetCustomVirtualTextureStreaming", SDK::Params::InterchangeTextureFactoryNode_GetCustomVirtualTextureStreaming)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureFactoryNode, GetObjectClass, "InterchangeTextureFactoryNode", "GetObjectClass", SDK::Params::InterchangeTextureFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DArrayFactoryNode, SetCustomAddressZ, "InterchangeTexture2DArrayFactoryNode", "SetCustomAddressZ", SDK::Params::InterchangeTexture2DArrayFactoryNode_SetCustomAddressZ)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DArrayFactoryNode, GetCustomAddressX, "InterchangeTexture2DArrayFactoryNode", "GetCustomAddressX", SDK::Params::InterchangeTexture2DArrayFactoryNode_GetCustomAddressX)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DArrayFactoryNode, GetCustomAddressY, "InterchangeTexture2DArrayFactoryNode", "GetCustomAddressY", SDK::Params::InterchangeTexture2DArrayFactoryNode_GetCustomAddressY)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DArrayFactoryNode, GetCustomAddressZ, "InterchangeTexture2DArrayFactoryNode", "GetCustomAddressZ", SDK::Params::InterchangeTexture2DArrayFactoryNode_GetCustomAddressZ)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, SetCustomAddressX, "InterchangeTexture2DFactoryNode", "SetCustomAddressX", SDK::Params::InterchangeTexture2DFactoryNode_SetCustomAddressX)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, SetCustomAddressY, "InterchangeTexture2DFactoryNode", "SetCustomAddressY", SDK::Params::InterchangeTexture2DFactoryNode_SetCustomAddressY)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, SetSourceBlock, "InterchangeTexture2DFactoryNode", "SetSourceBlock", SDK::Params::InterchangeTexture2DFactoryNode_SetSourceBlock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, SetSourceBlockByCoordinates, "InterchangeTexture2DFactoryNode", "SetSourceBlockByCoordinates", SDK::Params::InterchangeTexture2DFactoryNode_SetSourceBlockByCoordinates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, SetSourceBlocks, "InterchangeTexture2DFactoryNode", "SetSourceBlocks", SDK::Params::InterchangeTexture2DFactoryNode_SetSourceBlocks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, GetCustomAddressX, "InterchangeTexture2DFactoryNode", "GetCustomAddressX", SDK::Params::InterchangeTexture2DFactoryNode_GetCustomAddressX)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, GetCustomAddressY, "InterchangeTexture2DFactoryNode", "GetCustomAddressY", SDK::Params::InterchangeTexture2DFactoryNode_GetCustomAddressY)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, GetSourceBlock, "InterchangeTexture2DFactoryNode", "GetSourceBlock", SDK::Params::InterchangeTexture2DFactoryNode_GetSourceBlock)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, GetSourceBlockByCoordinates, "InterchangeTexture2DFactoryNode", "GetSourceBlockByCoordinates", SDK::Params::InterchangeTexture2DFactoryNode_GetSourceBlockByCoordinates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DFactoryNode, GetSourceBlocks, "InterchangeTexture2DFactoryNode", "GetSourceBlocks", SDK::Params::InterchangeTexture2DFactoryNode_GetSourceBlocks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureLightProfileFactoryNode, SetCustomBrightness, "InterchangeTextureLightProfileFactoryNode", "SetCustomBrightness", SDK::Params::InterchangeTextureLightProfileFactoryNode_SetCustomBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureLightProfileFactoryNode, SetCustomTextureMultiplier, "InterchangeTextureLightProfileFactoryNode", "SetCustomTextureMultiplier", SDK::Params::InterchangeTextureLightProfileFactoryNode_SetCustomTextureMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureLightProfileFactoryNode, GetCustomBrightness, "InterchangeTextureLightProfileFactoryNode", "GetCustomBrightness", SDK::Params::InterchangeTextureLightProfileFactoryNode_GetCustomBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureLightProfileFactoryNode, GetCustomTextureMultiplier, "InterchangeTextureLightProfileFactoryNode", "GetCustomTextureMultiplier", SDK::Params::InterchangeTextureLightProfileFactoryNode_GetCustomTextureMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, InitializeAnimSequenceNode, "InterchangeAnimSequenceFactoryNode", "InitializeAnimSequenceNode", SDK::Params::InterchangeAnimSequenceFactoryNode_InitializeAnimSequenceNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, RemoveAnimatedAttributeCurveName, "InterchangeAnimSequenceFactoryNode", "RemoveAnimatedAttributeCurveName", SDK::Params::InterchangeAnimSequenceFactoryNode_RemoveAnimatedAttributeCurveName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, RemoveAnimatedAttributeStepCurveName, "InterchangeAnimSequenceFactoryNode", "RemoveAnimatedAttributeStepCurveName", SDK::Params::InterchangeAnimSequenceFactoryNode_RemoveAnimatedAttributeStepCurveName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, RemoveAnimatedMaterialCurveSuffixe, "InterchangeAnimSequenceFactoryNode", "RemoveAnimatedMaterialCurveSuffixe", SDK::Params::InterchangeAnimSequenceFactoryNode_RemoveAnimatedMaterialCurveSuffixe)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetAnimatedAttributeCurveName, "InterchangeAnimSequenceFactoryNode", "SetAnimatedAttributeCurveName", SDK::Params::InterchangeAnimSequenceFactoryNode_SetAnimatedAttributeCurveName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetAnimatedAttributeStepCurveName, "InterchangeAnimSequenceFactoryNode", "SetAnimatedAttributeStepCurveName", SDK::Params::InterchangeAnimSequenceFactoryNode_SetAnimatedAttributeStepCurveName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetAnimatedMaterialCurveSuffixe, "InterchangeAnimSequenceFactoryNode", "SetAnimatedMaterialCurveSuffixe", SDK::Params::InterchangeAnimSequenceFactoryNode_SetAnimatedMaterialCurveSuffixe)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetAnimationPayloadKeysForMorphTargetNodeUids, "InterchangeAnimSequenceFactoryNode", "SetAnimationPayloadKeysForMorphTargetNodeUids", SDK::Params::InterchangeAnimSequenceFactoryNode_SetAnimationPayloadKeysForMorphTargetNodeUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetAnimationPayloadKeysForSceneNodeUids, "InterchangeAnimSequenceFactoryNode", "SetAnimationPayloadKeysForSceneNodeUids", SDK::Params::InterchangeAnimSequenceFactoryNode_SetAnimationPayloadKeysForSceneNodeUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomAddCurveMetadataToSkeleton, "InterchangeAnimSequenceFactoryNode", "SetCustomAddCurveMetadataToSkeleton", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomAddCurveMetadataToSkeleton)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomDeleteExistingCustomAttributeCurves, "InterchangeAnimSequenceFactoryNode", "SetCustomDeleteExistingCustomAttributeCurves", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomDeleteExistingCustomAttributeCurves)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomDeleteExistingMorphTargetCurves, "InterchangeAnimSequenceFactoryNode", "SetCustomDeleteExistingMorphTargetCurves", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomDeleteExistingMorphTargetCurves)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomDeleteExistingNonCurveCustomAttributes, "InterchangeAnimSequenceFactoryNode", "SetCustomDeleteExistingNonCurveCustomAttributes", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomDeleteExistingNonCurveCustomAttributes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomDoNotImportCurveWithZero, "InterchangeAnimSequenceFactoryNode", "SetCustomDoNotImportCurveWithZero", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomDoNotImportCurveWithZero)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomImportAttributeCurves, "InterchangeAnimSequenceFactoryNode", "SetCustomImportAttributeCurves", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomImportAttributeCurves)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomImportBoneTracks, "InterchangeAnimSequenceFactoryNode", "SetCustomImportBoneTracks", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomImportBoneTracks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomImportBoneTracksRangeStart, "InterchangeAnimSequenceFactoryNode", "SetCustomImportBoneTracksRangeStart", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomImportBoneTracksRangeStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomImportBoneTracksRangeStop, "InterchangeAnimSequenceFactoryNode", "SetCustomImportBoneTracksRangeStop", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomImportBoneTracksRangeStop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomImportBoneTracksSampleRate, "InterchangeAnimSequenceFactoryNode", "SetCustomImportBoneTracksSampleRate", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomImportBoneTracksSampleRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomMaterialDriveParameterOnCustomAttribute, "InterchangeAnimSequenceFactoryNode", "SetCustomMaterialDriveParameterOnCustomAttribute", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomMaterialDriveParameterOnCustomAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomRemoveCurveRedundantKeys, "InterchangeAnimSequenceFactoryNode", "SetCustomRemoveCurveRedundantKeys", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomRemoveCurveRedundantKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomSkeletonFactoryNodeUid, "InterchangeAnimSequenceFactoryNode", "SetCustomSkeletonFactoryNodeUid", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomSkeletonFactoryNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, SetCustomSkeletonSoftObjectPath, "InterchangeAnimSequenceFactoryNode", "SetCustomSkeletonSoftObjectPath", SDK::Params::InterchangeAnimSequenceFactoryNode_SetCustomSkeletonSoftObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedAttributeCurveName, "InterchangeAnimSequenceFactoryNode", "GetAnimatedAttributeCurveName", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedAttributeCurveName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedAttributeCurveNames, "InterchangeAnimSequenceFactoryNode", "GetAnimatedAttributeCurveNames", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedAttributeCurveNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedAttributeCurveNamesCount, "InterchangeAnimSequenceFactoryNode", "GetAnimatedAttributeCurveNamesCount", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedAttributeCurveNamesCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedAttributeStepCurveName, "InterchangeAnimSequenceFactoryNode", "GetAnimatedAttributeStepCurveName", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedAttributeStepCurveName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedAttributeStepCurveNames, "InterchangeAnimSequenceFactoryNode", "GetAnimatedAttributeStepCurveNames", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedAttributeStepCurveNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedAttributeStepCurveNamesCount, "InterchangeAnimSequenceFactoryNode", "GetAnimatedAttributeStepCurveNamesCount", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedAttributeStepCurveNamesCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedMaterialCurveSuffixe, "InterchangeAnimSequenceFactoryNode", "GetAnimatedMaterialCurveSuffixe", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedMaterialCurveSuffixe)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedMaterialCurveSuffixes, "InterchangeAnimSequenceFactoryNode", "GetAnimatedMaterialCurveSuffixes", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedMaterialCurveSuffixes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetAnimatedMaterialCurveSuffixesCount, "InterchangeAnimSequenceFactoryNode", "GetAnimatedMaterialCurveSuffixesCount", SDK::Params::InterchangeAnimSequenceFactoryNode_GetAnimatedMaterialCurveSuffixesCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomAddCurveMetadataToSkeleton, "InterchangeAnimSequenceFactoryNode", "GetCustomAddCurveMetadataToSkeleton", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomAddCurveMetadataToSkeleton)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomDeleteExistingCustomAttributeCurves, "InterchangeAnimSequenceFactoryNode", "GetCustomDeleteExistingCustomAttributeCurves", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomDeleteExistingCustomAttributeCurves)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomDeleteExistingMorphTargetCurves, "InterchangeAnimSequenceFactoryNode", "GetCustomDeleteExistingMorphTargetCurves", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomDeleteExistingMorphTargetCurves)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomDeleteExistingNonCurveCustomAttributes, "InterchangeAnimSequenceFactoryNode", "GetCustomDeleteExistingNonCurveCustomAttributes", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomDeleteExistingNonCurveCustomAttributes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomDoNotImportCurveWithZero, "InterchangeAnimSequenceFactoryNode", "GetCustomDoNotImportCurveWithZero", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomDoNotImportCurveWithZero)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomImportAttributeCurves, "InterchangeAnimSequenceFactoryNode", "GetCustomImportAttributeCurves", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomImportAttributeCurves)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomImportBoneTracks, "InterchangeAnimSequenceFactoryNode", "GetCustomImportBoneTracks", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomImportBoneTracks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomImportBoneTracksRangeStart, "InterchangeAnimSequenceFactoryNode", "GetCustomImportBoneTracksRangeStart", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomImportBoneTracksRangeStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomImportBoneTracksRangeStop, "InterchangeAnimSequenceFactoryNode", "GetCustomImportBoneTracksRangeStop", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomImportBoneTracksRangeStop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomImportBoneTracksSampleRate, "InterchangeAnimSequenceFactoryNode", "GetCustomImportBoneTracksSampleRate", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomImportBoneTracksSampleRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomMaterialDriveParameterOnCustomAttribute, "InterchangeAnimSequenceFactoryNode", "GetCustomMaterialDriveParameterOnCustomAttribute", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomMaterialDriveParameterOnCustomAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomRemoveCurveRedundantKeys, "InterchangeAnimSequenceFactoryNode", "GetCustomRemoveCurveRedundantKeys", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomRemoveCurveRedundantKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomSkeletonFactoryNodeUid, "InterchangeAnimSequenceFactoryNode", "GetCustomSkeletonFactoryNodeUid", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomSkeletonFactoryNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetCustomSkeletonSoftObjectPath, "InterchangeAnimSequenceFactoryNode", "GetCustomSkeletonSoftObjectPath", SDK::Params::InterchangeAnimSequenceFactoryNode_GetCustomSkeletonSoftObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetMorphTargetNodeAnimationPayloadKeys, "InterchangeAnimSequenceFactoryNode", "GetMorphTargetNodeAnimationPayloadKeys", SDK::Params::InterchangeAnimSequenceFactoryNode_GetMorphTargetNodeAnimationPayloadKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetObjectClass, "InterchangeAnimSequenceFactoryNode", "GetObjectClass", SDK::Params::InterchangeAnimSequenceFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimSequenceFactoryNode, GetSceneNodeAnimationPayloadKeys, "InterchangeAnimSequenceFactoryNode", "GetSceneNodeAnimationPayloadKeys", SDK::Params::InterchangeAnimSequenceFactoryNode_GetSceneNodeAnimationPayloadKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeCommonPipelineDataFactoryNode, SetBakeMeshes, "InterchangeCommonPipelineDataFactoryNode", "SetBakeMeshes", SDK::Params::InterchangeCommonPipelineDataFactoryNode_SetBakeMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeCommonPipelineDataFactoryNode, SetCustomGlobalOffsetTransform, "InterchangeCommonPipelineDataFactoryNode", "SetCustomGlobalOffsetTransform", SDK::Params::InterchangeCommonPipelineDataFactoryNode_SetCustomGlobalOffsetTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeCommonPipelineDataFactoryNode, GetBakeMeshes, "InterchangeCommonPipelineDataFactoryNode", "GetBakeMeshes", SDK::Params::InterchangeCommonPipelineDataFactoryNode_GetBakeMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeCommonPipelineDataFactoryNode, GetCustomGlobalOffsetTransform, "InterchangeCommonPipelineDataFactoryNode", "GetCustomGlobalOffsetTransform", SDK::Params::InterchangeCommonPipelineDataFactoryNode_GetCustomGlobalOffsetTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToAnisotropy, "InterchangeMaterialFactoryNode", "ConnectOutputToAnisotropy", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToAnisotropy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToBaseColor, "InterchangeMaterialFactoryNode", "ConnectOutputToBaseColor", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToBaseColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToClearCoat, "InterchangeMaterialFactoryNode", "ConnectOutputToClearCoat", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToClearCoat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToClearCoatNormal, "InterchangeMaterialFactoryNode", "ConnectOutputToClearCoatNormal", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToClearCoatNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToClearCoatRoughness, "InterchangeMaterialFactoryNode", "ConnectOutputToClearCoatRoughness", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToClearCoatRoughness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToCloth, "InterchangeMaterialFactoryNode", "ConnectOutputToCloth", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToCloth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToEmissiveColor, "InterchangeMaterialFactoryNode", "ConnectOutputToEmissiveColor", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToEmissiveColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToFuzzColor, "InterchangeMaterialFactoryNode", "ConnectOutputToFuzzColor", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToFuzzColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToMetallic, "InterchangeMaterialFactoryNode", "ConnectOutputToMetallic", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToMetallic)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToNormal, "InterchangeMaterialFactoryNode", "ConnectOutputToNormal", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToOcclusion, "InterchangeMaterialFactoryNode", "ConnectOutputToOcclusion", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToOcclusion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToOpacity, "InterchangeMaterialFactoryNode", "ConnectOutputToOpacity", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToRefraction, "InterchangeMaterialFactoryNode", "ConnectOutputToRefraction", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToRefraction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToRoughness, "InterchangeMaterialFactoryNode", "ConnectOutputToRoughness", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToRoughness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToSpecular, "InterchangeMaterialFactoryNode", "ConnectOutputToSpecular", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToSpecular)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToSubsurface, "InterchangeMaterialFactoryNode", "ConnectOutputToSubsurface", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToSubsurface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToTangent, "InterchangeMaterialFactoryNode", "ConnectOutputToTangent", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectOutputToTransmissionColor, "InterchangeMaterialFactoryNode", "ConnectOutputToTransmissionColor", SDK::Params::InterchangeMaterialFactoryNode_ConnectOutputToTransmissionColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToAnisotropy, "InterchangeMaterialFactoryNode", "ConnectToAnisotropy", SDK::Params::InterchangeMaterialFactoryNode_ConnectToAnisotropy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToBaseColor, "InterchangeMaterialFactoryNode", "ConnectToBaseColor", SDK::Params::InterchangeMaterialFactoryNode_ConnectToBaseColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToClearCoat, "InterchangeMaterialFactoryNode", "ConnectToClearCoat", SDK::Params::InterchangeMaterialFactoryNode_ConnectToClearCoat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToClearCoatNormal, "InterchangeMaterialFactoryNode", "ConnectToClearCoatNormal", SDK::Params::InterchangeMaterialFactoryNode_ConnectToClearCoatNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToClearCoatRoughness, "InterchangeMaterialFactoryNode", "ConnectToClearCoatRoughness", SDK::Params::InterchangeMaterialFactoryNode_ConnectToClearCoatRoughness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToCloth, "InterchangeMaterialFactoryNode", "ConnectToCloth", SDK::Params::InterchangeMaterialFactoryNode_ConnectToCloth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToEmissiveColor, "InterchangeMaterialFactoryNode", "ConnectToEmissiveColor", SDK::Params::InterchangeMaterialFactoryNode_ConnectToEmissiveColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToFuzzColor, "InterchangeMaterialFactoryNode", "ConnectToFuzzColor", SDK::Params::InterchangeMaterialFactoryNode_ConnectToFuzzColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToMetallic, "InterchangeMaterialFactoryNode", "ConnectToMetallic", SDK::Params::InterchangeMaterialFactoryNode_ConnectToMetallic)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToNormal, "InterchangeMaterialFactoryNode", "ConnectToNormal", SDK::Params::InterchangeMaterialFactoryNode_ConnectToNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToOcclusion, "InterchangeMaterialFactoryNode", "ConnectToOcclusion", SDK::Params::InterchangeMaterialFactoryNode_ConnectToOcclusion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToOpacity, "InterchangeMaterialFactoryNode", "ConnectToOpacity", SDK::Params::InterchangeMaterialFactoryNode_ConnectToOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToRefraction, "InterchangeMaterialFactoryNode", "ConnectToRefraction", SDK::Params::InterchangeMaterialFactoryNode_ConnectToRefraction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToRoughness, "InterchangeMaterialFactoryNode", "ConnectToRoughness", SDK::Params::InterchangeMaterialFactoryNode_ConnectToRoughness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToSpecular, "InterchangeMaterialFactoryNode", "ConnectToSpecular", SDK::Params::InterchangeMaterialFactoryNode_ConnectToSpecular)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToSubsurface, "InterchangeMaterialFactoryNode", "ConnectToSubsurface", SDK::Params::InterchangeMaterialFactoryNode_ConnectToSubsurface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToTangent, "InterchangeMaterialFactoryNode", "ConnectToTangent", SDK::Params::InterchangeMaterialFactoryNode_ConnectToTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, ConnectToTransmissionColor, "InterchangeMaterialFactoryNode", "ConnectToTransmissionColor", SDK::Params::InterchangeMaterialFactoryNode_ConnectToTransmissionColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, SetCustomBlendMode, "InterchangeMaterialFactoryNode", "SetCustomBlendMode", SDK::Params::InterchangeMaterialFactoryNode_SetCustomBlendMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, SetCustomOpacityMaskClipValue, "InterchangeMaterialFactoryNode", "SetCustomOpacityMaskClipValue", SDK::Params::InterchangeMaterialFactoryNode_SetCustomOpacityMaskClipValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, SetCustomRefractionMethod, "InterchangeMaterialFactoryNode", "SetCustomRefractionMethod", SDK::Params::InterchangeMaterialFactoryNode_SetCustomRefractionMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, SetCustomScreenSpaceReflections, "InterchangeMaterialFactoryNode", "SetCustomScreenSpaceReflections", SDK::Params::InterchangeMaterialFactoryNode_SetCustomScreenSpaceReflections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, SetCustomShadingModel, "InterchangeMaterialFactoryNode", "SetCustomShadingModel", SDK::Params::InterchangeMaterialFactoryNode_SetCustomShadingModel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, SetCustomTranslucencyLightingMode, "InterchangeMaterialFactoryNode", "SetCustomTranslucencyLightingMode", SDK::Params::InterchangeMaterialFactoryNode_SetCustomTranslucencyLightingMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, SetCustomTwoSided, "InterchangeMaterialFactoryNode", "SetCustomTwoSided", SDK::Params::InterchangeMaterialFactoryNode_SetCustomTwoSided)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetAnisotropyConnection, "InterchangeMaterialFactoryNode", "GetAnisotropyConnection", SDK::Params::InterchangeMaterialFactoryNode_GetAnisotropyConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetBaseColorConnection, "InterchangeMaterialFactoryNode", "GetBaseColorConnection", SDK::Params::InterchangeMaterialFactoryNode_GetBaseColorConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetClearCoatConnection, "InterchangeMaterialFactoryNode", "GetClearCoatConnection", SDK::Params::InterchangeMaterialFactoryNode_GetClearCoatConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetClearCoatNormalConnection, "InterchangeMaterialFactoryNode", "GetClearCoatNormalConnection", SDK::Params::InterchangeMaterialFactoryNode_GetClearCoatNormalConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetClearCoatRoughnessConnection, "InterchangeMaterialFactoryNode", "GetClearCoatRoughnessConnection", SDK::Params::InterchangeMaterialFactoryNode_GetClearCoatRoughnessConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetClothConnection, "InterchangeMaterialFactoryNode", "GetClothConnection", SDK::Params::InterchangeMaterialFactoryNode_GetClothConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetCustomBlendMode, "InterchangeMaterialFactoryNode", "GetCustomBlendMode", SDK::Params::InterchangeMaterialFactoryNode_GetCustomBlendMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetCustomOpacityMaskClipValue, "InterchangeMaterialFactoryNode", "GetCustomOpacityMaskClipValue", SDK::Params::InterchangeMaterialFactoryNode_GetCustomOpacityMaskClipValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetCustomRefractionMethod, "InterchangeMaterialFactoryNode", "GetCustomRefractionMethod", SDK::Params::InterchangeMaterialFactoryNode_GetCustomRefractionMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetCustomScreenSpaceReflections, "InterchangeMaterialFactoryNode", "GetCustomScreenSpaceReflections", SDK::Params::InterchangeMaterialFactoryNode_GetCustomScreenSpaceReflections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetCustomShadingModel, "InterchangeMaterialFactoryNode", "GetCustomShadingModel", SDK::Params::InterchangeMaterialFactoryNode_GetCustomShadingModel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetCustomTranslucencyLightingMode, "InterchangeMaterialFactoryNode", "GetCustomTranslucencyLightingMode", SDK::Params::InterchangeMaterialFactoryNode_GetCustomTranslucencyLightingMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetCustomTwoSided, "InterchangeMaterialFactoryNode", "GetCustomTwoSided", SDK::Params::InterchangeMaterialFactoryNode_GetCustomTwoSided)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetEmissiveColorConnection, "InterchangeMaterialFactoryNode", "GetEmissiveColorConnection", SDK::Params::InterchangeMaterialFactoryNode_GetEmissiveColorConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetFuzzColorConnection, "InterchangeMaterialFactoryNode", "GetFuzzColorConnection", SDK::Params::InterchangeMaterialFactoryNode_GetFuzzColorConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetMetallicConnection, "InterchangeMaterialFactoryNode", "GetMetallicConnection", SDK::Params::InterchangeMaterialFactoryNode_GetMetallicConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetNormalConnection, "InterchangeMaterialFactoryNode", "GetNormalConnection", SDK::Params::InterchangeMaterialFactoryNode_GetNormalConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetObjectClass, "InterchangeMaterialFactoryNode", "GetObjectClass", SDK::Params::InterchangeMaterialFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetOcclusionConnection, "InterchangeMaterialFactoryNode", "GetOcclusionConnection", SDK::Params::InterchangeMaterialFactoryNode_GetOcclusionConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetOpacityConnection, "InterchangeMaterialFactoryNode", "GetOpacityConnection", SDK::Params::InterchangeMaterialFactoryNode_GetOpacityConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetRefractionConnection, "InterchangeMaterialFactoryNode", "GetRefractionConnection", SDK::Params::InterchangeMaterialFactoryNode_GetRefractionConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetRoughnessConnection, "InterchangeMaterialFactoryNode", "GetRoughnessConnection", SDK::Params::InterchangeMaterialFactoryNode_GetRoughnessConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetSpecularConnection, "InterchangeMaterialFactoryNode", "GetSpecularConnection", SDK::Params::InterchangeMaterialFactoryNode_GetSpecularConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetSubsurfaceConnection, "InterchangeMaterialFactoryNode", "GetSubsurfaceConnection", SDK::Params::InterchangeMaterialFactoryNode_GetSubsurfaceConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetTangentConnection, "InterchangeMaterialFactoryNode", "GetTangentConnection", SDK::Params::InterchangeMaterialFactoryNode_GetTangentConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFactoryNode, GetTransmissionColorConnection, "InterchangeMaterialFactoryNode", "GetTransmissionColorConnection", SDK::Params::InterchangeMaterialFactoryNode_GetTransmissionColorConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialExpressionFactoryNode, SetCustomExpressionClassName, "InterchangeMaterialExpressionFactoryNode", "SetCustomExpressionClassName", SDK::Params::InterchangeMaterialExpressionFactoryNode_SetCustomExpressionClassName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialExpressionFactoryNode, GetCustomExpressionClassName, "InterchangeMaterialExpressionFactoryNode", "GetCustomExpressionClassName", SDK::Params::InterchangeMaterialExpressionFactoryNode_GetCustomExpressionClassName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceFactoryNode, SetCustomInstanceClassName, "InterchangeMaterialInstanceFactoryNode", "SetCustomInstanceClassName", SDK::Params::InterchangeMaterialInstanceFactoryNode_SetCustomInstanceClassName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceFactoryNode, SetCustomParent, "InterchangeMaterialInstanceFactoryNode", "SetCustomParent", SDK::Params::InterchangeMaterialInstanceFactoryNode_SetCustomParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceFactoryNode, GetCustomInstanceClassName, "InterchangeMaterialInstanceFactoryNode", "GetCustomInstanceClassName", SDK::Params::InterchangeMaterialInstanceFactoryNode_GetCustomInstanceClassName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceFactoryNode, GetCustomParent, "InterchangeMaterialInstanceFactoryNode", "GetCustomParent", SDK::Params::InterchangeMaterialInstanceFactoryNode_GetCustomParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFunctionCallExpressionFactoryNode, SetCustomMaterialFunctionDependency, "InterchangeMaterialFunctionCallExpressionFactoryNode", "SetCustomMaterialFunctionDependency", SDK::Params::InterchangeMaterialFunctionCallExpressionFactoryNode_SetCustomMaterialFunctionDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFunctionCallExpressionFactoryNode, GetCustomMaterialFunctionDependency, "InterchangeMaterialFunctionCallExpressionFactoryNode", "GetCustomMaterialFunctionDependency", SDK::Params::InterchangeMaterialFunctionCallExpressionFactoryNode_GetCustomMaterialFunctionDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFunctionFactoryNode, GetInputConnection, "InterchangeMaterialFunctionFactoryNode", "GetInputConnection", SDK::Params::InterchangeMaterialFunctionFactoryNode_GetInputConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialFunctionFactoryNode, GetObjectClass, "InterchangeMaterialFunctionFactoryNode", "GetObjectClass", SDK::Params::InterchangeMaterialFunctionFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshActorFactoryNode, RemoveSlotMaterialDependencyUid, "InterchangeMeshActorFactoryNode", "RemoveSlotMaterialDependencyUid", SDK::Params::InterchangeMeshActorFactoryNode_RemoveSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshActorFactoryNode, SetCustomAnimationAssetUidToPlay, "InterchangeMeshActorFactoryNode", "SetCustomAnimationAssetUidToPlay", SDK::Params::InterchangeMeshActorFactoryNode_SetCustomAnimationAssetUidToPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshActorFactoryNode, SetCustomGeometricTransform, "InterchangeMeshActorFactoryNode", "SetCustomGeometricTransform", SDK::Params::InterchangeMeshActorFactoryNode_SetCustomGeometricTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshActorFactoryNode, SetSlotMaterialDependencyUid, "InterchangeMeshActorFactoryNode", "SetSlotMaterialDependencyUid", SDK::Params::InterchangeMeshActorFactoryNode_SetSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshActorFactoryNode, GetCustomAnimationAssetUidToPlay, "InterchangeMeshActorFactoryNode", "GetCustomAnimationAssetUidToPlay", SDK::Params::InterchangeMeshActorFactoryNode_GetCustomAnimationAssetUidToPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshActorFactoryNode, GetCustomGeometricTransform, "InterchangeMeshActorFactoryNode", "GetCustomGeometricTransform", SDK::Params::InterchangeMeshActorFactoryNode_GetCustomGeometricTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshActorFactoryNode, GetSlotMaterialDependencies, "InterchangeMeshActorFactoryNode", "GetSlotMaterialDependencies", SDK::Params::InterchangeMeshActorFactoryNode_GetSlotMaterialDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshActorFactoryNode, GetSlotMaterialDependencyUid, "InterchangeMeshActorFactoryNode", "GetSlotMaterialDependencyUid", SDK::Params::InterchangeMeshActorFactoryNode_GetSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, AddLodDataUniqueId, "InterchangeMeshFactoryNode", "AddLodDataUniqueId", SDK::Params::InterchangeMeshFactoryNode_AddLodDataUniqueId)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, RemoveLodDataUniqueId, "InterchangeMeshFactoryNode", "RemoveLodDataUniqueId", SDK::Params::InterchangeMeshFactoryNode_RemoveLodDataUniqueId)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, RemoveSlotMaterialDependencyUid, "InterchangeMeshFactoryNode", "RemoveSlotMaterialDependencyUid", SDK::Params::InterchangeMeshFactoryNode_RemoveSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, ResetSlotMaterialDependencies, "InterchangeMeshFactoryNode", "ResetSlotMaterialDependencies", SDK::Params::InterchangeMeshFactoryNode_ResetSlotMaterialDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomComputeWeightedNormals, "InterchangeMeshFactoryNode", "SetCustomComputeWeightedNormals", SDK::Params::InterchangeMeshFactoryNode_SetCustomComputeWeightedNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomKeepSectionsSeparate, "InterchangeMeshFactoryNode", "SetCustomKeepSectionsSeparate", SDK::Params::InterchangeMeshFactoryNode_SetCustomKeepSectionsSeparate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomLODGroup, "InterchangeMeshFactoryNode", "SetCustomLODGroup", SDK::Params::InterchangeMeshFactoryNode_SetCustomLODGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomRecomputeNormals, "InterchangeMeshFactoryNode", "SetCustomRecomputeNormals", SDK::Params::InterchangeMeshFactoryNode_SetCustomRecomputeNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomRecomputeTangents, "InterchangeMeshFactoryNode", "SetCustomRecomputeTangents", SDK::Params::InterchangeMeshFactoryNode_SetCustomRecomputeTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomRemoveDegenerates, "InterchangeMeshFactoryNode", "SetCustomRemoveDegenerates", SDK::Params::InterchangeMeshFactoryNode_SetCustomRemoveDegenerates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomUseBackwardsCompatibleF16TruncUVs, "InterchangeMeshFactoryNode", "SetCustomUseBackwardsCompatibleF16TruncUVs", SDK::Params::InterchangeMeshFactoryNode_SetCustomUseBackwardsCompatibleF16TruncUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomUseFullPrecisionUVs, "InterchangeMeshFactoryNode", "SetCustomUseFullPrecisionUVs", SDK::Params::InterchangeMeshFactoryNode_SetCustomUseFullPrecisionUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomUseHighPrecisionTangentBasis, "InterchangeMeshFactoryNode", "SetCustomUseHighPrecisionTangentBasis", SDK::Params::InterchangeMeshFactoryNode_SetCustomUseHighPrecisionTangentBasis)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomUseMikkTSpace, "InterchangeMeshFactoryNode", "SetCustomUseMikkTSpace", SDK::Params::InterchangeMeshFactoryNode_SetCustomUseMikkTSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomVertexColorIgnore, "InterchangeMeshFactoryNode", "SetCustomVertexColorIgnore", SDK::Params::InterchangeMeshFactoryNode_SetCustomVertexColorIgnore)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomVertexColorOverride, "InterchangeMeshFactoryNode", "SetCustomVertexColorOverride", SDK::Params::InterchangeMeshFactoryNode_SetCustomVertexColorOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetCustomVertexColorReplace, "InterchangeMeshFactoryNode", "SetCustomVertexColorReplace", SDK::Params::InterchangeMeshFactoryNode_SetCustomVertexColorReplace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, SetSlotMaterialDependencyUid, "InterchangeMeshFactoryNode", "SetSlotMaterialDependencyUid", SDK::Params::InterchangeMeshFactoryNode_SetSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomComputeWeightedNormals, "InterchangeMeshFactoryNode", "GetCustomComputeWeightedNormals", SDK::Params::InterchangeMeshFactoryNode_GetCustomComputeWeightedNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomKeepSectionsSeparate, "InterchangeMeshFactoryNode", "GetCustomKeepSectionsSeparate", SDK::Params::InterchangeMeshFactoryNode_GetCustomKeepSectionsSeparate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomLODGroup, "InterchangeMeshFactoryNode", "GetCustomLODGroup", SDK::Params::InterchangeMeshFactoryNode_GetCustomLODGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomRecomputeNormals, "InterchangeMeshFactoryNode", "GetCustomRecomputeNormals", SDK::Params::InterchangeMeshFactoryNode_GetCustomRecomputeNormals)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomRecomputeTangents, "InterchangeMeshFactoryNode", "GetCustomRecomputeTangents", SDK::Params::InterchangeMeshFactoryNode_GetCustomRecomputeTangents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomRemoveDegenerates, "InterchangeMeshFactoryNode", "GetCustomRemoveDegenerates", SDK::Params::InterchangeMeshFactoryNode_GetCustomRemoveDegenerates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomUseBackwardsCompatibleF16TruncUVs, "InterchangeMeshFactoryNode", "GetCustomUseBackwardsCompatibleF16TruncUVs", SDK::Params::InterchangeMeshFactoryNode_GetCustomUseBackwardsCompatibleF16TruncUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomUseFullPrecisionUVs, "InterchangeMeshFactoryNode", "GetCustomUseFullPrecisionUVs", SDK::Params::InterchangeMeshFactoryNode_GetCustomUseFullPrecisionUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomUseHighPrecisionTangentBasis, "InterchangeMeshFactoryNode", "GetCustomUseHighPrecisionTangentBasis", SDK::Params::InterchangeMeshFactoryNode_GetCustomUseHighPrecisionTangentBasis)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomUseMikkTSpace, "InterchangeMeshFactoryNode", "GetCustomUseMikkTSpace", SDK::Params::InterchangeMeshFactoryNode_GetCustomUseMikkTSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomVertexColorIgnore, "InterchangeMeshFactoryNode", "GetCustomVertexColorIgnore", SDK::Params::InterchangeMeshFactoryNode_GetCustomVertexColorIgnore)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomVertexColorOverride, "InterchangeMeshFactoryNode", "GetCustomVertexColorOverride", SDK::Params::InterchangeMeshFactoryNode_GetCustomVertexColorOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetCustomVertexColorReplace, "InterchangeMeshFactoryNode", "GetCustomVertexColorReplace", SDK::Params::InterchangeMeshFactoryNode_GetCustomVertexColorReplace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetLodDataCount, "InterchangeMeshFactoryNode", "GetLodDataCount", SDK::Params::InterchangeMeshFactoryNode_GetLodDataCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetLodDataUniqueIds, "InterchangeMeshFactoryNode", "GetLodDataUniqueIds", SDK::Params::InterchangeMeshFactoryNode_GetLodDataUniqueIds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetSlotMaterialDependencies, "InterchangeMeshFactoryNode", "GetSlotMaterialDependencies", SDK::Params::InterchangeMeshFactoryNode_GetSlotMaterialDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshFactoryNode, GetSlotMaterialDependencyUid, "InterchangeMeshFactoryNode", "GetSlotMaterialDependencyUid", SDK::Params::InterchangeMeshFactoryNode_GetSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, InitializeSkeletalMeshNode, "InterchangeSkeletalMeshFactoryNode", "InitializeSkeletalMeshNode", SDK::Params::InterchangeSkeletalMeshFactoryNode_InitializeSkeletalMeshNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomBoneInfluenceLimit, "InterchangeSkeletalMeshFactoryNode", "SetCustomBoneInfluenceLimit", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomBoneInfluenceLimit)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomCreatePhysicsAsset, "InterchangeSkeletalMeshFactoryNode", "SetCustomCreatePhysicsAsset", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomCreatePhysicsAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomImportContentType, "InterchangeSkeletalMeshFactoryNode", "SetCustomImportContentType", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomImportContentType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomImportMorphTarget, "InterchangeSkeletalMeshFactoryNode", "SetCustomImportMorphTarget", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomImportMorphTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomImportVertexAttributes, "InterchangeSkeletalMeshFactoryNode", "SetCustomImportVertexAttributes", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomImportVertexAttributes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomMorphThresholdPosition, "InterchangeSkeletalMeshFactoryNode", "SetCustomMorphThresholdPosition", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomMorphThresholdPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomPhysicAssetSoftObjectPath, "InterchangeSkeletalMeshFactoryNode", "SetCustomPhysicAssetSoftObjectPath", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomPhysicAssetSoftObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomSkeletonSoftObjectPath, "InterchangeSkeletalMeshFactoryNode", "SetCustomSkeletonSoftObjectPath", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomSkeletonSoftObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomThresholdPosition, "InterchangeSkeletalMeshFactoryNode", "SetCustomThresholdPosition", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomThresholdPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomThresholdTangentNormal, "InterchangeSkeletalMeshFactoryNode", "SetCustomThresholdTangentNormal", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomThresholdTangentNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomThresholdUV, "InterchangeSkeletalMeshFactoryNode", "SetCustomThresholdUV", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomThresholdUV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, SetCustomUseHighPrecisionSkinWeights, "InterchangeSkeletalMeshFactoryNode", "SetCustomUseHighPrecisionSkinWeights", SDK::Params::InterchangeSkeletalMeshFactoryNode_SetCustomUseHighPrecisionSkinWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomBoneInfluenceLimit, "InterchangeSkeletalMeshFactoryNode", "GetCustomBoneInfluenceLimit", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomBoneInfluenceLimit)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomCreatePhysicsAsset, "InterchangeSkeletalMeshFactoryNode", "GetCustomCreatePhysicsAsset", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomCreatePhysicsAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomImportContentType, "InterchangeSkeletalMeshFactoryNode", "GetCustomImportContentType", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomImportContentType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomImportMorphTarget, "InterchangeSkeletalMeshFactoryNode", "GetCustomImportMorphTarget", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomImportMorphTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomImportVertexAttributes, "InterchangeSkeletalMeshFactoryNode", "GetCustomImportVertexAttributes", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomImportVertexAttributes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomMorphThresholdPosition, "InterchangeSkeletalMeshFactoryNode", "GetCustomMorphThresholdPosition", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomMorphThresholdPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomPhysicAssetSoftObjectPath, "InterchangeSkeletalMeshFactoryNode", "GetCustomPhysicAssetSoftObjectPath", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomPhysicAssetSoftObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomSkeletonSoftObjectPath, "InterchangeSkeletalMeshFactoryNode", "GetCustomSkeletonSoftObjectPath", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomSkeletonSoftObjectPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomThresholdPosition, "InterchangeSkeletalMeshFactoryNode", "GetCustomThresholdPosition", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomThresholdPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomThresholdTangentNormal, "InterchangeSkeletalMeshFactoryNode", "GetCustomThresholdTangentNormal", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomThresholdTangentNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomThresholdUV, "InterchangeSkeletalMeshFactoryNode", "GetCustomThresholdUV", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomThresholdUV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetCustomUseHighPrecisionSkinWeights, "InterchangeSkeletalMeshFactoryNode", "GetCustomUseHighPrecisionSkinWeights", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetCustomUseHighPrecisionSkinWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshFactoryNode, GetObjectClass, "InterchangeSkeletalMeshFactoryNode", "GetObjectClass", SDK::Params::InterchangeSkeletalMeshFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshLodDataNode, AddMeshUid, "InterchangeSkeletalMeshLodDataNode", "AddMeshUid", SDK::Params::InterchangeSkeletalMeshLodDataNode_AddMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshLodDataNode, RemoveAllMeshes, "InterchangeSkeletalMeshLodDataNode", "RemoveAllMeshes", SDK::Params::InterchangeSkeletalMeshLodDataNode_RemoveAllMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshLodDataNode, RemoveMeshUid, "InterchangeSkeletalMeshLodDataNode", "RemoveMeshUid", SDK::Params::InterchangeSkeletalMeshLodDataNode_RemoveMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshLodDataNode, SetCustomSkeletonUid, "InterchangeSkeletalMeshLodDataNode", "SetCustomSkeletonUid", SDK::Params::InterchangeSkeletalMeshLodDataNode_SetCustomSkeletonUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshLodDataNode, GetCustomSkeletonUid, "InterchangeSkeletalMeshLodDataNode", "GetCustomSkeletonUid", SDK::Params::InterchangeSkeletalMeshLodDataNode_GetCustomSkeletonUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshLodDataNode, GetMeshUids, "InterchangeSkeletalMeshLodDataNode", "GetMeshUids", SDK::Params::InterchangeSkeletalMeshLodDataNode_GetMeshUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalMeshLodDataNode, GetMeshUidsCount, "InterchangeSkeletalMeshLodDataNode", "GetMeshUidsCount", SDK::Params::InterchangeSkeletalMeshLodDataNode_GetMeshUidsCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, AddSocketUid, "InterchangeStaticMeshFactoryNode", "AddSocketUid", SDK::Params::InterchangeStaticMeshFactoryNode_AddSocketUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, AddSocketUids, "InterchangeStaticMeshFactoryNode", "AddSocketUids", SDK::Params::InterchangeStaticMeshFactoryNode_AddSocketUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, InitializeStaticMeshNode, "InterchangeStaticMeshFactoryNode", "InitializeStaticMeshNode", SDK::Params::InterchangeStaticMeshFactoryNode_InitializeStaticMeshNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, RemoveSocketUd, "InterchangeStaticMeshFactoryNode", "RemoveSocketUd", SDK::Params::InterchangeStaticMeshFactoryNode_RemoveSocketUd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomBuildNanite, "InterchangeStaticMeshFactoryNode", "SetCustomBuildNanite", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomBuildNanite)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomBuildReversedIndexBuffer, "InterchangeStaticMeshFactoryNode", "SetCustomBuildReversedIndexBuffer", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomBuildReversedIndexBuffer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomBuildScale3D, "InterchangeStaticMeshFactoryNode", "SetCustomBuildScale3D", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomBuildScale3D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomDistanceFieldReplacementMesh, "InterchangeStaticMeshFactoryNode", "SetCustomDistanceFieldReplacementMesh", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomDistanceFieldReplacementMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomDistanceFieldResolutionScale, "InterchangeStaticMeshFactoryNode", "SetCustomDistanceFieldResolutionScale", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomDistanceFieldResolutionScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomDstLightmapIndex, "InterchangeStaticMeshFactoryNode", "SetCustomDstLightmapIndex", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomDstLightmapIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomGenerateDistanceFieldAsIfTwoSided, "InterchangeStaticMeshFactoryNode", "SetCustomGenerateDistanceFieldAsIfTwoSided", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomGenerateDistanceFieldAsIfTwoSided)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomGenerateLightmapUVs, "InterchangeStaticMeshFactoryNode", "SetCustomGenerateLightmapUVs", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomGenerateLightmapUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomMaxLumenMeshCards, "InterchangeStaticMeshFactoryNode", "SetCustomMaxLumenMeshCards", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomMaxLumenMeshCards)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomMinLightmapResolution, "InterchangeStaticMeshFactoryNode", "SetCustomMinLightmapResolution", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomMinLightmapResolution)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomSrcLightmapIndex, "InterchangeStaticMeshFactoryNode", "SetCustomSrcLightmapIndex", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomSrcLightmapIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, SetCustomSupportFaceRemap, "InterchangeStaticMeshFactoryNode", "SetCustomSupportFaceRemap", SDK::Params::InterchangeStaticMeshFactoryNode_SetCustomSupportFaceRemap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomBuildNanite, "InterchangeStaticMeshFactoryNode", "GetCustomBuildNanite", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomBuildNanite)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomBuildReversedIndexBuffer, "InterchangeStaticMeshFactoryNode", "GetCustomBuildReversedIndexBuffer", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomBuildReversedIndexBuffer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomBuildScale3D, "InterchangeStaticMeshFactoryNode", "GetCustomBuildScale3D", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomBuildScale3D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomDistanceFieldReplacementMesh, "InterchangeStaticMeshFactoryNode", "GetCustomDistanceFieldReplacementMesh", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomDistanceFieldReplacementMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomDistanceFieldResolutionScale, "InterchangeStaticMeshFactoryNode", "GetCustomDistanceFieldResolutionScale", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomDistanceFieldResolutionScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomDstLightmapIndex, "InterchangeStaticMeshFactoryNode", "GetCustomDstLightmapIndex", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomDstLightmapIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomGenerateDistanceFieldAsIfTwoSided, "InterchangeStaticMeshFactoryNode", "GetCustomGenerateDistanceFieldAsIfTwoSided", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomGenerateDistanceFieldAsIfTwoSided)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomGenerateLightmapUVs, "InterchangeStaticMeshFactoryNode", "GetCustomGenerateLightmapUVs", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomGenerateLightmapUVs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomMaxLumenMeshCards, "InterchangeStaticMeshFactoryNode", "GetCustomMaxLumenMeshCards", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomMaxLumenMeshCards)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomMinLightmapResolution, "InterchangeStaticMeshFactoryNode", "GetCustomMinLightmapResolution", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomMinLightmapResolution)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomSrcLightmapIndex, "InterchangeStaticMeshFactoryNode", "GetCustomSrcLightmapIndex", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomSrcLightmapIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetCustomSupportFaceRemap, "InterchangeStaticMeshFactoryNode", "GetCustomSupportFaceRemap", SDK::Params::InterchangeStaticMeshFactoryNode_GetCustomSupportFaceRemap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetObjectClass, "InterchangeStaticMeshFactoryNode", "GetObjectClass", SDK::Params::InterchangeStaticMeshFactoryNode_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetSocketUidCount, "InterchangeStaticMeshFactoryNode", "GetSocketUidCount", SDK::Params::InterchangeStaticMeshFactoryNode_GetSocketUidCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshFactoryNode, GetSocketUids, "InterchangeStaticMeshFactoryNode", "GetSocketUids", SDK::Params::InterchangeStaticMeshFactoryNode_GetSocketUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, AddBoxCollisionMeshUid, "InterchangeStaticMeshLodDataNode", "AddBoxCollisionMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_AddBoxCollisionMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, AddCapsuleCollisionMeshUid, "InterchangeStaticMeshLodDataNode", "AddCapsuleCollisionMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_AddCapsuleCollisionMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, AddConvexCollisionMeshUid, "InterchangeStaticMeshLodDataNode", "AddConvexCollisionMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_AddConvexCollisionMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, AddMeshUid, "InterchangeStaticMeshLodDataNode", "AddMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_AddMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, AddSphereCollisionMeshUid, "InterchangeStaticMeshLodDataNode", "AddSphereCollisionMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_AddSphereCollisionMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveAllBoxCollisionMeshes, "InterchangeStaticMeshLodDataNode", "RemoveAllBoxCollisionMeshes", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveAllBoxCollisionMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveAllCapsuleCollisionMeshes, "InterchangeStaticMeshLodDataNode", "RemoveAllCapsuleCollisionMeshes", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveAllCapsuleCollisionMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveAllConvexCollisionMeshes, "InterchangeStaticMeshLodDataNode", "RemoveAllConvexCollisionMeshes", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveAllConvexCollisionMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveAllMeshes, "InterchangeStaticMeshLodDataNode", "RemoveAllMeshes", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveAllMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveAllSphereCollisionMeshes, "InterchangeStaticMeshLodDataNode", "RemoveAllSphereCollisionMeshes", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveAllSphereCollisionMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveBoxCollisionMeshUid, "InterchangeStaticMeshLodDataNode", "RemoveBoxCollisionMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveBoxCollisionMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveCapsuleCollisionMeshUid, "InterchangeStaticMeshLodDataNode", "RemoveCapsuleCollisionMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveCapsuleCollisionMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveConvexCollisionMeshUid, "InterchangeStaticMeshLodDataNode", "RemoveConvexCollisionMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveConvexCollisionMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveMeshUid, "InterchangeStaticMeshLodDataNode", "RemoveMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, RemoveSphereCollisionMeshUid, "InterchangeStaticMeshLodDataNode", "RemoveSphereCollisionMeshUid", SDK::Params::InterchangeStaticMeshLodDataNode_RemoveSphereCollisionMeshUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, SetImportCollision, "InterchangeStaticMeshLodDataNode", "SetImportCollision", SDK::Params::InterchangeStaticMeshLodDataNode_SetImportCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, SetOneConvexHullPerUCX, "InterchangeStaticMeshLodDataNode", "SetOneConvexHullPerUCX", SDK::Params::InterchangeStaticMeshLodDataNode_SetOneConvexHullPerUCX)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetBoxCollisionMeshUids, "InterchangeStaticMeshLodDataNode", "GetBoxCollisionMeshUids", SDK::Params::InterchangeStaticMeshLodDataNode_GetBoxCollisionMeshUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetBoxCollisionMeshUidsCount, "InterchangeStaticMeshLodDataNode", "GetBoxCollisionMeshUidsCount", SDK::Params::InterchangeStaticMeshLodDataNode_GetBoxCollisionMeshUidsCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetCapsuleCollisionMeshUids, "InterchangeStaticMeshLodDataNode", "GetCapsuleCollisionMeshUids", SDK::Params::InterchangeStaticMeshLodDataNode_GetCapsuleCollisionMeshUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetCapsuleCollisionMeshUidsCount, "InterchangeStaticMeshLodDataNode", "GetCapsuleCollisionMeshUidsCount", SDK::Params::InterchangeStaticMeshLodDataNode_GetCapsuleCollisionMeshUidsCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetConvexCollisionMeshUids, "InterchangeStaticMeshLodDataNode", "GetConvexCollisionMeshUids", SDK::Params::InterchangeStaticMeshLodDataNode_GetConvexCollisionMeshUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetConvexCollisionMeshUidsCount, "InterchangeStaticMeshLodDataNode", "GetConvexCollisionMeshUidsCount", SDK::Params::InterchangeStaticMeshLodDataNode_GetConvexCollisionMeshUidsCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetImportCollision, "InterchangeStaticMeshLodDataNode", "GetImportCollision", SDK::Params::InterchangeStaticMeshLodDataNode_GetImportCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetMeshUids, "InterchangeStaticMeshLodDataNode", "GetMeshUids", SDK::Params::InterchangeStaticMeshLodDataNode_GetMeshUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetMeshUidsCount, "InterchangeStaticMeshLodDataNode", "GetMeshUidsCount", SDK::Params::InterchangeStaticMeshLodDataNode_GetMeshUidsCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetOneConvexHullPerUCX, "InterchangeStaticMeshLodDataNode", "GetOneConvexHullPerUCX", SDK::Params::InterchangeStaticMeshLodDataNode_GetOneConvexHullPerUCX)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetSphereCollisionMeshUids, "InterchangeStaticMeshLodDataNode", "GetSphereCollisionMeshUids", SDK::Params::InterchangeStaticMeshLodDataNode_GetSphereCollisionMeshUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStaticMeshLodDataNode, GetSphereCollisionMeshUidsCount, "InterchangeStaticMeshLodDataNode", "GetSphereCollisionMeshUidsCount", SDK::Params::InterchangeStaticMeshLodDataNode_GetSphereCollisionMeshUidsCount)
+// clang-format on
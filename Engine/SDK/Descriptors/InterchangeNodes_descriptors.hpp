@@ -0,0 +1,250 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from InterchangeNodes_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/InterchangeNodes_classes.hpp"
+#include "../SDK/InterchangeNodes_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetNode, AddCustomAnimationTrackUid, "InterchangeAnimationTrackSetNode", "AddCustomAnimationTrackUid", SDK::Params::InterchangeAnimationTrackSetNode_AddCustomAnimationTrackUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetNode, RemoveCustomAnimationTrackUid, "InterchangeAnimationTrackSetNode", "RemoveCustomAnimationTrackUid", SDK::Params::InterchangeAnimationTrackSetNode_RemoveCustomAnimationTrackUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetNode, SetCustomFrameRate, "InterchangeAnimationTrackSetNode", "SetCustomFrameRate", SDK::Params::InterchangeAnimationTrackSetNode_SetCustomFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetNode, GetCustomAnimationTrackUid, "InterchangeAnimationTrackSetNode", "GetCustomAnimationTrackUid", SDK::Params::InterchangeAnimationTrackSetNode_GetCustomAnimationTrackUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetNode, GetCustomAnimationTrackUidCount, "InterchangeAnimationTrackSetNode", "GetCustomAnimationTrackUidCount", SDK::Params::InterchangeAnimationTrackSetNode_GetCustomAnimationTrackUidCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetNode, GetCustomAnimationTrackUids, "InterchangeAnimationTrackSetNode", "GetCustomAnimationTrackUids", SDK::Params::InterchangeAnimationTrackSetNode_GetCustomAnimationTrackUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetNode, GetCustomFrameRate, "InterchangeAnimationTrackSetNode", "GetCustomFrameRate", SDK::Params::InterchangeAnimationTrackSetNode_GetCustomFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackBaseNode, SetCustomCompletionMode, "InterchangeAnimationTrackBaseNode", "SetCustomCompletionMode", SDK::Params::InterchangeAnimationTrackBaseNode_SetCustomCompletionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackBaseNode, GetCustomCompletionMode, "InterchangeAnimationTrackBaseNode", "GetCustomCompletionMode", SDK::Params::InterchangeAnimationTrackBaseNode_GetCustomCompletionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetInstanceNode, SetCustomDuration, "InterchangeAnimationTrackSetInstanceNode", "SetCustomDuration", SDK::Params::InterchangeAnimationTrackSetInstanceNode_SetCustomDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetInstanceNode, SetCustomStartFrame, "InterchangeAnimationTrackSetInstanceNode", "SetCustomStartFrame", SDK::Params::InterchangeAnimationTrackSetInstanceNode_SetCustomStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetInstanceNode, SetCustomTimeScale, "InterchangeAnimationTrackSetInstanceNode", "SetCustomTimeScale", SDK::Params::InterchangeAnimationTrackSetInstanceNode_SetCustomTimeScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetInstanceNode, SetCustomTrackSetDependencyUid, "InterchangeAnimationTrackSetInstanceNode", "SetCustomTrackSetDependencyUid", SDK::Params::InterchangeAnimationTrackSetInstanceNode_SetCustomTrackSetDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetInstanceNode, GetCustomDuration, "InterchangeAnimationTrackSetInstanceNode", "GetCustomDuration", SDK::Params::InterchangeAnimationTrackSetInstanceNode_GetCustomDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetInstanceNode, GetCustomStartFrame, "InterchangeAnimationTrackSetInstanceNode", "GetCustomStartFrame", SDK::Params::InterchangeAnimationTrackSetInstanceNode_GetCustomStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetInstanceNode, GetCustomTimeScale, "InterchangeAnimationTrackSetInstanceNode", "GetCustomTimeScale", SDK::Params::InterchangeAnimationTrackSetInstanceNode_GetCustomTimeScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackSetInstanceNode, GetCustomTrackSetDependencyUid, "InterchangeAnimationTrackSetInstanceNode", "GetCustomTrackSetDependencyUid", SDK::Params::InterchangeAnimationTrackSetInstanceNode_GetCustomTrackSetDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, SetCustomActorDependencyUid, "InterchangeAnimationTrackNode", "SetCustomActorDependencyUid", SDK::Params::InterchangeAnimationTrackNode_SetCustomActorDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, SetCustomAnimationPayloadKey, "InterchangeAnimationTrackNode", "SetCustomAnimationPayloadKey", SDK::Params::InterchangeAnimationTrackNode_SetCustomAnimationPayloadKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, SetCustomFrameCount, "InterchangeAnimationTrackNode", "SetCustomFrameCount", SDK::Params::InterchangeAnimationTrackNode_SetCustomFrameCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, SetCustomPropertyTrack, "InterchangeAnimationTrackNode", "SetCustomPropertyTrack", SDK::Params::InterchangeAnimationTrackNode_SetCustomPropertyTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, SetCustomTargetedProperty, "InterchangeAnimationTrackNode", "SetCustomTargetedProperty", SDK::Params::InterchangeAnimationTrackNode_SetCustomTargetedProperty)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, GetCustomActorDependencyUid, "InterchangeAnimationTrackNode", "GetCustomActorDependencyUid", SDK::Params::InterchangeAnimationTrackNode_GetCustomActorDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, GetCustomAnimationPayloadKey, "InterchangeAnimationTrackNode", "GetCustomAnimationPayloadKey", SDK::Params::InterchangeAnimationTrackNode_GetCustomAnimationPayloadKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, GetCustomFrameCount, "InterchangeAnimationTrackNode", "GetCustomFrameCount", SDK::Params::InterchangeAnimationTrackNode_GetCustomFrameCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, GetCustomPropertyTrack, "InterchangeAnimationTrackNode", "GetCustomPropertyTrack", SDK::Params::InterchangeAnimationTrackNode_GetCustomPropertyTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeAnimationTrackNode, GetCustomTargetedProperty, "InterchangeAnimationTrackNode", "GetCustomTargetedProperty", SDK::Params::InterchangeAnimationTrackNode_GetCustomTargetedProperty)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTransformAnimationTrackNode, SetCustomUsedChannels, "InterchangeTransformAnimationTrackNode", "SetCustomUsedChannels", SDK::Params::InterchangeTransformAnimationTrackNode_SetCustomUsedChannels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTransformAnimationTrackNode, GetCustomUsedChannels, "InterchangeTransformAnimationTrackNode", "GetCustomUsedChannels", SDK::Params::InterchangeTransformAnimationTrackNode_GetCustomUsedChannels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, SetAnimationPayloadKeyForMorphTargetNodeUid, "InterchangeSkeletalAnimationTrackNode", "SetAnimationPayloadKeyForMorphTargetNodeUid", SDK::Params::InterchangeSkeletalAnimationTrackNode_SetAnimationPayloadKeyForMorphTargetNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, SetAnimationPayloadKeyForSceneNodeUid, "InterchangeSkeletalAnimationTrackNode", "SetAnimationPayloadKeyForSceneNodeUid", SDK::Params::InterchangeSkeletalAnimationTrackNode_SetAnimationPayloadKeyForSceneNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, SetCustomAnimationSampleRate, "InterchangeSkeletalAnimationTrackNode", "SetCustomAnimationSampleRate", SDK::Params::InterchangeSkeletalAnimationTrackNode_SetCustomAnimationSampleRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, SetCustomAnimationStartTime, "InterchangeSkeletalAnimationTrackNode", "SetCustomAnimationStartTime", SDK::Params::InterchangeSkeletalAnimationTrackNode_SetCustomAnimationStartTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, SetCustomAnimationStopTime, "InterchangeSkeletalAnimationTrackNode", "SetCustomAnimationStopTime", SDK::Params::InterchangeSkeletalAnimationTrackNode_SetCustomAnimationStopTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, SetCustomSkeletonNodeUid, "InterchangeSkeletalAnimationTrackNode", "SetCustomSkeletonNodeUid", SDK::Params::InterchangeSkeletalAnimationTrackNode_SetCustomSkeletonNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, GetCustomAnimationSampleRate, "InterchangeSkeletalAnimationTrackNode", "GetCustomAnimationSampleRate", SDK::Params::InterchangeSkeletalAnimationTrackNode_GetCustomAnimationSampleRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, GetCustomAnimationStartTime, "InterchangeSkeletalAnimationTrackNode", "GetCustomAnimationStartTime", SDK::Params::InterchangeSkeletalAnimationTrackNode_GetCustomAnimationStartTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, GetCustomAnimationStopTime, "InterchangeSkeletalAnimationTrackNode", "GetCustomAnimationStopTime", SDK::Params::InterchangeSkeletalAnimationTrackNode_GetCustomAnimationStopTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, GetCustomSkeletonNodeUid, "InterchangeSkeletalAnimationTrackNode", "GetCustomSkeletonNodeUid", SDK::Params::InterchangeSkeletalAnimationTrackNode_GetCustomSkeletonNodeUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, GetMorphTargetNodeAnimationPayloadKeys, "InterchangeSkeletalAnimationTrackNode", "GetMorphTargetNodeAnimationPayloadKeys", SDK::Params::InterchangeSkeletalAnimationTrackNode_GetMorphTargetNodeAnimationPayloadKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSkeletalAnimationTrackNode, GetSceneNodeAnimationPayloadKeys, "InterchangeSkeletalAnimationTrackNode", "GetSceneNodeAnimationPayloadKeys", SDK::Params::InterchangeSkeletalAnimationTrackNode_GetSceneNodeAnimationPayloadKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraNode, SetCustomEnableDepthOfField, "InterchangePhysicalCameraNode", "SetCustomEnableDepthOfField", SDK::Params::InterchangePhysicalCameraNode_SetCustomEnableDepthOfField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraNode, SetCustomFocalLength, "InterchangePhysicalCameraNode", "SetCustomFocalLength", SDK::Params::InterchangePhysicalCameraNode_SetCustomFocalLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraNode, SetCustomSensorHeight, "InterchangePhysicalCameraNode", "SetCustomSensorHeight", SDK::Params::InterchangePhysicalCameraNode_SetCustomSensorHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraNode, SetCustomSensorWidth, "InterchangePhysicalCameraNode", "SetCustomSensorWidth", SDK::Params::InterchangePhysicalCameraNode_SetCustomSensorWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraNode, GetCustomEnableDepthOfField, "InterchangePhysicalCameraNode", "GetCustomEnableDepthOfField", SDK::Params::InterchangePhysicalCameraNode_GetCustomEnableDepthOfField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraNode, GetCustomFocalLength, "InterchangePhysicalCameraNode", "GetCustomFocalLength", SDK::Params::InterchangePhysicalCameraNode_GetCustomFocalLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraNode, GetCustomSensorHeight, "InterchangePhysicalCameraNode", "GetCustomSensorHeight", SDK::Params::InterchangePhysicalCameraNode_GetCustomSensorHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePhysicalCameraNode, GetCustomSensorWidth, "InterchangePhysicalCameraNode", "GetCustomSensorWidth", SDK::Params::InterchangePhysicalCameraNode_GetCustomSensorWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, SetCustomAspectRatio, "InterchangeStandardCameraNode", "SetCustomAspectRatio", SDK::Params::InterchangeStandardCameraNode_SetCustomAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, SetCustomFarClipPlane, "InterchangeStandardCameraNode", "SetCustomFarClipPlane", SDK::Params::InterchangeStandardCameraNode_SetCustomFarClipPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, SetCustomFieldOfView, "InterchangeStandardCameraNode", "SetCustomFieldOfView", SDK::Params::InterchangeStandardCameraNode_SetCustomFieldOfView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, SetCustomNearClipPlane, "InterchangeStandardCameraNode", "SetCustomNearClipPlane", SDK::Params::InterchangeStandardCameraNode_SetCustomNearClipPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, SetCustomProjectionMode, "InterchangeStandardCameraNode", "SetCustomProjectionMode", SDK::Params::InterchangeStandardCameraNode_SetCustomProjectionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, SetCustomWidth, "InterchangeStandardCameraNode", "SetCustomWidth", SDK::Params::InterchangeStandardCameraNode_SetCustomWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, GetCustomAspectRatio, "InterchangeStandardCameraNode", "GetCustomAspectRatio", SDK::Params::InterchangeStandardCameraNode_GetCustomAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, GetCustomFarClipPlane, "InterchangeStandardCameraNode", "GetCustomFarClipPlane", SDK::Params::InterchangeStandardCameraNode_GetCustomFarClipPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, GetCustomFieldOfView, "InterchangeStandardCameraNode", "GetCustomFieldOfView", SDK::Params::InterchangeStandardCameraNode_GetCustomFieldOfView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, GetCustomNearClipPlane, "InterchangeStandardCameraNode", "GetCustomNearClipPlane", SDK::Params::InterchangeStandardCameraNode_GetCustomNearClipPlane)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, GetCustomProjectionMode, "InterchangeStandardCameraNode", "GetCustomProjectionMode", SDK::Params::InterchangeStandardCameraNode_GetCustomProjectionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeStandardCameraNode, GetCustomWidth, "InterchangeStandardCameraNode", "GetCustomWidth", SDK::Params::InterchangeStandardCameraNode_GetCustomWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderNode, AddFloatInput, "InterchangeShaderNode", "AddFloatInput", SDK::Params::InterchangeShaderNode_AddFloatInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderNode, AddLinearColorInput, "InterchangeShaderNode", "AddLinearColorInput", SDK::Params::InterchangeShaderNode_AddLinearColorInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderNode, AddStringInput, "InterchangeShaderNode", "AddStringInput", SDK::Params::InterchangeShaderNode_AddStringInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderNode, SetCustomShaderType, "InterchangeShaderNode", "SetCustomShaderType", SDK::Params::InterchangeShaderNode_SetCustomShaderType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderNode, GetCustomShaderType, "InterchangeShaderNode", "GetCustomShaderType", SDK::Params::InterchangeShaderNode_GetCustomShaderType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalNode, SetCustomDecalMaterialPathName, "InterchangeDecalNode", "SetCustomDecalMaterialPathName", SDK::Params::InterchangeDecalNode_SetCustomDecalMaterialPathName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalNode, SetCustomDecalSize, "InterchangeDecalNode", "SetCustomDecalSize", SDK::Params::InterchangeDecalNode_SetCustomDecalSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalNode, SetCustomSortOrder, "InterchangeDecalNode", "SetCustomSortOrder", SDK::Params::InterchangeDecalNode_SetCustomSortOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalNode, GetCustomDecalMaterialPathName, "InterchangeDecalNode", "GetCustomDecalMaterialPathName", SDK::Params::InterchangeDecalNode_GetCustomDecalMaterialPathName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalNode, GetCustomDecalSize, "InterchangeDecalNode", "GetCustomDecalSize", SDK::Params::InterchangeDecalNode_GetCustomDecalSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeDecalNode, GetCustomSortOrder, "InterchangeDecalNode", "GetCustomSortOrder", SDK::Params::InterchangeDecalNode_GetCustomSortOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightNode, SetCustomIntensity, "InterchangeBaseLightNode", "SetCustomIntensity", SDK::Params::InterchangeBaseLightNode_SetCustomIntensity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightNode, SetCustomLightColor, "InterchangeBaseLightNode", "SetCustomLightColor", SDK::Params::InterchangeBaseLightNode_SetCustomLightColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightNode, SetCustomTemperature, "InterchangeBaseLightNode", "SetCustomTemperature", SDK::Params::InterchangeBaseLightNode_SetCustomTemperature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightNode, SetCustomUseTemperature, "InterchangeBaseLightNode", "SetCustomUseTemperature", SDK::Params::InterchangeBaseLightNode_SetCustomUseTemperature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightNode, GetCustomIntensity, "InterchangeBaseLightNode", "GetCustomIntensity", SDK::Params::InterchangeBaseLightNode_GetCustomIntensity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightNode, GetCustomLightColor, "InterchangeBaseLightNode", "GetCustomLightColor", SDK::Params::InterchangeBaseLightNode_GetCustomLightColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightNode, GetCustomTemperature, "InterchangeBaseLightNode", "GetCustomTemperature", SDK::Params::InterchangeBaseLightNode_GetCustomTemperature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeBaseLightNode, GetCustomUseTemperature, "InterchangeBaseLightNode", "GetCustomUseTemperature", SDK::Params::InterchangeBaseLightNode_GetCustomUseTemperature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, SetCustomAttenuationRadius, "InterchangeLightNode", "SetCustomAttenuationRadius", SDK::Params::InterchangeLightNode_SetCustomAttenuationRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, SetCustomIESBrightnessScale, "InterchangeLightNode", "SetCustomIESBrightnessScale", SDK::Params::InterchangeLightNode_SetCustomIESBrightnessScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, SetCustomIESTexture, "InterchangeLightNode", "SetCustomIESTexture", SDK::Params::InterchangeLightNode_SetCustomIESTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, SetCustomIntensityUnits, "InterchangeLightNode", "SetCustomIntensityUnits", SDK::Params::InterchangeLightNode_SetCustomIntensityUnits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, SetCustomRotation, "InterchangeLightNode", "SetCustomRotation", SDK::Params::InterchangeLightNode_SetCustomRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, SetCustomUseIESBrightness, "InterchangeLightNode", "SetCustomUseIESBrightness", SDK::Params::InterchangeLightNode_SetCustomUseIESBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, GetCustomAttenuationRadius, "InterchangeLightNode", "GetCustomAttenuationRadius", SDK::Params::InterchangeLightNode_GetCustomAttenuationRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, GetCustomIESBrightnessScale, "InterchangeLightNode", "GetCustomIESBrightnessScale", SDK::Params::InterchangeLightNode_GetCustomIESBrightnessScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, GetCustomIESTexture, "InterchangeLightNode", "GetCustomIESTexture", SDK::Params::InterchangeLightNode_GetCustomIESTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, GetCustomIntensityUnits, "InterchangeLightNode", "GetCustomIntensityUnits", SDK::Params::InterchangeLightNode_GetCustomIntensityUnits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, GetCustomRotation, "InterchangeLightNode", "GetCustomRotation", SDK::Params::InterchangeLightNode_GetCustomRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeLightNode, GetCustomUseIESBrightness, "InterchangeLightNode", "GetCustomUseIESBrightness", SDK::Params::InterchangeLightNode_GetCustomUseIESBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePointLightNode, SetCustomLightFalloffExponent, "InterchangePointLightNode", "SetCustomLightFalloffExponent", SDK::Params::InterchangePointLightNode_SetCustomLightFalloffExponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePointLightNode, SetCustomUseInverseSquaredFalloff, "InterchangePointLightNode", "SetCustomUseInverseSquaredFalloff", SDK::Params::InterchangePointLightNode_SetCustomUseInverseSquaredFalloff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePointLightNode, GetCustomLightFalloffExponent, "InterchangePointLightNode", "GetCustomLightFalloffExponent", SDK::Params::InterchangePointLightNode_GetCustomLightFalloffExponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePointLightNode, GetCustomUseInverseSquaredFalloff, "InterchangePointLightNode", "GetCustomUseInverseSquaredFalloff", SDK::Params::InterchangePointLightNode_GetCustomUseInverseSquaredFalloff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSpotLightNode, SetCustomInnerConeAngle, "InterchangeSpotLightNode", "SetCustomInnerConeAngle", SDK::Params::InterchangeSpotLightNode_SetCustomInnerConeAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSpotLightNode, SetCustomOuterConeAngle, "InterchangeSpotLightNode", "SetCustomOuterConeAngle", SDK::Params::InterchangeSpotLightNode_SetCustomOuterConeAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSpotLightNode, GetCustomInnerConeAngle, "InterchangeSpotLightNode", "GetCustomInnerConeAngle", SDK::Params::InterchangeSpotLightNode_GetCustomInnerConeAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSpotLightNode, GetCustomOuterConeAngle, "InterchangeSpotLightNode", "GetCustomOuterConeAngle", SDK::Params::InterchangeSpotLightNode_GetCustomOuterConeAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeRectLightNode, SetCustomSourceHeight, "InterchangeRectLightNode", "SetCustomSourceHeight", SDK::Params::InterchangeRectLightNode_SetCustomSourceHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeRectLightNode, SetCustomSourceWidth, "InterchangeRectLightNode", "SetCustomSourceWidth", SDK::Params::InterchangeRectLightNode_SetCustomSourceWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeRectLightNode, GetCustomSourceHeight, "InterchangeRectLightNode", "GetCustomSourceHeight", SDK::Params::InterchangeRectLightNode_GetCustomSourceHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeRectLightNode, GetCustomSourceWidth, "InterchangeRectLightNode", "GetCustomSourceWidth", SDK::Params::InterchangeRectLightNode_GetCustomSourceWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureNode, SetCustombFlipGreenChannel, "InterchangeTextureNode", "SetCustombFlipGreenChannel", SDK::Params::InterchangeTextureNode_SetCustombFlipGreenChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureNode, SetCustomFilter, "InterchangeTextureNode", "SetCustomFilter", SDK::Params::InterchangeTextureNode_SetCustomFilter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureNode, SetCustomSRGB, "InterchangeTextureNode", "SetCustomSRGB", SDK::Params::InterchangeTextureNode_SetCustomSRGB)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureNode, SetPayLoadKey, "InterchangeTextureNode", "SetPayLoadKey", SDK::Params::InterchangeTextureNode_SetPayLoadKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureNode, GetCustombFlipGreenChannel, "InterchangeTextureNode", "GetCustombFlipGreenChannel", SDK::Params::InterchangeTextureNode_GetCustombFlipGreenChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureNode, GetCustomFilter, "InterchangeTextureNode", "GetCustomFilter", SDK::Params::InterchangeTextureNode_GetCustomFilter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTextureNode, GetCustomSRGB, "InterchangeTextureNode", "GetCustomSRGB", SDK::Params::InterchangeTextureNode_GetCustomSRGB)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, AddCustomDependencyUid, "InterchangeVariantSetNode", "AddCustomDependencyUid", SDK::Params::InterchangeVariantSetNode_AddCustomDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, RemoveCustomDependencyUid, "InterchangeVariantSetNode", "RemoveCustomDependencyUid", SDK::Params::InterchangeVariantSetNode_RemoveCustomDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, SetCustomDisplayText, "InterchangeVariantSetNode", "SetCustomDisplayText", SDK::Params::InterchangeVariantSetNode_SetCustomDisplayText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, SetCustomVariantsPayloadKey, "InterchangeVariantSetNode", "SetCustomVariantsPayloadKey", SDK::Params::InterchangeVariantSetNode_SetCustomVariantsPayloadKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, GetCustomDependencyUid, "InterchangeVariantSetNode", "GetCustomDependencyUid", SDK::Params::InterchangeVariantSetNode_GetCustomDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, GetCustomDependencyUidCount, "InterchangeVariantSetNode", "GetCustomDependencyUidCount", SDK::Params::InterchangeVariantSetNode_GetCustomDependencyUidCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, GetCustomDependencyUids, "InterchangeVariantSetNode", "GetCustomDependencyUids", SDK::Params::InterchangeVariantSetNode_GetCustomDependencyUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, GetCustomDisplayText, "InterchangeVariantSetNode", "GetCustomDisplayText", SDK::Params::InterchangeVariantSetNode_GetCustomDisplayText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeVariantSetNode, GetCustomVariantsPayloadKey, "InterchangeVariantSetNode", "GetCustomVariantsPayloadKey", SDK::Params::InterchangeVariantSetNode_GetCustomVariantsPayloadKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsNode, AddCustomVariantSetUid, "InterchangeSceneVariantSetsNode", "AddCustomVariantSetUid", SDK::Params::InterchangeSceneVariantSetsNode_AddCustomVariantSetUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsNode, RemoveCustomVariantSetUid, "InterchangeSceneVariantSetsNode", "RemoveCustomVariantSetUid", SDK::Params::InterchangeSceneVariantSetsNode_RemoveCustomVariantSetUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsNode, GetCustomVariantSetUid, "InterchangeSceneVariantSetsNode", "GetCustomVariantSetUid", SDK::Params::InterchangeSceneVariantSetsNode_GetCustomVariantSetUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsNode, GetCustomVariantSetUidCount, "InterchangeSceneVariantSetsNode", "GetCustomVariantSetUidCount", SDK::Params::InterchangeSceneVariantSetsNode_GetCustomVariantSetUidCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneVariantSetsNode, GetCustomVariantSetUids, "InterchangeSceneVariantSetsNode", "GetCustomVariantSetUids", SDK::Params::InterchangeSceneVariantSetsNode_GetCustomVariantSetUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, AddScalarParameterValue, "InterchangeMaterialInstanceNode", "AddScalarParameterValue", SDK::Params::InterchangeMaterialInstanceNode_AddScalarParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, AddStaticSwitchParameterValue, "InterchangeMaterialInstanceNode", "AddStaticSwitchParameterValue", SDK::Params::InterchangeMaterialInstanceNode_AddStaticSwitchParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, AddTextureParameterValue, "InterchangeMaterialInstanceNode", "AddTextureParameterValue", SDK::Params::InterchangeMaterialInstanceNode_AddTextureParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, AddVectorParameterValue, "InterchangeMaterialInstanceNode", "AddVectorParameterValue", SDK::Params::InterchangeMaterialInstanceNode_AddVectorParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, GetCustomParent, "InterchangeMaterialInstanceNode", "GetCustomParent", SDK::Params::InterchangeMaterialInstanceNode_GetCustomParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, GetScalarParameterValue, "InterchangeMaterialInstanceNode", "GetScalarParameterValue", SDK::Params::InterchangeMaterialInstanceNode_GetScalarParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, GetStaticSwitchParameterValue, "InterchangeMaterialInstanceNode", "GetStaticSwitchParameterValue", SDK::Params::InterchangeMaterialInstanceNode_GetStaticSwitchParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, GetTextureParameterValue, "InterchangeMaterialInstanceNode", "GetTextureParameterValue", SDK::Params::InterchangeMaterialInstanceNode_GetTextureParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, GetVectorParameterValue, "InterchangeMaterialInstanceNode", "GetVectorParameterValue", SDK::Params::InterchangeMaterialInstanceNode_GetVectorParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMaterialInstanceNode, SetCustomParent, "InterchangeMaterialInstanceNode", "SetCustomParent", SDK::Params::InterchangeMaterialInstanceNode_SetCustomParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, RemoveMorphTargetDependencyUid, "InterchangeMeshNode", "RemoveMorphTargetDependencyUid", SDK::Params::InterchangeMeshNode_RemoveMorphTargetDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, RemoveSceneInstanceUid, "InterchangeMeshNode", "RemoveSceneInstanceUid", SDK::Params::InterchangeMeshNode_RemoveSceneInstanceUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, RemoveSkeletonDependencyUid, "InterchangeMeshNode", "RemoveSkeletonDependencyUid", SDK::Params::InterchangeMeshNode_RemoveSkeletonDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, RemoveSlotMaterialDependencyUid, "InterchangeMeshNode", "RemoveSlotMaterialDependencyUid", SDK::Params::InterchangeMeshNode_RemoveSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomBoundingBox, "InterchangeMeshNode", "SetCustomBoundingBox", SDK::Params::InterchangeMeshNode_SetCustomBoundingBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomHasSmoothGroup, "InterchangeMeshNode", "SetCustomHasSmoothGroup", SDK::Params::InterchangeMeshNode_SetCustomHasSmoothGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomHasVertexBinormal, "InterchangeMeshNode", "SetCustomHasVertexBinormal", SDK::Params::InterchangeMeshNode_SetCustomHasVertexBinormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomHasVertexColor, "InterchangeMeshNode", "SetCustomHasVertexColor", SDK::Params::InterchangeMeshNode_SetCustomHasVertexColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomHasVertexNormal, "InterchangeMeshNode", "SetCustomHasVertexNormal", SDK::Params::InterchangeMeshNode_SetCustomHasVertexNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomHasVertexTangent, "InterchangeMeshNode", "SetCustomHasVertexTangent", SDK::Params::InterchangeMeshNode_SetCustomHasVertexTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomPolygonCount, "InterchangeMeshNode", "SetCustomPolygonCount", SDK::Params::InterchangeMeshNode_SetCustomPolygonCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomUVCount, "InterchangeMeshNode", "SetCustomUVCount", SDK::Params::InterchangeMeshNode_SetCustomUVCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetCustomVertexCount, "InterchangeMeshNode", "SetCustomVertexCount", SDK::Params::InterchangeMeshNode_SetCustomVertexCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetMorphTarget, "InterchangeMeshNode", "SetMorphTarget", SDK::Params::InterchangeMeshNode_SetMorphTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetMorphTargetDependencyUid, "InterchangeMeshNode", "SetMorphTargetDependencyUid", SDK::Params::InterchangeMeshNode_SetMorphTargetDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetMorphTargetName, "InterchangeMeshNode", "SetMorphTargetName", SDK::Params::InterchangeMeshNode_SetMorphTargetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetPayLoadKey, "InterchangeMeshNode", "SetPayLoadKey", SDK::Params::InterchangeMeshNode_SetPayLoadKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetSceneInstanceUid, "InterchangeMeshNode", "SetSceneInstanceUid", SDK::Params::InterchangeMeshNode_SetSceneInstanceUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetSkeletonDependencyUid, "InterchangeMeshNode", "SetSkeletonDependencyUid", SDK::Params::InterchangeMeshNode_SetSkeletonDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetSkinnedMesh, "InterchangeMeshNode", "SetSkinnedMesh", SDK::Params::InterchangeMeshNode_SetSkinnedMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, SetSlotMaterialDependencyUid, "InterchangeMeshNode", "SetSlotMaterialDependencyUid", SDK::Params::InterchangeMeshNode_SetSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomBoundingBox, "InterchangeMeshNode", "GetCustomBoundingBox", SDK::Params::InterchangeMeshNode_GetCustomBoundingBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomHasSmoothGroup, "InterchangeMeshNode", "GetCustomHasSmoothGroup", SDK::Params::InterchangeMeshNode_GetCustomHasSmoothGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomHasVertexBinormal, "InterchangeMeshNode", "GetCustomHasVertexBinormal", SDK::Params::InterchangeMeshNode_GetCustomHasVertexBinormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomHasVertexColor, "InterchangeMeshNode", "GetCustomHasVertexColor", SDK::Params::InterchangeMeshNode_GetCustomHasVertexColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomHasVertexNormal, "InterchangeMeshNode", "GetCustomHasVertexNormal", SDK::Params::InterchangeMeshNode_GetCustomHasVertexNormal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomHasVertexTangent, "InterchangeMeshNode", "GetCustomHasVertexTangent", SDK::Params::InterchangeMeshNode_GetCustomHasVertexTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomPolygonCount, "InterchangeMeshNode", "GetCustomPolygonCount", SDK::Params::InterchangeMeshNode_GetCustomPolygonCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomUVCount, "InterchangeMeshNode", "GetCustomUVCount", SDK::Params::InterchangeMeshNode_GetCustomUVCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetCustomVertexCount, "InterchangeMeshNode", "GetCustomVertexCount", SDK::Params::InterchangeMeshNode_GetCustomVertexCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetMorphTargetDependeciesCount, "InterchangeMeshNode", "GetMorphTargetDependeciesCount", SDK::Params::InterchangeMeshNode_GetMorphTargetDependeciesCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetMorphTargetDependencies, "InterchangeMeshNode", "GetMorphTargetDependencies", SDK::Params::InterchangeMeshNode_GetMorphTargetDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetMorphTargetDependency, "InterchangeMeshNode", "GetMorphTargetDependency", SDK::Params::InterchangeMeshNode_GetMorphTargetDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetMorphTargetName, "InterchangeMeshNode", "GetMorphTargetName", SDK::Params::InterchangeMeshNode_GetMorphTargetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetSceneInstanceUid, "InterchangeMeshNode", "GetSceneInstanceUid", SDK::Params::InterchangeMeshNode_GetSceneInstanceUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetSceneInstanceUids, "InterchangeMeshNode", "GetSceneInstanceUids", SDK::Params::InterchangeMeshNode_GetSceneInstanceUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetSceneInstanceUidsCount, "InterchangeMeshNode", "GetSceneInstanceUidsCount", SDK::Params::InterchangeMeshNode_GetSceneInstanceUidsCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetSkeletonDependeciesCount, "InterchangeMeshNode", "GetSkeletonDependeciesCount", SDK::Params::InterchangeMeshNode_GetSkeletonDependeciesCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetSkeletonDependencies, "InterchangeMeshNode", "GetSkeletonDependencies", SDK::Params::InterchangeMeshNode_GetSkeletonDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetSkeletonDependency, "InterchangeMeshNode", "GetSkeletonDependency", SDK::Params::InterchangeMeshNode_GetSkeletonDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetSlotMaterialDependencies, "InterchangeMeshNode", "GetSlotMaterialDependencies", SDK::Params::InterchangeMeshNode_GetSlotMaterialDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, GetSlotMaterialDependencyUid, "InterchangeMeshNode", "GetSlotMaterialDependencyUid", SDK::Params::InterchangeMeshNode_GetSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, IsMorphTarget, "InterchangeMeshNode", "IsMorphTarget", SDK::Params::InterchangeMeshNode_IsMorphTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeMeshNode, IsSkinnedMesh, "InterchangeMeshNode", "IsSkinnedMesh", SDK::Params::InterchangeMeshNode_IsSkinnedMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, AddSpecializedType, "InterchangeSceneNode", "AddSpecializedType", SDK::Params::InterchangeSceneNode_AddSpecializedType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, RemoveSlotMaterialDependencyUid, "InterchangeSceneNode", "RemoveSlotMaterialDependencyUid", SDK::Params::InterchangeSceneNode_RemoveSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, RemoveSpecializedType, "InterchangeSceneNode", "RemoveSpecializedType", SDK::Params::InterchangeSceneNode_RemoveSpecializedType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, SetCustomAnimationAssetUidToPlay, "InterchangeSceneNode", "SetCustomAnimationAssetUidToPlay", SDK::Params::InterchangeSceneNode_SetCustomAnimationAssetUidToPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, SetCustomAssetInstanceUid, "InterchangeSceneNode", "SetCustomAssetInstanceUid", SDK::Params::InterchangeSceneNode_SetCustomAssetInstanceUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, SetCustomBindPoseLocalTransform, "InterchangeSceneNode", "SetCustomBindPoseLocalTransform", SDK::Params::InterchangeSceneNode_SetCustomBindPoseLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, SetCustomGeometricTransform, "InterchangeSceneNode", "SetCustomGeometricTransform", SDK::Params::InterchangeSceneNode_SetCustomGeometricTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, SetCustomLocalTransform, "InterchangeSceneNode", "SetCustomLocalTransform", SDK::Params::InterchangeSceneNode_SetCustomLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, SetCustomTimeZeroLocalTransform, "InterchangeSceneNode", "SetCustomTimeZeroLocalTransform", SDK::Params::InterchangeSceneNode_SetCustomTimeZeroLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, SetMorphTargetCurveWeight, "InterchangeSceneNode", "SetMorphTargetCurveWeight", SDK::Params::InterchangeSceneNode_SetMorphTargetCurveWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, SetSlotMaterialDependencyUid, "InterchangeSceneNode", "SetSlotMaterialDependencyUid", SDK::Params::InterchangeSceneNode_SetSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomAnimationAssetUidToPlay, "InterchangeSceneNode", "GetCustomAnimationAssetUidToPlay", SDK::Params::InterchangeSceneNode_GetCustomAnimationAssetUidToPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomAssetInstanceUid, "InterchangeSceneNode", "GetCustomAssetInstanceUid", SDK::Params::InterchangeSceneNode_GetCustomAssetInstanceUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomBindPoseGlobalTransform, "InterchangeSceneNode", "GetCustomBindPoseGlobalTransform", SDK::Params::InterchangeSceneNode_GetCustomBindPoseGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomBindPoseLocalTransform, "InterchangeSceneNode", "GetCustomBindPoseLocalTransform", SDK::Params::InterchangeSceneNode_GetCustomBindPoseLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomGeometricTransform, "InterchangeSceneNode", "GetCustomGeometricTransform", SDK::Params::InterchangeSceneNode_GetCustomGeometricTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomGlobalTransform, "InterchangeSceneNode", "GetCustomGlobalTransform", SDK::Params::InterchangeSceneNode_GetCustomGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomLocalTransform, "InterchangeSceneNode", "GetCustomLocalTransform", SDK::Params::InterchangeSceneNode_GetCustomLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomTimeZeroGlobalTransform, "InterchangeSceneNode", "GetCustomTimeZeroGlobalTransform", SDK::Params::InterchangeSceneNode_GetCustomTimeZeroGlobalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetCustomTimeZeroLocalTransform, "InterchangeSceneNode", "GetCustomTimeZeroLocalTransform", SDK::Params::InterchangeSceneNode_GetCustomTimeZeroLocalTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetMorphTargetCurveWeights, "InterchangeSceneNode", "GetMorphTargetCurveWeights", SDK::Params::InterchangeSceneNode_GetMorphTargetCurveWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetSlotMaterialDependencies, "InterchangeSceneNode", "GetSlotMaterialDependencies", SDK::Params::InterchangeSceneNode_GetSlotMaterialDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetSlotMaterialDependencyUid, "InterchangeSceneNode", "GetSlotMaterialDependencyUid", SDK::Params::InterchangeSceneNode_GetSlotMaterialDependencyUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetSpecializedType, "InterchangeSceneNode", "GetSpecializedType", SDK::Params::InterchangeSceneNode_GetSpecializedType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetSpecializedTypeCount, "InterchangeSceneNode", "GetSpecializedTypeCount", SDK::Params::InterchangeSceneNode_GetSpecializedTypeCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, GetSpecializedTypes, "InterchangeSceneNode", "GetSpecializedTypes", SDK::Params::InterchangeSceneNode_GetSpecializedTypes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeSceneNode, IsSpecializedTypeContains, "InterchangeSceneNode", "IsSpecializedTypeContains", SDK::Params::InterchangeSceneNode_IsSpecializedTypeContains)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, ConnectDefaultOuputToInput, "InterchangeShaderPortsAPI", "ConnectDefaultOuputToInput", SDK::Params::InterchangeShaderPortsAPI_ConnectDefaultOuputToInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, ConnectOuputToInputByIndex, "InterchangeShaderPortsAPI", "ConnectOuputToInputByIndex", SDK::Params::InterchangeShaderPortsAPI_ConnectOuputToInputByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, ConnectOuputToInputByName, "InterchangeShaderPortsAPI", "ConnectOuputToInputByName", SDK::Params::InterchangeShaderPortsAPI_ConnectOuputToInputByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, GatherInputs, "InterchangeShaderPortsAPI", "GatherInputs", SDK::Params::InterchangeShaderPortsAPI_GatherInputs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, GetInputConnection, "InterchangeShaderPortsAPI", "GetInputConnection", SDK::Params::InterchangeShaderPortsAPI_GetInputConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, HasInput, "InterchangeShaderPortsAPI", "HasInput", SDK::Params::InterchangeShaderPortsAPI_HasInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, HasParameter, "InterchangeShaderPortsAPI", "HasParameter", SDK::Params::InterchangeShaderPortsAPI_HasParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, IsAnInput, "InterchangeShaderPortsAPI", "IsAnInput", SDK::Params::InterchangeShaderPortsAPI_IsAnInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, IsAParameter, "InterchangeShaderPortsAPI", "IsAParameter", SDK::Params::InterchangeShaderPortsAPI_IsAParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, MakeInputConnectionKey, "InterchangeShaderPortsAPI", "MakeInputConnectionKey", SDK::Params::InterchangeShaderPortsAPI_MakeInputConnectionKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, MakeInputName, "InterchangeShaderPortsAPI", "MakeInputName", SDK::Params::InterchangeShaderPortsAPI_MakeInputName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, MakeInputParameterKey, "InterchangeShaderPortsAPI", "MakeInputParameterKey", SDK::Params::InterchangeShaderPortsAPI_MakeInputParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderPortsAPI, MakeInputValueKey, "InterchangeShaderPortsAPI", "MakeInputValueKey", SDK::Params::InterchangeShaderPortsAPI_MakeInputValueKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFunctionCallShaderNode, SetCustomMaterialFunction, "InterchangeFunctionCallShaderNode", "SetCustomMaterialFunction", SDK::Params::InterchangeFunctionCallShaderNode_SetCustomMaterialFunction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeFunctionCallShaderNode, GetCustomMaterialFunction, "InterchangeFunctionCallShaderNode", "GetCustomMaterialFunction", SDK::Params::InterchangeFunctionCallShaderNode_GetCustomMaterialFunction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, SetCustomBlendMode, "InterchangeShaderGraphNode", "SetCustomBlendMode", SDK::Params::InterchangeShaderGraphNode_SetCustomBlendMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, SetCustomIsAShaderFunction, "InterchangeShaderGraphNode", "SetCustomIsAShaderFunction", SDK::Params::InterchangeShaderGraphNode_SetCustomIsAShaderFunction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, SetCustomOpacityMaskClipValue, "InterchangeShaderGraphNode", "SetCustomOpacityMaskClipValue", SDK::Params::InterchangeShaderGraphNode_SetCustomOpacityMaskClipValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, SetCustomScreenSpaceReflections, "InterchangeShaderGraphNode", "SetCustomScreenSpaceReflections", SDK::Params::InterchangeShaderGraphNode_SetCustomScreenSpaceReflections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, SetCustomTwoSided, "InterchangeShaderGraphNode", "SetCustomTwoSided", SDK::Params::InterchangeShaderGraphNode_SetCustomTwoSided)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, SetCustomTwoSidedTransmission, "InterchangeShaderGraphNode", "SetCustomTwoSidedTransmission", SDK::Params::InterchangeShaderGraphNode_SetCustomTwoSidedTransmission)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, GetCustomBlendMode, "InterchangeShaderGraphNode", "GetCustomBlendMode", SDK::Params::InterchangeShaderGraphNode_GetCustomBlendMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, GetCustomIsAShaderFunction, "InterchangeShaderGraphNode", "GetCustomIsAShaderFunction", SDK::Params::InterchangeShaderGraphNode_GetCustomIsAShaderFunction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, GetCustomOpacityMaskClipValue, "InterchangeShaderGraphNode", "GetCustomOpacityMaskClipValue", SDK::Params::InterchangeShaderGraphNode_GetCustomOpacityMaskClipValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, GetCustomScreenSpaceReflections, "InterchangeShaderGraphNode", "GetCustomScreenSpaceReflections", SDK::Params::InterchangeShaderGraphNode_GetCustomScreenSpaceReflections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, GetCustomTwoSided, "InterchangeShaderGraphNode", "GetCustomTwoSided", SDK::Params::InterchangeShaderGraphNode_GetCustomTwoSided)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeShaderGraphNode, GetCustomTwoSidedTransmission, "InterchangeShaderGraphNode", "GetCustomTwoSidedTransmission", SDK::Params::InterchangeShaderGraphNode_GetCustomTwoSidedTransmission)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DNode, SetCustomWrapU, "InterchangeTexture2DNode", "SetCustomWrapU", SDK::Params::InterchangeTexture2DNode_SetCustomWrapU)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DNode, SetCustomWrapV, "InterchangeTexture2DNode", "SetCustomWrapV", SDK::Params::InterchangeTexture2DNode_SetCustomWrapV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DNode, GetCustomWrapU, "InterchangeTexture2DNode", "GetCustomWrapU", SDK::Params::InterchangeTexture2DNode_GetCustomWrapU)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DNode, GetCustomWrapV, "InterchangeTexture2DNode", "GetCustomWrapV", SDK::Params::InterchangeTexture2DNode_GetCustomWrapV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangeTexture2DNode, GetSourceBlocks, "InterchangeTexture2DNode", "GetSourceBlocks", SDK::Params::InterchangeTexture2DNode_GetSourceBlocks)
+// clang-format on
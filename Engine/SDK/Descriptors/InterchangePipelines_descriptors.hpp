@@ -0,0 +1,28 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from InterchangePipelines_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/InterchangePipelines_classes.hpp"
+#include "../SDK/InterchangePipelines_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, CreateInterchangePipelineMeshesUtilities, "InterchangePipelineMeshesUtilities", "CreateInterchangePipelineMeshesUtilities", SDK::Params::InterchangePipelineMeshesUtilities_CreateInterchangePipelineMeshesUtilities)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetAllMeshGeometry, "InterchangePipelineMeshesUtilities", "GetAllMeshGeometry", SDK::Params::InterchangePipelineMeshesUtilities_GetAllMeshGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetAllMeshGeometryNotInstanced, "InterchangePipelineMeshesUtilities", "GetAllMeshGeometryNotInstanced", SDK::Params::InterchangePipelineMeshesUtilities_GetAllMeshGeometryNotInstanced)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetAllMeshInstanceUids, "InterchangePipelineMeshesUtilities", "GetAllMeshInstanceUids", SDK::Params::InterchangePipelineMeshesUtilities_GetAllMeshInstanceUids)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetAllMeshInstanceUidsUsingMeshGeometryUid, "InterchangePipelineMeshesUtilities", "GetAllMeshInstanceUidsUsingMeshGeometryUid", SDK::Params::InterchangePipelineMeshesUtilities_GetAllMeshInstanceUidsUsingMeshGeometryUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetAllSkinnedMeshGeometry, "InterchangePipelineMeshesUtilities", "GetAllSkinnedMeshGeometry", SDK::Params::InterchangePipelineMeshesUtilities_GetAllSkinnedMeshGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetAllSkinnedMeshInstance, "InterchangePipelineMeshesUtilities", "GetAllSkinnedMeshInstance", SDK::Params::InterchangePipelineMeshesUtilities_GetAllSkinnedMeshInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetAllStaticMeshGeometry, "InterchangePipelineMeshesUtilities", "GetAllStaticMeshGeometry", SDK::Params::InterchangePipelineMeshesUtilities_GetAllStaticMeshGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetAllStaticMeshInstance, "InterchangePipelineMeshesUtilities", "GetAllStaticMeshInstance", SDK::Params::InterchangePipelineMeshesUtilities_GetAllStaticMeshInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetMeshGeometryByUid, "InterchangePipelineMeshesUtilities", "GetMeshGeometryByUid", SDK::Params::InterchangePipelineMeshesUtilities_GetMeshGeometryByUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetMeshGeometrySkeletonRootUid, "InterchangePipelineMeshesUtilities", "GetMeshGeometrySkeletonRootUid", SDK::Params::InterchangePipelineMeshesUtilities_GetMeshGeometrySkeletonRootUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetMeshInstanceByUid, "InterchangePipelineMeshesUtilities", "GetMeshInstanceByUid", SDK::Params::InterchangePipelineMeshesUtilities_GetMeshInstanceByUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, GetMeshInstanceSkeletonRootUid, "InterchangePipelineMeshesUtilities", "GetMeshInstanceSkeletonRootUid", SDK::Params::InterchangePipelineMeshesUtilities_GetMeshInstanceSkeletonRootUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, IsValidMeshGeometryUid, "InterchangePipelineMeshesUtilities", "IsValidMeshGeometryUid", SDK::Params::InterchangePipelineMeshesUtilities_IsValidMeshGeometryUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, IsValidMeshInstanceUid, "InterchangePipelineMeshesUtilities", "IsValidMeshInstanceUid", SDK::Params::InterchangePipelineMeshesUtilities_IsValidMeshInstanceUid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInterchangePipelineMeshesUtilities, SetContext, "InterchangePipelineMeshesUtilities", "SetContext", SDK::Params::InterchangePipelineMeshesUtilities_SetContext)
+// clang-format on
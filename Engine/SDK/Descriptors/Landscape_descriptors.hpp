@@ -0,0 +1,38 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Landscape_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Landscape_classes.hpp"
+#include "../SDK/Landscape_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, ChangeComponentScreenSizeToUseSubSections, "LandscapeProxy", "ChangeComponentScreenSizeToUseSubSections", SDK::Params::LandscapeProxy_ChangeComponentScreenSizeToUseSubSections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, ChangeLODDistanceFactor, "LandscapeProxy", "ChangeLODDistanceFactor", SDK::Params::LandscapeProxy_ChangeLODDistanceFactor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, EditorApplySpline, "LandscapeProxy", "EditorApplySpline", SDK::Params::LandscapeProxy_EditorApplySpline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, EditorSetLandscapeMaterial, "LandscapeProxy", "EditorSetLandscapeMaterial", SDK::Params::LandscapeProxy_EditorSetLandscapeMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, GetLandscapeActor, "LandscapeProxy", "GetLandscapeActor", SDK::Params::LandscapeProxy_GetLandscapeActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, LandscapeExportHeightmapToRenderTarget, "LandscapeProxy", "LandscapeExportHeightmapToRenderTarget", SDK::Params::LandscapeProxy_LandscapeExportHeightmapToRenderTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, SetLandscapeMaterialScalarParameterValue, "LandscapeProxy", "SetLandscapeMaterialScalarParameterValue", SDK::Params::LandscapeProxy_SetLandscapeMaterialScalarParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, SetLandscapeMaterialTextureParameterValue, "LandscapeProxy", "SetLandscapeMaterialTextureParameterValue", SDK::Params::LandscapeProxy_SetLandscapeMaterialTextureParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, SetLandscapeMaterialVectorParameterValue, "LandscapeProxy", "SetLandscapeMaterialVectorParameterValue", SDK::Params::LandscapeProxy_SetLandscapeMaterialVectorParameterValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeProxy, SetVirtualTextureRenderPassType, "LandscapeProxy", "SetVirtualTextureRenderPassType", SDK::Params::LandscapeProxy_SetVirtualTextureRenderPassType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscape, RenderHeightmap, "Landscape", "RenderHeightmap", SDK::Params::Landscape_RenderHeightmap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscape, RenderWeightmap, "Landscape", "RenderWeightmap", SDK::Params::Landscape_RenderWeightmap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscape, RenderWeightmaps, "Landscape", "RenderWeightmaps", SDK::Params::Landscape_RenderWeightmaps)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscape, GetTargetLayerNames, "Landscape", "GetTargetLayerNames", SDK::Params::Landscape_GetTargetLayerNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULandscapeComponent, EditorGetPaintLayerWeightAtLocation, "LandscapeComponent", "EditorGetPaintLayerWeightAtLocation", SDK::Params::LandscapeComponent_EditorGetPaintLayerWeightAtLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULandscapeComponent, EditorGetPaintLayerWeightByNameAtLocation, "LandscapeComponent", "EditorGetPaintLayerWeightByNameAtLocation", SDK::Params::LandscapeComponent_EditorGetPaintLayerWeightByNameAtLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULandscapeComponent, SetForcedLOD, "LandscapeComponent", "SetForcedLOD", SDK::Params::LandscapeComponent_SetForcedLOD)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULandscapeComponent, SetLODBias, "LandscapeComponent", "SetLODBias", SDK::Params::LandscapeComponent_SetLODBias)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULandscapeComponent, GetMaterialInstanceDynamic, "LandscapeComponent", "GetMaterialInstanceDynamic", SDK::Params::LandscapeComponent_GetMaterialInstanceDynamic)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULandscapeHeightfieldCollisionComponent, GetRenderComponent, "LandscapeHeightfieldCollisionComponent", "GetRenderComponent", SDK::Params::LandscapeHeightfieldCollisionComponent_GetRenderComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULandscapeSplinesComponent, GetSplineMeshComponents, "LandscapeSplinesComponent", "GetSplineMeshComponents", SDK::Params::LandscapeSplinesComponent_GetSplineMeshComponents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeBlueprintBrushBase, GetBlueprintRenderDependencies, "LandscapeBlueprintBrushBase", "GetBlueprintRenderDependencies", SDK::Params::LandscapeBlueprintBrushBase_GetBlueprintRenderDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeBlueprintBrushBase, Initialize, "LandscapeBlueprintBrushBase", "Initialize", SDK::Params::LandscapeBlueprintBrushBase_Initialize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeBlueprintBrushBase, Render, "LandscapeBlueprintBrushBase", "Render", SDK::Params::LandscapeBlueprintBrushBase_Render)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeBlueprintBrushBase, RenderLayer, "LandscapeBlueprintBrushBase", "RenderLayer", SDK::Params::LandscapeBlueprintBrushBase_RenderLayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALandscapeBlueprintBrushBase, RequestLandscapeUpdate, "LandscapeBlueprintBrushBase", "RequestLandscapeUpdate", SDK::Params::LandscapeBlueprintBrushBase_RequestLandscapeUpdate)
+// clang-format on
@@ -0,0 +1,51 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from LevelSequence_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/LevelSequence_classes.hpp"
+#include "../SDK/LevelSequence_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequence, CopyMetaData, "LevelSequence", "CopyMetaData", SDK::Params::LevelSequence_CopyMetaData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequence, FindOrAddMetaDataByClass, "LevelSequence", "FindOrAddMetaDataByClass", SDK::Params::LevelSequence_FindOrAddMetaDataByClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequence, RemoveMetaDataByClass, "LevelSequence", "RemoveMetaDataByClass", SDK::Params::LevelSequence_RemoveMetaDataByClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequence, FindMetaDataByClass, "LevelSequence", "FindMetaDataByClass", SDK::Params::LevelSequence_FindMetaDataByClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceBurnInOptions, SetBurnIn, "LevelSequenceBurnInOptions", "SetBurnIn", SDK::Params::LevelSequenceBurnInOptions_SetBurnIn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, AddBinding, "LevelSequenceActor", "AddBinding", SDK::Params::LevelSequenceActor_AddBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, AddBindingByTag, "LevelSequenceActor", "AddBindingByTag", SDK::Params::LevelSequenceActor_AddBindingByTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, HideBurnin, "LevelSequenceActor", "HideBurnin", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, RemoveBinding, "LevelSequenceActor", "RemoveBinding", SDK::Params::LevelSequenceActor_RemoveBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, RemoveBindingByTag, "LevelSequenceActor", "RemoveBindingByTag", SDK::Params::LevelSequenceActor_RemoveBindingByTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, ResetBinding, "LevelSequenceActor", "ResetBinding", SDK::Params::LevelSequenceActor_ResetBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, ResetBindings, "LevelSequenceActor", "ResetBindings", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, SetBinding, "LevelSequenceActor", "SetBinding", SDK::Params::LevelSequenceActor_SetBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, SetBindingByTag, "LevelSequenceActor", "SetBindingByTag", SDK::Params::LevelSequenceActor_SetBindingByTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, SetReplicatePlayback, "LevelSequenceActor", "SetReplicatePlayback", SDK::Params::LevelSequenceActor_SetReplicatePlayback)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, SetSequence, "LevelSequenceActor", "SetSequence", SDK::Params::LevelSequenceActor_SetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, ShowBurnin, "LevelSequenceActor", "ShowBurnin", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, FindNamedBinding, "LevelSequenceActor", "FindNamedBinding", SDK::Params::LevelSequenceActor_FindNamedBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, FindNamedBindings, "LevelSequenceActor", "FindNamedBindings", SDK::Params::LevelSequenceActor_FindNamedBindings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, GetSequence, "LevelSequenceActor", "GetSequence", SDK::Params::LevelSequenceActor_GetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceActor, GetSequencePlayer, "LevelSequenceActor", "GetSequencePlayer", SDK::Params::LevelSequenceActor_GetSequencePlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceBurnIn, SetSettings, "LevelSequenceBurnIn", "SetSettings", SDK::Params::LevelSequenceBurnIn_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceBurnIn, GetSettingsClass, "LevelSequenceBurnIn", "GetSettingsClass", SDK::Params::LevelSequenceBurnIn_GetSettingsClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, GetBoundActor, "LevelSequenceDirector", "GetBoundActor", SDK::Params::LevelSequenceDirector_GetBoundActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, GetBoundActors, "LevelSequenceDirector", "GetBoundActors", SDK::Params::LevelSequenceDirector_GetBoundActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, GetBoundObject, "LevelSequenceDirector", "GetBoundObject", SDK::Params::LevelSequenceDirector_GetBoundObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, GetBoundObjects, "LevelSequenceDirector", "GetBoundObjects", SDK::Params::LevelSequenceDirector_GetBoundObjects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, GetSequence, "LevelSequenceDirector", "GetSequence", SDK::Params::LevelSequenceDirector_GetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, OnCreated, "LevelSequenceDirector", "OnCreated", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, GetCurrentTime, "LevelSequenceDirector", "GetCurrentTime", SDK::Params::LevelSequenceDirector_GetCurrentTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, GetMasterSequenceTime, "LevelSequenceDirector", "GetMasterSequenceTime", SDK::Params::LevelSequenceDirector_GetMasterSequenceTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequenceDirector, GetRootSequenceTime, "LevelSequenceDirector", "GetRootSequenceTime", SDK::Params::LevelSequenceDirector_GetRootSequenceTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequencePlayer, CreateLevelSequencePlayer, "LevelSequencePlayer", "CreateLevelSequencePlayer", SDK::Params::LevelSequencePlayer_CreateLevelSequencePlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelSequencePlayer, GetActiveCameraComponent, "LevelSequencePlayer", "GetActiveCameraComponent", SDK::Params::LevelSequencePlayer_GetActiveCameraComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceMediaController, OnRep_ServerStartTimeSeconds, "LevelSequenceMediaController", "OnRep_ServerStartTimeSeconds", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceMediaController, Play, "LevelSequenceMediaController", "Play", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceMediaController, SynchronizeToServer, "LevelSequenceMediaController", "SynchronizeToServer", SDK::Params::LevelSequenceMediaController_SynchronizeToServer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceMediaController, GetMediaComponent, "LevelSequenceMediaController", "GetMediaComponent", SDK::Params::LevelSequenceMediaController_GetMediaComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelSequenceMediaController, GetSequence, "LevelSequenceMediaController", "GetSequence", SDK::Params::LevelSequenceMediaController_GetSequence)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from LocalizableMessageBlueprint_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/LocalizableMessageBlueprint_classes.hpp"
+#include "../SDK/LocalizableMessageBlueprint_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocalizableMessageLibrary, Conv_LocalizableMessageToText, "LocalizableMessageLibrary", "Conv_LocalizableMessageToText", SDK::Params::LocalizableMessageLibrary_Conv_LocalizableMessageToText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocalizableMessageLibrary, IsEmpty_LocalizableMessage, "LocalizableMessageLibrary", "IsEmpty_LocalizableMessage", SDK::Params::LocalizableMessageLibrary_IsEmpty_LocalizableMessage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocalizableMessageLibrary, Reset_LocalizableMessage, "LocalizableMessageLibrary", "Reset_LocalizableMessage", SDK::Params::LocalizableMessageLibrary_Reset_LocalizableMessage)
+// clang-format on
@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from LocationServicesBPLibrary_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/LocationServicesBPLibrary_classes.hpp"
+#include "../SDK/LocationServicesBPLibrary_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocationServices, AreLocationServicesEnabled, "LocationServices", "AreLocationServicesEnabled", SDK::Params::LocationServices_AreLocationServicesEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocationServices, GetLastKnownLocation, "LocationServices", "GetLastKnownLocation", SDK::Params::LocationServices_GetLastKnownLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocationServices, GetLocationServicesImpl, "LocationServices", "GetLocationServicesImpl", SDK::Params::LocationServices_GetLocationServicesImpl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocationServices, InitLocationServices, "LocationServices", "InitLocationServices", SDK::Params::LocationServices_InitLocationServices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocationServices, IsLocationAccuracyAvailable, "LocationServices", "IsLocationAccuracyAvailable", SDK::Params::LocationServices_IsLocationAccuracyAvailable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocationServices, StartLocationServices, "LocationServices", "StartLocationServices", SDK::Params::LocationServices_StartLocationServices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULocationServices, StopLocationServices, "LocationServices", "StopLocationServices", SDK::Params::LocationServices_StopLocationServices)
+// clang-format on
@@ -0,0 +1,32 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MRMesh_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MRMesh_classes.hpp"
+#include "../SDK/MRMesh_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMockDataMeshTrackerComponent, ConnectMRMesh, "MockDataMeshTrackerComponent", "ConnectMRMesh", SDK::Params::MockDataMeshTrackerComponent_ConnectMRMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMockDataMeshTrackerComponent, DisconnectMRMesh, "MockDataMeshTrackerComponent", "DisconnectMRMesh", SDK::Params::MockDataMeshTrackerComponent_DisconnectMRMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, Clear, "MRMeshComponent", "Clear", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, ForceNavMeshUpdate, "MRMeshComponent", "ForceNavMeshUpdate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, RequestNavMeshUpdate, "MRMeshComponent", "RequestNavMeshUpdate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, SetEnableMeshOcclusion, "MRMeshComponent", "SetEnableMeshOcclusion", SDK::Params::MRMeshComponent_SetEnableMeshOcclusion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, SetUseWireframe, "MRMeshComponent", "SetUseWireframe", SDK::Params::MRMeshComponent_SetUseWireframe)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, SetWireframeColor, "MRMeshComponent", "SetWireframeColor", SDK::Params::MRMeshComponent_SetWireframeColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, SetWireframeMaterial, "MRMeshComponent", "SetWireframeMaterial", SDK::Params::MRMeshComponent_SetWireframeMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, GetEnableMeshOcclusion, "MRMeshComponent", "GetEnableMeshOcclusion", SDK::Params::MRMeshComponent_GetEnableMeshOcclusion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, GetUseWireframe, "MRMeshComponent", "GetUseWireframe", SDK::Params::MRMeshComponent_GetUseWireframe)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, GetWireframeColor, "MRMeshComponent", "GetWireframeColor", SDK::Params::MRMeshComponent_GetWireframeColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMRMeshComponent, IsConnected, "MRMeshComponent", "IsConnected", SDK::Params::MRMeshComponent_IsConnected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshReconstructorBase, ConnectMRMesh, "MeshReconstructorBase", "ConnectMRMesh", SDK::Params::MeshReconstructorBase_ConnectMRMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshReconstructorBase, DisconnectMRMesh, "MeshReconstructorBase", "DisconnectMRMesh", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshReconstructorBase, PauseReconstruction, "MeshReconstructorBase", "PauseReconstruction", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshReconstructorBase, StartReconstruction, "MeshReconstructorBase", "StartReconstruction", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshReconstructorBase, StopReconstruction, "MeshReconstructorBase", "StopReconstruction", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshReconstructorBase, IsReconstructionPaused, "MeshReconstructorBase", "IsReconstructionPaused", SDK::Params::MeshReconstructorBase_IsReconstructionPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshReconstructorBase, IsReconstructionStarted, "MeshReconstructorBase", "IsReconstructionStarted", SDK::Params::MeshReconstructorBase_IsReconstructionStarted)
+// clang-format on
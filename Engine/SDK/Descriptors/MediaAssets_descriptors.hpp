@@ -0,0 +1,131 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MediaAssets_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MediaAssets_classes.hpp"
+#include "../SDK/MediaAssets_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, CanPlaySource, "MediaPlayer", "CanPlaySource", SDK::Params::MediaPlayer_CanPlaySource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, CanPlayUrl, "MediaPlayer", "CanPlayUrl", SDK::Params::MediaPlayer_CanPlayUrl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, Close, "MediaPlayer", "Close", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetPlaybackTimeRange, "MediaPlayer", "GetPlaybackTimeRange", SDK::Params::MediaPlayer_GetPlaybackTimeRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, Next, "MediaPlayer", "Next", SDK::Params::MediaPlayer_Next)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, OpenFile, "MediaPlayer", "OpenFile", SDK::Params::MediaPlayer_OpenFile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, OpenPlaylist, "MediaPlayer", "OpenPlaylist", SDK::Params::MediaPlayer_OpenPlaylist)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, OpenPlaylistIndex, "MediaPlayer", "OpenPlaylistIndex", SDK::Params::MediaPlayer_OpenPlaylistIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, OpenSource, "MediaPlayer", "OpenSource", SDK::Params::MediaPlayer_OpenSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, OpenSourceLatent, "MediaPlayer", "OpenSourceLatent", SDK::Params::MediaPlayer_OpenSourceLatent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, OpenSourceWithOptions, "MediaPlayer", "OpenSourceWithOptions", SDK::Params::MediaPlayer_OpenSourceWithOptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, OpenUrl, "MediaPlayer", "OpenUrl", SDK::Params::MediaPlayer_OpenUrl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, Pause, "MediaPlayer", "Pause", SDK::Params::MediaPlayer_Pause)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, Play, "MediaPlayer", "Play", SDK::Params::MediaPlayer_Play)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, PlayAndSeek, "MediaPlayer", "PlayAndSeek", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, Previous, "MediaPlayer", "Previous", SDK::Params::MediaPlayer_Previous)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, Reopen, "MediaPlayer", "Reopen", SDK::Params::MediaPlayer_Reopen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, Rewind, "MediaPlayer", "Rewind", SDK::Params::MediaPlayer_Rewind)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, Seek, "MediaPlayer", "Seek", SDK::Params::MediaPlayer_Seek)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SelectTrack, "MediaPlayer", "SelectTrack", SDK::Params::MediaPlayer_SelectTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetBlockOnTime, "MediaPlayer", "SetBlockOnTime", SDK::Params::MediaPlayer_SetBlockOnTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetDesiredPlayerName, "MediaPlayer", "SetDesiredPlayerName", SDK::Params::MediaPlayer_SetDesiredPlayerName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetLooping, "MediaPlayer", "SetLooping", SDK::Params::MediaPlayer_SetLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetMediaOptions, "MediaPlayer", "SetMediaOptions", SDK::Params::MediaPlayer_SetMediaOptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetNativeVolume, "MediaPlayer", "SetNativeVolume", SDK::Params::MediaPlayer_SetNativeVolume)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetPlaybackTimeRange, "MediaPlayer", "SetPlaybackTimeRange", SDK::Params::MediaPlayer_SetPlaybackTimeRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetRate, "MediaPlayer", "SetRate", SDK::Params::MediaPlayer_SetRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetTimeDelay, "MediaPlayer", "SetTimeDelay", SDK::Params::MediaPlayer_SetTimeDelay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetTrackFormat, "MediaPlayer", "SetTrackFormat", SDK::Params::MediaPlayer_SetTrackFormat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetVideoTrackFrameRate, "MediaPlayer", "SetVideoTrackFrameRate", SDK::Params::MediaPlayer_SetVideoTrackFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetViewField, "MediaPlayer", "SetViewField", SDK::Params::MediaPlayer_SetViewField)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SetViewRotation, "MediaPlayer", "SetViewRotation", SDK::Params::MediaPlayer_SetViewRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, CanPause, "MediaPlayer", "CanPause", SDK::Params::MediaPlayer_CanPause)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetAudioTrackChannels, "MediaPlayer", "GetAudioTrackChannels", SDK::Params::MediaPlayer_GetAudioTrackChannels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetAudioTrackSampleRate, "MediaPlayer", "GetAudioTrackSampleRate", SDK::Params::MediaPlayer_GetAudioTrackSampleRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetAudioTrackType, "MediaPlayer", "GetAudioTrackType", SDK::Params::MediaPlayer_GetAudioTrackType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetDesiredPlayerName, "MediaPlayer", "GetDesiredPlayerName", SDK::Params::MediaPlayer_GetDesiredPlayerName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetDisplayTime, "MediaPlayer", "GetDisplayTime", SDK::Params::MediaPlayer_GetDisplayTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetDisplayTimeStamp, "MediaPlayer", "GetDisplayTimeStamp", SDK::Params::MediaPlayer_GetDisplayTimeStamp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetDuration, "MediaPlayer", "GetDuration", SDK::Params::MediaPlayer_GetDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetHorizontalFieldOfView, "MediaPlayer", "GetHorizontalFieldOfView", SDK::Params::MediaPlayer_GetHorizontalFieldOfView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetMediaMetadataItems, "MediaPlayer", "GetMediaMetadataItems", SDK::Params::MediaPlayer_GetMediaMetadataItems)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetMediaName, "MediaPlayer", "GetMediaName", SDK::Params::MediaPlayer_GetMediaName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetNumTrackFormats, "MediaPlayer", "GetNumTrackFormats", SDK::Params::MediaPlayer_GetNumTrackFormats)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetNumTracks, "MediaPlayer", "GetNumTracks", SDK::Params::MediaPlayer_GetNumTracks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetPlayerName, "MediaPlayer", "GetPlayerName", SDK::Params::MediaPlayer_GetPlayerName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetPlaylist, "MediaPlayer", "GetPlaylist", SDK::Params::MediaPlayer_GetPlaylist)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetPlaylistIndex, "MediaPlayer", "GetPlaylistIndex", SDK::Params::MediaPlayer_GetPlaylistIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetRate, "MediaPlayer", "GetRate", SDK::Params::MediaPlayer_GetRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetSelectedTrack, "MediaPlayer", "GetSelectedTrack", SDK::Params::MediaPlayer_GetSelectedTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetSupportedRates, "MediaPlayer", "GetSupportedRates", SDK::Params::MediaPlayer_GetSupportedRates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetTime, "MediaPlayer", "GetTime", SDK::Params::MediaPlayer_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetTimeDelay, "MediaPlayer", "GetTimeDelay", SDK::Params::MediaPlayer_GetTimeDelay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetTimeStamp, "MediaPlayer", "GetTimeStamp", SDK::Params::MediaPlayer_GetTimeStamp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetTrackDisplayName, "MediaPlayer", "GetTrackDisplayName", SDK::Params::MediaPlayer_GetTrackDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetTrackFormat, "MediaPlayer", "GetTrackFormat", SDK::Params::MediaPlayer_GetTrackFormat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetTrackLanguage, "MediaPlayer", "GetTrackLanguage", SDK::Params::MediaPlayer_GetTrackLanguage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetUrl, "MediaPlayer", "GetUrl", SDK::Params::MediaPlayer_GetUrl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetVerticalFieldOfView, "MediaPlayer", "GetVerticalFieldOfView", SDK::Params::MediaPlayer_GetVerticalFieldOfView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetVideoTrackAspectRatio, "MediaPlayer", "GetVideoTrackAspectRatio", SDK::Params::MediaPlayer_GetVideoTrackAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetVideoTrackDimensions, "MediaPlayer", "GetVideoTrackDimensions", SDK::Params::MediaPlayer_GetVideoTrackDimensions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetVideoTrackFrameRate, "MediaPlayer", "GetVideoTrackFrameRate", SDK::Params::MediaPlayer_GetVideoTrackFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetVideoTrackFrameRates, "MediaPlayer", "GetVideoTrackFrameRates", SDK::Params::MediaPlayer_GetVideoTrackFrameRates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetVideoTrackType, "MediaPlayer", "GetVideoTrackType", SDK::Params::MediaPlayer_GetVideoTrackType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, GetViewRotation, "MediaPlayer", "GetViewRotation", SDK::Params::MediaPlayer_GetViewRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, HasError, "MediaPlayer", "HasError", SDK::Params::MediaPlayer_HasError)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, IsBuffering, "MediaPlayer", "IsBuffering", SDK::Params::MediaPlayer_IsBuffering)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, IsClosed, "MediaPlayer", "IsClosed", SDK::Params::MediaPlayer_IsClosed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, IsConnecting, "MediaPlayer", "IsConnecting", SDK::Params::MediaPlayer_IsConnecting)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, IsLooping, "MediaPlayer", "IsLooping", SDK::Params::MediaPlayer_IsLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, IsPaused, "MediaPlayer", "IsPaused", SDK::Params::MediaPlayer_IsPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, IsPlaying, "MediaPlayer", "IsPlaying", SDK::Params::MediaPlayer_IsPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, IsPreparing, "MediaPlayer", "IsPreparing", SDK::Params::MediaPlayer_IsPreparing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, IsReady, "MediaPlayer", "IsReady", SDK::Params::MediaPlayer_IsReady)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SupportsPlaybackTimeRange, "MediaPlayer", "SupportsPlaybackTimeRange", SDK::Params::MediaPlayer_SupportsPlaybackTimeRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SupportsRate, "MediaPlayer", "SupportsRate", SDK::Params::MediaPlayer_SupportsRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SupportsScrubbing, "MediaPlayer", "SupportsScrubbing", SDK::Params::MediaPlayer_SupportsScrubbing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlayer, SupportsSeeking, "MediaPlayer", "SupportsSeeking", SDK::Params::MediaPlayer_SupportsSeeking)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaTexture, SetMediaPlayer, "MediaTexture", "SetMediaPlayer", SDK::Params::MediaTexture_SetMediaPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaTexture, UpdateResource, "MediaTexture", "UpdateResource", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaTexture, GetAspectRatio, "MediaTexture", "GetAspectRatio", SDK::Params::MediaTexture_GetAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaTexture, GetHeight, "MediaTexture", "GetHeight", SDK::Params::MediaTexture_GetHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaTexture, GetMediaPlayer, "MediaTexture", "GetMediaPlayer", SDK::Params::MediaTexture_GetMediaPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaTexture, GetTextureNumMips, "MediaTexture", "GetTextureNumMips", SDK::Params::MediaTexture_GetTextureNumMips)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaTexture, GetWidth, "MediaTexture", "GetWidth", SDK::Params::MediaTexture_GetWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSource, SetMediaOptionBool, "MediaSource", "SetMediaOptionBool", SDK::Params::MediaSource_SetMediaOptionBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSource, SetMediaOptionFloat, "MediaSource", "SetMediaOptionFloat", SDK::Params::MediaSource_SetMediaOptionFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSource, SetMediaOptionInt64, "MediaSource", "SetMediaOptionInt64", SDK::Params::MediaSource_SetMediaOptionInt64)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSource, SetMediaOptionString, "MediaSource", "SetMediaOptionString", SDK::Params::MediaSource_SetMediaOptionString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSource, GetUrl, "MediaSource", "GetUrl", SDK::Params::MediaSource_GetUrl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSource, Validate, "MediaSource", "Validate", SDK::Params::MediaSource_Validate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFileMediaSource, SetFilePath, "FileMediaSource", "SetFilePath", SDK::Params::FileMediaSource_SetFilePath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaComponent, GetMediaPlayer, "MediaComponent", "GetMediaPlayer", SDK::Params::MediaComponent_GetMediaPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaComponent, GetMediaTexture, "MediaComponent", "GetMediaTexture", SDK::Params::MediaComponent_GetMediaTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, Add, "MediaPlaylist", "Add", SDK::Params::MediaPlaylist_Add)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, AddFile, "MediaPlaylist", "AddFile", SDK::Params::MediaPlaylist_AddFile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, AddUrl, "MediaPlaylist", "AddUrl", SDK::Params::MediaPlaylist_AddUrl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, Get, "MediaPlaylist", "Get", SDK::Params::MediaPlaylist_Get)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, GetNext, "MediaPlaylist", "GetNext", SDK::Params::MediaPlaylist_GetNext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, GetPrevious, "MediaPlaylist", "GetPrevious", SDK::Params::MediaPlaylist_GetPrevious)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, GetRandom, "MediaPlaylist", "GetRandom", SDK::Params::MediaPlaylist_GetRandom)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, Insert, "MediaPlaylist", "Insert", SDK::Params::MediaPlaylist_Insert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, Num, "MediaPlaylist", "Num", SDK::Params::MediaPlaylist_Num)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, Remove, "MediaPlaylist", "Remove", SDK::Params::MediaPlaylist_Remove)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, RemoveAt, "MediaPlaylist", "RemoveAt", SDK::Params::MediaPlaylist_RemoveAt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlaylist, Replace, "MediaPlaylist", "Replace", SDK::Params::MediaPlaylist_Replace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, BP_GetAttenuationSettingsToApply, "MediaSoundComponent", "BP_GetAttenuationSettingsToApply", SDK::Params::MediaSoundComponent_BP_GetAttenuationSettingsToApply)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, GetNormalizedSpectralData, "MediaSoundComponent", "GetNormalizedSpectralData", SDK::Params::MediaSoundComponent_GetNormalizedSpectralData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, GetSpectralData, "MediaSoundComponent", "GetSpectralData", SDK::Params::MediaSoundComponent_GetSpectralData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, SetEnableEnvelopeFollowing, "MediaSoundComponent", "SetEnableEnvelopeFollowing", SDK::Params::MediaSoundComponent_SetEnableEnvelopeFollowing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, SetEnableSpectralAnalysis, "MediaSoundComponent", "SetEnableSpectralAnalysis", SDK::Params::MediaSoundComponent_SetEnableSpectralAnalysis)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, SetEnvelopeFollowingsettings, "MediaSoundComponent", "SetEnvelopeFollowingsettings", SDK::Params::MediaSoundComponent_SetEnvelopeFollowingsettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, SetMediaPlayer, "MediaSoundComponent", "SetMediaPlayer", SDK::Params::MediaSoundComponent_SetMediaPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, SetSpectralAnalysisSettings, "MediaSoundComponent", "SetSpectralAnalysisSettings", SDK::Params::MediaSoundComponent_SetSpectralAnalysisSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, GetEnvelopeValue, "MediaSoundComponent", "GetEnvelopeValue", SDK::Params::MediaSoundComponent_GetEnvelopeValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaSoundComponent, GetMediaPlayer, "MediaSoundComponent", "GetMediaPlayer", SDK::Params::MediaSoundComponent_GetMediaPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaBlueprintFunctionLibrary, EnumerateAudioCaptureDevices, "MediaBlueprintFunctionLibrary", "EnumerateAudioCaptureDevices", SDK::Params::MediaBlueprintFunctionLibrary_EnumerateAudioCaptureDevices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaBlueprintFunctionLibrary, EnumerateVideoCaptureDevices, "MediaBlueprintFunctionLibrary", "EnumerateVideoCaptureDevices", SDK::Params::MediaBlueprintFunctionLibrary_EnumerateVideoCaptureDevices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaBlueprintFunctionLibrary, EnumerateWebcamCaptureDevices, "MediaBlueprintFunctionLibrary", "EnumerateWebcamCaptureDevices", SDK::Params::MediaBlueprintFunctionLibrary_EnumerateWebcamCaptureDevices)
+// clang-format on
@@ -0,0 +1,34 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MediaPlate_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MediaPlate_classes.hpp"
+#include "../SDK/MediaPlate_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, Close, "MediaPlateComponent", "Close", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, GetLetterboxAspectRatio, "MediaPlateComponent", "GetLetterboxAspectRatio", SDK::Params::MediaPlateComponent_GetLetterboxAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, GetLoop, "MediaPlateComponent", "GetLoop", SDK::Params::MediaPlateComponent_GetLoop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, GetMediaPlayer, "MediaPlateComponent", "GetMediaPlayer", SDK::Params::MediaPlateComponent_GetMediaPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, GetMediaTexture, "MediaPlateComponent", "GetMediaTexture", SDK::Params::MediaPlateComponent_GetMediaTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, OnMediaEnd, "MediaPlateComponent", "OnMediaEnd", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, OnMediaOpened, "MediaPlateComponent", "OnMediaOpened", SDK::Params::MediaPlateComponent_OnMediaOpened)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, OnMediaResumed, "MediaPlateComponent", "OnMediaResumed", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, OnMediaSuspended, "MediaPlateComponent", "OnMediaSuspended", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, Open, "MediaPlateComponent", "Open", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, Pause, "MediaPlateComponent", "Pause", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, Play, "MediaPlateComponent", "Play", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, Rewind, "MediaPlateComponent", "Rewind", SDK::Params::MediaPlateComponent_Rewind)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, Seek, "MediaPlateComponent", "Seek", SDK::Params::MediaPlateComponent_Seek)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, SetIsAspectRatioAuto, "MediaPlateComponent", "SetIsAspectRatioAuto", SDK::Params::MediaPlateComponent_SetIsAspectRatioAuto)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, SetLetterboxAspectRatio, "MediaPlateComponent", "SetLetterboxAspectRatio", SDK::Params::MediaPlateComponent_SetLetterboxAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, SetLoop, "MediaPlateComponent", "SetLoop", SDK::Params::MediaPlateComponent_SetLoop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, SetMeshRange, "MediaPlateComponent", "SetMeshRange", SDK::Params::MediaPlateComponent_SetMeshRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, SetPlayOnlyWhenVisible, "MediaPlateComponent", "SetPlayOnlyWhenVisible", SDK::Params::MediaPlateComponent_SetPlayOnlyWhenVisible)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, GetIsAspectRatioAuto, "MediaPlateComponent", "GetIsAspectRatioAuto", SDK::Params::MediaPlateComponent_GetIsAspectRatioAuto)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, GetMeshRange, "MediaPlateComponent", "GetMeshRange", SDK::Params::MediaPlateComponent_GetMeshRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMediaPlateComponent, IsMediaPlatePlaying, "MediaPlateComponent", "IsMediaPlatePlaying", SDK::Params::MediaPlateComponent_IsMediaPlatePlaying)
+// clang-format on
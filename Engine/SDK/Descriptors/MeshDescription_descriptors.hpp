@@ -0,0 +1,103 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MeshDescription_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MeshDescription_classes.hpp"
+#include "../SDK/MeshDescription_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, ComputePolygonTriangulation, "MeshDescriptionBase", "ComputePolygonTriangulation", SDK::Params::MeshDescriptionBase_ComputePolygonTriangulation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreateEdge, "MeshDescriptionBase", "CreateEdge", SDK::Params::MeshDescriptionBase_CreateEdge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreateEdgeWithID, "MeshDescriptionBase", "CreateEdgeWithID", SDK::Params::MeshDescriptionBase_CreateEdgeWithID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreatePolygon, "MeshDescriptionBase", "CreatePolygon", SDK::Params::MeshDescriptionBase_CreatePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreatePolygonGroup, "MeshDescriptionBase", "CreatePolygonGroup", SDK::Params::MeshDescriptionBase_CreatePolygonGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreatePolygonGroupWithID, "MeshDescriptionBase", "CreatePolygonGroupWithID", SDK::Params::MeshDescriptionBase_CreatePolygonGroupWithID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreatePolygonWithID, "MeshDescriptionBase", "CreatePolygonWithID", SDK::Params::MeshDescriptionBase_CreatePolygonWithID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreateTriangle, "MeshDescriptionBase", "CreateTriangle", SDK::Params::MeshDescriptionBase_CreateTriangle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreateTriangleWithID, "MeshDescriptionBase", "CreateTriangleWithID", SDK::Params::MeshDescriptionBase_CreateTriangleWithID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreateVertex, "MeshDescriptionBase", "CreateVertex", SDK::Params::MeshDescriptionBase_CreateVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreateVertexInstance, "MeshDescriptionBase", "CreateVertexInstance", SDK::Params::MeshDescriptionBase_CreateVertexInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreateVertexInstanceWithID, "MeshDescriptionBase", "CreateVertexInstanceWithID", SDK::Params::MeshDescriptionBase_CreateVertexInstanceWithID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, CreateVertexWithID, "MeshDescriptionBase", "CreateVertexWithID", SDK::Params::MeshDescriptionBase_CreateVertexWithID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, DeleteEdge, "MeshDescriptionBase", "DeleteEdge", SDK::Params::MeshDescriptionBase_DeleteEdge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, DeletePolygon, "MeshDescriptionBase", "DeletePolygon", SDK::Params::MeshDescriptionBase_DeletePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, DeletePolygonGroup, "MeshDescriptionBase", "DeletePolygonGroup", SDK::Params::MeshDescriptionBase_DeletePolygonGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, DeleteTriangle, "MeshDescriptionBase", "DeleteTriangle", SDK::Params::MeshDescriptionBase_DeleteTriangle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, DeleteVertex, "MeshDescriptionBase", "DeleteVertex", SDK::Params::MeshDescriptionBase_DeleteVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, DeleteVertexInstance, "MeshDescriptionBase", "DeleteVertexInstance", SDK::Params::MeshDescriptionBase_DeleteVertexInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, Empty, "MeshDescriptionBase", "Empty", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, ReserveNewEdges, "MeshDescriptionBase", "ReserveNewEdges", SDK::Params::MeshDescriptionBase_ReserveNewEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, ReserveNewPolygonGroups, "MeshDescriptionBase", "ReserveNewPolygonGroups", SDK::Params::MeshDescriptionBase_ReserveNewPolygonGroups)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, ReserveNewPolygons, "MeshDescriptionBase", "ReserveNewPolygons", SDK::Params::MeshDescriptionBase_ReserveNewPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, ReserveNewTriangles, "MeshDescriptionBase", "ReserveNewTriangles", SDK::Params::MeshDescriptionBase_ReserveNewTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, ReserveNewVertexInstances, "MeshDescriptionBase", "ReserveNewVertexInstances", SDK::Params::MeshDescriptionBase_ReserveNewVertexInstances)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, ReserveNewVertices, "MeshDescriptionBase", "ReserveNewVertices", SDK::Params::MeshDescriptionBase_ReserveNewVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, ReversePolygonFacing, "MeshDescriptionBase", "ReversePolygonFacing", SDK::Params::MeshDescriptionBase_ReversePolygonFacing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, SetPolygonPolygonGroup, "MeshDescriptionBase", "SetPolygonPolygonGroup", SDK::Params::MeshDescriptionBase_SetPolygonPolygonGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, SetPolygonVertexInstances, "MeshDescriptionBase", "SetPolygonVertexInstances", SDK::Params::MeshDescriptionBase_SetPolygonVertexInstances)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, SetVertexPosition, "MeshDescriptionBase", "SetVertexPosition", SDK::Params::MeshDescriptionBase_SetVertexPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetEdgeConnectedPolygons, "MeshDescriptionBase", "GetEdgeConnectedPolygons", SDK::Params::MeshDescriptionBase_GetEdgeConnectedPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetEdgeConnectedTriangles, "MeshDescriptionBase", "GetEdgeConnectedTriangles", SDK::Params::MeshDescriptionBase_GetEdgeConnectedTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetEdgeCount, "MeshDescriptionBase", "GetEdgeCount", SDK::Params::MeshDescriptionBase_GetEdgeCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetEdgeVertex, "MeshDescriptionBase", "GetEdgeVertex", SDK::Params::MeshDescriptionBase_GetEdgeVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetEdgeVertices, "MeshDescriptionBase", "GetEdgeVertices", SDK::Params::MeshDescriptionBase_GetEdgeVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumEdgeConnectedPolygons, "MeshDescriptionBase", "GetNumEdgeConnectedPolygons", SDK::Params::MeshDescriptionBase_GetNumEdgeConnectedPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumEdgeConnectedTriangles, "MeshDescriptionBase", "GetNumEdgeConnectedTriangles", SDK::Params::MeshDescriptionBase_GetNumEdgeConnectedTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumPolygonGroupPolygons, "MeshDescriptionBase", "GetNumPolygonGroupPolygons", SDK::Params::MeshDescriptionBase_GetNumPolygonGroupPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumPolygonInternalEdges, "MeshDescriptionBase", "GetNumPolygonInternalEdges", SDK::Params::MeshDescriptionBase_GetNumPolygonInternalEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumPolygonTriangles, "MeshDescriptionBase", "GetNumPolygonTriangles", SDK::Params::MeshDescriptionBase_GetNumPolygonTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumPolygonVertices, "MeshDescriptionBase", "GetNumPolygonVertices", SDK::Params::MeshDescriptionBase_GetNumPolygonVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumVertexConnectedEdges, "MeshDescriptionBase", "GetNumVertexConnectedEdges", SDK::Params::MeshDescriptionBase_GetNumVertexConnectedEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumVertexConnectedPolygons, "MeshDescriptionBase", "GetNumVertexConnectedPolygons", SDK::Params::MeshDescriptionBase_GetNumVertexConnectedPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumVertexConnectedTriangles, "MeshDescriptionBase", "GetNumVertexConnectedTriangles", SDK::Params::MeshDescriptionBase_GetNumVertexConnectedTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumVertexInstanceConnectedPolygons, "MeshDescriptionBase", "GetNumVertexInstanceConnectedPolygons", SDK::Params::MeshDescriptionBase_GetNumVertexInstanceConnectedPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumVertexInstanceConnectedTriangles, "MeshDescriptionBase", "GetNumVertexInstanceConnectedTriangles", SDK::Params::MeshDescriptionBase_GetNumVertexInstanceConnectedTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetNumVertexVertexInstances, "MeshDescriptionBase", "GetNumVertexVertexInstances", SDK::Params::MeshDescriptionBase_GetNumVertexVertexInstances)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonAdjacentPolygons, "MeshDescriptionBase", "GetPolygonAdjacentPolygons", SDK::Params::MeshDescriptionBase_GetPolygonAdjacentPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonCount, "MeshDescriptionBase", "GetPolygonCount", SDK::Params::MeshDescriptionBase_GetPolygonCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonGroupCount, "MeshDescriptionBase", "GetPolygonGroupCount", SDK::Params::MeshDescriptionBase_GetPolygonGroupCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonGroupPolygons, "MeshDescriptionBase", "GetPolygonGroupPolygons", SDK::Params::MeshDescriptionBase_GetPolygonGroupPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonInternalEdges, "MeshDescriptionBase", "GetPolygonInternalEdges", SDK::Params::MeshDescriptionBase_GetPolygonInternalEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonPerimeterEdges, "MeshDescriptionBase", "GetPolygonPerimeterEdges", SDK::Params::MeshDescriptionBase_GetPolygonPerimeterEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonPolygonGroup, "MeshDescriptionBase", "GetPolygonPolygonGroup", SDK::Params::MeshDescriptionBase_GetPolygonPolygonGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonTriangles, "MeshDescriptionBase", "GetPolygonTriangles", SDK::Params::MeshDescriptionBase_GetPolygonTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonVertexInstances, "MeshDescriptionBase", "GetPolygonVertexInstances", SDK::Params::MeshDescriptionBase_GetPolygonVertexInstances)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetPolygonVertices, "MeshDescriptionBase", "GetPolygonVertices", SDK::Params::MeshDescriptionBase_GetPolygonVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetTriangleAdjacentTriangles, "MeshDescriptionBase", "GetTriangleAdjacentTriangles", SDK::Params::MeshDescriptionBase_GetTriangleAdjacentTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetTriangleCount, "MeshDescriptionBase", "GetTriangleCount", SDK::Params::MeshDescriptionBase_GetTriangleCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetTriangleEdges, "MeshDescriptionBase", "GetTriangleEdges", SDK::Params::MeshDescriptionBase_GetTriangleEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetTrianglePolygon, "MeshDescriptionBase", "GetTrianglePolygon", SDK::Params::MeshDescriptionBase_GetTrianglePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetTrianglePolygonGroup, "MeshDescriptionBase", "GetTrianglePolygonGroup", SDK::Params::MeshDescriptionBase_GetTrianglePolygonGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetTriangleVertexInstance, "MeshDescriptionBase", "GetTriangleVertexInstance", SDK::Params::MeshDescriptionBase_GetTriangleVertexInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetTriangleVertexInstances, "MeshDescriptionBase", "GetTriangleVertexInstances", SDK::Params::MeshDescriptionBase_GetTriangleVertexInstances)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetTriangleVertices, "MeshDescriptionBase", "GetTriangleVertices", SDK::Params::MeshDescriptionBase_GetTriangleVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexAdjacentVertices, "MeshDescriptionBase", "GetVertexAdjacentVertices", SDK::Params::MeshDescriptionBase_GetVertexAdjacentVertices)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexConnectedEdges, "MeshDescriptionBase", "GetVertexConnectedEdges", SDK::Params::MeshDescriptionBase_GetVertexConnectedEdges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexConnectedPolygons, "MeshDescriptionBase", "GetVertexConnectedPolygons", SDK::Params::MeshDescriptionBase_GetVertexConnectedPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexConnectedTriangles, "MeshDescriptionBase", "GetVertexConnectedTriangles", SDK::Params::MeshDescriptionBase_GetVertexConnectedTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexCount, "MeshDescriptionBase", "GetVertexCount", SDK::Params::MeshDescriptionBase_GetVertexCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexInstanceConnectedPolygons, "MeshDescriptionBase", "GetVertexInstanceConnectedPolygons", SDK::Params::MeshDescriptionBase_GetVertexInstanceConnectedPolygons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexInstanceConnectedTriangles, "MeshDescriptionBase", "GetVertexInstanceConnectedTriangles", SDK::Params::MeshDescriptionBase_GetVertexInstanceConnectedTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexInstanceCount, "MeshDescriptionBase", "GetVertexInstanceCount", SDK::Params::MeshDescriptionBase_GetVertexInstanceCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexInstanceForPolygonVertex, "MeshDescriptionBase", "GetVertexInstanceForPolygonVertex", SDK::Params::MeshDescriptionBase_GetVertexInstanceForPolygonVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexInstanceForTriangleVertex, "MeshDescriptionBase", "GetVertexInstanceForTriangleVertex", SDK::Params::MeshDescriptionBase_GetVertexInstanceForTriangleVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexInstancePairEdge, "MeshDescriptionBase", "GetVertexInstancePairEdge", SDK::Params::MeshDescriptionBase_GetVertexInstancePairEdge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexInstanceVertex, "MeshDescriptionBase", "GetVertexInstanceVertex", SDK::Params::MeshDescriptionBase_GetVertexInstanceVertex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexPairEdge, "MeshDescriptionBase", "GetVertexPairEdge", SDK::Params::MeshDescriptionBase_GetVertexPairEdge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexPosition, "MeshDescriptionBase", "GetVertexPosition", SDK::Params::MeshDescriptionBase_GetVertexPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, GetVertexVertexInstances, "MeshDescriptionBase", "GetVertexVertexInstances", SDK::Params::MeshDescriptionBase_GetVertexVertexInstances)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsEdgeInternal, "MeshDescriptionBase", "IsEdgeInternal", SDK::Params::MeshDescriptionBase_IsEdgeInternal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsEdgeInternalToPolygon, "MeshDescriptionBase", "IsEdgeInternalToPolygon", SDK::Params::MeshDescriptionBase_IsEdgeInternalToPolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsEdgeValid, "MeshDescriptionBase", "IsEdgeValid", SDK::Params::MeshDescriptionBase_IsEdgeValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsEmpty, "MeshDescriptionBase", "IsEmpty", SDK::Params::MeshDescriptionBase_IsEmpty)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsPolygonGroupValid, "MeshDescriptionBase", "IsPolygonGroupValid", SDK::Params::MeshDescriptionBase_IsPolygonGroupValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsPolygonValid, "MeshDescriptionBase", "IsPolygonValid", SDK::Params::MeshDescriptionBase_IsPolygonValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsTrianglePartOfNgon, "MeshDescriptionBase", "IsTrianglePartOfNgon", SDK::Params::MeshDescriptionBase_IsTrianglePartOfNgon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsTriangleValid, "MeshDescriptionBase", "IsTriangleValid", SDK::Params::MeshDescriptionBase_IsTriangleValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsVertexInstanceValid, "MeshDescriptionBase", "IsVertexInstanceValid", SDK::Params::MeshDescriptionBase_IsVertexInstanceValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsVertexOrphaned, "MeshDescriptionBase", "IsVertexOrphaned", SDK::Params::MeshDescriptionBase_IsVertexOrphaned)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshDescriptionBase, IsVertexValid, "MeshDescriptionBase", "IsVertexValid", SDK::Params::MeshDescriptionBase_IsVertexValid)
+// clang-format on
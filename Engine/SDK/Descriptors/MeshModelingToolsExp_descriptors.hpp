@@ -0,0 +1,98 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MeshModelingToolsExp_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MeshModelingToolsExp_classes.hpp"
+#include "../SDK/MeshModelingToolsExp_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBakeInputMeshProperties, GetSourceUVLayerNamesFunc, "BakeInputMeshProperties", "GetSourceUVLayerNamesFunc", SDK::Params::BakeInputMeshProperties_GetSourceUVLayerNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBakeInputMeshProperties, GetTargetUVLayerNamesFunc, "BakeInputMeshProperties", "GetTargetUVLayerNamesFunc", SDK::Params::BakeInputMeshProperties_GetTargetUVLayerNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBakeTexture2DProperties, GetUVLayerNamesFunc, "BakeTexture2DProperties", "GetUVLayerNamesFunc", SDK::Params::BakeTexture2DProperties_GetUVLayerNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBakeMultiTexture2DProperties, GetUVLayerNamesFunc, "BakeMultiTexture2DProperties", "GetUVLayerNamesFunc", SDK::Params::BakeMultiTexture2DProperties_GetUVLayerNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshConstraintProperties, IsPreventNormalFlipsEnabled, "MeshConstraintProperties", "IsPreventNormalFlipsEnabled", SDK::Params::MeshConstraintProperties_IsPreventNormalFlipsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshConstraintProperties, IsPreventTinyTrianglesEnabled, "MeshConstraintProperties", "IsPreventTinyTrianglesEnabled", SDK::Params::MeshConstraintProperties_IsPreventTinyTrianglesEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URevolveSplineToolActionPropertySet, ResetAxis, "RevolveSplineToolActionPropertySet", "ResetAxis", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTransferMeshToolProperties, GetSourceLODNamesFunc, "TransferMeshToolProperties", "GetSourceLODNamesFunc", SDK::Params::TransferMeshToolProperties_GetSourceLODNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTransferMeshToolProperties, GetTargetLODNamesFunc, "TransferMeshToolProperties", "GetTargetLODNamesFunc", SDK::Params::TransferMeshToolProperties_GetTargetLODNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBakeMeshAttributeMapsToolProperties, GetMapPreviewNamesFunc, "BakeMeshAttributeMapsToolProperties", "GetMapPreviewNamesFunc", SDK::Params::BakeMeshAttributeMapsToolProperties_GetMapPreviewNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USimpleCollisionEditorToolActionProperties, AddBox, "SimpleCollisionEditorToolActionProperties", "AddBox", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USimpleCollisionEditorToolActionProperties, AddCapsule, "SimpleCollisionEditorToolActionProperties", "AddCapsule", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USimpleCollisionEditorToolActionProperties, AddSphere, "SimpleCollisionEditorToolActionProperties", "AddSphere", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USimpleCollisionEditorToolActionProperties, Delete, "SimpleCollisionEditorToolActionProperties", "Delete", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USimpleCollisionEditorToolActionProperties, DeleteAll, "SimpleCollisionEditorToolActionProperties", "DeleteAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USimpleCollisionEditorToolActionProperties, Duplicate, "SimpleCollisionEditorToolActionProperties", "Duplicate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBakeMultiMeshAttributeMapsToolProperties, GetMapPreviewNamesFunc, "BakeMultiMeshAttributeMapsToolProperties", "GetMapPreviewNamesFunc", SDK::Params::BakeMultiMeshAttributeMapsToolProperties_GetMapPreviewNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBakeMultiMeshInputToolProperties, GetTargetUVLayerNamesFunc, "BakeMultiMeshInputToolProperties", "GetTargetUVLayerNamesFunc", SDK::Params::BakeMultiMeshInputToolProperties_GetTargetUVLayerNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOutputPolygroupLayerProperties, GetGroupOptionsList, "OutputPolygroupLayerProperties", "GetGroupOptionsList", SDK::Params::OutputPolygroupLayerProperties_GetGroupOptionsList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCubeGridToolActions, AcceptAndStartNew, "CubeGridToolActions", "AcceptAndStartNew", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCubeGridToolActions, CornerMode, "CubeGridToolActions", "CornerMode", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCubeGridToolActions, Flip, "CubeGridToolActions", "Flip", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCubeGridToolActions, Pull, "CubeGridToolActions", "Pull", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCubeGridToolActions, Push, "CubeGridToolActions", "Push", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCubeGridToolActions, ResetGridFromActor, "CubeGridToolActions", "ResetGridFromActor", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCubeGridToolActions, SlideBack, "CubeGridToolActions", "SlideBack", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCubeGridToolActions, SlideForward, "CubeGridToolActions", "SlideForward", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDisplaceMeshCommonProperties, GetWeightMapsFunc, "DisplaceMeshCommonProperties", "GetWeightMapsFunc", SDK::Params::DisplaceMeshCommonProperties_GetWeightMapsFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USelectiveTessellationProperties, GetMaterialIDsFunc, "SelectiveTessellationProperties", "GetMaterialIDsFunc", SDK::Params::SelectiveTessellationProperties_GetMaterialIDsFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicSculptToolActions, DiscardAttributes, "DynamicSculptToolActions", "DiscardAttributes", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditPivotToolActionPropertySet, Back, "EditPivotToolActionPropertySet", "Back", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditPivotToolActionPropertySet, Bottom, "EditPivotToolActionPropertySet", "Bottom", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditPivotToolActionPropertySet, Center, "EditPivotToolActionPropertySet", "Center", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditPivotToolActionPropertySet, Front, "EditPivotToolActionPropertySet", "Front", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditPivotToolActionPropertySet, Left, "EditPivotToolActionPropertySet", "Left", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditPivotToolActionPropertySet, Right, "EditPivotToolActionPropertySet", "Right", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditPivotToolActionPropertySet, Top, "EditPivotToolActionPropertySet", "Top", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditPivotToolActionPropertySet, WorldOrigin, "EditPivotToolActionPropertySet", "WorldOrigin", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UHoleFillToolActions, Clear, "HoleFillToolActions", "Clear", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UHoleFillToolActions, SelectAll, "HoleFillToolActions", "SelectAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULatticeDeformerToolProperties, ClearConstraints, "LatticeDeformerToolProperties", "ClearConstraints", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULatticeDeformerToolProperties, Constrain, "LatticeDeformerToolProperties", "Constrain", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshAttributePaintToolProperties, GetAttributeNames, "MeshAttributePaintToolProperties", "GetAttributeNames", SDK::Params::MeshAttributePaintToolProperties_GetAttributeNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshGroupPaintToolFreezeActions, ClearAll, "MeshGroupPaintToolFreezeActions", "ClearAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshGroupPaintToolFreezeActions, ClearCurrent, "MeshGroupPaintToolFreezeActions", "ClearCurrent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshGroupPaintToolFreezeActions, FloodFillCurrent, "MeshGroupPaintToolFreezeActions", "FloodFillCurrent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshGroupPaintToolFreezeActions, FreezeCurrent, "MeshGroupPaintToolFreezeActions", "FreezeCurrent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshGroupPaintToolFreezeActions, FreezeOthers, "MeshGroupPaintToolFreezeActions", "FreezeOthers", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshGroupPaintToolFreezeActions, GrowCurrent, "MeshGroupPaintToolFreezeActions", "GrowCurrent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshGroupPaintToolFreezeActions, ShrinkCurrent, "MeshGroupPaintToolFreezeActions", "ShrinkCurrent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshGroupPaintToolFreezeActions, UnfreezeAll, "MeshGroupPaintToolFreezeActions", "UnfreezeAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshInspectorMaterialProperties, GetUVChannelNamesFunc, "MeshInspectorMaterialProperties", "GetUVChannelNamesFunc", SDK::Params::MeshInspectorMaterialProperties_GetUVChannelNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, Clear, "MeshSelectionEditActions", "Clear", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, ExpandToMaterials, "MeshSelectionEditActions", "ExpandToMaterials", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, FloodFill, "MeshSelectionEditActions", "FloodFill", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, Grow, "MeshSelectionEditActions", "Grow", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, Invert, "MeshSelectionEditActions", "Invert", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, LargestAreaPart, "MeshSelectionEditActions", "LargestAreaPart", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, LargestTriCountPart, "MeshSelectionEditActions", "LargestTriCountPart", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, OptimizeBorder, "MeshSelectionEditActions", "OptimizeBorder", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, SelectAll, "MeshSelectionEditActions", "SelectAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionEditActions, Shrink, "MeshSelectionEditActions", "Shrink", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionMeshEditActions, CreatePolygroup, "MeshSelectionMeshEditActions", "CreatePolygroup", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionMeshEditActions, Delete, "MeshSelectionMeshEditActions", "Delete", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionMeshEditActions, Disconnect, "MeshSelectionMeshEditActions", "Disconnect", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionMeshEditActions, Duplicate, "MeshSelectionMeshEditActions", "Duplicate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionMeshEditActions, FlipNormals, "MeshSelectionMeshEditActions", "FlipNormals", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionMeshEditActions, Separate, "MeshSelectionMeshEditActions", "Separate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSelectionMeshEditActions, SmoothBorder, "MeshSelectionMeshEditActions", "SmoothBorder", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshSpaceDeformerToolActionPropertySet, ShiftToCenter, "MeshSpaceDeformerToolActionPropertySet", "ShiftToCenter", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshVertexPaintToolQuickActions, EraseAll, "MeshVertexPaintToolQuickActions", "EraseAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshVertexPaintToolQuickActions, FillBlack, "MeshVertexPaintToolQuickActions", "FillBlack", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshVertexPaintToolQuickActions, FillWhite, "MeshVertexPaintToolQuickActions", "FillWhite", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshVertexPaintToolQuickActions, PaintAll, "MeshVertexPaintToolQuickActions", "PaintAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshVertexPaintToolUtilityActions, ApplySelectedOperation, "MeshVertexPaintToolUtilityActions", "ApplySelectedOperation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshVertexPaintToolUtilityActions, GetWeightMapsFunc, "MeshVertexPaintToolUtilityActions", "GetWeightMapsFunc", SDK::Params::MeshVertexPaintToolUtilityActions_GetWeightMapsFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshVertexPaintToolUtilityActions, GetLODNamesFunc, "MeshVertexPaintToolUtilityActions", "GetLODNamesFunc", SDK::Params::MeshVertexPaintToolUtilityActions_GetLODNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorToolActionPropertySet, Backward, "MirrorToolActionPropertySet", "Backward", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorToolActionPropertySet, Down, "MirrorToolActionPropertySet", "Down", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorToolActionPropertySet, Forward, "MirrorToolActionPropertySet", "Forward", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorToolActionPropertySet, Left, "MirrorToolActionPropertySet", "Left", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorToolActionPropertySet, Right, "MirrorToolActionPropertySet", "Right", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorToolActionPropertySet, ShiftToCenter, "MirrorToolActionPropertySet", "ShiftToCenter", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMirrorToolActionPropertySet, Up, "MirrorToolActionPropertySet", "Up", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlaneCutTool, Cut, "PlaneCutTool", "Cut", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPlaneCutTool, FlipPlane, "PlaneCutTool", "FlipPlane", void)
+// clang-format on
@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MeshModelingTools_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MeshModelingTools_classes.hpp"
+#include "../SDK/MeshModelingTools_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, CutFaces, "EditMeshPolygonsToolActions_Triangles", "CutFaces", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Delete, "EditMeshPolygonsToolActions_Triangles", "Delete", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Disconnect, "EditMeshPolygonsToolActions_Triangles", "Disconnect", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Duplicate, "EditMeshPolygonsToolActions_Triangles", "Duplicate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Extrude, "EditMeshPolygonsToolActions_Triangles", "Extrude", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Flip, "EditMeshPolygonsToolActions_Triangles", "Flip", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Inset, "EditMeshPolygonsToolActions_Triangles", "Inset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Offset, "EditMeshPolygonsToolActions_Triangles", "Offset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Outset, "EditMeshPolygonsToolActions_Triangles", "Outset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, Poke, "EditMeshPolygonsToolActions_Triangles", "Poke", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, PushPull, "EditMeshPolygonsToolActions_Triangles", "PushPull", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions_Triangles, RecalcNormals, "EditMeshPolygonsToolActions_Triangles", "RecalcNormals", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolUVActions, PlanarProjection, "EditMeshPolygonsToolUVActions", "PlanarProjection", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPolyEditTopologyProperties, RegenerateExtraCorners, "PolyEditTopologyProperties", "RegenerateExtraCorners", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions, Bevel, "EditMeshPolygonsToolEdgeActions", "Bevel", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions, Bridge, "EditMeshPolygonsToolEdgeActions", "Bridge", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions, DeleteEdge, "EditMeshPolygonsToolEdgeActions", "DeleteEdge", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions, Extrude, "EditMeshPolygonsToolEdgeActions", "Extrude", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions, FillHole, "EditMeshPolygonsToolEdgeActions", "FillHole", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions, Simplify, "EditMeshPolygonsToolEdgeActions", "Simplify", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions, Straighten, "EditMeshPolygonsToolEdgeActions", "Straighten", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions, Weld, "EditMeshPolygonsToolEdgeActions", "Weld", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Bevel, "EditMeshPolygonsToolActions", "Bevel", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, CutFaces, "EditMeshPolygonsToolActions", "CutFaces", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Decompose, "EditMeshPolygonsToolActions", "Decompose", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Delete, "EditMeshPolygonsToolActions", "Delete", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Disconnect, "EditMeshPolygonsToolActions", "Disconnect", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Duplicate, "EditMeshPolygonsToolActions", "Duplicate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Extrude, "EditMeshPolygonsToolActions", "Extrude", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Flip, "EditMeshPolygonsToolActions", "Flip", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, InsertEdge, "EditMeshPolygonsToolActions", "InsertEdge", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, InsertEdgeLoop, "EditMeshPolygonsToolActions", "InsertEdgeLoop", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Inset, "EditMeshPolygonsToolActions", "Inset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Merge, "EditMeshPolygonsToolActions", "Merge", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Offset, "EditMeshPolygonsToolActions", "Offset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Outset, "EditMeshPolygonsToolActions", "Outset", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, PushPull, "EditMeshPolygonsToolActions", "PushPull", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, RecalcNormals, "EditMeshPolygonsToolActions", "RecalcNormals", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, Retriangulate, "EditMeshPolygonsToolActions", "Retriangulate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolActions, SimplifyByGroups, "EditMeshPolygonsToolActions", "SimplifyByGroups", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions_Triangles, Bridge, "EditMeshPolygonsToolEdgeActions_Triangles", "Bridge", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions_Triangles, Collapse, "EditMeshPolygonsToolEdgeActions_Triangles", "Collapse", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions_Triangles, Extrude, "EditMeshPolygonsToolEdgeActions_Triangles", "Extrude", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions_Triangles, FillHole, "EditMeshPolygonsToolEdgeActions_Triangles", "FillHole", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions_Triangles, Flip, "EditMeshPolygonsToolEdgeActions_Triangles", "Flip", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions_Triangles, Split, "EditMeshPolygonsToolEdgeActions_Triangles", "Split", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditMeshPolygonsToolEdgeActions_Triangles, Weld, "EditMeshPolygonsToolEdgeActions_Triangles", "Weld", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UExistingMeshMaterialProperties, GetUVChannelNamesFunc, "ExistingMeshMaterialProperties", "GetUVChannelNamesFunc", SDK::Params::ExistingMeshMaterialProperties_GetUVChannelNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshUVChannelProperties, GetUVChannelNamesFunc, "MeshUVChannelProperties", "GetUVChannelNamesFunc", SDK::Params::MeshUVChannelProperties_GetUVChannelNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUVProjectionToolEditActions, AutoFit, "UVProjectionToolEditActions", "AutoFit", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUVProjectionToolEditActions, AutoFitAlign, "UVProjectionToolEditActions", "AutoFitAlign", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUVProjectionToolEditActions, Reset, "UVProjectionToolEditActions", "Reset", void)
+// clang-format on
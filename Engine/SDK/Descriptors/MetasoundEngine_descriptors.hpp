@@ -0,0 +1,132 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MetasoundEngine_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MetasoundEngine_classes.hpp"
+#include "../SDK/MetasoundEngine_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateBoolArrayMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateBoolArrayMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateBoolArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateBoolMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateBoolMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateBoolMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateFloatArrayMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateFloatArrayMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateFloatArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateFloatMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateFloatMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateFloatMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateIntArrayMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateIntArrayMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateIntArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateIntMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateIntMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateIntMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateMetaSoundLiteralFromParam, "MetasoundFrontendLiteralBlueprintAccess", "CreateMetaSoundLiteralFromParam", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateMetaSoundLiteralFromParam)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateObjectArrayMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateObjectArrayMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateObjectArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateObjectMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateObjectMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateObjectMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateStringArrayMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateStringArrayMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateStringArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundFrontendLiteralBlueprintAccess, CreateStringMetaSoundLiteral, "MetasoundFrontendLiteralBlueprintAccess", "CreateStringMetaSoundLiteral", SDK::Params::MetasoundFrontendLiteralBlueprintAccess_CreateStringMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundGeneratorHandle, CreateMetaSoundGeneratorHandle, "MetasoundGeneratorHandle", "CreateMetaSoundGeneratorHandle", SDK::Params::MetasoundGeneratorHandle_CreateMetaSoundGeneratorHandle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundGeneratorHandle, ApplyParameterPack, "MetasoundGeneratorHandle", "ApplyParameterPack", SDK::Params::MetasoundGeneratorHandle_ApplyParameterPack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundGeneratorHandle, WatchOutput, "MetasoundGeneratorHandle", "WatchOutput", SDK::Params::MetasoundGeneratorHandle_WatchOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundGeneratorHandle, EnableRuntimeRenderTiming, "MetasoundGeneratorHandle", "EnableRuntimeRenderTiming", SDK::Params::MetasoundGeneratorHandle_EnableRuntimeRenderTiming)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundGeneratorHandle, GetCPUCoreUtilization, "MetasoundGeneratorHandle", "GetCPUCoreUtilization", SDK::Params::MetasoundGeneratorHandle_GetCPUCoreUtilization)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundGeneratorHandle, UpdateWatchers, "MetasoundGeneratorHandle", "UpdateWatchers", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundCacheSubsystem, PrecacheMetaSound, "MetaSoundCacheSubsystem", "PrecacheMetaSound", SDK::Params::MetaSoundCacheSubsystem_PrecacheMetaSound)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundCacheSubsystem, RemoveCachedOperatorsForMetaSound, "MetaSoundCacheSubsystem", "RemoveCachedOperatorsForMetaSound", SDK::Params::MetaSoundCacheSubsystem_RemoveCachedOperatorsForMetaSound)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundCacheSubsystem, TouchOrPrecacheMetaSound, "MetaSoundCacheSubsystem", "TouchOrPrecacheMetaSound", SDK::Params::MetaSoundCacheSubsystem_TouchOrPrecacheMetaSound)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, GetBool, "MetasoundOutputBlueprintAccess", "GetBool", SDK::Params::MetasoundOutputBlueprintAccess_GetBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, GetFloat, "MetasoundOutputBlueprintAccess", "GetFloat", SDK::Params::MetasoundOutputBlueprintAccess_GetFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, GetInt32, "MetasoundOutputBlueprintAccess", "GetInt32", SDK::Params::MetasoundOutputBlueprintAccess_GetInt32)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, GetString, "MetasoundOutputBlueprintAccess", "GetString", SDK::Params::MetasoundOutputBlueprintAccess_GetString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, GetTimeSeconds, "MetasoundOutputBlueprintAccess", "GetTimeSeconds", SDK::Params::MetasoundOutputBlueprintAccess_GetTimeSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, IsBool, "MetasoundOutputBlueprintAccess", "IsBool", SDK::Params::MetasoundOutputBlueprintAccess_IsBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, IsFloat, "MetasoundOutputBlueprintAccess", "IsFloat", SDK::Params::MetasoundOutputBlueprintAccess_IsFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, IsInt32, "MetasoundOutputBlueprintAccess", "IsInt32", SDK::Params::MetasoundOutputBlueprintAccess_IsInt32)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, IsString, "MetasoundOutputBlueprintAccess", "IsString", SDK::Params::MetasoundOutputBlueprintAccess_IsString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundOutputBlueprintAccess, IsTime, "MetasoundOutputBlueprintAccess", "IsTime", SDK::Params::MetasoundOutputBlueprintAccess_IsTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundOutputSubsystem, WatchOutput, "MetaSoundOutputSubsystem", "WatchOutput", SDK::Params::MetaSoundOutputSubsystem_WatchOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundQualityHelper, GetQualityList, "MetaSoundQualityHelper", "GetQualityList", SDK::Params::MetaSoundQualityHelper_GetQualityList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundAssetSubsystem, RegisterAssetClassesInDirectories, "MetaSoundAssetSubsystem", "RegisterAssetClassesInDirectories", SDK::Params::MetaSoundAssetSubsystem_RegisterAssetClassesInDirectories)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundAssetSubsystem, UnregisterAssetClassesInDirectories, "MetaSoundAssetSubsystem", "UnregisterAssetClassesInDirectories", SDK::Params::MetaSoundAssetSubsystem_UnregisterAssetClassesInDirectories)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, AddGraphInputNode, "MetaSoundBuilderBase", "AddGraphInputNode", SDK::Params::MetaSoundBuilderBase_AddGraphInputNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, AddGraphOutputNode, "MetaSoundBuilderBase", "AddGraphOutputNode", SDK::Params::MetaSoundBuilderBase_AddGraphOutputNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, AddInterface, "MetaSoundBuilderBase", "AddInterface", SDK::Params::MetaSoundBuilderBase_AddInterface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, AddNode, "MetaSoundBuilderBase", "AddNode", SDK::Params::MetaSoundBuilderBase_AddNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, AddNodeByClassName, "MetaSoundBuilderBase", "AddNodeByClassName", SDK::Params::MetaSoundBuilderBase_AddNodeByClassName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ConnectNodeInputsToMatchingGraphInterfaceInputs, "MetaSoundBuilderBase", "ConnectNodeInputsToMatchingGraphInterfaceInputs", SDK::Params::MetaSoundBuilderBase_ConnectNodeInputsToMatchingGraphInterfaceInputs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ConnectNodeInputToGraphInput, "MetaSoundBuilderBase", "ConnectNodeInputToGraphInput", SDK::Params::MetaSoundBuilderBase_ConnectNodeInputToGraphInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ConnectNodeOutputsToMatchingGraphInterfaceOutputs, "MetaSoundBuilderBase", "ConnectNodeOutputsToMatchingGraphInterfaceOutputs", SDK::Params::MetaSoundBuilderBase_ConnectNodeOutputsToMatchingGraphInterfaceOutputs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ConnectNodeOutputToGraphOutput, "MetaSoundBuilderBase", "ConnectNodeOutputToGraphOutput", SDK::Params::MetaSoundBuilderBase_ConnectNodeOutputToGraphOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ConnectNodes, "MetaSoundBuilderBase", "ConnectNodes", SDK::Params::MetaSoundBuilderBase_ConnectNodes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ConnectNodesByInterfaceBindings, "MetaSoundBuilderBase", "ConnectNodesByInterfaceBindings", SDK::Params::MetaSoundBuilderBase_ConnectNodesByInterfaceBindings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ConvertFromPreset, "MetaSoundBuilderBase", "ConvertFromPreset", SDK::Params::MetaSoundBuilderBase_ConvertFromPreset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ConvertToPreset, "MetaSoundBuilderBase", "ConvertToPreset", SDK::Params::MetaSoundBuilderBase_ConvertToPreset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, DisconnectNodeInput, "MetaSoundBuilderBase", "DisconnectNodeInput", SDK::Params::MetaSoundBuilderBase_DisconnectNodeInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, DisconnectNodeOutput, "MetaSoundBuilderBase", "DisconnectNodeOutput", SDK::Params::MetaSoundBuilderBase_DisconnectNodeOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, DisconnectNodes, "MetaSoundBuilderBase", "DisconnectNodes", SDK::Params::MetaSoundBuilderBase_DisconnectNodes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, DisconnectNodesByInterfaceBindings, "MetaSoundBuilderBase", "DisconnectNodesByInterfaceBindings", SDK::Params::MetaSoundBuilderBase_DisconnectNodesByInterfaceBindings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindGraphInputNode, "MetaSoundBuilderBase", "FindGraphInputNode", SDK::Params::MetaSoundBuilderBase_FindGraphInputNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindGraphOutputNode, "MetaSoundBuilderBase", "FindGraphOutputNode", SDK::Params::MetaSoundBuilderBase_FindGraphOutputNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindInterfaceInputNodes, "MetaSoundBuilderBase", "FindInterfaceInputNodes", SDK::Params::MetaSoundBuilderBase_FindInterfaceInputNodes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindInterfaceOutputNodes, "MetaSoundBuilderBase", "FindInterfaceOutputNodes", SDK::Params::MetaSoundBuilderBase_FindInterfaceOutputNodes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeClassVersion, "MetaSoundBuilderBase", "FindNodeClassVersion", SDK::Params::MetaSoundBuilderBase_FindNodeClassVersion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeInputByName, "MetaSoundBuilderBase", "FindNodeInputByName", SDK::Params::MetaSoundBuilderBase_FindNodeInputByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeInputParent, "MetaSoundBuilderBase", "FindNodeInputParent", SDK::Params::MetaSoundBuilderBase_FindNodeInputParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeInputs, "MetaSoundBuilderBase", "FindNodeInputs", SDK::Params::MetaSoundBuilderBase_FindNodeInputs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeInputsByDataType, "MetaSoundBuilderBase", "FindNodeInputsByDataType", SDK::Params::MetaSoundBuilderBase_FindNodeInputsByDataType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeOutputByName, "MetaSoundBuilderBase", "FindNodeOutputByName", SDK::Params::MetaSoundBuilderBase_FindNodeOutputByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeOutputParent, "MetaSoundBuilderBase", "FindNodeOutputParent", SDK::Params::MetaSoundBuilderBase_FindNodeOutputParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeOutputs, "MetaSoundBuilderBase", "FindNodeOutputs", SDK::Params::MetaSoundBuilderBase_FindNodeOutputs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, FindNodeOutputsByDataType, "MetaSoundBuilderBase", "FindNodeOutputsByDataType", SDK::Params::MetaSoundBuilderBase_FindNodeOutputsByDataType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, GetNodeInputClassDefault, "MetaSoundBuilderBase", "GetNodeInputClassDefault", SDK::Params::MetaSoundBuilderBase_GetNodeInputClassDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, GetNodeInputData, "MetaSoundBuilderBase", "GetNodeInputData", SDK::Params::MetaSoundBuilderBase_GetNodeInputData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, GetNodeInputDefault, "MetaSoundBuilderBase", "GetNodeInputDefault", SDK::Params::MetaSoundBuilderBase_GetNodeInputDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, GetNodeOutputData, "MetaSoundBuilderBase", "GetNodeOutputData", SDK::Params::MetaSoundBuilderBase_GetNodeOutputData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, RemoveGraphInput, "MetaSoundBuilderBase", "RemoveGraphInput", SDK::Params::MetaSoundBuilderBase_RemoveGraphInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, RemoveGraphOutput, "MetaSoundBuilderBase", "RemoveGraphOutput", SDK::Params::MetaSoundBuilderBase_RemoveGraphOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, RemoveInterface, "MetaSoundBuilderBase", "RemoveInterface", SDK::Params::MetaSoundBuilderBase_RemoveInterface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, RemoveNode, "MetaSoundBuilderBase", "RemoveNode", SDK::Params::MetaSoundBuilderBase_RemoveNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, RemoveNodeInputDefault, "MetaSoundBuilderBase", "RemoveNodeInputDefault", SDK::Params::MetaSoundBuilderBase_RemoveNodeInputDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, SetGraphInputDefault, "MetaSoundBuilderBase", "SetGraphInputDefault", SDK::Params::MetaSoundBuilderBase_SetGraphInputDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, SetNodeInputDefault, "MetaSoundBuilderBase", "SetNodeInputDefault", SDK::Params::MetaSoundBuilderBase_SetNodeInputDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ContainsNode, "MetaSoundBuilderBase", "ContainsNode", SDK::Params::MetaSoundBuilderBase_ContainsNode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ContainsNodeInput, "MetaSoundBuilderBase", "ContainsNodeInput", SDK::Params::MetaSoundBuilderBase_ContainsNodeInput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, ContainsNodeOutput, "MetaSoundBuilderBase", "ContainsNodeOutput", SDK::Params::MetaSoundBuilderBase_ContainsNodeOutput)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, GetNodeInputIsConstructorPin, "MetaSoundBuilderBase", "GetNodeInputIsConstructorPin", SDK::Params::MetaSoundBuilderBase_GetNodeInputIsConstructorPin)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, GetNodeOutputIsConstructorPin, "MetaSoundBuilderBase", "GetNodeOutputIsConstructorPin", SDK::Params::MetaSoundBuilderBase_GetNodeOutputIsConstructorPin)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, GetReferencedPresetAsset, "MetaSoundBuilderBase", "GetReferencedPresetAsset", SDK::Params::MetaSoundBuilderBase_GetReferencedPresetAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, InterfaceIsDeclared, "MetaSoundBuilderBase", "InterfaceIsDeclared", SDK::Params::MetaSoundBuilderBase_InterfaceIsDeclared)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, IsPreset, "MetaSoundBuilderBase", "IsPreset", SDK::Params::MetaSoundBuilderBase_IsPreset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, NodeInputIsConnected, "MetaSoundBuilderBase", "NodeInputIsConnected", SDK::Params::MetaSoundBuilderBase_NodeInputIsConnected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, NodeOutputIsConnected, "MetaSoundBuilderBase", "NodeOutputIsConnected", SDK::Params::MetaSoundBuilderBase_NodeOutputIsConnected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderBase, NodesAreConnected, "MetaSoundBuilderBase", "NodesAreConnected", SDK::Params::MetaSoundBuilderBase_NodesAreConnected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundPatchBuilder, Build, "MetaSoundPatchBuilder", "Build", SDK::Params::MetaSoundPatchBuilder_Build)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundSourceBuilder, Audition, "MetaSoundSourceBuilder", "Audition", SDK::Params::MetaSoundSourceBuilder_Audition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundSourceBuilder, SetBlockRateOverride, "MetaSoundSourceBuilder", "SetBlockRateOverride", SDK::Params::MetaSoundSourceBuilder_SetBlockRateOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundSourceBuilder, SetFormat, "MetaSoundSourceBuilder", "SetFormat", SDK::Params::MetaSoundSourceBuilder_SetFormat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundSourceBuilder, SetQuality, "MetaSoundSourceBuilder", "SetQuality", SDK::Params::MetaSoundSourceBuilder_SetQuality)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundSourceBuilder, SetSampleRateOverride, "MetaSoundSourceBuilder", "SetSampleRateOverride", SDK::Params::MetaSoundSourceBuilder_SetSampleRateOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundSourceBuilder, Build, "MetaSoundSourceBuilder", "Build", SDK::Params::MetaSoundSourceBuilder_Build)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundSourceBuilder, GetLiveUpdatesEnabled, "MetaSoundSourceBuilder", "GetLiveUpdatesEnabled", SDK::Params::MetaSoundSourceBuilder_GetLiveUpdatesEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateBoolArrayMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateBoolArrayMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateBoolArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateBoolMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateBoolMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateBoolMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateFloatArrayMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateFloatArrayMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateFloatArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateFloatMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateFloatMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateFloatMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateIntArrayMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateIntArrayMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateIntArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateIntMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateIntMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateIntMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateMetaSoundLiteralFromParam, "MetaSoundBuilderSubsystem", "CreateMetaSoundLiteralFromParam", SDK::Params::MetaSoundBuilderSubsystem_CreateMetaSoundLiteralFromParam)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateObjectArrayMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateObjectArrayMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateObjectArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateObjectMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateObjectMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateObjectMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreatePatchBuilder, "MetaSoundBuilderSubsystem", "CreatePatchBuilder", SDK::Params::MetaSoundBuilderSubsystem_CreatePatchBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreatePatchPresetBuilder, "MetaSoundBuilderSubsystem", "CreatePatchPresetBuilder", SDK::Params::MetaSoundBuilderSubsystem_CreatePatchPresetBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateSourceBuilder, "MetaSoundBuilderSubsystem", "CreateSourceBuilder", SDK::Params::MetaSoundBuilderSubsystem_CreateSourceBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateSourcePresetBuilder, "MetaSoundBuilderSubsystem", "CreateSourcePresetBuilder", SDK::Params::MetaSoundBuilderSubsystem_CreateSourcePresetBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateStringArrayMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateStringArrayMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateStringArrayMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, CreateStringMetaSoundLiteral, "MetaSoundBuilderSubsystem", "CreateStringMetaSoundLiteral", SDK::Params::MetaSoundBuilderSubsystem_CreateStringMetaSoundLiteral)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, FindBuilder, "MetaSoundBuilderSubsystem", "FindBuilder", SDK::Params::MetaSoundBuilderSubsystem_FindBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, FindPatchBuilder, "MetaSoundBuilderSubsystem", "FindPatchBuilder", SDK::Params::MetaSoundBuilderSubsystem_FindPatchBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, FindSourceBuilder, "MetaSoundBuilderSubsystem", "FindSourceBuilder", SDK::Params::MetaSoundBuilderSubsystem_FindSourceBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, RegisterBuilder, "MetaSoundBuilderSubsystem", "RegisterBuilder", SDK::Params::MetaSoundBuilderSubsystem_RegisterBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, RegisterPatchBuilder, "MetaSoundBuilderSubsystem", "RegisterPatchBuilder", SDK::Params::MetaSoundBuilderSubsystem_RegisterPatchBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, RegisterSourceBuilder, "MetaSoundBuilderSubsystem", "RegisterSourceBuilder", SDK::Params::MetaSoundBuilderSubsystem_RegisterSourceBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, UnregisterBuilder, "MetaSoundBuilderSubsystem", "UnregisterBuilder", SDK::Params::MetaSoundBuilderSubsystem_UnregisterBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, UnregisterPatchBuilder, "MetaSoundBuilderSubsystem", "UnregisterPatchBuilder", SDK::Params::MetaSoundBuilderSubsystem_UnregisterPatchBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, UnregisterSourceBuilder, "MetaSoundBuilderSubsystem", "UnregisterSourceBuilder", SDK::Params::MetaSoundBuilderSubsystem_UnregisterSourceBuilder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, FindBuilderOfDocument, "MetaSoundBuilderSubsystem", "FindBuilderOfDocument", SDK::Params::MetaSoundBuilderSubsystem_FindBuilderOfDocument)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetaSoundBuilderSubsystem, IsInterfaceRegistered, "MetaSoundBuilderSubsystem", "IsInterfaceRegistered", SDK::Params::MetaSoundBuilderSubsystem_IsInterfaceRegistered)
+// clang-format on
@@ -0,0 +1,28 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MetasoundFrontend_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MetasoundFrontend_classes.hpp"
+#include "../SDK/MetasoundFrontend_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, MakeMetasoundParameterPack, "MetasoundParameterPack", "MakeMetasoundParameterPack", SDK::Params::MetasoundParameterPack_MakeMetasoundParameterPack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, SetBool, "MetasoundParameterPack", "SetBool", SDK::Params::MetasoundParameterPack_SetBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, SetFloat, "MetasoundParameterPack", "SetFloat", SDK::Params::MetasoundParameterPack_SetFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, SetInt, "MetasoundParameterPack", "SetInt", SDK::Params::MetasoundParameterPack_SetInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, SetString, "MetasoundParameterPack", "SetString", SDK::Params::MetasoundParameterPack_SetString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, SetTrigger, "MetasoundParameterPack", "SetTrigger", SDK::Params::MetasoundParameterPack_SetTrigger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, GetBool, "MetasoundParameterPack", "GetBool", SDK::Params::MetasoundParameterPack_GetBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, GetFloat, "MetasoundParameterPack", "GetFloat", SDK::Params::MetasoundParameterPack_GetFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, GetInt, "MetasoundParameterPack", "GetInt", SDK::Params::MetasoundParameterPack_GetInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, GetString, "MetasoundParameterPack", "GetString", SDK::Params::MetasoundParameterPack_GetString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, GetTrigger, "MetasoundParameterPack", "GetTrigger", SDK::Params::MetasoundParameterPack_GetTrigger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, HasBool, "MetasoundParameterPack", "HasBool", SDK::Params::MetasoundParameterPack_HasBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, HasFloat, "MetasoundParameterPack", "HasFloat", SDK::Params::MetasoundParameterPack_HasFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, HasInt, "MetasoundParameterPack", "HasInt", SDK::Params::MetasoundParameterPack_HasInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, HasString, "MetasoundParameterPack", "HasString", SDK::Params::MetasoundParameterPack_HasString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMetasoundParameterPack, HasTrigger, "MetasoundParameterPack", "HasTrigger", SDK::Params::MetasoundParameterPack_HasTrigger)
+// clang-format on
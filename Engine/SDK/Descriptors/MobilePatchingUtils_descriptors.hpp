@@ -0,0 +1,27 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MobilePatchingUtils_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MobilePatchingUtils_classes.hpp"
+#include "../SDK/MobilePatchingUtils_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobileInstalledContent, GetDiskFreeSpace, "MobileInstalledContent", "GetDiskFreeSpace", SDK::Params::MobileInstalledContent_GetDiskFreeSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobileInstalledContent, GetInstalledContentSize, "MobileInstalledContent", "GetInstalledContentSize", SDK::Params::MobileInstalledContent_GetInstalledContentSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobileInstalledContent, Mount, "MobileInstalledContent", "Mount", SDK::Params::MobileInstalledContent_Mount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePendingContent, GetDownloadSize, "MobilePendingContent", "GetDownloadSize", SDK::Params::MobilePendingContent_GetDownloadSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePendingContent, GetDownloadSpeed, "MobilePendingContent", "GetDownloadSpeed", SDK::Params::MobilePendingContent_GetDownloadSpeed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePendingContent, GetDownloadStatusText, "MobilePendingContent", "GetDownloadStatusText", SDK::Params::MobilePendingContent_GetDownloadStatusText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePendingContent, GetInstallProgress, "MobilePendingContent", "GetInstallProgress", SDK::Params::MobilePendingContent_GetInstallProgress)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePendingContent, GetRequiredDiskSpace, "MobilePendingContent", "GetRequiredDiskSpace", SDK::Params::MobilePendingContent_GetRequiredDiskSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePendingContent, GetTotalDownloadedSize, "MobilePendingContent", "GetTotalDownloadedSize", SDK::Params::MobilePendingContent_GetTotalDownloadedSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePendingContent, StartInstall, "MobilePendingContent", "StartInstall", SDK::Params::MobilePendingContent_StartInstall)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePatchingLibrary, GetActiveDeviceProfileName, "MobilePatchingLibrary", "GetActiveDeviceProfileName", SDK::Params::MobilePatchingLibrary_GetActiveDeviceProfileName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePatchingLibrary, GetInstalledContent, "MobilePatchingLibrary", "GetInstalledContent", SDK::Params::MobilePatchingLibrary_GetInstalledContent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePatchingLibrary, GetSupportedPlatformNames, "MobilePatchingLibrary", "GetSupportedPlatformNames", SDK::Params::MobilePatchingLibrary_GetSupportedPlatformNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePatchingLibrary, HasActiveWiFiConnection, "MobilePatchingLibrary", "HasActiveWiFiConnection", SDK::Params::MobilePatchingLibrary_HasActiveWiFiConnection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMobilePatchingLibrary, RequestContent, "MobilePatchingLibrary", "RequestContent", SDK::Params::MobilePatchingLibrary_RequestContent)
+// clang-format on
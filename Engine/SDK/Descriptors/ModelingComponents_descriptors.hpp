@@ -0,0 +1,45 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModelingComponents_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModelingComponents_classes.hpp"
+#include "../SDK/ModelingComponents_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshTopologySelectionMechanicProperties, InvertSelection, "MeshTopologySelectionMechanicProperties", "InvertSelection", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMeshTopologySelectionMechanicProperties, SelectAll, "MeshTopologySelectionMechanicProperties", "SelectAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOctreeDynamicMeshComponent, SetDynamicMesh, "OctreeDynamicMeshComponent", "SetDynamicMesh", SDK::Params::OctreeDynamicMeshComponent_SetDynamicMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, AddLineSet, "PreviewGeometry", "AddLineSet", SDK::Params::PreviewGeometry_AddLineSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, AddPointSet, "PreviewGeometry", "AddPointSet", SDK::Params::PreviewGeometry_AddPointSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, AddTriangleSet, "PreviewGeometry", "AddTriangleSet", SDK::Params::PreviewGeometry_AddTriangleSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, CreateInWorld, "PreviewGeometry", "CreateInWorld", SDK::Params::PreviewGeometry_CreateInWorld)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, Disconnect, "PreviewGeometry", "Disconnect", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, FindLineSet, "PreviewGeometry", "FindLineSet", SDK::Params::PreviewGeometry_FindLineSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, FindPointSet, "PreviewGeometry", "FindPointSet", SDK::Params::PreviewGeometry_FindPointSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, FindTriangleSet, "PreviewGeometry", "FindTriangleSet", SDK::Params::PreviewGeometry_FindTriangleSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, RemoveAllLineSets, "PreviewGeometry", "RemoveAllLineSets", SDK::Params::PreviewGeometry_RemoveAllLineSets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, RemoveAllPointSets, "PreviewGeometry", "RemoveAllPointSets", SDK::Params::PreviewGeometry_RemoveAllPointSets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, RemoveAllTriangleSets, "PreviewGeometry", "RemoveAllTriangleSets", SDK::Params::PreviewGeometry_RemoveAllTriangleSets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, RemoveLineSet, "PreviewGeometry", "RemoveLineSet", SDK::Params::PreviewGeometry_RemoveLineSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, RemovePointSet, "PreviewGeometry", "RemovePointSet", SDK::Params::PreviewGeometry_RemovePointSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, RemoveTriangleSet, "PreviewGeometry", "RemoveTriangleSet", SDK::Params::PreviewGeometry_RemoveTriangleSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, SetAllLineSetsMaterial, "PreviewGeometry", "SetAllLineSetsMaterial", SDK::Params::PreviewGeometry_SetAllLineSetsMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, SetAllPointSetsMaterial, "PreviewGeometry", "SetAllPointSetsMaterial", SDK::Params::PreviewGeometry_SetAllPointSetsMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, SetLineSetMaterial, "PreviewGeometry", "SetLineSetMaterial", SDK::Params::PreviewGeometry_SetLineSetMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, SetLineSetVisibility, "PreviewGeometry", "SetLineSetVisibility", SDK::Params::PreviewGeometry_SetLineSetVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, SetPointSetMaterial, "PreviewGeometry", "SetPointSetMaterial", SDK::Params::PreviewGeometry_SetPointSetMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, SetPointSetVisibility, "PreviewGeometry", "SetPointSetVisibility", SDK::Params::PreviewGeometry_SetPointSetVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPreviewGeometry, GetActor, "PreviewGeometry", "GetActor", SDK::Params::PreviewGeometry_GetActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModelingObjectsCreationAPI, CreateMaterialObject, "ModelingObjectsCreationAPI", "CreateMaterialObject", SDK::Params::ModelingObjectsCreationAPI_CreateMaterialObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModelingObjectsCreationAPI, CreateMeshObject, "ModelingObjectsCreationAPI", "CreateMeshObject", SDK::Params::ModelingObjectsCreationAPI_CreateMeshObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModelingObjectsCreationAPI, CreateNewActor, "ModelingObjectsCreationAPI", "CreateNewActor", SDK::Params::ModelingObjectsCreationAPI_CreateNewActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModelingObjectsCreationAPI, CreateTextureObject, "ModelingObjectsCreationAPI", "CreateTextureObject", SDK::Params::ModelingObjectsCreationAPI_CreateTextureObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreateMeshObjectTypeProperties, GetOutputTypeNamesFunc, "CreateMeshObjectTypeProperties", "GetOutputTypeNamesFunc", SDK::Params::CreateMeshObjectTypeProperties_GetOutputTypeNamesFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreateMeshObjectTypeProperties, GetCurrentCreateMeshType, "CreateMeshObjectTypeProperties", "GetCurrentCreateMeshType", SDK::Params::CreateMeshObjectTypeProperties_GetCurrentCreateMeshType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreateMeshObjectTypeProperties, ShouldShowPropertySet, "CreateMeshObjectTypeProperties", "ShouldShowPropertySet", SDK::Params::CreateMeshObjectTypeProperties_ShouldShowPropertySet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPolygroupLayersProperties, GetGroupLayersFunc, "PolygroupLayersProperties", "GetGroupLayersFunc", SDK::Params::PolygroupLayersProperties_GetGroupLayersFunc)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWeightMapSetProperties, GetWeightMapsFunc, "WeightMapSetProperties", "GetWeightMapsFunc", SDK::Params::WeightMapSetProperties_GetWeightMapsFunc)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_Axe2H_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_Axe2H_classes.hpp"
+#include "../SDK/ModularWeaponBP_Axe2H_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Axe2H_C, BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_Axe2H_C", "BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_Axe2H_C_BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Axe2H_C, BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_Axe2H_C", "BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_Axe2H_C_BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Axe2H_C, ExecuteUbergraph_ModularWeaponBP_Axe2H, "ModularWeaponBP_Axe2H_C", "ExecuteUbergraph_ModularWeaponBP_Axe2H", SDK::Params::ModularWeaponBP_Axe2H_C_ExecuteUbergraph_ModularWeaponBP_Axe2H)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Axe2H_C, UserConstructionScript, "ModularWeaponBP_Axe2H_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_Billhook_B_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_Billhook_B_classes.hpp"
+#include "../SDK/ModularWeaponBP_Billhook_B_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Billhook_B_C, BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_Billhook_B_C", "BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_Billhook_B_C_BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Billhook_B_C, BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_Billhook_B_C", "BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_Billhook_B_C_BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Billhook_B_C, ExecuteUbergraph_ModularWeaponBP_Billhook_B, "ModularWeaponBP_Billhook_B_C", "ExecuteUbergraph_ModularWeaponBP_Billhook_B", SDK::Params::ModularWeaponBP_Billhook_B_C_ExecuteUbergraph_ModularWeaponBP_Billhook_B)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Billhook_B_C, UserConstructionScript, "ModularWeaponBP_Billhook_B_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_Halberd_D_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_Halberd_D_classes.hpp"
+#include "../SDK/ModularWeaponBP_Halberd_D_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Halberd_D_C, BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_Halberd_D_C", "BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_Halberd_D_C_BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Halberd_D_C, BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_Halberd_D_C", "BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_Halberd_D_C_BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Halberd_D_C, ExecuteUbergraph_ModularWeaponBP_Halberd_D, "ModularWeaponBP_Halberd_D_C", "ExecuteUbergraph_ModularWeaponBP_Halberd_D", SDK::Params::ModularWeaponBP_Halberd_D_C_ExecuteUbergraph_ModularWeaponBP_Halberd_D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Halberd_D_C, UserConstructionScript, "ModularWeaponBP_Halberd_D_C", "UserConstructionScript", void)
+// clang-format on
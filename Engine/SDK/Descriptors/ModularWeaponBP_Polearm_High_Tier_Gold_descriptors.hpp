@@ -0,0 +1,12 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_Polearm_High_Tier_Gold_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_Polearm_High_Tier_Gold_classes.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Polearm_High_Tier_Gold_C, UserConstructionScript, "ModularWeaponBP_Polearm_High_Tier_Gold_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_Polearm_High_Tier_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_Polearm_High_Tier_classes.hpp"
+#include "../SDK/ModularWeaponBP_Polearm_High_Tier_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Polearm_High_Tier_C, UserConstructionScript, "ModularWeaponBP_Polearm_High_Tier_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_Rondel_Gold_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_Rondel_Gold_classes.hpp"
+#include "../SDK/ModularWeaponBP_Rondel_Gold_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Rondel_Gold_C, BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_Rondel_Gold_C", "BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_Rondel_Gold_C_BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Rondel_Gold_C, ExecuteUbergraph_ModularWeaponBP_Rondel_Gold, "ModularWeaponBP_Rondel_Gold_C", "ExecuteUbergraph_ModularWeaponBP_Rondel_Gold", SDK::Params::ModularWeaponBP_Rondel_Gold_C_ExecuteUbergraph_ModularWeaponBP_Rondel_Gold)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Rondel_Gold_C, ReceiveBeginPlay, "ModularWeaponBP_Rondel_Gold_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Rondel_Gold_C, UserConstructionScript, "ModularWeaponBP_Rondel_Gold_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_Rondel_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_Rondel_classes.hpp"
+#include "../SDK/ModularWeaponBP_Rondel_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Rondel_C, BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_Rondel_C", "BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_Rondel_C_BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Rondel_C, ExecuteUbergraph_ModularWeaponBP_Rondel, "ModularWeaponBP_Rondel_C", "ExecuteUbergraph_ModularWeaponBP_Rondel", SDK::Params::ModularWeaponBP_Rondel_C_ExecuteUbergraph_ModularWeaponBP_Rondel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Rondel_C, ReceiveBeginPlay, "ModularWeaponBP_Rondel_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_Rondel_C, UserConstructionScript, "ModularWeaponBP_Rondel_C", "UserConstructionScript", void)
+// clang-format on
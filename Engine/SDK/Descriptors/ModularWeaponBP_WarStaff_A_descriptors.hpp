@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_WarStaff_A_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_WarStaff_A_classes.hpp"
+#include "../SDK/ModularWeaponBP_WarStaff_A_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_WarStaff_A_C, BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_WarStaff_A_C", "BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_WarStaff_A_C_BndEvt__ModularWeaponBP_Axe_Blade_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_WarStaff_A_C, BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_WarStaff_A_C", "BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_WarStaff_A_C_BndEvt__ModularWeaponBP_Axe_Grip_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_WarStaff_A_C, ExecuteUbergraph_ModularWeaponBP_WarStaff_A, "ModularWeaponBP_WarStaff_A_C", "ExecuteUbergraph_ModularWeaponBP_WarStaff_A", SDK::Params::ModularWeaponBP_WarStaff_A_C_ExecuteUbergraph_ModularWeaponBP_WarStaff_A)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_WarStaff_A_C, UserConstructionScript, "ModularWeaponBP_WarStaff_A_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,38 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ModularWeaponBP_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ModularWeaponBP_classes.hpp"
+#include "../SDK/ModularWeaponBP_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, BndEvt__ModularWeaponBP_BaseMesh_K2Node_ComponentBoundEvent_3_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_C", "BndEvt__ModularWeaponBP_BaseMesh_K2Node_ComponentBoundEvent_3_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_C_BndEvt__ModularWeaponBP_BaseMesh_K2Node_ComponentBoundEvent_3_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, BndEvt__ModularWeaponBP_Grip_K2Node_ComponentBoundEvent_2_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_C", "BndEvt__ModularWeaponBP_Grip_K2Node_ComponentBoundEvent_2_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_C_BndEvt__ModularWeaponBP_Grip_K2Node_ComponentBoundEvent_2_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, BndEvt__ModularWeaponBP_Guard_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_C", "BndEvt__ModularWeaponBP_Guard_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_C_BndEvt__ModularWeaponBP_Guard_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, BndEvt__ModularWeaponBP_Head_SubModule_1_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_C", "BndEvt__ModularWeaponBP_Head SubModule 1_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_C_BndEvt__ModularWeaponBP_Head_SubModule_1_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, BndEvt__ModularWeaponBP_Head_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_C", "BndEvt__ModularWeaponBP_Head_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_C_BndEvt__ModularWeaponBP_Head_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, BndEvt__ModularWeaponBP_Pommel_K2Node_ComponentBoundEvent_3_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_C", "BndEvt__ModularWeaponBP_Pommel_K2Node_ComponentBoundEvent_3_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_C_BndEvt__ModularWeaponBP_Pommel_K2Node_ComponentBoundEvent_3_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, BndEvt__ModularWeaponBP_SubModule_2_K2Node_ComponentBoundEvent_5_ComponentHitSignature__DelegateSignature, "ModularWeaponBP_C", "BndEvt__ModularWeaponBP_SubModule 2_K2Node_ComponentBoundEvent_5_ComponentHitSignature__DelegateSignature", SDK::Params::ModularWeaponBP_C_BndEvt__ModularWeaponBP_SubModule_2_K2Node_ComponentBoundEvent_5_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Clear_Stuck_Bone, "ModularWeaponBP_C", "Clear Stuck Bone", SDK::Params::ModularWeaponBP_C_Clear_Stuck_Bone)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Collision_Hit, "ModularWeaponBP_C", "Collision Hit", SDK::Params::ModularWeaponBP_C_Collision_Hit)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Event_Enable_Last_Parent_Collision, "ModularWeaponBP_C", "Event Enable Last Parent Collision", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, ExecuteUbergraph_ModularWeaponBP, "ModularWeaponBP_C", "ExecuteUbergraph_ModularWeaponBP", SDK::Params::ModularWeaponBP_C_ExecuteUbergraph_ModularWeaponBP)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, GGAGA, "ModularWeaponBP_C", "GGAGA", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, ReceiveBeginPlay, "ModularWeaponBP_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, ReceiveTick, "ModularWeaponBP_C", "ReceiveTick", SDK::Params::ModularWeaponBP_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Refresh_Collisions, "ModularWeaponBP_C", "Refresh Collisions", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Release_All_Jammed_Bones, "ModularWeaponBP_C", "Release All Jammed Bones", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Set_Up_Module, "ModularWeaponBP_C", "Set Up Module", SDK::Params::ModularWeaponBP_C_Set_Up_Module)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Sheathed_Mode, "ModularWeaponBP_C", "Sheathed Mode", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Spawn_Module, "ModularWeaponBP_C", "Spawn Module", SDK::Params::ModularWeaponBP_C_Spawn_Module)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Temporary_Disable_Damage, "ModularWeaponBP_C", "Temporary Disable Damage", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Turn_Off_Collision, "ModularWeaponBP_C", "Turn Off Collision", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Turn_On_Collision, "ModularWeaponBP_C", "Turn On Collision", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Unsheathed_Mode, "ModularWeaponBP_C", "Unsheathed Mode", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, UserConstructionScript, "ModularWeaponBP_C", "UserConstructionScript", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Vertex_Paint, "ModularWeaponBP_C", "Vertex Paint", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModularWeaponBP_C, Weapon_HIt, "ModularWeaponBP_C", "Weapon HIt", SDK::Params::ModularWeaponBP_C_Weapon_HIt)
+// clang-format on
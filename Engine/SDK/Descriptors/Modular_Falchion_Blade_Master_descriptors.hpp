@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Modular_Falchion_Blade_Master_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Modular_Falchion_Blade_Master_classes.hpp"
+#include "../SDK/Modular_Falchion_Blade_Master_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Falchion_Blade_Master_C, ExecuteUbergraph_Modular_Falchion_Blade_Master, "Modular_Falchion_Blade_Master_C", "ExecuteUbergraph_Modular_Falchion_Blade_Master", SDK::Params::Modular_Falchion_Blade_Master_C_ExecuteUbergraph_Modular_Falchion_Blade_Master)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Falchion_Blade_Master_C, ReceiveBeginPlay, "Modular_Falchion_Blade_Master_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Falchion_Blade_Master_C, ReceiveTick, "Modular_Falchion_Blade_Master_C", "ReceiveTick", SDK::Params::Modular_Falchion_Blade_Master_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Falchion_Blade_Master_C, UserConstructionScript, "Modular_Falchion_Blade_Master_C", "UserConstructionScript", void)
+// clang-format on
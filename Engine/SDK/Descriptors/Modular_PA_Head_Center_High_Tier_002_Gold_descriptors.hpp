@@ -0,0 +1,12 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Modular_PA_Head_Center_High_Tier_002_Gold_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Modular_PA_Head_Center_High_Tier_002_Gold_classes.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_PA_Head_Center_High_Tier_002_Gold_C, UserConstructionScript, "Modular_PA_Head_Center_High_Tier_002_Gold_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Modular_Sword_Guard_Master_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Modular_Sword_Guard_Master_classes.hpp"
+#include "../SDK/Modular_Sword_Guard_Master_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Sword_Guard_Master_C, ExecuteUbergraph_Modular_Sword_Guard_Master, "Modular_Sword_Guard_Master_C", "ExecuteUbergraph_Modular_Sword_Guard_Master", SDK::Params::Modular_Sword_Guard_Master_C_ExecuteUbergraph_Modular_Sword_Guard_Master)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Sword_Guard_Master_C, ReceiveTick, "Modular_Sword_Guard_Master_C", "ReceiveTick", SDK::Params::Modular_Sword_Guard_Master_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Sword_Guard_Master_C, UserConstructionScript, "Modular_Sword_Guard_Master_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Modular_Weapon_Grip_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Modular_Weapon_Grip_classes.hpp"
+#include "../SDK/Modular_Weapon_Grip_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Weapon_Grip_C, ExecuteUbergraph_Modular_Weapon_Grip, "Modular_Weapon_Grip_C", "ExecuteUbergraph_Modular_Weapon_Grip", SDK::Params::Modular_Weapon_Grip_C_ExecuteUbergraph_Modular_Weapon_Grip)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Weapon_Grip_C, ReceiveBeginPlay, "Modular_Weapon_Grip_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Weapon_Grip_C, UserConstructionScript, "Modular_Weapon_Grip_C", "UserConstructionScript", void)
+// clang-format on
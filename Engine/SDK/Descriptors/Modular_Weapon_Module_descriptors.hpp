@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Modular_Weapon_Module_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Modular_Weapon_Module_classes.hpp"
+#include "../SDK/Modular_Weapon_Module_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Weapon_Module_C, UserConstructionScript, "Modular_Weapon_Module_C", "UserConstructionScript", void)
+// clang-format on
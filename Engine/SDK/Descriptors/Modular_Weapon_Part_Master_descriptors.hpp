@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Modular_Weapon_Part_Master_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Modular_Weapon_Part_Master_classes.hpp"
+#include "../SDK/Modular_Weapon_Part_Master_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Weapon_Part_Master_C, ExecuteUbergraph_Modular_Weapon_Part_Master, "Modular_Weapon_Part_Master_C", "ExecuteUbergraph_Modular_Weapon_Part_Master", SDK::Params::Modular_Weapon_Part_Master_C_ExecuteUbergraph_Modular_Weapon_Part_Master)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Weapon_Part_Master_C, ReceiveBeginPlay, "Modular_Weapon_Part_Master_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Weapon_Part_Master_C, UserConstructionScript, "Modular_Weapon_Part_Master_C", "UserConstructionScript", void)
+// clang-format on
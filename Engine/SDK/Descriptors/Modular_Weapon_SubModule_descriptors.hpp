@@ -0,0 +1,12 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Modular_Weapon_SubModule_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Modular_Weapon_SubModule_classes.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AModular_Weapon_SubModule_C, UserConstructionScript, "Modular_Weapon_SubModule_C", "UserConstructionScript", void)
+// clang-format on
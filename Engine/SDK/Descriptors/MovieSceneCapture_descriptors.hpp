@@ -0,0 +1,42 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MovieSceneCapture_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MovieSceneCapture_classes.hpp"
+#include "../SDK/MovieSceneCapture_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCaptureProtocolBase, GetState, "MovieSceneCaptureProtocolBase", "GetState", SDK::Params::MovieSceneCaptureProtocolBase_GetState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCaptureProtocolBase, IsCapturing, "MovieSceneCaptureProtocolBase", "IsCapturing", SDK::Params::MovieSceneCaptureProtocolBase_IsCapturing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCapture, GetAudioCaptureProtocol, "MovieSceneCapture", "GetAudioCaptureProtocol", SDK::Params::MovieSceneCapture_GetAudioCaptureProtocol)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCapture, GetImageCaptureProtocol, "MovieSceneCapture", "GetImageCaptureProtocol", SDK::Params::MovieSceneCapture_GetImageCaptureProtocol)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCapture, SetAudioCaptureProtocolType, "MovieSceneCapture", "SetAudioCaptureProtocolType", SDK::Params::MovieSceneCapture_SetAudioCaptureProtocolType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCapture, SetImageCaptureProtocolType, "MovieSceneCapture", "SetImageCaptureProtocolType", SDK::Params::MovieSceneCapture_SetImageCaptureProtocolType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCaptureEnvironment, FindAudioCaptureProtocol, "MovieSceneCaptureEnvironment", "FindAudioCaptureProtocol", SDK::Params::MovieSceneCaptureEnvironment_FindAudioCaptureProtocol)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCaptureEnvironment, FindImageCaptureProtocol, "MovieSceneCaptureEnvironment", "FindImageCaptureProtocol", SDK::Params::MovieSceneCaptureEnvironment_FindImageCaptureProtocol)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCaptureEnvironment, GetCaptureElapsedTime, "MovieSceneCaptureEnvironment", "GetCaptureElapsedTime", SDK::Params::MovieSceneCaptureEnvironment_GetCaptureElapsedTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCaptureEnvironment, GetCaptureFrameNumber, "MovieSceneCaptureEnvironment", "GetCaptureFrameNumber", SDK::Params::MovieSceneCaptureEnvironment_GetCaptureFrameNumber)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCaptureEnvironment, IsCaptureInProgress, "MovieSceneCaptureEnvironment", "IsCaptureInProgress", SDK::Params::MovieSceneCaptureEnvironment_IsCaptureInProgress)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnBeginFinalize, "UserDefinedCaptureProtocol", "OnBeginFinalize", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnCaptureFrame, "UserDefinedCaptureProtocol", "OnCaptureFrame", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnFinalize, "UserDefinedCaptureProtocol", "OnFinalize", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnPauseCapture, "UserDefinedCaptureProtocol", "OnPauseCapture", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnPixelsReceived, "UserDefinedCaptureProtocol", "OnPixelsReceived", SDK::Params::UserDefinedCaptureProtocol_OnPixelsReceived)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnPreTick, "UserDefinedCaptureProtocol", "OnPreTick", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnSetup, "UserDefinedCaptureProtocol", "OnSetup", SDK::Params::UserDefinedCaptureProtocol_OnSetup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnStartCapture, "UserDefinedCaptureProtocol", "OnStartCapture", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnTick, "UserDefinedCaptureProtocol", "OnTick", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnWarmUp, "UserDefinedCaptureProtocol", "OnWarmUp", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, ResolveBuffer, "UserDefinedCaptureProtocol", "ResolveBuffer", SDK::Params::UserDefinedCaptureProtocol_ResolveBuffer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, StartCapturingFinalPixels, "UserDefinedCaptureProtocol", "StartCapturingFinalPixels", SDK::Params::UserDefinedCaptureProtocol_StartCapturingFinalPixels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, StopCapturingFinalPixels, "UserDefinedCaptureProtocol", "StopCapturingFinalPixels", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, GenerateFilename, "UserDefinedCaptureProtocol", "GenerateFilename", SDK::Params::UserDefinedCaptureProtocol_GenerateFilename)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, GetCurrentFrameMetrics, "UserDefinedCaptureProtocol", "GetCurrentFrameMetrics", SDK::Params::UserDefinedCaptureProtocol_GetCurrentFrameMetrics)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedCaptureProtocol, OnCanFinalize, "UserDefinedCaptureProtocol", "OnCanFinalize", SDK::Params::UserDefinedCaptureProtocol_OnCanFinalize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedImageCaptureProtocol, GenerateFilenameForBuffer, "UserDefinedImageCaptureProtocol", "GenerateFilenameForBuffer", SDK::Params::UserDefinedImageCaptureProtocol_GenerateFilenameForBuffer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedImageCaptureProtocol, GenerateFilenameForCurrentFrame, "UserDefinedImageCaptureProtocol", "GenerateFilenameForCurrentFrame", SDK::Params::UserDefinedImageCaptureProtocol_GenerateFilenameForCurrentFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserDefinedImageCaptureProtocol, WriteImageToDisk, "UserDefinedImageCaptureProtocol", "WriteImageToDisk", SDK::Params::UserDefinedImageCaptureProtocol_WriteImageToDisk)
+// clang-format on
@@ -0,0 +1,75 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MovieSceneTracks_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MovieSceneTracks_classes.hpp"
+#include "../SDK/MovieSceneTracks_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneTransformOrigin, BP_GetTransformOrigin, "MovieSceneTransformOrigin", "BP_GetTransformOrigin", SDK::Params::MovieSceneTransformOrigin_BP_GetTransformOrigin)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScene3DConstraintSection, SetConstraintBindingID, "MovieScene3DConstraintSection", "SetConstraintBindingID", SDK::Params::MovieScene3DConstraintSection_SetConstraintBindingID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScene3DConstraintSection, GetConstraintBindingID, "MovieScene3DConstraintSection", "GetConstraintBindingID", SDK::Params::MovieScene3DConstraintSection_GetConstraintBindingID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, SetAttenuationSettings, "MovieSceneAudioSection", "SetAttenuationSettings", SDK::Params::MovieSceneAudioSection_SetAttenuationSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, SetLooping, "MovieSceneAudioSection", "SetLooping", SDK::Params::MovieSceneAudioSection_SetLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, SetOverrideAttenuation, "MovieSceneAudioSection", "SetOverrideAttenuation", SDK::Params::MovieSceneAudioSection_SetOverrideAttenuation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, SetSound, "MovieSceneAudioSection", "SetSound", SDK::Params::MovieSceneAudioSection_SetSound)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, SetStartOffset, "MovieSceneAudioSection", "SetStartOffset", SDK::Params::MovieSceneAudioSection_SetStartOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, SetSuppressSubtitles, "MovieSceneAudioSection", "SetSuppressSubtitles", SDK::Params::MovieSceneAudioSection_SetSuppressSubtitles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, GetAttenuationSettings, "MovieSceneAudioSection", "GetAttenuationSettings", SDK::Params::MovieSceneAudioSection_GetAttenuationSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, GetLooping, "MovieSceneAudioSection", "GetLooping", SDK::Params::MovieSceneAudioSection_GetLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, GetOverrideAttenuation, "MovieSceneAudioSection", "GetOverrideAttenuation", SDK::Params::MovieSceneAudioSection_GetOverrideAttenuation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, GetSound, "MovieSceneAudioSection", "GetSound", SDK::Params::MovieSceneAudioSection_GetSound)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, GetStartOffset, "MovieSceneAudioSection", "GetStartOffset", SDK::Params::MovieSceneAudioSection_GetStartOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAudioSection, GetSuppressSubtitles, "MovieSceneAudioSection", "GetSuppressSubtitles", SDK::Params::MovieSceneAudioSection_GetSuppressSubtitles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCameraCutSection, SetCameraBindingID, "MovieSceneCameraCutSection", "SetCameraBindingID", SDK::Params::MovieSceneCameraCutSection_SetCameraBindingID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCameraCutSection, GetCameraBindingID, "MovieSceneCameraCutSection", "GetCameraBindingID", SDK::Params::MovieSceneCameraCutSection_GetCameraBindingID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCinematicShotSection, SetShotDisplayName, "MovieSceneCinematicShotSection", "SetShotDisplayName", SDK::Params::MovieSceneCinematicShotSection_SetShotDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCinematicShotSection, GetShotDisplayName, "MovieSceneCinematicShotSection", "GetShotDisplayName", SDK::Params::MovieSceneCinematicShotSection_GetShotDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneComponentMaterialParameterSection, AddColorParameterKey, "MovieSceneComponentMaterialParameterSection", "AddColorParameterKey", SDK::Params::MovieSceneComponentMaterialParameterSection_AddColorParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneComponentMaterialParameterSection, AddScalarParameterKey, "MovieSceneComponentMaterialParameterSection", "AddScalarParameterKey", SDK::Params::MovieSceneComponentMaterialParameterSection_AddScalarParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneComponentMaterialParameterSection, RemoveColorParameter, "MovieSceneComponentMaterialParameterSection", "RemoveColorParameter", SDK::Params::MovieSceneComponentMaterialParameterSection_RemoveColorParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneComponentMaterialParameterSection, RemoveScalarParameter, "MovieSceneComponentMaterialParameterSection", "RemoveScalarParameter", SDK::Params::MovieSceneComponentMaterialParameterSection_RemoveScalarParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, AddBoolParameterKey, "MovieSceneParameterSection", "AddBoolParameterKey", SDK::Params::MovieSceneParameterSection_AddBoolParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, AddColorParameterKey, "MovieSceneParameterSection", "AddColorParameterKey", SDK::Params::MovieSceneParameterSection_AddColorParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, AddScalarParameterKey, "MovieSceneParameterSection", "AddScalarParameterKey", SDK::Params::MovieSceneParameterSection_AddScalarParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, AddTransformParameterKey, "MovieSceneParameterSection", "AddTransformParameterKey", SDK::Params::MovieSceneParameterSection_AddTransformParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, AddVector2DParameterKey, "MovieSceneParameterSection", "AddVector2DParameterKey", SDK::Params::MovieSceneParameterSection_AddVector2DParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, AddVectorParameterKey, "MovieSceneParameterSection", "AddVectorParameterKey", SDK::Params::MovieSceneParameterSection_AddVectorParameterKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, RemoveBoolParameter, "MovieSceneParameterSection", "RemoveBoolParameter", SDK::Params::MovieSceneParameterSection_RemoveBoolParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, RemoveColorParameter, "MovieSceneParameterSection", "RemoveColorParameter", SDK::Params::MovieSceneParameterSection_RemoveColorParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, RemoveScalarParameter, "MovieSceneParameterSection", "RemoveScalarParameter", SDK::Params::MovieSceneParameterSection_RemoveScalarParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, RemoveTransformParameter, "MovieSceneParameterSection", "RemoveTransformParameter", SDK::Params::MovieSceneParameterSection_RemoveTransformParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, RemoveVector2DParameter, "MovieSceneParameterSection", "RemoveVector2DParameter", SDK::Params::MovieSceneParameterSection_RemoveVector2DParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, RemoveVectorParameter, "MovieSceneParameterSection", "RemoveVectorParameter", SDK::Params::MovieSceneParameterSection_RemoveVectorParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneParameterSection, GetParameterNames, "MovieSceneParameterSection", "GetParameterNames", SDK::Params::MovieSceneParameterSection_GetParameterNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCVarSection, SetFromString, "MovieSceneCVarSection", "SetFromString", SDK::Params::MovieSceneCVarSection_SetFromString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneCVarSection, GetString, "MovieSceneCVarSection", "GetString", SDK::Params::MovieSceneCVarSection_GetString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, SetDataLayerAssets, "MovieSceneDataLayerSection", "SetDataLayerAssets", SDK::Params::MovieSceneDataLayerSection_SetDataLayerAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, SetDataLayers, "MovieSceneDataLayerSection", "SetDataLayers", SDK::Params::MovieSceneDataLayerSection_SetDataLayers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, SetDesiredState, "MovieSceneDataLayerSection", "SetDesiredState", SDK::Params::MovieSceneDataLayerSection_SetDesiredState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, SetFlushOnActivated, "MovieSceneDataLayerSection", "SetFlushOnActivated", SDK::Params::MovieSceneDataLayerSection_SetFlushOnActivated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, SetFlushOnUnload, "MovieSceneDataLayerSection", "SetFlushOnUnload", SDK::Params::MovieSceneDataLayerSection_SetFlushOnUnload)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, SetPerformGCOnUnload, "MovieSceneDataLayerSection", "SetPerformGCOnUnload", SDK::Params::MovieSceneDataLayerSection_SetPerformGCOnUnload)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, SetPrerollState, "MovieSceneDataLayerSection", "SetPrerollState", SDK::Params::MovieSceneDataLayerSection_SetPrerollState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, GetDataLayerAssets, "MovieSceneDataLayerSection", "GetDataLayerAssets", SDK::Params::MovieSceneDataLayerSection_GetDataLayerAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, GetDataLayers, "MovieSceneDataLayerSection", "GetDataLayers", SDK::Params::MovieSceneDataLayerSection_GetDataLayers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, GetDesiredState, "MovieSceneDataLayerSection", "GetDesiredState", SDK::Params::MovieSceneDataLayerSection_GetDesiredState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, GetFlushOnActivated, "MovieSceneDataLayerSection", "GetFlushOnActivated", SDK::Params::MovieSceneDataLayerSection_GetFlushOnActivated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, GetFlushOnUnload, "MovieSceneDataLayerSection", "GetFlushOnUnload", SDK::Params::MovieSceneDataLayerSection_GetFlushOnUnload)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, GetPerformGCOnUnload, "MovieSceneDataLayerSection", "GetPerformGCOnUnload", SDK::Params::MovieSceneDataLayerSection_GetPerformGCOnUnload)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, GetPrerollState, "MovieSceneDataLayerSection", "GetPrerollState", SDK::Params::MovieSceneDataLayerSection_GetPrerollState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDataLayerSection, HasPreRoll, "MovieSceneDataLayerSection", "HasPreRoll", SDK::Params::MovieSceneDataLayerSection_HasPreRoll)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneLevelVisibilitySection, SetLevelNames, "MovieSceneLevelVisibilitySection", "SetLevelNames", SDK::Params::MovieSceneLevelVisibilitySection_SetLevelNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneLevelVisibilitySection, SetVisibility, "MovieSceneLevelVisibilitySection", "SetVisibility", SDK::Params::MovieSceneLevelVisibilitySection_SetVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneLevelVisibilitySection, GetLevelNames, "MovieSceneLevelVisibilitySection", "GetLevelNames", SDK::Params::MovieSceneLevelVisibilitySection_GetLevelNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneLevelVisibilitySection, GetVisibility, "MovieSceneLevelVisibilitySection", "GetVisibility", SDK::Params::MovieSceneLevelVisibilitySection_GetVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAsyncAction_SequencePrediction, PredictLocalTransformAtFrame, "MovieSceneAsyncAction_SequencePrediction", "PredictLocalTransformAtFrame", SDK::Params::MovieSceneAsyncAction_SequencePrediction_PredictLocalTransformAtFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAsyncAction_SequencePrediction, PredictLocalTransformAtTime, "MovieSceneAsyncAction_SequencePrediction", "PredictLocalTransformAtTime", SDK::Params::MovieSceneAsyncAction_SequencePrediction_PredictLocalTransformAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAsyncAction_SequencePrediction, PredictWorldTransformAtFrame, "MovieSceneAsyncAction_SequencePrediction", "PredictWorldTransformAtFrame", SDK::Params::MovieSceneAsyncAction_SequencePrediction_PredictWorldTransformAtFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneAsyncAction_SequencePrediction, PredictWorldTransformAtTime, "MovieSceneAsyncAction_SequencePrediction", "PredictWorldTransformAtTime", SDK::Params::MovieSceneAsyncAction_SequencePrediction_PredictWorldTransformAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSkeletalAnimationTrack, SetSwapRootBone, "MovieSceneSkeletalAnimationTrack", "SetSwapRootBone", SDK::Params::MovieSceneSkeletalAnimationTrack_SetSwapRootBone)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSkeletalAnimationTrack, GetSwapRootBone, "MovieSceneSkeletalAnimationTrack", "GetSwapRootBone", SDK::Params::MovieSceneSkeletalAnimationTrack_GetSwapRootBone)
+// clang-format on
@@ -0,0 +1,89 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from MovieScene_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/MovieScene_classes.hpp"
+#include "../SDK/MovieScene_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneBoundObjectProxy, BP_GetBoundObjectForSequencer, "MovieSceneBoundObjectProxy", "BP_GetBoundObjectForSequencer", SDK::Params::MovieSceneBoundObjectProxy_BP_GetBoundObjectForSequencer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneBindingEventReceiverInterface, OnObjectBoundBySequencer, "MovieSceneBindingEventReceiverInterface", "OnObjectBoundBySequencer", SDK::Params::MovieSceneBindingEventReceiverInterface_OnObjectBoundBySequencer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneBindingEventReceiverInterface, OnObjectUnboundBySequencer, "MovieSceneBindingEventReceiverInterface", "OnObjectUnboundBySequencer", SDK::Params::MovieSceneBindingEventReceiverInterface_OnObjectUnboundBySequencer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneEasingFunction, OnEvaluate, "MovieSceneEasingFunction", "OnEvaluate", SDK::Params::MovieSceneEasingFunction_OnEvaluate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneCustomClockSource, OnRequestCurrentTime, "MovieSceneCustomClockSource", "OnRequestCurrentTime", SDK::Params::MovieSceneCustomClockSource_OnRequestCurrentTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneCustomClockSource, OnStartPlaying, "MovieSceneCustomClockSource", "OnStartPlaying", SDK::Params::MovieSceneCustomClockSource_OnStartPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneCustomClockSource, OnStopPlaying, "MovieSceneCustomClockSource", "OnStopPlaying", SDK::Params::MovieSceneCustomClockSource_OnStopPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IMovieSceneCustomClockSource, OnTick, "MovieSceneCustomClockSource", "OnTick", SDK::Params::MovieSceneCustomClockSource_OnTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBuiltInDynamicBindingResolverLibrary, ResolveToPlayerPawn, "BuiltInDynamicBindingResolverLibrary", "ResolveToPlayerPawn", SDK::Params::BuiltInDynamicBindingResolverLibrary_ResolveToPlayerPawn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMetaData, SetAuthor, "MovieSceneMetaData", "SetAuthor", SDK::Params::MovieSceneMetaData_SetAuthor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMetaData, SetCreated, "MovieSceneMetaData", "SetCreated", SDK::Params::MovieSceneMetaData_SetCreated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMetaData, SetNotes, "MovieSceneMetaData", "SetNotes", SDK::Params::MovieSceneMetaData_SetNotes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMetaData, GetAuthor, "MovieSceneMetaData", "GetAuthor", SDK::Params::MovieSceneMetaData_GetAuthor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMetaData, GetCreated, "MovieSceneMetaData", "GetCreated", SDK::Params::MovieSceneMetaData_GetCreated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMetaData, GetNotes, "MovieSceneMetaData", "GetNotes", SDK::Params::MovieSceneMetaData_GetNotes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetBlendType, "MovieSceneSection", "SetBlendType", SDK::Params::MovieSceneSection_SetBlendType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetColorTint, "MovieSceneSection", "SetColorTint", SDK::Params::MovieSceneSection_SetColorTint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetCompletionMode, "MovieSceneSection", "SetCompletionMode", SDK::Params::MovieSceneSection_SetCompletionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetIsActive, "MovieSceneSection", "SetIsActive", SDK::Params::MovieSceneSection_SetIsActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetIsLocked, "MovieSceneSection", "SetIsLocked", SDK::Params::MovieSceneSection_SetIsLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetOverlapPriority, "MovieSceneSection", "SetOverlapPriority", SDK::Params::MovieSceneSection_SetOverlapPriority)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetPostRollFrames, "MovieSceneSection", "SetPostRollFrames", SDK::Params::MovieSceneSection_SetPostRollFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetPreRollFrames, "MovieSceneSection", "SetPreRollFrames", SDK::Params::MovieSceneSection_SetPreRollFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, SetRowIndex, "MovieSceneSection", "SetRowIndex", SDK::Params::MovieSceneSection_SetRowIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, GetBlendType, "MovieSceneSection", "GetBlendType", SDK::Params::MovieSceneSection_GetBlendType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, GetColorTint, "MovieSceneSection", "GetColorTint", SDK::Params::MovieSceneSection_GetColorTint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, GetCompletionMode, "MovieSceneSection", "GetCompletionMode", SDK::Params::MovieSceneSection_GetCompletionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, GetOverlapPriority, "MovieSceneSection", "GetOverlapPriority", SDK::Params::MovieSceneSection_GetOverlapPriority)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, GetPostRollFrames, "MovieSceneSection", "GetPostRollFrames", SDK::Params::MovieSceneSection_GetPostRollFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, GetPreRollFrames, "MovieSceneSection", "GetPreRollFrames", SDK::Params::MovieSceneSection_GetPreRollFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, GetRowIndex, "MovieSceneSection", "GetRowIndex", SDK::Params::MovieSceneSection_GetRowIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, IsActive, "MovieSceneSection", "IsActive", SDK::Params::MovieSceneSection_IsActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSection, IsLocked, "MovieSceneSection", "IsLocked", SDK::Params::MovieSceneSection_IsLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequence, FindBindingByTag, "MovieSceneSequence", "FindBindingByTag", SDK::Params::MovieSceneSequence_FindBindingByTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequence, FindBindingsByTag, "MovieSceneSequence", "FindBindingsByTag", SDK::Params::MovieSceneSequence_FindBindingsByTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequence, GetEarliestTimecodeSource, "MovieSceneSequence", "GetEarliestTimecodeSource", SDK::Params::MovieSceneSequence_GetEarliestTimecodeSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, ChangePlaybackDirection, "MovieSceneSequencePlayer", "ChangePlaybackDirection", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetBoundObjects, "MovieSceneSequencePlayer", "GetBoundObjects", SDK::Params::MovieSceneSequencePlayer_GetBoundObjects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetDisableCameraCuts, "MovieSceneSequencePlayer", "GetDisableCameraCuts", SDK::Params::MovieSceneSequencePlayer_GetDisableCameraCuts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetObjectBindings, "MovieSceneSequencePlayer", "GetObjectBindings", SDK::Params::MovieSceneSequencePlayer_GetObjectBindings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GoToEndAndStop, "MovieSceneSequencePlayer", "GoToEndAndStop", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, Pause, "MovieSceneSequencePlayer", "Pause", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, Play, "MovieSceneSequencePlayer", "Play", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, PlayLooping, "MovieSceneSequencePlayer", "PlayLooping", SDK::Params::MovieSceneSequencePlayer_PlayLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, PlayReverse, "MovieSceneSequencePlayer", "PlayReverse", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, PlayTo, "MovieSceneSequencePlayer", "PlayTo", SDK::Params::MovieSceneSequencePlayer_PlayTo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, RemoveWeight, "MovieSceneSequencePlayer", "RemoveWeight", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, RestoreState, "MovieSceneSequencePlayer", "RestoreState", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, RPC_ExplicitServerUpdateEvent, "MovieSceneSequencePlayer", "RPC_ExplicitServerUpdateEvent", SDK::Params::MovieSceneSequencePlayer_RPC_ExplicitServerUpdateEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, RPC_OnFinishPlaybackEvent, "MovieSceneSequencePlayer", "RPC_OnFinishPlaybackEvent", SDK::Params::MovieSceneSequencePlayer_RPC_OnFinishPlaybackEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, RPC_OnStopEvent, "MovieSceneSequencePlayer", "RPC_OnStopEvent", SDK::Params::MovieSceneSequencePlayer_RPC_OnStopEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, Scrub, "MovieSceneSequencePlayer", "Scrub", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, SetCompletionModeOverride, "MovieSceneSequencePlayer", "SetCompletionModeOverride", SDK::Params::MovieSceneSequencePlayer_SetCompletionModeOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, SetDisableCameraCuts, "MovieSceneSequencePlayer", "SetDisableCameraCuts", SDK::Params::MovieSceneSequencePlayer_SetDisableCameraCuts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, SetFrameRange, "MovieSceneSequencePlayer", "SetFrameRange", SDK::Params::MovieSceneSequencePlayer_SetFrameRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, SetFrameRate, "MovieSceneSequencePlayer", "SetFrameRate", SDK::Params::MovieSceneSequencePlayer_SetFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, SetPlaybackPosition, "MovieSceneSequencePlayer", "SetPlaybackPosition", SDK::Params::MovieSceneSequencePlayer_SetPlaybackPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, SetPlayRate, "MovieSceneSequencePlayer", "SetPlayRate", SDK::Params::MovieSceneSequencePlayer_SetPlayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, SetTimeRange, "MovieSceneSequencePlayer", "SetTimeRange", SDK::Params::MovieSceneSequencePlayer_SetTimeRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, SetWeight, "MovieSceneSequencePlayer", "SetWeight", SDK::Params::MovieSceneSequencePlayer_SetWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, Stop, "MovieSceneSequencePlayer", "Stop", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, StopAtCurrentTime, "MovieSceneSequencePlayer", "StopAtCurrentTime", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetCompletionModeOverride, "MovieSceneSequencePlayer", "GetCompletionModeOverride", SDK::Params::MovieSceneSequencePlayer_GetCompletionModeOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetCurrentTime, "MovieSceneSequencePlayer", "GetCurrentTime", SDK::Params::MovieSceneSequencePlayer_GetCurrentTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetDuration, "MovieSceneSequencePlayer", "GetDuration", SDK::Params::MovieSceneSequencePlayer_GetDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetEndTime, "MovieSceneSequencePlayer", "GetEndTime", SDK::Params::MovieSceneSequencePlayer_GetEndTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetFrameDuration, "MovieSceneSequencePlayer", "GetFrameDuration", SDK::Params::MovieSceneSequencePlayer_GetFrameDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetFrameRate, "MovieSceneSequencePlayer", "GetFrameRate", SDK::Params::MovieSceneSequencePlayer_GetFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetPlayRate, "MovieSceneSequencePlayer", "GetPlayRate", SDK::Params::MovieSceneSequencePlayer_GetPlayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetSequence, "MovieSceneSequencePlayer", "GetSequence", SDK::Params::MovieSceneSequencePlayer_GetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetSequenceName, "MovieSceneSequencePlayer", "GetSequenceName", SDK::Params::MovieSceneSequencePlayer_GetSequenceName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, GetStartTime, "MovieSceneSequencePlayer", "GetStartTime", SDK::Params::MovieSceneSequencePlayer_GetStartTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, IsPaused, "MovieSceneSequencePlayer", "IsPaused", SDK::Params::MovieSceneSequencePlayer_IsPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, IsPlaying, "MovieSceneSequencePlayer", "IsPlaying", SDK::Params::MovieSceneSequencePlayer_IsPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequencePlayer, IsReversed, "MovieSceneSequencePlayer", "IsReversed", SDK::Params::MovieSceneSequencePlayer_IsReversed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSubSection, SetSequence, "MovieSceneSubSection", "SetSequence", SDK::Params::MovieSceneSubSection_SetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSubSection, GetSequence, "MovieSceneSubSection", "GetSequence", SDK::Params::MovieSceneSubSection_GetSequence)
+// clang-format on
@@ -0,0 +1,43 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from NavigationSystem_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/NavigationSystem_classes.hpp"
+#include "../SDK/NavigationSystem_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationPath, EnableDebugDrawing, "NavigationPath", "EnableDebugDrawing", SDK::Params::NavigationPath_EnableDebugDrawing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationPath, EnableRecalculationOnInvalidation, "NavigationPath", "EnableRecalculationOnInvalidation", SDK::Params::NavigationPath_EnableRecalculationOnInvalidation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationPath, GetDebugString, "NavigationPath", "GetDebugString", SDK::Params::NavigationPath_GetDebugString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationPath, GetPathCost, "NavigationPath", "GetPathCost", SDK::Params::NavigationPath_GetPathCost)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationPath, GetPathLength, "NavigationPath", "GetPathLength", SDK::Params::NavigationPath_GetPathLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationPath, IsPartial, "NavigationPath", "IsPartial", SDK::Params::NavigationPath_IsPartial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationPath, IsStringPulled, "NavigationPath", "IsStringPulled", SDK::Params::NavigationPath_IsStringPulled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationPath, IsValid, "NavigationPath", "IsValid", SDK::Params::NavigationPath_IsValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, FindPathToActorSynchronously, "NavigationSystemV1", "FindPathToActorSynchronously", SDK::Params::NavigationSystemV1_FindPathToActorSynchronously)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, FindPathToLocationSynchronously, "NavigationSystemV1", "FindPathToLocationSynchronously", SDK::Params::NavigationSystemV1_FindPathToLocationSynchronously)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, GetNavigationSystem, "NavigationSystemV1", "GetNavigationSystem", SDK::Params::NavigationSystemV1_GetNavigationSystem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, GetPathCost, "NavigationSystemV1", "GetPathCost", SDK::Params::NavigationSystemV1_GetPathCost)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, GetPathLength, "NavigationSystemV1", "GetPathLength", SDK::Params::NavigationSystemV1_GetPathLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, IsNavigationBeingBuilt, "NavigationSystemV1", "IsNavigationBeingBuilt", SDK::Params::NavigationSystemV1_IsNavigationBeingBuilt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, IsNavigationBeingBuiltOrLocked, "NavigationSystemV1", "IsNavigationBeingBuiltOrLocked", SDK::Params::NavigationSystemV1_IsNavigationBeingBuiltOrLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, K2_GetRandomLocationInNavigableRadius, "NavigationSystemV1", "K2_GetRandomLocationInNavigableRadius", SDK::Params::NavigationSystemV1_K2_GetRandomLocationInNavigableRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, K2_GetRandomPointInNavigableRadius, "NavigationSystemV1", "K2_GetRandomPointInNavigableRadius", SDK::Params::NavigationSystemV1_K2_GetRandomPointInNavigableRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, K2_GetRandomReachablePointInRadius, "NavigationSystemV1", "K2_GetRandomReachablePointInRadius", SDK::Params::NavigationSystemV1_K2_GetRandomReachablePointInRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, K2_ProjectPointToNavigation, "NavigationSystemV1", "K2_ProjectPointToNavigation", SDK::Params::NavigationSystemV1_K2_ProjectPointToNavigation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, NavigationRaycast, "NavigationSystemV1", "NavigationRaycast", SDK::Params::NavigationSystemV1_NavigationRaycast)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, K2_ReplaceAreaInOctreeData, "NavigationSystemV1", "K2_ReplaceAreaInOctreeData", SDK::Params::NavigationSystemV1_K2_ReplaceAreaInOctreeData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, OnNavigationBoundsUpdated, "NavigationSystemV1", "OnNavigationBoundsUpdated", SDK::Params::NavigationSystemV1_OnNavigationBoundsUpdated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, RegisterNavigationInvoker, "NavigationSystemV1", "RegisterNavigationInvoker", SDK::Params::NavigationSystemV1_RegisterNavigationInvoker)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, ResetMaxSimultaneousTileGenerationJobsCount, "NavigationSystemV1", "ResetMaxSimultaneousTileGenerationJobsCount", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, SetGeometryGatheringMode, "NavigationSystemV1", "SetGeometryGatheringMode", SDK::Params::NavigationSystemV1_SetGeometryGatheringMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, SetMaxSimultaneousTileGenerationJobsCount, "NavigationSystemV1", "SetMaxSimultaneousTileGenerationJobsCount", SDK::Params::NavigationSystemV1_SetMaxSimultaneousTileGenerationJobsCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavigationSystemV1, UnregisterNavigationInvoker, "NavigationSystemV1", "UnregisterNavigationInvoker", SDK::Params::NavigationSystemV1_UnregisterNavigationInvoker)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavRelevantComponent, SetNavigationRelevancy, "NavRelevantComponent", "SetNavigationRelevancy", SDK::Params::NavRelevantComponent_SetNavigationRelevancy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ARecastNavMesh, K2_ReplaceAreaInTileBounds, "RecastNavMesh", "K2_ReplaceAreaInTileBounds", SDK::Params::RecastNavMesh_K2_ReplaceAreaInTileBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNavModifierComponent, SetAreaClass, "NavModifierComponent", "SetAreaClass", SDK::Params::NavModifierComponent_SetAreaClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANavModifierVolume, SetAreaClass, "NavModifierVolume", "SetAreaClass", SDK::Params::NavModifierVolume_SetAreaClass)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from NiagaraAnimNotifies_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/NiagaraAnimNotifies_classes.hpp"
+#include "../SDK/NiagaraAnimNotifies_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNotifyState_TimedNiagaraEffect, GetSpawnedEffect, "AnimNotifyState_TimedNiagaraEffect", "GetSpawnedEffect", SDK::Params::AnimNotifyState_TimedNiagaraEffect_GetSpawnedEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNotify_PlayNiagaraEffect, GetSpawnedEffect, "AnimNotify_PlayNiagaraEffect", "GetSpawnedEffect", SDK::Params::AnimNotify_PlayNiagaraEffect_GetSpawnedEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAnimNotifyState_TimedNiagaraEffectAdvanced, GetNotifyProgress, "AnimNotifyState_TimedNiagaraEffectAdvanced", "GetNotifyProgress", SDK::Params::AnimNotifyState_TimedNiagaraEffectAdvanced_GetNotifyProgress)
+// clang-format on
@@ -0,0 +1,264 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Niagara_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Niagara_classes.hpp"
+#include "../SDK/Niagara_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, InitAccess, "NiagaraDataChannelReader", "InitAccess", SDK::Params::NiagaraDataChannelReader_InitAccess)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, Num, "NiagaraDataChannelReader", "Num", SDK::Params::NiagaraDataChannelReader_Num)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadBool, "NiagaraDataChannelReader", "ReadBool", SDK::Params::NiagaraDataChannelReader_ReadBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadEnum, "NiagaraDataChannelReader", "ReadEnum", SDK::Params::NiagaraDataChannelReader_ReadEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadFloat, "NiagaraDataChannelReader", "ReadFloat", SDK::Params::NiagaraDataChannelReader_ReadFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadID, "NiagaraDataChannelReader", "ReadID", SDK::Params::NiagaraDataChannelReader_ReadID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadInt, "NiagaraDataChannelReader", "ReadInt", SDK::Params::NiagaraDataChannelReader_ReadInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadLinearColor, "NiagaraDataChannelReader", "ReadLinearColor", SDK::Params::NiagaraDataChannelReader_ReadLinearColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadPosition, "NiagaraDataChannelReader", "ReadPosition", SDK::Params::NiagaraDataChannelReader_ReadPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadQuat, "NiagaraDataChannelReader", "ReadQuat", SDK::Params::NiagaraDataChannelReader_ReadQuat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadSpawnInfo, "NiagaraDataChannelReader", "ReadSpawnInfo", SDK::Params::NiagaraDataChannelReader_ReadSpawnInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadVector, "NiagaraDataChannelReader", "ReadVector", SDK::Params::NiagaraDataChannelReader_ReadVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadVector2D, "NiagaraDataChannelReader", "ReadVector2D", SDK::Params::NiagaraDataChannelReader_ReadVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelReader, ReadVector4, "NiagaraDataChannelReader", "ReadVector4", SDK::Params::NiagaraDataChannelReader_ReadVector4)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, InitWrite, "NiagaraDataChannelWriter", "InitWrite", SDK::Params::NiagaraDataChannelWriter_InitWrite)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteBool, "NiagaraDataChannelWriter", "WriteBool", SDK::Params::NiagaraDataChannelWriter_WriteBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteEnum, "NiagaraDataChannelWriter", "WriteEnum", SDK::Params::NiagaraDataChannelWriter_WriteEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteFloat, "NiagaraDataChannelWriter", "WriteFloat", SDK::Params::NiagaraDataChannelWriter_WriteFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteID, "NiagaraDataChannelWriter", "WriteID", SDK::Params::NiagaraDataChannelWriter_WriteID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteInt, "NiagaraDataChannelWriter", "WriteInt", SDK::Params::NiagaraDataChannelWriter_WriteInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteLinearColor, "NiagaraDataChannelWriter", "WriteLinearColor", SDK::Params::NiagaraDataChannelWriter_WriteLinearColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WritePosition, "NiagaraDataChannelWriter", "WritePosition", SDK::Params::NiagaraDataChannelWriter_WritePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteQuat, "NiagaraDataChannelWriter", "WriteQuat", SDK::Params::NiagaraDataChannelWriter_WriteQuat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteSpawnInfo, "NiagaraDataChannelWriter", "WriteSpawnInfo", SDK::Params::NiagaraDataChannelWriter_WriteSpawnInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteVector, "NiagaraDataChannelWriter", "WriteVector", SDK::Params::NiagaraDataChannelWriter_WriteVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteVector2D, "NiagaraDataChannelWriter", "WriteVector2D", SDK::Params::NiagaraDataChannelWriter_WriteVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, WriteVector4, "NiagaraDataChannelWriter", "WriteVector4", SDK::Params::NiagaraDataChannelWriter_WriteVector4)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelWriter, Num, "NiagaraDataChannelWriter", "Num", SDK::Params::NiagaraDataChannelWriter_Num)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelHandler, GetDataChannelReader, "NiagaraDataChannelHandler", "GetDataChannelReader", SDK::Params::NiagaraDataChannelHandler_GetDataChannelReader)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelHandler, GetDataChannelWriter, "NiagaraDataChannelHandler", "GetDataChannelWriter", SDK::Params::NiagaraDataChannelHandler_GetDataChannelWriter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraStatelessModule_MeshIndex, NeedsMeshIndexWeights, "NiagaraStatelessModule_MeshIndex", "NeedsMeshIndexWeights", SDK::Params::NiagaraStatelessModule_MeshIndex_NeedsMeshIndexWeights)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraStatelessModule_ScaleMeshSize, UseScaleCurveRange, "NiagaraStatelessModule_ScaleMeshSize", "UseScaleCurveRange", SDK::Params::NiagaraStatelessModule_ScaleMeshSize_UseScaleCurveRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraStatelessModule_ScaleSpriteSize, UseScaleCurveRange, "NiagaraStatelessModule_ScaleSpriteSize", "UseScaleCurveRange", SDK::Params::NiagaraStatelessModule_ScaleSpriteSize_UseScaleCurveRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceSceneCapture2D, SetSceneCapture2DManagedShowOnlyActors, "NiagaraDataInterfaceSceneCapture2D", "SetSceneCapture2DManagedShowOnlyActors", SDK::Params::NiagaraDataInterfaceSceneCapture2D_SetSceneCapture2DManagedShowOnlyActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceStaticMesh, SetNiagaraStaticMeshDIInstanceIndex, "NiagaraDataInterfaceStaticMesh", "SetNiagaraStaticMeshDIInstanceIndex", SDK::Params::NiagaraDataInterfaceStaticMesh_SetNiagaraStaticMeshDIInstanceIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceStaticMesh, OnSourceEndPlay, "NiagaraDataInterfaceStaticMesh", "OnSourceEndPlay", SDK::Params::NiagaraDataInterfaceStaticMesh_OnSourceEndPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceUObjectPropertyReader, SetUObjectReaderPropertyRemap, "NiagaraDataInterfaceUObjectPropertyReader", "SetUObjectReaderPropertyRemap", SDK::Params::NiagaraDataInterfaceUObjectPropertyReader_SetUObjectReaderPropertyRemap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraActor, OnNiagaraSystemFinished, "NiagaraActor", "OnNiagaraSystemFinished", SDK::Params::NiagaraActor_OnNiagaraSystemFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraActor, SetDestroyOnSystemFinish, "NiagaraActor", "SetDestroyOnSystemFinish", SDK::Params::NiagaraActor_SetDestroyOnSystemFinish)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraActor, GetDestroyOnSystemFinish, "NiagaraActor", "GetDestroyOnSystemFinish", SDK::Params::NiagaraActor_GetDestroyOnSystemFinish)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, AdvanceSimulation, "NiagaraComponent", "AdvanceSimulation", SDK::Params::NiagaraComponent_AdvanceSimulation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, AdvanceSimulationByTime, "NiagaraComponent", "AdvanceSimulationByTime", SDK::Params::NiagaraComponent_AdvanceSimulationByTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, ClearEmitterFixedBounds, "NiagaraComponent", "ClearEmitterFixedBounds", SDK::Params::NiagaraComponent_ClearEmitterFixedBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, ClearSimCache, "NiagaraComponent", "ClearSimCache", SDK::Params::NiagaraComponent_ClearSimCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, ClearSystemFixedBounds, "NiagaraComponent", "ClearSystemFixedBounds", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetDataInterface, "NiagaraComponent", "GetDataInterface", SDK::Params::NiagaraComponent_GetDataInterface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, InitForPerformanceBaseline, "NiagaraComponent", "InitForPerformanceBaseline", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, ReinitializeSystem, "NiagaraComponent", "ReinitializeSystem", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, ResetSystem, "NiagaraComponent", "ResetSystem", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SeekToDesiredAge, "NiagaraComponent", "SeekToDesiredAge", SDK::Params::NiagaraComponent_SeekToDesiredAge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetAgeUpdateMode, "NiagaraComponent", "SetAgeUpdateMode", SDK::Params::NiagaraComponent_SetAgeUpdateMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetAllowScalability, "NiagaraComponent", "SetAllowScalability", SDK::Params::NiagaraComponent_SetAllowScalability)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetAsset, "NiagaraComponent", "SetAsset", SDK::Params::NiagaraComponent_SetAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetAutoDestroy, "NiagaraComponent", "SetAutoDestroy", SDK::Params::NiagaraComponent_SetAutoDestroy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetCanRenderWhileSeeking, "NiagaraComponent", "SetCanRenderWhileSeeking", SDK::Params::NiagaraComponent_SetCanRenderWhileSeeking)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetCustomTimeDilation, "NiagaraComponent", "SetCustomTimeDilation", SDK::Params::NiagaraComponent_SetCustomTimeDilation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetDesiredAge, "NiagaraComponent", "SetDesiredAge", SDK::Params::NiagaraComponent_SetDesiredAge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetEmitterFixedBounds, "NiagaraComponent", "SetEmitterFixedBounds", SDK::Params::NiagaraComponent_SetEmitterFixedBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetForceLocalPlayerEffect, "NiagaraComponent", "SetForceLocalPlayerEffect", SDK::Params::NiagaraComponent_SetForceLocalPlayerEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetForceSolo, "NiagaraComponent", "SetForceSolo", SDK::Params::NiagaraComponent_SetForceSolo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetGpuComputeDebug, "NiagaraComponent", "SetGpuComputeDebug", SDK::Params::NiagaraComponent_SetGpuComputeDebug)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetLockDesiredAgeDeltaTimeToSeekDelta, "NiagaraComponent", "SetLockDesiredAgeDeltaTimeToSeekDelta", SDK::Params::NiagaraComponent_SetLockDesiredAgeDeltaTimeToSeekDelta)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetMaxSimTime, "NiagaraComponent", "SetMaxSimTime", SDK::Params::NiagaraComponent_SetMaxSimTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableActor, "NiagaraComponent", "SetNiagaraVariableActor", SDK::Params::NiagaraComponent_SetNiagaraVariableActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableBool, "NiagaraComponent", "SetNiagaraVariableBool", SDK::Params::NiagaraComponent_SetNiagaraVariableBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableFloat, "NiagaraComponent", "SetNiagaraVariableFloat", SDK::Params::NiagaraComponent_SetNiagaraVariableFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableInt, "NiagaraComponent", "SetNiagaraVariableInt", SDK::Params::NiagaraComponent_SetNiagaraVariableInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableLinearColor, "NiagaraComponent", "SetNiagaraVariableLinearColor", SDK::Params::NiagaraComponent_SetNiagaraVariableLinearColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableMatrix, "NiagaraComponent", "SetNiagaraVariableMatrix", SDK::Params::NiagaraComponent_SetNiagaraVariableMatrix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableObject, "NiagaraComponent", "SetNiagaraVariableObject", SDK::Params::NiagaraComponent_SetNiagaraVariableObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariablePosition, "NiagaraComponent", "SetNiagaraVariablePosition", SDK::Params::NiagaraComponent_SetNiagaraVariablePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableQuat, "NiagaraComponent", "SetNiagaraVariableQuat", SDK::Params::NiagaraComponent_SetNiagaraVariableQuat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableVec2, "NiagaraComponent", "SetNiagaraVariableVec2", SDK::Params::NiagaraComponent_SetNiagaraVariableVec2)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableVec3, "NiagaraComponent", "SetNiagaraVariableVec3", SDK::Params::NiagaraComponent_SetNiagaraVariableVec3)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetNiagaraVariableVec4, "NiagaraComponent", "SetNiagaraVariableVec4", SDK::Params::NiagaraComponent_SetNiagaraVariableVec4)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetOcclusionQueryMode, "NiagaraComponent", "SetOcclusionQueryMode", SDK::Params::NiagaraComponent_SetOcclusionQueryMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetPaused, "NiagaraComponent", "SetPaused", SDK::Params::NiagaraComponent_SetPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetPreviewLODDistance, "NiagaraComponent", "SetPreviewLODDistance", SDK::Params::NiagaraComponent_SetPreviewLODDistance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetRandomSeedOffset, "NiagaraComponent", "SetRandomSeedOffset", SDK::Params::NiagaraComponent_SetRandomSeedOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetRenderingEnabled, "NiagaraComponent", "SetRenderingEnabled", SDK::Params::NiagaraComponent_SetRenderingEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetSeekDelta, "NiagaraComponent", "SetSeekDelta", SDK::Params::NiagaraComponent_SetSeekDelta)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetSimCache, "NiagaraComponent", "SetSimCache", SDK::Params::NiagaraComponent_SetSimCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetSystemFixedBounds, "NiagaraComponent", "SetSystemFixedBounds", SDK::Params::NiagaraComponent_SetSystemFixedBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetTickBehavior, "NiagaraComponent", "SetTickBehavior", SDK::Params::NiagaraComponent_SetTickBehavior)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableActor, "NiagaraComponent", "SetVariableActor", SDK::Params::NiagaraComponent_SetVariableActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableBool, "NiagaraComponent", "SetVariableBool", SDK::Params::NiagaraComponent_SetVariableBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableFloat, "NiagaraComponent", "SetVariableFloat", SDK::Params::NiagaraComponent_SetVariableFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableInt, "NiagaraComponent", "SetVariableInt", SDK::Params::NiagaraComponent_SetVariableInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableLinearColor, "NiagaraComponent", "SetVariableLinearColor", SDK::Params::NiagaraComponent_SetVariableLinearColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableMaterial, "NiagaraComponent", "SetVariableMaterial", SDK::Params::NiagaraComponent_SetVariableMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableMatrix, "NiagaraComponent", "SetVariableMatrix", SDK::Params::NiagaraComponent_SetVariableMatrix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableObject, "NiagaraComponent", "SetVariableObject", SDK::Params::NiagaraComponent_SetVariableObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariablePosition, "NiagaraComponent", "SetVariablePosition", SDK::Params::NiagaraComponent_SetVariablePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableQuat, "NiagaraComponent", "SetVariableQuat", SDK::Params::NiagaraComponent_SetVariableQuat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableStaticMesh, "NiagaraComponent", "SetVariableStaticMesh", SDK::Params::NiagaraComponent_SetVariableStaticMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableTexture, "NiagaraComponent", "SetVariableTexture", SDK::Params::NiagaraComponent_SetVariableTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableTextureRenderTarget, "NiagaraComponent", "SetVariableTextureRenderTarget", SDK::Params::NiagaraComponent_SetVariableTextureRenderTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableVec2, "NiagaraComponent", "SetVariableVec2", SDK::Params::NiagaraComponent_SetVariableVec2)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableVec3, "NiagaraComponent", "SetVariableVec3", SDK::Params::NiagaraComponent_SetVariableVec3)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, SetVariableVec4, "NiagaraComponent", "SetVariableVec4", SDK::Params::NiagaraComponent_SetVariableVec4)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetAgeUpdateMode, "NiagaraComponent", "GetAgeUpdateMode", SDK::Params::NiagaraComponent_GetAgeUpdateMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetAllowScalability, "NiagaraComponent", "GetAllowScalability", SDK::Params::NiagaraComponent_GetAllowScalability)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetAsset, "NiagaraComponent", "GetAsset", SDK::Params::NiagaraComponent_GetAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetCustomTimeDilation, "NiagaraComponent", "GetCustomTimeDilation", SDK::Params::NiagaraComponent_GetCustomTimeDilation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetDesiredAge, "NiagaraComponent", "GetDesiredAge", SDK::Params::NiagaraComponent_GetDesiredAge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetEmitterFixedBounds, "NiagaraComponent", "GetEmitterFixedBounds", SDK::Params::NiagaraComponent_GetEmitterFixedBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetForceLocalPlayerEffect, "NiagaraComponent", "GetForceLocalPlayerEffect", SDK::Params::NiagaraComponent_GetForceLocalPlayerEffect)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetForceSolo, "NiagaraComponent", "GetForceSolo", SDK::Params::NiagaraComponent_GetForceSolo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetLockDesiredAgeDeltaTimeToSeekDelta, "NiagaraComponent", "GetLockDesiredAgeDeltaTimeToSeekDelta", SDK::Params::NiagaraComponent_GetLockDesiredAgeDeltaTimeToSeekDelta)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetMaxSimTime, "NiagaraComponent", "GetMaxSimTime", SDK::Params::NiagaraComponent_GetMaxSimTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetOcclusionQueryMode, "NiagaraComponent", "GetOcclusionQueryMode", SDK::Params::NiagaraComponent_GetOcclusionQueryMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetPreviewLODDistance, "NiagaraComponent", "GetPreviewLODDistance", SDK::Params::NiagaraComponent_GetPreviewLODDistance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetPreviewLODDistanceEnabled, "NiagaraComponent", "GetPreviewLODDistanceEnabled", SDK::Params::NiagaraComponent_GetPreviewLODDistanceEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetRandomSeedOffset, "NiagaraComponent", "GetRandomSeedOffset", SDK::Params::NiagaraComponent_GetRandomSeedOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetSeekDelta, "NiagaraComponent", "GetSeekDelta", SDK::Params::NiagaraComponent_GetSeekDelta)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetSimCache, "NiagaraComponent", "GetSimCache", SDK::Params::NiagaraComponent_GetSimCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetSystemFixedBounds, "NiagaraComponent", "GetSystemFixedBounds", SDK::Params::NiagaraComponent_GetSystemFixedBounds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, GetTickBehavior, "NiagaraComponent", "GetTickBehavior", SDK::Params::NiagaraComponent_GetTickBehavior)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraComponent, IsPaused, "NiagaraComponent", "IsPaused", SDK::Params::NiagaraComponent_IsPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelLibrary, GetDataChannelElementCount, "NiagaraDataChannelLibrary", "GetDataChannelElementCount", SDK::Params::NiagaraDataChannelLibrary_GetDataChannelElementCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelLibrary, GetNiagaraDataChannel, "NiagaraDataChannelLibrary", "GetNiagaraDataChannel", SDK::Params::NiagaraDataChannelLibrary_GetNiagaraDataChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelLibrary, ReadFromNiagaraDataChannel, "NiagaraDataChannelLibrary", "ReadFromNiagaraDataChannel", SDK::Params::NiagaraDataChannelLibrary_ReadFromNiagaraDataChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelLibrary, ReadFromNiagaraDataChannelSingle, "NiagaraDataChannelLibrary", "ReadFromNiagaraDataChannelSingle", SDK::Params::NiagaraDataChannelLibrary_ReadFromNiagaraDataChannelSingle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelLibrary, WriteToNiagaraDataChannel, "NiagaraDataChannelLibrary", "WriteToNiagaraDataChannel", SDK::Params::NiagaraDataChannelLibrary_WriteToNiagaraDataChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataChannelLibrary, WriteToNiagaraDataChannelSingle, "NiagaraDataChannelLibrary", "WriteToNiagaraDataChannelSingle", SDK::Params::NiagaraDataChannelLibrary_WriteToNiagaraDataChannelSingle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayBool, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayBool", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayBoolValue, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayBoolValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayBoolValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayColor, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayColor", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayColorValue, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayColorValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayColorValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayFloat, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayFloat", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayFloatValue, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayFloatValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayFloatValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayInt32, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayInt32", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayInt32)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayInt32Value, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayInt32Value", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayInt32Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayMatrix, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayMatrix", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayMatrix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayMatrixValue, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayMatrixValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayMatrixValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayPosition, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayPosition", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayPositionValue, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayPositionValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayPositionValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayQuat, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayQuat", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayQuat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayQuatValue, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayQuatValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayQuatValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayUInt8, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayUInt8", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayUInt8)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayUInt8Value, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayUInt8Value", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayUInt8Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayVector, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayVector", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayVector2D, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayVector2D", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayVector2DValue, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayVector2DValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayVector2DValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayVector4, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayVector4", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayVector4)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayVector4Value, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayVector4Value", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayVector4Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, GetNiagaraArrayVectorValue, "NiagaraDataInterfaceArrayFunctionLibrary", "GetNiagaraArrayVectorValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_GetNiagaraArrayVectorValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayBool, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayBool", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayBoolValue, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayBoolValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayBoolValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayColor, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayColor", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayColorValue, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayColorValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayColorValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayFloat, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayFloat", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayFloatValue, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayFloatValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayFloatValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayInt32, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayInt32", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayInt32)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayInt32Value, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayInt32Value", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayInt32Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayMatrix, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayMatrix", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayMatrix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayMatrixValue, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayMatrixValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayMatrixValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayPosition, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayPosition", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayPositionValue, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayPositionValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayPositionValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayQuat, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayQuat", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayQuat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayQuatValue, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayQuatValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayQuatValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayUInt8, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayUInt8", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayUInt8)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayUInt8Value, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayUInt8Value", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayUInt8Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayVector, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayVector", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayVector2D, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayVector2D", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayVector2DValue, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayVector2DValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayVector2DValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayVector4, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayVector4", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayVector4)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayVector4Value, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayVector4Value", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayVector4Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceArrayFunctionLibrary, SetNiagaraArrayVectorValue, "NiagaraDataInterfaceArrayFunctionLibrary", "SetNiagaraArrayVectorValue", SDK::Params::NiagaraDataInterfaceArrayFunctionLibrary_SetNiagaraArrayVectorValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(INiagaraParticleCallbackHandler, ReceiveParticleData, "NiagaraParticleCallbackHandler", "ReceiveParticleData", SDK::Params::NiagaraParticleCallbackHandler_ReceiveParticleData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceGrid2DCollection, FillRawTexture2D, "NiagaraDataInterfaceGrid2DCollection", "FillRawTexture2D", SDK::Params::NiagaraDataInterfaceGrid2DCollection_FillRawTexture2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceGrid2DCollection, FillTexture2D, "NiagaraDataInterfaceGrid2DCollection", "FillTexture2D", SDK::Params::NiagaraDataInterfaceGrid2DCollection_FillTexture2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceGrid2DCollection, GetRawTextureSize, "NiagaraDataInterfaceGrid2DCollection", "GetRawTextureSize", SDK::Params::NiagaraDataInterfaceGrid2DCollection_GetRawTextureSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceGrid2DCollection, GetTextureSize, "NiagaraDataInterfaceGrid2DCollection", "GetTextureSize", SDK::Params::NiagaraDataInterfaceGrid2DCollection_GetTextureSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceGrid3DCollection, FillRawVolumeTexture, "NiagaraDataInterfaceGrid3DCollection", "FillRawVolumeTexture", SDK::Params::NiagaraDataInterfaceGrid3DCollection_FillRawVolumeTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceGrid3DCollection, FillVolumeTexture, "NiagaraDataInterfaceGrid3DCollection", "FillVolumeTexture", SDK::Params::NiagaraDataInterfaceGrid3DCollection_FillVolumeTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceGrid3DCollection, GetRawTextureSize, "NiagaraDataInterfaceGrid3DCollection", "GetRawTextureSize", SDK::Params::NiagaraDataInterfaceGrid3DCollection_GetRawTextureSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceGrid3DCollection, GetTextureSize, "NiagaraDataInterfaceGrid3DCollection", "GetTextureSize", SDK::Params::NiagaraDataInterfaceGrid3DCollection_GetTextureSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDIRigidMeshCollisionFunctionLibrary, SetSourceActors, "NiagaraDIRigidMeshCollisionFunctionLibrary", "SetSourceActors", SDK::Params::NiagaraDIRigidMeshCollisionFunctionLibrary_SetSourceActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraDataInterfaceSkeletalMesh, OnSourceEndPlay, "NiagaraDataInterfaceSkeletalMesh", "OnSourceEndPlay", SDK::Params::NiagaraDataInterfaceSkeletalMesh_OnSourceEndPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, AcquireNiagaraGPURayTracedCollisionGroup, "NiagaraFunctionLibrary", "AcquireNiagaraGPURayTracedCollisionGroup", SDK::Params::NiagaraFunctionLibrary_AcquireNiagaraGPURayTracedCollisionGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, GetNiagaraParameterCollection, "NiagaraFunctionLibrary", "GetNiagaraParameterCollection", SDK::Params::NiagaraFunctionLibrary_GetNiagaraParameterCollection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, OverrideSystemUserVariableSkeletalMeshComponent, "NiagaraFunctionLibrary", "OverrideSystemUserVariableSkeletalMeshComponent", SDK::Params::NiagaraFunctionLibrary_OverrideSystemUserVariableSkeletalMeshComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, OverrideSystemUserVariableStaticMesh, "NiagaraFunctionLibrary", "OverrideSystemUserVariableStaticMesh", SDK::Params::NiagaraFunctionLibrary_OverrideSystemUserVariableStaticMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, OverrideSystemUserVariableStaticMeshComponent, "NiagaraFunctionLibrary", "OverrideSystemUserVariableStaticMeshComponent", SDK::Params::NiagaraFunctionLibrary_OverrideSystemUserVariableStaticMeshComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, ReleaseNiagaraGPURayTracedCollisionGroup, "NiagaraFunctionLibrary", "ReleaseNiagaraGPURayTracedCollisionGroup", SDK::Params::NiagaraFunctionLibrary_ReleaseNiagaraGPURayTracedCollisionGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SetActorNiagaraGPURayTracedCollisionGroup, "NiagaraFunctionLibrary", "SetActorNiagaraGPURayTracedCollisionGroup", SDK::Params::NiagaraFunctionLibrary_SetActorNiagaraGPURayTracedCollisionGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SetComponentNiagaraGPURayTracedCollisionGroup, "NiagaraFunctionLibrary", "SetComponentNiagaraGPURayTracedCollisionGroup", SDK::Params::NiagaraFunctionLibrary_SetComponentNiagaraGPURayTracedCollisionGroup)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SetSkeletalMeshDataInterfaceFilteredBones, "NiagaraFunctionLibrary", "SetSkeletalMeshDataInterfaceFilteredBones", SDK::Params::NiagaraFunctionLibrary_SetSkeletalMeshDataInterfaceFilteredBones)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SetSkeletalMeshDataInterfaceFilteredSockets, "NiagaraFunctionLibrary", "SetSkeletalMeshDataInterfaceFilteredSockets", SDK::Params::NiagaraFunctionLibrary_SetSkeletalMeshDataInterfaceFilteredSockets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SetSkeletalMeshDataInterfaceSamplingRegions, "NiagaraFunctionLibrary", "SetSkeletalMeshDataInterfaceSamplingRegions", SDK::Params::NiagaraFunctionLibrary_SetSkeletalMeshDataInterfaceSamplingRegions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SetTexture2DArrayObject, "NiagaraFunctionLibrary", "SetTexture2DArrayObject", SDK::Params::NiagaraFunctionLibrary_SetTexture2DArrayObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SetTextureObject, "NiagaraFunctionLibrary", "SetTextureObject", SDK::Params::NiagaraFunctionLibrary_SetTextureObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SetVolumeTextureObject, "NiagaraFunctionLibrary", "SetVolumeTextureObject", SDK::Params::NiagaraFunctionLibrary_SetVolumeTextureObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SpawnSystemAtLocation, "NiagaraFunctionLibrary", "SpawnSystemAtLocation", SDK::Params::NiagaraFunctionLibrary_SpawnSystemAtLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SpawnSystemAtLocationWithParams, "NiagaraFunctionLibrary", "SpawnSystemAtLocationWithParams", SDK::Params::NiagaraFunctionLibrary_SpawnSystemAtLocationWithParams)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SpawnSystemAttached, "NiagaraFunctionLibrary", "SpawnSystemAttached", SDK::Params::NiagaraFunctionLibrary_SpawnSystemAttached)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraFunctionLibrary, SpawnSystemAttachedWithParams, "NiagaraFunctionLibrary", "SpawnSystemAttachedWithParams", SDK::Params::NiagaraFunctionLibrary_SpawnSystemAttachedWithParams)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, GetBoolParameter, "NiagaraParameterCollectionInstance", "GetBoolParameter", SDK::Params::NiagaraParameterCollectionInstance_GetBoolParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, GetColorParameter, "NiagaraParameterCollectionInstance", "GetColorParameter", SDK::Params::NiagaraParameterCollectionInstance_GetColorParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, GetFloatParameter, "NiagaraParameterCollectionInstance", "GetFloatParameter", SDK::Params::NiagaraParameterCollectionInstance_GetFloatParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, GetIntParameter, "NiagaraParameterCollectionInstance", "GetIntParameter", SDK::Params::NiagaraParameterCollectionInstance_GetIntParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, GetQuatParameter, "NiagaraParameterCollectionInstance", "GetQuatParameter", SDK::Params::NiagaraParameterCollectionInstance_GetQuatParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, GetVector2DParameter, "NiagaraParameterCollectionInstance", "GetVector2DParameter", SDK::Params::NiagaraParameterCollectionInstance_GetVector2DParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, GetVector4Parameter, "NiagaraParameterCollectionInstance", "GetVector4Parameter", SDK::Params::NiagaraParameterCollectionInstance_GetVector4Parameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, GetVectorParameter, "NiagaraParameterCollectionInstance", "GetVectorParameter", SDK::Params::NiagaraParameterCollectionInstance_GetVectorParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, SetBoolParameter, "NiagaraParameterCollectionInstance", "SetBoolParameter", SDK::Params::NiagaraParameterCollectionInstance_SetBoolParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, SetColorParameter, "NiagaraParameterCollectionInstance", "SetColorParameter", SDK::Params::NiagaraParameterCollectionInstance_SetColorParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, SetFloatParameter, "NiagaraParameterCollectionInstance", "SetFloatParameter", SDK::Params::NiagaraParameterCollectionInstance_SetFloatParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, SetIntParameter, "NiagaraParameterCollectionInstance", "SetIntParameter", SDK::Params::NiagaraParameterCollectionInstance_SetIntParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, SetQuatParameter, "NiagaraParameterCollectionInstance", "SetQuatParameter", SDK::Params::NiagaraParameterCollectionInstance_SetQuatParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, SetVector2DParameter, "NiagaraParameterCollectionInstance", "SetVector2DParameter", SDK::Params::NiagaraParameterCollectionInstance_SetVector2DParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, SetVector4Parameter, "NiagaraParameterCollectionInstance", "SetVector4Parameter", SDK::Params::NiagaraParameterCollectionInstance_SetVector4Parameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraParameterCollectionInstance, SetVectorParameter, "NiagaraParameterCollectionInstance", "SetVectorParameter", SDK::Params::NiagaraParameterCollectionInstance_SetVectorParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraBaselineController, GetSystem, "NiagaraBaselineController", "GetSystem", SDK::Params::NiagaraBaselineController_GetSystem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraBaselineController, OnBeginTest, "NiagaraBaselineController", "OnBeginTest", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraBaselineController, OnEndTest, "NiagaraBaselineController", "OnEndTest", SDK::Params::NiagaraBaselineController_OnEndTest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraBaselineController, OnOwnerTick, "NiagaraBaselineController", "OnOwnerTick", SDK::Params::NiagaraBaselineController_OnOwnerTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraBaselineController, OnTickTest, "NiagaraBaselineController", "OnTickTest", SDK::Params::NiagaraBaselineController_OnTickTest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraPreviewBase, SetLabelText, "NiagaraPreviewBase", "SetLabelText", SDK::Params::NiagaraPreviewBase_SetLabelText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraPreviewBase, SetSystem, "NiagaraPreviewBase", "SetSystem", SDK::Params::NiagaraPreviewBase_SetSystem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraPreviewAxis, ApplyToPreview, "NiagaraPreviewAxis", "ApplyToPreview", SDK::Params::NiagaraPreviewAxis_ApplyToPreview)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraPreviewAxis, Num, "NiagaraPreviewAxis", "Num", SDK::Params::NiagaraPreviewAxis_Num)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraPreviewGrid, ActivatePreviews, "NiagaraPreviewGrid", "ActivatePreviews", SDK::Params::NiagaraPreviewGrid_ActivatePreviews)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraPreviewGrid, DeactivatePreviews, "NiagaraPreviewGrid", "DeactivatePreviews", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraPreviewGrid, GetPreviews, "NiagaraPreviewGrid", "GetPreviews", SDK::Params::NiagaraPreviewGrid_GetPreviews)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ANiagaraPreviewGrid, SetPaused, "NiagaraPreviewGrid", "SetPaused", SDK::Params::NiagaraPreviewGrid_SetPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraScript, RaiseOnGPUCompilationComplete, "NiagaraScript", "RaiseOnGPUCompilationComplete", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, GetAttributeCaptureMode, "NiagaraSimCache", "GetAttributeCaptureMode", SDK::Params::NiagaraSimCache_GetAttributeCaptureMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, GetEmitterName, "NiagaraSimCache", "GetEmitterName", SDK::Params::NiagaraSimCache_GetEmitterName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, GetEmitterNames, "NiagaraSimCache", "GetEmitterNames", SDK::Params::NiagaraSimCache_GetEmitterNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, GetNumEmitters, "NiagaraSimCache", "GetNumEmitters", SDK::Params::NiagaraSimCache_GetNumEmitters)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, GetNumFrames, "NiagaraSimCache", "GetNumFrames", SDK::Params::NiagaraSimCache_GetNumFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, GetStartSeconds, "NiagaraSimCache", "GetStartSeconds", SDK::Params::NiagaraSimCache_GetStartSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, IsCacheValid, "NiagaraSimCache", "IsCacheValid", SDK::Params::NiagaraSimCache_IsCacheValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, IsEmpty, "NiagaraSimCache", "IsEmpty", SDK::Params::NiagaraSimCache_IsEmpty)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadColorAttribute, "NiagaraSimCache", "ReadColorAttribute", SDK::Params::NiagaraSimCache_ReadColorAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadFloatAttribute, "NiagaraSimCache", "ReadFloatAttribute", SDK::Params::NiagaraSimCache_ReadFloatAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadIDAttribute, "NiagaraSimCache", "ReadIDAttribute", SDK::Params::NiagaraSimCache_ReadIDAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadIntAttribute, "NiagaraSimCache", "ReadIntAttribute", SDK::Params::NiagaraSimCache_ReadIntAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadPositionAttribute, "NiagaraSimCache", "ReadPositionAttribute", SDK::Params::NiagaraSimCache_ReadPositionAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadPositionAttributeWithRebase, "NiagaraSimCache", "ReadPositionAttributeWithRebase", SDK::Params::NiagaraSimCache_ReadPositionAttributeWithRebase)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadQuatAttribute, "NiagaraSimCache", "ReadQuatAttribute", SDK::Params::NiagaraSimCache_ReadQuatAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadQuatAttributeWithRebase, "NiagaraSimCache", "ReadQuatAttributeWithRebase", SDK::Params::NiagaraSimCache_ReadQuatAttributeWithRebase)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadVector2Attribute, "NiagaraSimCache", "ReadVector2Attribute", SDK::Params::NiagaraSimCache_ReadVector2Attribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadVector4Attribute, "NiagaraSimCache", "ReadVector4Attribute", SDK::Params::NiagaraSimCache_ReadVector4Attribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCache, ReadVectorAttribute, "NiagaraSimCache", "ReadVectorAttribute", SDK::Params::NiagaraSimCache_ReadVectorAttribute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAsyncNiagaraCaptureSimCache, CaptureNiagaraSimCache, "AsyncNiagaraCaptureSimCache", "CaptureNiagaraSimCache", SDK::Params::AsyncNiagaraCaptureSimCache_CaptureNiagaraSimCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAsyncNiagaraCaptureSimCache, CaptureNiagaraSimCacheMultiFrame, "AsyncNiagaraCaptureSimCache", "CaptureNiagaraSimCacheMultiFrame", SDK::Params::AsyncNiagaraCaptureSimCache_CaptureNiagaraSimCacheMultiFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAsyncNiagaraCaptureSimCache, CaptureNiagaraSimCacheUntilComplete, "AsyncNiagaraCaptureSimCache", "CaptureNiagaraSimCacheUntilComplete", SDK::Params::AsyncNiagaraCaptureSimCache_CaptureNiagaraSimCacheUntilComplete)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCacheFunctionLibrary, CaptureNiagaraSimCacheImmediate, "NiagaraSimCacheFunctionLibrary", "CaptureNiagaraSimCacheImmediate", SDK::Params::NiagaraSimCacheFunctionLibrary_CaptureNiagaraSimCacheImmediate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UNiagaraSimCacheFunctionLibrary, CreateNiagaraSimCache, "NiagaraSimCacheFunctionLibrary", "CreateNiagaraSimCache", SDK::Params::NiagaraSimCacheFunctionLibrary_CreateNiagaraSimCache)
+// clang-format on
@@ -0,0 +1,68 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from OnlineSubsystemUtils_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/OnlineSubsystemUtils_classes.hpp"
+#include "../SDK/OnlineSubsystemUtils_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAchievementBlueprintLibrary, GetCachedAchievementDescription, "AchievementBlueprintLibrary", "GetCachedAchievementDescription", SDK::Params::AchievementBlueprintLibrary_GetCachedAchievementDescription)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAchievementBlueprintLibrary, GetCachedAchievementProgress, "AchievementBlueprintLibrary", "GetCachedAchievementProgress", SDK::Params::AchievementBlueprintLibrary_GetCachedAchievementProgress)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAchievementQueryCallbackProxy, CacheAchievementDescriptions, "AchievementQueryCallbackProxy", "CacheAchievementDescriptions", SDK::Params::AchievementQueryCallbackProxy_CacheAchievementDescriptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAchievementQueryCallbackProxy, CacheAchievements, "AchievementQueryCallbackProxy", "CacheAchievements", SDK::Params::AchievementQueryCallbackProxy_CacheAchievements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAchievementWriteCallbackProxy, WriteAchievementProgress, "AchievementWriteCallbackProxy", "WriteAchievementProgress", SDK::Params::AchievementWriteCallbackProxy_WriteAchievementProgress)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UConnectionCallbackProxy, ConnectToService, "ConnectionCallbackProxy", "ConnectToService", SDK::Params::ConnectionCallbackProxy_ConnectToService)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCreateSessionCallbackProxy, CreateSession, "CreateSessionCallbackProxy", "CreateSession", SDK::Params::CreateSessionCallbackProxy_CreateSession)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDestroySessionCallbackProxy, DestroySession, "DestroySessionCallbackProxy", "DestroySession", SDK::Params::DestroySessionCallbackProxy_DestroySession)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEndMatchCallbackProxy, EndMatch, "EndMatchCallbackProxy", "EndMatch", SDK::Params::EndMatchCallbackProxy_EndMatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEndTurnCallbackProxy, EndTurn, "EndTurnCallbackProxy", "EndTurn", SDK::Params::EndTurnCallbackProxy_EndTurn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFindSessionsCallbackProxy, FindSessions, "FindSessionsCallbackProxy", "FindSessions", SDK::Params::FindSessionsCallbackProxy_FindSessions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFindSessionsCallbackProxy, GetCurrentPlayers, "FindSessionsCallbackProxy", "GetCurrentPlayers", SDK::Params::FindSessionsCallbackProxy_GetCurrentPlayers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFindSessionsCallbackProxy, GetMaxPlayers, "FindSessionsCallbackProxy", "GetMaxPlayers", SDK::Params::FindSessionsCallbackProxy_GetMaxPlayers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFindSessionsCallbackProxy, GetPingInMs, "FindSessionsCallbackProxy", "GetPingInMs", SDK::Params::FindSessionsCallbackProxy_GetPingInMs)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFindSessionsCallbackProxy, GetServerName, "FindSessionsCallbackProxy", "GetServerName", SDK::Params::FindSessionsCallbackProxy_GetServerName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFindTurnBasedMatchCallbackProxy, FindTurnBasedMatch, "FindTurnBasedMatchCallbackProxy", "FindTurnBasedMatch", SDK::Params::FindTurnBasedMatchCallbackProxy_FindTurnBasedMatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseCallbackProxy2, CreateProxyObjectForInAppPurchase, "InAppPurchaseCallbackProxy2", "CreateProxyObjectForInAppPurchase", SDK::Params::InAppPurchaseCallbackProxy2_CreateProxyObjectForInAppPurchase)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseCallbackProxy2, CreateProxyObjectForInAppPurchaseQueryOwned, "InAppPurchaseCallbackProxy2", "CreateProxyObjectForInAppPurchaseQueryOwned", SDK::Params::InAppPurchaseCallbackProxy2_CreateProxyObjectForInAppPurchaseQueryOwned)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseCallbackProxy2, CreateProxyObjectForInAppPurchaseUnprocessedPurchases, "InAppPurchaseCallbackProxy2", "CreateProxyObjectForInAppPurchaseUnprocessedPurchases", SDK::Params::InAppPurchaseCallbackProxy2_CreateProxyObjectForInAppPurchaseUnprocessedPurchases)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseCheckoutCallbackProxy, CreateProxyObjectForInAppPurchaseCheckout, "InAppPurchaseCheckoutCallbackProxy", "CreateProxyObjectForInAppPurchaseCheckout", SDK::Params::InAppPurchaseCheckoutCallbackProxy_CreateProxyObjectForInAppPurchaseCheckout)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseFinalizeProxy, CreateProxyObjectForInAppPurchaseFinalize, "InAppPurchaseFinalizeProxy", "CreateProxyObjectForInAppPurchaseFinalize", SDK::Params::InAppPurchaseFinalizeProxy_CreateProxyObjectForInAppPurchaseFinalize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseQueryCallbackProxy2, CreateProxyObjectForInAppPurchaseQuery, "InAppPurchaseQueryCallbackProxy2", "CreateProxyObjectForInAppPurchaseQuery", SDK::Params::InAppPurchaseQueryCallbackProxy2_CreateProxyObjectForInAppPurchaseQuery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseReceiptsCallbackProxy, CreateProxyObjectForInAppPurchaseGetKnownReceipts, "InAppPurchaseReceiptsCallbackProxy", "CreateProxyObjectForInAppPurchaseGetKnownReceipts", SDK::Params::InAppPurchaseReceiptsCallbackProxy_CreateProxyObjectForInAppPurchaseGetKnownReceipts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseReceiptsCallbackProxy, CreateProxyObjectForInAppPurchaseQueryOwnedProducts, "InAppPurchaseReceiptsCallbackProxy", "CreateProxyObjectForInAppPurchaseQueryOwnedProducts", SDK::Params::InAppPurchaseReceiptsCallbackProxy_CreateProxyObjectForInAppPurchaseQueryOwnedProducts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseReceiptsCallbackProxy, CreateProxyObjectForInAppPurchaseRestoreOwnedProducts, "InAppPurchaseReceiptsCallbackProxy", "CreateProxyObjectForInAppPurchaseRestoreOwnedProducts", SDK::Params::InAppPurchaseReceiptsCallbackProxy_CreateProxyObjectForInAppPurchaseRestoreOwnedProducts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInAppPurchaseRestoreCallbackProxy2, CreateProxyObjectForInAppPurchaseRestore, "InAppPurchaseRestoreCallbackProxy2", "CreateProxyObjectForInAppPurchaseRestore", SDK::Params::InAppPurchaseRestoreCallbackProxy2_CreateProxyObjectForInAppPurchaseRestore)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UJoinSessionCallbackProxy, JoinSession, "JoinSessionCallbackProxy", "JoinSession", SDK::Params::JoinSessionCallbackProxy_JoinSession)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULeaderboardBlueprintLibrary, WriteLeaderboardInteger, "LeaderboardBlueprintLibrary", "WriteLeaderboardInteger", SDK::Params::LeaderboardBlueprintLibrary_WriteLeaderboardInteger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULeaderboardFlushCallbackProxy, CreateProxyObjectForFlush, "LeaderboardFlushCallbackProxy", "CreateProxyObjectForFlush", SDK::Params::LeaderboardFlushCallbackProxy_CreateProxyObjectForFlush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULeaderboardQueryCallbackProxy, CreateProxyObjectForIntQuery, "LeaderboardQueryCallbackProxy", "CreateProxyObjectForIntQuery", SDK::Params::LeaderboardQueryCallbackProxy_CreateProxyObjectForIntQuery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULogoutCallbackProxy, Logout, "LogoutCallbackProxy", "Logout", SDK::Params::LogoutCallbackProxy_Logout)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AOnlineBeaconClient, ClientOnConnected, "OnlineBeaconClient", "ClientOnConnected", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ClientCancelReservationResponse, "PartyBeaconClient", "ClientCancelReservationResponse", SDK::Params::PartyBeaconClient_ClientCancelReservationResponse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ClientReservationResponse, "PartyBeaconClient", "ClientReservationResponse", SDK::Params::PartyBeaconClient_ClientReservationResponse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ClientSendReservationFull, "PartyBeaconClient", "ClientSendReservationFull", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ClientSendReservationUpdates, "PartyBeaconClient", "ClientSendReservationUpdates", SDK::Params::PartyBeaconClient_ClientSendReservationUpdates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ServerAddOrUpdateReservationRequest, "PartyBeaconClient", "ServerAddOrUpdateReservationRequest", SDK::Params::PartyBeaconClient_ServerAddOrUpdateReservationRequest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ServerCancelReservationRequest, "PartyBeaconClient", "ServerCancelReservationRequest", SDK::Params::PartyBeaconClient_ServerCancelReservationRequest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ServerRemoveMemberFromReservationRequest, "PartyBeaconClient", "ServerRemoveMemberFromReservationRequest", SDK::Params::PartyBeaconClient_ServerRemoveMemberFromReservationRequest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ServerReservationRequest, "PartyBeaconClient", "ServerReservationRequest", SDK::Params::PartyBeaconClient_ServerReservationRequest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(APartyBeaconClient, ServerUpdateReservationRequest, "PartyBeaconClient", "ServerUpdateReservationRequest", SDK::Params::PartyBeaconClient_ServerUpdateReservationRequest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UQuitMatchCallbackProxy, QuitMatch, "QuitMatchCallbackProxy", "QuitMatch", SDK::Params::QuitMatchCallbackProxy_QuitMatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UShowLoginUICallbackProxy, ShowExternalLoginUI, "ShowLoginUICallbackProxy", "ShowExternalLoginUI", SDK::Params::ShowLoginUICallbackProxy_ShowExternalLoginUI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASpectatorBeaconClient, ClientCancelReservationResponse, "SpectatorBeaconClient", "ClientCancelReservationResponse", SDK::Params::SpectatorBeaconClient_ClientCancelReservationResponse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASpectatorBeaconClient, ClientReservationResponse, "SpectatorBeaconClient", "ClientReservationResponse", SDK::Params::SpectatorBeaconClient_ClientReservationResponse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASpectatorBeaconClient, ClientSendReservationFull, "SpectatorBeaconClient", "ClientSendReservationFull", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASpectatorBeaconClient, ClientSendReservationUpdates, "SpectatorBeaconClient", "ClientSendReservationUpdates", SDK::Params::SpectatorBeaconClient_ClientSendReservationUpdates)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASpectatorBeaconClient, ServerCancelReservationRequest, "SpectatorBeaconClient", "ServerCancelReservationRequest", SDK::Params::SpectatorBeaconClient_ServerCancelReservationRequest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASpectatorBeaconClient, ServerReservationRequest, "SpectatorBeaconClient", "ServerReservationRequest", SDK::Params::SpectatorBeaconClient_ServerReservationRequest)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ATestBeaconClient, ClientPing, "TestBeaconClient", "ClientPing", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ATestBeaconClient, ServerPong, "TestBeaconClient", "ServerPong", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTurnBasedBlueprintLibrary, GetIsMyTurn, "TurnBasedBlueprintLibrary", "GetIsMyTurn", SDK::Params::TurnBasedBlueprintLibrary_GetIsMyTurn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTurnBasedBlueprintLibrary, GetMyPlayerIndex, "TurnBasedBlueprintLibrary", "GetMyPlayerIndex", SDK::Params::TurnBasedBlueprintLibrary_GetMyPlayerIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTurnBasedBlueprintLibrary, GetPlayerDisplayName, "TurnBasedBlueprintLibrary", "GetPlayerDisplayName", SDK::Params::TurnBasedBlueprintLibrary_GetPlayerDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTurnBasedBlueprintLibrary, RegisterTurnBasedMatchInterfaceObject, "TurnBasedBlueprintLibrary", "RegisterTurnBasedMatchInterfaceObject", SDK::Params::TurnBasedBlueprintLibrary_RegisterTurnBasedMatchInterfaceObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVoipListenerSynthComponent, IsIdling, "VoipListenerSynthComponent", "IsIdling", SDK::Params::VoipListenerSynthComponent_IsIdling)
+// clang-format on
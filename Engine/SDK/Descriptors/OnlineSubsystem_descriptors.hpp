@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from OnlineSubsystem_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/OnlineSubsystem_classes.hpp"
+#include "../SDK/OnlineSubsystem_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITurnBasedMatchInterface, OnMatchEnded, "TurnBasedMatchInterface", "OnMatchEnded", SDK::Params::TurnBasedMatchInterface_OnMatchEnded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITurnBasedMatchInterface, OnMatchReceivedTurn, "TurnBasedMatchInterface", "OnMatchReceivedTurn", SDK::Params::TurnBasedMatchInterface_OnMatchReceivedTurn)
+// clang-format on
@@ -0,0 +1,79 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Paper2D_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Paper2D_classes.hpp"
+#include "../SDK/Paper2D_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbook, GetKeyFrameIndexAtTime, "PaperFlipbook", "GetKeyFrameIndexAtTime", SDK::Params::PaperFlipbook_GetKeyFrameIndexAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbook, GetNumFrames, "PaperFlipbook", "GetNumFrames", SDK::Params::PaperFlipbook_GetNumFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbook, GetNumKeyFrames, "PaperFlipbook", "GetNumKeyFrames", SDK::Params::PaperFlipbook_GetNumKeyFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbook, GetSpriteAtFrame, "PaperFlipbook", "GetSpriteAtFrame", SDK::Params::PaperFlipbook_GetSpriteAtFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbook, GetSpriteAtTime, "PaperFlipbook", "GetSpriteAtTime", SDK::Params::PaperFlipbook_GetSpriteAtTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbook, GetTotalDuration, "PaperFlipbook", "GetTotalDuration", SDK::Params::PaperFlipbook_GetTotalDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbook, IsValidKeyFrameIndex, "PaperFlipbook", "IsValidKeyFrameIndex", SDK::Params::PaperFlipbook_IsValidKeyFrameIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, GetFlipbook, "PaperFlipbookComponent", "GetFlipbook", SDK::Params::PaperFlipbookComponent_GetFlipbook)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, OnRep_SourceFlipbook, "PaperFlipbookComponent", "OnRep_SourceFlipbook", SDK::Params::PaperFlipbookComponent_OnRep_SourceFlipbook)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, Play, "PaperFlipbookComponent", "Play", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, PlayFromStart, "PaperFlipbookComponent", "PlayFromStart", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, Reverse, "PaperFlipbookComponent", "Reverse", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, ReverseFromEnd, "PaperFlipbookComponent", "ReverseFromEnd", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, SetFlipbook, "PaperFlipbookComponent", "SetFlipbook", SDK::Params::PaperFlipbookComponent_SetFlipbook)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, SetLooping, "PaperFlipbookComponent", "SetLooping", SDK::Params::PaperFlipbookComponent_SetLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, SetNewTime, "PaperFlipbookComponent", "SetNewTime", SDK::Params::PaperFlipbookComponent_SetNewTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, SetPlaybackPosition, "PaperFlipbookComponent", "SetPlaybackPosition", SDK::Params::PaperFlipbookComponent_SetPlaybackPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, SetPlaybackPositionInFrames, "PaperFlipbookComponent", "SetPlaybackPositionInFrames", SDK::Params::PaperFlipbookComponent_SetPlaybackPositionInFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, SetPlayRate, "PaperFlipbookComponent", "SetPlayRate", SDK::Params::PaperFlipbookComponent_SetPlayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, SetSpriteColor, "PaperFlipbookComponent", "SetSpriteColor", SDK::Params::PaperFlipbookComponent_SetSpriteColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, Stop, "PaperFlipbookComponent", "Stop", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, GetFlipbookFramerate, "PaperFlipbookComponent", "GetFlipbookFramerate", SDK::Params::PaperFlipbookComponent_GetFlipbookFramerate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, GetFlipbookLength, "PaperFlipbookComponent", "GetFlipbookLength", SDK::Params::PaperFlipbookComponent_GetFlipbookLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, GetFlipbookLengthInFrames, "PaperFlipbookComponent", "GetFlipbookLengthInFrames", SDK::Params::PaperFlipbookComponent_GetFlipbookLengthInFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, GetPlaybackPosition, "PaperFlipbookComponent", "GetPlaybackPosition", SDK::Params::PaperFlipbookComponent_GetPlaybackPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, GetPlaybackPositionInFrames, "PaperFlipbookComponent", "GetPlaybackPositionInFrames", SDK::Params::PaperFlipbookComponent_GetPlaybackPositionInFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, GetPlayRate, "PaperFlipbookComponent", "GetPlayRate", SDK::Params::PaperFlipbookComponent_GetPlayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, GetSpriteColor, "PaperFlipbookComponent", "GetSpriteColor", SDK::Params::PaperFlipbookComponent_GetSpriteColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, IsLooping, "PaperFlipbookComponent", "IsLooping", SDK::Params::PaperFlipbookComponent_IsLooping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, IsPlaying, "PaperFlipbookComponent", "IsPlaying", SDK::Params::PaperFlipbookComponent_IsPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperFlipbookComponent, IsReversing, "PaperFlipbookComponent", "IsReversing", SDK::Params::PaperFlipbookComponent_IsReversing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperGroupedSpriteComponent, AddInstance, "PaperGroupedSpriteComponent", "AddInstance", SDK::Params::PaperGroupedSpriteComponent_AddInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperGroupedSpriteComponent, ClearInstances, "PaperGroupedSpriteComponent", "ClearInstances", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperGroupedSpriteComponent, RemoveInstance, "PaperGroupedSpriteComponent", "RemoveInstance", SDK::Params::PaperGroupedSpriteComponent_RemoveInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperGroupedSpriteComponent, SortInstancesAlongAxis, "PaperGroupedSpriteComponent", "SortInstancesAlongAxis", SDK::Params::PaperGroupedSpriteComponent_SortInstancesAlongAxis)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperGroupedSpriteComponent, UpdateInstanceColor, "PaperGroupedSpriteComponent", "UpdateInstanceColor", SDK::Params::PaperGroupedSpriteComponent_UpdateInstanceColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperGroupedSpriteComponent, UpdateInstanceTransform, "PaperGroupedSpriteComponent", "UpdateInstanceTransform", SDK::Params::PaperGroupedSpriteComponent_UpdateInstanceTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperGroupedSpriteComponent, GetInstanceCount, "PaperGroupedSpriteComponent", "GetInstanceCount", SDK::Params::PaperGroupedSpriteComponent_GetInstanceCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperGroupedSpriteComponent, GetInstanceTransform, "PaperGroupedSpriteComponent", "GetInstanceTransform", SDK::Params::PaperGroupedSpriteComponent_GetInstanceTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperSpriteBlueprintLibrary, MakeBrushFromSprite, "PaperSpriteBlueprintLibrary", "MakeBrushFromSprite", SDK::Params::PaperSpriteBlueprintLibrary_MakeBrushFromSprite)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperSpriteComponent, GetSprite, "PaperSpriteComponent", "GetSprite", SDK::Params::PaperSpriteComponent_GetSprite)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperSpriteComponent, SetSprite, "PaperSpriteComponent", "SetSprite", SDK::Params::PaperSpriteComponent_SetSprite)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperSpriteComponent, SetSpriteColor, "PaperSpriteComponent", "SetSpriteColor", SDK::Params::PaperSpriteComponent_SetSpriteColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, AddNewLayer, "PaperTileMapComponent", "AddNewLayer", SDK::Params::PaperTileMapComponent_AddNewLayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, CreateNewTileMap, "PaperTileMapComponent", "CreateNewTileMap", SDK::Params::PaperTileMapComponent_CreateNewTileMap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, GetMapSize, "PaperTileMapComponent", "GetMapSize", SDK::Params::PaperTileMapComponent_GetMapSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, MakeTileMapEditable, "PaperTileMapComponent", "MakeTileMapEditable", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, RebuildCollision, "PaperTileMapComponent", "RebuildCollision", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, ResizeMap, "PaperTileMapComponent", "ResizeMap", SDK::Params::PaperTileMapComponent_ResizeMap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, SetDefaultCollisionThickness, "PaperTileMapComponent", "SetDefaultCollisionThickness", SDK::Params::PaperTileMapComponent_SetDefaultCollisionThickness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, SetLayerCollision, "PaperTileMapComponent", "SetLayerCollision", SDK::Params::PaperTileMapComponent_SetLayerCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, SetLayerColor, "PaperTileMapComponent", "SetLayerColor", SDK::Params::PaperTileMapComponent_SetLayerColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, SetTile, "PaperTileMapComponent", "SetTile", SDK::Params::PaperTileMapComponent_SetTile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, SetTileMap, "PaperTileMapComponent", "SetTileMap", SDK::Params::PaperTileMapComponent_SetTileMap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, SetTileMapColor, "PaperTileMapComponent", "SetTileMapColor", SDK::Params::PaperTileMapComponent_SetTileMapColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, GetLayerColor, "PaperTileMapComponent", "GetLayerColor", SDK::Params::PaperTileMapComponent_GetLayerColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, GetTile, "PaperTileMapComponent", "GetTile", SDK::Params::PaperTileMapComponent_GetTile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, GetTileCenterPosition, "PaperTileMapComponent", "GetTileCenterPosition", SDK::Params::PaperTileMapComponent_GetTileCenterPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, GetTileCornerPosition, "PaperTileMapComponent", "GetTileCornerPosition", SDK::Params::PaperTileMapComponent_GetTileCornerPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, GetTileMapColor, "PaperTileMapComponent", "GetTileMapColor", SDK::Params::PaperTileMapComponent_GetTileMapColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, GetTilePolygon, "PaperTileMapComponent", "GetTilePolygon", SDK::Params::PaperTileMapComponent_GetTilePolygon)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTileMapComponent, OwnsTileMap, "PaperTileMapComponent", "OwnsTileMap", SDK::Params::PaperTileMapComponent_OwnsTileMap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPaperTerrainComponent, SetTerrainColor, "PaperTerrainComponent", "SetTerrainColor", SDK::Params::PaperTerrainComponent_SetTerrainColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileMapBlueprintLibrary, BreakTile, "TileMapBlueprintLibrary", "BreakTile", SDK::Params::TileMapBlueprintLibrary_BreakTile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileMapBlueprintLibrary, GetTileTransform, "TileMapBlueprintLibrary", "GetTileTransform", SDK::Params::TileMapBlueprintLibrary_GetTileTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileMapBlueprintLibrary, GetTileUserData, "TileMapBlueprintLibrary", "GetTileUserData", SDK::Params::TileMapBlueprintLibrary_GetTileUserData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileMapBlueprintLibrary, MakeTile, "TileMapBlueprintLibrary", "MakeTile", SDK::Params::TileMapBlueprintLibrary_MakeTile)
+// clang-format on
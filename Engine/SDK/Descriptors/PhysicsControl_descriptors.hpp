@@ -0,0 +1,148 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from PhysicsControl_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/PhysicsControl_classes.hpp"
+#include "../SDK/PhysicsControl_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, AddControlParameters, "PhysicsControlBPLibrary", "AddControlParameters", SDK::Params::PhysicsControlBPLibrary_AddControlParameters)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, AddModifierParameters, "PhysicsControlBPLibrary", "AddModifierParameters", SDK::Params::PhysicsControlBPLibrary_AddModifierParameters)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, AddMultipleControlParameters, "PhysicsControlBPLibrary", "AddMultipleControlParameters", SDK::Params::PhysicsControlBPLibrary_AddMultipleControlParameters)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, AddMultipleModifierParameters, "PhysicsControlBPLibrary", "AddMultipleModifierParameters", SDK::Params::PhysicsControlBPLibrary_AddMultipleModifierParameters)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, BlendControlParametersThroughSet, "PhysicsControlBPLibrary", "BlendControlParametersThroughSet", SDK::Params::PhysicsControlBPLibrary_BlendControlParametersThroughSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, BlendModifierParametersThroughSet, "PhysicsControlBPLibrary", "BlendModifierParametersThroughSet", SDK::Params::PhysicsControlBPLibrary_BlendModifierParametersThroughSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, BlendParameters, "PhysicsControlBPLibrary", "BlendParameters", SDK::Params::PhysicsControlBPLibrary_BlendParameters)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, ConvertToRigidBodyWithControl, "PhysicsControlBPLibrary", "ConvertToRigidBodyWithControl", SDK::Params::PhysicsControlBPLibrary_ConvertToRigidBodyWithControl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, ConvertToRigidBodyWithControlPure, "PhysicsControlBPLibrary", "ConvertToRigidBodyWithControlPure", SDK::Params::PhysicsControlBPLibrary_ConvertToRigidBodyWithControlPure)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, GetBodyModifierNamesInSet, "PhysicsControlBPLibrary", "GetBodyModifierNamesInSet", SDK::Params::PhysicsControlBPLibrary_GetBodyModifierNamesInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, GetControlNamesInSet, "PhysicsControlBPLibrary", "GetControlNamesInSet", SDK::Params::PhysicsControlBPLibrary_GetControlNamesInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlBPLibrary, SetOverridePhysicsAsset, "PhysicsControlBPLibrary", "SetOverridePhysicsAsset", SDK::Params::PhysicsControlBPLibrary_SetOverridePhysicsAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, AddBodyModifiersToSet, "PhysicsControlComponent", "AddBodyModifiersToSet", SDK::Params::PhysicsControlComponent_AddBodyModifiersToSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, AddBodyModifierToSet, "PhysicsControlComponent", "AddBodyModifierToSet", SDK::Params::PhysicsControlComponent_AddBodyModifierToSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, AddControlsToSet, "PhysicsControlComponent", "AddControlsToSet", SDK::Params::PhysicsControlComponent_AddControlsToSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, AddControlToSet, "PhysicsControlComponent", "AddControlToSet", SDK::Params::PhysicsControlComponent_AddControlToSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateBodyModifier, "PhysicsControlComponent", "CreateBodyModifier", SDK::Params::PhysicsControlComponent_CreateBodyModifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateBodyModifiersFromLimbBones, "PhysicsControlComponent", "CreateBodyModifiersFromLimbBones", SDK::Params::PhysicsControlComponent_CreateBodyModifiersFromLimbBones)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateBodyModifiersFromSkeletalMeshBelow, "PhysicsControlComponent", "CreateBodyModifiersFromSkeletalMeshBelow", SDK::Params::PhysicsControlComponent_CreateBodyModifiersFromSkeletalMeshBelow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControl, "PhysicsControlComponent", "CreateControl", SDK::Params::PhysicsControlComponent_CreateControl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControlsAndBodyModifiersFromControlProfileAsset, "PhysicsControlComponent", "CreateControlsAndBodyModifiersFromControlProfileAsset", SDK::Params::PhysicsControlComponent_CreateControlsAndBodyModifiersFromControlProfileAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControlsAndBodyModifiersFromLimbBones, "PhysicsControlComponent", "CreateControlsAndBodyModifiersFromLimbBones", SDK::Params::PhysicsControlComponent_CreateControlsAndBodyModifiersFromLimbBones)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControlsFromLimbBones, "PhysicsControlComponent", "CreateControlsFromLimbBones", SDK::Params::PhysicsControlComponent_CreateControlsFromLimbBones)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControlsFromLimbBonesAndConstraintProfile, "PhysicsControlComponent", "CreateControlsFromLimbBonesAndConstraintProfile", SDK::Params::PhysicsControlComponent_CreateControlsFromLimbBonesAndConstraintProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControlsFromSkeletalMesh, "PhysicsControlComponent", "CreateControlsFromSkeletalMesh", SDK::Params::PhysicsControlComponent_CreateControlsFromSkeletalMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControlsFromSkeletalMeshAndConstraintProfile, "PhysicsControlComponent", "CreateControlsFromSkeletalMeshAndConstraintProfile", SDK::Params::PhysicsControlComponent_CreateControlsFromSkeletalMeshAndConstraintProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControlsFromSkeletalMeshAndConstraintProfileBelow, "PhysicsControlComponent", "CreateControlsFromSkeletalMeshAndConstraintProfileBelow", SDK::Params::PhysicsControlComponent_CreateControlsFromSkeletalMeshAndConstraintProfileBelow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateControlsFromSkeletalMeshBelow, "PhysicsControlComponent", "CreateControlsFromSkeletalMeshBelow", SDK::Params::PhysicsControlComponent_CreateControlsFromSkeletalMeshBelow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateNamedBodyModifier, "PhysicsControlComponent", "CreateNamedBodyModifier", SDK::Params::PhysicsControlComponent_CreateNamedBodyModifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, CreateNamedControl, "PhysicsControlComponent", "CreateNamedControl", SDK::Params::PhysicsControlComponent_CreateNamedControl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, DestroyBodyModifier, "PhysicsControlComponent", "DestroyBodyModifier", SDK::Params::PhysicsControlComponent_DestroyBodyModifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, DestroyBodyModifiers, "PhysicsControlComponent", "DestroyBodyModifiers", SDK::Params::PhysicsControlComponent_DestroyBodyModifiers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, DestroyBodyModifiersInSet, "PhysicsControlComponent", "DestroyBodyModifiersInSet", SDK::Params::PhysicsControlComponent_DestroyBodyModifiersInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, DestroyControl, "PhysicsControlComponent", "DestroyControl", SDK::Params::PhysicsControlComponent_DestroyControl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, DestroyControls, "PhysicsControlComponent", "DestroyControls", SDK::Params::PhysicsControlComponent_DestroyControls)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, DestroyControlsInSet, "PhysicsControlComponent", "DestroyControlsInSet", SDK::Params::PhysicsControlComponent_DestroyControlsInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBoneAngularVelocities, "PhysicsControlComponent", "GetCachedBoneAngularVelocities", SDK::Params::PhysicsControlComponent_GetCachedBoneAngularVelocities)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBoneAngularVelocity, "PhysicsControlComponent", "GetCachedBoneAngularVelocity", SDK::Params::PhysicsControlComponent_GetCachedBoneAngularVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBoneOrientation, "PhysicsControlComponent", "GetCachedBoneOrientation", SDK::Params::PhysicsControlComponent_GetCachedBoneOrientation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBoneOrientations, "PhysicsControlComponent", "GetCachedBoneOrientations", SDK::Params::PhysicsControlComponent_GetCachedBoneOrientations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBonePosition, "PhysicsControlComponent", "GetCachedBonePosition", SDK::Params::PhysicsControlComponent_GetCachedBonePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBonePositions, "PhysicsControlComponent", "GetCachedBonePositions", SDK::Params::PhysicsControlComponent_GetCachedBonePositions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBoneTransform, "PhysicsControlComponent", "GetCachedBoneTransform", SDK::Params::PhysicsControlComponent_GetCachedBoneTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBoneTransforms, "PhysicsControlComponent", "GetCachedBoneTransforms", SDK::Params::PhysicsControlComponent_GetCachedBoneTransforms)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBoneVelocities, "PhysicsControlComponent", "GetCachedBoneVelocities", SDK::Params::PhysicsControlComponent_GetCachedBoneVelocities)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetCachedBoneVelocity, "PhysicsControlComponent", "GetCachedBoneVelocity", SDK::Params::PhysicsControlComponent_GetCachedBoneVelocity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, InvokeControlProfile, "PhysicsControlComponent", "InvokeControlProfile", SDK::Params::PhysicsControlComponent_InvokeControlProfile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, ResetBodyModifiersInSetToCachedBoneTransforms, "PhysicsControlComponent", "ResetBodyModifiersInSetToCachedBoneTransforms", SDK::Params::PhysicsControlComponent_ResetBodyModifiersInSetToCachedBoneTransforms)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, ResetBodyModifiersToCachedBoneTransforms, "PhysicsControlComponent", "ResetBodyModifiersToCachedBoneTransforms", SDK::Params::PhysicsControlComponent_ResetBodyModifiersToCachedBoneTransforms)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, ResetBodyModifierToCachedBoneTransform, "PhysicsControlComponent", "ResetBodyModifierToCachedBoneTransform", SDK::Params::PhysicsControlComponent_ResetBodyModifierToCachedBoneTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, ResetControlPoint, "PhysicsControlComponent", "ResetControlPoint", SDK::Params::PhysicsControlComponent_ResetControlPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierCollisionType, "PhysicsControlComponent", "SetBodyModifierCollisionType", SDK::Params::PhysicsControlComponent_SetBodyModifierCollisionType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierData, "PhysicsControlComponent", "SetBodyModifierData", SDK::Params::PhysicsControlComponent_SetBodyModifierData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierDatas, "PhysicsControlComponent", "SetBodyModifierDatas", SDK::Params::PhysicsControlComponent_SetBodyModifierDatas)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierDatasInSet, "PhysicsControlComponent", "SetBodyModifierDatasInSet", SDK::Params::PhysicsControlComponent_SetBodyModifierDatasInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierGravityMultiplier, "PhysicsControlComponent", "SetBodyModifierGravityMultiplier", SDK::Params::PhysicsControlComponent_SetBodyModifierGravityMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierKinematicTarget, "PhysicsControlComponent", "SetBodyModifierKinematicTarget", SDK::Params::PhysicsControlComponent_SetBodyModifierKinematicTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierMovementType, "PhysicsControlComponent", "SetBodyModifierMovementType", SDK::Params::PhysicsControlComponent_SetBodyModifierMovementType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierPhysicsBlendWeight, "PhysicsControlComponent", "SetBodyModifierPhysicsBlendWeight", SDK::Params::PhysicsControlComponent_SetBodyModifierPhysicsBlendWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersCollisionType, "PhysicsControlComponent", "SetBodyModifiersCollisionType", SDK::Params::PhysicsControlComponent_SetBodyModifiersCollisionType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersGravityMultiplier, "PhysicsControlComponent", "SetBodyModifiersGravityMultiplier", SDK::Params::PhysicsControlComponent_SetBodyModifiersGravityMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersInSetCollisionType, "PhysicsControlComponent", "SetBodyModifiersInSetCollisionType", SDK::Params::PhysicsControlComponent_SetBodyModifiersInSetCollisionType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersInSetGravityMultiplier, "PhysicsControlComponent", "SetBodyModifiersInSetGravityMultiplier", SDK::Params::PhysicsControlComponent_SetBodyModifiersInSetGravityMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersInSetMovementType, "PhysicsControlComponent", "SetBodyModifiersInSetMovementType", SDK::Params::PhysicsControlComponent_SetBodyModifiersInSetMovementType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersInSetPhysicsBlendWeight, "PhysicsControlComponent", "SetBodyModifiersInSetPhysicsBlendWeight", SDK::Params::PhysicsControlComponent_SetBodyModifiersInSetPhysicsBlendWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersInSetUpdateKinematicFromSimulation, "PhysicsControlComponent", "SetBodyModifiersInSetUpdateKinematicFromSimulation", SDK::Params::PhysicsControlComponent_SetBodyModifiersInSetUpdateKinematicFromSimulation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersInSetUseSkeletalAnimation, "PhysicsControlComponent", "SetBodyModifiersInSetUseSkeletalAnimation", SDK::Params::PhysicsControlComponent_SetBodyModifiersInSetUseSkeletalAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersMovementType, "PhysicsControlComponent", "SetBodyModifiersMovementType", SDK::Params::PhysicsControlComponent_SetBodyModifiersMovementType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierSparseData, "PhysicsControlComponent", "SetBodyModifierSparseData", SDK::Params::PhysicsControlComponent_SetBodyModifierSparseData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierSparseDatas, "PhysicsControlComponent", "SetBodyModifierSparseDatas", SDK::Params::PhysicsControlComponent_SetBodyModifierSparseDatas)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierSparseDatasInSet, "PhysicsControlComponent", "SetBodyModifierSparseDatasInSet", SDK::Params::PhysicsControlComponent_SetBodyModifierSparseDatasInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersPhysicsBlendWeight, "PhysicsControlComponent", "SetBodyModifiersPhysicsBlendWeight", SDK::Params::PhysicsControlComponent_SetBodyModifiersPhysicsBlendWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersUpdateKinematicFromSimulation, "PhysicsControlComponent", "SetBodyModifiersUpdateKinematicFromSimulation", SDK::Params::PhysicsControlComponent_SetBodyModifiersUpdateKinematicFromSimulation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifiersUseSkeletalAnimation, "PhysicsControlComponent", "SetBodyModifiersUseSkeletalAnimation", SDK::Params::PhysicsControlComponent_SetBodyModifiersUseSkeletalAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierUpdateKinematicFromSimulation, "PhysicsControlComponent", "SetBodyModifierUpdateKinematicFromSimulation", SDK::Params::PhysicsControlComponent_SetBodyModifierUpdateKinematicFromSimulation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetBodyModifierUseSkeletalAnimation, "PhysicsControlComponent", "SetBodyModifierUseSkeletalAnimation", SDK::Params::PhysicsControlComponent_SetBodyModifierUseSkeletalAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetCachedBoneData, "PhysicsControlComponent", "SetCachedBoneData", SDK::Params::PhysicsControlComponent_SetCachedBoneData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlAngularData, "PhysicsControlComponent", "SetControlAngularData", SDK::Params::PhysicsControlComponent_SetControlAngularData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlData, "PhysicsControlComponent", "SetControlData", SDK::Params::PhysicsControlComponent_SetControlData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlDatas, "PhysicsControlComponent", "SetControlDatas", SDK::Params::PhysicsControlComponent_SetControlDatas)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlDatasInSet, "PhysicsControlComponent", "SetControlDatasInSet", SDK::Params::PhysicsControlComponent_SetControlDatasInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlDisableCollision, "PhysicsControlComponent", "SetControlDisableCollision", SDK::Params::PhysicsControlComponent_SetControlDisableCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlEnabled, "PhysicsControlComponent", "SetControlEnabled", SDK::Params::PhysicsControlComponent_SetControlEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlLinearData, "PhysicsControlComponent", "SetControlLinearData", SDK::Params::PhysicsControlComponent_SetControlLinearData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlMultiplier, "PhysicsControlComponent", "SetControlMultiplier", SDK::Params::PhysicsControlComponent_SetControlMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlMultipliers, "PhysicsControlComponent", "SetControlMultipliers", SDK::Params::PhysicsControlComponent_SetControlMultipliers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlMultipliersInSet, "PhysicsControlComponent", "SetControlMultipliersInSet", SDK::Params::PhysicsControlComponent_SetControlMultipliersInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlParent, "PhysicsControlComponent", "SetControlParent", SDK::Params::PhysicsControlComponent_SetControlParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlParents, "PhysicsControlComponent", "SetControlParents", SDK::Params::PhysicsControlComponent_SetControlParents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlParentsInSet, "PhysicsControlComponent", "SetControlParentsInSet", SDK::Params::PhysicsControlComponent_SetControlParentsInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlPoint, "PhysicsControlComponent", "SetControlPoint", SDK::Params::PhysicsControlComponent_SetControlPoint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlsDisableCollision, "PhysicsControlComponent", "SetControlsDisableCollision", SDK::Params::PhysicsControlComponent_SetControlsDisableCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlsEnabled, "PhysicsControlComponent", "SetControlsEnabled", SDK::Params::PhysicsControlComponent_SetControlsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlsInSetDisableCollision, "PhysicsControlComponent", "SetControlsInSetDisableCollision", SDK::Params::PhysicsControlComponent_SetControlsInSetDisableCollision)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlsInSetEnabled, "PhysicsControlComponent", "SetControlsInSetEnabled", SDK::Params::PhysicsControlComponent_SetControlsInSetEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlsInSetUseSkeletalAnimation, "PhysicsControlComponent", "SetControlsInSetUseSkeletalAnimation", SDK::Params::PhysicsControlComponent_SetControlsInSetUseSkeletalAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlSparseData, "PhysicsControlComponent", "SetControlSparseData", SDK::Params::PhysicsControlComponent_SetControlSparseData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlSparseDatas, "PhysicsControlComponent", "SetControlSparseDatas", SDK::Params::PhysicsControlComponent_SetControlSparseDatas)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlSparseDatasInSet, "PhysicsControlComponent", "SetControlSparseDatasInSet", SDK::Params::PhysicsControlComponent_SetControlSparseDatasInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlSparseMultiplier, "PhysicsControlComponent", "SetControlSparseMultiplier", SDK::Params::PhysicsControlComponent_SetControlSparseMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlSparseMultipliers, "PhysicsControlComponent", "SetControlSparseMultipliers", SDK::Params::PhysicsControlComponent_SetControlSparseMultipliers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlSparseMultipliersInSet, "PhysicsControlComponent", "SetControlSparseMultipliersInSet", SDK::Params::PhysicsControlComponent_SetControlSparseMultipliersInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlsUseSkeletalAnimation, "PhysicsControlComponent", "SetControlsUseSkeletalAnimation", SDK::Params::PhysicsControlComponent_SetControlsUseSkeletalAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTarget, "PhysicsControlComponent", "SetControlTarget", SDK::Params::PhysicsControlComponent_SetControlTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetOrientation, "PhysicsControlComponent", "SetControlTargetOrientation", SDK::Params::PhysicsControlComponent_SetControlTargetOrientation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetOrientations, "PhysicsControlComponent", "SetControlTargetOrientations", SDK::Params::PhysicsControlComponent_SetControlTargetOrientations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetOrientationsFromArray, "PhysicsControlComponent", "SetControlTargetOrientationsFromArray", SDK::Params::PhysicsControlComponent_SetControlTargetOrientationsFromArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetOrientationsInSet, "PhysicsControlComponent", "SetControlTargetOrientationsInSet", SDK::Params::PhysicsControlComponent_SetControlTargetOrientationsInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPoses, "PhysicsControlComponent", "SetControlTargetPoses", SDK::Params::PhysicsControlComponent_SetControlTargetPoses)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPosition, "PhysicsControlComponent", "SetControlTargetPosition", SDK::Params::PhysicsControlComponent_SetControlTargetPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPositionAndOrientation, "PhysicsControlComponent", "SetControlTargetPositionAndOrientation", SDK::Params::PhysicsControlComponent_SetControlTargetPositionAndOrientation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPositions, "PhysicsControlComponent", "SetControlTargetPositions", SDK::Params::PhysicsControlComponent_SetControlTargetPositions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPositionsAndOrientations, "PhysicsControlComponent", "SetControlTargetPositionsAndOrientations", SDK::Params::PhysicsControlComponent_SetControlTargetPositionsAndOrientations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPositionsAndOrientationsFromArray, "PhysicsControlComponent", "SetControlTargetPositionsAndOrientationsFromArray", SDK::Params::PhysicsControlComponent_SetControlTargetPositionsAndOrientationsFromArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPositionsAndOrientationsInSet, "PhysicsControlComponent", "SetControlTargetPositionsAndOrientationsInSet", SDK::Params::PhysicsControlComponent_SetControlTargetPositionsAndOrientationsInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPositionsFromArray, "PhysicsControlComponent", "SetControlTargetPositionsFromArray", SDK::Params::PhysicsControlComponent_SetControlTargetPositionsFromArray)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetPositionsInSet, "PhysicsControlComponent", "SetControlTargetPositionsInSet", SDK::Params::PhysicsControlComponent_SetControlTargetPositionsInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargets, "PhysicsControlComponent", "SetControlTargets", SDK::Params::PhysicsControlComponent_SetControlTargets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlTargetsInSet, "PhysicsControlComponent", "SetControlTargetsInSet", SDK::Params::PhysicsControlComponent_SetControlTargetsInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, SetControlUseSkeletalAnimation, "PhysicsControlComponent", "SetControlUseSkeletalAnimation", SDK::Params::PhysicsControlComponent_SetControlUseSkeletalAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, UpdateControls, "PhysicsControlComponent", "UpdateControls", SDK::Params::PhysicsControlComponent_UpdateControls)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, UpdateTargetCaches, "PhysicsControlComponent", "UpdateTargetCaches", SDK::Params::PhysicsControlComponent_UpdateTargetCaches)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetAllBodyModifierNames, "PhysicsControlComponent", "GetAllBodyModifierNames", SDK::Params::PhysicsControlComponent_GetAllBodyModifierNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetAllControlNames, "PhysicsControlComponent", "GetAllControlNames", SDK::Params::PhysicsControlComponent_GetAllControlNames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetBodyModifierExists, "PhysicsControlComponent", "GetBodyModifierExists", SDK::Params::PhysicsControlComponent_GetBodyModifierExists)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetBodyModifierNamesInSet, "PhysicsControlComponent", "GetBodyModifierNamesInSet", SDK::Params::PhysicsControlComponent_GetBodyModifierNamesInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetControlData, "PhysicsControlComponent", "GetControlData", SDK::Params::PhysicsControlComponent_GetControlData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetControlEnabled, "PhysicsControlComponent", "GetControlEnabled", SDK::Params::PhysicsControlComponent_GetControlEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetControlExists, "PhysicsControlComponent", "GetControlExists", SDK::Params::PhysicsControlComponent_GetControlExists)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetControlMultiplier, "PhysicsControlComponent", "GetControlMultiplier", SDK::Params::PhysicsControlComponent_GetControlMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetControlNamesInSet, "PhysicsControlComponent", "GetControlNamesInSet", SDK::Params::PhysicsControlComponent_GetControlNamesInSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetControlTarget, "PhysicsControlComponent", "GetControlTarget", SDK::Params::PhysicsControlComponent_GetControlTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetLimbBonesFromSkeletalMesh, "PhysicsControlComponent", "GetLimbBonesFromSkeletalMesh", SDK::Params::PhysicsControlComponent_GetLimbBonesFromSkeletalMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetSetsContainingBodyModifier, "PhysicsControlComponent", "GetSetsContainingBodyModifier", SDK::Params::PhysicsControlComponent_GetSetsContainingBodyModifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlComponent, GetSetsContainingControl, "PhysicsControlComponent", "GetSetsContainingControl", SDK::Params::PhysicsControlComponent_GetSetsContainingControl)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPhysicsControlInitializerComponent, CreateControls, "PhysicsControlInitializerComponent", "CreateControls", SDK::Params::PhysicsControlInitializerComponent_CreateControls)
+// clang-format on
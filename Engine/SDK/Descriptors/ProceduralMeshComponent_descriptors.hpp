@@ -0,0 +1,33 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ProceduralMeshComponent_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ProceduralMeshComponent_classes.hpp"
+#include "../SDK/ProceduralMeshComponent_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, CalculateTangentsForMesh, "KismetProceduralMeshLibrary", "CalculateTangentsForMesh", SDK::Params::KismetProceduralMeshLibrary_CalculateTangentsForMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, ConvertQuadToTriangles, "KismetProceduralMeshLibrary", "ConvertQuadToTriangles", SDK::Params::KismetProceduralMeshLibrary_ConvertQuadToTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, CopyProceduralMeshFromStaticMeshComponent, "KismetProceduralMeshLibrary", "CopyProceduralMeshFromStaticMeshComponent", SDK::Params::KismetProceduralMeshLibrary_CopyProceduralMeshFromStaticMeshComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, CreateGridMeshSplit, "KismetProceduralMeshLibrary", "CreateGridMeshSplit", SDK::Params::KismetProceduralMeshLibrary_CreateGridMeshSplit)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, CreateGridMeshTriangles, "KismetProceduralMeshLibrary", "CreateGridMeshTriangles", SDK::Params::KismetProceduralMeshLibrary_CreateGridMeshTriangles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, CreateGridMeshWelded, "KismetProceduralMeshLibrary", "CreateGridMeshWelded", SDK::Params::KismetProceduralMeshLibrary_CreateGridMeshWelded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, GenerateBoxMesh, "KismetProceduralMeshLibrary", "GenerateBoxMesh", SDK::Params::KismetProceduralMeshLibrary_GenerateBoxMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, GetSectionFromProceduralMesh, "KismetProceduralMeshLibrary", "GetSectionFromProceduralMesh", SDK::Params::KismetProceduralMeshLibrary_GetSectionFromProceduralMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, GetSectionFromStaticMesh, "KismetProceduralMeshLibrary", "GetSectionFromStaticMesh", SDK::Params::KismetProceduralMeshLibrary_GetSectionFromStaticMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UKismetProceduralMeshLibrary, SliceProceduralMesh, "KismetProceduralMeshLibrary", "SliceProceduralMesh", SDK::Params::KismetProceduralMeshLibrary_SliceProceduralMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, AddCollisionConvexMesh, "ProceduralMeshComponent", "AddCollisionConvexMesh", SDK::Params::ProceduralMeshComponent_AddCollisionConvexMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, ClearAllMeshSections, "ProceduralMeshComponent", "ClearAllMeshSections", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, ClearCollisionConvexMeshes, "ProceduralMeshComponent", "ClearCollisionConvexMeshes", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, ClearMeshSection, "ProceduralMeshComponent", "ClearMeshSection", SDK::Params::ProceduralMeshComponent_ClearMeshSection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, CreateMeshSection, "ProceduralMeshComponent", "CreateMeshSection", SDK::Params::ProceduralMeshComponent_CreateMeshSection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, CreateMeshSection_LinearColor, "ProceduralMeshComponent", "CreateMeshSection_LinearColor", SDK::Params::ProceduralMeshComponent_CreateMeshSection_LinearColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, SetMeshSectionVisible, "ProceduralMeshComponent", "SetMeshSectionVisible", SDK::Params::ProceduralMeshComponent_SetMeshSectionVisible)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, UpdateMeshSection, "ProceduralMeshComponent", "UpdateMeshSection", SDK::Params::ProceduralMeshComponent_UpdateMeshSection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, UpdateMeshSection_LinearColor, "ProceduralMeshComponent", "UpdateMeshSection_LinearColor", SDK::Params::ProceduralMeshComponent_UpdateMeshSection_LinearColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, GetNumSections, "ProceduralMeshComponent", "GetNumSections", SDK::Params::ProceduralMeshComponent_GetNumSections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProceduralMeshComponent, IsMeshSectionVisible, "ProceduralMeshComponent", "IsMeshSectionVisible", SDK::Params::ProceduralMeshComponent_IsMeshSectionVisible)
+// clang-format on
@@ -0,0 +1,20 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from PropertyPath_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/PropertyPath_classes.hpp"
+#include "../SDK/PropertyPath_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyPathTestObject, SetFloat, "PropertyPathTestObject", "SetFloat", SDK::Params::PropertyPathTestObject_SetFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyPathTestObject, SetStruct, "PropertyPathTestObject", "SetStruct", SDK::Params::PropertyPathTestObject_SetStruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyPathTestObject, SetStructConstRef, "PropertyPathTestObject", "SetStructConstRef", SDK::Params::PropertyPathTestObject_SetStructConstRef)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyPathTestObject, SetStructRef, "PropertyPathTestObject", "SetStructRef", SDK::Params::PropertyPathTestObject_SetStructRef)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyPathTestObject, GetFloat, "PropertyPathTestObject", "GetFloat", SDK::Params::PropertyPathTestObject_GetFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyPathTestObject, GetStruct, "PropertyPathTestObject", "GetStruct", SDK::Params::PropertyPathTestObject_GetStruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyPathTestObject, GetStructConstRef, "PropertyPathTestObject", "GetStructConstRef", SDK::Params::PropertyPathTestObject_GetStructConstRef)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyPathTestObject, GetStructRef, "PropertyPathTestObject", "GetStructRef", SDK::Params::PropertyPathTestObject_GetStructRef)
+// clang-format on
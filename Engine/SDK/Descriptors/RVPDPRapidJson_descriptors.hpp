@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from RVPDPRapidJson_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/RVPDPRapidJson_classes.hpp"
+#include "../SDK/RVPDPRapidJson_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeBool_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeBool_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeBool_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeBoolArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeBoolArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeBoolArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeColorArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeColorArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeColorArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeFColor_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeFColor_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeFColor_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeFloat_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeFloat_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeFloat_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeFloatArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeFloatArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeFloatArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeFName_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeFName_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeFName_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeFRotator_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeFRotator_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeFRotator_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeFString_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeFString_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeFString_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeFText_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeFText_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeFText_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeFTransform_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeFTransform_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeFTransform_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeFVector_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeFVector_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeFVector_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeInt32ArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeInt32ArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeInt32ArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeInt64_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeInt64_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeInt64_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeInt64ArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeInt64ArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeInt64ArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeInt_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeInt_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeInt_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeNameArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeNameArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeNameArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeRotatorArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeRotatorArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeRotatorArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeStringArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeStringArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeStringArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayBool_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayBool_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayBool_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayFColor_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayFColor_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayFColor_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayFloat_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayFloat_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayFloat_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayFName_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayFName_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayFName_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayFRotator_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayFRotator_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayFRotator_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayFString_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayFString_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayFString_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayFText_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayFText_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayFText_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayFTransform_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayFTransform_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayFTransform_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayFVector_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayFVector_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayFVector_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayInt64_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayInt64_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayInt64_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayInt_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayInt_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayInt_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeTArrayUInt8_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeTArrayUInt8_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeTArrayUInt8_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeTextArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeTextArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeTextArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeTransformArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeTransformArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeTransformArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeserializeUInt8_Wrapper, "RVPDPRapidJsonFunctionLibrary", "DeserializeUInt8_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeserializeUInt8_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeUInt8ArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeUInt8ArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeUInt8ArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, DeSerializeVectorArrayAsync, "RVPDPRapidJsonFunctionLibrary", "DeSerializeVectorArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_DeSerializeVectorArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeBool_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeBool_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeBool_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeBoolArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeBoolArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeBoolArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeColorArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeColorArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeColorArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFColor_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeFColor_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFColor_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFloat_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeFloat_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFloat_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFloatArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeFloatArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFloatArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFName_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeFName_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFName_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFRotator_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeFRotator_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFRotator_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFString_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeFString_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFString_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFText_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeFText_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFText_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFTransform_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeFTransform_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFTransform_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeFVector_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeFVector_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeFVector_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeInt32ArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeInt32ArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeInt32ArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeInt64_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeInt64_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeInt64_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeInt64ArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeInt64ArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeInt64ArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeInt_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeInt_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeInt_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeNameArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeNameArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeNameArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeRotatorArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeRotatorArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeRotatorArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeStringArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeStringArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeStringArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayBool_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayBool_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayBool_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayFColor_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayFColor_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayFColor_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayFloat_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayFloat_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayFloat_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayFName_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayFName_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayFName_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayFRotator_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayFRotator_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayFRotator_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayFString_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayFString_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayFString_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayFText_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayFText_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayFText_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayFTransform_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayFTransform_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayFTransform_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayFVector_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayFVector_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayFVector_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayInt64_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayInt64_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayInt64_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayInt_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayInt_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayInt_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTArrayUInt8_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeTArrayUInt8_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTArrayUInt8_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTextArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeTextArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTextArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeTransformArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeTransformArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeTransformArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeUInt8_Wrapper, "RVPDPRapidJsonFunctionLibrary", "SerializeUInt8_Wrapper", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeUInt8_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeUint8ArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeUint8ArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeUint8ArrayAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URVPDPRapidJsonFunctionLibrary, SerializeVectorArrayAsync, "RVPDPRapidJsonFunctionLibrary", "SerializeVectorArrayAsync", SDK::Params::RVPDPRapidJsonFunctionLibrary_SerializeVectorArrayAsync)
+// clang-format on
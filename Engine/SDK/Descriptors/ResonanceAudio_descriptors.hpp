@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from ResonanceAudio_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/ResonanceAudio_classes.hpp"
+#include "../SDK/ResonanceAudio_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioBlueprintFunctionLibrary, GetGlobalReverbPreset, "ResonanceAudioBlueprintFunctionLibrary", "GetGlobalReverbPreset", SDK::Params::ResonanceAudioBlueprintFunctionLibrary_GetGlobalReverbPreset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioBlueprintFunctionLibrary, SetGlobalReverbPreset, "ResonanceAudioBlueprintFunctionLibrary", "SetGlobalReverbPreset", SDK::Params::ResonanceAudioBlueprintFunctionLibrary_SetGlobalReverbPreset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetEnableRoomEffects, "ResonanceAudioReverbPluginPreset", "SetEnableRoomEffects", SDK::Params::ResonanceAudioReverbPluginPreset_SetEnableRoomEffects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetReflectionScalar, "ResonanceAudioReverbPluginPreset", "SetReflectionScalar", SDK::Params::ResonanceAudioReverbPluginPreset_SetReflectionScalar)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetReverbBrightness, "ResonanceAudioReverbPluginPreset", "SetReverbBrightness", SDK::Params::ResonanceAudioReverbPluginPreset_SetReverbBrightness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetReverbGain, "ResonanceAudioReverbPluginPreset", "SetReverbGain", SDK::Params::ResonanceAudioReverbPluginPreset_SetReverbGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetReverbTimeModifier, "ResonanceAudioReverbPluginPreset", "SetReverbTimeModifier", SDK::Params::ResonanceAudioReverbPluginPreset_SetReverbTimeModifier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetRoomDimensions, "ResonanceAudioReverbPluginPreset", "SetRoomDimensions", SDK::Params::ResonanceAudioReverbPluginPreset_SetRoomDimensions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetRoomMaterials, "ResonanceAudioReverbPluginPreset", "SetRoomMaterials", SDK::Params::ResonanceAudioReverbPluginPreset_SetRoomMaterials)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetRoomPosition, "ResonanceAudioReverbPluginPreset", "SetRoomPosition", SDK::Params::ResonanceAudioReverbPluginPreset_SetRoomPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioReverbPluginPreset, SetRoomRotation, "ResonanceAudioReverbPluginPreset", "SetRoomRotation", SDK::Params::ResonanceAudioReverbPluginPreset_SetRoomRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioSpatializationSourceSettings, SetSoundSourceDirectivity, "ResonanceAudioSpatializationSourceSettings", "SetSoundSourceDirectivity", SDK::Params::ResonanceAudioSpatializationSourceSettings_SetSoundSourceDirectivity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UResonanceAudioSpatializationSourceSettings, SetSoundSourceSpread, "ResonanceAudioSpatializationSourceSettings", "SetSoundSourceSpread", SDK::Params::ResonanceAudioSpatializationSourceSettings_SetSoundSourceSpread)
+// clang-format on
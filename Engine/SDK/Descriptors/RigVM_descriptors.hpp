@@ -0,0 +1,66 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from RigVM_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/RigVM_classes.hpp"
+#include "../SDK/RigVM_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, AddRigVMFunction, "RigVM", "AddRigVMFunction", SDK::Params::RigVM_AddRigVMFunction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, Execute, "RigVM", "Execute", SDK::Params::RigVM_Execute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueBool, "RigVM", "GetParameterValueBool", SDK::Params::RigVM_GetParameterValueBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueDouble, "RigVM", "GetParameterValueDouble", SDK::Params::RigVM_GetParameterValueDouble)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueFloat, "RigVM", "GetParameterValueFloat", SDK::Params::RigVM_GetParameterValueFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueInt, "RigVM", "GetParameterValueInt", SDK::Params::RigVM_GetParameterValueInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueName, "RigVM", "GetParameterValueName", SDK::Params::RigVM_GetParameterValueName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueQuat, "RigVM", "GetParameterValueQuat", SDK::Params::RigVM_GetParameterValueQuat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueString, "RigVM", "GetParameterValueString", SDK::Params::RigVM_GetParameterValueString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueTransform, "RigVM", "GetParameterValueTransform", SDK::Params::RigVM_GetParameterValueTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueVector, "RigVM", "GetParameterValueVector", SDK::Params::RigVM_GetParameterValueVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetParameterValueVector2D, "RigVM", "GetParameterValueVector2D", SDK::Params::RigVM_GetParameterValueVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueBool, "RigVM", "SetParameterValueBool", SDK::Params::RigVM_SetParameterValueBool)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueDouble, "RigVM", "SetParameterValueDouble", SDK::Params::RigVM_SetParameterValueDouble)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueFloat, "RigVM", "SetParameterValueFloat", SDK::Params::RigVM_SetParameterValueFloat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueInt, "RigVM", "SetParameterValueInt", SDK::Params::RigVM_SetParameterValueInt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueName, "RigVM", "SetParameterValueName", SDK::Params::RigVM_SetParameterValueName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueQuat, "RigVM", "SetParameterValueQuat", SDK::Params::RigVM_SetParameterValueQuat)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueString, "RigVM", "SetParameterValueString", SDK::Params::RigVM_SetParameterValueString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueTransform, "RigVM", "SetParameterValueTransform", SDK::Params::RigVM_SetParameterValueTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueVector, "RigVM", "SetParameterValueVector", SDK::Params::RigVM_SetParameterValueVector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, SetParameterValueVector2D, "RigVM", "SetParameterValueVector2D", SDK::Params::RigVM_SetParameterValueVector2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetRigVMFunctionName, "RigVM", "GetRigVMFunctionName", SDK::Params::RigVM_GetRigVMFunctionName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVM, GetStatistics, "RigVM", "GetStatistics", SDK::Params::RigVM_GetStatistics)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDataAssetLink, SetDataAsset, "DataAssetLink", "SetDataAsset", SDK::Params::DataAssetLink_SetDataAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDataAssetLink, GetDataAsset, "DataAssetLink", "GetDataAsset", SDK::Params::DataAssetLink_GetDataAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMUserWorkflowOptions, ReportError, "RigVMUserWorkflowOptions", "ReportError", SDK::Params::RigVMUserWorkflowOptions_ReportError)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMUserWorkflowOptions, ReportInfo, "RigVMUserWorkflowOptions", "ReportInfo", SDK::Params::RigVMUserWorkflowOptions_ReportInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMUserWorkflowOptions, ReportWarning, "RigVMUserWorkflowOptions", "ReportWarning", SDK::Params::RigVMUserWorkflowOptions_ReportWarning)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMUserWorkflowOptions, IsValid, "RigVMUserWorkflowOptions", "IsValid", SDK::Params::RigVMUserWorkflowOptions_IsValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMUserWorkflowOptions, RequiresDialog, "RigVMUserWorkflowOptions", "RequiresDialog", SDK::Params::RigVMUserWorkflowOptions_RequiresDialog)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, FindRigVMHosts, "RigVMHost", "FindRigVMHosts", SDK::Params::RigVMHost_FindRigVMHosts)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, Execute, "RigVMHost", "Execute", SDK::Params::RigVMHost_Execute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, ExecuteEvent, "RigVMHost", "ExecuteEvent", SDK::Params::RigVMHost_ExecuteEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetExtendedExecuteContext, "RigVMHost", "GetExtendedExecuteContext", SDK::Params::RigVMHost_GetExtendedExecuteContext)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetVM, "RigVMHost", "GetVM", SDK::Params::RigVMHost_GetVM)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, RemoveRunOnceEvent, "RigVMHost", "RemoveRunOnceEvent", SDK::Params::RigVMHost_RemoveRunOnceEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, RequestInit, "RigVMHost", "RequestInit", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, RequestRunOnceEvent, "RigVMHost", "RequestRunOnceEvent", SDK::Params::RigVMHost_RequestRunOnceEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, SetAbsoluteAndDeltaTime, "RigVMHost", "SetAbsoluteAndDeltaTime", SDK::Params::RigVMHost_SetAbsoluteAndDeltaTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, SetAbsoluteTime, "RigVMHost", "SetAbsoluteTime", SDK::Params::RigVMHost_SetAbsoluteTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, SetDeltaTime, "RigVMHost", "SetDeltaTime", SDK::Params::RigVMHost_SetDeltaTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, SetFramesPerSecond, "RigVMHost", "SetFramesPerSecond", SDK::Params::RigVMHost_SetFramesPerSecond)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, SetVariableFromString, "RigVMHost", "SetVariableFromString", SDK::Params::RigVMHost_SetVariableFromString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, CanExecute, "RigVMHost", "CanExecute", SDK::Params::RigVMHost_CanExecute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetAbsoluteTime, "RigVMHost", "GetAbsoluteTime", SDK::Params::RigVMHost_GetAbsoluteTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetCurrentFramesPerSecond, "RigVMHost", "GetCurrentFramesPerSecond", SDK::Params::RigVMHost_GetCurrentFramesPerSecond)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetDeltaTime, "RigVMHost", "GetDeltaTime", SDK::Params::RigVMHost_GetDeltaTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetScriptAccessibleVariables, "RigVMHost", "GetScriptAccessibleVariables", SDK::Params::RigVMHost_GetScriptAccessibleVariables)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetSupportedEvents, "RigVMHost", "GetSupportedEvents", SDK::Params::RigVMHost_GetSupportedEvents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetVariableAsString, "RigVMHost", "GetVariableAsString", SDK::Params::RigVMHost_GetVariableAsString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, GetVariableType, "RigVMHost", "GetVariableType", SDK::Params::RigVMHost_GetVariableType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, IsInitRequired, "RigVMHost", "IsInitRequired", SDK::Params::RigVMHost_IsInitRequired)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URigVMHost, SupportsEvent, "RigVMHost", "SupportsEvent", SDK::Params::RigVMHost_SupportsEvent)
+// clang-format on
@@ -0,0 +1,18 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from RunningBlood_BP_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/RunningBlood_BP_classes.hpp"
+#include "../SDK/RunningBlood_BP_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ARunningBlood_BP_C, Bleed_Event, "RunningBlood_BP_C", "Bleed Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ARunningBlood_BP_C, Destroy_Self, "RunningBlood_BP_C", "Destroy Self", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ARunningBlood_BP_C, ExecuteUbergraph_RunningBlood_BP, "RunningBlood_BP_C", "ExecuteUbergraph_RunningBlood_BP", SDK::Params::RunningBlood_BP_C_ExecuteUbergraph_RunningBlood_BP)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ARunningBlood_BP_C, ReceiveBeginPlay, "RunningBlood_BP_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ARunningBlood_BP_C, ReceiveTick, "RunningBlood_BP_C", "ReceiveTick", SDK::Params::RunningBlood_BP_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ARunningBlood_BP_C, UserConstructionScript, "RunningBlood_BP_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from SG_PlayerProgression_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/SG_PlayerProgression_classes.hpp"
+#include "../SDK/SG_PlayerProgression_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(USG_PlayerProgression_C, ExecuteUbergraph_SG_PlayerProgression, "SG_PlayerProgression_C", "ExecuteUbergraph_SG_PlayerProgression", SDK::Params::SG_PlayerProgression_C_ExecuteUbergraph_SG_PlayerProgression)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USG_PlayerProgression_C, Save_Rank_Equipment_Event, "SG_PlayerProgression_C", "Save Rank Equipment Event", SDK::Params::SG_PlayerProgression_C_Save_Rank_Equipment_Event)
+// clang-format on
@@ -0,0 +1,346 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from SequencerScripting_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/SequencerScripting_classes.hpp"
+#include "../SDK/SequencerScripting_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceKey, SetTime, "MovieSceneScriptingActorReferenceKey", "SetTime", SDK::Params::MovieSceneScriptingActorReferenceKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceKey, SetValue, "MovieSceneScriptingActorReferenceKey", "SetValue", SDK::Params::MovieSceneScriptingActorReferenceKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceKey, GetTime, "MovieSceneScriptingActorReferenceKey", "GetTime", SDK::Params::MovieSceneScriptingActorReferenceKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceKey, GetValue, "MovieSceneScriptingActorReferenceKey", "GetValue", SDK::Params::MovieSceneScriptingActorReferenceKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceChannel, AddKey, "MovieSceneScriptingActorReferenceChannel", "AddKey", SDK::Params::MovieSceneScriptingActorReferenceChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceChannel, RemoveDefault, "MovieSceneScriptingActorReferenceChannel", "RemoveDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceChannel, RemoveKey, "MovieSceneScriptingActorReferenceChannel", "RemoveKey", SDK::Params::MovieSceneScriptingActorReferenceChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceChannel, SetDefault, "MovieSceneScriptingActorReferenceChannel", "SetDefault", SDK::Params::MovieSceneScriptingActorReferenceChannel_SetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceChannel, GetDefault, "MovieSceneScriptingActorReferenceChannel", "GetDefault", SDK::Params::MovieSceneScriptingActorReferenceChannel_GetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceChannel, GetKeys, "MovieSceneScriptingActorReferenceChannel", "GetKeys", SDK::Params::MovieSceneScriptingActorReferenceChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceChannel, GetKeysByIndex, "MovieSceneScriptingActorReferenceChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingActorReferenceChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingActorReferenceChannel, HasDefault, "MovieSceneScriptingActorReferenceChannel", "HasDefault", SDK::Params::MovieSceneScriptingActorReferenceChannel_HasDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolKey, SetTime, "MovieSceneScriptingBoolKey", "SetTime", SDK::Params::MovieSceneScriptingBoolKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolKey, SetValue, "MovieSceneScriptingBoolKey", "SetValue", SDK::Params::MovieSceneScriptingBoolKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolKey, GetTime, "MovieSceneScriptingBoolKey", "GetTime", SDK::Params::MovieSceneScriptingBoolKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolKey, GetValue, "MovieSceneScriptingBoolKey", "GetValue", SDK::Params::MovieSceneScriptingBoolKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, AddKey, "MovieSceneScriptingBoolChannel", "AddKey", SDK::Params::MovieSceneScriptingBoolChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, RemoveDefault, "MovieSceneScriptingBoolChannel", "RemoveDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, RemoveKey, "MovieSceneScriptingBoolChannel", "RemoveKey", SDK::Params::MovieSceneScriptingBoolChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, SetDefault, "MovieSceneScriptingBoolChannel", "SetDefault", SDK::Params::MovieSceneScriptingBoolChannel_SetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, ComputeEffectiveRange, "MovieSceneScriptingBoolChannel", "ComputeEffectiveRange", SDK::Params::MovieSceneScriptingBoolChannel_ComputeEffectiveRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, EvaluateKeys, "MovieSceneScriptingBoolChannel", "EvaluateKeys", SDK::Params::MovieSceneScriptingBoolChannel_EvaluateKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, GetDefault, "MovieSceneScriptingBoolChannel", "GetDefault", SDK::Params::MovieSceneScriptingBoolChannel_GetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, GetKeys, "MovieSceneScriptingBoolChannel", "GetKeys", SDK::Params::MovieSceneScriptingBoolChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, GetKeysByIndex, "MovieSceneScriptingBoolChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingBoolChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, GetNumKeys, "MovieSceneScriptingBoolChannel", "GetNumKeys", SDK::Params::MovieSceneScriptingBoolChannel_GetNumKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingBoolChannel, HasDefault, "MovieSceneScriptingBoolChannel", "HasDefault", SDK::Params::MovieSceneScriptingBoolChannel_HasDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteKey, SetTime, "MovieSceneScriptingByteKey", "SetTime", SDK::Params::MovieSceneScriptingByteKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteKey, SetValue, "MovieSceneScriptingByteKey", "SetValue", SDK::Params::MovieSceneScriptingByteKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteKey, GetTime, "MovieSceneScriptingByteKey", "GetTime", SDK::Params::MovieSceneScriptingByteKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteKey, GetValue, "MovieSceneScriptingByteKey", "GetValue", SDK::Params::MovieSceneScriptingByteKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteChannel, AddKey, "MovieSceneScriptingByteChannel", "AddKey", SDK::Params::MovieSceneScriptingByteChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteChannel, RemoveDefault, "MovieSceneScriptingByteChannel", "RemoveDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteChannel, RemoveKey, "MovieSceneScriptingByteChannel", "RemoveKey", SDK::Params::MovieSceneScriptingByteChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteChannel, SetDefault, "MovieSceneScriptingByteChannel", "SetDefault", SDK::Params::MovieSceneScriptingByteChannel_SetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteChannel, GetDefault, "MovieSceneScriptingByteChannel", "GetDefault", SDK::Params::MovieSceneScriptingByteChannel_GetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteChannel, GetKeys, "MovieSceneScriptingByteChannel", "GetKeys", SDK::Params::MovieSceneScriptingByteChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteChannel, GetKeysByIndex, "MovieSceneScriptingByteChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingByteChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingByteChannel, HasDefault, "MovieSceneScriptingByteChannel", "HasDefault", SDK::Params::MovieSceneScriptingByteChannel_HasDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetArriveTangent, "MovieSceneScriptingDoubleKey", "SetArriveTangent", SDK::Params::MovieSceneScriptingDoubleKey_SetArriveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetArriveTangentWeight, "MovieSceneScriptingDoubleKey", "SetArriveTangentWeight", SDK::Params::MovieSceneScriptingDoubleKey_SetArriveTangentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetInterpolationMode, "MovieSceneScriptingDoubleKey", "SetInterpolationMode", SDK::Params::MovieSceneScriptingDoubleKey_SetInterpolationMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetLeaveTangent, "MovieSceneScriptingDoubleKey", "SetLeaveTangent", SDK::Params::MovieSceneScriptingDoubleKey_SetLeaveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetLeaveTangentWeight, "MovieSceneScriptingDoubleKey", "SetLeaveTangentWeight", SDK::Params::MovieSceneScriptingDoubleKey_SetLeaveTangentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetTangentMode, "MovieSceneScriptingDoubleKey", "SetTangentMode", SDK::Params::MovieSceneScriptingDoubleKey_SetTangentMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetTangentWeightMode, "MovieSceneScriptingDoubleKey", "SetTangentWeightMode", SDK::Params::MovieSceneScriptingDoubleKey_SetTangentWeightMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetTime, "MovieSceneScriptingDoubleKey", "SetTime", SDK::Params::MovieSceneScriptingDoubleKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, SetValue, "MovieSceneScriptingDoubleKey", "SetValue", SDK::Params::MovieSceneScriptingDoubleKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetArriveTangent, "MovieSceneScriptingDoubleKey", "GetArriveTangent", SDK::Params::MovieSceneScriptingDoubleKey_GetArriveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetArriveTangentWeight, "MovieSceneScriptingDoubleKey", "GetArriveTangentWeight", SDK::Params::MovieSceneScriptingDoubleKey_GetArriveTangentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetInterpolationMode, "MovieSceneScriptingDoubleKey", "GetInterpolationMode", SDK::Params::MovieSceneScriptingDoubleKey_GetInterpolationMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetLeaveTangent, "MovieSceneScriptingDoubleKey", "GetLeaveTangent", SDK::Params::MovieSceneScriptingDoubleKey_GetLeaveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetLeaveTangentWeight, "MovieSceneScriptingDoubleKey", "GetLeaveTangentWeight", SDK::Params::MovieSceneScriptingDoubleKey_GetLeaveTangentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetTangentMode, "MovieSceneScriptingDoubleKey", "GetTangentMode", SDK::Params::MovieSceneScriptingDoubleKey_GetTangentMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetTangentWeightMode, "MovieSceneScriptingDoubleKey", "GetTangentWeightMode", SDK::Params::MovieSceneScriptingDoubleKey_GetTangentWeightMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetTime, "MovieSceneScriptingDoubleKey", "GetTime", SDK::Params::MovieSceneScriptingDoubleKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleKey, GetValue, "MovieSceneScriptingDoubleKey", "GetValue", SDK::Params::MovieSceneScriptingDoubleKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, AddKey, "MovieSceneScriptingDoubleChannel", "AddKey", SDK::Params::MovieSceneScriptingDoubleChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, RemoveDefault, "MovieSceneScriptingDoubleChannel", "RemoveDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, RemoveKey, "MovieSceneScriptingDoubleChannel", "RemoveKey", SDK::Params::MovieSceneScriptingDoubleChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, SetDefault, "MovieSceneScriptingDoubleChannel", "SetDefault", SDK::Params::MovieSceneScriptingDoubleChannel_SetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, SetPostInfinityExtrapolation, "MovieSceneScriptingDoubleChannel", "SetPostInfinityExtrapolation", SDK::Params::MovieSceneScriptingDoubleChannel_SetPostInfinityExtrapolation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, SetPreInfinityExtrapolation, "MovieSceneScriptingDoubleChannel", "SetPreInfinityExtrapolation", SDK::Params::MovieSceneScriptingDoubleChannel_SetPreInfinityExtrapolation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, ComputeEffectiveRange, "MovieSceneScriptingDoubleChannel", "ComputeEffectiveRange", SDK::Params::MovieSceneScriptingDoubleChannel_ComputeEffectiveRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, EvaluateKeys, "MovieSceneScriptingDoubleChannel", "EvaluateKeys", SDK::Params::MovieSceneScriptingDoubleChannel_EvaluateKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, GetDefault, "MovieSceneScriptingDoubleChannel", "GetDefault", SDK::Params::MovieSceneScriptingDoubleChannel_GetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, GetKeys, "MovieSceneScriptingDoubleChannel", "GetKeys", SDK::Params::MovieSceneScriptingDoubleChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, GetKeysByIndex, "MovieSceneScriptingDoubleChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingDoubleChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, GetNumKeys, "MovieSceneScriptingDoubleChannel", "GetNumKeys", SDK::Params::MovieSceneScriptingDoubleChannel_GetNumKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, GetPostInfinityExtrapolation, "MovieSceneScriptingDoubleChannel", "GetPostInfinityExtrapolation", SDK::Params::MovieSceneScriptingDoubleChannel_GetPostInfinityExtrapolation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, GetPreInfinityExtrapolation, "MovieSceneScriptingDoubleChannel", "GetPreInfinityExtrapolation", SDK::Params::MovieSceneScriptingDoubleChannel_GetPreInfinityExtrapolation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingDoubleChannel, HasDefault, "MovieSceneScriptingDoubleChannel", "HasDefault", SDK::Params::MovieSceneScriptingDoubleChannel_HasDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingEventKey, SetTime, "MovieSceneScriptingEventKey", "SetTime", SDK::Params::MovieSceneScriptingEventKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingEventKey, SetValue, "MovieSceneScriptingEventKey", "SetValue", SDK::Params::MovieSceneScriptingEventKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingEventKey, GetTime, "MovieSceneScriptingEventKey", "GetTime", SDK::Params::MovieSceneScriptingEventKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingEventKey, GetValue, "MovieSceneScriptingEventKey", "GetValue", SDK::Params::MovieSceneScriptingEventKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingEventChannel, AddKey, "MovieSceneScriptingEventChannel", "AddKey", SDK::Params::MovieSceneScriptingEventChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingEventChannel, RemoveKey, "MovieSceneScriptingEventChannel", "RemoveKey", SDK::Params::MovieSceneScriptingEventChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingEventChannel, GetKeys, "MovieSceneScriptingEventChannel", "GetKeys", SDK::Params::MovieSceneScriptingEventChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingEventChannel, GetKeysByIndex, "MovieSceneScriptingEventChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingEventChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetArriveTangent, "MovieSceneScriptingFloatKey", "SetArriveTangent", SDK::Params::MovieSceneScriptingFloatKey_SetArriveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetArriveTangentWeight, "MovieSceneScriptingFloatKey", "SetArriveTangentWeight", SDK::Params::MovieSceneScriptingFloatKey_SetArriveTangentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetInterpolationMode, "MovieSceneScriptingFloatKey", "SetInterpolationMode", SDK::Params::MovieSceneScriptingFloatKey_SetInterpolationMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetLeaveTangent, "MovieSceneScriptingFloatKey", "SetLeaveTangent", SDK::Params::MovieSceneScriptingFloatKey_SetLeaveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetLeaveTangentWeight, "MovieSceneScriptingFloatKey", "SetLeaveTangentWeight", SDK::Params::MovieSceneScriptingFloatKey_SetLeaveTangentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetTangentMode, "MovieSceneScriptingFloatKey", "SetTangentMode", SDK::Params::MovieSceneScriptingFloatKey_SetTangentMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetTangentWeightMode, "MovieSceneScriptingFloatKey", "SetTangentWeightMode", SDK::Params::MovieSceneScriptingFloatKey_SetTangentWeightMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetTime, "MovieSceneScriptingFloatKey", "SetTime", SDK::Params::MovieSceneScriptingFloatKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, SetValue, "MovieSceneScriptingFloatKey", "SetValue", SDK::Params::MovieSceneScriptingFloatKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetArriveTangent, "MovieSceneScriptingFloatKey", "GetArriveTangent", SDK::Params::MovieSceneScriptingFloatKey_GetArriveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetArriveTangentWeight, "MovieSceneScriptingFloatKey", "GetArriveTangentWeight", SDK::Params::MovieSceneScriptingFloatKey_GetArriveTangentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetInterpolationMode, "MovieSceneScriptingFloatKey", "GetInterpolationMode", SDK::Params::MovieSceneScriptingFloatKey_GetInterpolationMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetLeaveTangent, "MovieSceneScriptingFloatKey", "GetLeaveTangent", SDK::Params::MovieSceneScriptingFloatKey_GetLeaveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetLeaveTangentWeight, "MovieSceneScriptingFloatKey", "GetLeaveTangentWeight", SDK::Params::MovieSceneScriptingFloatKey_GetLeaveTangentWeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetTangentMode, "MovieSceneScriptingFloatKey", "GetTangentMode", SDK::Params::MovieSceneScriptingFloatKey_GetTangentMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetTangentWeightMode, "MovieSceneScriptingFloatKey", "GetTangentWeightMode", SDK::Params::MovieSceneScriptingFloatKey_GetTangentWeightMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetTime, "MovieSceneScriptingFloatKey", "GetTime", SDK::Params::MovieSceneScriptingFloatKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatKey, GetValue, "MovieSceneScriptingFloatKey", "GetValue", SDK::Params::MovieSceneScriptingFloatKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, AddKey, "MovieSceneScriptingFloatChannel", "AddKey", SDK::Params::MovieSceneScriptingFloatChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, RemoveDefault, "MovieSceneScriptingFloatChannel", "RemoveDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, RemoveKey, "MovieSceneScriptingFloatChannel", "RemoveKey", SDK::Params::MovieSceneScriptingFloatChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, SetDefault, "MovieSceneScriptingFloatChannel", "SetDefault", SDK::Params::MovieSceneScriptingFloatChannel_SetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, SetPostInfinityExtrapolation, "MovieSceneScriptingFloatChannel", "SetPostInfinityExtrapolation", SDK::Params::MovieSceneScriptingFloatChannel_SetPostInfinityExtrapolation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, SetPreInfinityExtrapolation, "MovieSceneScriptingFloatChannel", "SetPreInfinityExtrapolation", SDK::Params::MovieSceneScriptingFloatChannel_SetPreInfinityExtrapolation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, ComputeEffectiveRange, "MovieSceneScriptingFloatChannel", "ComputeEffectiveRange", SDK::Params::MovieSceneScriptingFloatChannel_ComputeEffectiveRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, EvaluateKeys, "MovieSceneScriptingFloatChannel", "EvaluateKeys", SDK::Params::MovieSceneScriptingFloatChannel_EvaluateKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, GetDefault, "MovieSceneScriptingFloatChannel", "GetDefault", SDK::Params::MovieSceneScriptingFloatChannel_GetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, GetKeys, "MovieSceneScriptingFloatChannel", "GetKeys", SDK::Params::MovieSceneScriptingFloatChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, GetKeysByIndex, "MovieSceneScriptingFloatChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingFloatChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, GetNumKeys, "MovieSceneScriptingFloatChannel", "GetNumKeys", SDK::Params::MovieSceneScriptingFloatChannel_GetNumKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, GetPostInfinityExtrapolation, "MovieSceneScriptingFloatChannel", "GetPostInfinityExtrapolation", SDK::Params::MovieSceneScriptingFloatChannel_GetPostInfinityExtrapolation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, GetPreInfinityExtrapolation, "MovieSceneScriptingFloatChannel", "GetPreInfinityExtrapolation", SDK::Params::MovieSceneScriptingFloatChannel_GetPreInfinityExtrapolation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingFloatChannel, HasDefault, "MovieSceneScriptingFloatChannel", "HasDefault", SDK::Params::MovieSceneScriptingFloatChannel_HasDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerKey, SetTime, "MovieSceneScriptingIntegerKey", "SetTime", SDK::Params::MovieSceneScriptingIntegerKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerKey, SetValue, "MovieSceneScriptingIntegerKey", "SetValue", SDK::Params::MovieSceneScriptingIntegerKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerKey, GetTime, "MovieSceneScriptingIntegerKey", "GetTime", SDK::Params::MovieSceneScriptingIntegerKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerKey, GetValue, "MovieSceneScriptingIntegerKey", "GetValue", SDK::Params::MovieSceneScriptingIntegerKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, AddKey, "MovieSceneScriptingIntegerChannel", "AddKey", SDK::Params::MovieSceneScriptingIntegerChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, RemoveDefault, "MovieSceneScriptingIntegerChannel", "RemoveDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, RemoveKey, "MovieSceneScriptingIntegerChannel", "RemoveKey", SDK::Params::MovieSceneScriptingIntegerChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, SetDefault, "MovieSceneScriptingIntegerChannel", "SetDefault", SDK::Params::MovieSceneScriptingIntegerChannel_SetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, EvaluateKeys, "MovieSceneScriptingIntegerChannel", "EvaluateKeys", SDK::Params::MovieSceneScriptingIntegerChannel_EvaluateKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, GetDefault, "MovieSceneScriptingIntegerChannel", "GetDefault", SDK::Params::MovieSceneScriptingIntegerChannel_GetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, GetKeys, "MovieSceneScriptingIntegerChannel", "GetKeys", SDK::Params::MovieSceneScriptingIntegerChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, GetKeysByIndex, "MovieSceneScriptingIntegerChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingIntegerChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, GetNumKeys, "MovieSceneScriptingIntegerChannel", "GetNumKeys", SDK::Params::MovieSceneScriptingIntegerChannel_GetNumKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingIntegerChannel, HasDefault, "MovieSceneScriptingIntegerChannel", "HasDefault", SDK::Params::MovieSceneScriptingIntegerChannel_HasDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathKey, SetTime, "MovieSceneScriptingObjectPathKey", "SetTime", SDK::Params::MovieSceneScriptingObjectPathKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathKey, SetValue, "MovieSceneScriptingObjectPathKey", "SetValue", SDK::Params::MovieSceneScriptingObjectPathKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathKey, GetTime, "MovieSceneScriptingObjectPathKey", "GetTime", SDK::Params::MovieSceneScriptingObjectPathKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathKey, GetValue, "MovieSceneScriptingObjectPathKey", "GetValue", SDK::Params::MovieSceneScriptingObjectPathKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathChannel, AddKey, "MovieSceneScriptingObjectPathChannel", "AddKey", SDK::Params::MovieSceneScriptingObjectPathChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathChannel, RemoveDefault, "MovieSceneScriptingObjectPathChannel", "RemoveDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathChannel, RemoveKey, "MovieSceneScriptingObjectPathChannel", "RemoveKey", SDK::Params::MovieSceneScriptingObjectPathChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathChannel, SetDefault, "MovieSceneScriptingObjectPathChannel", "SetDefault", SDK::Params::MovieSceneScriptingObjectPathChannel_SetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathChannel, GetDefault, "MovieSceneScriptingObjectPathChannel", "GetDefault", SDK::Params::MovieSceneScriptingObjectPathChannel_GetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathChannel, GetKeys, "MovieSceneScriptingObjectPathChannel", "GetKeys", SDK::Params::MovieSceneScriptingObjectPathChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathChannel, GetKeysByIndex, "MovieSceneScriptingObjectPathChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingObjectPathChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingObjectPathChannel, HasDefault, "MovieSceneScriptingObjectPathChannel", "HasDefault", SDK::Params::MovieSceneScriptingObjectPathChannel_HasDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringKey, SetTime, "MovieSceneScriptingStringKey", "SetTime", SDK::Params::MovieSceneScriptingStringKey_SetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringKey, SetValue, "MovieSceneScriptingStringKey", "SetValue", SDK::Params::MovieSceneScriptingStringKey_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringKey, GetTime, "MovieSceneScriptingStringKey", "GetTime", SDK::Params::MovieSceneScriptingStringKey_GetTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringKey, GetValue, "MovieSceneScriptingStringKey", "GetValue", SDK::Params::MovieSceneScriptingStringKey_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringChannel, AddKey, "MovieSceneScriptingStringChannel", "AddKey", SDK::Params::MovieSceneScriptingStringChannel_AddKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringChannel, RemoveDefault, "MovieSceneScriptingStringChannel", "RemoveDefault", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringChannel, RemoveKey, "MovieSceneScriptingStringChannel", "RemoveKey", SDK::Params::MovieSceneScriptingStringChannel_RemoveKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringChannel, SetDefault, "MovieSceneScriptingStringChannel", "SetDefault", SDK::Params::MovieSceneScriptingStringChannel_SetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringChannel, GetDefault, "MovieSceneScriptingStringChannel", "GetDefault", SDK::Params::MovieSceneScriptingStringChannel_GetDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringChannel, GetKeys, "MovieSceneScriptingStringChannel", "GetKeys", SDK::Params::MovieSceneScriptingStringChannel_GetKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringChannel, GetKeysByIndex, "MovieSceneScriptingStringChannel", "GetKeysByIndex", SDK::Params::MovieSceneScriptingStringChannel_GetKeysByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneScriptingStringChannel, HasDefault, "MovieSceneScriptingStringChannel", "HasDefault", SDK::Params::MovieSceneScriptingStringChannel_HasDefault)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, AddTrack, "MovieSceneBindingExtensions", "AddTrack", SDK::Params::MovieSceneBindingExtensions_AddTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, FindTracksByExactType, "MovieSceneBindingExtensions", "FindTracksByExactType", SDK::Params::MovieSceneBindingExtensions_FindTracksByExactType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, FindTracksByType, "MovieSceneBindingExtensions", "FindTracksByType", SDK::Params::MovieSceneBindingExtensions_FindTracksByType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetChildPossessables, "MovieSceneBindingExtensions", "GetChildPossessables", SDK::Params::MovieSceneBindingExtensions_GetChildPossessables)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetDisplayName, "MovieSceneBindingExtensions", "GetDisplayName", SDK::Params::MovieSceneBindingExtensions_GetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetId, "MovieSceneBindingExtensions", "GetId", SDK::Params::MovieSceneBindingExtensions_GetId)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetName, "MovieSceneBindingExtensions", "GetName", SDK::Params::MovieSceneBindingExtensions_GetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetObjectTemplate, "MovieSceneBindingExtensions", "GetObjectTemplate", SDK::Params::MovieSceneBindingExtensions_GetObjectTemplate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetParent, "MovieSceneBindingExtensions", "GetParent", SDK::Params::MovieSceneBindingExtensions_GetParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetPossessedObjectClass, "MovieSceneBindingExtensions", "GetPossessedObjectClass", SDK::Params::MovieSceneBindingExtensions_GetPossessedObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetSortingOrder, "MovieSceneBindingExtensions", "GetSortingOrder", SDK::Params::MovieSceneBindingExtensions_GetSortingOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, GetTracks, "MovieSceneBindingExtensions", "GetTracks", SDK::Params::MovieSceneBindingExtensions_GetTracks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, IsValid, "MovieSceneBindingExtensions", "IsValid", SDK::Params::MovieSceneBindingExtensions_IsValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, MoveBindingContents, "MovieSceneBindingExtensions", "MoveBindingContents", SDK::Params::MovieSceneBindingExtensions_MoveBindingContents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, Remove, "MovieSceneBindingExtensions", "Remove", SDK::Params::MovieSceneBindingExtensions_Remove)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, RemoveTrack, "MovieSceneBindingExtensions", "RemoveTrack", SDK::Params::MovieSceneBindingExtensions_RemoveTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, SetDisplayName, "MovieSceneBindingExtensions", "SetDisplayName", SDK::Params::MovieSceneBindingExtensions_SetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, SetName, "MovieSceneBindingExtensions", "SetName", SDK::Params::MovieSceneBindingExtensions_SetName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, SetParent, "MovieSceneBindingExtensions", "SetParent", SDK::Params::MovieSceneBindingExtensions_SetParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, SetSortingOrder, "MovieSceneBindingExtensions", "SetSortingOrder", SDK::Params::MovieSceneBindingExtensions_SetSortingOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneBindingExtensions, SetSpawnableBindingID, "MovieSceneBindingExtensions", "SetSpawnableBindingID", SDK::Params::MovieSceneBindingExtensions_SetSpawnableBindingID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneEventTrackExtensions, AddEventRepeaterSection, "MovieSceneEventTrackExtensions", "AddEventRepeaterSection", SDK::Params::MovieSceneEventTrackExtensions_AddEventRepeaterSection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneEventTrackExtensions, AddEventTriggerSection, "MovieSceneEventTrackExtensions", "AddEventTriggerSection", SDK::Params::MovieSceneEventTrackExtensions_AddEventTriggerSection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneEventTrackExtensions, GetBoundObjectPropertyClass, "MovieSceneEventTrackExtensions", "GetBoundObjectPropertyClass", SDK::Params::MovieSceneEventTrackExtensions_GetBoundObjectPropertyClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, AddChildFolder, "MovieSceneFolderExtensions", "AddChildFolder", SDK::Params::MovieSceneFolderExtensions_AddChildFolder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, AddChildMasterTrack, "MovieSceneFolderExtensions", "AddChildMasterTrack", SDK::Params::MovieSceneFolderExtensions_AddChildMasterTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, AddChildObjectBinding, "MovieSceneFolderExtensions", "AddChildObjectBinding", SDK::Params::MovieSceneFolderExtensions_AddChildObjectBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, AddChildTrack, "MovieSceneFolderExtensions", "AddChildTrack", SDK::Params::MovieSceneFolderExtensions_AddChildTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, GetChildFolders, "MovieSceneFolderExtensions", "GetChildFolders", SDK::Params::MovieSceneFolderExtensions_GetChildFolders)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, GetChildMasterTracks, "MovieSceneFolderExtensions", "GetChildMasterTracks", SDK::Params::MovieSceneFolderExtensions_GetChildMasterTracks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, GetChildObjectBindings, "MovieSceneFolderExtensions", "GetChildObjectBindings", SDK::Params::MovieSceneFolderExtensions_GetChildObjectBindings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, GetChildTracks, "MovieSceneFolderExtensions", "GetChildTracks", SDK::Params::MovieSceneFolderExtensions_GetChildTracks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, GetFolderColor, "MovieSceneFolderExtensions", "GetFolderColor", SDK::Params::MovieSceneFolderExtensions_GetFolderColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, GetFolderName, "MovieSceneFolderExtensions", "GetFolderName", SDK::Params::MovieSceneFolderExtensions_GetFolderName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, RemoveChildFolder, "MovieSceneFolderExtensions", "RemoveChildFolder", SDK::Params::MovieSceneFolderExtensions_RemoveChildFolder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, RemoveChildMasterTrack, "MovieSceneFolderExtensions", "RemoveChildMasterTrack", SDK::Params::MovieSceneFolderExtensions_RemoveChildMasterTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, RemoveChildObjectBinding, "MovieSceneFolderExtensions", "RemoveChildObjectBinding", SDK::Params::MovieSceneFolderExtensions_RemoveChildObjectBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, RemoveChildTrack, "MovieSceneFolderExtensions", "RemoveChildTrack", SDK::Params::MovieSceneFolderExtensions_RemoveChildTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, SetFolderColor, "MovieSceneFolderExtensions", "SetFolderColor", SDK::Params::MovieSceneFolderExtensions_SetFolderColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFolderExtensions, SetFolderName, "MovieSceneFolderExtensions", "SetFolderName", SDK::Params::MovieSceneFolderExtensions_SetFolderName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMaterialTrackExtensions, GetMaterialIndex, "MovieSceneMaterialTrackExtensions", "GetMaterialIndex", SDK::Params::MovieSceneMaterialTrackExtensions_GetMaterialIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMaterialTrackExtensions, GetMaterialInfo, "MovieSceneMaterialTrackExtensions", "GetMaterialInfo", SDK::Params::MovieSceneMaterialTrackExtensions_GetMaterialInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMaterialTrackExtensions, SetMaterialIndex, "MovieSceneMaterialTrackExtensions", "SetMaterialIndex", SDK::Params::MovieSceneMaterialTrackExtensions_SetMaterialIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneMaterialTrackExtensions, SetMaterialInfo, "MovieSceneMaterialTrackExtensions", "SetMaterialInfo", SDK::Params::MovieSceneMaterialTrackExtensions_SetMaterialInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePrimitiveMaterialTrackExtensions, GetMaterialIndex, "MovieScenePrimitiveMaterialTrackExtensions", "GetMaterialIndex", SDK::Params::MovieScenePrimitiveMaterialTrackExtensions_GetMaterialIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePrimitiveMaterialTrackExtensions, GetMaterialInfo, "MovieScenePrimitiveMaterialTrackExtensions", "GetMaterialInfo", SDK::Params::MovieScenePrimitiveMaterialTrackExtensions_GetMaterialInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePrimitiveMaterialTrackExtensions, SetMaterialIndex, "MovieScenePrimitiveMaterialTrackExtensions", "SetMaterialIndex", SDK::Params::MovieScenePrimitiveMaterialTrackExtensions_SetMaterialIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePrimitiveMaterialTrackExtensions, SetMaterialInfo, "MovieScenePrimitiveMaterialTrackExtensions", "SetMaterialInfo", SDK::Params::MovieScenePrimitiveMaterialTrackExtensions_SetMaterialInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePropertyTrackExtensions, GetByteTrackEnum, "MovieScenePropertyTrackExtensions", "GetByteTrackEnum", SDK::Params::MovieScenePropertyTrackExtensions_GetByteTrackEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePropertyTrackExtensions, GetObjectPropertyClass, "MovieScenePropertyTrackExtensions", "GetObjectPropertyClass", SDK::Params::MovieScenePropertyTrackExtensions_GetObjectPropertyClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePropertyTrackExtensions, GetPropertyName, "MovieScenePropertyTrackExtensions", "GetPropertyName", SDK::Params::MovieScenePropertyTrackExtensions_GetPropertyName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePropertyTrackExtensions, GetPropertyPath, "MovieScenePropertyTrackExtensions", "GetPropertyPath", SDK::Params::MovieScenePropertyTrackExtensions_GetPropertyPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePropertyTrackExtensions, GetUniqueTrackName, "MovieScenePropertyTrackExtensions", "GetUniqueTrackName", SDK::Params::MovieScenePropertyTrackExtensions_GetUniqueTrackName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePropertyTrackExtensions, SetByteTrackEnum, "MovieScenePropertyTrackExtensions", "SetByteTrackEnum", SDK::Params::MovieScenePropertyTrackExtensions_SetByteTrackEnum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePropertyTrackExtensions, SetObjectPropertyClass, "MovieScenePropertyTrackExtensions", "SetObjectPropertyClass", SDK::Params::MovieScenePropertyTrackExtensions_SetObjectPropertyClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieScenePropertyTrackExtensions, SetPropertyNameAndPath, "MovieScenePropertyTrackExtensions", "SetPropertyNameAndPath", SDK::Params::MovieScenePropertyTrackExtensions_SetPropertyNameAndPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetAllChannels, "MovieSceneSectionExtensions", "GetAllChannels", SDK::Params::MovieSceneSectionExtensions_GetAllChannels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetAutoSizeEndFrame, "MovieSceneSectionExtensions", "GetAutoSizeEndFrame", SDK::Params::MovieSceneSectionExtensions_GetAutoSizeEndFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetAutoSizeEndFrameSeconds, "MovieSceneSectionExtensions", "GetAutoSizeEndFrameSeconds", SDK::Params::MovieSceneSectionExtensions_GetAutoSizeEndFrameSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetAutoSizeHasEndFrame, "MovieSceneSectionExtensions", "GetAutoSizeHasEndFrame", SDK::Params::MovieSceneSectionExtensions_GetAutoSizeHasEndFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetAutoSizeHasStartFrame, "MovieSceneSectionExtensions", "GetAutoSizeHasStartFrame", SDK::Params::MovieSceneSectionExtensions_GetAutoSizeHasStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetAutoSizeStartFrame, "MovieSceneSectionExtensions", "GetAutoSizeStartFrame", SDK::Params::MovieSceneSectionExtensions_GetAutoSizeStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetAutoSizeStartFrameSeconds, "MovieSceneSectionExtensions", "GetAutoSizeStartFrameSeconds", SDK::Params::MovieSceneSectionExtensions_GetAutoSizeStartFrameSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetChannel, "MovieSceneSectionExtensions", "GetChannel", SDK::Params::MovieSceneSectionExtensions_GetChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetChannelsByType, "MovieSceneSectionExtensions", "GetChannelsByType", SDK::Params::MovieSceneSectionExtensions_GetChannelsByType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetEndFrame, "MovieSceneSectionExtensions", "GetEndFrame", SDK::Params::MovieSceneSectionExtensions_GetEndFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetEndFrameSeconds, "MovieSceneSectionExtensions", "GetEndFrameSeconds", SDK::Params::MovieSceneSectionExtensions_GetEndFrameSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetParentSequenceFrame, "MovieSceneSectionExtensions", "GetParentSequenceFrame", SDK::Params::MovieSceneSectionExtensions_GetParentSequenceFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetStartFrame, "MovieSceneSectionExtensions", "GetStartFrame", SDK::Params::MovieSceneSectionExtensions_GetStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, GetStartFrameSeconds, "MovieSceneSectionExtensions", "GetStartFrameSeconds", SDK::Params::MovieSceneSectionExtensions_GetStartFrameSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, HasEndFrame, "MovieSceneSectionExtensions", "HasEndFrame", SDK::Params::MovieSceneSectionExtensions_HasEndFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, HasStartFrame, "MovieSceneSectionExtensions", "HasStartFrame", SDK::Params::MovieSceneSectionExtensions_HasStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, SetEndFrame, "MovieSceneSectionExtensions", "SetEndFrame", SDK::Params::MovieSceneSectionExtensions_SetEndFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, SetEndFrameBounded, "MovieSceneSectionExtensions", "SetEndFrameBounded", SDK::Params::MovieSceneSectionExtensions_SetEndFrameBounded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, SetEndFrameSeconds, "MovieSceneSectionExtensions", "SetEndFrameSeconds", SDK::Params::MovieSceneSectionExtensions_SetEndFrameSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, SetRange, "MovieSceneSectionExtensions", "SetRange", SDK::Params::MovieSceneSectionExtensions_SetRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, SetRangeSeconds, "MovieSceneSectionExtensions", "SetRangeSeconds", SDK::Params::MovieSceneSectionExtensions_SetRangeSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, SetStartFrame, "MovieSceneSectionExtensions", "SetStartFrame", SDK::Params::MovieSceneSectionExtensions_SetStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, SetStartFrameBounded, "MovieSceneSectionExtensions", "SetStartFrameBounded", SDK::Params::MovieSceneSectionExtensions_SetStartFrameBounded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSectionExtensions, SetStartFrameSeconds, "MovieSceneSectionExtensions", "SetStartFrameSeconds", SDK::Params::MovieSceneSectionExtensions_SetStartFrameSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AddMarkedFrame, "MovieSceneSequenceExtensions", "AddMarkedFrame", SDK::Params::MovieSceneSequenceExtensions_AddMarkedFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AddMarkedFrameToSequence, "MovieSceneSequenceExtensions", "AddMarkedFrameToSequence", SDK::Params::MovieSceneSequenceExtensions_AddMarkedFrameToSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AddMasterTrack, "MovieSceneSequenceExtensions", "AddMasterTrack", SDK::Params::MovieSceneSequenceExtensions_AddMasterTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AddPossessable, "MovieSceneSequenceExtensions", "AddPossessable", SDK::Params::MovieSceneSequenceExtensions_AddPossessable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AddRootFolderToSequence, "MovieSceneSequenceExtensions", "AddRootFolderToSequence", SDK::Params::MovieSceneSequenceExtensions_AddRootFolderToSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AddSpawnableFromClass, "MovieSceneSequenceExtensions", "AddSpawnableFromClass", SDK::Params::MovieSceneSequenceExtensions_AddSpawnableFromClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AddSpawnableFromInstance, "MovieSceneSequenceExtensions", "AddSpawnableFromInstance", SDK::Params::MovieSceneSequenceExtensions_AddSpawnableFromInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AddTrack, "MovieSceneSequenceExtensions", "AddTrack", SDK::Params::MovieSceneSequenceExtensions_AddTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, AreMarkedFramesLocked, "MovieSceneSequenceExtensions", "AreMarkedFramesLocked", SDK::Params::MovieSceneSequenceExtensions_AreMarkedFramesLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, DeleteMarkedFrame, "MovieSceneSequenceExtensions", "DeleteMarkedFrame", SDK::Params::MovieSceneSequenceExtensions_DeleteMarkedFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, DeleteMarkedFrames, "MovieSceneSequenceExtensions", "DeleteMarkedFrames", SDK::Params::MovieSceneSequenceExtensions_DeleteMarkedFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindBindingById, "MovieSceneSequenceExtensions", "FindBindingById", SDK::Params::MovieSceneSequenceExtensions_FindBindingById)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindBindingByName, "MovieSceneSequenceExtensions", "FindBindingByName", SDK::Params::MovieSceneSequenceExtensions_FindBindingByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindMarkedFrameByFrameNumber, "MovieSceneSequenceExtensions", "FindMarkedFrameByFrameNumber", SDK::Params::MovieSceneSequenceExtensions_FindMarkedFrameByFrameNumber)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindMarkedFrameByFrameNumberInSequence, "MovieSceneSequenceExtensions", "FindMarkedFrameByFrameNumberInSequence", SDK::Params::MovieSceneSequenceExtensions_FindMarkedFrameByFrameNumberInSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindMarkedFrameByLabel, "MovieSceneSequenceExtensions", "FindMarkedFrameByLabel", SDK::Params::MovieSceneSequenceExtensions_FindMarkedFrameByLabel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindMasterTracksByExactType, "MovieSceneSequenceExtensions", "FindMasterTracksByExactType", SDK::Params::MovieSceneSequenceExtensions_FindMasterTracksByExactType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindMasterTracksByType, "MovieSceneSequenceExtensions", "FindMasterTracksByType", SDK::Params::MovieSceneSequenceExtensions_FindMasterTracksByType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindNextMarkedFrame, "MovieSceneSequenceExtensions", "FindNextMarkedFrame", SDK::Params::MovieSceneSequenceExtensions_FindNextMarkedFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindNextMarkedFrameInSequence, "MovieSceneSequenceExtensions", "FindNextMarkedFrameInSequence", SDK::Params::MovieSceneSequenceExtensions_FindNextMarkedFrameInSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindTracksByExactType, "MovieSceneSequenceExtensions", "FindTracksByExactType", SDK::Params::MovieSceneSequenceExtensions_FindTracksByExactType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, FindTracksByType, "MovieSceneSequenceExtensions", "FindTracksByType", SDK::Params::MovieSceneSequenceExtensions_FindTracksByType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetBindingID, "MovieSceneSequenceExtensions", "GetBindingID", SDK::Params::MovieSceneSequenceExtensions_GetBindingID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetBindings, "MovieSceneSequenceExtensions", "GetBindings", SDK::Params::MovieSceneSequenceExtensions_GetBindings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetClockSource, "MovieSceneSequenceExtensions", "GetClockSource", SDK::Params::MovieSceneSequenceExtensions_GetClockSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetDisplayRate, "MovieSceneSequenceExtensions", "GetDisplayRate", SDK::Params::MovieSceneSequenceExtensions_GetDisplayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetEvaluationType, "MovieSceneSequenceExtensions", "GetEvaluationType", SDK::Params::MovieSceneSequenceExtensions_GetEvaluationType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetMarkedFrames, "MovieSceneSequenceExtensions", "GetMarkedFrames", SDK::Params::MovieSceneSequenceExtensions_GetMarkedFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetMarkedFramesFromSequence, "MovieSceneSequenceExtensions", "GetMarkedFramesFromSequence", SDK::Params::MovieSceneSequenceExtensions_GetMarkedFramesFromSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetMasterTracks, "MovieSceneSequenceExtensions", "GetMasterTracks", SDK::Params::MovieSceneSequenceExtensions_GetMasterTracks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetMovieScene, "MovieSceneSequenceExtensions", "GetMovieScene", SDK::Params::MovieSceneSequenceExtensions_GetMovieScene)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetPlaybackEnd, "MovieSceneSequenceExtensions", "GetPlaybackEnd", SDK::Params::MovieSceneSequenceExtensions_GetPlaybackEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetPlaybackEndSeconds, "MovieSceneSequenceExtensions", "GetPlaybackEndSeconds", SDK::Params::MovieSceneSequenceExtensions_GetPlaybackEndSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetPlaybackRange, "MovieSceneSequenceExtensions", "GetPlaybackRange", SDK::Params::MovieSceneSequenceExtensions_GetPlaybackRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetPlaybackStart, "MovieSceneSequenceExtensions", "GetPlaybackStart", SDK::Params::MovieSceneSequenceExtensions_GetPlaybackStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetPlaybackStartSeconds, "MovieSceneSequenceExtensions", "GetPlaybackStartSeconds", SDK::Params::MovieSceneSequenceExtensions_GetPlaybackStartSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetPortableBindingID, "MovieSceneSequenceExtensions", "GetPortableBindingID", SDK::Params::MovieSceneSequenceExtensions_GetPortableBindingID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetPossessables, "MovieSceneSequenceExtensions", "GetPossessables", SDK::Params::MovieSceneSequenceExtensions_GetPossessables)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetRootFoldersInSequence, "MovieSceneSequenceExtensions", "GetRootFoldersInSequence", SDK::Params::MovieSceneSequenceExtensions_GetRootFoldersInSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetSpawnables, "MovieSceneSequenceExtensions", "GetSpawnables", SDK::Params::MovieSceneSequenceExtensions_GetSpawnables)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetTickResolution, "MovieSceneSequenceExtensions", "GetTickResolution", SDK::Params::MovieSceneSequenceExtensions_GetTickResolution)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetTracks, "MovieSceneSequenceExtensions", "GetTracks", SDK::Params::MovieSceneSequenceExtensions_GetTracks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetViewRangeEnd, "MovieSceneSequenceExtensions", "GetViewRangeEnd", SDK::Params::MovieSceneSequenceExtensions_GetViewRangeEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetViewRangeStart, "MovieSceneSequenceExtensions", "GetViewRangeStart", SDK::Params::MovieSceneSequenceExtensions_GetViewRangeStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetWorkRangeEnd, "MovieSceneSequenceExtensions", "GetWorkRangeEnd", SDK::Params::MovieSceneSequenceExtensions_GetWorkRangeEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, GetWorkRangeStart, "MovieSceneSequenceExtensions", "GetWorkRangeStart", SDK::Params::MovieSceneSequenceExtensions_GetWorkRangeStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, IsPlaybackRangeLocked, "MovieSceneSequenceExtensions", "IsPlaybackRangeLocked", SDK::Params::MovieSceneSequenceExtensions_IsPlaybackRangeLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, IsReadOnly, "MovieSceneSequenceExtensions", "IsReadOnly", SDK::Params::MovieSceneSequenceExtensions_IsReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, LocateBoundObjects, "MovieSceneSequenceExtensions", "LocateBoundObjects", SDK::Params::MovieSceneSequenceExtensions_LocateBoundObjects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, MakeRange, "MovieSceneSequenceExtensions", "MakeRange", SDK::Params::MovieSceneSequenceExtensions_MakeRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, MakeRangeSeconds, "MovieSceneSequenceExtensions", "MakeRangeSeconds", SDK::Params::MovieSceneSequenceExtensions_MakeRangeSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, RemoveMasterTrack, "MovieSceneSequenceExtensions", "RemoveMasterTrack", SDK::Params::MovieSceneSequenceExtensions_RemoveMasterTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, RemoveRootFolderFromSequence, "MovieSceneSequenceExtensions", "RemoveRootFolderFromSequence", SDK::Params::MovieSceneSequenceExtensions_RemoveRootFolderFromSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, RemoveTrack, "MovieSceneSequenceExtensions", "RemoveTrack", SDK::Params::MovieSceneSequenceExtensions_RemoveTrack)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, ResolveBindingID, "MovieSceneSequenceExtensions", "ResolveBindingID", SDK::Params::MovieSceneSequenceExtensions_ResolveBindingID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetClockSource, "MovieSceneSequenceExtensions", "SetClockSource", SDK::Params::MovieSceneSequenceExtensions_SetClockSource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetDisplayRate, "MovieSceneSequenceExtensions", "SetDisplayRate", SDK::Params::MovieSceneSequenceExtensions_SetDisplayRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetEvaluationType, "MovieSceneSequenceExtensions", "SetEvaluationType", SDK::Params::MovieSceneSequenceExtensions_SetEvaluationType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetMarkedFrame, "MovieSceneSequenceExtensions", "SetMarkedFrame", SDK::Params::MovieSceneSequenceExtensions_SetMarkedFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetMarkedFrameInSequence, "MovieSceneSequenceExtensions", "SetMarkedFrameInSequence", SDK::Params::MovieSceneSequenceExtensions_SetMarkedFrameInSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetMarkedFramesLocked, "MovieSceneSequenceExtensions", "SetMarkedFramesLocked", SDK::Params::MovieSceneSequenceExtensions_SetMarkedFramesLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetPlaybackEnd, "MovieSceneSequenceExtensions", "SetPlaybackEnd", SDK::Params::MovieSceneSequenceExtensions_SetPlaybackEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetPlaybackEndSeconds, "MovieSceneSequenceExtensions", "SetPlaybackEndSeconds", SDK::Params::MovieSceneSequenceExtensions_SetPlaybackEndSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetPlaybackRangeLocked, "MovieSceneSequenceExtensions", "SetPlaybackRangeLocked", SDK::Params::MovieSceneSequenceExtensions_SetPlaybackRangeLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetPlaybackStart, "MovieSceneSequenceExtensions", "SetPlaybackStart", SDK::Params::MovieSceneSequenceExtensions_SetPlaybackStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetPlaybackStartSeconds, "MovieSceneSequenceExtensions", "SetPlaybackStartSeconds", SDK::Params::MovieSceneSequenceExtensions_SetPlaybackStartSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetReadOnly, "MovieSceneSequenceExtensions", "SetReadOnly", SDK::Params::MovieSceneSequenceExtensions_SetReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetTickResolution, "MovieSceneSequenceExtensions", "SetTickResolution", SDK::Params::MovieSceneSequenceExtensions_SetTickResolution)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetTickResolutionDirectly, "MovieSceneSequenceExtensions", "SetTickResolutionDirectly", SDK::Params::MovieSceneSequenceExtensions_SetTickResolutionDirectly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetViewRangeEnd, "MovieSceneSequenceExtensions", "SetViewRangeEnd", SDK::Params::MovieSceneSequenceExtensions_SetViewRangeEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetViewRangeStart, "MovieSceneSequenceExtensions", "SetViewRangeStart", SDK::Params::MovieSceneSequenceExtensions_SetViewRangeStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetWorkRangeEnd, "MovieSceneSequenceExtensions", "SetWorkRangeEnd", SDK::Params::MovieSceneSequenceExtensions_SetWorkRangeEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SetWorkRangeStart, "MovieSceneSequenceExtensions", "SetWorkRangeStart", SDK::Params::MovieSceneSequenceExtensions_SetWorkRangeStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneSequenceExtensions, SortMarkedFrames, "MovieSceneSequenceExtensions", "SortMarkedFrames", SDK::Params::MovieSceneSequenceExtensions_SortMarkedFrames)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, AddSection, "MovieSceneTrackExtensions", "AddSection", SDK::Params::MovieSceneTrackExtensions_AddSection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, GetColorTint, "MovieSceneTrackExtensions", "GetColorTint", SDK::Params::MovieSceneTrackExtensions_GetColorTint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, GetDisplayName, "MovieSceneTrackExtensions", "GetDisplayName", SDK::Params::MovieSceneTrackExtensions_GetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, GetSections, "MovieSceneTrackExtensions", "GetSections", SDK::Params::MovieSceneTrackExtensions_GetSections)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, GetSectionToKey, "MovieSceneTrackExtensions", "GetSectionToKey", SDK::Params::MovieSceneTrackExtensions_GetSectionToKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, GetSortingOrder, "MovieSceneTrackExtensions", "GetSortingOrder", SDK::Params::MovieSceneTrackExtensions_GetSortingOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, GetTrackRowDisplayName, "MovieSceneTrackExtensions", "GetTrackRowDisplayName", SDK::Params::MovieSceneTrackExtensions_GetTrackRowDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, RemoveSection, "MovieSceneTrackExtensions", "RemoveSection", SDK::Params::MovieSceneTrackExtensions_RemoveSection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, SetColorTint, "MovieSceneTrackExtensions", "SetColorTint", SDK::Params::MovieSceneTrackExtensions_SetColorTint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, SetDisplayName, "MovieSceneTrackExtensions", "SetDisplayName", SDK::Params::MovieSceneTrackExtensions_SetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, SetSectionToKey, "MovieSceneTrackExtensions", "SetSectionToKey", SDK::Params::MovieSceneTrackExtensions_SetSectionToKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, SetSortingOrder, "MovieSceneTrackExtensions", "SetSortingOrder", SDK::Params::MovieSceneTrackExtensions_SetSortingOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneTrackExtensions, SetTrackRowDisplayName, "MovieSceneTrackExtensions", "SetTrackRowDisplayName", SDK::Params::MovieSceneTrackExtensions_SetTrackRowDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFloatVectorTrackExtensions, GetNumChannelsUsed, "MovieSceneFloatVectorTrackExtensions", "GetNumChannelsUsed", SDK::Params::MovieSceneFloatVectorTrackExtensions_GetNumChannelsUsed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneFloatVectorTrackExtensions, SetNumChannelsUsed, "MovieSceneFloatVectorTrackExtensions", "SetNumChannelsUsed", SDK::Params::MovieSceneFloatVectorTrackExtensions_SetNumChannelsUsed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDoubleVectorTrackExtensions, GetNumChannelsUsed, "MovieSceneDoubleVectorTrackExtensions", "GetNumChannelsUsed", SDK::Params::MovieSceneDoubleVectorTrackExtensions_GetNumChannelsUsed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMovieSceneDoubleVectorTrackExtensions, SetNumChannelsUsed, "MovieSceneDoubleVectorTrackExtensions", "SetNumChannelsUsed", SDK::Params::MovieSceneDoubleVectorTrackExtensions_SetNumChannelsUsed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, GetEndFrame, "SequencerScriptingRangeExtensions", "GetEndFrame", SDK::Params::SequencerScriptingRangeExtensions_GetEndFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, GetEndSeconds, "SequencerScriptingRangeExtensions", "GetEndSeconds", SDK::Params::SequencerScriptingRangeExtensions_GetEndSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, GetStartFrame, "SequencerScriptingRangeExtensions", "GetStartFrame", SDK::Params::SequencerScriptingRangeExtensions_GetStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, GetStartSeconds, "SequencerScriptingRangeExtensions", "GetStartSeconds", SDK::Params::SequencerScriptingRangeExtensions_GetStartSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, HasEnd, "SequencerScriptingRangeExtensions", "HasEnd", SDK::Params::SequencerScriptingRangeExtensions_HasEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, HasStart, "SequencerScriptingRangeExtensions", "HasStart", SDK::Params::SequencerScriptingRangeExtensions_HasStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, RemoveEnd, "SequencerScriptingRangeExtensions", "RemoveEnd", SDK::Params::SequencerScriptingRangeExtensions_RemoveEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, RemoveStart, "SequencerScriptingRangeExtensions", "RemoveStart", SDK::Params::SequencerScriptingRangeExtensions_RemoveStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, SetEndFrame, "SequencerScriptingRangeExtensions", "SetEndFrame", SDK::Params::SequencerScriptingRangeExtensions_SetEndFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, SetEndSeconds, "SequencerScriptingRangeExtensions", "SetEndSeconds", SDK::Params::SequencerScriptingRangeExtensions_SetEndSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, SetStartFrame, "SequencerScriptingRangeExtensions", "SetStartFrame", SDK::Params::SequencerScriptingRangeExtensions_SetStartFrame)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequencerScriptingRangeExtensions, SetStartSeconds, "SequencerScriptingRangeExtensions", "SetStartSeconds", SDK::Params::SequencerScriptingRangeExtensions_SetStartSeconds)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Shield_BossGrip_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Shield_BossGrip_classes.hpp"
+#include "../SDK/Shield_BossGrip_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_BossGrip_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "Shield_BossGrip_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::Shield_BossGrip_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_BossGrip_C, ExecuteUbergraph_Shield_BossGrip, "Shield_BossGrip_C", "ExecuteUbergraph_Shield_BossGrip", SDK::Params::Shield_BossGrip_C_ExecuteUbergraph_Shield_BossGrip)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_BossGrip_C, ReceiveBeginPlay, "Shield_BossGrip_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_BossGrip_C, UserConstructionScript, "Shield_BossGrip_C", "UserConstructionScript", void)
+// clang-format on
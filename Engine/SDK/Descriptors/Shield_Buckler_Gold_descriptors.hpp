@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Shield_Buckler_Gold_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Shield_Buckler_Gold_classes.hpp"
+#include "../SDK/Shield_Buckler_Gold_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Buckler_Gold_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "Shield_Buckler_Gold_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::Shield_Buckler_Gold_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Buckler_Gold_C, ExecuteUbergraph_Shield_Buckler_Gold, "Shield_Buckler_Gold_C", "ExecuteUbergraph_Shield_Buckler_Gold", SDK::Params::Shield_Buckler_Gold_C_ExecuteUbergraph_Shield_Buckler_Gold)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Buckler_Gold_C, ReceiveBeginPlay, "Shield_Buckler_Gold_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Buckler_Gold_C, UserConstructionScript, "Shield_Buckler_Gold_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Shield_Buckler_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Shield_Buckler_classes.hpp"
+#include "../SDK/Shield_Buckler_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Buckler_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "Shield_Buckler_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::Shield_Buckler_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Buckler_C, ExecuteUbergraph_Shield_Buckler, "Shield_Buckler_C", "ExecuteUbergraph_Shield_Buckler", SDK::Params::Shield_Buckler_C_ExecuteUbergraph_Shield_Buckler)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Buckler_C, ReceiveBeginPlay, "Shield_Buckler_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Buckler_C, UserConstructionScript, "Shield_Buckler_C", "UserConstructionScript", void)
+// clang-format on
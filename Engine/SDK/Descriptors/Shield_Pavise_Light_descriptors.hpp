@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Shield_Pavise_Light_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Shield_Pavise_Light_classes.hpp"
+#include "../SDK/Shield_Pavise_Light_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Pavise_Light_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "Shield_Pavise_Light_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::Shield_Pavise_Light_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Pavise_Light_C, ExecuteUbergraph_Shield_Pavise_Light, "Shield_Pavise_Light_C", "ExecuteUbergraph_Shield_Pavise_Light", SDK::Params::Shield_Pavise_Light_C_ExecuteUbergraph_Shield_Pavise_Light)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Pavise_Light_C, ReceiveBeginPlay, "Shield_Pavise_Light_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Pavise_Light_C, UserConstructionScript, "Shield_Pavise_Light_C", "UserConstructionScript", void)
+// clang-format on
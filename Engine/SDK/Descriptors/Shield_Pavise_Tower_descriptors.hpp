@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Shield_Pavise_Tower_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Shield_Pavise_Tower_classes.hpp"
+#include "../SDK/Shield_Pavise_Tower_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Pavise_Tower_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "Shield_Pavise_Tower_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::Shield_Pavise_Tower_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Pavise_Tower_C, ExecuteUbergraph_Shield_Pavise_Tower, "Shield_Pavise_Tower_C", "ExecuteUbergraph_Shield_Pavise_Tower", SDK::Params::Shield_Pavise_Tower_C_ExecuteUbergraph_Shield_Pavise_Tower)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Pavise_Tower_C, ReceiveBeginPlay, "Shield_Pavise_Tower_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Pavise_Tower_C, UserConstructionScript, "Shield_Pavise_Tower_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Shield_Tagre_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Shield_Tagre_classes.hpp"
+#include "../SDK/Shield_Tagre_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Tagre_C, BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "Shield_Tagre_C", "BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::Shield_Tagre_C_BndEvt__Buckler_Buckler_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Tagre_C, ExecuteUbergraph_Shield_Tagre, "Shield_Tagre_C", "ExecuteUbergraph_Shield_Tagre", SDK::Params::Shield_Tagre_C_ExecuteUbergraph_Shield_Tagre)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Tagre_C, ReceiveBeginPlay, "Shield_Tagre_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AShield_Tagre_C, UserConstructionScript, "Shield_Tagre_C", "UserConstructionScript", void)
+// clang-format on
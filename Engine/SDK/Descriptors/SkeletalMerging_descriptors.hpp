@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from SkeletalMerging_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/SkeletalMerging_classes.hpp"
+#include "../SDK/SkeletalMerging_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(USkeletalMergingLibrary, MergeMeshes, "SkeletalMergingLibrary", "MergeMeshes", SDK::Params::SkeletalMergingLibrary_MergeMeshes)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USkeletalMergingLibrary, MergeSkeletons, "SkeletalMergingLibrary", "MergeSkeletons", SDK::Params::SkeletalMergingLibrary_MergeSkeletons)
+// clang-format on
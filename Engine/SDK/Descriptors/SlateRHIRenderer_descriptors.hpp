@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from SlateRHIRenderer_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/SlateRHIRenderer_classes.hpp"
+#include "../SDK/SlateRHIRenderer_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateFXSubsystem, GetSlatePostProcessor, "SlateFXSubsystem", "GetSlatePostProcessor", SDK::Params::SlateFXSubsystem_GetSlatePostProcessor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateRHIRendererSettings, GetMutableSlatePostSetting, "SlateRHIRendererSettings", "GetMutableSlatePostSetting", SDK::Params::SlateRHIRendererSettings_GetMutableSlatePostSetting)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateRHIRendererSettings, GetSlatePostSetting, "SlateRHIRendererSettings", "GetSlatePostSetting", SDK::Params::SlateRHIRendererSettings_GetSlatePostSetting)
+// clang-format on
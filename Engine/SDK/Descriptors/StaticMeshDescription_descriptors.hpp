@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from StaticMeshDescription_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/StaticMeshDescription_classes.hpp"
+#include "../SDK/StaticMeshDescription_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStaticMeshDescription, CreateCube, "StaticMeshDescription", "CreateCube", SDK::Params::StaticMeshDescription_CreateCube)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStaticMeshDescription, SetPolygonGroupMaterialSlotName, "StaticMeshDescription", "SetPolygonGroupMaterialSlotName", SDK::Params::StaticMeshDescription_SetPolygonGroupMaterialSlotName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStaticMeshDescription, SetVertexInstanceUV, "StaticMeshDescription", "SetVertexInstanceUV", SDK::Params::StaticMeshDescription_SetVertexInstanceUV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStaticMeshDescription, GetVertexInstanceUV, "StaticMeshDescription", "GetVertexInstanceUV", SDK::Params::StaticMeshDescription_GetVertexInstanceUV)
+// clang-format on
@@ -0,0 +1,20 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from StructUtilsEngine_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/StructUtilsEngine_classes.hpp"
+#include "../SDK/StructUtilsEngine_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStructUtilsFunctionLibrary, EqualEqual_InstancedStruct, "StructUtilsFunctionLibrary", "EqualEqual_InstancedStruct", SDK::Params::StructUtilsFunctionLibrary_EqualEqual_InstancedStruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStructUtilsFunctionLibrary, GetInstancedStructValue, "StructUtilsFunctionLibrary", "GetInstancedStructValue", SDK::Params::StructUtilsFunctionLibrary_GetInstancedStructValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStructUtilsFunctionLibrary, IsInstancedStructValid, "StructUtilsFunctionLibrary", "IsInstancedStructValid", SDK::Params::StructUtilsFunctionLibrary_IsInstancedStructValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStructUtilsFunctionLibrary, IsValid_InstancedStruct, "StructUtilsFunctionLibrary", "IsValid_InstancedStruct", SDK::Params::StructUtilsFunctionLibrary_IsValid_InstancedStruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStructUtilsFunctionLibrary, MakeInstancedStruct, "StructUtilsFunctionLibrary", "MakeInstancedStruct", SDK::Params::StructUtilsFunctionLibrary_MakeInstancedStruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStructUtilsFunctionLibrary, NotEqual_InstancedStruct, "StructUtilsFunctionLibrary", "NotEqual_InstancedStruct", SDK::Params::StructUtilsFunctionLibrary_NotEqual_InstancedStruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStructUtilsFunctionLibrary, Reset, "StructUtilsFunctionLibrary", "Reset", SDK::Params::StructUtilsFunctionLibrary_Reset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStructUtilsFunctionLibrary, SetInstancedStructValue, "StructUtilsFunctionLibrary", "SetInstancedStructValue", SDK::Params::StructUtilsFunctionLibrary_SetInstancedStructValue)
+// clang-format on
@@ -0,0 +1,236 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Synthesis_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Synthesis_classes.hpp"
+#include "../SDK/Synthesis_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthLibrary, AddModularSynthPresetToBankAsset, "ModularSynthLibrary", "AddModularSynthPresetToBankAsset", SDK::Params::ModularSynthLibrary_AddModularSynthPresetToBankAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, CreatePatch, "ModularSynthComponent", "CreatePatch", SDK::Params::ModularSynthComponent_CreatePatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, NoteOff, "ModularSynthComponent", "NoteOff", SDK::Params::ModularSynthComponent_NoteOff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, NoteOn, "ModularSynthComponent", "NoteOn", SDK::Params::ModularSynthComponent_NoteOn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetAttackTime, "ModularSynthComponent", "SetAttackTime", SDK::Params::ModularSynthComponent_SetAttackTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetChorusDepth, "ModularSynthComponent", "SetChorusDepth", SDK::Params::ModularSynthComponent_SetChorusDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetChorusEnabled, "ModularSynthComponent", "SetChorusEnabled", SDK::Params::ModularSynthComponent_SetChorusEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetChorusFeedback, "ModularSynthComponent", "SetChorusFeedback", SDK::Params::ModularSynthComponent_SetChorusFeedback)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetChorusFrequency, "ModularSynthComponent", "SetChorusFrequency", SDK::Params::ModularSynthComponent_SetChorusFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetDecayTime, "ModularSynthComponent", "SetDecayTime", SDK::Params::ModularSynthComponent_SetDecayTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetEnableLegato, "ModularSynthComponent", "SetEnableLegato", SDK::Params::ModularSynthComponent_SetEnableLegato)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetEnablePatch, "ModularSynthComponent", "SetEnablePatch", SDK::Params::ModularSynthComponent_SetEnablePatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetEnablePolyphony, "ModularSynthComponent", "SetEnablePolyphony", SDK::Params::ModularSynthComponent_SetEnablePolyphony)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetEnableRetrigger, "ModularSynthComponent", "SetEnableRetrigger", SDK::Params::ModularSynthComponent_SetEnableRetrigger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetEnableUnison, "ModularSynthComponent", "SetEnableUnison", SDK::Params::ModularSynthComponent_SetEnableUnison)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetFilterAlgorithm, "ModularSynthComponent", "SetFilterAlgorithm", SDK::Params::ModularSynthComponent_SetFilterAlgorithm)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetFilterFrequency, "ModularSynthComponent", "SetFilterFrequency", SDK::Params::ModularSynthComponent_SetFilterFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetFilterFrequencyMod, "ModularSynthComponent", "SetFilterFrequencyMod", SDK::Params::ModularSynthComponent_SetFilterFrequencyMod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetFilterQ, "ModularSynthComponent", "SetFilterQ", SDK::Params::ModularSynthComponent_SetFilterQ)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetFilterQMod, "ModularSynthComponent", "SetFilterQMod", SDK::Params::ModularSynthComponent_SetFilterQMod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetFilterType, "ModularSynthComponent", "SetFilterType", SDK::Params::ModularSynthComponent_SetFilterType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetGainDb, "ModularSynthComponent", "SetGainDb", SDK::Params::ModularSynthComponent_SetGainDb)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetLFOFrequency, "ModularSynthComponent", "SetLFOFrequency", SDK::Params::ModularSynthComponent_SetLFOFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetLFOFrequencyMod, "ModularSynthComponent", "SetLFOFrequencyMod", SDK::Params::ModularSynthComponent_SetLFOFrequencyMod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetLFOGain, "ModularSynthComponent", "SetLFOGain", SDK::Params::ModularSynthComponent_SetLFOGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetLFOGainMod, "ModularSynthComponent", "SetLFOGainMod", SDK::Params::ModularSynthComponent_SetLFOGainMod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetLFOMode, "ModularSynthComponent", "SetLFOMode", SDK::Params::ModularSynthComponent_SetLFOMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetLFOPatch, "ModularSynthComponent", "SetLFOPatch", SDK::Params::ModularSynthComponent_SetLFOPatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetLFOType, "ModularSynthComponent", "SetLFOType", SDK::Params::ModularSynthComponent_SetLFOType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvAttackTime, "ModularSynthComponent", "SetModEnvAttackTime", SDK::Params::ModularSynthComponent_SetModEnvAttackTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvBiasInvert, "ModularSynthComponent", "SetModEnvBiasInvert", SDK::Params::ModularSynthComponent_SetModEnvBiasInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvBiasPatch, "ModularSynthComponent", "SetModEnvBiasPatch", SDK::Params::ModularSynthComponent_SetModEnvBiasPatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvDecayTime, "ModularSynthComponent", "SetModEnvDecayTime", SDK::Params::ModularSynthComponent_SetModEnvDecayTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvDepth, "ModularSynthComponent", "SetModEnvDepth", SDK::Params::ModularSynthComponent_SetModEnvDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvInvert, "ModularSynthComponent", "SetModEnvInvert", SDK::Params::ModularSynthComponent_SetModEnvInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvPatch, "ModularSynthComponent", "SetModEnvPatch", SDK::Params::ModularSynthComponent_SetModEnvPatch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvReleaseTime, "ModularSynthComponent", "SetModEnvReleaseTime", SDK::Params::ModularSynthComponent_SetModEnvReleaseTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetModEnvSustainGain, "ModularSynthComponent", "SetModEnvSustainGain", SDK::Params::ModularSynthComponent_SetModEnvSustainGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscCents, "ModularSynthComponent", "SetOscCents", SDK::Params::ModularSynthComponent_SetOscCents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscFrequencyMod, "ModularSynthComponent", "SetOscFrequencyMod", SDK::Params::ModularSynthComponent_SetOscFrequencyMod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscGain, "ModularSynthComponent", "SetOscGain", SDK::Params::ModularSynthComponent_SetOscGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscGainMod, "ModularSynthComponent", "SetOscGainMod", SDK::Params::ModularSynthComponent_SetOscGainMod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscOctave, "ModularSynthComponent", "SetOscOctave", SDK::Params::ModularSynthComponent_SetOscOctave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscPulsewidth, "ModularSynthComponent", "SetOscPulsewidth", SDK::Params::ModularSynthComponent_SetOscPulsewidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscSemitones, "ModularSynthComponent", "SetOscSemitones", SDK::Params::ModularSynthComponent_SetOscSemitones)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscSync, "ModularSynthComponent", "SetOscSync", SDK::Params::ModularSynthComponent_SetOscSync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetOscType, "ModularSynthComponent", "SetOscType", SDK::Params::ModularSynthComponent_SetOscType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetPan, "ModularSynthComponent", "SetPan", SDK::Params::ModularSynthComponent_SetPan)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetPitchBend, "ModularSynthComponent", "SetPitchBend", SDK::Params::ModularSynthComponent_SetPitchBend)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetPortamento, "ModularSynthComponent", "SetPortamento", SDK::Params::ModularSynthComponent_SetPortamento)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetReleaseTime, "ModularSynthComponent", "SetReleaseTime", SDK::Params::ModularSynthComponent_SetReleaseTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetSpread, "ModularSynthComponent", "SetSpread", SDK::Params::ModularSynthComponent_SetSpread)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetStereoDelayFeedback, "ModularSynthComponent", "SetStereoDelayFeedback", SDK::Params::ModularSynthComponent_SetStereoDelayFeedback)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetStereoDelayIsEnabled, "ModularSynthComponent", "SetStereoDelayIsEnabled", SDK::Params::ModularSynthComponent_SetStereoDelayIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetStereoDelayMode, "ModularSynthComponent", "SetStereoDelayMode", SDK::Params::ModularSynthComponent_SetStereoDelayMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetStereoDelayRatio, "ModularSynthComponent", "SetStereoDelayRatio", SDK::Params::ModularSynthComponent_SetStereoDelayRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetStereoDelayTime, "ModularSynthComponent", "SetStereoDelayTime", SDK::Params::ModularSynthComponent_SetStereoDelayTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetStereoDelayWetlevel, "ModularSynthComponent", "SetStereoDelayWetlevel", SDK::Params::ModularSynthComponent_SetStereoDelayWetlevel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetSustainGain, "ModularSynthComponent", "SetSustainGain", SDK::Params::ModularSynthComponent_SetSustainGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UModularSynthComponent, SetSynthPreset, "ModularSynthComponent", "SetSynthPreset", SDK::Params::ModularSynthComponent_SetSynthPreset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectBitCrusherPreset, SetBitModulator, "SourceEffectBitCrusherPreset", "SetBitModulator", SDK::Params::SourceEffectBitCrusherPreset_SetBitModulator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectBitCrusherPreset, SetBitModulators, "SourceEffectBitCrusherPreset", "SetBitModulators", SDK::Params::SourceEffectBitCrusherPreset_SetBitModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectBitCrusherPreset, SetBits, "SourceEffectBitCrusherPreset", "SetBits", SDK::Params::SourceEffectBitCrusherPreset_SetBits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectBitCrusherPreset, SetModulationSettings, "SourceEffectBitCrusherPreset", "SetModulationSettings", SDK::Params::SourceEffectBitCrusherPreset_SetModulationSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectBitCrusherPreset, SetSampleRate, "SourceEffectBitCrusherPreset", "SetSampleRate", SDK::Params::SourceEffectBitCrusherPreset_SetSampleRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectBitCrusherPreset, SetSampleRateModulator, "SourceEffectBitCrusherPreset", "SetSampleRateModulator", SDK::Params::SourceEffectBitCrusherPreset_SetSampleRateModulator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectBitCrusherPreset, SetSampleRateModulators, "SourceEffectBitCrusherPreset", "SetSampleRateModulators", SDK::Params::SourceEffectBitCrusherPreset_SetSampleRateModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectBitCrusherPreset, SetSettings, "SourceEffectBitCrusherPreset", "SetSettings", SDK::Params::SourceEffectBitCrusherPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetDepth, "SourceEffectChorusPreset", "SetDepth", SDK::Params::SourceEffectChorusPreset_SetDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetDepthModulator, "SourceEffectChorusPreset", "SetDepthModulator", SDK::Params::SourceEffectChorusPreset_SetDepthModulator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetDepthModulators, "SourceEffectChorusPreset", "SetDepthModulators", SDK::Params::SourceEffectChorusPreset_SetDepthModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetDry, "SourceEffectChorusPreset", "SetDry", SDK::Params::SourceEffectChorusPreset_SetDry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetDryModulator, "SourceEffectChorusPreset", "SetDryModulator", SDK::Params::SourceEffectChorusPreset_SetDryModulator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetDryModulators, "SourceEffectChorusPreset", "SetDryModulators", SDK::Params::SourceEffectChorusPreset_SetDryModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetFeedback, "SourceEffectChorusPreset", "SetFeedback", SDK::Params::SourceEffectChorusPreset_SetFeedback)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetFeedbackModulator, "SourceEffectChorusPreset", "SetFeedbackModulator", SDK::Params::SourceEffectChorusPreset_SetFeedbackModulator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetFeedbackModulators, "SourceEffectChorusPreset", "SetFeedbackModulators", SDK::Params::SourceEffectChorusPreset_SetFeedbackModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetFrequency, "SourceEffectChorusPreset", "SetFrequency", SDK::Params::SourceEffectChorusPreset_SetFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetFrequencyModulator, "SourceEffectChorusPreset", "SetFrequencyModulator", SDK::Params::SourceEffectChorusPreset_SetFrequencyModulator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetFrequencyModulators, "SourceEffectChorusPreset", "SetFrequencyModulators", SDK::Params::SourceEffectChorusPreset_SetFrequencyModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetModulationSettings, "SourceEffectChorusPreset", "SetModulationSettings", SDK::Params::SourceEffectChorusPreset_SetModulationSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetSettings, "SourceEffectChorusPreset", "SetSettings", SDK::Params::SourceEffectChorusPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetSpread, "SourceEffectChorusPreset", "SetSpread", SDK::Params::SourceEffectChorusPreset_SetSpread)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetSpreadModulator, "SourceEffectChorusPreset", "SetSpreadModulator", SDK::Params::SourceEffectChorusPreset_SetSpreadModulator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetSpreadModulators, "SourceEffectChorusPreset", "SetSpreadModulators", SDK::Params::SourceEffectChorusPreset_SetSpreadModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetWet, "SourceEffectChorusPreset", "SetWet", SDK::Params::SourceEffectChorusPreset_SetWet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetWetModulator, "SourceEffectChorusPreset", "SetWetModulator", SDK::Params::SourceEffectChorusPreset_SetWetModulator)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectChorusPreset, SetWetModulators, "SourceEffectChorusPreset", "SetWetModulators", SDK::Params::SourceEffectChorusPreset_SetWetModulators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectConvolutionReverbPreset, SetImpulseResponse, "SourceEffectConvolutionReverbPreset", "SetImpulseResponse", SDK::Params::SourceEffectConvolutionReverbPreset_SetImpulseResponse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectConvolutionReverbPreset, SetSettings, "SourceEffectConvolutionReverbPreset", "SetSettings", SDK::Params::SourceEffectConvolutionReverbPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectDynamicsProcessorPreset, SetSettings, "SourceEffectDynamicsProcessorPreset", "SetSettings", SDK::Params::SourceEffectDynamicsProcessorPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectEnvelopeFollowerPreset, RegisterEnvelopeFollowerListener, "SourceEffectEnvelopeFollowerPreset", "RegisterEnvelopeFollowerListener", SDK::Params::SourceEffectEnvelopeFollowerPreset_RegisterEnvelopeFollowerListener)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectEnvelopeFollowerPreset, SetSettings, "SourceEffectEnvelopeFollowerPreset", "SetSettings", SDK::Params::SourceEffectEnvelopeFollowerPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectEnvelopeFollowerPreset, UnregisterEnvelopeFollowerListener, "SourceEffectEnvelopeFollowerPreset", "UnregisterEnvelopeFollowerListener", SDK::Params::SourceEffectEnvelopeFollowerPreset_UnregisterEnvelopeFollowerListener)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectEQPreset, SetSettings, "SourceEffectEQPreset", "SetSettings", SDK::Params::SourceEffectEQPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectFilterPreset, SetSettings, "SourceEffectFilterPreset", "SetSettings", SDK::Params::SourceEffectFilterPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectFoldbackDistortionPreset, SetSettings, "SourceEffectFoldbackDistortionPreset", "SetSettings", SDK::Params::SourceEffectFoldbackDistortionPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectMidSideSpreaderPreset, SetSettings, "SourceEffectMidSideSpreaderPreset", "SetSettings", SDK::Params::SourceEffectMidSideSpreaderPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectMotionFilterPreset, SetSettings, "SourceEffectMotionFilterPreset", "SetSettings", SDK::Params::SourceEffectMotionFilterPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectPannerPreset, SetSettings, "SourceEffectPannerPreset", "SetSettings", SDK::Params::SourceEffectPannerPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectPhaserPreset, SetSettings, "SourceEffectPhaserPreset", "SetSettings", SDK::Params::SourceEffectPhaserPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectRingModulationPreset, SetSettings, "SourceEffectRingModulationPreset", "SetSettings", SDK::Params::SourceEffectRingModulationPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectSimpleDelayPreset, SetSettings, "SourceEffectSimpleDelayPreset", "SetSettings", SDK::Params::SourceEffectSimpleDelayPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectStereoDelayPreset, SetSettings, "SourceEffectStereoDelayPreset", "SetSettings", SDK::Params::SourceEffectStereoDelayPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USourceEffectWaveShaperPreset, SetSettings, "SourceEffectWaveShaperPreset", "SetSettings", SDK::Params::SourceEffectWaveShaperPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectConvolutionReverbPreset, SetImpulseResponse, "SubmixEffectConvolutionReverbPreset", "SetImpulseResponse", SDK::Params::SubmixEffectConvolutionReverbPreset_SetImpulseResponse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectConvolutionReverbPreset, SetSettings, "SubmixEffectConvolutionReverbPreset", "SetSettings", SDK::Params::SubmixEffectConvolutionReverbPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDelayStatics, SetDelayLength, "SubmixEffectDelayStatics", "SetDelayLength", SDK::Params::SubmixEffectDelayStatics_SetDelayLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDelayStatics, SetInterpolationTime, "SubmixEffectDelayStatics", "SetInterpolationTime", SDK::Params::SubmixEffectDelayStatics_SetInterpolationTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDelayStatics, SetMaximumDelayLength, "SubmixEffectDelayStatics", "SetMaximumDelayLength", SDK::Params::SubmixEffectDelayStatics_SetMaximumDelayLength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDelayPreset, SetDefaultSettings, "SubmixEffectDelayPreset", "SetDefaultSettings", SDK::Params::SubmixEffectDelayPreset_SetDefaultSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDelayPreset, SetDelay, "SubmixEffectDelayPreset", "SetDelay", SDK::Params::SubmixEffectDelayPreset_SetDelay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDelayPreset, SetInterpolationTime, "SubmixEffectDelayPreset", "SetInterpolationTime", SDK::Params::SubmixEffectDelayPreset_SetInterpolationTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDelayPreset, SetSettings, "SubmixEffectDelayPreset", "SetSettings", SDK::Params::SubmixEffectDelayPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectDelayPreset, GetMaxDelayInMilliseconds, "SubmixEffectDelayPreset", "GetMaxDelayInMilliseconds", SDK::Params::SubmixEffectDelayPreset_GetMaxDelayInMilliseconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectFilterPreset, SetFilterAlgorithm, "SubmixEffectFilterPreset", "SetFilterAlgorithm", SDK::Params::SubmixEffectFilterPreset_SetFilterAlgorithm)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectFilterPreset, SetFilterCutoffFrequency, "SubmixEffectFilterPreset", "SetFilterCutoffFrequency", SDK::Params::SubmixEffectFilterPreset_SetFilterCutoffFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectFilterPreset, SetFilterCutoffFrequencyMod, "SubmixEffectFilterPreset", "SetFilterCutoffFrequencyMod", SDK::Params::SubmixEffectFilterPreset_SetFilterCutoffFrequencyMod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectFilterPreset, SetFilterQ, "SubmixEffectFilterPreset", "SetFilterQ", SDK::Params::SubmixEffectFilterPreset_SetFilterQ)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectFilterPreset, SetFilterQMod, "SubmixEffectFilterPreset", "SetFilterQMod", SDK::Params::SubmixEffectFilterPreset_SetFilterQMod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectFilterPreset, SetFilterType, "SubmixEffectFilterPreset", "SetFilterType", SDK::Params::SubmixEffectFilterPreset_SetFilterType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectFilterPreset, SetSettings, "SubmixEffectFilterPreset", "SetSettings", SDK::Params::SubmixEffectFilterPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectFlexiverbPreset, SetSettings, "SubmixEffectFlexiverbPreset", "SetSettings", SDK::Params::SubmixEffectFlexiverbPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectMultibandCompressorPreset, ResetKey, "SubmixEffectMultibandCompressorPreset", "ResetKey", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectMultibandCompressorPreset, SetAudioBus, "SubmixEffectMultibandCompressorPreset", "SetAudioBus", SDK::Params::SubmixEffectMultibandCompressorPreset_SetAudioBus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectMultibandCompressorPreset, SetExternalSubmix, "SubmixEffectMultibandCompressorPreset", "SetExternalSubmix", SDK::Params::SubmixEffectMultibandCompressorPreset_SetExternalSubmix)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectMultibandCompressorPreset, SetSettings, "SubmixEffectMultibandCompressorPreset", "SetSettings", SDK::Params::SubmixEffectMultibandCompressorPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectStereoDelayPreset, SetSettings, "SubmixEffectStereoDelayPreset", "SetSettings", SDK::Params::SubmixEffectStereoDelayPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectStereoToQuadPreset, SetSettings, "SubmixEffectStereoToQuadPreset", "SetSettings", SDK::Params::SubmixEffectStereoToQuadPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectTapDelayPreset, AddTap, "SubmixEffectTapDelayPreset", "AddTap", SDK::Params::SubmixEffectTapDelayPreset_AddTap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectTapDelayPreset, GetMaxDelayInMilliseconds, "SubmixEffectTapDelayPreset", "GetMaxDelayInMilliseconds", SDK::Params::SubmixEffectTapDelayPreset_GetMaxDelayInMilliseconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectTapDelayPreset, GetTap, "SubmixEffectTapDelayPreset", "GetTap", SDK::Params::SubmixEffectTapDelayPreset_GetTap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectTapDelayPreset, GetTapIds, "SubmixEffectTapDelayPreset", "GetTapIds", SDK::Params::SubmixEffectTapDelayPreset_GetTapIds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectTapDelayPreset, RemoveTap, "SubmixEffectTapDelayPreset", "RemoveTap", SDK::Params::SubmixEffectTapDelayPreset_RemoveTap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectTapDelayPreset, SetInterpolationTime, "SubmixEffectTapDelayPreset", "SetInterpolationTime", SDK::Params::SubmixEffectTapDelayPreset_SetInterpolationTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectTapDelayPreset, SetSettings, "SubmixEffectTapDelayPreset", "SetSettings", SDK::Params::SubmixEffectTapDelayPreset_SetSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USubmixEffectTapDelayPreset, SetTap, "SubmixEffectTapDelayPreset", "SetTap", SDK::Params::SubmixEffectTapDelayPreset_SetTap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, NoteOff, "GranularSynth", "NoteOff", SDK::Params::GranularSynth_NoteOff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, NoteOn, "GranularSynth", "NoteOn", SDK::Params::GranularSynth_NoteOn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetAttackTime, "GranularSynth", "SetAttackTime", SDK::Params::GranularSynth_SetAttackTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetDecayTime, "GranularSynth", "SetDecayTime", SDK::Params::GranularSynth_SetDecayTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetGrainDuration, "GranularSynth", "SetGrainDuration", SDK::Params::GranularSynth_SetGrainDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetGrainEnvelopeType, "GranularSynth", "SetGrainEnvelopeType", SDK::Params::GranularSynth_SetGrainEnvelopeType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetGrainPan, "GranularSynth", "SetGrainPan", SDK::Params::GranularSynth_SetGrainPan)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetGrainPitch, "GranularSynth", "SetGrainPitch", SDK::Params::GranularSynth_SetGrainPitch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetGrainProbability, "GranularSynth", "SetGrainProbability", SDK::Params::GranularSynth_SetGrainProbability)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetGrainsPerSecond, "GranularSynth", "SetGrainsPerSecond", SDK::Params::GranularSynth_SetGrainsPerSecond)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetGrainVolume, "GranularSynth", "SetGrainVolume", SDK::Params::GranularSynth_SetGrainVolume)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetPlaybackSpeed, "GranularSynth", "SetPlaybackSpeed", SDK::Params::GranularSynth_SetPlaybackSpeed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetPlayheadTime, "GranularSynth", "SetPlayheadTime", SDK::Params::GranularSynth_SetPlayheadTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetReleaseTimeMsec, "GranularSynth", "SetReleaseTimeMsec", SDK::Params::GranularSynth_SetReleaseTimeMsec)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetScrubMode, "GranularSynth", "SetScrubMode", SDK::Params::GranularSynth_SetScrubMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetSoundWave, "GranularSynth", "SetSoundWave", SDK::Params::GranularSynth_SetSoundWave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, SetSustainGain, "GranularSynth", "SetSustainGain", SDK::Params::GranularSynth_SetSustainGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, GetCurrentPlayheadTime, "GranularSynth", "GetCurrentPlayheadTime", SDK::Params::GranularSynth_GetCurrentPlayheadTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, GetSampleDuration, "GranularSynth", "GetSampleDuration", SDK::Params::GranularSynth_GetSampleDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGranularSynth, IsLoaded, "GranularSynth", "IsLoaded", SDK::Params::GranularSynth_IsLoaded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, GetCurveTangent, "SynthComponentMonoWaveTable", "GetCurveTangent", SDK::Params::SynthComponentMonoWaveTable_GetCurveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, GetNumTableEntries, "SynthComponentMonoWaveTable", "GetNumTableEntries", SDK::Params::SynthComponentMonoWaveTable_GetNumTableEntries)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, NoteOff, "SynthComponentMonoWaveTable", "NoteOff", SDK::Params::SynthComponentMonoWaveTable_NoteOff)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, NoteOn, "SynthComponentMonoWaveTable", "NoteOn", SDK::Params::SynthComponentMonoWaveTable_NoteOn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, RefreshAllWaveTables, "SynthComponentMonoWaveTable", "RefreshAllWaveTables", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, RefreshWaveTable, "SynthComponentMonoWaveTable", "RefreshWaveTable", SDK::Params::SynthComponentMonoWaveTable_RefreshWaveTable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetAmpEnvelopeAttackTime, "SynthComponentMonoWaveTable", "SetAmpEnvelopeAttackTime", SDK::Params::SynthComponentMonoWaveTable_SetAmpEnvelopeAttackTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetAmpEnvelopeBiasDepth, "SynthComponentMonoWaveTable", "SetAmpEnvelopeBiasDepth", SDK::Params::SynthComponentMonoWaveTable_SetAmpEnvelopeBiasDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetAmpEnvelopeBiasInvert, "SynthComponentMonoWaveTable", "SetAmpEnvelopeBiasInvert", SDK::Params::SynthComponentMonoWaveTable_SetAmpEnvelopeBiasInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetAmpEnvelopeDecayTime, "SynthComponentMonoWaveTable", "SetAmpEnvelopeDecayTime", SDK::Params::SynthComponentMonoWaveTable_SetAmpEnvelopeDecayTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetAmpEnvelopeDepth, "SynthComponentMonoWaveTable", "SetAmpEnvelopeDepth", SDK::Params::SynthComponentMonoWaveTable_SetAmpEnvelopeDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetAmpEnvelopeInvert, "SynthComponentMonoWaveTable", "SetAmpEnvelopeInvert", SDK::Params::SynthComponentMonoWaveTable_SetAmpEnvelopeInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetAmpEnvelopeReleaseTime, "SynthComponentMonoWaveTable", "SetAmpEnvelopeReleaseTime", SDK::Params::SynthComponentMonoWaveTable_SetAmpEnvelopeReleaseTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetAmpEnvelopeSustainGain, "SynthComponentMonoWaveTable", "SetAmpEnvelopeSustainGain", SDK::Params::SynthComponentMonoWaveTable_SetAmpEnvelopeSustainGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetCurveInterpolationType, "SynthComponentMonoWaveTable", "SetCurveInterpolationType", SDK::Params::SynthComponentMonoWaveTable_SetCurveInterpolationType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetCurveTangent, "SynthComponentMonoWaveTable", "SetCurveTangent", SDK::Params::SynthComponentMonoWaveTable_SetCurveTangent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetCurveValue, "SynthComponentMonoWaveTable", "SetCurveValue", SDK::Params::SynthComponentMonoWaveTable_SetCurveValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFilterEnvelopeAttackTime, "SynthComponentMonoWaveTable", "SetFilterEnvelopeAttackTime", SDK::Params::SynthComponentMonoWaveTable_SetFilterEnvelopeAttackTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFilterEnvelopeBiasDepth, "SynthComponentMonoWaveTable", "SetFilterEnvelopeBiasDepth", SDK::Params::SynthComponentMonoWaveTable_SetFilterEnvelopeBiasDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFilterEnvelopeBiasInvert, "SynthComponentMonoWaveTable", "SetFilterEnvelopeBiasInvert", SDK::Params::SynthComponentMonoWaveTable_SetFilterEnvelopeBiasInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFilterEnvelopeDepth, "SynthComponentMonoWaveTable", "SetFilterEnvelopeDepth", SDK::Params::SynthComponentMonoWaveTable_SetFilterEnvelopeDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFilterEnvelopeInvert, "SynthComponentMonoWaveTable", "SetFilterEnvelopeInvert", SDK::Params::SynthComponentMonoWaveTable_SetFilterEnvelopeInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFilterEnvelopenDecayTime, "SynthComponentMonoWaveTable", "SetFilterEnvelopenDecayTime", SDK::Params::SynthComponentMonoWaveTable_SetFilterEnvelopenDecayTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFilterEnvelopeReleaseTime, "SynthComponentMonoWaveTable", "SetFilterEnvelopeReleaseTime", SDK::Params::SynthComponentMonoWaveTable_SetFilterEnvelopeReleaseTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFilterEnvelopeSustainGain, "SynthComponentMonoWaveTable", "SetFilterEnvelopeSustainGain", SDK::Params::SynthComponentMonoWaveTable_SetFilterEnvelopeSustainGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFrequency, "SynthComponentMonoWaveTable", "SetFrequency", SDK::Params::SynthComponentMonoWaveTable_SetFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFrequencyPitchBend, "SynthComponentMonoWaveTable", "SetFrequencyPitchBend", SDK::Params::SynthComponentMonoWaveTable_SetFrequencyPitchBend)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetFrequencyWithMidiNote, "SynthComponentMonoWaveTable", "SetFrequencyWithMidiNote", SDK::Params::SynthComponentMonoWaveTable_SetFrequencyWithMidiNote)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetLowPassFilterResonance, "SynthComponentMonoWaveTable", "SetLowPassFilterResonance", SDK::Params::SynthComponentMonoWaveTable_SetLowPassFilterResonance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPositionEnvelopeAttackTime, "SynthComponentMonoWaveTable", "SetPositionEnvelopeAttackTime", SDK::Params::SynthComponentMonoWaveTable_SetPositionEnvelopeAttackTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPositionEnvelopeBiasDepth, "SynthComponentMonoWaveTable", "SetPositionEnvelopeBiasDepth", SDK::Params::SynthComponentMonoWaveTable_SetPositionEnvelopeBiasDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPositionEnvelopeBiasInvert, "SynthComponentMonoWaveTable", "SetPositionEnvelopeBiasInvert", SDK::Params::SynthComponentMonoWaveTable_SetPositionEnvelopeBiasInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPositionEnvelopeDecayTime, "SynthComponentMonoWaveTable", "SetPositionEnvelopeDecayTime", SDK::Params::SynthComponentMonoWaveTable_SetPositionEnvelopeDecayTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPositionEnvelopeDepth, "SynthComponentMonoWaveTable", "SetPositionEnvelopeDepth", SDK::Params::SynthComponentMonoWaveTable_SetPositionEnvelopeDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPositionEnvelopeInvert, "SynthComponentMonoWaveTable", "SetPositionEnvelopeInvert", SDK::Params::SynthComponentMonoWaveTable_SetPositionEnvelopeInvert)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPositionEnvelopeReleaseTime, "SynthComponentMonoWaveTable", "SetPositionEnvelopeReleaseTime", SDK::Params::SynthComponentMonoWaveTable_SetPositionEnvelopeReleaseTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPositionEnvelopeSustainGain, "SynthComponentMonoWaveTable", "SetPositionEnvelopeSustainGain", SDK::Params::SynthComponentMonoWaveTable_SetPositionEnvelopeSustainGain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPosLfoDepth, "SynthComponentMonoWaveTable", "SetPosLfoDepth", SDK::Params::SynthComponentMonoWaveTable_SetPosLfoDepth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPosLfoFrequency, "SynthComponentMonoWaveTable", "SetPosLfoFrequency", SDK::Params::SynthComponentMonoWaveTable_SetPosLfoFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetPosLfoType, "SynthComponentMonoWaveTable", "SetPosLfoType", SDK::Params::SynthComponentMonoWaveTable_SetPosLfoType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetSustainPedalState, "SynthComponentMonoWaveTable", "SetSustainPedalState", SDK::Params::SynthComponentMonoWaveTable_SetSustainPedalState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, SetWaveTablePosition, "SynthComponentMonoWaveTable", "SetWaveTablePosition", SDK::Params::SynthComponentMonoWaveTable_SetWaveTablePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, GetKeyFrameValuesForTable, "SynthComponentMonoWaveTable", "GetKeyFrameValuesForTable", SDK::Params::SynthComponentMonoWaveTable_GetKeyFrameValuesForTable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentMonoWaveTable, GetMaxTableIndex, "SynthComponentMonoWaveTable", "GetMaxTableIndex", SDK::Params::SynthComponentMonoWaveTable_GetMaxTableIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentToneGenerator, SetFrequency, "SynthComponentToneGenerator", "SetFrequency", SDK::Params::SynthComponentToneGenerator_SetFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthComponentToneGenerator, SetVolume, "SynthComponentToneGenerator", "SetVolume", SDK::Params::SynthComponentToneGenerator_SetVolume)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, SeekToTime, "SynthSamplePlayer", "SeekToTime", SDK::Params::SynthSamplePlayer_SeekToTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, SetPitch, "SynthSamplePlayer", "SetPitch", SDK::Params::SynthSamplePlayer_SetPitch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, SetScrubMode, "SynthSamplePlayer", "SetScrubMode", SDK::Params::SynthSamplePlayer_SetScrubMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, SetScrubTimeWidth, "SynthSamplePlayer", "SetScrubTimeWidth", SDK::Params::SynthSamplePlayer_SetScrubTimeWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, SetSoundWave, "SynthSamplePlayer", "SetSoundWave", SDK::Params::SynthSamplePlayer_SetSoundWave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, GetCurrentPlaybackProgressPercent, "SynthSamplePlayer", "GetCurrentPlaybackProgressPercent", SDK::Params::SynthSamplePlayer_GetCurrentPlaybackProgressPercent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, GetCurrentPlaybackProgressTime, "SynthSamplePlayer", "GetCurrentPlaybackProgressTime", SDK::Params::SynthSamplePlayer_GetCurrentPlaybackProgressTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, GetSampleDuration, "SynthSamplePlayer", "GetSampleDuration", SDK::Params::SynthSamplePlayer_GetSampleDuration)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthSamplePlayer, IsLoaded, "SynthSamplePlayer", "IsLoaded", SDK::Params::SynthSamplePlayer_IsLoaded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthesisUtilitiesBlueprintFunctionLibrary, GetLinearFrequency, "SynthesisUtilitiesBlueprintFunctionLibrary", "GetLinearFrequency", SDK::Params::SynthesisUtilitiesBlueprintFunctionLibrary_GetLinearFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthesisUtilitiesBlueprintFunctionLibrary, GetLogFrequency, "SynthesisUtilitiesBlueprintFunctionLibrary", "GetLogFrequency", SDK::Params::SynthesisUtilitiesBlueprintFunctionLibrary_GetLogFrequency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynth2DSlider, SetIndentHandle, "Synth2DSlider", "SetIndentHandle", SDK::Params::Synth2DSlider_SetIndentHandle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynth2DSlider, SetLocked, "Synth2DSlider", "SetLocked", SDK::Params::Synth2DSlider_SetLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynth2DSlider, SetSliderHandleColor, "Synth2DSlider", "SetSliderHandleColor", SDK::Params::Synth2DSlider_SetSliderHandleColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynth2DSlider, SetStepSize, "Synth2DSlider", "SetStepSize", SDK::Params::Synth2DSlider_SetStepSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynth2DSlider, SetValue, "Synth2DSlider", "SetValue", SDK::Params::Synth2DSlider_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynth2DSlider, GetValue, "Synth2DSlider", "GetValue", SDK::Params::Synth2DSlider_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthKnob, SetLocked, "SynthKnob", "SetLocked", SDK::Params::SynthKnob_SetLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthKnob, SetStepSize, "SynthKnob", "SetStepSize", SDK::Params::SynthKnob_SetStepSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthKnob, SetValue, "SynthKnob", "SetValue", SDK::Params::SynthKnob_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USynthKnob, GetValue, "SynthKnob", "GetValue", SDK::Params::SynthKnob_GetValue)
+// clang-format on
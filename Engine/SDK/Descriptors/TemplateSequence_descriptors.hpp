@@ -0,0 +1,21 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from TemplateSequence_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/TemplateSequence_classes.hpp"
+#include "../SDK/TemplateSequence_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ATemplateSequenceActor, SetBinding, "TemplateSequenceActor", "SetBinding", SDK::Params::TemplateSequenceActor_SetBinding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ATemplateSequenceActor, SetSequence, "TemplateSequenceActor", "SetSequence", SDK::Params::TemplateSequenceActor_SetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ATemplateSequenceActor, GetSequence, "TemplateSequenceActor", "GetSequence", SDK::Params::TemplateSequenceActor_GetSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ATemplateSequenceActor, GetSequencePlayer, "TemplateSequenceActor", "GetSequencePlayer", SDK::Params::TemplateSequenceActor_GetSequencePlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ATemplateSequenceActor, LoadSequence, "TemplateSequenceActor", "LoadSequence", SDK::Params::TemplateSequenceActor_LoadSequence)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTemplateSequencePlayer, CreateTemplateSequencePlayer, "TemplateSequencePlayer", "CreateTemplateSequencePlayer", SDK::Params::TemplateSequencePlayer_CreateTemplateSequencePlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceCameraShakeTestUtil, GetCameraCachePOV, "SequenceCameraShakeTestUtil", "GetCameraCachePOV", SDK::Params::SequenceCameraShakeTestUtil_GetCameraCachePOV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceCameraShakeTestUtil, GetLastFrameCameraCachePOV, "SequenceCameraShakeTestUtil", "GetLastFrameCameraCachePOV", SDK::Params::SequenceCameraShakeTestUtil_GetLastFrameCameraCachePOV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USequenceCameraShakeTestUtil, GetPostProcessBlendCache, "SequenceCameraShakeTestUtil", "GetPostProcessBlendCache", SDK::Params::SequenceCameraShakeTestUtil_GetPostProcessBlendCache)
+// clang-format on
@@ -0,0 +1,30 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from TimeManagement_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/TimeManagement_classes.hpp"
+#include "../SDK/TimeManagement_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Add_FrameNumberFrameNumber, "TimeManagementBlueprintLibrary", "Add_FrameNumberFrameNumber", SDK::Params::TimeManagementBlueprintLibrary_Add_FrameNumberFrameNumber)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Add_FrameNumberInteger, "TimeManagementBlueprintLibrary", "Add_FrameNumberInteger", SDK::Params::TimeManagementBlueprintLibrary_Add_FrameNumberInteger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Conv_FrameNumberToInteger, "TimeManagementBlueprintLibrary", "Conv_FrameNumberToInteger", SDK::Params::TimeManagementBlueprintLibrary_Conv_FrameNumberToInteger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Conv_FrameRateToInterval, "TimeManagementBlueprintLibrary", "Conv_FrameRateToInterval", SDK::Params::TimeManagementBlueprintLibrary_Conv_FrameRateToInterval)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Conv_FrameRateToSeconds, "TimeManagementBlueprintLibrary", "Conv_FrameRateToSeconds", SDK::Params::TimeManagementBlueprintLibrary_Conv_FrameRateToSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Conv_QualifiedFrameTimeToSeconds, "TimeManagementBlueprintLibrary", "Conv_QualifiedFrameTimeToSeconds", SDK::Params::TimeManagementBlueprintLibrary_Conv_QualifiedFrameTimeToSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Conv_TimecodeToString, "TimeManagementBlueprintLibrary", "Conv_TimecodeToString", SDK::Params::TimeManagementBlueprintLibrary_Conv_TimecodeToString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Divide_FrameNumberInteger, "TimeManagementBlueprintLibrary", "Divide_FrameNumberInteger", SDK::Params::TimeManagementBlueprintLibrary_Divide_FrameNumberInteger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, GetTimecode, "TimeManagementBlueprintLibrary", "GetTimecode", SDK::Params::TimeManagementBlueprintLibrary_GetTimecode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, GetTimecodeFrameRate, "TimeManagementBlueprintLibrary", "GetTimecodeFrameRate", SDK::Params::TimeManagementBlueprintLibrary_GetTimecodeFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, IsValid_Framerate, "TimeManagementBlueprintLibrary", "IsValid_Framerate", SDK::Params::TimeManagementBlueprintLibrary_IsValid_Framerate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, IsValid_MultipleOf, "TimeManagementBlueprintLibrary", "IsValid_MultipleOf", SDK::Params::TimeManagementBlueprintLibrary_IsValid_MultipleOf)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Multiply_FrameNumberInteger, "TimeManagementBlueprintLibrary", "Multiply_FrameNumberInteger", SDK::Params::TimeManagementBlueprintLibrary_Multiply_FrameNumberInteger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Multiply_SecondsFrameRate, "TimeManagementBlueprintLibrary", "Multiply_SecondsFrameRate", SDK::Params::TimeManagementBlueprintLibrary_Multiply_SecondsFrameRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, SnapFrameTimeToRate, "TimeManagementBlueprintLibrary", "SnapFrameTimeToRate", SDK::Params::TimeManagementBlueprintLibrary_SnapFrameTimeToRate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Subtract_FrameNumberFrameNumber, "TimeManagementBlueprintLibrary", "Subtract_FrameNumberFrameNumber", SDK::Params::TimeManagementBlueprintLibrary_Subtract_FrameNumberFrameNumber)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, Subtract_FrameNumberInteger, "TimeManagementBlueprintLibrary", "Subtract_FrameNumberInteger", SDK::Params::TimeManagementBlueprintLibrary_Subtract_FrameNumberInteger)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTimeManagementBlueprintLibrary, TransformTime, "TimeManagementBlueprintLibrary", "TransformTime", SDK::Params::TimeManagementBlueprintLibrary_TransformTime)
+// clang-format on
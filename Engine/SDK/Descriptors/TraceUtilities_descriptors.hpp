@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from TraceUtilities_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/TraceUtilities_classes.hpp"
+#include "../SDK/TraceUtilities_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, GetAllChannels, "TraceUtilLibrary", "GetAllChannels", SDK::Params::TraceUtilLibrary_GetAllChannels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, GetEnabledChannels, "TraceUtilLibrary", "GetEnabledChannels", SDK::Params::TraceUtilLibrary_GetEnabledChannels)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, IsChannelEnabled, "TraceUtilLibrary", "IsChannelEnabled", SDK::Params::TraceUtilLibrary_IsChannelEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, IsTracing, "TraceUtilLibrary", "IsTracing", SDK::Params::TraceUtilLibrary_IsTracing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, PauseTracing, "TraceUtilLibrary", "PauseTracing", SDK::Params::TraceUtilLibrary_PauseTracing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, ResumeTracing, "TraceUtilLibrary", "ResumeTracing", SDK::Params::TraceUtilLibrary_ResumeTracing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, StartTraceSendTo, "TraceUtilLibrary", "StartTraceSendTo", SDK::Params::TraceUtilLibrary_StartTraceSendTo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, StartTraceToFile, "TraceUtilLibrary", "StartTraceToFile", SDK::Params::TraceUtilLibrary_StartTraceToFile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, StopTracing, "TraceUtilLibrary", "StopTracing", SDK::Params::TraceUtilLibrary_StopTracing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, ToggleChannel, "TraceUtilLibrary", "ToggleChannel", SDK::Params::TraceUtilLibrary_ToggleChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, TraceBookmark, "TraceUtilLibrary", "TraceBookmark", SDK::Params::TraceUtilLibrary_TraceBookmark)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, TraceMarkRegionEnd, "TraceUtilLibrary", "TraceMarkRegionEnd", SDK::Params::TraceUtilLibrary_TraceMarkRegionEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTraceUtilLibrary, TraceMarkRegionStart, "TraceUtilLibrary", "TraceMarkRegionStart", SDK::Params::TraceUtilLibrary_TraceMarkRegionStart)
+// clang-format on
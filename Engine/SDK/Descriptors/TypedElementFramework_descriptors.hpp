@@ -0,0 +1,42 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from TypedElementFramework_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/TypedElementFramework_classes.hpp"
+#include "../SDK/TypedElementFramework_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementHandleLibrary, Equal, "TypedElementHandleLibrary", "Equal", SDK::Params::TypedElementHandleLibrary_Equal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementHandleLibrary, IsSet, "TypedElementHandleLibrary", "IsSet", SDK::Params::TypedElementHandleLibrary_IsSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementHandleLibrary, NotEqual, "TypedElementHandleLibrary", "NotEqual", SDK::Params::TypedElementHandleLibrary_NotEqual)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementHandleLibrary, Release, "TypedElementHandleLibrary", "Release", SDK::Params::TypedElementHandleLibrary_Release)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Add, "TypedElementListLibrary", "Add", SDK::Params::TypedElementListLibrary_Add)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Append, "TypedElementListLibrary", "Append", SDK::Params::TypedElementListLibrary_Append)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, AppendList, "TypedElementListLibrary", "AppendList", SDK::Params::TypedElementListLibrary_AppendList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Clone, "TypedElementListLibrary", "Clone", SDK::Params::TypedElementListLibrary_Clone)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Contains, "TypedElementListLibrary", "Contains", SDK::Params::TypedElementListLibrary_Contains)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, CountElements, "TypedElementListLibrary", "CountElements", SDK::Params::TypedElementListLibrary_CountElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, CountElementsOfType, "TypedElementListLibrary", "CountElementsOfType", SDK::Params::TypedElementListLibrary_CountElementsOfType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, CreateScriptElementList, "TypedElementListLibrary", "CreateScriptElementList", SDK::Params::TypedElementListLibrary_CreateScriptElementList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Empty, "TypedElementListLibrary", "Empty", SDK::Params::TypedElementListLibrary_Empty)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, GetElementHandleAt, "TypedElementListLibrary", "GetElementHandleAt", SDK::Params::TypedElementListLibrary_GetElementHandleAt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, GetElementHandles, "TypedElementListLibrary", "GetElementHandles", SDK::Params::TypedElementListLibrary_GetElementHandles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, GetElementInterface, "TypedElementListLibrary", "GetElementInterface", SDK::Params::TypedElementListLibrary_GetElementInterface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, HasElements, "TypedElementListLibrary", "HasElements", SDK::Params::TypedElementListLibrary_HasElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, HasElementsOfType, "TypedElementListLibrary", "HasElementsOfType", SDK::Params::TypedElementListLibrary_HasElementsOfType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, IsValidIndex, "TypedElementListLibrary", "IsValidIndex", SDK::Params::TypedElementListLibrary_IsValidIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Num, "TypedElementListLibrary", "Num", SDK::Params::TypedElementListLibrary_Num)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Remove, "TypedElementListLibrary", "Remove", SDK::Params::TypedElementListLibrary_Remove)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Reserve, "TypedElementListLibrary", "Reserve", SDK::Params::TypedElementListLibrary_Reserve)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Reset, "TypedElementListLibrary", "Reset", SDK::Params::TypedElementListLibrary_Reset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementListLibrary, Shrink, "TypedElementListLibrary", "Shrink", SDK::Params::TypedElementListLibrary_Shrink)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementRegistry, GetInstance, "TypedElementRegistry", "GetInstance", SDK::Params::TypedElementRegistry_GetInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementRegistry, GetElementInterface, "TypedElementRegistry", "GetElementInterface", SDK::Params::TypedElementRegistry_GetElementInterface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITestTypedElementInterfaceA, GetDisplayName, "TestTypedElementInterfaceA", "GetDisplayName", SDK::Params::TestTypedElementInterfaceA_GetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITestTypedElementInterfaceA, SetDisplayName, "TestTypedElementInterfaceA", "SetDisplayName", SDK::Params::TestTypedElementInterfaceA_SetDisplayName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITestTypedElementInterfaceB, MarkAsTested, "TestTypedElementInterfaceB", "MarkAsTested", SDK::Params::TestTypedElementInterfaceB_MarkAsTested)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITestTypedElementInterfaceC, GetIsTested, "TestTypedElementInterfaceC", "GetIsTested", SDK::Params::TestTypedElementInterfaceC_GetIsTested)
+// clang-format on
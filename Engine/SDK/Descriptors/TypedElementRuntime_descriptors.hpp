@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from TypedElementRuntime_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/TypedElementRuntime_classes.hpp"
+#include "../SDK/TypedElementRuntime_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSetLibrary, DeselectElementsFromList, "TypedElementSelectionSetLibrary", "DeselectElementsFromList", SDK::Params::TypedElementSelectionSetLibrary_DeselectElementsFromList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSetLibrary, GetNormalizedElementList, "TypedElementSelectionSetLibrary", "GetNormalizedElementList", SDK::Params::TypedElementSelectionSetLibrary_GetNormalizedElementList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSetLibrary, GetNormalizedSelection, "TypedElementSelectionSetLibrary", "GetNormalizedSelection", SDK::Params::TypedElementSelectionSetLibrary_GetNormalizedSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSetLibrary, SelectElementsFromList, "TypedElementSelectionSetLibrary", "SelectElementsFromList", SDK::Params::TypedElementSelectionSetLibrary_SelectElementsFromList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSetLibrary, SetSelectionFromList, "TypedElementSelectionSetLibrary", "SetSelectionFromList", SDK::Params::TypedElementSelectionSetLibrary_SetSelectionFromList)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, ClearSelection, "TypedElementSelectionSet", "ClearSelection", SDK::Params::TypedElementSelectionSet_ClearSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, DeselectElement, "TypedElementSelectionSet", "DeselectElement", SDK::Params::TypedElementSelectionSet_DeselectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, DeselectElements, "TypedElementSelectionSet", "DeselectElements", SDK::Params::TypedElementSelectionSet_DeselectElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, RestoreSelectionState, "TypedElementSelectionSet", "RestoreSelectionState", SDK::Params::TypedElementSelectionSet_RestoreSelectionState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, SelectElement, "TypedElementSelectionSet", "SelectElement", SDK::Params::TypedElementSelectionSet_SelectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, SelectElements, "TypedElementSelectionSet", "SelectElements", SDK::Params::TypedElementSelectionSet_SelectElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, SetSelection, "TypedElementSelectionSet", "SetSelection", SDK::Params::TypedElementSelectionSet_SetSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, AllowSelectionModifiers, "TypedElementSelectionSet", "AllowSelectionModifiers", SDK::Params::TypedElementSelectionSet_AllowSelectionModifiers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, CanDeselectElement, "TypedElementSelectionSet", "CanDeselectElement", SDK::Params::TypedElementSelectionSet_CanDeselectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, CanSelectElement, "TypedElementSelectionSet", "CanSelectElement", SDK::Params::TypedElementSelectionSet_CanSelectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, CountSelectedElements, "TypedElementSelectionSet", "CountSelectedElements", SDK::Params::TypedElementSelectionSet_CountSelectedElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, CountSelectedObjects, "TypedElementSelectionSet", "CountSelectedObjects", SDK::Params::TypedElementSelectionSet_CountSelectedObjects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, GetBottomSelectedObject, "TypedElementSelectionSet", "GetBottomSelectedObject", SDK::Params::TypedElementSelectionSet_GetBottomSelectedObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, GetCurrentSelectionState, "TypedElementSelectionSet", "GetCurrentSelectionState", SDK::Params::TypedElementSelectionSet_GetCurrentSelectionState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, GetNumSelectedElements, "TypedElementSelectionSet", "GetNumSelectedElements", SDK::Params::TypedElementSelectionSet_GetNumSelectedElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, GetSelectedObjects, "TypedElementSelectionSet", "GetSelectedObjects", SDK::Params::TypedElementSelectionSet_GetSelectedObjects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, GetSelectionElement, "TypedElementSelectionSet", "GetSelectionElement", SDK::Params::TypedElementSelectionSet_GetSelectionElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, GetTopSelectedObject, "TypedElementSelectionSet", "GetTopSelectedObject", SDK::Params::TypedElementSelectionSet_GetTopSelectedObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, HasSelectedElements, "TypedElementSelectionSet", "HasSelectedElements", SDK::Params::TypedElementSelectionSet_HasSelectedElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, HasSelectedObjects, "TypedElementSelectionSet", "HasSelectedObjects", SDK::Params::TypedElementSelectionSet_HasSelectedObjects)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, IsElementSelected, "TypedElementSelectionSet", "IsElementSelected", SDK::Params::TypedElementSelectionSet_IsElementSelected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTypedElementSelectionSet, K2_GetSelectedElementHandles, "TypedElementSelectionSet", "K2_GetSelectedElementHandles", SDK::Params::TypedElementSelectionSet_K2_GetSelectedElementHandles)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementAssetDataInterface, GetAllReferencedAssetDatas, "TypedElementAssetDataInterface", "GetAllReferencedAssetDatas", SDK::Params::TypedElementAssetDataInterface_GetAllReferencedAssetDatas)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementAssetDataInterface, GetAssetData, "TypedElementAssetDataInterface", "GetAssetData", SDK::Params::TypedElementAssetDataInterface_GetAssetData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementHierarchyInterface, GetChildElements, "TypedElementHierarchyInterface", "GetChildElements", SDK::Params::TypedElementHierarchyInterface_GetChildElements)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementHierarchyInterface, GetParentElement, "TypedElementHierarchyInterface", "GetParentElement", SDK::Params::TypedElementHierarchyInterface_GetParentElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementObjectInterface, GetObject, "TypedElementObjectInterface", "GetObject", SDK::Params::TypedElementObjectInterface_GetObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementObjectInterface, GetObjectClass, "TypedElementObjectInterface", "GetObjectClass", SDK::Params::TypedElementObjectInterface_GetObjectClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementPrimitiveCustomDataInterface, SetCustomData, "TypedElementPrimitiveCustomDataInterface", "SetCustomData", SDK::Params::TypedElementPrimitiveCustomDataInterface_SetCustomData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementPrimitiveCustomDataInterface, SetCustomDataValue, "TypedElementPrimitiveCustomDataInterface", "SetCustomDataValue", SDK::Params::TypedElementPrimitiveCustomDataInterface_SetCustomDataValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementSelectionInterface, AllowSelectionModifiers, "TypedElementSelectionInterface", "AllowSelectionModifiers", SDK::Params::TypedElementSelectionInterface_AllowSelectionModifiers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementSelectionInterface, CanDeselectElement, "TypedElementSelectionInterface", "CanDeselectElement", SDK::Params::TypedElementSelectionInterface_CanDeselectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementSelectionInterface, CanSelectElement, "TypedElementSelectionInterface", "CanSelectElement", SDK::Params::TypedElementSelectionInterface_CanSelectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementSelectionInterface, DeselectElement, "TypedElementSelectionInterface", "DeselectElement", SDK::Params::TypedElementSelectionInterface_DeselectElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementSelectionInterface, GetSelectionElement, "TypedElementSelectionInterface", "GetSelectionElement", SDK::Params::TypedElementSelectionInterface_GetSelectionElement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementSelectionInterface, IsElementSelected, "TypedElementSelectionInterface", "IsElementSelected", SDK::Params::TypedElementSelectionInterface_IsElementSelected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ITypedElementSelectionInterface, SelectElement, "TypedElementSelectionInterface", "SelectElement", SDK::Params::TypedElementSelectionInterface_SelectElement)
+// clang-format on
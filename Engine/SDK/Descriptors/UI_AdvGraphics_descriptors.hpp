@@ -0,0 +1,39 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_AdvGraphics_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_AdvGraphics_classes.hpp"
+#include "../SDK/UI_AdvGraphics_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_AntiAliaUp_K2Node_ComponentBoundEvent_23_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_AntiAliaUp_K2Node_ComponentBoundEvent_23_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_BackButton_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_BackButton_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_BackButton_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_BackButton_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_BackButton_K2Node_ComponentBoundEvent_16_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_BackButton_K2Node_ComponentBoundEvent_16_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_1_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_1_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_1_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_1_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_1_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_1_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_27_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_27_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_27_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_27_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_27_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_27_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_2_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_2_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_2_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_2_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_2_K2Node_ComponentBoundEvent_4_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_2_K2Node_ComponentBoundEvent_4_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_4_K2Node_ComponentBoundEvent_24_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_4_K2Node_ComponentBoundEvent_24_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_Button_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_Button_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_FoliageDown_K2Node_ComponentBoundEvent_21_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_FoliageDown_K2Node_ComponentBoundEvent_21_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_FoliageUp_K2Node_ComponentBoundEvent_22_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_FoliageUp_K2Node_ComponentBoundEvent_22_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_GraphicsDown_1_K2Node_ComponentBoundEvent_20_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_GraphicsDown_1_K2Node_ComponentBoundEvent_20_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_GraphicsDown_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_GraphicsDown_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_GraphicsUp_K2Node_ComponentBoundEvent_19_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_GraphicsUp_K2Node_ComponentBoundEvent_19_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_SaveButton_K2Node_ComponentBoundEvent_17_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_SaveButton_K2Node_ComponentBoundEvent_17_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_SaveButton_K2Node_ComponentBoundEvent_18_OnButtonHoverEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_SaveButton_K2Node_ComponentBoundEvent_18_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, BndEvt__UI_AdvGraphics_SaveButton_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature, "UI_AdvGraphics_C", "BndEvt__UI_AdvGraphics_SaveButton_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, ExecuteUbergraph_UI_AdvGraphics, "UI_AdvGraphics_C", "ExecuteUbergraph_UI_AdvGraphics", SDK::Params::UI_AdvGraphics_C_ExecuteUbergraph_UI_AdvGraphics)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AdvGraphics_C, Tick, "UI_AdvGraphics_C", "Tick", SDK::Params::UI_AdvGraphics_C_Tick)
+// clang-format on
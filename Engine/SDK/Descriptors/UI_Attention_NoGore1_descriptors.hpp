@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Attention_NoGore1_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Attention_NoGore1_classes.hpp"
+#include "../SDK/UI_Attention_NoGore1_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore1_Button_0_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore1_Button_0_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore1_Button_0_K2Node_ComponentBoundEvent_5_OnButtonHoverEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore1_Button_0_K2Node_ComponentBoundEvent_5_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore1_Button_1_K2Node_ComponentBoundEvent_11_OnButtonClickedEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore1_Button_1_K2Node_ComponentBoundEvent_11_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore1_Button_1_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore1_Button_1_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore1_Button_1_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore1_Button_1_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore1_Button_K2Node_ComponentBoundEvent_10_OnButtonClickedEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore1_Button_K2Node_ComponentBoundEvent_10_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore1_Button_K2Node_ComponentBoundEvent_6_OnButtonHoverEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore1_Button_K2Node_ComponentBoundEvent_6_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore1_Button_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore1_Button_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, BndEvt__UI_Attention_NoGore_Button_0_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_Attention_NoGore1_C", "BndEvt__UI_Attention_NoGore_Button_0_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, Construct, "UI_Attention_NoGore1_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, ExecuteUbergraph_UI_Attention_NoGore1, "UI_Attention_NoGore1_C", "ExecuteUbergraph_UI_Attention_NoGore1", SDK::Params::UI_Attention_NoGore1_C_ExecuteUbergraph_UI_Attention_NoGore1)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, GetText, "UI_Attention_NoGore1_C", "GetText", SDK::Params::UI_Attention_NoGore1_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Attention_NoGore1_C, GetText_0, "UI_Attention_NoGore1_C", "GetText_0", SDK::Params::UI_Attention_NoGore1_C_GetText_0)
+// clang-format on
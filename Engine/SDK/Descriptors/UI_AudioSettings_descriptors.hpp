@@ -0,0 +1,33 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_AudioSettings_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_AudioSettings_classes.hpp"
+#include "../SDK/UI_AudioSettings_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_BackButton_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_BackButton_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_BackButton_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_BackButton_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_BackButton_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_BackButton_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_Button_1_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_Button_1_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_Button_1_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_Button_1_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_Button_27_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_Button_27_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_Button_27_K2Node_ComponentBoundEvent_4_OnButtonHoverEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_Button_27_K2Node_ComponentBoundEvent_4_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_Button_K2Node_ComponentBoundEvent_6_OnButtonHoverEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_Button_K2Node_ComponentBoundEvent_6_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_Button_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_Button_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_AudioSettings_SliderVOice_K2Node_ComponentBoundEvent_14_OnFloatValueChangedEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_AudioSettings_SliderVOice_K2Node_ComponentBoundEvent_14_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_AudioSettings_C_BndEvt__UI_AudioSettings_SliderVOice_K2Node_ComponentBoundEvent_14_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_Controls_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_Controls_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_Controls_Button_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_Controls_Button_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_Settings_Game_Button_1_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_Settings_Game_Button_1_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_Settings_Slider_0_K2Node_ComponentBoundEvent_8_OnFloatValueChangedEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_Settings_Slider_0_K2Node_ComponentBoundEvent_8_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_AudioSettings_C_BndEvt__UI_Settings_Slider_0_K2Node_ComponentBoundEvent_8_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, BndEvt__UI_Settings_Slider_K2Node_ComponentBoundEvent_9_OnFloatValueChangedEvent__DelegateSignature, "UI_AudioSettings_C", "BndEvt__UI_Settings_Slider_K2Node_ComponentBoundEvent_9_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_AudioSettings_C_BndEvt__UI_Settings_Slider_K2Node_ComponentBoundEvent_9_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, Construct, "UI_AudioSettings_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, ExecuteUbergraph_UI_AudioSettings, "UI_AudioSettings_C", "ExecuteUbergraph_UI_AudioSettings", SDK::Params::UI_AudioSettings_C_ExecuteUbergraph_UI_AudioSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, Get_SliderMusic_Value, "UI_AudioSettings_C", "Get_SliderMusic_Value", SDK::Params::UI_AudioSettings_C_Get_SliderMusic_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, Get_SliderSFX_Value, "UI_AudioSettings_C", "Get_SliderSFX_Value", SDK::Params::UI_AudioSettings_C_Get_SliderSFX_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, Get_SliderVOice_Value, "UI_AudioSettings_C", "Get_SliderVOice_Value", SDK::Params::UI_AudioSettings_C_Get_SliderVOice_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_AudioSettings_C, Tick, "UI_AudioSettings_C", "Tick", SDK::Params::UI_AudioSettings_C_Tick)
+// clang-format on
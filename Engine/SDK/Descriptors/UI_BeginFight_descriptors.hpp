@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_BeginFight_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_BeginFight_classes.hpp"
+#include "../SDK/UI_BeginFight_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_BeginFight_C, Construct, "UI_BeginFight_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_BeginFight_C, ExecuteUbergraph_UI_BeginFight, "UI_BeginFight_C", "ExecuteUbergraph_UI_BeginFight", SDK::Params::UI_BeginFight_C_ExecuteUbergraph_UI_BeginFight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_BeginFight_C, Tick, "UI_BeginFight_C", "Tick", SDK::Params::UI_BeginFight_C_Tick)
+// clang-format on
@@ -0,0 +1,26 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Card_Boss_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Card_Boss_classes.hpp"
+#include "../SDK/UI_Card_Boss_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature, "UI_Card_Boss_C", "BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_Card_Boss_C", "BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_8_OnButtonClickedEvent__DelegateSignature, "UI_Card_Boss_C", "BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_8_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_Card_Boss_C", "BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature, "UI_Card_Boss_C", "BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature, "UI_Card_Boss_C", "BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, Construct, "UI_Card_Boss_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, ExecuteUbergraph_UI_Card_Boss, "UI_Card_Boss_C", "ExecuteUbergraph_UI_Card_Boss", SDK::Params::UI_Card_Boss_C_ExecuteUbergraph_UI_Card_Boss)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, GetPercent, "UI_Card_Boss_C", "GetPercent", SDK::Params::UI_Card_Boss_C_GetPercent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, GetText, "UI_Card_Boss_C", "GetText", SDK::Params::UI_Card_Boss_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, GetText_0, "UI_Card_Boss_C", "GetText_0", SDK::Params::UI_Card_Boss_C_GetText_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, GetVisibility_0, "UI_Card_Boss_C", "GetVisibility_0", SDK::Params::UI_Card_Boss_C_GetVisibility_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, PreConstruct, "UI_Card_Boss_C", "PreConstruct", SDK::Params::UI_Card_Boss_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Card_Boss_C, Tick, "UI_Card_Boss_C", "Tick", SDK::Params::UI_Card_Boss_C_Tick)
+// clang-format on
@@ -0,0 +1,29 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Cards_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Cards_classes.hpp"
+#include "../SDK/UI_Cards_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_8_OnButtonClickedEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Button_88_K2Node_ComponentBoundEvent_8_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Card_1_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Card_2_K2Node_ComponentBoundEvent_4_OnButtonHoverEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Card_2_K2Node_ComponentBoundEvent_4_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Card_2_K2Node_ComponentBoundEvent_5_OnButtonHoverEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Card_2_K2Node_ComponentBoundEvent_5_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, BndEvt__UI_Cards_Card_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature, "UI_Cards_C", "BndEvt__UI_Cards_Card_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, Construct, "UI_Cards_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, ExecuteUbergraph_UI_Cards, "UI_Cards_C", "ExecuteUbergraph_UI_Cards", SDK::Params::UI_Cards_C_ExecuteUbergraph_UI_Cards)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, GetPercent, "UI_Cards_C", "GetPercent", SDK::Params::UI_Cards_C_GetPercent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, GetText, "UI_Cards_C", "GetText", SDK::Params::UI_Cards_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, GetText_0, "UI_Cards_C", "GetText_0", SDK::Params::UI_Cards_C_GetText_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, GetVisibility_0, "UI_Cards_C", "GetVisibility_0", SDK::Params::UI_Cards_C_GetVisibility_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, PreConstruct, "UI_Cards_C", "PreConstruct", SDK::Params::UI_Cards_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Cards_C, Tick, "UI_Cards_C", "Tick", SDK::Params::UI_Cards_C_Tick)
+// clang-format on
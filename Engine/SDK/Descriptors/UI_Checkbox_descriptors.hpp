@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Checkbox_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Checkbox_classes.hpp"
+#include "../SDK/UI_Checkbox_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, BndEvt__ToggleDoF_1_K2Node_ComponentBoundEvent_3_OnCheckBoxComponentStateChanged__DelegateSignature, "UI_Checkbox_C", "BndEvt__ToggleDoF_1_K2Node_ComponentBoundEvent_3_OnCheckBoxComponentStateChanged__DelegateSignature", SDK::Params::UI_Checkbox_C_BndEvt__ToggleDoF_1_K2Node_ComponentBoundEvent_3_OnCheckBoxComponentStateChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, ChangeValue, "UI_Checkbox_C", "ChangeValue", SDK::Params::UI_Checkbox_C_ChangeValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, Construct, "UI_Checkbox_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, ExecuteUbergraph_UI_Checkbox, "UI_Checkbox_C", "ExecuteUbergraph_UI_Checkbox", SDK::Params::UI_Checkbox_C_ExecuteUbergraph_UI_Checkbox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, Initialize, "UI_Checkbox_C", "Initialize", SDK::Params::UI_Checkbox_C_Initialize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, OnMouseEnter, "UI_Checkbox_C", "OnMouseEnter", SDK::Params::UI_Checkbox_C_OnMouseEnter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, PreConstruct, "UI_Checkbox_C", "PreConstruct", SDK::Params::UI_Checkbox_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, ResetCheckbox, "UI_Checkbox_C", "ResetCheckbox", SDK::Params::UI_Checkbox_C_ResetCheckbox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, ResetToggleFocus, "UI_Checkbox_C", "ResetToggleFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, Set_Focused_or_Unfocused_Color, "UI_Checkbox_C", "Set Focused or Unfocused Color", SDK::Params::UI_Checkbox_C_Set_Focused_or_Unfocused_Color)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, SetToggleFocus, "UI_Checkbox_C", "SetToggleFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, setTxtValue, "UI_Checkbox_C", "setTxtValue", SDK::Params::UI_Checkbox_C_setTxtValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Checkbox_C, ToggleUsingArrows, "UI_Checkbox_C", "ToggleUsingArrows", SDK::Params::UI_Checkbox_C_ToggleUsingArrows)
+// clang-format on
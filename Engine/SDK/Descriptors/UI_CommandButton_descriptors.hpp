@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_CommandButton_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_CommandButton_classes.hpp"
+#include "../SDK/UI_CommandButton_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_CommandButton_C, BndEvt__Button_K2Node_ComponentBoundEvent_1_OnButtonPressedEvent__DelegateSignature, "UI_CommandButton_C", "BndEvt__Button_K2Node_ComponentBoundEvent_1_OnButtonPressedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_CommandButton_C, ExecuteUbergraph_UI_CommandButton, "UI_CommandButton_C", "ExecuteUbergraph_UI_CommandButton", SDK::Params::UI_CommandButton_C_ExecuteUbergraph_UI_CommandButton)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_CommandButton_C, OnMouseEnter, "UI_CommandButton_C", "OnMouseEnter", SDK::Params::UI_CommandButton_C_OnMouseEnter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_CommandButton_C, OnMouseLeave, "UI_CommandButton_C", "OnMouseLeave", SDK::Params::UI_CommandButton_C_OnMouseLeave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_CommandButton_C, PreConstruct, "UI_CommandButton_C", "PreConstruct", SDK::Params::UI_CommandButton_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_CommandButton_C, UpdateIconByIndex, "UI_CommandButton_C", "UpdateIconByIndex", SDK::Params::UI_CommandButton_C_UpdateIconByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_CommandButton_C, UpdateIconDT, "UI_CommandButton_C", "UpdateIconDT", SDK::Params::UI_CommandButton_C_UpdateIconDT)
+// clang-format on
@@ -0,0 +1,34 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Controls_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Controls_classes.hpp"
+#include "../SDK/UI_Controls_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_BackButton_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_BackButton_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_BackButton_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_BackButton_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_27_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_27_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_27_K2Node_ComponentBoundEvent_4_OnButtonHoverEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_27_K2Node_ComponentBoundEvent_4_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_3_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_3_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Button_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Button_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_CheckBox_0_K2Node_ComponentBoundEvent_18_OnCheckBoxComponentStateChanged__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_CheckBox_0_K2Node_ComponentBoundEvent_18_OnCheckBoxComponentStateChanged__DelegateSignature", SDK::Params::UI_Controls_C_BndEvt__UI_Controls_CheckBox_0_K2Node_ComponentBoundEvent_18_OnCheckBoxComponentStateChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_CheckBox_K2Node_ComponentBoundEvent_13_OnCheckBoxComponentStateChanged__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_CheckBox_K2Node_ComponentBoundEvent_13_OnCheckBoxComponentStateChanged__DelegateSignature", SDK::Params::UI_Controls_C_BndEvt__UI_Controls_CheckBox_K2Node_ComponentBoundEvent_13_OnCheckBoxComponentStateChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Controls_Slider_Sensitivity_K2Node_ComponentBoundEvent_17_OnFloatValueChangedEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Controls_Slider_Sensitivity_K2Node_ComponentBoundEvent_17_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_Controls_C_BndEvt__UI_Controls_Slider_Sensitivity_K2Node_ComponentBoundEvent_17_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, BndEvt__UI_Settings_GraphicsReturn_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature, "UI_Controls_C", "BndEvt__UI_Settings_GraphicsReturn_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, Construct, "UI_Controls_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, ExecuteUbergraph_UI_Controls, "UI_Controls_C", "ExecuteUbergraph_UI_Controls", SDK::Params::UI_Controls_C_ExecuteUbergraph_UI_Controls)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, Get_Slider_Sensitivity_Value, "UI_Controls_C", "Get_Slider_Sensitivity_Value", SDK::Params::UI_Controls_C_Get_Slider_Sensitivity_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, GetCheckedState, "UI_Controls_C", "GetCheckedState", SDK::Params::UI_Controls_C_GetCheckedState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, GetCheckedState_0, "UI_Controls_C", "GetCheckedState_0", SDK::Params::UI_Controls_C_GetCheckedState_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Controls_C, Tick, "UI_Controls_C", "Tick", SDK::Params::UI_Controls_C_Tick)
+// clang-format on
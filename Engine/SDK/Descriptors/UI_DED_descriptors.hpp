@@ -0,0 +1,20 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_DED_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_DED_classes.hpp"
+#include "../SDK/UI_DED_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DED_C, BndEvt__UI_DED_Button_155_K2Node_ComponentBoundEvent_0_OnButtonHoverEvent__DelegateSignature, "UI_DED_C", "BndEvt__UI_DED_Button_155_K2Node_ComponentBoundEvent_0_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DED_C, BndEvt__UI_DED_Button_155_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature, "UI_DED_C", "BndEvt__UI_DED_Button_155_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DED_C, BndEvt__UI_DED_Button_155_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature, "UI_DED_C", "BndEvt__UI_DED_Button_155_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DED_C, Construct, "UI_DED_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DED_C, ExecuteUbergraph_UI_DED, "UI_DED_C", "ExecuteUbergraph_UI_DED", SDK::Params::UI_DED_C_ExecuteUbergraph_UI_DED)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DED_C, Get_Score_Text, "UI_DED_C", "Get_Score_Text", SDK::Params::UI_DED_C_Get_Score_Text)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DED_C, GetText, "UI_DED_C", "GetText", SDK::Params::UI_DED_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DED_C, Tick, "UI_DED_C", "Tick", SDK::Params::UI_DED_C_Tick)
+// clang-format on
@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_DisplaySettings_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_DisplaySettings_classes.hpp"
+#include "../SDK/UI_DisplaySettings_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__Settings_UI_GraphicsDown_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__Settings_UI_GraphicsDown_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__Settings_UI_GraphicsUp_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__Settings_UI_GraphicsUp_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_BackButton_1_K2Node_ComponentBoundEvent_24_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_BackButton_1_K2Node_ComponentBoundEvent_24_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_BackButton_1_K2Node_ComponentBoundEvent_25_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_BackButton_1_K2Node_ComponentBoundEvent_25_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_BackButton_1_K2Node_ComponentBoundEvent_26_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_BackButton_1_K2Node_ComponentBoundEvent_26_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_Button_3_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_Button_3_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_Button_3_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_Button_3_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_Button_3_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_Button_3_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_DisplayDown_1_K2Node_ComponentBoundEvent_16_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_DisplayDown_1_K2Node_ComponentBoundEvent_16_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_DisplayUp_1_K2Node_ComponentBoundEvent_29_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_DisplayUp_1_K2Node_ComponentBoundEvent_29_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_GraphicsDown_3_K2Node_ComponentBoundEvent_7_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_GraphicsDown_3_K2Node_ComponentBoundEvent_7_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_GraphicsDown_4_K2Node_ComponentBoundEvent_28_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_GraphicsDown_4_K2Node_ComponentBoundEvent_28_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_GraphicsDown_5_K2Node_ComponentBoundEvent_27_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_GraphicsDown_5_K2Node_ComponentBoundEvent_27_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_GraphicsDown_6_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_GraphicsDown_6_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_VsyncDown_1_K2Node_ComponentBoundEvent_30_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_VsyncDown_1_K2Node_ComponentBoundEvent_30_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_DisplaySettings_VsyncUp_1_K2Node_ComponentBoundEvent_31_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_DisplaySettings_VsyncUp_1_K2Node_ComponentBoundEvent_31_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_BackButton_K2Node_ComponentBoundEvent_18_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_BackButton_K2Node_ComponentBoundEvent_18_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_BackButton_K2Node_ComponentBoundEvent_19_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_BackButton_K2Node_ComponentBoundEvent_19_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_BackButton_K2Node_ComponentBoundEvent_19_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_BackButton_K2Node_ComponentBoundEvent_19_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Button_1_K2Node_ComponentBoundEvent_17_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Button_1_K2Node_ComponentBoundEvent_17_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Button_1_K2Node_ComponentBoundEvent_20_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Button_1_K2Node_ComponentBoundEvent_20_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Button_1_K2Node_ComponentBoundEvent_21_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Button_1_K2Node_ComponentBoundEvent_21_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Button_2_K2Node_ComponentBoundEvent_22_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Button_2_K2Node_ComponentBoundEvent_22_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Button_2_K2Node_ComponentBoundEvent_23_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Button_2_K2Node_ComponentBoundEvent_23_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Button_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Button_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Button_K2Node_ComponentBoundEvent_4_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Button_K2Node_ComponentBoundEvent_4_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Button_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Button_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_GraphicsDown_1_K2Node_ComponentBoundEvent_12_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_GraphicsDown_1_K2Node_ComponentBoundEvent_12_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_GraphicsDown_2_K2Node_ComponentBoundEvent_14_OnButtonClickedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_GraphicsDown_2_K2Node_ComponentBoundEvent_14_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Slider_FOV_1_K2Node_ComponentBoundEvent_10_OnFloatValueChangedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Slider_FOV_1_K2Node_ComponentBoundEvent_10_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_DisplaySettings_C_BndEvt__UI_Settings_AuVi_Slider_FOV_1_K2Node_ComponentBoundEvent_10_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, BndEvt__UI_Settings_AuVi_Slider_FOV_K2Node_ComponentBoundEvent_13_OnFloatValueChangedEvent__DelegateSignature, "UI_DisplaySettings_C", "BndEvt__UI_Settings_AuVi_Slider_FOV_K2Node_ComponentBoundEvent_13_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_DisplaySettings_C_BndEvt__UI_Settings_AuVi_Slider_FOV_K2Node_ComponentBoundEvent_13_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Construct, "UI_DisplaySettings_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, ExecuteUbergraph_UI_DisplaySettings, "UI_DisplaySettings_C", "ExecuteUbergraph_UI_DisplaySettings", SDK::Params::UI_DisplaySettings_C_ExecuteUbergraph_UI_DisplaySettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Get_DisplayMode_2_Text, "UI_DisplaySettings_C", "Get_DisplayMode_2_Text", SDK::Params::UI_DisplaySettings_C_Get_DisplayMode_2_Text)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Get_FOV, "UI_DisplaySettings_C", "Get_FOV", SDK::Params::UI_DisplaySettings_C_Get_FOV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Get_FPS, "UI_DisplaySettings_C", "Get_FPS", SDK::Params::UI_DisplaySettings_C_Get_FPS)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Get_Graphics, "UI_DisplaySettings_C", "Get_Graphics", SDK::Params::UI_DisplaySettings_C_Get_Graphics)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Get_HUD, "UI_DisplaySettings_C", "Get_HUD", SDK::Params::UI_DisplaySettings_C_Get_HUD)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Get_Resolution, "UI_DisplaySettings_C", "Get_Resolution", SDK::Params::UI_DisplaySettings_C_Get_Resolution)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Get_Vsync, "UI_DisplaySettings_C", "Get_Vsync", SDK::Params::UI_DisplaySettings_C_Get_Vsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Get_WindowMode, "UI_DisplaySettings_C", "Get_WindowMode", SDK::Params::UI_DisplaySettings_C_Get_WindowMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, GetLastOpenedWidget, "UI_DisplaySettings_C", "GetLastOpenedWidget", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, SetLastOpenedWidget, "UI_DisplaySettings_C", "SetLastOpenedWidget", SDK::Params::UI_DisplaySettings_C_SetLastOpenedWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_DisplaySettings_C, Tick, "UI_DisplaySettings_C", "Tick", SDK::Params::UI_DisplaySettings_C_Tick)
+// clang-format on
@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_FadeOut_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_FadeOut_classes.hpp"
+#include "../SDK/UI_FadeOut_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_FadeOut_C, Construct, "UI_FadeOut_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_FadeOut_C, ExecuteUbergraph_UI_FadeOut, "UI_FadeOut_C", "ExecuteUbergraph_UI_FadeOut", SDK::Params::UI_FadeOut_C_ExecuteUbergraph_UI_FadeOut)
+// clang-format on
@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_FadeToAbyss_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_FadeToAbyss_classes.hpp"
+#include "../SDK/UI_FadeToAbyss_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_FadeToAbyss_C, Construct, "UI_FadeToAbyss_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_FadeToAbyss_C, ExecuteUbergraph_UI_FadeToAbyss, "UI_FadeToAbyss_C", "ExecuteUbergraph_UI_FadeToAbyss", SDK::Params::UI_FadeToAbyss_C_ExecuteUbergraph_UI_FadeToAbyss)
+// clang-format on
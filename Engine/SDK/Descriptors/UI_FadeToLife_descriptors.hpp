@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_FadeToLife_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_FadeToLife_classes.hpp"
+#include "../SDK/UI_FadeToLife_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_FadeToLife_C, Construct, "UI_FadeToLife_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_FadeToLife_C, ExecuteUbergraph_UI_FadeToLife, "UI_FadeToLife_C", "ExecuteUbergraph_UI_FadeToLife", SDK::Params::UI_FadeToLife_C_ExecuteUbergraph_UI_FadeToLife)
+// clang-format on
@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Gallery_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Gallery_classes.hpp"
+#include "../SDK/UI_Gallery_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_BackFullScreen_K2Node_ComponentBoundEvent_4_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_BackFullScreen_K2Node_ComponentBoundEvent_4_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_Close_K2Node_ComponentBoundEvent_1_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_Close_K2Node_ComponentBoundEvent_1_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_Fullscreen_Next_K2Node_ComponentBoundEvent_3_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_Fullscreen_Next_K2Node_ComponentBoundEvent_3_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_Fullscreen_Previous_K2Node_ComponentBoundEvent_2_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_Fullscreen_Previous_K2Node_ComponentBoundEvent_2_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_Next_K2Node_ComponentBoundEvent_1_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_Next_K2Node_ComponentBoundEvent_1_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_PhotoMode_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_PhotoMode_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_Previous_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_Previous_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_Select_K2Node_ComponentBoundEvent_3_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_Select_K2Node_ComponentBoundEvent_3_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__Command_ShowMouse_K2Node_ComponentBoundEvent_2_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__Command_ShowMouse_K2Node_ComponentBoundEvent_2_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__CommandButton_OpenPhotoModeFullscreen_K2Node_ComponentBoundEvent_5_OnPressed__DelegateSignature, "UI_Gallery_C", "BndEvt__CommandButton_OpenPhotoModeFullscreen_K2Node_ComponentBoundEvent_5_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__NextPageButton_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_Gallery_C", "BndEvt__NextPageButton_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, BndEvt__PreviousPageButton_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_Gallery_C", "BndEvt__PreviousPageButton_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, CloseFullscreen, "UI_Gallery_C", "CloseFullscreen", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, Construct, "UI_Gallery_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, CreatePages, "UI_Gallery_C", "CreatePages", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, DeletePhoto, "UI_Gallery_C", "DeletePhoto", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, Destruct, "UI_Gallery_C", "Destruct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, ExecuteUbergraph_UI_Gallery, "UI_Gallery_C", "ExecuteUbergraph_UI_Gallery", SDK::Params::UI_Gallery_C_ExecuteUbergraph_UI_Gallery)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, Get_Any_Key, "UI_Gallery_C", "Get Any Key", SDK::Params::UI_Gallery_C_Get_Any_Key)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, LoadNextPrevPage, "UI_Gallery_C", "LoadNextPrevPage", SDK::Params::UI_Gallery_C_LoadNextPrevPage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, Next_Page_Button_Visibility, "UI_Gallery_C", "Next Page Button Visibility", SDK::Params::UI_Gallery_C_Next_Page_Button_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, NextPage, "UI_Gallery_C", "NextPage", SDK::Params::UI_Gallery_C_NextPage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, OnKeyDown, "UI_Gallery_C", "OnKeyDown", SDK::Params::UI_Gallery_C_OnKeyDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, OnMouseButtonDown, "UI_Gallery_C", "OnMouseButtonDown", SDK::Params::UI_Gallery_C_OnMouseButtonDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, OnMouseEnter, "UI_Gallery_C", "OnMouseEnter", SDK::Params::UI_Gallery_C_OnMouseEnter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, OnMouseLeave, "UI_Gallery_C", "OnMouseLeave", SDK::Params::UI_Gallery_C_OnMouseLeave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, OnMouseMove, "UI_Gallery_C", "OnMouseMove", SDK::Params::UI_Gallery_C_OnMouseMove)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, OnMouseWheel, "UI_Gallery_C", "OnMouseWheel", SDK::Params::UI_Gallery_C_OnMouseWheel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, OnRemovedFromFocusPath, "UI_Gallery_C", "OnRemovedFromFocusPath", SDK::Params::UI_Gallery_C_OnRemovedFromFocusPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, PreConstruct, "UI_Gallery_C", "PreConstruct", SDK::Params::UI_Gallery_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, Previous_Page_Button_Visibility, "UI_Gallery_C", "Previous Page Button Visibility", SDK::Params::UI_Gallery_C_Previous_Page_Button_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, PreviousPage, "UI_Gallery_C", "PreviousPage", SDK::Params::UI_Gallery_C_PreviousPage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, ResetFocus, "UI_Gallery_C", "ResetFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, ResetKeyboardIcons, "UI_Gallery_C", "ResetKeyboardIcons", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, ResetShowMouseCursor, "UI_Gallery_C", "ResetShowMouseCursor", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, SendPhotoData, "UI_Gallery_C", "SendPhotoData", SDK::Params::UI_Gallery_C_SendPhotoData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, SetIcons, "UI_Gallery_C", "SetIcons", SDK::Params::UI_Gallery_C_SetIcons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, ShowHideDeleteOption, "UI_Gallery_C", "ShowHideDeleteOption", SDK::Params::UI_Gallery_C_ShowHideDeleteOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, ShowHideMouseTxt, "UI_Gallery_C", "ShowHideMouseTxt", SDK::Params::UI_Gallery_C_ShowHideMouseTxt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, ShowHideMouseVisibility, "UI_Gallery_C", "ShowHideMouseVisibility", SDK::Params::UI_Gallery_C_ShowHideMouseVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, ShowMouse, "UI_Gallery_C", "ShowMouse", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, SwapUpDownLeftRightVisibility, "UI_Gallery_C", "SwapUpDownLeftRightVisibility", SDK::Params::UI_Gallery_C_SwapUpDownLeftRightVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, TabToOpen, "UI_Gallery_C", "TabToOpen", SDK::Params::UI_Gallery_C_TabToOpen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, Tick, "UI_Gallery_C", "Tick", SDK::Params::UI_Gallery_C_Tick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Gallery_C, UpdatePhotosData, "UI_Gallery_C", "UpdatePhotosData", void)
+// clang-format on
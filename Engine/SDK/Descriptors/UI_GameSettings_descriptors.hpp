@@ -0,0 +1,44 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_GameSettings_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_GameSettings_classes.hpp"
+#include "../SDK/UI_GameSettings_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_Button_1_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_Button_1_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_Button_1_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_Button_1_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_Button_27_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_Button_27_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_Button_27_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_Button_27_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_Button_2_K2Node_ComponentBoundEvent_16_OnButtonHoverEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_Button_2_K2Node_ComponentBoundEvent_16_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_Button_2_K2Node_ComponentBoundEvent_17_OnButtonHoverEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_Button_2_K2Node_ComponentBoundEvent_17_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_Button_3_K2Node_ComponentBoundEvent_18_OnButtonClickedEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_Button_3_K2Node_ComponentBoundEvent_18_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_CheckBox_0_K2Node_ComponentBoundEvent_1_OnCheckBoxComponentStateChanged__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_CheckBox_0_K2Node_ComponentBoundEvent_1_OnCheckBoxComponentStateChanged__DelegateSignature", SDK::Params::UI_GameSettings_C_BndEvt__UI_GameSettings_CheckBox_0_K2Node_ComponentBoundEvent_1_OnCheckBoxComponentStateChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_GameSettings_CheckBox_K2Node_ComponentBoundEvent_4_OnCheckBoxComponentStateChanged__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_GameSettings_CheckBox_K2Node_ComponentBoundEvent_4_OnCheckBoxComponentStateChanged__DelegateSignature", SDK::Params::UI_GameSettings_C_BndEvt__UI_GameSettings_CheckBox_K2Node_ComponentBoundEvent_4_OnCheckBoxComponentStateChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_Settings_Game_Button_1_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_Settings_Game_Button_1_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_Settings_Game_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_Settings_Game_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_Settings_Game_Slider_LockOnSlider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_Settings_Game_Slider_LockOnSlider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_GameSettings_C_BndEvt__UI_Settings_Game_Slider_LockOnSlider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_Settings_Slider_0_K2Node_ComponentBoundEvent_8_OnFloatValueChangedEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_Settings_Slider_0_K2Node_ComponentBoundEvent_8_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_GameSettings_C_BndEvt__UI_Settings_Slider_0_K2Node_ComponentBoundEvent_8_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, BndEvt__UI_Settings_Slider_K2Node_ComponentBoundEvent_9_OnFloatValueChangedEvent__DelegateSignature, "UI_GameSettings_C", "BndEvt__UI_Settings_Slider_K2Node_ComponentBoundEvent_9_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_GameSettings_C_BndEvt__UI_Settings_Slider_K2Node_ComponentBoundEvent_9_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, Construct, "UI_GameSettings_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, ExecuteUbergraph_UI_GameSettings, "UI_GameSettings_C", "ExecuteUbergraph_UI_GameSettings", SDK::Params::UI_GameSettings_C_ExecuteUbergraph_UI_GameSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, Get_BoneSnappingSlid_Value, "UI_GameSettings_C", "Get_BoneSnappingSlid_Value", SDK::Params::UI_GameSettings_C_Get_BoneSnappingSlid_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, Get_Slider_DamagePlayer_Value, "UI_GameSettings_C", "Get_Slider_DamagePlayer_Value", SDK::Params::UI_GameSettings_C_Get_Slider_DamagePlayer_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, Get_Slider_LockOnSlider_Value, "UI_GameSettings_C", "Get_Slider_LockOnSlider_Value", SDK::Params::UI_GameSettings_C_Get_Slider_LockOnSlider_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, GetCheckedState, "UI_GameSettings_C", "GetCheckedState", SDK::Params::UI_GameSettings_C_GetCheckedState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, GetCheckedState_0, "UI_GameSettings_C", "GetCheckedState_0", SDK::Params::UI_GameSettings_C_GetCheckedState_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, GetValue, "UI_GameSettings_C", "GetValue", SDK::Params::UI_GameSettings_C_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, GetValue_0, "UI_GameSettings_C", "GetValue_0", SDK::Params::UI_GameSettings_C_GetValue_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, GetValue_1, "UI_GameSettings_C", "GetValue_1", SDK::Params::UI_GameSettings_C_GetValue_1)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, GetValue_2, "UI_GameSettings_C", "GetValue_2", SDK::Params::UI_GameSettings_C_GetValue_2)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, GetValue_3, "UI_GameSettings_C", "GetValue_3", SDK::Params::UI_GameSettings_C_GetValue_3)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, PreConstruct, "UI_GameSettings_C", "PreConstruct", SDK::Params::UI_GameSettings_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GameSettings_C, Tick, "UI_GameSettings_C", "Tick", SDK::Params::UI_GameSettings_C_Tick)
+// clang-format on
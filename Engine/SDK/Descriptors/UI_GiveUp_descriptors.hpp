@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_GiveUp_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_GiveUp_classes.hpp"
+#include "../SDK/UI_GiveUp_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GiveUp_C, Construct, "UI_GiveUp_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GiveUp_C, ExecuteUbergraph_UI_GiveUp, "UI_GiveUp_C", "ExecuteUbergraph_UI_GiveUp", SDK::Params::UI_GiveUp_C_ExecuteUbergraph_UI_GiveUp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GiveUp_C, GetPercent, "UI_GiveUp_C", "GetPercent", SDK::Params::UI_GiveUp_C_GetPercent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GiveUp_C, GetText, "UI_GiveUp_C", "GetText", SDK::Params::UI_GiveUp_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GiveUp_C, GetText_0, "UI_GiveUp_C", "GetText_0", SDK::Params::UI_GiveUp_C_GetText_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GiveUp_C, PreConstruct, "UI_GiveUp_C", "PreConstruct", SDK::Params::UI_GiveUp_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GiveUp_C, Tick, "UI_GiveUp_C", "Tick", SDK::Params::UI_GiveUp_C_Tick)
+// clang-format on
@@ -0,0 +1,42 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_GoreSettings_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_GoreSettings_classes.hpp"
+#include "../SDK/UI_GoreSettings_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_Controls_Button_2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_BackButton_1_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_Button_1_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_Button_1_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_Button_1_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_Button_1_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_Button_27_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_Button_27_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_Button_27_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_Button_27_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_Button_2_K2Node_ComponentBoundEvent_16_OnButtonHoverEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_Button_2_K2Node_ComponentBoundEvent_16_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GameSettings_Button_2_K2Node_ComponentBoundEvent_17_OnButtonHoverEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GameSettings_Button_2_K2Node_ComponentBoundEvent_17_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GoreSettings_GraphicsDown_K2Node_ComponentBoundEvent_19_OnButtonClickedEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GoreSettings_GraphicsDown_K2Node_ComponentBoundEvent_19_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_GoreSettings_GraphicsUp_K2Node_ComponentBoundEvent_18_OnButtonClickedEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_GoreSettings_GraphicsUp_K2Node_ComponentBoundEvent_18_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_Settings_AuVi_Slider_1_K2Node_ComponentBoundEvent_6_OnFloatValueChangedEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_Settings_AuVi_Slider_1_K2Node_ComponentBoundEvent_6_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_GoreSettings_C_BndEvt__UI_Settings_AuVi_Slider_1_K2Node_ComponentBoundEvent_6_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_Settings_Game_BodyDensitySlid_K2Node_ComponentBoundEvent_1_OnFloatValueChangedEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_Settings_Game_BodyDensitySlid_K2Node_ComponentBoundEvent_1_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_GoreSettings_C_BndEvt__UI_Settings_Game_BodyDensitySlid_K2Node_ComponentBoundEvent_1_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_Settings_Game_Button_1_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_Settings_Game_Button_1_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, BndEvt__UI_Settings_Game_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_GoreSettings_C", "BndEvt__UI_Settings_Game_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, Construct, "UI_GoreSettings_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, ExecuteUbergraph_UI_GoreSettings, "UI_GoreSettings_C", "ExecuteUbergraph_UI_GoreSettings", SDK::Params::UI_GoreSettings_C_ExecuteUbergraph_UI_GoreSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, Get_BoneSnappingSlid_Value, "UI_GoreSettings_C", "Get_BoneSnappingSlid_Value", SDK::Params::UI_GoreSettings_C_Get_BoneSnappingSlid_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, Get_Slider_DamagePlayer_Value, "UI_GoreSettings_C", "Get_Slider_DamagePlayer_Value", SDK::Params::UI_GoreSettings_C_Get_Slider_DamagePlayer_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, Get_Slider_LockOnSlider_Value, "UI_GoreSettings_C", "Get_Slider_LockOnSlider_Value", SDK::Params::UI_GoreSettings_C_Get_Slider_LockOnSlider_Value)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, GetBrush, "UI_GoreSettings_C", "GetBrush", SDK::Params::UI_GoreSettings_C_GetBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, GetText, "UI_GoreSettings_C", "GetText", SDK::Params::UI_GoreSettings_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, GetValue, "UI_GoreSettings_C", "GetValue", SDK::Params::UI_GoreSettings_C_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, GetValue_0, "UI_GoreSettings_C", "GetValue_0", SDK::Params::UI_GoreSettings_C_GetValue_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, GetValue_1, "UI_GoreSettings_C", "GetValue_1", SDK::Params::UI_GoreSettings_C_GetValue_1)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, GetValue_2, "UI_GoreSettings_C", "GetValue_2", SDK::Params::UI_GoreSettings_C_GetValue_2)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, GetValue_3, "UI_GoreSettings_C", "GetValue_3", SDK::Params::UI_GoreSettings_C_GetValue_3)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, PreConstruct, "UI_GoreSettings_C", "PreConstruct", SDK::Params::UI_GoreSettings_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_GoreSettings_C, Tick, "UI_GoreSettings_C", "Tick", SDK::Params::UI_GoreSettings_C_Tick)
+// clang-format on
@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_HUD_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_HUD_classes.hpp"
+#include "../SDK/UI_HUD_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_HUD_C, Aim_Lock_Is_Off, "UI_HUD_C", "Aim Lock Is Off", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_HUD_C, Aim_Lock_Is_On, "UI_HUD_C", "Aim Lock Is On", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_HUD_C, Construct, "UI_HUD_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_HUD_C, ExecuteUbergraph_UI_HUD, "UI_HUD_C", "ExecuteUbergraph_UI_HUD", SDK::Params::UI_HUD_C_ExecuteUbergraph_UI_HUD)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_HUD_C, Get_TextDisabled_1_Text, "UI_HUD_C", "Get_TextDisabled_1_Text", SDK::Params::UI_HUD_C_Get_TextDisabled_1_Text)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_HUD_C, PreConstruct, "UI_HUD_C", "PreConstruct", SDK::Params::UI_HUD_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_HUD_C, Tick, "UI_HUD_C", "Tick", SDK::Params::UI_HUD_C_Tick)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Helper_BP_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Helper_BP_classes.hpp"
+#include "../SDK/UI_Helper_BP_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AUI_Helper_BP_C, Add_Handle_Event, "UI_Helper_BP_C", "Add Handle Event", SDK::Params::UI_Helper_BP_C_Add_Handle_Event)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AUI_Helper_BP_C, Destroy_Handle_Event, "UI_Helper_BP_C", "Destroy Handle Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AUI_Helper_BP_C, ExecuteUbergraph_UI_Helper_BP, "UI_Helper_BP_C", "ExecuteUbergraph_UI_Helper_BP", SDK::Params::UI_Helper_BP_C_ExecuteUbergraph_UI_Helper_BP)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AUI_Helper_BP_C, ReceiveTick, "UI_Helper_BP_C", "ReceiveTick", SDK::Params::UI_Helper_BP_C_ReceiveTick)
+// clang-format on
@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_KO_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_KO_classes.hpp"
+#include "../SDK/UI_KO_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KO_C, Construct, "UI_KO_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KO_C, ExecuteUbergraph_UI_KO, "UI_KO_C", "ExecuteUbergraph_UI_KO", SDK::Params::UI_KO_C_ExecuteUbergraph_UI_KO)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KO_C, Get_Score_Text, "UI_KO_C", "Get_Score_Text", SDK::Params::UI_KO_C_Get_Score_Text)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KO_C, GetText, "UI_KO_C", "GetText", SDK::Params::UI_KO_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KO_C, Tick, "UI_KO_C", "Tick", SDK::Params::UI_KO_C_Tick)
+// clang-format on
@@ -0,0 +1,29 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_KeyBinds_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_KeyBinds_classes.hpp"
+#include "../SDK/UI_KeyBinds_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_BackButton_1_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_BackButton_1_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_BackButton_1_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_BackButton_1_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_BackButton_1_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_BackButton_1_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_1_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_1_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_1_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_1_K2Node_ComponentBoundEvent_3_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_1_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_1_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_27_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_27_K2Node_ComponentBoundEvent_5_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_27_K2Node_ComponentBoundEvent_5_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_27_K2Node_ComponentBoundEvent_6_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_27_K2Node_ComponentBoundEvent_6_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_2_K2Node_ComponentBoundEvent_11_OnButtonClickedEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_2_K2Node_ComponentBoundEvent_11_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_2_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_2_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_2_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_2_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, BndEvt__UI_KeyBinds_Button_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature, "UI_KeyBinds_C", "BndEvt__UI_KeyBinds_Button_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, ExecuteUbergraph_UI_KeyBinds, "UI_KeyBinds_C", "ExecuteUbergraph_UI_KeyBinds", SDK::Params::UI_KeyBinds_C_ExecuteUbergraph_UI_KeyBinds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_KeyBinds_C, Tick, "UI_KeyBinds_C", "Tick", SDK::Params::UI_KeyBinds_C_Tick)
+// clang-format on
@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Lose_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Lose_classes.hpp"
+#include "../SDK/UI_Lose_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Lose_C, Construct, "UI_Lose_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Lose_C, ExecuteUbergraph_UI_Lose, "UI_Lose_C", "ExecuteUbergraph_UI_Lose", SDK::Params::UI_Lose_C_ExecuteUbergraph_UI_Lose)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Lose_C, Get_Score_Text, "UI_Lose_C", "Get_Score_Text", SDK::Params::UI_Lose_C_Get_Score_Text)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Lose_C, GetText, "UI_Lose_C", "GetText", SDK::Params::UI_Lose_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Lose_C, Tick, "UI_Lose_C", "Tick", SDK::Params::UI_Lose_C_Tick)
+// clang-format on
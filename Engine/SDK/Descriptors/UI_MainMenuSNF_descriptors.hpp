@@ -0,0 +1,152 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_MainMenuSNF_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_MainMenuSNF_classes.hpp"
+#include "../SDK/UI_MainMenuSNF_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_1_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_1_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_1_K2Node_ComponentBoundEvent_4_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_1_K2Node_ComponentBoundEvent_4_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_261_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_261_K2Node_ComponentBoundEvent_2_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_261_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_261_K2Node_ComponentBoundEvent_5_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_Credit_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_Credit_K2Node_ComponentBoundEvent_8_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_Quit_K2Node_ComponentBoundEvent_6_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_Quit_K2Node_ComponentBoundEvent_6_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__NewWidgetBlueprint_Button_Start_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__NewWidgetBlueprint_Button_Start_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_Button_0_K2Node_ComponentBoundEvent_9_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_Button_0_K2Node_ComponentBoundEvent_9_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_Button_2_K2Node_ComponentBoundEvent_12_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_Button_2_K2Node_ComponentBoundEvent_12_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_Button_K2Node_ComponentBoundEvent_10_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_Button_K2Node_ComponentBoundEvent_10_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_ButtonOptions_K2Node_ComponentBoundEvent_19_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_ButtonOptions_K2Node_ComponentBoundEvent_19_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_ButtonOptions_K2Node_ComponentBoundEvent_20_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_ButtonOptions_K2Node_ComponentBoundEvent_20_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_ButtonOptions_K2Node_ComponentBoundEvent_21_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_ButtonOptions_K2Node_ComponentBoundEvent_21_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_DiscordButton_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_DiscordButton_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_DiscordButton_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_DiscordButton_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_KickstarterButton_K2Node_ComponentBoundEvent_17_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_KickstarterButton_K2Node_ComponentBoundEvent_17_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_KickstarterButton_K2Node_ComponentBoundEvent_18_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_KickstarterButton_K2Node_ComponentBoundEvent_18_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_SteamButton_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_SteamButton_K2Node_ComponentBoundEvent_15_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenu_SteamButton_K2Node_ComponentBoundEvent_16_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenu_SteamButton_K2Node_ComponentBoundEvent_16_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_0_K2Node_ComponentBoundEvent_52_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_0_K2Node_ComponentBoundEvent_52_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_0_K2Node_ComponentBoundEvent_67_OnButtonReleasedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_0_K2Node_ComponentBoundEvent_67_OnButtonReleasedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_GauntletMode_K2Node_ComponentBoundEvent_45_OnButtonReleasedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_GauntletMode_K2Node_ComponentBoundEvent_45_OnButtonReleasedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_1_Gau_K2Node_ComponentBoundEvent_69_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_1_Gau_K2Node_ComponentBoundEvent_69_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_1_Gau_K2Node_ComponentBoundEvent_79_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_1_Gau_K2Node_ComponentBoundEvent_79_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_1_K2Node_ComponentBoundEvent_39_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_1_K2Node_ComponentBoundEvent_39_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_1_K2Node_ComponentBoundEvent_53_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_1_K2Node_ComponentBoundEvent_53_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_2_Gau_K2Node_ComponentBoundEvent_70_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_2_Gau_K2Node_ComponentBoundEvent_70_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_2_Gau_K2Node_ComponentBoundEvent_80_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_2_Gau_K2Node_ComponentBoundEvent_80_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_2_K2Node_ComponentBoundEvent_40_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_2_K2Node_ComponentBoundEvent_40_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_2_K2Node_ComponentBoundEvent_54_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_2_K2Node_ComponentBoundEvent_54_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_3_Gau_K2Node_ComponentBoundEvent_71_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_3_Gau_K2Node_ComponentBoundEvent_71_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_3_Gau_K2Node_ComponentBoundEvent_81_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_3_Gau_K2Node_ComponentBoundEvent_81_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_3_K2Node_ComponentBoundEvent_55_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_3_K2Node_ComponentBoundEvent_55_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_4_Gau_K2Node_ComponentBoundEvent_72_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_4_Gau_K2Node_ComponentBoundEvent_72_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_4_Gau_K2Node_ComponentBoundEvent_82_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_4_Gau_K2Node_ComponentBoundEvent_82_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_4_K2Node_ComponentBoundEvent_42_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_4_K2Node_ComponentBoundEvent_42_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_4_K2Node_ComponentBoundEvent_56_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_4_K2Node_ComponentBoundEvent_56_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_5_Gau_K2Node_ComponentBoundEvent_73_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_5_Gau_K2Node_ComponentBoundEvent_73_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_5_Gau_K2Node_ComponentBoundEvent_83_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_5_Gau_K2Node_ComponentBoundEvent_83_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_5_K2Node_ComponentBoundEvent_43_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_5_K2Node_ComponentBoundEvent_43_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_5_K2Node_ComponentBoundEvent_57_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_5_K2Node_ComponentBoundEvent_57_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_6_Gau_K2Node_ComponentBoundEvent_74_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_6_Gau_K2Node_ComponentBoundEvent_74_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_6_Gau_K2Node_ComponentBoundEvent_84_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_6_Gau_K2Node_ComponentBoundEvent_84_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_6_K2Node_ComponentBoundEvent_46_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_6_K2Node_ComponentBoundEvent_46_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_6_K2Node_ComponentBoundEvent_58_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_6_K2Node_ComponentBoundEvent_58_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_7_Gau_K2Node_ComponentBoundEvent_75_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_7_Gau_K2Node_ComponentBoundEvent_75_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_7_Gau_K2Node_ComponentBoundEvent_85_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_7_Gau_K2Node_ComponentBoundEvent_85_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_7_K2Node_ComponentBoundEvent_49_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_7_K2Node_ComponentBoundEvent_49_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_7_K2Node_ComponentBoundEvent_59_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_7_K2Node_ComponentBoundEvent_59_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_8_Gau_K2Node_ComponentBoundEvent_76_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_8_Gau_K2Node_ComponentBoundEvent_76_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_8_Gau_K2Node_ComponentBoundEvent_86_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_8_Gau_K2Node_ComponentBoundEvent_86_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_8_K2Node_ComponentBoundEvent_52_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_8_K2Node_ComponentBoundEvent_52_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_8_K2Node_ComponentBoundEvent_60_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_8_K2Node_ComponentBoundEvent_60_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_9_Gau_K2Node_ComponentBoundEvent_77_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_9_Gau_K2Node_ComponentBoundEvent_77_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_9_Gau_K2Node_ComponentBoundEvent_87_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_9_Gau_K2Node_ComponentBoundEvent_87_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_9_K2Node_ComponentBoundEvent_64_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_9_K2Node_ComponentBoundEvent_64_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Button_Rank_K2Node_ComponentBoundEvent_41_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Button_Rank_K2Node_ComponentBoundEvent_41_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_ButtonFreeMode_K2Node_ComponentBoundEvent_46_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_ButtonFreeMode_K2Node_ComponentBoundEvent_46_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_ButtonFreeMode_K2Node_ComponentBoundEvent_48_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_ButtonFreeMode_K2Node_ComponentBoundEvent_48_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_ButtonFreeMode_K2Node_ComponentBoundEvent_49_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_ButtonFreeMode_K2Node_ComponentBoundEvent_49_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction1_1_K2Node_ComponentBoundEvent_27_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction1_1_K2Node_ComponentBoundEvent_27_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction1_2_K2Node_ComponentBoundEvent_26_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction1_2_K2Node_ComponentBoundEvent_26_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction1_3_K2Node_ComponentBoundEvent_25_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction1_3_K2Node_ComponentBoundEvent_25_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction1_K2Node_ComponentBoundEvent_23_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction1_K2Node_ComponentBoundEvent_23_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction1_K2Node_ComponentBoundEvent_24_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction1_K2Node_ComponentBoundEvent_24_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction1_K2Node_ComponentBoundEvent_28_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction1_K2Node_ComponentBoundEvent_28_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction1_K2Node_ComponentBoundEvent_51_OnButtonReleasedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction1_K2Node_ComponentBoundEvent_51_OnButtonReleasedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction2_K2Node_ComponentBoundEvent_37_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction2_K2Node_ComponentBoundEvent_37_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction2_K2Node_ComponentBoundEvent_38_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction2_K2Node_ComponentBoundEvent_38_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction2_K2Node_ComponentBoundEvent_61_OnButtonReleasedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction2_K2Node_ComponentBoundEvent_61_OnButtonReleasedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction3_K2Node_ComponentBoundEvent_35_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction3_K2Node_ComponentBoundEvent_35_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction3_K2Node_ComponentBoundEvent_36_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction3_K2Node_ComponentBoundEvent_36_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction3_K2Node_ComponentBoundEvent_62_OnButtonReleasedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction3_K2Node_ComponentBoundEvent_62_OnButtonReleasedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction4_K2Node_ComponentBoundEvent_33_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction4_K2Node_ComponentBoundEvent_33_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction4_K2Node_ComponentBoundEvent_34_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction4_K2Node_ComponentBoundEvent_34_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_Faction4_K2Node_ComponentBoundEvent_63_OnButtonReleasedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_Faction4_K2Node_ComponentBoundEvent_63_OnButtonReleasedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_ImSecret_K2Node_ComponentBoundEvent_42_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_ImSecret_K2Node_ComponentBoundEvent_42_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandArmourButton_Free_K2Node_ComponentBoundEvent_88_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandArmourButton_Free_K2Node_ComponentBoundEvent_88_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandArmourButton_Free_K2Node_ComponentBoundEvent_89_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandArmourButton_Free_K2Node_ComponentBoundEvent_89_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandArmourButton_Free_K2Node_ComponentBoundEvent_90_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandArmourButton_Free_K2Node_ComponentBoundEvent_90_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandArmourButton_K2Node_ComponentBoundEvent_11_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandArmourButton_K2Node_ComponentBoundEvent_11_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandArmourButton_K2Node_ComponentBoundEvent_29_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandArmourButton_K2Node_ComponentBoundEvent_29_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandArmourButton_K2Node_ComponentBoundEvent_30_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandArmourButton_K2Node_ComponentBoundEvent_30_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandBodyButton_K2Node_ComponentBoundEvent_65_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandBodyButton_K2Node_ComponentBoundEvent_65_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandBodyButton_K2Node_ComponentBoundEvent_66_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandBodyButton_K2Node_ComponentBoundEvent_66_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandWeaponButton_K2Node_ComponentBoundEvent_22_OnButtonClickedEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandWeaponButton_K2Node_ComponentBoundEvent_22_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandWeaponButton_K2Node_ComponentBoundEvent_31_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandWeaponButton_K2Node_ComponentBoundEvent_31_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, BndEvt__UI_MainMenuSNF_RandWeaponButton_K2Node_ComponentBoundEvent_32_OnButtonHoverEvent__DelegateSignature, "UI_MainMenuSNF_C", "BndEvt__UI_MainMenuSNF_RandWeaponButton_K2Node_ComponentBoundEvent_32_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Check_Snap_Neck_Event, "UI_MainMenuSNF_C", "Check Snap Neck Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Construct, "UI_MainMenuSNF_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Enter_Gauntlet_Mode_Event, "UI_MainMenuSNF_C", "Enter Gauntlet Mode Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, ExecuteUbergraph_UI_MainMenuSNF, "UI_MainMenuSNF_C", "ExecuteUbergraph_UI_MainMenuSNF", SDK::Params::UI_MainMenuSNF_C_ExecuteUbergraph_UI_MainMenuSNF)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Free_Mode_Text_Visibility, "UI_MainMenuSNF_C", "Free_Mode_Text_Visibility", SDK::Params::UI_MainMenuSNF_C_Free_Mode_Text_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_GauntletMode_Visibility, "UI_MainMenuSNF_C", "Get_Button_GauntletMode_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_GauntletMode_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_1_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_1_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_1_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_1_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_1_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_1_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_2_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_2_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_2_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_2_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_2_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_2_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_3_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_3_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_3_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_3_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_3_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_3_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_4_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_4_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_4_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_4_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_4_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_4_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_5_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_5_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_5_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_5_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_5_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_5_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_6_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_6_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_6_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_6_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_6_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_6_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_7_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_7_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_7_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_7_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_7_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_7_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_8_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_8_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_8_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_8_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_8_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_8_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_9_Gau_bIsEnabled, "UI_MainMenuSNF_C", "Get_Button_Rank_9_Gau_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_9_Gau_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Button_Rank_9_Visibility, "UI_MainMenuSNF_C", "Get_Button_Rank_9_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_Button_Rank_9_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_Faction1_bIsEnabled, "UI_MainMenuSNF_C", "Get_Faction1_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_Faction1_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_FactionBonusText_Text, "UI_MainMenuSNF_C", "Get_FactionBonusText_Text", SDK::Params::UI_MainMenuSNF_C_Get_FactionBonusText_Text)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_FactionText_Visibility, "UI_MainMenuSNF_C", "Get_FactionText_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_FactionText_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_PortraitImage_1_Brush, "UI_MainMenuSNF_C", "Get_PortraitImage_1_Brush", SDK::Params::UI_MainMenuSNF_C_Get_PortraitImage_1_Brush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_PortraitImage_Brush, "UI_MainMenuSNF_C", "Get_PortraitImage_Brush", SDK::Params::UI_MainMenuSNF_C_Get_PortraitImage_Brush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_RandArmourButton_Cost_1_bIsEnabled, "UI_MainMenuSNF_C", "Get_RandArmourButton_Cost_1_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_RandArmourButton_Cost_1_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_RandArmourButton_Free_Visibility, "UI_MainMenuSNF_C", "Get_RandArmourButton_Free_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_RandArmourButton_Free_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_RandArmourButton_Visibility, "UI_MainMenuSNF_C", "Get_RandArmourButton_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_RandArmourButton_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_RandBodyButton_bIsEnabled, "UI_MainMenuSNF_C", "Get_RandBodyButton_bIsEnabled", SDK::Params::UI_MainMenuSNF_C_Get_RandBodyButton_bIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_RandBodyButton_Visibility, "UI_MainMenuSNF_C", "Get_RandBodyButton_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_RandBodyButton_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_RankProgress_Percent, "UI_MainMenuSNF_C", "Get_RankProgress_Percent", SDK::Params::UI_MainMenuSNF_C_Get_RankProgress_Percent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_RankProgressText_2_Text, "UI_MainMenuSNF_C", "Get_RankProgressText_2_Text", SDK::Params::UI_MainMenuSNF_C_Get_RankProgressText_2_Text)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_RankProgressText_Text, "UI_MainMenuSNF_C", "Get_RankProgressText_Text", SDK::Params::UI_MainMenuSNF_C_Get_RankProgressText_Text)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Get_TextFreeMode_1_Visibility, "UI_MainMenuSNF_C", "Get_TextFreeMode_1_Visibility", SDK::Params::UI_MainMenuSNF_C_Get_TextFreeMode_1_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, GetText, "UI_MainMenuSNF_C", "GetText", SDK::Params::UI_MainMenuSNF_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, GetVisibility_0, "UI_MainMenuSNF_C", "GetVisibility_0", SDK::Params::UI_MainMenuSNF_C_GetVisibility_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Go_To_Free_Mode_Event, "UI_MainMenuSNF_C", "Go To Free Mode Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Initialize_New_Gauntlet_Character, "UI_MainMenuSNF_C", "Initialize New Gauntlet Character", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Mouse_Button_Down_Event, "UI_MainMenuSNF_C", "Mouse Button Down Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Mouse_Button_Up_Event, "UI_MainMenuSNF_C", "Mouse Button Up Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, OnMouseButtonDown, "UI_MainMenuSNF_C", "OnMouseButtonDown", SDK::Params::UI_MainMenuSNF_C_OnMouseButtonDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, OnMouseButtonUp, "UI_MainMenuSNF_C", "OnMouseButtonUp", SDK::Params::UI_MainMenuSNF_C_OnMouseButtonUp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Pick_Gauntlet_Character_Event, "UI_MainMenuSNF_C", "Pick Gauntlet Character Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Random_Armor_Event, "UI_MainMenuSNF_C", "Random Armor Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Switch_Mode_Event, "UI_MainMenuSNF_C", "Switch Mode Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_MainMenuSNF_C, Tick, "UI_MainMenuSNF_C", "Tick", SDK::Params::UI_MainMenuSNF_C_Tick)
+// clang-format on
@@ -0,0 +1,137 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_PhotoMode_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_PhotoMode_classes.hpp"
+#include "../SDK/UI_PhotoMode_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ActiveTab, "UI_PhotoMode_C", "ActiveTab", SDK::Params::UI_PhotoMode_C_ActiveTab)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BlockScreenshot, "UI_PhotoMode_C", "BlockScreenshot", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Aperture_K2Node_ComponentBoundEvent_33_OnOptionChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Aperture_K2Node_ComponentBoundEvent_33_OnOptionChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Aperture_K2Node_ComponentBoundEvent_33_OnOptionChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Autofocus_K2Node_ComponentBoundEvent_5_OnCheckboxValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Autofocus_K2Node_ComponentBoundEvent_5_OnCheckboxValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Autofocus_K2Node_ComponentBoundEvent_5_OnCheckboxValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__BlueCorrection_K2Node_ComponentBoundEvent_4_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__BlueCorrection_K2Node_ComponentBoundEvent_4_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__BlueCorrection_K2Node_ComponentBoundEvent_4_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Brightness_K2Node_ComponentBoundEvent_3_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Brightness_K2Node_ComponentBoundEvent_3_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Brightness_K2Node_ComponentBoundEvent_3_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__CameraDistance_K2Node_ComponentBoundEvent_6_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__CameraDistance_K2Node_ComponentBoundEvent_6_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__CameraDistance_K2Node_ComponentBoundEvent_6_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__CameraRoll_K2Node_ComponentBoundEvent_7_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__CameraRoll_K2Node_ComponentBoundEvent_7_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__CameraRoll_K2Node_ComponentBoundEvent_7_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__CharacterRotation_K2Node_ComponentBoundEvent_3_OnCheckboxValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__CharacterRotation_K2Node_ComponentBoundEvent_3_OnCheckboxValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__CharacterRotation_K2Node_ComponentBoundEvent_3_OnCheckboxValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__ChromaticAberrationIntensity_K2Node_ComponentBoundEvent_10_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__ChromaticAberrationIntensity_K2Node_ComponentBoundEvent_10_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__ChromaticAberrationIntensity_K2Node_ComponentBoundEvent_10_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__ChromaticAberrationOffset_K2Node_ComponentBoundEvent_11_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__ChromaticAberrationOffset_K2Node_ComponentBoundEvent_11_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__ChromaticAberrationOffset_K2Node_ComponentBoundEvent_11_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__ColorBalanceBlue_K2Node_ComponentBoundEvent_15_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__ColorBalanceBlue_K2Node_ComponentBoundEvent_15_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__ColorBalanceBlue_K2Node_ComponentBoundEvent_15_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__ColorBalanceGreen_K2Node_ComponentBoundEvent_16_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__ColorBalanceGreen_K2Node_ComponentBoundEvent_16_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__ColorBalanceGreen_K2Node_ComponentBoundEvent_16_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__ColorBalanceIntensity_K2Node_ComponentBoundEvent_17_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__ColorBalanceIntensity_K2Node_ComponentBoundEvent_17_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__ColorBalanceIntensity_K2Node_ComponentBoundEvent_17_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__ColorBalanceRed_K2Node_ComponentBoundEvent_18_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__ColorBalanceRed_K2Node_ComponentBoundEvent_18_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__ColorBalanceRed_K2Node_ComponentBoundEvent_18_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__ColorBalanceSelector_K2Node_ComponentBoundEvent_0_ResetDispatcher__DelegateSignature, "UI_PhotoMode_C", "BndEvt__ColorBalanceSelector_K2Node_ComponentBoundEvent_0_ResetDispatcher__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__ColorBalanceSelector_K2Node_ComponentBoundEvent_32_OnOptionChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__ColorBalanceSelector_K2Node_ComponentBoundEvent_32_OnOptionChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__ColorBalanceSelector_K2Node_ComponentBoundEvent_32_OnOptionChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_Album_K2Node_ComponentBoundEvent_1_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_Album_K2Node_ComponentBoundEvent_1_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_ChangeTab_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_ChangeTab_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_Close_K2Node_ComponentBoundEvent_7_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_Close_K2Node_ComponentBoundEvent_7_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_Down_K2Node_ComponentBoundEvent_1_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_Down_K2Node_ComponentBoundEvent_1_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_FreeCamera_K2Node_ComponentBoundEvent_4_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_FreeCamera_K2Node_ComponentBoundEvent_4_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_HideUI_K2Node_ComponentBoundEvent_6_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_HideUI_K2Node_ComponentBoundEvent_6_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_Left_K2Node_ComponentBoundEvent_2_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_Left_K2Node_ComponentBoundEvent_2_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_Mouse_K2Node_ComponentBoundEvent_3_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_Mouse_K2Node_ComponentBoundEvent_3_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_Reset_K2Node_ComponentBoundEvent_5_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_Reset_K2Node_ComponentBoundEvent_5_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_Right_K2Node_ComponentBoundEvent_3_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_Right_K2Node_ComponentBoundEvent_3_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Command_Up_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Command_Up_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__CommandButton_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature, "UI_PhotoMode_C", "BndEvt__CommandButton_K2Node_ComponentBoundEvent_0_OnPressed__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__FieldOfView_K2Node_ComponentBoundEvent_8_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__FieldOfView_K2Node_ComponentBoundEvent_8_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__FieldOfView_K2Node_ComponentBoundEvent_8_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__FilmGrain_K2Node_ComponentBoundEvent_12_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__FilmGrain_K2Node_ComponentBoundEvent_12_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__FilmGrain_K2Node_ComponentBoundEvent_12_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Filter_K2Node_ComponentBoundEvent_31_OnOptionChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Filter_K2Node_ComponentBoundEvent_31_OnOptionChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Filter_K2Node_ComponentBoundEvent_31_OnOptionChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__FocusDistance_K2Node_ComponentBoundEvent_1_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__FocusDistance_K2Node_ComponentBoundEvent_1_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__FocusDistance_K2Node_ComponentBoundEvent_1_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__FrameBlue_K2Node_ComponentBoundEvent_19_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__FrameBlue_K2Node_ComponentBoundEvent_19_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__FrameBlue_K2Node_ComponentBoundEvent_19_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__FrameGreen_K2Node_ComponentBoundEvent_20_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__FrameGreen_K2Node_ComponentBoundEvent_20_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__FrameGreen_K2Node_ComponentBoundEvent_20_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__FrameRed_K2Node_ComponentBoundEvent_21_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__FrameRed_K2Node_ComponentBoundEvent_21_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__FrameRed_K2Node_ComponentBoundEvent_21_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__FrameSelector_K2Node_ComponentBoundEvent_29_OnOptionChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__FrameSelector_K2Node_ComponentBoundEvent_29_OnOptionChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__FrameSelector_K2Node_ComponentBoundEvent_29_OnOptionChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__FrameSize_K2Node_ComponentBoundEvent_22_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__FrameSize_K2Node_ComponentBoundEvent_22_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__FrameSize_K2Node_ComponentBoundEvent_22_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Grid_K2Node_ComponentBoundEvent_6_OnCheckboxValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Grid_K2Node_ComponentBoundEvent_6_OnCheckboxValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Grid_K2Node_ComponentBoundEvent_6_OnCheckboxValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__HideCharacter_K2Node_ComponentBoundEvent_4_OnCheckboxValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__HideCharacter_K2Node_ComponentBoundEvent_4_OnCheckboxValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__HideCharacter_K2Node_ComponentBoundEvent_4_OnCheckboxValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__LogoAngle_K2Node_ComponentBoundEvent_23_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__LogoAngle_K2Node_ComponentBoundEvent_23_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__LogoAngle_K2Node_ComponentBoundEvent_23_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__LogoHorizontalAlignment_K2Node_ComponentBoundEvent_24_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__LogoHorizontalAlignment_K2Node_ComponentBoundEvent_24_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__LogoHorizontalAlignment_K2Node_ComponentBoundEvent_24_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__LogoSelector_K2Node_ComponentBoundEvent_27_OnOptionChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__LogoSelector_K2Node_ComponentBoundEvent_27_OnOptionChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__LogoSelector_K2Node_ComponentBoundEvent_27_OnOptionChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__LogoSize_K2Node_ComponentBoundEvent_25_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__LogoSize_K2Node_ComponentBoundEvent_25_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__LogoSize_K2Node_ComponentBoundEvent_25_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__LogoVerticalAlignment_K2Node_ComponentBoundEvent_26_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__LogoVerticalAlignment_K2Node_ComponentBoundEvent_26_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__LogoVerticalAlignment_K2Node_ComponentBoundEvent_26_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__LUTIntensity_K2Node_ComponentBoundEvent_9_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__LUTIntensity_K2Node_ComponentBoundEvent_9_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__LUTIntensity_K2Node_ComponentBoundEvent_9_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__MotionBlur_K2Node_ComponentBoundEvent_13_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__MotionBlur_K2Node_ComponentBoundEvent_13_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__MotionBlur_K2Node_ComponentBoundEvent_13_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__PhotoResolution_K2Node_ComponentBoundEvent_28_OnOptionChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__PhotoResolution_K2Node_ComponentBoundEvent_28_OnOptionChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__PhotoResolution_K2Node_ComponentBoundEvent_28_OnOptionChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Rendering_K2Node_ComponentBoundEvent_30_OnOptionChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Rendering_K2Node_ComponentBoundEvent_30_OnOptionChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Rendering_K2Node_ComponentBoundEvent_30_OnOptionChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__SensorWidth_K2Node_ComponentBoundEvent_5_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__SensorWidth_K2Node_ComponentBoundEvent_5_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__SensorWidth_K2Node_ComponentBoundEvent_5_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Slider_SimplifiedContrast_K2Node_ComponentBoundEvent_1_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Slider_SimplifiedContrast_K2Node_ComponentBoundEvent_1_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Slider_SimplifiedContrast_K2Node_ComponentBoundEvent_1_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Slider_SimplifiedGamma_K2Node_ComponentBoundEvent_2_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Slider_SimplifiedGamma_K2Node_ComponentBoundEvent_2_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Slider_SimplifiedGamma_K2Node_ComponentBoundEvent_2_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Slider_SimplifiedSaturation_K2Node_ComponentBoundEvent_0_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Slider_SimplifiedSaturation_K2Node_ComponentBoundEvent_0_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Slider_SimplifiedSaturation_K2Node_ComponentBoundEvent_0_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Temperature_K2Node_ComponentBoundEvent_0_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Temperature_K2Node_ComponentBoundEvent_0_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Temperature_K2Node_ComponentBoundEvent_0_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Tint_K2Node_ComponentBoundEvent_2_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Tint_K2Node_ComponentBoundEvent_2_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Tint_K2Node_ComponentBoundEvent_2_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, BndEvt__Vignette_K2Node_ComponentBoundEvent_14_OnSliderValueChanged__DelegateSignature, "UI_PhotoMode_C", "BndEvt__Vignette_K2Node_ComponentBoundEvent_14_OnSliderValueChanged__DelegateSignature", SDK::Params::UI_PhotoMode_C_BndEvt__Vignette_K2Node_ComponentBoundEvent_14_OnSliderValueChanged__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, CameraDistanceMouseWheel, "UI_PhotoMode_C", "CameraDistanceMouseWheel", SDK::Params::UI_PhotoMode_C_CameraDistanceMouseWheel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, CameraLeftRight, "UI_PhotoMode_C", "CameraLeftRight", SDK::Params::UI_PhotoMode_C_CameraLeftRight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, CameraModeTxt, "UI_PhotoMode_C", "CameraModeTxt", SDK::Params::UI_PhotoMode_C_CameraModeTxt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, CameraUpDown, "UI_PhotoMode_C", "CameraUpDown", SDK::Params::UI_PhotoMode_C_CameraUpDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ChangeFreeCameraFOV, "UI_PhotoMode_C", "ChangeFreeCameraFOV", SDK::Params::UI_PhotoMode_C_ChangeFreeCameraFOV)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ChangeFreeCameraRotation, "UI_PhotoMode_C", "ChangeFreeCameraRotation", SDK::Params::UI_PhotoMode_C_ChangeFreeCameraRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ChangeTab, "UI_PhotoMode_C", "ChangeTab", SDK::Params::UI_PhotoMode_C_ChangeTab)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, CloseFreeCamera, "UI_PhotoMode_C", "CloseFreeCamera", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Construct, "UI_PhotoMode_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Dispatchers, "UI_PhotoMode_C", "Dispatchers", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ExecuteUbergraph_UI_PhotoMode, "UI_PhotoMode_C", "ExecuteUbergraph_UI_PhotoMode", SDK::Params::UI_PhotoMode_C_ExecuteUbergraph_UI_PhotoMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Focus, "UI_PhotoMode_C", "Focus", SDK::Params::UI_PhotoMode_C_Focus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, FocusDistanceVisibility, "UI_PhotoMode_C", "FocusDistanceVisibility", SDK::Params::UI_PhotoMode_C_FocusDistanceVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, FreeCameraButtonVisibility, "UI_PhotoMode_C", "FreeCameraButtonVisibility", SDK::Params::UI_PhotoMode_C_FreeCameraButtonVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Get_Focus_Region_Visibility, "UI_PhotoMode_C", "Get Focus Region Visibility", SDK::Params::UI_PhotoMode_C_Get_Focus_Region_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Get_Photo_Resolution, "UI_PhotoMode_C", "Get Photo Resolution", SDK::Params::UI_PhotoMode_C_Get_Photo_Resolution)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, getAdjustedWorldDeltaSeconds, "UI_PhotoMode_C", "getAdjustedWorldDeltaSeconds", SDK::Params::UI_PhotoMode_C_getAdjustedWorldDeltaSeconds)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, GetAnyKey, "UI_PhotoMode_C", "GetAnyKey", SDK::Params::UI_PhotoMode_C_GetAnyKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, GetFocusDistance, "UI_PhotoMode_C", "GetFocusDistance", SDK::Params::UI_PhotoMode_C_GetFocusDistance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, getScreenshotTitle, "UI_PhotoMode_C", "getScreenshotTitle", SDK::Params::UI_PhotoMode_C_getScreenshotTitle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, GridVisibility, "UI_PhotoMode_C", "GridVisibility", SDK::Params::UI_PhotoMode_C_GridVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, HideMenu, "UI_PhotoMode_C", "HideMenu", SDK::Params::UI_PhotoMode_C_HideMenu)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Initialize, "UI_PhotoMode_C", "Initialize", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, InterpolationUpdater, "UI_PhotoMode_C", "InterpolationUpdater", SDK::Params::UI_PhotoMode_C_InterpolationUpdater)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, LeftRightCameraGamepadVisibility, "UI_PhotoMode_C", "LeftRightCameraGamepadVisibility", SDK::Params::UI_PhotoMode_C_LeftRightCameraGamepadVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, MakeRegister, "UI_PhotoMode_C", "MakeRegister", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, MakeScreenshot, "UI_PhotoMode_C", "MakeScreenshot", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, MakeScreenshotRender, "UI_PhotoMode_C", "MakeScreenshotRender", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, MakeThumbnail, "UI_PhotoMode_C", "MakeThumbnail", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, MoveButtonVisibility, "UI_PhotoMode_C", "MoveButtonVisibility", SDK::Params::UI_PhotoMode_C_MoveButtonVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnCameraMoved, "UI_PhotoMode_C", "OnCameraMoved", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnCameraStopped, "UI_PhotoMode_C", "OnCameraStopped", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnDestruct, "UI_PhotoMode_C", "OnDestruct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnFreeCameraStart, "UI_PhotoMode_C", "OnFreeCameraStart", SDK::Params::UI_PhotoMode_C_OnFreeCameraStart)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnFreenCameraEnd, "UI_PhotoMode_C", "OnFreenCameraEnd", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnKeyDown, "UI_PhotoMode_C", "OnKeyDown", SDK::Params::UI_PhotoMode_C_OnKeyDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnLoaded_82A7579942174F38FE2AD9A2E247AA34, "UI_PhotoMode_C", "OnLoaded_82A7579942174F38FE2AD9A2E247AA34", SDK::Params::UI_PhotoMode_C_OnLoaded_82A7579942174F38FE2AD9A2E247AA34)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnMouseButtonDoubleClick, "UI_PhotoMode_C", "OnMouseButtonDoubleClick", SDK::Params::UI_PhotoMode_C_OnMouseButtonDoubleClick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnMouseButtonDown, "UI_PhotoMode_C", "OnMouseButtonDown", SDK::Params::UI_PhotoMode_C_OnMouseButtonDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnMouseEnter, "UI_PhotoMode_C", "OnMouseEnter", SDK::Params::UI_PhotoMode_C_OnMouseEnter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnMouseLeave, "UI_PhotoMode_C", "OnMouseLeave", SDK::Params::UI_PhotoMode_C_OnMouseLeave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnMouseMove, "UI_PhotoMode_C", "OnMouseMove", SDK::Params::UI_PhotoMode_C_OnMouseMove)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnMouseWheel, "UI_PhotoMode_C", "OnMouseWheel", SDK::Params::UI_PhotoMode_C_OnMouseWheel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OnRemovedFromFocusPath, "UI_PhotoMode_C", "OnRemovedFromFocusPath", SDK::Params::UI_PhotoMode_C_OnRemovedFromFocusPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OpenFreeCamera, "UI_PhotoMode_C", "OpenFreeCamera", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, OpenGalleryButtonVisibility, "UI_PhotoMode_C", "OpenGalleryButtonVisibility", SDK::Params::UI_PhotoMode_C_OpenGalleryButtonVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, PreConstruct, "UI_PhotoMode_C", "PreConstruct", SDK::Params::UI_PhotoMode_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Register_Photo, "UI_PhotoMode_C", "Register Photo", SDK::Params::UI_PhotoMode_C_Register_Photo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, RemoveMaterialFromCamera, "UI_PhotoMode_C", "RemoveMaterialFromCamera", SDK::Params::UI_PhotoMode_C_RemoveMaterialFromCamera)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ResetKeyboardIcons, "UI_PhotoMode_C", "ResetKeyboardIcons", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ResetShowMouseCursor, "UI_PhotoMode_C", "ResetShowMouseCursor", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Screenshot, "UI_PhotoMode_C", "Screenshot", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, SendPhotoData, "UI_PhotoMode_C", "SendPhotoData", SDK::Params::UI_PhotoMode_C_SendPhotoData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Set_Focus_Distance, "UI_PhotoMode_C", "Set Focus Distance", SDK::Params::UI_PhotoMode_C_Set_Focus_Distance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, SetFocusBasedOnTab, "UI_PhotoMode_C", "SetFocusBasedOnTab", SDK::Params::UI_PhotoMode_C_SetFocusBasedOnTab)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, SetFocusOnClick, "UI_PhotoMode_C", "SetFocusOnClick", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, SetMenuIcons, "UI_PhotoMode_C", "SetMenuIcons", SDK::Params::UI_PhotoMode_C_SetMenuIcons)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ShowHideCharacterRotation, "UI_PhotoMode_C", "ShowHideCharacterRotation", SDK::Params::UI_PhotoMode_C_ShowHideCharacterRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ShowHideMouseButtonVisibility, "UI_PhotoMode_C", "ShowHideMouseButtonVisibility", SDK::Params::UI_PhotoMode_C_ShowHideMouseButtonVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ShowHideMouseTxtButton, "UI_PhotoMode_C", "ShowHideMouseTxtButton", SDK::Params::UI_PhotoMode_C_ShowHideMouseTxtButton)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ShowHidePhotoModeIsOnWarning, "UI_PhotoMode_C", "ShowHidePhotoModeIsOnWarning", SDK::Params::UI_PhotoMode_C_ShowHidePhotoModeIsOnWarning)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, ShowMouse, "UI_PhotoMode_C", "ShowMouse", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, SwapOptionGamepadVisibility, "UI_PhotoMode_C", "SwapOptionGamepadVisibility", SDK::Params::UI_PhotoMode_C_SwapOptionGamepadVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, TabToOpen, "UI_PhotoMode_C", "TabToOpen", SDK::Params::UI_PhotoMode_C_TabToOpen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, TakePictureButtonVisibility, "UI_PhotoMode_C", "TakePictureButtonVisibility", SDK::Params::UI_PhotoMode_C_TakePictureButtonVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Tick, "UI_PhotoMode_C", "Tick", SDK::Params::UI_PhotoMode_C_Tick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Up_Down_Left_Right_Buttons_Visibility, "UI_PhotoMode_C", "Up Down Left Right Buttons Visibility", SDK::Params::UI_PhotoMode_C_Up_Down_Left_Right_Buttons_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, Update_Logo_Color, "UI_PhotoMode_C", "Update Logo Color", SDK::Params::UI_PhotoMode_C_Update_Logo_Color)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoMode_C, UpDownCameraGamepadVisibility, "UI_PhotoMode_C", "UpDownCameraGamepadVisibility", SDK::Params::UI_PhotoMode_C_UpDownCameraGamepadVisibility)
+// clang-format on
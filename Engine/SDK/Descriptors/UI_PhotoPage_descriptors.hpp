@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_PhotoPage_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_PhotoPage_classes.hpp"
+#include "../SDK/UI_PhotoPage_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoPage_C, Construct, "UI_PhotoPage_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoPage_C, ExecuteUbergraph_UI_PhotoPage, "UI_PhotoPage_C", "ExecuteUbergraph_UI_PhotoPage", SDK::Params::UI_PhotoPage_C_ExecuteUbergraph_UI_PhotoPage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoPage_C, Initialize, "UI_PhotoPage_C", "Initialize", SDK::Params::UI_PhotoPage_C_Initialize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoPage_C, PreConstruct, "UI_PhotoPage_C", "PreConstruct", SDK::Params::UI_PhotoPage_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoPage_C, ResetPage, "UI_PhotoPage_C", "ResetPage", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoPage_C, Tick, "UI_PhotoPage_C", "Tick", SDK::Params::UI_PhotoPage_C_Tick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoPage_C, UpdatePage, "UI_PhotoPage_C", "UpdatePage", void)
+// clang-format on
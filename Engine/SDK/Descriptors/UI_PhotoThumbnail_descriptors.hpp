@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_PhotoThumbnail_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_PhotoThumbnail_classes.hpp"
+#include "../SDK/UI_PhotoThumbnail_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, Animation, "UI_PhotoThumbnail_C", "Animation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, BndEvt__ButtonPhoto_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_PhotoThumbnail_C", "BndEvt__ButtonPhoto_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, DeleteData, "UI_PhotoThumbnail_C", "DeleteData", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, Destruct, "UI_PhotoThumbnail_C", "Destruct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, Edges_Visibility, "UI_PhotoThumbnail_C", "Edges Visibility", SDK::Params::UI_PhotoThumbnail_C_Edges_Visibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, ExecuteUbergraph_UI_PhotoThumbnail, "UI_PhotoThumbnail_C", "ExecuteUbergraph_UI_PhotoThumbnail", SDK::Params::UI_PhotoThumbnail_C_ExecuteUbergraph_UI_PhotoThumbnail)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, FrameFocusedAndUnfocusedColor, "UI_PhotoThumbnail_C", "FrameFocusedAndUnfocusedColor", SDK::Params::UI_PhotoThumbnail_C_FrameFocusedAndUnfocusedColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, Initialize, "UI_PhotoThumbnail_C", "Initialize", SDK::Params::UI_PhotoThumbnail_C_Initialize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, PreConstruct, "UI_PhotoThumbnail_C", "PreConstruct", SDK::Params::UI_PhotoThumbnail_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, ResetThumb, "UI_PhotoThumbnail_C", "ResetThumb", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, ResetThumbAnimation, "UI_PhotoThumbnail_C", "ResetThumbAnimation", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, SetPhotoData, "UI_PhotoThumbnail_C", "SetPhotoData", SDK::Params::UI_PhotoThumbnail_C_SetPhotoData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_PhotoThumbnail_C, UpdatePhoto, "UI_PhotoThumbnail_C", "UpdatePhoto", void)
+// clang-format on
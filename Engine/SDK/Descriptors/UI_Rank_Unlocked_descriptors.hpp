@@ -0,0 +1,22 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Rank_Unlocked_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Rank_Unlocked_classes.hpp"
+#include "../SDK/UI_Rank_Unlocked_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, Construct, "UI_Rank_Unlocked_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, ExecuteUbergraph_UI_Rank_Unlocked, "UI_Rank_Unlocked_C", "ExecuteUbergraph_UI_Rank_Unlocked", SDK::Params::UI_Rank_Unlocked_C_ExecuteUbergraph_UI_Rank_Unlocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, GetBrush, "UI_Rank_Unlocked_C", "GetBrush", SDK::Params::UI_Rank_Unlocked_C_GetBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, GetPercent, "UI_Rank_Unlocked_C", "GetPercent", SDK::Params::UI_Rank_Unlocked_C_GetPercent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, GetText, "UI_Rank_Unlocked_C", "GetText", SDK::Params::UI_Rank_Unlocked_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, GetText_0, "UI_Rank_Unlocked_C", "GetText_0", SDK::Params::UI_Rank_Unlocked_C_GetText_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, GetText_1, "UI_Rank_Unlocked_C", "GetText_1", SDK::Params::UI_Rank_Unlocked_C_GetText_1)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, GetVisibility_0, "UI_Rank_Unlocked_C", "GetVisibility_0", SDK::Params::UI_Rank_Unlocked_C_GetVisibility_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, PreConstruct, "UI_Rank_Unlocked_C", "PreConstruct", SDK::Params::UI_Rank_Unlocked_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Rank_Unlocked_C, Tick, "UI_Rank_Unlocked_C", "Tick", SDK::Params::UI_Rank_Unlocked_C_Tick)
+// clang-format on
@@ -0,0 +1,41 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Selector_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Selector_classes.hpp"
+#include "../SDK/UI_Selector_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, AddOption, "UI_Selector_C", "AddOption", SDK::Params::UI_Selector_C_AddOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, AddOptions_Name_, "UI_Selector_C", "AddOptions(Name)", SDK::Params::UI_Selector_C_AddOptions_Name_)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, AddOptions_String_, "UI_Selector_C", "AddOptions(String)", SDK::Params::UI_Selector_C_AddOptions_String_)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, AddOptions_Text_, "UI_Selector_C", "AddOptions(Text)", SDK::Params::UI_Selector_C_AddOptions_Text_)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, BndEvt__btn_left_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_Selector_C", "BndEvt__btn_left_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, BndEvt__btn_right_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_Selector_C", "BndEvt__btn_right_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, BndEvt__Slider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature, "UI_Selector_C", "BndEvt__Slider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_Selector_C_BndEvt__Slider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, ChangeValue, "UI_Selector_C", "ChangeValue", SDK::Params::UI_Selector_C_ChangeValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, ClearOptions, "UI_Selector_C", "ClearOptions", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, Construct, "UI_Selector_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, ExecuteUbergraph_UI_Selector, "UI_Selector_C", "ExecuteUbergraph_UI_Selector", SDK::Params::UI_Selector_C_ExecuteUbergraph_UI_Selector)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, FocusThisWidget, "UI_Selector_C", "FocusThisWidget", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, FocusWithMouseWheel, "UI_Selector_C", "FocusWithMouseWheel", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, getFocusedOrUnfocusedColor, "UI_Selector_C", "getFocusedOrUnfocusedColor", SDK::Params::UI_Selector_C_getFocusedOrUnfocusedColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, getLeftButtonSettings, "UI_Selector_C", "getLeftButtonSettings", SDK::Params::UI_Selector_C_getLeftButtonSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, getRightButtonSettings, "UI_Selector_C", "getRightButtonSettings", SDK::Params::UI_Selector_C_getRightButtonSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, GetSelectedOption, "UI_Selector_C", "GetSelectedOption", SDK::Params::UI_Selector_C_GetSelectedOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, getTxtValue, "UI_Selector_C", "getTxtValue", SDK::Params::UI_Selector_C_getTxtValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, OnMouseButtonDoubleClick, "UI_Selector_C", "OnMouseButtonDoubleClick", SDK::Params::UI_Selector_C_OnMouseButtonDoubleClick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, OnMouseEnter, "UI_Selector_C", "OnMouseEnter", SDK::Params::UI_Selector_C_OnMouseEnter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, OnMouseLeave, "UI_Selector_C", "OnMouseLeave", SDK::Params::UI_Selector_C_OnMouseLeave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, OnMouseWheel, "UI_Selector_C", "OnMouseWheel", SDK::Params::UI_Selector_C_OnMouseWheel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, PreConstruct, "UI_Selector_C", "PreConstruct", SDK::Params::UI_Selector_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, RemoveOption, "UI_Selector_C", "RemoveOption", SDK::Params::UI_Selector_C_RemoveOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, ResetSlider, "UI_Selector_C", "ResetSlider", SDK::Params::UI_Selector_C_ResetSlider)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, ResetSliderFocus, "UI_Selector_C", "ResetSliderFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, SetDefaultOptionByIndex, "UI_Selector_C", "SetDefaultOptionByIndex", SDK::Params::UI_Selector_C_SetDefaultOptionByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, SetDefaultOptionByName, "UI_Selector_C", "SetDefaultOptionByName", SDK::Params::UI_Selector_C_SetDefaultOptionByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Selector_C, SetSliderFocus, "UI_Selector_C", "SetSliderFocus", void)
+// clang-format on
@@ -0,0 +1,37 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Slider_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Slider_classes.hpp"
+#include "../SDK/UI_Slider_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, BndEvt__btn_left_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_Slider_C", "BndEvt__btn_left_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, BndEvt__btn_right_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature, "UI_Slider_C", "BndEvt__btn_right_K2Node_ComponentBoundEvent_1_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, BndEvt__Slider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature, "UI_Slider_C", "BndEvt__Slider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature", SDK::Params::UI_Slider_C_BndEvt__Slider_K2Node_ComponentBoundEvent_2_OnFloatValueChangedEvent__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, ChangeValue, "UI_Slider_C", "ChangeValue", SDK::Params::UI_Slider_C_ChangeValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, ConstantStepSizeIncrease, "UI_Slider_C", "ConstantStepSizeIncrease", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, Construct, "UI_Slider_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, EnableDisableWidget, "UI_Slider_C", "EnableDisableWidget", SDK::Params::UI_Slider_C_EnableDisableWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, ExecuteUbergraph_UI_Slider, "UI_Slider_C", "ExecuteUbergraph_UI_Slider", SDK::Params::UI_Slider_C_ExecuteUbergraph_UI_Slider)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, FocusThisWidget, "UI_Slider_C", "FocusThisWidget", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, FocusWithMouseWheel, "UI_Slider_C", "FocusWithMouseWheel", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, getFocusedOrUnfocusedColor, "UI_Slider_C", "getFocusedOrUnfocusedColor", SDK::Params::UI_Slider_C_getFocusedOrUnfocusedColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, getLeftButtonSettings, "UI_Slider_C", "getLeftButtonSettings", SDK::Params::UI_Slider_C_getLeftButtonSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, getRightButtonSettings, "UI_Slider_C", "getRightButtonSettings", SDK::Params::UI_Slider_C_getRightButtonSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, getTxtValue, "UI_Slider_C", "getTxtValue", SDK::Params::UI_Slider_C_getTxtValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, Initialize, "UI_Slider_C", "Initialize", SDK::Params::UI_Slider_C_Initialize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, LockVisibility, "UI_Slider_C", "LockVisibility", SDK::Params::UI_Slider_C_LockVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, OnMouseButtonDoubleClick, "UI_Slider_C", "OnMouseButtonDoubleClick", SDK::Params::UI_Slider_C_OnMouseButtonDoubleClick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, OnMouseEnter, "UI_Slider_C", "OnMouseEnter", SDK::Params::UI_Slider_C_OnMouseEnter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, OnMouseLeave, "UI_Slider_C", "OnMouseLeave", SDK::Params::UI_Slider_C_OnMouseLeave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, OnMouseWheel, "UI_Slider_C", "OnMouseWheel", SDK::Params::UI_Slider_C_OnMouseWheel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, PreConstruct, "UI_Slider_C", "PreConstruct", SDK::Params::UI_Slider_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, ResetSlider, "UI_Slider_C", "ResetSlider", SDK::Params::UI_Slider_C_ResetSlider)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, ResetSliderFocus, "UI_Slider_C", "ResetSliderFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, SetSliderFocus, "UI_Slider_C", "SetSliderFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Slider_C, TextValueVisibility, "UI_Slider_C", "TextValueVisibility", SDK::Params::UI_Slider_C_TextValueVisibility)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_StartUpScreen_1_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_StartUpScreen_1_classes.hpp"
+#include "../SDK/UI_StartUpScreen_1_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_1_C, Construct, "UI_StartUpScreen_1_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_1_C, ExecuteUbergraph_UI_StartUpScreen_1, "UI_StartUpScreen_1_C", "ExecuteUbergraph_UI_StartUpScreen_1", SDK::Params::UI_StartUpScreen_1_C_ExecuteUbergraph_UI_StartUpScreen_1)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_1_C, InpActEvt_AnyKey_K2Node_InputKeyEvent_0, "UI_StartUpScreen_1_C", "InpActEvt_AnyKey_K2Node_InputKeyEvent_0", SDK::Params::UI_StartUpScreen_1_C_InpActEvt_AnyKey_K2Node_InputKeyEvent_0)
+// clang-format on
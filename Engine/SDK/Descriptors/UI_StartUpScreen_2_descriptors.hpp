@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_StartUpScreen_2_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_StartUpScreen_2_classes.hpp"
+#include "../SDK/UI_StartUpScreen_2_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_2_C, Construct, "UI_StartUpScreen_2_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_2_C, ExecuteUbergraph_UI_StartUpScreen_2, "UI_StartUpScreen_2_C", "ExecuteUbergraph_UI_StartUpScreen_2", SDK::Params::UI_StartUpScreen_2_C_ExecuteUbergraph_UI_StartUpScreen_2)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_2_C, InpActEvt_AnyKey_K2Node_InputKeyEvent_0, "UI_StartUpScreen_2_C", "InpActEvt_AnyKey_K2Node_InputKeyEvent_0", SDK::Params::UI_StartUpScreen_2_C_InpActEvt_AnyKey_K2Node_InputKeyEvent_0)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_StartUpScreen_3_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_StartUpScreen_3_classes.hpp"
+#include "../SDK/UI_StartUpScreen_3_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_3_C, Construct, "UI_StartUpScreen_3_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_3_C, ExecuteUbergraph_UI_StartUpScreen_3, "UI_StartUpScreen_3_C", "ExecuteUbergraph_UI_StartUpScreen_3", SDK::Params::UI_StartUpScreen_3_C_ExecuteUbergraph_UI_StartUpScreen_3)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_3_C, InpActEvt_AnyKey_K2Node_InputKeyEvent_0, "UI_StartUpScreen_3_C", "InpActEvt_AnyKey_K2Node_InputKeyEvent_0", SDK::Params::UI_StartUpScreen_3_C_InpActEvt_AnyKey_K2Node_InputKeyEvent_0)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_StartUpScreen_4_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_StartUpScreen_4_classes.hpp"
+#include "../SDK/UI_StartUpScreen_4_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_4_C, Construct, "UI_StartUpScreen_4_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_4_C, ExecuteUbergraph_UI_StartUpScreen_4, "UI_StartUpScreen_4_C", "ExecuteUbergraph_UI_StartUpScreen_4", SDK::Params::UI_StartUpScreen_4_C_ExecuteUbergraph_UI_StartUpScreen_4)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_StartUpScreen_4_C, InpActEvt_AnyKey_K2Node_InputKeyEvent_0, "UI_StartUpScreen_4_C", "InpActEvt_AnyKey_K2Node_InputKeyEvent_0", SDK::Params::UI_StartUpScreen_4_C_InpActEvt_AnyKey_K2Node_InputKeyEvent_0)
+// clang-format on
@@ -0,0 +1,18 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_TabButton_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_TabButton_classes.hpp"
+#include "../SDK/UI_TabButton_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_TabButton_C, BndEvt__Button_99_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_TabButton_C", "BndEvt__Button_99_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_TabButton_C, ExecuteUbergraph_UI_TabButton, "UI_TabButton_C", "ExecuteUbergraph_UI_TabButton", SDK::Params::UI_TabButton_C_ExecuteUbergraph_UI_TabButton)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_TabButton_C, Initialize, "UI_TabButton_C", "Initialize", SDK::Params::UI_TabButton_C_Initialize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_TabButton_C, PreConstruct, "UI_TabButton_C", "PreConstruct", SDK::Params::UI_TabButton_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_TabButton_C, SetSelectedTabStyle, "UI_TabButton_C", "SetSelectedTabStyle", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_TabButton_C, SetUnselectedTabStyle, "UI_TabButton_C", "SetUnselectedTabStyle", void)
+// clang-format on
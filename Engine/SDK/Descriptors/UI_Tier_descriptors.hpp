@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Tier_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Tier_classes.hpp"
+#include "../SDK/UI_Tier_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Tier_C, Construct, "UI_Tier_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Tier_C, ExecuteUbergraph_UI_Tier, "UI_Tier_C", "ExecuteUbergraph_UI_Tier", SDK::Params::UI_Tier_C_ExecuteUbergraph_UI_Tier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Tier_C, GetBrush, "UI_Tier_C", "GetBrush", SDK::Params::UI_Tier_C_GetBrush)
+// clang-format on
@@ -0,0 +1,20 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_Ultimate_Challenge_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_Ultimate_Challenge_classes.hpp"
+#include "../SDK/UI_Ultimate_Challenge_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Ultimate_Challenge_C, Construct, "UI_Ultimate_Challenge_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Ultimate_Challenge_C, ExecuteUbergraph_UI_Ultimate_Challenge, "UI_Ultimate_Challenge_C", "ExecuteUbergraph_UI_Ultimate_Challenge", SDK::Params::UI_Ultimate_Challenge_C_ExecuteUbergraph_UI_Ultimate_Challenge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Ultimate_Challenge_C, GetPercent, "UI_Ultimate_Challenge_C", "GetPercent", SDK::Params::UI_Ultimate_Challenge_C_GetPercent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Ultimate_Challenge_C, GetText, "UI_Ultimate_Challenge_C", "GetText", SDK::Params::UI_Ultimate_Challenge_C_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Ultimate_Challenge_C, GetText_0, "UI_Ultimate_Challenge_C", "GetText_0", SDK::Params::UI_Ultimate_Challenge_C_GetText_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Ultimate_Challenge_C, GetVisibility_0, "UI_Ultimate_Challenge_C", "GetVisibility_0", SDK::Params::UI_Ultimate_Challenge_C_GetVisibility_0)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Ultimate_Challenge_C, PreConstruct, "UI_Ultimate_Challenge_C", "PreConstruct", SDK::Params::UI_Ultimate_Challenge_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_Ultimate_Challenge_C, Tick, "UI_Ultimate_Challenge_C", "Tick", SDK::Params::UI_Ultimate_Challenge_C_Tick)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_WIN_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_WIN_classes.hpp"
+#include "../SDK/UI_WIN_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WIN_C, Construct, "UI_WIN_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WIN_C, ExecuteUbergraph_UI_WIN, "UI_WIN_C", "ExecuteUbergraph_UI_WIN", SDK::Params::UI_WIN_C_ExecuteUbergraph_UI_WIN)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WIN_C, PreConstruct, "UI_WIN_C", "PreConstruct", SDK::Params::UI_WIN_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WIN_C, Tick, "UI_WIN_C", "Tick", SDK::Params::UI_WIN_C_Tick)
+// clang-format on
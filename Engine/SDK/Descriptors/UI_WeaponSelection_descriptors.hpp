@@ -0,0 +1,43 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_WeaponSelection_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_WeaponSelection_classes.hpp"
+#include "../SDK/UI_WeaponSelection_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_B1_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_B1_K2Node_ComponentBoundEvent_14_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_B1_K2Node_ComponentBoundEvent_20_OnButtonPressedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_B1_K2Node_ComponentBoundEvent_20_OnButtonPressedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_B1_K2Node_ComponentBoundEvent_8_OnButtonClickedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_B1_K2Node_ComponentBoundEvent_8_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_B1_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_B1_K2Node_ComponentBoundEvent_9_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_L1_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_L1_K2Node_ComponentBoundEvent_12_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_L1_K2Node_ComponentBoundEvent_18_OnButtonPressedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_L1_K2Node_ComponentBoundEvent_18_OnButtonPressedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_L1_K2Node_ComponentBoundEvent_4_OnButtonClickedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_L1_K2Node_ComponentBoundEvent_4_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_L1_K2Node_ComponentBoundEvent_5_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_L1_K2Node_ComponentBoundEvent_5_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_L2_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_L2_K2Node_ComponentBoundEvent_13_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_L2_K2Node_ComponentBoundEvent_19_OnButtonPressedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_L2_K2Node_ComponentBoundEvent_19_OnButtonPressedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_L2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_L2_K2Node_ComponentBoundEvent_6_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_L2_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_L2_K2Node_ComponentBoundEvent_7_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_R1_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_R1_K2Node_ComponentBoundEvent_0_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_R1_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_R1_K2Node_ComponentBoundEvent_10_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_R1_K2Node_ComponentBoundEvent_16_OnButtonPressedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_R1_K2Node_ComponentBoundEvent_16_OnButtonPressedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_R1_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_R1_K2Node_ComponentBoundEvent_1_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_R2_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_R2_K2Node_ComponentBoundEvent_11_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_R2_K2Node_ComponentBoundEvent_17_OnButtonPressedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_R2_K2Node_ComponentBoundEvent_17_OnButtonPressedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_R2_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_R2_K2Node_ComponentBoundEvent_2_OnButtonClickedEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, BndEvt__UI_WeaponSelection_R2_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature, "UI_WeaponSelection_C", "BndEvt__UI_WeaponSelection_R2_K2Node_ComponentBoundEvent_3_OnButtonHoverEvent__DelegateSignature", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, Close_Widget, "UI_WeaponSelection_C", "Close Widget", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, Construct, "UI_WeaponSelection_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, ExecuteUbergraph_UI_WeaponSelection, "UI_WeaponSelection_C", "ExecuteUbergraph_UI_WeaponSelection", SDK::Params::UI_WeaponSelection_C_ExecuteUbergraph_UI_WeaponSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, Mouse_Click_Left, "UI_WeaponSelection_C", "Mouse Click Left", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, Mouse_Click_Right, "UI_WeaponSelection_C", "Mouse Click Right", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, OnKeyDown, "UI_WeaponSelection_C", "OnKeyDown", SDK::Params::UI_WeaponSelection_C_OnKeyDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, OnKeyUp, "UI_WeaponSelection_C", "OnKeyUp", SDK::Params::UI_WeaponSelection_C_OnKeyUp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, OnMouseButtonDown, "UI_WeaponSelection_C", "OnMouseButtonDown", SDK::Params::UI_WeaponSelection_C_OnMouseButtonDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, OnMouseMove, "UI_WeaponSelection_C", "OnMouseMove", SDK::Params::UI_WeaponSelection_C_OnMouseMove)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, PreConstruct, "UI_WeaponSelection_C", "PreConstruct", SDK::Params::UI_WeaponSelection_C_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WeaponSelection_C, Tick, "UI_WeaponSelection_C", "Tick", SDK::Params::UI_WeaponSelection_C_Tick)
+// clang-format on
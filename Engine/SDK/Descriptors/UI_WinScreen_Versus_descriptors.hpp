@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_WinScreen_Versus_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_WinScreen_Versus_classes.hpp"
+#include "../SDK/UI_WinScreen_Versus_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WinScreen_Versus_C, Construct, "UI_WinScreen_Versus_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WinScreen_Versus_C, ExecuteUbergraph_UI_WinScreen_Versus, "UI_WinScreen_Versus_C", "ExecuteUbergraph_UI_WinScreen_Versus", SDK::Params::UI_WinScreen_Versus_C_ExecuteUbergraph_UI_WinScreen_Versus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WinScreen_Versus_C, PreConstruct, "UI_WinScreen_Versus_C", "PreConstruct", SDK::Params::UI_WinScreen_Versus_C_PreConstruct)
+// clang-format on
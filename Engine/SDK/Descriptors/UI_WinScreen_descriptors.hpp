@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UI_WinScreen_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UI_WinScreen_classes.hpp"
+#include "../SDK/UI_WinScreen_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WinScreen_C, Construct, "UI_WinScreen_C", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WinScreen_C, ExecuteUbergraph_UI_WinScreen, "UI_WinScreen_C", "ExecuteUbergraph_UI_WinScreen", SDK::Params::UI_WinScreen_C_ExecuteUbergraph_UI_WinScreen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUI_WinScreen_C, PreConstruct, "UI_WinScreen_C", "PreConstruct", SDK::Params::UI_WinScreen_C_PreConstruct)
+// clang-format on
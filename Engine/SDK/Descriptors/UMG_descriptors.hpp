@@ -0,0 +1,797 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from UMG_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/UMG_classes.hpp"
+#include "../SDK/UMG_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, ForceLayoutPrepass, "Widget", "ForceLayoutPrepass", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, ForceVolatile, "Widget", "ForceVolatile", SDK::Params::Widget_ForceVolatile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, InvalidateLayoutAndVolatility, "Widget", "InvalidateLayoutAndVolatility", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, K2_AddFieldValueChangedDelegate, "Widget", "K2_AddFieldValueChangedDelegate", SDK::Params::Widget_K2_AddFieldValueChangedDelegate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, K2_BroadcastFieldValueChanged, "Widget", "K2_BroadcastFieldValueChanged", SDK::Params::Widget_K2_BroadcastFieldValueChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, K2_RemoveFieldValueChangedDelegate, "Widget", "K2_RemoveFieldValueChangedDelegate", SDK::Params::Widget_K2_RemoveFieldValueChangedDelegate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, RemoveFromParent, "Widget", "RemoveFromParent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, ResetCursor, "Widget", "ResetCursor", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetAllNavigationRules, "Widget", "SetAllNavigationRules", SDK::Params::Widget_SetAllNavigationRules)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetClipping, "Widget", "SetClipping", SDK::Params::Widget_SetClipping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetCursor, "Widget", "SetCursor", SDK::Params::Widget_SetCursor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetFocus, "Widget", "SetFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetIsEnabled, "Widget", "SetIsEnabled", SDK::Params::Widget_SetIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetKeyboardFocus, "Widget", "SetKeyboardFocus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetNavigationRule, "Widget", "SetNavigationRule", SDK::Params::Widget_SetNavigationRule)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetNavigationRuleBase, "Widget", "SetNavigationRuleBase", SDK::Params::Widget_SetNavigationRuleBase)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetNavigationRuleCustom, "Widget", "SetNavigationRuleCustom", SDK::Params::Widget_SetNavigationRuleCustom)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetNavigationRuleCustomBoundary, "Widget", "SetNavigationRuleCustomBoundary", SDK::Params::Widget_SetNavigationRuleCustomBoundary)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetNavigationRuleExplicit, "Widget", "SetNavigationRuleExplicit", SDK::Params::Widget_SetNavigationRuleExplicit)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetRenderOpacity, "Widget", "SetRenderOpacity", SDK::Params::Widget_SetRenderOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetRenderScale, "Widget", "SetRenderScale", SDK::Params::Widget_SetRenderScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetRenderShear, "Widget", "SetRenderShear", SDK::Params::Widget_SetRenderShear)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetRenderTransform, "Widget", "SetRenderTransform", SDK::Params::Widget_SetRenderTransform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetRenderTransformAngle, "Widget", "SetRenderTransformAngle", SDK::Params::Widget_SetRenderTransformAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetRenderTransformPivot, "Widget", "SetRenderTransformPivot", SDK::Params::Widget_SetRenderTransformPivot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetRenderTranslation, "Widget", "SetRenderTranslation", SDK::Params::Widget_SetRenderTranslation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetToolTip, "Widget", "SetToolTip", SDK::Params::Widget_SetToolTip)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetToolTipText, "Widget", "SetToolTipText", SDK::Params::Widget_SetToolTipText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetUserFocus, "Widget", "SetUserFocus", SDK::Params::Widget_SetUserFocus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, SetVisibility, "Widget", "SetVisibility", SDK::Params::Widget_SetVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetAccessibleSummaryText, "Widget", "GetAccessibleSummaryText", SDK::Params::Widget_GetAccessibleSummaryText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetAccessibleText, "Widget", "GetAccessibleText", SDK::Params::Widget_GetAccessibleText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetCachedGeometry, "Widget", "GetCachedGeometry", SDK::Params::Widget_GetCachedGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetClipping, "Widget", "GetClipping", SDK::Params::Widget_GetClipping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetDesiredSize, "Widget", "GetDesiredSize", SDK::Params::Widget_GetDesiredSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetGameInstance, "Widget", "GetGameInstance", SDK::Params::Widget_GetGameInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetIsEnabled, "Widget", "GetIsEnabled", SDK::Params::Widget_GetIsEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetOwningLocalPlayer, "Widget", "GetOwningLocalPlayer", SDK::Params::Widget_GetOwningLocalPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetOwningPlayer, "Widget", "GetOwningPlayer", SDK::Params::Widget_GetOwningPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetPaintSpaceGeometry, "Widget", "GetPaintSpaceGeometry", SDK::Params::Widget_GetPaintSpaceGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetParent, "Widget", "GetParent", SDK::Params::Widget_GetParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetRenderOpacity, "Widget", "GetRenderOpacity", SDK::Params::Widget_GetRenderOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetRenderTransformAngle, "Widget", "GetRenderTransformAngle", SDK::Params::Widget_GetRenderTransformAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetTickSpaceGeometry, "Widget", "GetTickSpaceGeometry", SDK::Params::Widget_GetTickSpaceGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, GetVisibility, "Widget", "GetVisibility", SDK::Params::Widget_GetVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, HasAnyUserFocus, "Widget", "HasAnyUserFocus", SDK::Params::Widget_HasAnyUserFocus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, HasFocusedDescendants, "Widget", "HasFocusedDescendants", SDK::Params::Widget_HasFocusedDescendants)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, HasKeyboardFocus, "Widget", "HasKeyboardFocus", SDK::Params::Widget_HasKeyboardFocus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, HasMouseCapture, "Widget", "HasMouseCapture", SDK::Params::Widget_HasMouseCapture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, HasMouseCaptureByUser, "Widget", "HasMouseCaptureByUser", SDK::Params::Widget_HasMouseCaptureByUser)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, HasUserFocus, "Widget", "HasUserFocus", SDK::Params::Widget_HasUserFocus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, HasUserFocusedDescendants, "Widget", "HasUserFocusedDescendants", SDK::Params::Widget_HasUserFocusedDescendants)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, IsHovered, "Widget", "IsHovered", SDK::Params::Widget_IsHovered)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, IsInViewport, "Widget", "IsInViewport", SDK::Params::Widget_IsInViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, IsRendered, "Widget", "IsRendered", SDK::Params::Widget_IsRendered)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidget, IsVisible, "Widget", "IsVisible", SDK::Params::Widget_IsVisible)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, AddExtension, "UserWidget", "AddExtension", SDK::Params::UserWidget_AddExtension)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, AddToPlayerScreen, "UserWidget", "AddToPlayerScreen", SDK::Params::UserWidget_AddToPlayerScreen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, AddToViewport, "UserWidget", "AddToViewport", SDK::Params::UserWidget_AddToViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, BindToAnimationEvent, "UserWidget", "BindToAnimationEvent", SDK::Params::UserWidget_BindToAnimationEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, BindToAnimationFinished, "UserWidget", "BindToAnimationFinished", SDK::Params::UserWidget_BindToAnimationFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, BindToAnimationStarted, "UserWidget", "BindToAnimationStarted", SDK::Params::UserWidget_BindToAnimationStarted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, CancelLatentActions, "UserWidget", "CancelLatentActions", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, Construct, "UserWidget", "Construct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, Destruct, "UserWidget", "Destruct", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, FlushAnimations, "UserWidget", "FlushAnimations", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, IsAnimationPlayingForward, "UserWidget", "IsAnimationPlayingForward", SDK::Params::UserWidget_IsAnimationPlayingForward)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, ListenForInputAction, "UserWidget", "ListenForInputAction", SDK::Params::UserWidget_ListenForInputAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnAddedToFocusPath, "UserWidget", "OnAddedToFocusPath", SDK::Params::UserWidget_OnAddedToFocusPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnAnalogValueChanged, "UserWidget", "OnAnalogValueChanged", SDK::Params::UserWidget_OnAnalogValueChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnAnimationFinished, "UserWidget", "OnAnimationFinished", SDK::Params::UserWidget_OnAnimationFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnAnimationStarted, "UserWidget", "OnAnimationStarted", SDK::Params::UserWidget_OnAnimationStarted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnDragCancelled, "UserWidget", "OnDragCancelled", SDK::Params::UserWidget_OnDragCancelled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnDragDetected, "UserWidget", "OnDragDetected", SDK::Params::UserWidget_OnDragDetected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnDragEnter, "UserWidget", "OnDragEnter", SDK::Params::UserWidget_OnDragEnter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnDragLeave, "UserWidget", "OnDragLeave", SDK::Params::UserWidget_OnDragLeave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnDragOver, "UserWidget", "OnDragOver", SDK::Params::UserWidget_OnDragOver)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnDrop, "UserWidget", "OnDrop", SDK::Params::UserWidget_OnDrop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnFocusLost, "UserWidget", "OnFocusLost", SDK::Params::UserWidget_OnFocusLost)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnFocusReceived, "UserWidget", "OnFocusReceived", SDK::Params::UserWidget_OnFocusReceived)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnInitialized, "UserWidget", "OnInitialized", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnKeyChar, "UserWidget", "OnKeyChar", SDK::Params::UserWidget_OnKeyChar)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnKeyDown, "UserWidget", "OnKeyDown", SDK::Params::UserWidget_OnKeyDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnKeyUp, "UserWidget", "OnKeyUp", SDK::Params::UserWidget_OnKeyUp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMotionDetected, "UserWidget", "OnMotionDetected", SDK::Params::UserWidget_OnMotionDetected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMouseButtonDoubleClick, "UserWidget", "OnMouseButtonDoubleClick", SDK::Params::UserWidget_OnMouseButtonDoubleClick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMouseButtonDown, "UserWidget", "OnMouseButtonDown", SDK::Params::UserWidget_OnMouseButtonDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMouseButtonUp, "UserWidget", "OnMouseButtonUp", SDK::Params::UserWidget_OnMouseButtonUp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMouseCaptureLost, "UserWidget", "OnMouseCaptureLost", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMouseEnter, "UserWidget", "OnMouseEnter", SDK::Params::UserWidget_OnMouseEnter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMouseLeave, "UserWidget", "OnMouseLeave", SDK::Params::UserWidget_OnMouseLeave)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMouseMove, "UserWidget", "OnMouseMove", SDK::Params::UserWidget_OnMouseMove)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnMouseWheel, "UserWidget", "OnMouseWheel", SDK::Params::UserWidget_OnMouseWheel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnPreviewKeyDown, "UserWidget", "OnPreviewKeyDown", SDK::Params::UserWidget_OnPreviewKeyDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnPreviewMouseButtonDown, "UserWidget", "OnPreviewMouseButtonDown", SDK::Params::UserWidget_OnPreviewMouseButtonDown)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnRemovedFromFocusPath, "UserWidget", "OnRemovedFromFocusPath", SDK::Params::UserWidget_OnRemovedFromFocusPath)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnTouchEnded, "UserWidget", "OnTouchEnded", SDK::Params::UserWidget_OnTouchEnded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnTouchForceChanged, "UserWidget", "OnTouchForceChanged", SDK::Params::UserWidget_OnTouchForceChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnTouchGesture, "UserWidget", "OnTouchGesture", SDK::Params::UserWidget_OnTouchGesture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnTouchMoved, "UserWidget", "OnTouchMoved", SDK::Params::UserWidget_OnTouchMoved)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnTouchStarted, "UserWidget", "OnTouchStarted", SDK::Params::UserWidget_OnTouchStarted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, PauseAnimation, "UserWidget", "PauseAnimation", SDK::Params::UserWidget_PauseAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, PlayAnimation, "UserWidget", "PlayAnimation", SDK::Params::UserWidget_PlayAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, PlayAnimationForward, "UserWidget", "PlayAnimationForward", SDK::Params::UserWidget_PlayAnimationForward)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, PlayAnimationReverse, "UserWidget", "PlayAnimationReverse", SDK::Params::UserWidget_PlayAnimationReverse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, PlayAnimationTimeRange, "UserWidget", "PlayAnimationTimeRange", SDK::Params::UserWidget_PlayAnimationTimeRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, PlaySound, "UserWidget", "PlaySound", SDK::Params::UserWidget_PlaySound)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, PreConstruct, "UserWidget", "PreConstruct", SDK::Params::UserWidget_PreConstruct)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, QueuePauseAnimation, "UserWidget", "QueuePauseAnimation", SDK::Params::UserWidget_QueuePauseAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, QueuePlayAnimation, "UserWidget", "QueuePlayAnimation", SDK::Params::UserWidget_QueuePlayAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, QueuePlayAnimationForward, "UserWidget", "QueuePlayAnimationForward", SDK::Params::UserWidget_QueuePlayAnimationForward)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, QueuePlayAnimationReverse, "UserWidget", "QueuePlayAnimationReverse", SDK::Params::UserWidget_QueuePlayAnimationReverse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, QueuePlayAnimationTimeRange, "UserWidget", "QueuePlayAnimationTimeRange", SDK::Params::UserWidget_QueuePlayAnimationTimeRange)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, QueueStopAllAnimations, "UserWidget", "QueueStopAllAnimations", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, QueueStopAnimation, "UserWidget", "QueueStopAnimation", SDK::Params::UserWidget_QueueStopAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, RegisterInputComponent, "UserWidget", "RegisterInputComponent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, RemoveExtension, "UserWidget", "RemoveExtension", SDK::Params::UserWidget_RemoveExtension)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, RemoveExtensions, "UserWidget", "RemoveExtensions", SDK::Params::UserWidget_RemoveExtensions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, RemoveFromViewport, "UserWidget", "RemoveFromViewport", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, ReverseAnimation, "UserWidget", "ReverseAnimation", SDK::Params::UserWidget_ReverseAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetAlignmentInViewport, "UserWidget", "SetAlignmentInViewport", SDK::Params::UserWidget_SetAlignmentInViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetAnchorsInViewport, "UserWidget", "SetAnchorsInViewport", SDK::Params::UserWidget_SetAnchorsInViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetAnimationCurrentTime, "UserWidget", "SetAnimationCurrentTime", SDK::Params::UserWidget_SetAnimationCurrentTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetColorAndOpacity, "UserWidget", "SetColorAndOpacity", SDK::Params::UserWidget_SetColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetDesiredSizeInViewport, "UserWidget", "SetDesiredSizeInViewport", SDK::Params::UserWidget_SetDesiredSizeInViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetForegroundColor, "UserWidget", "SetForegroundColor", SDK::Params::UserWidget_SetForegroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetInputActionBlocking, "UserWidget", "SetInputActionBlocking", SDK::Params::UserWidget_SetInputActionBlocking)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetInputActionPriority, "UserWidget", "SetInputActionPriority", SDK::Params::UserWidget_SetInputActionPriority)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetNumLoopsToPlay, "UserWidget", "SetNumLoopsToPlay", SDK::Params::UserWidget_SetNumLoopsToPlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetOwningPlayer, "UserWidget", "SetOwningPlayer", SDK::Params::UserWidget_SetOwningPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetPadding, "UserWidget", "SetPadding", SDK::Params::UserWidget_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetPlaybackSpeed, "UserWidget", "SetPlaybackSpeed", SDK::Params::UserWidget_SetPlaybackSpeed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, SetPositionInViewport, "UserWidget", "SetPositionInViewport", SDK::Params::UserWidget_SetPositionInViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, StopAllAnimations, "UserWidget", "StopAllAnimations", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, StopAnimation, "UserWidget", "StopAnimation", SDK::Params::UserWidget_StopAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, StopAnimationsAndLatentActions, "UserWidget", "StopAnimationsAndLatentActions", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, StopListeningForAllInputActions, "UserWidget", "StopListeningForAllInputActions", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, StopListeningForInputAction, "UserWidget", "StopListeningForInputAction", SDK::Params::UserWidget_StopListeningForInputAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, Tick, "UserWidget", "Tick", SDK::Params::UserWidget_Tick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, UnbindAllFromAnimationFinished, "UserWidget", "UnbindAllFromAnimationFinished", SDK::Params::UserWidget_UnbindAllFromAnimationFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, UnbindAllFromAnimationStarted, "UserWidget", "UnbindAllFromAnimationStarted", SDK::Params::UserWidget_UnbindAllFromAnimationStarted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, UnbindFromAnimationFinished, "UserWidget", "UnbindFromAnimationFinished", SDK::Params::UserWidget_UnbindFromAnimationFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, UnbindFromAnimationStarted, "UserWidget", "UnbindFromAnimationStarted", SDK::Params::UserWidget_UnbindFromAnimationStarted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, UnregisterInputComponent, "UserWidget", "UnregisterInputComponent", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, GetAlignmentInViewport, "UserWidget", "GetAlignmentInViewport", SDK::Params::UserWidget_GetAlignmentInViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, GetAnchorsInViewport, "UserWidget", "GetAnchorsInViewport", SDK::Params::UserWidget_GetAnchorsInViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, GetAnimationCurrentTime, "UserWidget", "GetAnimationCurrentTime", SDK::Params::UserWidget_GetAnimationCurrentTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, GetExtension, "UserWidget", "GetExtension", SDK::Params::UserWidget_GetExtension)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, GetExtensions, "UserWidget", "GetExtensions", SDK::Params::UserWidget_GetExtensions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, GetIsVisible, "UserWidget", "GetIsVisible", SDK::Params::UserWidget_GetIsVisible)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, GetOwningPlayerCameraManager, "UserWidget", "GetOwningPlayerCameraManager", SDK::Params::UserWidget_GetOwningPlayerCameraManager)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, GetOwningPlayerPawn, "UserWidget", "GetOwningPlayerPawn", SDK::Params::UserWidget_GetOwningPlayerPawn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, IsAnimationPlaying, "UserWidget", "IsAnimationPlaying", SDK::Params::UserWidget_IsAnimationPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, IsAnyAnimationPlaying, "UserWidget", "IsAnyAnimationPlaying", SDK::Params::UserWidget_IsAnyAnimationPlaying)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, IsInteractable, "UserWidget", "IsInteractable", SDK::Params::UserWidget_IsInteractable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, IsListeningForInputAction, "UserWidget", "IsListeningForInputAction", SDK::Params::UserWidget_IsListeningForInputAction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, IsPlayingAnimation, "UserWidget", "IsPlayingAnimation", SDK::Params::UserWidget_IsPlayingAnimation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserWidget, OnPaint, "UserWidget", "OnPaint", SDK::Params::UserWidget_OnPaint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCircularThrobber, SetNumberOfPieces, "CircularThrobber", "SetNumberOfPieces", SDK::Params::CircularThrobber_SetNumberOfPieces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCircularThrobber, SetPeriod, "CircularThrobber", "SetPeriod", SDK::Params::CircularThrobber_SetPeriod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCircularThrobber, SetRadius, "CircularThrobber", "SetRadius", SDK::Params::CircularThrobber_SetRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcherSlot, SetHorizontalAlignment, "WidgetSwitcherSlot", "SetHorizontalAlignment", SDK::Params::WidgetSwitcherSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcherSlot, SetPadding, "WidgetSwitcherSlot", "SetPadding", SDK::Params::WidgetSwitcherSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcherSlot, SetVerticalAlignment, "WidgetSwitcherSlot", "SetVerticalAlignment", SDK::Params::WidgetSwitcherSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, RegenerateAllEntries, "ListViewBase", "RegenerateAllEntries", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, RequestRefresh, "ListViewBase", "RequestRefresh", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, ScrollToBottom, "ListViewBase", "ScrollToBottom", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, ScrollToTop, "ListViewBase", "ScrollToTop", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, SetIsPointerScrollingEnabled, "ListViewBase", "SetIsPointerScrollingEnabled", SDK::Params::ListViewBase_SetIsPointerScrollingEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, SetScrollbarVisibility, "ListViewBase", "SetScrollbarVisibility", SDK::Params::ListViewBase_SetScrollbarVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, SetScrollOffset, "ListViewBase", "SetScrollOffset", SDK::Params::ListViewBase_SetScrollOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, SetWheelScrollMultiplier, "ListViewBase", "SetWheelScrollMultiplier", SDK::Params::ListViewBase_SetWheelScrollMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, GetDisplayedEntryWidgets, "ListViewBase", "GetDisplayedEntryWidgets", SDK::Params::ListViewBase_GetDisplayedEntryWidgets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListViewBase, GetScrollOffset, "ListViewBase", "GetScrollOffset", SDK::Params::ListViewBase_GetScrollOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, AddChild, "PanelWidget", "AddChild", SDK::Params::PanelWidget_AddChild)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, ClearChildren, "PanelWidget", "ClearChildren", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, RemoveChild, "PanelWidget", "RemoveChild", SDK::Params::PanelWidget_RemoveChild)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, RemoveChildAt, "PanelWidget", "RemoveChildAt", SDK::Params::PanelWidget_RemoveChildAt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, GetAllChildren, "PanelWidget", "GetAllChildren", SDK::Params::PanelWidget_GetAllChildren)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, GetChildAt, "PanelWidget", "GetChildAt", SDK::Params::PanelWidget_GetChildAt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, GetChildIndex, "PanelWidget", "GetChildIndex", SDK::Params::PanelWidget_GetChildIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, GetChildrenCount, "PanelWidget", "GetChildrenCount", SDK::Params::PanelWidget_GetChildrenCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, HasAnyChildren, "PanelWidget", "HasAnyChildren", SDK::Params::PanelWidget_HasAnyChildren)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPanelWidget, HasChild, "PanelWidget", "HasChild", SDK::Params::PanelWidget_HasChild)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVerticalBox, AddChildToVerticalBox, "VerticalBox", "AddChildToVerticalBox", SDK::Params::VerticalBox_AddChildToVerticalBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, AddItem, "ListView", "AddItem", SDK::Params::ListView_AddItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_CancelScrollIntoView, "ListView", "BP_CancelScrollIntoView", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_ClearSelection, "ListView", "BP_ClearSelection", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_NavigateToItem, "ListView", "BP_NavigateToItem", SDK::Params::ListView_BP_NavigateToItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_ScrollItemIntoView, "ListView", "BP_ScrollItemIntoView", SDK::Params::ListView_BP_ScrollItemIntoView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_SetItemSelection, "ListView", "BP_SetItemSelection", SDK::Params::ListView_BP_SetItemSelection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_SetListItems, "ListView", "BP_SetListItems", SDK::Params::ListView_BP_SetListItems)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_SetSelectedItem, "ListView", "BP_SetSelectedItem", SDK::Params::ListView_BP_SetSelectedItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, ClearListItems, "ListView", "ClearListItems", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, NavigateToIndex, "ListView", "NavigateToIndex", SDK::Params::ListView_NavigateToIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, OnListItemEndPlayed, "ListView", "OnListItemEndPlayed", SDK::Params::ListView_OnListItemEndPlayed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, OnListItemOuterEndPlayed, "ListView", "OnListItemOuterEndPlayed", SDK::Params::ListView_OnListItemOuterEndPlayed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, RemoveItem, "ListView", "RemoveItem", SDK::Params::ListView_RemoveItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, ScrollIndexIntoView, "ListView", "ScrollIndexIntoView", SDK::Params::ListView_ScrollIndexIntoView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, SetSelectedIndex, "ListView", "SetSelectedIndex", SDK::Params::ListView_SetSelectedIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, SetSelectionMode, "ListView", "SetSelectionMode", SDK::Params::ListView_SetSelectionMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_GetNumItemsSelected, "ListView", "BP_GetNumItemsSelected", SDK::Params::ListView_BP_GetNumItemsSelected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_GetSelectedItem, "ListView", "BP_GetSelectedItem", SDK::Params::ListView_BP_GetSelectedItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_GetSelectedItems, "ListView", "BP_GetSelectedItems", SDK::Params::ListView_BP_GetSelectedItems)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, BP_IsItemVisible, "ListView", "BP_IsItemVisible", SDK::Params::ListView_BP_IsItemVisible)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, GetHorizontalEntrySpacing, "ListView", "GetHorizontalEntrySpacing", SDK::Params::ListView_GetHorizontalEntrySpacing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, GetIndexForItem, "ListView", "GetIndexForItem", SDK::Params::ListView_GetIndexForItem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, GetItemAt, "ListView", "GetItemAt", SDK::Params::ListView_GetItemAt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, GetListItems, "ListView", "GetListItems", SDK::Params::ListView_GetListItems)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, GetNumItems, "ListView", "GetNumItems", SDK::Params::ListView_GetNumItems)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, GetVerticalEntrySpacing, "ListView", "GetVerticalEntrySpacing", SDK::Params::ListView_GetVerticalEntrySpacing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UListView, IsRefreshPending, "ListView", "IsRefreshPending", SDK::Params::ListView_IsRefreshPending)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBoxSlot, SetFillEmptySpace, "WrapBoxSlot", "SetFillEmptySpace", SDK::Params::WrapBoxSlot_SetFillEmptySpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBoxSlot, SetFillSpanWhenLessThan, "WrapBoxSlot", "SetFillSpanWhenLessThan", SDK::Params::WrapBoxSlot_SetFillSpanWhenLessThan)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBoxSlot, SetHorizontalAlignment, "WrapBoxSlot", "SetHorizontalAlignment", SDK::Params::WrapBoxSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBoxSlot, SetNewLine, "WrapBoxSlot", "SetNewLine", SDK::Params::WrapBoxSlot_SetNewLine)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBoxSlot, SetPadding, "WrapBoxSlot", "SetPadding", SDK::Params::WrapBoxSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBoxSlot, SetVerticalAlignment, "WrapBoxSlot", "SetVerticalAlignment", SDK::Params::WrapBoxSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWindowTitleBarAreaSlot, SetHorizontalAlignment, "WindowTitleBarAreaSlot", "SetHorizontalAlignment", SDK::Params::WindowTitleBarAreaSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWindowTitleBarAreaSlot, SetPadding, "WindowTitleBarAreaSlot", "SetPadding", SDK::Params::WindowTitleBarAreaSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWindowTitleBarAreaSlot, SetVerticalAlignment, "WindowTitleBarAreaSlot", "SetVerticalAlignment", SDK::Params::WindowTitleBarAreaSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, CancelDragDrop, "WidgetBlueprintLibrary", "CancelDragDrop", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, CaptureJoystick, "WidgetBlueprintLibrary", "CaptureJoystick", SDK::Params::WidgetBlueprintLibrary_CaptureJoystick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, CaptureMouse, "WidgetBlueprintLibrary", "CaptureMouse", SDK::Params::WidgetBlueprintLibrary_CaptureMouse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, ClearUserFocus, "WidgetBlueprintLibrary", "ClearUserFocus", SDK::Params::WidgetBlueprintLibrary_ClearUserFocus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, Create, "WidgetBlueprintLibrary", "Create", SDK::Params::WidgetBlueprintLibrary_Create)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, CreateDragDropOperation, "WidgetBlueprintLibrary", "CreateDragDropOperation", SDK::Params::WidgetBlueprintLibrary_CreateDragDropOperation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DetectDrag, "WidgetBlueprintLibrary", "DetectDrag", SDK::Params::WidgetBlueprintLibrary_DetectDrag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DetectDragIfPressed, "WidgetBlueprintLibrary", "DetectDragIfPressed", SDK::Params::WidgetBlueprintLibrary_DetectDragIfPressed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DismissAllMenus, "WidgetBlueprintLibrary", "DismissAllMenus", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DrawBox, "WidgetBlueprintLibrary", "DrawBox", SDK::Params::WidgetBlueprintLibrary_DrawBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DrawLine, "WidgetBlueprintLibrary", "DrawLine", SDK::Params::WidgetBlueprintLibrary_DrawLine)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DrawLines, "WidgetBlueprintLibrary", "DrawLines", SDK::Params::WidgetBlueprintLibrary_DrawLines)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DrawSpline, "WidgetBlueprintLibrary", "DrawSpline", SDK::Params::WidgetBlueprintLibrary_DrawSpline)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DrawText, "WidgetBlueprintLibrary", "DrawText", SDK::Params::WidgetBlueprintLibrary_DrawText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, DrawTextFormatted, "WidgetBlueprintLibrary", "DrawTextFormatted", SDK::Params::WidgetBlueprintLibrary_DrawTextFormatted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, EndDragDrop, "WidgetBlueprintLibrary", "EndDragDrop", SDK::Params::WidgetBlueprintLibrary_EndDragDrop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetAllWidgetsOfClass, "WidgetBlueprintLibrary", "GetAllWidgetsOfClass", SDK::Params::WidgetBlueprintLibrary_GetAllWidgetsOfClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetAllWidgetsWithInterface, "WidgetBlueprintLibrary", "GetAllWidgetsWithInterface", SDK::Params::WidgetBlueprintLibrary_GetAllWidgetsWithInterface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetBrushResource, "WidgetBlueprintLibrary", "GetBrushResource", SDK::Params::WidgetBlueprintLibrary_GetBrushResource)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetBrushResourceAsMaterial, "WidgetBlueprintLibrary", "GetBrushResourceAsMaterial", SDK::Params::WidgetBlueprintLibrary_GetBrushResourceAsMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetBrushResourceAsTexture2D, "WidgetBlueprintLibrary", "GetBrushResourceAsTexture2D", SDK::Params::WidgetBlueprintLibrary_GetBrushResourceAsTexture2D)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetDragDroppingContent, "WidgetBlueprintLibrary", "GetDragDroppingContent", SDK::Params::WidgetBlueprintLibrary_GetDragDroppingContent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetDynamicMaterial, "WidgetBlueprintLibrary", "GetDynamicMaterial", SDK::Params::WidgetBlueprintLibrary_GetDynamicMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetInputEventFromCharacterEvent, "WidgetBlueprintLibrary", "GetInputEventFromCharacterEvent", SDK::Params::WidgetBlueprintLibrary_GetInputEventFromCharacterEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetInputEventFromKeyEvent, "WidgetBlueprintLibrary", "GetInputEventFromKeyEvent", SDK::Params::WidgetBlueprintLibrary_GetInputEventFromKeyEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetInputEventFromNavigationEvent, "WidgetBlueprintLibrary", "GetInputEventFromNavigationEvent", SDK::Params::WidgetBlueprintLibrary_GetInputEventFromNavigationEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetInputEventFromPointerEvent, "WidgetBlueprintLibrary", "GetInputEventFromPointerEvent", SDK::Params::WidgetBlueprintLibrary_GetInputEventFromPointerEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetKeyEventFromAnalogInputEvent, "WidgetBlueprintLibrary", "GetKeyEventFromAnalogInputEvent", SDK::Params::WidgetBlueprintLibrary_GetKeyEventFromAnalogInputEvent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, GetSafeZonePadding, "WidgetBlueprintLibrary", "GetSafeZonePadding", SDK::Params::WidgetBlueprintLibrary_GetSafeZonePadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, Handled, "WidgetBlueprintLibrary", "Handled", SDK::Params::WidgetBlueprintLibrary_Handled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, IsDragDropping, "WidgetBlueprintLibrary", "IsDragDropping", SDK::Params::WidgetBlueprintLibrary_IsDragDropping)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, LockMouse, "WidgetBlueprintLibrary", "LockMouse", SDK::Params::WidgetBlueprintLibrary_LockMouse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, MakeBrushFromAsset, "WidgetBlueprintLibrary", "MakeBrushFromAsset", SDK::Params::WidgetBlueprintLibrary_MakeBrushFromAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, MakeBrushFromMaterial, "WidgetBlueprintLibrary", "MakeBrushFromMaterial", SDK::Params::WidgetBlueprintLibrary_MakeBrushFromMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, MakeBrushFromTexture, "WidgetBlueprintLibrary", "MakeBrushFromTexture", SDK::Params::WidgetBlueprintLibrary_MakeBrushFromTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, NoResourceBrush, "WidgetBlueprintLibrary", "NoResourceBrush", SDK::Params::WidgetBlueprintLibrary_NoResourceBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, ReleaseJoystickCapture, "WidgetBlueprintLibrary", "ReleaseJoystickCapture", SDK::Params::WidgetBlueprintLibrary_ReleaseJoystickCapture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, ReleaseMouseCapture, "WidgetBlueprintLibrary", "ReleaseMouseCapture", SDK::Params::WidgetBlueprintLibrary_ReleaseMouseCapture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, RestorePreviousWindowTitleBarState, "WidgetBlueprintLibrary", "RestorePreviousWindowTitleBarState", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetBrushResourceToMaterial, "WidgetBlueprintLibrary", "SetBrushResourceToMaterial", SDK::Params::WidgetBlueprintLibrary_SetBrushResourceToMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetBrushResourceToTexture, "WidgetBlueprintLibrary", "SetBrushResourceToTexture", SDK::Params::WidgetBlueprintLibrary_SetBrushResourceToTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetColorVisionDeficiencyType, "WidgetBlueprintLibrary", "SetColorVisionDeficiencyType", SDK::Params::WidgetBlueprintLibrary_SetColorVisionDeficiencyType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetFocusToGameViewport, "WidgetBlueprintLibrary", "SetFocusToGameViewport", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetHardwareCursor, "WidgetBlueprintLibrary", "SetHardwareCursor", SDK::Params::WidgetBlueprintLibrary_SetHardwareCursor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetInputMode_GameAndUIEx, "WidgetBlueprintLibrary", "SetInputMode_GameAndUIEx", SDK::Params::WidgetBlueprintLibrary_SetInputMode_GameAndUIEx)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetInputMode_GameOnly, "WidgetBlueprintLibrary", "SetInputMode_GameOnly", SDK::Params::WidgetBlueprintLibrary_SetInputMode_GameOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetInputMode_UIOnlyEx, "WidgetBlueprintLibrary", "SetInputMode_UIOnlyEx", SDK::Params::WidgetBlueprintLibrary_SetInputMode_UIOnlyEx)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetMousePosition, "WidgetBlueprintLibrary", "SetMousePosition", SDK::Params::WidgetBlueprintLibrary_SetMousePosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetUserFocus, "WidgetBlueprintLibrary", "SetUserFocus", SDK::Params::WidgetBlueprintLibrary_SetUserFocus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetWindowTitleBarCloseButtonActive, "WidgetBlueprintLibrary", "SetWindowTitleBarCloseButtonActive", SDK::Params::WidgetBlueprintLibrary_SetWindowTitleBarCloseButtonActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetWindowTitleBarOnCloseClickedDelegate, "WidgetBlueprintLibrary", "SetWindowTitleBarOnCloseClickedDelegate", SDK::Params::WidgetBlueprintLibrary_SetWindowTitleBarOnCloseClickedDelegate)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, SetWindowTitleBarState, "WidgetBlueprintLibrary", "SetWindowTitleBarState", SDK::Params::WidgetBlueprintLibrary_SetWindowTitleBarState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, Unhandled, "WidgetBlueprintLibrary", "Unhandled", SDK::Params::WidgetBlueprintLibrary_Unhandled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBlueprintLibrary, UnlockMouse, "WidgetBlueprintLibrary", "UnlockMouse", SDK::Params::WidgetBlueprintLibrary_UnlockMouse)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUMGSequencePlayer, SetUserTag, "UMGSequencePlayer", "SetUserTag", SDK::Params::UMGSequencePlayer_SetUserTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUMGSequencePlayer, GetUserTag, "UMGSequencePlayer", "GetUserTag", SDK::Params::UMGSequencePlayer_GetUserTag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimation, BindToAnimationFinished, "WidgetAnimation", "BindToAnimationFinished", SDK::Params::WidgetAnimation_BindToAnimationFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimation, BindToAnimationStarted, "WidgetAnimation", "BindToAnimationStarted", SDK::Params::WidgetAnimation_BindToAnimationStarted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimation, UnbindAllFromAnimationFinished, "WidgetAnimation", "UnbindAllFromAnimationFinished", SDK::Params::WidgetAnimation_UnbindAllFromAnimationFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimation, UnbindAllFromAnimationStarted, "WidgetAnimation", "UnbindAllFromAnimationStarted", SDK::Params::WidgetAnimation_UnbindAllFromAnimationStarted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimation, UnbindFromAnimationFinished, "WidgetAnimation", "UnbindFromAnimationFinished", SDK::Params::WidgetAnimation_UnbindFromAnimationFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimation, UnbindFromAnimationStarted, "WidgetAnimation", "UnbindFromAnimationStarted", SDK::Params::WidgetAnimation_UnbindFromAnimationStarted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimation, GetEndTime, "WidgetAnimation", "GetEndTime", SDK::Params::WidgetAnimation_GetEndTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimation, GetStartTime, "WidgetAnimation", "GetStartTime", SDK::Params::WidgetAnimation_GetStartTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimationPlayCallbackProxy, CreatePlayAnimationProxyObject, "WidgetAnimationPlayCallbackProxy", "CreatePlayAnimationProxyObject", SDK::Params::WidgetAnimationPlayCallbackProxy_CreatePlayAnimationProxyObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetAnimationPlayCallbackProxy, CreatePlayAnimationTimeRangeProxyObject, "WidgetAnimationPlayCallbackProxy", "CreatePlayAnimationTimeRangeProxyObject", SDK::Params::WidgetAnimationPlayCallbackProxy_CreatePlayAnimationTimeRangeProxyObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBoolBinding, GetValue, "BoolBinding", "GetValue", SDK::Params::BoolBinding_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBrushBinding, GetValue, "BrushBinding", "GetValue", SDK::Params::BrushBinding_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckedStateBinding, GetValue, "CheckedStateBinding", "GetValue", SDK::Params::CheckedStateBinding_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UColorBinding, GetLinearValue, "ColorBinding", "GetLinearValue", SDK::Params::ColorBinding_GetLinearValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UColorBinding, GetSlateValue, "ColorBinding", "GetSlateValue", SDK::Params::ColorBinding_GetSlateValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UFloatBinding, GetValue, "FloatBinding", "GetValue", SDK::Params::FloatBinding_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInt32Binding, GetValue, "Int32Binding", "GetValue", SDK::Params::Int32Binding_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMouseCursorBinding, GetValue, "MouseCursorBinding", "GetValue", SDK::Params::MouseCursorBinding_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBinding, GetStringValue, "TextBinding", "GetStringValue", SDK::Params::TextBinding_GetStringValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBinding, GetTextValue, "TextBinding", "GetTextValue", SDK::Params::TextBinding_GetTextValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVisibilityBinding, GetValue, "VisibilityBinding", "GetValue", SDK::Params::VisibilityBinding_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetBinding, GetValue, "WidgetBinding", "GetValue", SDK::Params::WidgetBinding_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAsyncTaskDownloadImage, DownloadImage, "AsyncTaskDownloadImage", "DownloadImage", SDK::Params::AsyncTaskDownloadImage_DownloadImage)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameViewportSubsystem, SetWidgetSlotDesiredSize, "GameViewportSubsystem", "SetWidgetSlotDesiredSize", SDK::Params::GameViewportSubsystem_SetWidgetSlotDesiredSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameViewportSubsystem, SetWidgetSlotPosition, "GameViewportSubsystem", "SetWidgetSlotPosition", SDK::Params::GameViewportSubsystem_SetWidgetSlotPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameViewportSubsystem, AddWidget, "GameViewportSubsystem", "AddWidget", SDK::Params::GameViewportSubsystem_AddWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameViewportSubsystem, AddWidgetForPlayer, "GameViewportSubsystem", "AddWidgetForPlayer", SDK::Params::GameViewportSubsystem_AddWidgetForPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameViewportSubsystem, RemoveWidget, "GameViewportSubsystem", "RemoveWidget", SDK::Params::GameViewportSubsystem_RemoveWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameViewportSubsystem, SetWidgetSlot, "GameViewportSubsystem", "SetWidgetSlot", SDK::Params::GameViewportSubsystem_SetWidgetSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameViewportSubsystem, GetWidgetSlot, "GameViewportSubsystem", "GetWidgetSlot", SDK::Params::GameViewportSubsystem_GetWidgetSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGameViewportSubsystem, IsWidgetAdded, "GameViewportSubsystem", "IsWidgetAdded", SDK::Params::GameViewportSubsystem_IsWidgetAdded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IUserListEntry, BP_OnEntryReleased, "UserListEntry", "BP_OnEntryReleased", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IUserListEntry, BP_OnItemExpansionChanged, "UserListEntry", "BP_OnItemExpansionChanged", SDK::Params::UserListEntry_BP_OnItemExpansionChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IUserListEntry, BP_OnItemSelectionChanged, "UserListEntry", "BP_OnItemSelectionChanged", SDK::Params::UserListEntry_BP_OnItemSelectionChanged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserListEntryLibrary, GetOwningListView, "UserListEntryLibrary", "GetOwningListView", SDK::Params::UserListEntryLibrary_GetOwningListView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserListEntryLibrary, IsListItemExpanded, "UserListEntryLibrary", "IsListItemExpanded", SDK::Params::UserListEntryLibrary_IsListItemExpanded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserListEntryLibrary, IsListItemSelected, "UserListEntryLibrary", "IsListItemSelected", SDK::Params::UserListEntryLibrary_IsListItemSelected)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IUserObjectListEntry, OnListItemObjectSet, "UserObjectListEntry", "OnListItemObjectSet", SDK::Params::UserObjectListEntry_OnListItemObjectSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUserObjectListEntryLibrary, GetListItemObject, "UserObjectListEntryLibrary", "GetListItemObject", SDK::Params::UserObjectListEntryLibrary_GetListItemObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextLayoutWidget, SetJustification, "TextLayoutWidget", "SetJustification", SDK::Params::TextLayoutWidget_SetJustification)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, GetDynamicFontMaterial, "TextBlock", "GetDynamicFontMaterial", SDK::Params::TextBlock_GetDynamicFontMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, GetDynamicOutlineMaterial, "TextBlock", "GetDynamicOutlineMaterial", SDK::Params::TextBlock_GetDynamicOutlineMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetAutoWrapText, "TextBlock", "SetAutoWrapText", SDK::Params::TextBlock_SetAutoWrapText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetColorAndOpacity, "TextBlock", "SetColorAndOpacity", SDK::Params::TextBlock_SetColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetFont, "TextBlock", "SetFont", SDK::Params::TextBlock_SetFont)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetFontMaterial, "TextBlock", "SetFontMaterial", SDK::Params::TextBlock_SetFontMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetFontOutlineMaterial, "TextBlock", "SetFontOutlineMaterial", SDK::Params::TextBlock_SetFontOutlineMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetMinDesiredWidth, "TextBlock", "SetMinDesiredWidth", SDK::Params::TextBlock_SetMinDesiredWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetOpacity, "TextBlock", "SetOpacity", SDK::Params::TextBlock_SetOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetShadowColorAndOpacity, "TextBlock", "SetShadowColorAndOpacity", SDK::Params::TextBlock_SetShadowColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetShadowOffset, "TextBlock", "SetShadowOffset", SDK::Params::TextBlock_SetShadowOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetStrikeBrush, "TextBlock", "SetStrikeBrush", SDK::Params::TextBlock_SetStrikeBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetText, "TextBlock", "SetText", SDK::Params::TextBlock_SetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetTextOverflowPolicy, "TextBlock", "SetTextOverflowPolicy", SDK::Params::TextBlock_SetTextOverflowPolicy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, SetTextTransformPolicy, "TextBlock", "SetTextTransformPolicy", SDK::Params::TextBlock_SetTextTransformPolicy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTextBlock, GetText, "TextBlock", "GetText", SDK::Params::TextBlock_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UContentWidget, SetContent, "ContentWidget", "SetContent", SDK::Params::ContentWidget_SetContent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UContentWidget, GetContent, "ContentWidget", "GetContent", SDK::Params::ContentWidget_GetContent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UContentWidget, GetContentSlot, "ContentWidget", "GetContentSlot", SDK::Params::ContentWidget_GetContentSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlur, SetApplyAlphaToBlur, "BackgroundBlur", "SetApplyAlphaToBlur", SDK::Params::BackgroundBlur_SetApplyAlphaToBlur)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlur, SetBlurRadius, "BackgroundBlur", "SetBlurRadius", SDK::Params::BackgroundBlur_SetBlurRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlur, SetBlurStrength, "BackgroundBlur", "SetBlurStrength", SDK::Params::BackgroundBlur_SetBlurStrength)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlur, SetCornerRadius, "BackgroundBlur", "SetCornerRadius", SDK::Params::BackgroundBlur_SetCornerRadius)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlur, SetHorizontalAlignment, "BackgroundBlur", "SetHorizontalAlignment", SDK::Params::BackgroundBlur_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlur, SetLowQualityFallbackBrush, "BackgroundBlur", "SetLowQualityFallbackBrush", SDK::Params::BackgroundBlur_SetLowQualityFallbackBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlur, SetPadding, "BackgroundBlur", "SetPadding", SDK::Params::BackgroundBlur_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlur, SetVerticalAlignment, "BackgroundBlur", "SetVerticalAlignment", SDK::Params::BackgroundBlur_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlurSlot, SetHorizontalAlignment, "BackgroundBlurSlot", "SetHorizontalAlignment", SDK::Params::BackgroundBlurSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlurSlot, SetPadding, "BackgroundBlurSlot", "SetPadding", SDK::Params::BackgroundBlurSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBackgroundBlurSlot, SetVerticalAlignment, "BackgroundBlurSlot", "SetVerticalAlignment", SDK::Params::BackgroundBlurSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformGridPanel, AddChildToUniformGrid, "UniformGridPanel", "AddChildToUniformGrid", SDK::Params::UniformGridPanel_AddChildToUniformGrid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformGridPanel, SetMinDesiredSlotHeight, "UniformGridPanel", "SetMinDesiredSlotHeight", SDK::Params::UniformGridPanel_SetMinDesiredSlotHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformGridPanel, SetMinDesiredSlotWidth, "UniformGridPanel", "SetMinDesiredSlotWidth", SDK::Params::UniformGridPanel_SetMinDesiredSlotWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformGridPanel, SetSlotPadding, "UniformGridPanel", "SetSlotPadding", SDK::Params::UniformGridPanel_SetSlotPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, GetDynamicMaterial, "Border", "GetDynamicMaterial", SDK::Params::Border_GetDynamicMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetBrush, "Border", "SetBrush", SDK::Params::Border_SetBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetBrushColor, "Border", "SetBrushColor", SDK::Params::Border_SetBrushColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetBrushFromAsset, "Border", "SetBrushFromAsset", SDK::Params::Border_SetBrushFromAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetBrushFromMaterial, "Border", "SetBrushFromMaterial", SDK::Params::Border_SetBrushFromMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetBrushFromTexture, "Border", "SetBrushFromTexture", SDK::Params::Border_SetBrushFromTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetContentColorAndOpacity, "Border", "SetContentColorAndOpacity", SDK::Params::Border_SetContentColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetDesiredSizeScale, "Border", "SetDesiredSizeScale", SDK::Params::Border_SetDesiredSizeScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetHorizontalAlignment, "Border", "SetHorizontalAlignment", SDK::Params::Border_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetPadding, "Border", "SetPadding", SDK::Params::Border_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetShowEffectWhenDisabled, "Border", "SetShowEffectWhenDisabled", SDK::Params::Border_SetShowEffectWhenDisabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorder, SetVerticalAlignment, "Border", "SetVerticalAlignment", SDK::Params::Border_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorderSlot, SetHorizontalAlignment, "BorderSlot", "SetHorizontalAlignment", SDK::Params::BorderSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorderSlot, SetPadding, "BorderSlot", "SetPadding", SDK::Params::BorderSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UBorderSlot, SetVerticalAlignment, "BorderSlot", "SetVerticalAlignment", SDK::Params::BorderSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStackBox, AddChildToStackBox, "StackBox", "AddChildToStackBox", SDK::Params::StackBox_AddChildToStackBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UStackBox, ReplaceStackBoxChildAt, "StackBox", "ReplaceStackBoxChildAt", SDK::Params::StackBox_ReplaceStackBoxChildAt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButton, SetBackgroundColor, "Button", "SetBackgroundColor", SDK::Params::Button_SetBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButton, SetClickMethod, "Button", "SetClickMethod", SDK::Params::Button_SetClickMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButton, SetColorAndOpacity, "Button", "SetColorAndOpacity", SDK::Params::Button_SetColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButton, SetPressMethod, "Button", "SetPressMethod", SDK::Params::Button_SetPressMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButton, SetStyle, "Button", "SetStyle", SDK::Params::Button_SetStyle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButton, SetTouchMethod, "Button", "SetTouchMethod", SDK::Params::Button_SetTouchMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButton, IsPressed, "Button", "IsPressed", SDK::Params::Button_IsPressed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButtonSlot, SetHorizontalAlignment, "ButtonSlot", "SetHorizontalAlignment", SDK::Params::ButtonSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButtonSlot, SetPadding, "ButtonSlot", "SetPadding", SDK::Params::ButtonSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UButtonSlot, SetVerticalAlignment, "ButtonSlot", "SetVerticalAlignment", SDK::Params::ButtonSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanel, AddChildToCanvas, "CanvasPanel", "AddChildToCanvas", SDK::Params::CanvasPanel_AddChildToCanvas)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetAlignment, "CanvasPanelSlot", "SetAlignment", SDK::Params::CanvasPanelSlot_SetAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetAnchors, "CanvasPanelSlot", "SetAnchors", SDK::Params::CanvasPanelSlot_SetAnchors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetAutoSize, "CanvasPanelSlot", "SetAutoSize", SDK::Params::CanvasPanelSlot_SetAutoSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetLayout, "CanvasPanelSlot", "SetLayout", SDK::Params::CanvasPanelSlot_SetLayout)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetMaximum, "CanvasPanelSlot", "SetMaximum", SDK::Params::CanvasPanelSlot_SetMaximum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetMinimum, "CanvasPanelSlot", "SetMinimum", SDK::Params::CanvasPanelSlot_SetMinimum)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetOffsets, "CanvasPanelSlot", "SetOffsets", SDK::Params::CanvasPanelSlot_SetOffsets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetPosition, "CanvasPanelSlot", "SetPosition", SDK::Params::CanvasPanelSlot_SetPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetSize, "CanvasPanelSlot", "SetSize", SDK::Params::CanvasPanelSlot_SetSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, SetZOrder, "CanvasPanelSlot", "SetZOrder", SDK::Params::CanvasPanelSlot_SetZOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, GetAlignment, "CanvasPanelSlot", "GetAlignment", SDK::Params::CanvasPanelSlot_GetAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, GetAnchors, "CanvasPanelSlot", "GetAnchors", SDK::Params::CanvasPanelSlot_GetAnchors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, GetAutoSize, "CanvasPanelSlot", "GetAutoSize", SDK::Params::CanvasPanelSlot_GetAutoSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, GetLayout, "CanvasPanelSlot", "GetLayout", SDK::Params::CanvasPanelSlot_GetLayout)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, GetOffsets, "CanvasPanelSlot", "GetOffsets", SDK::Params::CanvasPanelSlot_GetOffsets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, GetPosition, "CanvasPanelSlot", "GetPosition", SDK::Params::CanvasPanelSlot_GetPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, GetSize, "CanvasPanelSlot", "GetSize", SDK::Params::CanvasPanelSlot_GetSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCanvasPanelSlot, GetZOrder, "CanvasPanelSlot", "GetZOrder", SDK::Params::CanvasPanelSlot_GetZOrder)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckBox, SetCheckedState, "CheckBox", "SetCheckedState", SDK::Params::CheckBox_SetCheckedState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckBox, SetClickMethod, "CheckBox", "SetClickMethod", SDK::Params::CheckBox_SetClickMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckBox, SetIsChecked, "CheckBox", "SetIsChecked", SDK::Params::CheckBox_SetIsChecked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckBox, SetPressMethod, "CheckBox", "SetPressMethod", SDK::Params::CheckBox_SetPressMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckBox, SetTouchMethod, "CheckBox", "SetTouchMethod", SDK::Params::CheckBox_SetTouchMethod)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckBox, GetCheckedState, "CheckBox", "GetCheckedState", SDK::Params::CheckBox_GetCheckedState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckBox, IsChecked, "CheckBox", "IsChecked", SDK::Params::CheckBox_IsChecked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UCheckBox, IsPressed, "CheckBox", "IsPressed", SDK::Params::CheckBox_IsPressed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxKey, AddOption, "ComboBoxKey", "AddOption", SDK::Params::ComboBoxKey_AddOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxKey, ClearOptions, "ComboBoxKey", "ClearOptions", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxKey, ClearSelection, "ComboBoxKey", "ClearSelection", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxKey, RemoveOption, "ComboBoxKey", "RemoveOption", SDK::Params::ComboBoxKey_RemoveOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxKey, SetSelectedOption, "ComboBoxKey", "SetSelectedOption", SDK::Params::ComboBoxKey_SetSelectedOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxKey, GetSelectedOption, "ComboBoxKey", "GetSelectedOption", SDK::Params::ComboBoxKey_GetSelectedOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxKey, IsOpen, "ComboBoxKey", "IsOpen", SDK::Params::ComboBoxKey_IsOpen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, AddOption, "ComboBoxString", "AddOption", SDK::Params::ComboBoxString_AddOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, ClearOptions, "ComboBoxString", "ClearOptions", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, ClearSelection, "ComboBoxString", "ClearSelection", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, RefreshOptions, "ComboBoxString", "RefreshOptions", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, RemoveOption, "ComboBoxString", "RemoveOption", SDK::Params::ComboBoxString_RemoveOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, SetSelectedIndex, "ComboBoxString", "SetSelectedIndex", SDK::Params::ComboBoxString_SetSelectedIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, SetSelectedOption, "ComboBoxString", "SetSelectedOption", SDK::Params::ComboBoxString_SetSelectedOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, FindOptionIndex, "ComboBoxString", "FindOptionIndex", SDK::Params::ComboBoxString_FindOptionIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, GetOptionAtIndex, "ComboBoxString", "GetOptionAtIndex", SDK::Params::ComboBoxString_GetOptionAtIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, GetOptionCount, "ComboBoxString", "GetOptionCount", SDK::Params::ComboBoxString_GetOptionCount)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, GetSelectedIndex, "ComboBoxString", "GetSelectedIndex", SDK::Params::ComboBoxString_GetSelectedIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, GetSelectedOption, "ComboBoxString", "GetSelectedOption", SDK::Params::ComboBoxString_GetSelectedOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UComboBoxString, IsOpen, "ComboBoxString", "IsOpen", SDK::Params::ComboBoxString_IsOpen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicEntryBoxBase, SetEntrySpacing, "DynamicEntryBoxBase", "SetEntrySpacing", SDK::Params::DynamicEntryBoxBase_SetEntrySpacing)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicEntryBoxBase, SetRadialSettings, "DynamicEntryBoxBase", "SetRadialSettings", SDK::Params::DynamicEntryBoxBase_SetRadialSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicEntryBoxBase, GetAllEntries, "DynamicEntryBoxBase", "GetAllEntries", SDK::Params::DynamicEntryBoxBase_GetAllEntries)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicEntryBoxBase, GetNumEntries, "DynamicEntryBoxBase", "GetNumEntries", SDK::Params::DynamicEntryBoxBase_GetNumEntries)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicEntryBox, BP_CreateEntry, "DynamicEntryBox", "BP_CreateEntry", SDK::Params::DynamicEntryBox_BP_CreateEntry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicEntryBox, BP_CreateEntryOfClass, "DynamicEntryBox", "BP_CreateEntryOfClass", SDK::Params::DynamicEntryBox_BP_CreateEntryOfClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicEntryBox, RemoveEntry, "DynamicEntryBox", "RemoveEntry", SDK::Params::DynamicEntryBox_RemoveEntry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDynamicEntryBox, Reset, "DynamicEntryBox", "Reset", SDK::Params::DynamicEntryBox_Reset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetFont, "EditableText", "SetFont", SDK::Params::EditableText_SetFont)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetFontMaterial, "EditableText", "SetFontMaterial", SDK::Params::EditableText_SetFontMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetFontOutlineMaterial, "EditableText", "SetFontOutlineMaterial", SDK::Params::EditableText_SetFontOutlineMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetHintText, "EditableText", "SetHintText", SDK::Params::EditableText_SetHintText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetIsPassword, "EditableText", "SetIsPassword", SDK::Params::EditableText_SetIsPassword)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetIsReadOnly, "EditableText", "SetIsReadOnly", SDK::Params::EditableText_SetIsReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetJustification, "EditableText", "SetJustification", SDK::Params::EditableText_SetJustification)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetMinimumDesiredWidth, "EditableText", "SetMinimumDesiredWidth", SDK::Params::EditableText_SetMinimumDesiredWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetText, "EditableText", "SetText", SDK::Params::EditableText_SetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, SetTextOverflowPolicy, "EditableText", "SetTextOverflowPolicy", SDK::Params::EditableText_SetTextOverflowPolicy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, GetFont, "EditableText", "GetFont", SDK::Params::EditableText_GetFont)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, GetHintText, "EditableText", "GetHintText", SDK::Params::EditableText_GetHintText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, GetJustification, "EditableText", "GetJustification", SDK::Params::EditableText_GetJustification)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableText, GetText, "EditableText", "GetText", SDK::Params::EditableText_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, ClearError, "EditableTextBox", "ClearError", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, SetError, "EditableTextBox", "SetError", SDK::Params::EditableTextBox_SetError)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, SetForegroundColor, "EditableTextBox", "SetForegroundColor", SDK::Params::EditableTextBox_SetForegroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, SetHintText, "EditableTextBox", "SetHintText", SDK::Params::EditableTextBox_SetHintText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, SetIsPassword, "EditableTextBox", "SetIsPassword", SDK::Params::EditableTextBox_SetIsPassword)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, SetIsReadOnly, "EditableTextBox", "SetIsReadOnly", SDK::Params::EditableTextBox_SetIsReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, SetJustification, "EditableTextBox", "SetJustification", SDK::Params::EditableTextBox_SetJustification)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, SetText, "EditableTextBox", "SetText", SDK::Params::EditableTextBox_SetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, SetTextOverflowPolicy, "EditableTextBox", "SetTextOverflowPolicy", SDK::Params::EditableTextBox_SetTextOverflowPolicy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, GetText, "EditableTextBox", "GetText", SDK::Params::EditableTextBox_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UEditableTextBox, HasError, "EditableTextBox", "HasError", SDK::Params::EditableTextBox_HasError)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UExpandableArea, SetIsExpanded, "ExpandableArea", "SetIsExpanded", SDK::Params::ExpandableArea_SetIsExpanded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UExpandableArea, SetIsExpanded_Animated, "ExpandableArea", "SetIsExpanded_Animated", SDK::Params::ExpandableArea_SetIsExpanded_Animated)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UExpandableArea, GetIsExpanded, "ExpandableArea", "GetIsExpanded", SDK::Params::ExpandableArea_GetIsExpanded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridPanel, AddChildToGrid, "GridPanel", "AddChildToGrid", SDK::Params::GridPanel_AddChildToGrid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridPanel, SetColumnFill, "GridPanel", "SetColumnFill", SDK::Params::GridPanel_SetColumnFill)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridPanel, SetRowFill, "GridPanel", "SetRowFill", SDK::Params::GridPanel_SetRowFill)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetColumn, "GridSlot", "SetColumn", SDK::Params::GridSlot_SetColumn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetColumnSpan, "GridSlot", "SetColumnSpan", SDK::Params::GridSlot_SetColumnSpan)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetHorizontalAlignment, "GridSlot", "SetHorizontalAlignment", SDK::Params::GridSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetLayer, "GridSlot", "SetLayer", SDK::Params::GridSlot_SetLayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetNudge, "GridSlot", "SetNudge", SDK::Params::GridSlot_SetNudge)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetPadding, "GridSlot", "SetPadding", SDK::Params::GridSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetRow, "GridSlot", "SetRow", SDK::Params::GridSlot_SetRow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetRowSpan, "GridSlot", "SetRowSpan", SDK::Params::GridSlot_SetRowSpan)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UGridSlot, SetVerticalAlignment, "GridSlot", "SetVerticalAlignment", SDK::Params::GridSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UHorizontalBox, AddChildToHorizontalBox, "HorizontalBox", "AddChildToHorizontalBox", SDK::Params::HorizontalBox_AddChildToHorizontalBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UHorizontalBoxSlot, SetHorizontalAlignment, "HorizontalBoxSlot", "SetHorizontalAlignment", SDK::Params::HorizontalBoxSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UHorizontalBoxSlot, SetPadding, "HorizontalBoxSlot", "SetPadding", SDK::Params::HorizontalBoxSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UHorizontalBoxSlot, SetSize, "HorizontalBoxSlot", "SetSize", SDK::Params::HorizontalBoxSlot_SetSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UHorizontalBoxSlot, SetVerticalAlignment, "HorizontalBoxSlot", "SetVerticalAlignment", SDK::Params::HorizontalBoxSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, GetDynamicMaterial, "Image", "GetDynamicMaterial", SDK::Params::Image_GetDynamicMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrush, "Image", "SetBrush", SDK::Params::Image_SetBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushFromAsset, "Image", "SetBrushFromAsset", SDK::Params::Image_SetBrushFromAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushFromAtlasInterface, "Image", "SetBrushFromAtlasInterface", SDK::Params::Image_SetBrushFromAtlasInterface)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushFromMaterial, "Image", "SetBrushFromMaterial", SDK::Params::Image_SetBrushFromMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushFromSoftMaterial, "Image", "SetBrushFromSoftMaterial", SDK::Params::Image_SetBrushFromSoftMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushFromSoftTexture, "Image", "SetBrushFromSoftTexture", SDK::Params::Image_SetBrushFromSoftTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushFromTexture, "Image", "SetBrushFromTexture", SDK::Params::Image_SetBrushFromTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushFromTextureDynamic, "Image", "SetBrushFromTextureDynamic", SDK::Params::Image_SetBrushFromTextureDynamic)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushResourceObject, "Image", "SetBrushResourceObject", SDK::Params::Image_SetBrushResourceObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetBrushTintColor, "Image", "SetBrushTintColor", SDK::Params::Image_SetBrushTintColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetColorAndOpacity, "Image", "SetColorAndOpacity", SDK::Params::Image_SetColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetDesiredSizeOverride, "Image", "SetDesiredSizeOverride", SDK::Params::Image_SetDesiredSizeOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UImage, SetOpacity, "Image", "SetOpacity", SDK::Params::Image_SetOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputKeySelector, SetAllowGamepadKeys, "InputKeySelector", "SetAllowGamepadKeys", SDK::Params::InputKeySelector_SetAllowGamepadKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputKeySelector, SetAllowModifierKeys, "InputKeySelector", "SetAllowModifierKeys", SDK::Params::InputKeySelector_SetAllowModifierKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputKeySelector, SetEscapeKeys, "InputKeySelector", "SetEscapeKeys", SDK::Params::InputKeySelector_SetEscapeKeys)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputKeySelector, SetKeySelectionText, "InputKeySelector", "SetKeySelectionText", SDK::Params::InputKeySelector_SetKeySelectionText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputKeySelector, SetNoKeySpecifiedText, "InputKeySelector", "SetNoKeySpecifiedText", SDK::Params::InputKeySelector_SetNoKeySpecifiedText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputKeySelector, SetSelectedKey, "InputKeySelector", "SetSelectedKey", SDK::Params::InputKeySelector_SetSelectedKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputKeySelector, SetTextBlockVisibility, "InputKeySelector", "SetTextBlockVisibility", SDK::Params::InputKeySelector_SetTextBlockVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInputKeySelector, GetIsSelectingKey, "InputKeySelector", "GetIsSelectingKey", SDK::Params::InputKeySelector_GetIsSelectingKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInvalidationBox, InvalidateCache, "InvalidationBox", "InvalidateCache", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInvalidationBox, SetCanCache, "InvalidationBox", "SetCanCache", SDK::Params::InvalidationBox_SetCanCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UInvalidationBox, GetCanCache, "InvalidationBox", "GetCanCache", SDK::Params::InvalidationBox_GetCanCache)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, Close, "MenuAnchor", "Close", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, FitInWindow, "MenuAnchor", "FitInWindow", SDK::Params::MenuAnchor_FitInWindow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, Open, "MenuAnchor", "Open", SDK::Params::MenuAnchor_Open)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, SetPlacement, "MenuAnchor", "SetPlacement", SDK::Params::MenuAnchor_SetPlacement)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, ToggleOpen, "MenuAnchor", "ToggleOpen", SDK::Params::MenuAnchor_ToggleOpen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, GetMenuPosition, "MenuAnchor", "GetMenuPosition", SDK::Params::MenuAnchor_GetMenuPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, HasOpenSubMenus, "MenuAnchor", "HasOpenSubMenus", SDK::Params::MenuAnchor_HasOpenSubMenus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, IsOpen, "MenuAnchor", "IsOpen", SDK::Params::MenuAnchor_IsOpen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMenuAnchor, ShouldOpenDueToClick, "MenuAnchor", "ShouldOpenDueToClick", SDK::Params::MenuAnchor_ShouldOpenDueToClick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, SetFont, "MultiLineEditableText", "SetFont", SDK::Params::MultiLineEditableText_SetFont)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, SetFontMaterial, "MultiLineEditableText", "SetFontMaterial", SDK::Params::MultiLineEditableText_SetFontMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, SetFontOutlineMaterial, "MultiLineEditableText", "SetFontOutlineMaterial", SDK::Params::MultiLineEditableText_SetFontOutlineMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, SetHintText, "MultiLineEditableText", "SetHintText", SDK::Params::MultiLineEditableText_SetHintText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, SetIsReadOnly, "MultiLineEditableText", "SetIsReadOnly", SDK::Params::MultiLineEditableText_SetIsReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, SetText, "MultiLineEditableText", "SetText", SDK::Params::MultiLineEditableText_SetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, SetWidgetStyle, "MultiLineEditableText", "SetWidgetStyle", SDK::Params::MultiLineEditableText_SetWidgetStyle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, GetFont, "MultiLineEditableText", "GetFont", SDK::Params::MultiLineEditableText_GetFont)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, GetHintText, "MultiLineEditableText", "GetHintText", SDK::Params::MultiLineEditableText_GetHintText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableText, GetText, "MultiLineEditableText", "GetText", SDK::Params::MultiLineEditableText_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableTextBox, SetError, "MultiLineEditableTextBox", "SetError", SDK::Params::MultiLineEditableTextBox_SetError)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableTextBox, SetForegroundColor, "MultiLineEditableTextBox", "SetForegroundColor", SDK::Params::MultiLineEditableTextBox_SetForegroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableTextBox, SetHintText, "MultiLineEditableTextBox", "SetHintText", SDK::Params::MultiLineEditableTextBox_SetHintText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableTextBox, SetIsReadOnly, "MultiLineEditableTextBox", "SetIsReadOnly", SDK::Params::MultiLineEditableTextBox_SetIsReadOnly)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableTextBox, SetText, "MultiLineEditableTextBox", "SetText", SDK::Params::MultiLineEditableTextBox_SetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableTextBox, SetTextStyle, "MultiLineEditableTextBox", "SetTextStyle", SDK::Params::MultiLineEditableTextBox_SetTextStyle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableTextBox, GetHintText, "MultiLineEditableTextBox", "GetHintText", SDK::Params::MultiLineEditableTextBox_GetHintText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UMultiLineEditableTextBox, GetText, "MultiLineEditableTextBox", "GetText", SDK::Params::MultiLineEditableTextBox_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOverlay, AddChildToOverlay, "Overlay", "AddChildToOverlay", SDK::Params::Overlay_AddChildToOverlay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOverlay, ReplaceOverlayChildAt, "Overlay", "ReplaceOverlayChildAt", SDK::Params::Overlay_ReplaceOverlayChildAt)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOverlaySlot, SetHorizontalAlignment, "OverlaySlot", "SetHorizontalAlignment", SDK::Params::OverlaySlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOverlaySlot, SetPadding, "OverlaySlot", "SetPadding", SDK::Params::OverlaySlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UOverlaySlot, SetVerticalAlignment, "OverlaySlot", "SetVerticalAlignment", SDK::Params::OverlaySlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProgressBar, SetFillColorAndOpacity, "ProgressBar", "SetFillColorAndOpacity", SDK::Params::ProgressBar_SetFillColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProgressBar, SetIsMarquee, "ProgressBar", "SetIsMarquee", SDK::Params::ProgressBar_SetIsMarquee)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UProgressBar, SetPercent, "ProgressBar", "SetPercent", SDK::Params::ProgressBar_SetPercent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URetainerBox, RequestRender, "RetainerBox", "RequestRender", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URetainerBox, SetEffectMaterial, "RetainerBox", "SetEffectMaterial", SDK::Params::RetainerBox_SetEffectMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URetainerBox, SetRenderingPhase, "RetainerBox", "SetRenderingPhase", SDK::Params::RetainerBox_SetRenderingPhase)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URetainerBox, SetRetainRendering, "RetainerBox", "SetRetainRendering", SDK::Params::RetainerBox_SetRetainRendering)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URetainerBox, SetTextureParameter, "RetainerBox", "SetTextureParameter", SDK::Params::RetainerBox_SetTextureParameter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URetainerBox, GetEffectMaterial, "RetainerBox", "GetEffectMaterial", SDK::Params::RetainerBox_GetEffectMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, ClearAllDefaultStyleOverrides, "RichTextBlock", "ClearAllDefaultStyleOverrides", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, GetDecoratorByClass, "RichTextBlock", "GetDecoratorByClass", SDK::Params::RichTextBlock_GetDecoratorByClass)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, GetDefaultDynamicMaterial, "RichTextBlock", "GetDefaultDynamicMaterial", SDK::Params::RichTextBlock_GetDefaultDynamicMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, RefreshTextLayout, "RichTextBlock", "RefreshTextLayout", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetAutoWrapText, "RichTextBlock", "SetAutoWrapText", SDK::Params::RichTextBlock_SetAutoWrapText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetDecorators, "RichTextBlock", "SetDecorators", SDK::Params::RichTextBlock_SetDecorators)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetDefaultColorAndOpacity, "RichTextBlock", "SetDefaultColorAndOpacity", SDK::Params::RichTextBlock_SetDefaultColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetDefaultFont, "RichTextBlock", "SetDefaultFont", SDK::Params::RichTextBlock_SetDefaultFont)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetDefaultMaterial, "RichTextBlock", "SetDefaultMaterial", SDK::Params::RichTextBlock_SetDefaultMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetDefaultShadowColorAndOpacity, "RichTextBlock", "SetDefaultShadowColorAndOpacity", SDK::Params::RichTextBlock_SetDefaultShadowColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetDefaultShadowOffset, "RichTextBlock", "SetDefaultShadowOffset", SDK::Params::RichTextBlock_SetDefaultShadowOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetDefaultStrikeBrush, "RichTextBlock", "SetDefaultStrikeBrush", SDK::Params::RichTextBlock_SetDefaultStrikeBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetDefaultTextStyle, "RichTextBlock", "SetDefaultTextStyle", SDK::Params::RichTextBlock_SetDefaultTextStyle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetMinDesiredWidth, "RichTextBlock", "SetMinDesiredWidth", SDK::Params::RichTextBlock_SetMinDesiredWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetText, "RichTextBlock", "SetText", SDK::Params::RichTextBlock_SetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetTextOverflowPolicy, "RichTextBlock", "SetTextOverflowPolicy", SDK::Params::RichTextBlock_SetTextOverflowPolicy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetTextStyleSet, "RichTextBlock", "SetTextStyleSet", SDK::Params::RichTextBlock_SetTextStyleSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, SetTextTransformPolicy, "RichTextBlock", "SetTextTransformPolicy", SDK::Params::RichTextBlock_SetTextTransformPolicy)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, GetText, "RichTextBlock", "GetText", SDK::Params::RichTextBlock_GetText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(URichTextBlock, GetTextStyleSet, "RichTextBlock", "GetTextStyleSet", SDK::Params::RichTextBlock_GetTextStyleSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USafeZone, SetSidesToPad, "SafeZone", "SetSidesToPad", SDK::Params::SafeZone_SetSidesToPad)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScaleBox, SetIgnoreInheritedScale, "ScaleBox", "SetIgnoreInheritedScale", SDK::Params::ScaleBox_SetIgnoreInheritedScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScaleBox, SetStretch, "ScaleBox", "SetStretch", SDK::Params::ScaleBox_SetStretch)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScaleBox, SetStretchDirection, "ScaleBox", "SetStretchDirection", SDK::Params::ScaleBox_SetStretchDirection)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScaleBox, SetUserSpecifiedScale, "ScaleBox", "SetUserSpecifiedScale", SDK::Params::ScaleBox_SetUserSpecifiedScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScaleBoxSlot, SetHorizontalAlignment, "ScaleBoxSlot", "SetHorizontalAlignment", SDK::Params::ScaleBoxSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScaleBoxSlot, SetPadding, "ScaleBoxSlot", "SetPadding", SDK::Params::ScaleBoxSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScaleBoxSlot, SetVerticalAlignment, "ScaleBoxSlot", "SetVerticalAlignment", SDK::Params::ScaleBoxSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBar, SetState, "ScrollBar", "SetState", SDK::Params::ScrollBar_SetState)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, EndInertialScrolling, "ScrollBox", "EndInertialScrolling", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, ScrollToEnd, "ScrollBox", "ScrollToEnd", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, ScrollToStart, "ScrollBox", "ScrollToStart", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, ScrollWidgetIntoView, "ScrollBox", "ScrollWidgetIntoView", SDK::Params::ScrollBox_ScrollWidgetIntoView)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetAllowOverscroll, "ScrollBox", "SetAllowOverscroll", SDK::Params::ScrollBox_SetAllowOverscroll)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetAlwaysShowScrollbar, "ScrollBox", "SetAlwaysShowScrollbar", SDK::Params::ScrollBox_SetAlwaysShowScrollbar)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetAnimateWheelScrolling, "ScrollBox", "SetAnimateWheelScrolling", SDK::Params::ScrollBox_SetAnimateWheelScrolling)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetConsumeMouseWheel, "ScrollBox", "SetConsumeMouseWheel", SDK::Params::ScrollBox_SetConsumeMouseWheel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetNavigationDestination, "ScrollBox", "SetNavigationDestination", SDK::Params::ScrollBox_SetNavigationDestination)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetOrientation, "ScrollBox", "SetOrientation", SDK::Params::ScrollBox_SetOrientation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetScrollbarPadding, "ScrollBox", "SetScrollbarPadding", SDK::Params::ScrollBox_SetScrollbarPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetScrollbarThickness, "ScrollBox", "SetScrollbarThickness", SDK::Params::ScrollBox_SetScrollbarThickness)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetScrollbarVisibility, "ScrollBox", "SetScrollbarVisibility", SDK::Params::ScrollBox_SetScrollbarVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetScrollOffset, "ScrollBox", "SetScrollOffset", SDK::Params::ScrollBox_SetScrollOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetScrollWhenFocusChanges, "ScrollBox", "SetScrollWhenFocusChanges", SDK::Params::ScrollBox_SetScrollWhenFocusChanges)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, SetWheelScrollMultiplier, "ScrollBox", "SetWheelScrollMultiplier", SDK::Params::ScrollBox_SetWheelScrollMultiplier)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, GetScrollOffset, "ScrollBox", "GetScrollOffset", SDK::Params::ScrollBox_GetScrollOffset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, GetScrollOffsetOfEnd, "ScrollBox", "GetScrollOffsetOfEnd", SDK::Params::ScrollBox_GetScrollOffsetOfEnd)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, GetViewFraction, "ScrollBox", "GetViewFraction", SDK::Params::ScrollBox_GetViewFraction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBox, GetViewOffsetFraction, "ScrollBox", "GetViewOffsetFraction", SDK::Params::ScrollBox_GetViewOffsetFraction)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBoxSlot, SetHorizontalAlignment, "ScrollBoxSlot", "SetHorizontalAlignment", SDK::Params::ScrollBoxSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBoxSlot, SetPadding, "ScrollBoxSlot", "SetPadding", SDK::Params::ScrollBoxSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UScrollBoxSlot, SetVerticalAlignment, "ScrollBoxSlot", "SetVerticalAlignment", SDK::Params::ScrollBoxSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, ClearHeightOverride, "SizeBox", "ClearHeightOverride", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, ClearMaxAspectRatio, "SizeBox", "ClearMaxAspectRatio", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, ClearMaxDesiredHeight, "SizeBox", "ClearMaxDesiredHeight", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, ClearMaxDesiredWidth, "SizeBox", "ClearMaxDesiredWidth", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, ClearMinAspectRatio, "SizeBox", "ClearMinAspectRatio", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, ClearMinDesiredHeight, "SizeBox", "ClearMinDesiredHeight", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, ClearMinDesiredWidth, "SizeBox", "ClearMinDesiredWidth", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, ClearWidthOverride, "SizeBox", "ClearWidthOverride", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, SetHeightOverride, "SizeBox", "SetHeightOverride", SDK::Params::SizeBox_SetHeightOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, SetMaxAspectRatio, "SizeBox", "SetMaxAspectRatio", SDK::Params::SizeBox_SetMaxAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, SetMaxDesiredHeight, "SizeBox", "SetMaxDesiredHeight", SDK::Params::SizeBox_SetMaxDesiredHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, SetMaxDesiredWidth, "SizeBox", "SetMaxDesiredWidth", SDK::Params::SizeBox_SetMaxDesiredWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, SetMinAspectRatio, "SizeBox", "SetMinAspectRatio", SDK::Params::SizeBox_SetMinAspectRatio)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, SetMinDesiredHeight, "SizeBox", "SetMinDesiredHeight", SDK::Params::SizeBox_SetMinDesiredHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, SetMinDesiredWidth, "SizeBox", "SetMinDesiredWidth", SDK::Params::SizeBox_SetMinDesiredWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBox, SetWidthOverride, "SizeBox", "SetWidthOverride", SDK::Params::SizeBox_SetWidthOverride)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBoxSlot, SetHorizontalAlignment, "SizeBoxSlot", "SetHorizontalAlignment", SDK::Params::SizeBoxSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBoxSlot, SetPadding, "SizeBoxSlot", "SetPadding", SDK::Params::SizeBoxSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USizeBoxSlot, SetVerticalAlignment, "SizeBoxSlot", "SetVerticalAlignment", SDK::Params::SizeBoxSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, SetIndentHandle, "Slider", "SetIndentHandle", SDK::Params::Slider_SetIndentHandle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, SetLocked, "Slider", "SetLocked", SDK::Params::Slider_SetLocked)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, SetMaxValue, "Slider", "SetMaxValue", SDK::Params::Slider_SetMaxValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, SetMinValue, "Slider", "SetMinValue", SDK::Params::Slider_SetMinValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, SetSliderBarColor, "Slider", "SetSliderBarColor", SDK::Params::Slider_SetSliderBarColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, SetSliderHandleColor, "Slider", "SetSliderHandleColor", SDK::Params::Slider_SetSliderHandleColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, SetStepSize, "Slider", "SetStepSize", SDK::Params::Slider_SetStepSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, SetValue, "Slider", "SetValue", SDK::Params::Slider_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, GetNormalizedValue, "Slider", "GetNormalizedValue", SDK::Params::Slider_GetNormalizedValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlider, GetValue, "Slider", "GetValue", SDK::Params::Slider_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpacer, SetSize, "Spacer", "SetSize", SDK::Params::Spacer_SetSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, ClearMaxSliderValue, "SpinBox", "ClearMaxSliderValue", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, ClearMaxValue, "SpinBox", "ClearMaxValue", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, ClearMinSliderValue, "SpinBox", "ClearMinSliderValue", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, ClearMinValue, "SpinBox", "ClearMinValue", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetAlwaysUsesDeltaSnap, "SpinBox", "SetAlwaysUsesDeltaSnap", SDK::Params::SpinBox_SetAlwaysUsesDeltaSnap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetDelta, "SpinBox", "SetDelta", SDK::Params::SpinBox_SetDelta)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetForegroundColor, "SpinBox", "SetForegroundColor", SDK::Params::SpinBox_SetForegroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetMaxFractionalDigits, "SpinBox", "SetMaxFractionalDigits", SDK::Params::SpinBox_SetMaxFractionalDigits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetMaxSliderValue, "SpinBox", "SetMaxSliderValue", SDK::Params::SpinBox_SetMaxSliderValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetMaxValue, "SpinBox", "SetMaxValue", SDK::Params::SpinBox_SetMaxValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetMinFractionalDigits, "SpinBox", "SetMinFractionalDigits", SDK::Params::SpinBox_SetMinFractionalDigits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetMinSliderValue, "SpinBox", "SetMinSliderValue", SDK::Params::SpinBox_SetMinSliderValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetMinValue, "SpinBox", "SetMinValue", SDK::Params::SpinBox_SetMinValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, SetValue, "SpinBox", "SetValue", SDK::Params::SpinBox_SetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetAlwaysUsesDeltaSnap, "SpinBox", "GetAlwaysUsesDeltaSnap", SDK::Params::SpinBox_GetAlwaysUsesDeltaSnap)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetDelta, "SpinBox", "GetDelta", SDK::Params::SpinBox_GetDelta)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetMaxFractionalDigits, "SpinBox", "GetMaxFractionalDigits", SDK::Params::SpinBox_GetMaxFractionalDigits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetMaxSliderValue, "SpinBox", "GetMaxSliderValue", SDK::Params::SpinBox_GetMaxSliderValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetMaxValue, "SpinBox", "GetMaxValue", SDK::Params::SpinBox_GetMaxValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetMinFractionalDigits, "SpinBox", "GetMinFractionalDigits", SDK::Params::SpinBox_GetMinFractionalDigits)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetMinSliderValue, "SpinBox", "GetMinSliderValue", SDK::Params::SpinBox_GetMinSliderValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetMinValue, "SpinBox", "GetMinValue", SDK::Params::SpinBox_GetMinValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USpinBox, GetValue, "SpinBox", "GetValue", SDK::Params::SpinBox_GetValue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UThrobber, SetAnimateHorizontally, "Throbber", "SetAnimateHorizontally", SDK::Params::Throbber_SetAnimateHorizontally)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UThrobber, SetAnimateOpacity, "Throbber", "SetAnimateOpacity", SDK::Params::Throbber_SetAnimateOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UThrobber, SetAnimateVertically, "Throbber", "SetAnimateVertically", SDK::Params::Throbber_SetAnimateVertically)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UThrobber, SetNumberOfPieces, "Throbber", "SetNumberOfPieces", SDK::Params::Throbber_SetNumberOfPieces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileView, SetEntryHeight, "TileView", "SetEntryHeight", SDK::Params::TileView_SetEntryHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileView, SetEntryWidth, "TileView", "SetEntryWidth", SDK::Params::TileView_SetEntryWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileView, GetEntryHeight, "TileView", "GetEntryHeight", SDK::Params::TileView_GetEntryHeight)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileView, GetEntryWidth, "TileView", "GetEntryWidth", SDK::Params::TileView_GetEntryWidth)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTileView, IsAligned, "TileView", "IsAligned", SDK::Params::TileView_IsAligned)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTreeView, CollapseAll, "TreeView", "CollapseAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTreeView, ExpandAll, "TreeView", "ExpandAll", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UTreeView, SetItemExpansion, "TreeView", "SetItemExpansion", SDK::Params::TreeView_SetItemExpansion)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformGridSlot, SetColumn, "UniformGridSlot", "SetColumn", SDK::Params::UniformGridSlot_SetColumn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformGridSlot, SetHorizontalAlignment, "UniformGridSlot", "SetHorizontalAlignment", SDK::Params::UniformGridSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformGridSlot, SetRow, "UniformGridSlot", "SetRow", SDK::Params::UniformGridSlot_SetRow)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UUniformGridSlot, SetVerticalAlignment, "UniformGridSlot", "SetVerticalAlignment", SDK::Params::UniformGridSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVerticalBoxSlot, SetHorizontalAlignment, "VerticalBoxSlot", "SetHorizontalAlignment", SDK::Params::VerticalBoxSlot_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVerticalBoxSlot, SetPadding, "VerticalBoxSlot", "SetPadding", SDK::Params::VerticalBoxSlot_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVerticalBoxSlot, SetSize, "VerticalBoxSlot", "SetSize", SDK::Params::VerticalBoxSlot_SetSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVerticalBoxSlot, SetVerticalAlignment, "VerticalBoxSlot", "SetVerticalAlignment", SDK::Params::VerticalBoxSlot_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, SetEnableAdvancedFeatures, "Viewport", "SetEnableAdvancedFeatures", SDK::Params::Viewport_SetEnableAdvancedFeatures)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, SetLightIntensity, "Viewport", "SetLightIntensity", SDK::Params::Viewport_SetLightIntensity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, SetShowFlag, "Viewport", "SetShowFlag", SDK::Params::Viewport_SetShowFlag)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, SetSkyIntensity, "Viewport", "SetSkyIntensity", SDK::Params::Viewport_SetSkyIntensity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, SetViewLocation, "Viewport", "SetViewLocation", SDK::Params::Viewport_SetViewLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, SetViewRotation, "Viewport", "SetViewRotation", SDK::Params::Viewport_SetViewRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, Spawn, "Viewport", "Spawn", SDK::Params::Viewport_Spawn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, GetViewLocation, "Viewport", "GetViewLocation", SDK::Params::Viewport_GetViewLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, GetViewportWorld, "Viewport", "GetViewportWorld", SDK::Params::Viewport_GetViewportWorld)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UViewport, GetViewRotation, "Viewport", "GetViewRotation", SDK::Params::Viewport_GetViewRotation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, RequestRedraw, "WidgetComponent", "RequestRedraw", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, RequestRenderUpdate, "WidgetComponent", "RequestRenderUpdate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetBackgroundColor, "WidgetComponent", "SetBackgroundColor", SDK::Params::WidgetComponent_SetBackgroundColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetCylinderArcAngle, "WidgetComponent", "SetCylinderArcAngle", SDK::Params::WidgetComponent_SetCylinderArcAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetDrawAtDesiredSize, "WidgetComponent", "SetDrawAtDesiredSize", SDK::Params::WidgetComponent_SetDrawAtDesiredSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetDrawSize, "WidgetComponent", "SetDrawSize", SDK::Params::WidgetComponent_SetDrawSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetGeometryMode, "WidgetComponent", "SetGeometryMode", SDK::Params::WidgetComponent_SetGeometryMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetManuallyRedraw, "WidgetComponent", "SetManuallyRedraw", SDK::Params::WidgetComponent_SetManuallyRedraw)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetOwnerPlayer, "WidgetComponent", "SetOwnerPlayer", SDK::Params::WidgetComponent_SetOwnerPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetPivot, "WidgetComponent", "SetPivot", SDK::Params::WidgetComponent_SetPivot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetRedrawTime, "WidgetComponent", "SetRedrawTime", SDK::Params::WidgetComponent_SetRedrawTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetTickMode, "WidgetComponent", "SetTickMode", SDK::Params::WidgetComponent_SetTickMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetTickWhenOffscreen, "WidgetComponent", "SetTickWhenOffscreen", SDK::Params::WidgetComponent_SetTickWhenOffscreen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetTintColorAndOpacity, "WidgetComponent", "SetTintColorAndOpacity", SDK::Params::WidgetComponent_SetTintColorAndOpacity)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetTwoSided, "WidgetComponent", "SetTwoSided", SDK::Params::WidgetComponent_SetTwoSided)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetWidget, "WidgetComponent", "SetWidget", SDK::Params::WidgetComponent_SetWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetWidgetSpace, "WidgetComponent", "SetWidgetSpace", SDK::Params::WidgetComponent_SetWidgetSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetWindowFocusable, "WidgetComponent", "SetWindowFocusable", SDK::Params::WidgetComponent_SetWindowFocusable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, SetWindowVisibility, "WidgetComponent", "SetWindowVisibility", SDK::Params::WidgetComponent_SetWindowVisibility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetCurrentDrawSize, "WidgetComponent", "GetCurrentDrawSize", SDK::Params::WidgetComponent_GetCurrentDrawSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetCylinderArcAngle, "WidgetComponent", "GetCylinderArcAngle", SDK::Params::WidgetComponent_GetCylinderArcAngle)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetDrawAtDesiredSize, "WidgetComponent", "GetDrawAtDesiredSize", SDK::Params::WidgetComponent_GetDrawAtDesiredSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetDrawSize, "WidgetComponent", "GetDrawSize", SDK::Params::WidgetComponent_GetDrawSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetGeometryMode, "WidgetComponent", "GetGeometryMode", SDK::Params::WidgetComponent_GetGeometryMode)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetManuallyRedraw, "WidgetComponent", "GetManuallyRedraw", SDK::Params::WidgetComponent_GetManuallyRedraw)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetMaterialInstance, "WidgetComponent", "GetMaterialInstance", SDK::Params::WidgetComponent_GetMaterialInstance)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetOwnerPlayer, "WidgetComponent", "GetOwnerPlayer", SDK::Params::WidgetComponent_GetOwnerPlayer)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetPivot, "WidgetComponent", "GetPivot", SDK::Params::WidgetComponent_GetPivot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetRedrawTime, "WidgetComponent", "GetRedrawTime", SDK::Params::WidgetComponent_GetRedrawTime)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetRenderTarget, "WidgetComponent", "GetRenderTarget", SDK::Params::WidgetComponent_GetRenderTarget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetTickWhenOffscreen, "WidgetComponent", "GetTickWhenOffscreen", SDK::Params::WidgetComponent_GetTickWhenOffscreen)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetTwoSided, "WidgetComponent", "GetTwoSided", SDK::Params::WidgetComponent_GetTwoSided)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetUserWidgetObject, "WidgetComponent", "GetUserWidgetObject", SDK::Params::WidgetComponent_GetUserWidgetObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetWidget, "WidgetComponent", "GetWidget", SDK::Params::WidgetComponent_GetWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetWidgetSpace, "WidgetComponent", "GetWidgetSpace", SDK::Params::WidgetComponent_GetWidgetSpace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetWindowFocusable, "WidgetComponent", "GetWindowFocusable", SDK::Params::WidgetComponent_GetWindowFocusable)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, GetWindowVisiblility, "WidgetComponent", "GetWindowVisiblility", SDK::Params::WidgetComponent_GetWindowVisiblility)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetComponent, IsWidgetVisible, "WidgetComponent", "IsWidgetVisible", SDK::Params::WidgetComponent_IsWidgetVisible)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, PressAndReleaseKey, "WidgetInteractionComponent", "PressAndReleaseKey", SDK::Params::WidgetInteractionComponent_PressAndReleaseKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, PressKey, "WidgetInteractionComponent", "PressKey", SDK::Params::WidgetInteractionComponent_PressKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, PressPointerKey, "WidgetInteractionComponent", "PressPointerKey", SDK::Params::WidgetInteractionComponent_PressPointerKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, ReleaseKey, "WidgetInteractionComponent", "ReleaseKey", SDK::Params::WidgetInteractionComponent_ReleaseKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, ReleasePointerKey, "WidgetInteractionComponent", "ReleasePointerKey", SDK::Params::WidgetInteractionComponent_ReleasePointerKey)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, ScrollWheel, "WidgetInteractionComponent", "ScrollWheel", SDK::Params::WidgetInteractionComponent_ScrollWheel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, SendKeyChar, "WidgetInteractionComponent", "SendKeyChar", SDK::Params::WidgetInteractionComponent_SendKeyChar)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, SetCustomHitResult, "WidgetInteractionComponent", "SetCustomHitResult", SDK::Params::WidgetInteractionComponent_SetCustomHitResult)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, SetFocus, "WidgetInteractionComponent", "SetFocus", SDK::Params::WidgetInteractionComponent_SetFocus)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, Get2DHitLocation, "WidgetInteractionComponent", "Get2DHitLocation", SDK::Params::WidgetInteractionComponent_Get2DHitLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, GetHoveredWidgetComponent, "WidgetInteractionComponent", "GetHoveredWidgetComponent", SDK::Params::WidgetInteractionComponent_GetHoveredWidgetComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, GetLastHitResult, "WidgetInteractionComponent", "GetLastHitResult", SDK::Params::WidgetInteractionComponent_GetLastHitResult)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, IsOverFocusableWidget, "WidgetInteractionComponent", "IsOverFocusableWidget", SDK::Params::WidgetInteractionComponent_IsOverFocusableWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, IsOverHitTestVisibleWidget, "WidgetInteractionComponent", "IsOverHitTestVisibleWidget", SDK::Params::WidgetInteractionComponent_IsOverHitTestVisibleWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetInteractionComponent, IsOverInteractableWidget, "WidgetInteractionComponent", "IsOverInteractableWidget", SDK::Params::WidgetInteractionComponent_IsOverInteractableWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcher, SetActiveWidget, "WidgetSwitcher", "SetActiveWidget", SDK::Params::WidgetSwitcher_SetActiveWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcher, SetActiveWidgetIndex, "WidgetSwitcher", "SetActiveWidgetIndex", SDK::Params::WidgetSwitcher_SetActiveWidgetIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcher, GetActiveWidget, "WidgetSwitcher", "GetActiveWidget", SDK::Params::WidgetSwitcher_GetActiveWidget)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcher, GetActiveWidgetIndex, "WidgetSwitcher", "GetActiveWidgetIndex", SDK::Params::WidgetSwitcher_GetActiveWidgetIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcher, GetNumWidgets, "WidgetSwitcher", "GetNumWidgets", SDK::Params::WidgetSwitcher_GetNumWidgets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetSwitcher, GetWidgetAtIndex, "WidgetSwitcher", "GetWidgetAtIndex", SDK::Params::WidgetSwitcher_GetWidgetAtIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWindowTitleBarArea, SetHorizontalAlignment, "WindowTitleBarArea", "SetHorizontalAlignment", SDK::Params::WindowTitleBarArea_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWindowTitleBarArea, SetPadding, "WindowTitleBarArea", "SetPadding", SDK::Params::WindowTitleBarArea_SetPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWindowTitleBarArea, SetVerticalAlignment, "WindowTitleBarArea", "SetVerticalAlignment", SDK::Params::WindowTitleBarArea_SetVerticalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBox, AddChildToWrapBox, "WrapBox", "AddChildToWrapBox", SDK::Params::WrapBox_AddChildToWrapBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBox, SetHorizontalAlignment, "WrapBox", "SetHorizontalAlignment", SDK::Params::WrapBox_SetHorizontalAlignment)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWrapBox, SetInnerSlotPadding, "WrapBox", "SetInnerSlotPadding", SDK::Params::WrapBox_SetInnerSlotPadding)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDragDropOperation, DragCancelled, "DragDropOperation", "DragCancelled", SDK::Params::DragDropOperation_DragCancelled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDragDropOperation, Dragged, "DragDropOperation", "Dragged", SDK::Params::DragDropOperation_Dragged)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UDragDropOperation, Drop, "DragDropOperation", "Drop", SDK::Params::DragDropOperation_Drop)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, AbsoluteToLocal, "SlateBlueprintLibrary", "AbsoluteToLocal", SDK::Params::SlateBlueprintLibrary_AbsoluteToLocal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, AbsoluteToViewport, "SlateBlueprintLibrary", "AbsoluteToViewport", SDK::Params::SlateBlueprintLibrary_AbsoluteToViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, EqualEqual_SlateBrush, "SlateBlueprintLibrary", "EqualEqual_SlateBrush", SDK::Params::SlateBlueprintLibrary_EqualEqual_SlateBrush)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, GetAbsoluteSize, "SlateBlueprintLibrary", "GetAbsoluteSize", SDK::Params::SlateBlueprintLibrary_GetAbsoluteSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, GetLocalSize, "SlateBlueprintLibrary", "GetLocalSize", SDK::Params::SlateBlueprintLibrary_GetLocalSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, GetLocalTopLeft, "SlateBlueprintLibrary", "GetLocalTopLeft", SDK::Params::SlateBlueprintLibrary_GetLocalTopLeft)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, IsUnderLocation, "SlateBlueprintLibrary", "IsUnderLocation", SDK::Params::SlateBlueprintLibrary_IsUnderLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, LocalToAbsolute, "SlateBlueprintLibrary", "LocalToAbsolute", SDK::Params::SlateBlueprintLibrary_LocalToAbsolute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, LocalToViewport, "SlateBlueprintLibrary", "LocalToViewport", SDK::Params::SlateBlueprintLibrary_LocalToViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, ScreenToViewport, "SlateBlueprintLibrary", "ScreenToViewport", SDK::Params::SlateBlueprintLibrary_ScreenToViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, ScreenToWidgetAbsolute, "SlateBlueprintLibrary", "ScreenToWidgetAbsolute", SDK::Params::SlateBlueprintLibrary_ScreenToWidgetAbsolute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, ScreenToWidgetLocal, "SlateBlueprintLibrary", "ScreenToWidgetLocal", SDK::Params::SlateBlueprintLibrary_ScreenToWidgetLocal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, TransformScalarAbsoluteToLocal, "SlateBlueprintLibrary", "TransformScalarAbsoluteToLocal", SDK::Params::SlateBlueprintLibrary_TransformScalarAbsoluteToLocal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, TransformScalarLocalToAbsolute, "SlateBlueprintLibrary", "TransformScalarLocalToAbsolute", SDK::Params::SlateBlueprintLibrary_TransformScalarLocalToAbsolute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, TransformVectorAbsoluteToLocal, "SlateBlueprintLibrary", "TransformVectorAbsoluteToLocal", SDK::Params::SlateBlueprintLibrary_TransformVectorAbsoluteToLocal)
+BROADSWORD_UFUNCTION_DESCRIPTOR(USlateBlueprintLibrary, TransformVectorLocalToAbsolute, "SlateBlueprintLibrary", "TransformVectorLocalToAbsolute", SDK::Params::SlateBlueprintLibrary_TransformVectorLocalToAbsolute)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, GetMousePositionOnPlatform, "WidgetLayoutLibrary", "GetMousePositionOnPlatform", SDK::Params::WidgetLayoutLibrary_GetMousePositionOnPlatform)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, GetMousePositionOnViewport, "WidgetLayoutLibrary", "GetMousePositionOnViewport", SDK::Params::WidgetLayoutLibrary_GetMousePositionOnViewport)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, GetMousePositionScaledByDPI, "WidgetLayoutLibrary", "GetMousePositionScaledByDPI", SDK::Params::WidgetLayoutLibrary_GetMousePositionScaledByDPI)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, GetPlayerScreenWidgetGeometry, "WidgetLayoutLibrary", "GetPlayerScreenWidgetGeometry", SDK::Params::WidgetLayoutLibrary_GetPlayerScreenWidgetGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, GetViewportScale, "WidgetLayoutLibrary", "GetViewportScale", SDK::Params::WidgetLayoutLibrary_GetViewportScale)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, GetViewportSize, "WidgetLayoutLibrary", "GetViewportSize", SDK::Params::WidgetLayoutLibrary_GetViewportSize)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, GetViewportWidgetGeometry, "WidgetLayoutLibrary", "GetViewportWidgetGeometry", SDK::Params::WidgetLayoutLibrary_GetViewportWidgetGeometry)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, ProjectWorldLocationToWidgetPosition, "WidgetLayoutLibrary", "ProjectWorldLocationToWidgetPosition", SDK::Params::WidgetLayoutLibrary_ProjectWorldLocationToWidgetPosition)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, RemoveAllWidgets, "WidgetLayoutLibrary", "RemoveAllWidgets", SDK::Params::WidgetLayoutLibrary_RemoveAllWidgets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsBorderSlot, "WidgetLayoutLibrary", "SlotAsBorderSlot", SDK::Params::WidgetLayoutLibrary_SlotAsBorderSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsCanvasSlot, "WidgetLayoutLibrary", "SlotAsCanvasSlot", SDK::Params::WidgetLayoutLibrary_SlotAsCanvasSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsGridSlot, "WidgetLayoutLibrary", "SlotAsGridSlot", SDK::Params::WidgetLayoutLibrary_SlotAsGridSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsHorizontalBoxSlot, "WidgetLayoutLibrary", "SlotAsHorizontalBoxSlot", SDK::Params::WidgetLayoutLibrary_SlotAsHorizontalBoxSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsOverlaySlot, "WidgetLayoutLibrary", "SlotAsOverlaySlot", SDK::Params::WidgetLayoutLibrary_SlotAsOverlaySlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsSafeBoxSlot, "WidgetLayoutLibrary", "SlotAsSafeBoxSlot", SDK::Params::WidgetLayoutLibrary_SlotAsSafeBoxSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsScaleBoxSlot, "WidgetLayoutLibrary", "SlotAsScaleBoxSlot", SDK::Params::WidgetLayoutLibrary_SlotAsScaleBoxSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsScrollBoxSlot, "WidgetLayoutLibrary", "SlotAsScrollBoxSlot", SDK::Params::WidgetLayoutLibrary_SlotAsScrollBoxSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsSizeBoxSlot, "WidgetLayoutLibrary", "SlotAsSizeBoxSlot", SDK::Params::WidgetLayoutLibrary_SlotAsSizeBoxSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsUniformGridSlot, "WidgetLayoutLibrary", "SlotAsUniformGridSlot", SDK::Params::WidgetLayoutLibrary_SlotAsUniformGridSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsVerticalBoxSlot, "WidgetLayoutLibrary", "SlotAsVerticalBoxSlot", SDK::Params::WidgetLayoutLibrary_SlotAsVerticalBoxSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsWidgetSwitcherSlot, "WidgetLayoutLibrary", "SlotAsWidgetSwitcherSlot", SDK::Params::WidgetLayoutLibrary_SlotAsWidgetSwitcherSlot)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UWidgetLayoutLibrary, SlotAsWrapBoxSlot, "WidgetLayoutLibrary", "SlotAsWrapBoxSlot", SDK::Params::WidgetLayoutLibrary_SlotAsWrapBoxSlot)
+// clang-format on
@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from VariantManagerContent_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/VariantManagerContent_classes.hpp"
+#include "../SDK/VariantManagerContent_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelVariantSets, GetNumVariantSets, "LevelVariantSets", "GetNumVariantSets", SDK::Params::LevelVariantSets_GetNumVariantSets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelVariantSets, GetVariantSet, "LevelVariantSets", "GetVariantSet", SDK::Params::LevelVariantSets_GetVariantSet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ULevelVariantSets, GetVariantSetByName, "LevelVariantSets", "GetVariantSetByName", SDK::Params::LevelVariantSets_GetVariantSetByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelVariantSetsActor, GetLevelVariantSets, "LevelVariantSetsActor", "GetLevelVariantSets", SDK::Params::LevelVariantSetsActor_GetLevelVariantSets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelVariantSetsActor, SetLevelVariantSets, "LevelVariantSetsActor", "SetLevelVariantSets", SDK::Params::LevelVariantSetsActor_SetLevelVariantSets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelVariantSetsActor, SwitchOnVariantByIndex, "LevelVariantSetsActor", "SwitchOnVariantByIndex", SDK::Params::LevelVariantSetsActor_SwitchOnVariantByIndex)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ALevelVariantSetsActor, SwitchOnVariantByName, "LevelVariantSetsActor", "SwitchOnVariantByName", SDK::Params::LevelVariantSetsActor_SwitchOnVariantByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyValue, GetFullDisplayString, "PropertyValue", "GetFullDisplayString", SDK::Params::PropertyValue_GetFullDisplayString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyValue, GetPropertyTooltip, "PropertyValue", "GetPropertyTooltip", SDK::Params::PropertyValue_GetPropertyTooltip)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UPropertyValue, HasRecordedData, "PropertyValue", "HasRecordedData", SDK::Params::PropertyValue_HasRecordedData)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASwitchActor, SelectOption, "SwitchActor", "SelectOption", SDK::Params::SwitchActor_SelectOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASwitchActor, GetOptions, "SwitchActor", "GetOptions", SDK::Params::SwitchActor_GetOptions)
+BROADSWORD_UFUNCTION_DESCRIPTOR(ASwitchActor, GetSelectedOption, "SwitchActor", "GetSelectedOption", SDK::Params::SwitchActor_GetSelectedOption)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, AddDependency, "Variant", "AddDependency", SDK::Params::Variant_AddDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, DeleteDependency, "Variant", "DeleteDependency", SDK::Params::Variant_DeleteDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, GetActor, "Variant", "GetActor", SDK::Params::Variant_GetActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, GetDependency, "Variant", "GetDependency", SDK::Params::Variant_GetDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, GetDependents, "Variant", "GetDependents", SDK::Params::Variant_GetDependents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, GetNumActors, "Variant", "GetNumActors", SDK::Params::Variant_GetNumActors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, GetNumDependencies, "Variant", "GetNumDependencies", SDK::Params::Variant_GetNumDependencies)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, GetParent, "Variant", "GetParent", SDK::Params::Variant_GetParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, GetThumbnail, "Variant", "GetThumbnail", SDK::Params::Variant_GetThumbnail)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, IsActive, "Variant", "IsActive", SDK::Params::Variant_IsActive)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, SetDependency, "Variant", "SetDependency", SDK::Params::Variant_SetDependency)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, SetDisplayText, "Variant", "SetDisplayText", SDK::Params::Variant_SetDisplayText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, SetThumbnailFromCamera, "Variant", "SetThumbnailFromCamera", SDK::Params::Variant_SetThumbnailFromCamera)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, SetThumbnailFromEditorViewport, "Variant", "SetThumbnailFromEditorViewport", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, SetThumbnailFromFile, "Variant", "SetThumbnailFromFile", SDK::Params::Variant_SetThumbnailFromFile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, SetThumbnailFromTexture, "Variant", "SetThumbnailFromTexture", SDK::Params::Variant_SetThumbnailFromTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, SwitchOn, "Variant", "SwitchOn", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariant, GetDisplayText, "Variant", "GetDisplayText", SDK::Params::Variant_GetDisplayText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, GetParent, "VariantSet", "GetParent", SDK::Params::VariantSet_GetParent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, GetThumbnail, "VariantSet", "GetThumbnail", SDK::Params::VariantSet_GetThumbnail)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, GetVariant, "VariantSet", "GetVariant", SDK::Params::VariantSet_GetVariant)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, GetVariantByName, "VariantSet", "GetVariantByName", SDK::Params::VariantSet_GetVariantByName)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, SetDisplayText, "VariantSet", "SetDisplayText", SDK::Params::VariantSet_SetDisplayText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, SetThumbnailFromCamera, "VariantSet", "SetThumbnailFromCamera", SDK::Params::VariantSet_SetThumbnailFromCamera)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, SetThumbnailFromEditorViewport, "VariantSet", "SetThumbnailFromEditorViewport", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, SetThumbnailFromFile, "VariantSet", "SetThumbnailFromFile", SDK::Params::VariantSet_SetThumbnailFromFile)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, SetThumbnailFromTexture, "VariantSet", "SetThumbnailFromTexture", SDK::Params::VariantSet_SetThumbnailFromTexture)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, GetDisplayText, "VariantSet", "GetDisplayText", SDK::Params::VariantSet_GetDisplayText)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVariantSet, GetNumVariants, "VariantSet", "GetNumVariants", SDK::Params::VariantSet_GetNumVariants)
+// clang-format on
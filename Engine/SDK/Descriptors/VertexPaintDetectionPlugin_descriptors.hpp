@@ -0,0 +1,161 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from VertexPaintDetectionPlugin_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/VertexPaintDetectionPlugin_classes.hpp"
+#include "../SDK/VertexPaintDetectionPlugin_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentGetAllVertexColorsOnlyTasks, "VertexPaintDetectionComponent", "GetCurrentGetAllVertexColorsOnlyTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentGetAllVertexColorsOnlyTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentGetClosestVertexDataTasks, "VertexPaintDetectionComponent", "GetCurrentGetClosestVertexDataTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentGetClosestVertexDataTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentGetColorsWithinAreaTasks, "VertexPaintDetectionComponent", "GetCurrentGetColorsWithinAreaTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentGetColorsWithinAreaTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentPaintAtLocationTasks, "VertexPaintDetectionComponent", "GetCurrentPaintAtLocationTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentPaintAtLocationTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentPaintColorSnippetTasks, "VertexPaintDetectionComponent", "GetCurrentPaintColorSnippetTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentPaintColorSnippetTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentPaintEntireMeshTasks, "VertexPaintDetectionComponent", "GetCurrentPaintEntireMeshTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentPaintEntireMeshTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentPaintWithinAreaTasks, "VertexPaintDetectionComponent", "GetCurrentPaintWithinAreaTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentPaintWithinAreaTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentSetMeshComponentVertexColorsTasks, "VertexPaintDetectionComponent", "GetCurrentSetMeshComponentVertexColorsTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentSetMeshComponentVertexColorsTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentSetMeshComponentVertexColorsUsingSerializedStringTasks, "VertexPaintDetectionComponent", "GetCurrentSetMeshComponentVertexColorsUsingSerializedStringTasks", SDK::Params::VertexPaintDetectionComponent_GetCurrentSetMeshComponentVertexColorsUsingSerializedStringTasks)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentTasksInitiatedByComponent, "VertexPaintDetectionComponent", "GetCurrentTasksInitiatedByComponent", SDK::Params::VertexPaintDetectionComponent_GetCurrentTasksInitiatedByComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetCurrentTasksMeshComponents, "VertexPaintDetectionComponent", "GetCurrentTasksMeshComponents", SDK::Params::VertexPaintDetectionComponent_GetCurrentTasksMeshComponents)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, GetTotalTasksInitiatedByComponent, "VertexPaintDetectionComponent", "GetTotalTasksInitiatedByComponent", SDK::Params::VertexPaintDetectionComponent_GetTotalTasksInitiatedByComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, HasAnyTasksQueuedUp, "VertexPaintDetectionComponent", "HasAnyTasksQueuedUp", SDK::Params::VertexPaintDetectionComponent_HasAnyTasksQueuedUp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionComponent, TaskRemovedByTaskQueue, "VertexPaintDetectionComponent", "TaskRemovedByTaskQueue", SDK::Params::VertexPaintDetectionComponent_TaskRemovedByTaskQueue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, AutoPaintDelayFinished, "AutoAddColorComponent", "AutoPaintDelayFinished", SDK::Params::AutoAddColorComponent_AutoPaintDelayFinished)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, AutoPaintedActorDestroyed, "AutoAddColorComponent", "AutoPaintedActorDestroyed", SDK::Params::AutoAddColorComponent_AutoPaintedActorDestroyed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, PauseAllAutoPainting, "AutoAddColorComponent", "PauseAllAutoPainting", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, PauseAutoPaintingMesh, "AutoAddColorComponent", "PauseAutoPaintingMesh", SDK::Params::AutoAddColorComponent_PauseAutoPaintingMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, ResumeAllAutoPainting, "AutoAddColorComponent", "ResumeAllAutoPainting", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, ResumeAutoPaintingMesh, "AutoAddColorComponent", "ResumeAutoPaintingMesh", SDK::Params::AutoAddColorComponent_ResumeAutoPaintingMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, SetIfAutoPaintedMeshShouldOnlyStartNewTaskIfChangeWasMade, "AutoAddColorComponent", "SetIfAutoPaintedMeshShouldOnlyStartNewTaskIfChangeWasMade", SDK::Params::AutoAddColorComponent_SetIfAutoPaintedMeshShouldOnlyStartNewTaskIfChangeWasMade)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, StartNewRoundOfTasks, "AutoAddColorComponent", "StartNewRoundOfTasks", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, StopAllAutoPainting, "AutoAddColorComponent", "StopAllAutoPainting", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, StopAutoPaintingMesh, "AutoAddColorComponent", "StopAutoPaintingMesh", SDK::Params::AutoAddColorComponent_StopAutoPaintingMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, CanAutoPaintedMeshGetPaused, "AutoAddColorComponent", "CanAutoPaintedMeshGetPaused", SDK::Params::AutoAddColorComponent_CanAutoPaintedMeshGetPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, GetIfMeshShouldOnlyStartNewTaskIfChangeWasMade, "AutoAddColorComponent", "GetIfMeshShouldOnlyStartNewTaskIfChangeWasMade", SDK::Params::AutoAddColorComponent_GetIfMeshShouldOnlyStartNewTaskIfChangeWasMade)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, GetIsAutoPainting, "AutoAddColorComponent", "GetIsAutoPainting", SDK::Params::AutoAddColorComponent_GetIsAutoPainting)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, GetMeshesBeingAutoPainted, "AutoAddColorComponent", "GetMeshesBeingAutoPainted", SDK::Params::AutoAddColorComponent_GetMeshesBeingAutoPainted)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, IsAutoPaintedMeshPaused, "AutoAddColorComponent", "IsAutoPaintedMeshPaused", SDK::Params::AutoAddColorComponent_IsAutoPaintedMeshPaused)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorComponent, IsNewRoundOfTasksGoingToStartAfterDelay, "AutoAddColorComponent", "IsNewRoundOfTasksGoingToStartAfterDelay", SDK::Params::AutoAddColorComponent_IsNewRoundOfTasksGoingToStartAfterDelay)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorEntireMeshComponent, AddAutoPaintEntireMesh, "AutoAddColorEntireMeshComponent", "AddAutoPaintEntireMesh", SDK::Params::AutoAddColorEntireMeshComponent_AddAutoPaintEntireMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorEntireMeshComponent, GetAutoPaintingEntireMeshesAdditionalDataSettings, "AutoAddColorEntireMeshComponent", "GetAutoPaintingEntireMeshesAdditionalDataSettings", SDK::Params::AutoAddColorEntireMeshComponent_GetAutoPaintingEntireMeshesAdditionalDataSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorEntireMeshComponent, GetAutoPaintingEntireMeshesPaintSettings, "AutoAddColorEntireMeshComponent", "GetAutoPaintingEntireMeshesPaintSettings", SDK::Params::AutoAddColorEntireMeshComponent_GetAutoPaintingEntireMeshesPaintSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorEntireMeshComponent, UpdateAutoPaintedEntireMesh, "AutoAddColorEntireMeshComponent", "UpdateAutoPaintedEntireMesh", SDK::Params::AutoAddColorEntireMeshComponent_UpdateAutoPaintedEntireMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorPaintAtLocComponent, AddAutoPaintAtLocation, "AutoAddColorPaintAtLocComponent", "AddAutoPaintAtLocation", SDK::Params::AutoAddColorPaintAtLocComponent_AddAutoPaintAtLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorPaintAtLocComponent, GetAutoPaintingAtLocationAdditionalDataSettings, "AutoAddColorPaintAtLocComponent", "GetAutoPaintingAtLocationAdditionalDataSettings", SDK::Params::AutoAddColorPaintAtLocComponent_GetAutoPaintingAtLocationAdditionalDataSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorPaintAtLocComponent, GetAutoPaintingAtLocationPaintSettings, "AutoAddColorPaintAtLocComponent", "GetAutoPaintingAtLocationPaintSettings", SDK::Params::AutoAddColorPaintAtLocComponent_GetAutoPaintingAtLocationPaintSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorPaintAtLocComponent, UpdateAutoPaintedAtLocation, "AutoAddColorPaintAtLocComponent", "UpdateAutoPaintedAtLocation", SDK::Params::AutoAddColorPaintAtLocComponent_UpdateAutoPaintedAtLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorWithinAreaComponent, AddAutoPaintWithinArea, "AutoAddColorWithinAreaComponent", "AddAutoPaintWithinArea", SDK::Params::AutoAddColorWithinAreaComponent_AddAutoPaintWithinArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorWithinAreaComponent, GetAutoPaintingWithinAreaAdditionalDataSettings, "AutoAddColorWithinAreaComponent", "GetAutoPaintingWithinAreaAdditionalDataSettings", SDK::Params::AutoAddColorWithinAreaComponent_GetAutoPaintingWithinAreaAdditionalDataSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorWithinAreaComponent, GetAutoPaintingWithinAreaPaintSettings, "AutoAddColorWithinAreaComponent", "GetAutoPaintingWithinAreaPaintSettings", SDK::Params::AutoAddColorWithinAreaComponent_GetAutoPaintingWithinAreaPaintSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UAutoAddColorWithinAreaComponent, UpdateAutoPaintedWithinArea, "AutoAddColorWithinAreaComponent", "UpdateAutoPaintedWithinArea", SDK::Params::AutoAddColorWithinAreaComponent_UpdateAutoPaintedWithinArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintClothOverlapComponent, GetClothObjectsToSphereTrace, "VertexPaintClothOverlapComponent", "GetClothObjectsToSphereTrace", SDK::Params::VertexPaintClothOverlapComponent_GetClothObjectsToSphereTrace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintClothOverlapComponent, OnRep_ClothOverlapTracingEnabled, "VertexPaintClothOverlapComponent", "OnRep_ClothOverlapTracingEnabled", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintClothOverlapComponent, SetClothObjectsTypesToSphereTrace, "VertexPaintClothOverlapComponent", "SetClothObjectsTypesToSphereTrace", SDK::Params::VertexPaintClothOverlapComponent_SetClothObjectsTypesToSphereTrace)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintClothOverlapComponent, SetClothOverlapTracingEnabled, "VertexPaintClothOverlapComponent", "SetClothOverlapTracingEnabled", SDK::Params::VertexPaintClothOverlapComponent_SetClothOverlapTracingEnabled)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintColorSnippetRefs, CheckAndGetTheComponentsThatMatchGroupChildSnippets, "VertexPaintColorSnippetRefs", "CheckAndGetTheComponentsThatMatchGroupChildSnippets", SDK::Params::VertexPaintColorSnippetRefs_CheckAndGetTheComponentsThatMatchGroupChildSnippets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintColorSnippetRefs, ContainsColorSnippet, "VertexPaintColorSnippetRefs", "ContainsColorSnippet", SDK::Params::VertexPaintColorSnippetRefs_ContainsColorSnippet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintColorSnippetRefs, GetAllColorSnippetsAndDataAssetForObject, "VertexPaintColorSnippetRefs", "GetAllColorSnippetsAndDataAssetForObject", SDK::Params::VertexPaintColorSnippetRefs_GetAllColorSnippetsAndDataAssetForObject)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintColorSnippetRefs, GetAllColorSnippetsInSpecifiedDataAsset, "VertexPaintColorSnippetRefs", "GetAllColorSnippetsInSpecifiedDataAsset", SDK::Params::VertexPaintColorSnippetRefs_GetAllColorSnippetsInSpecifiedDataAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintColorSnippetRefs, GetAllGroupSnippetsInSpecifiedDataAsset, "VertexPaintColorSnippetRefs", "GetAllGroupSnippetsInSpecifiedDataAsset", SDK::Params::VertexPaintColorSnippetRefs_GetAllGroupSnippetsInSpecifiedDataAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintColorSnippetRefs, GetChildSnippetInfosAssociatedWithGroupSnippetID, "VertexPaintColorSnippetRefs", "GetChildSnippetInfosAssociatedWithGroupSnippetID", SDK::Params::VertexPaintColorSnippetRefs_GetChildSnippetInfosAssociatedWithGroupSnippetID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintColorSnippetRefs, GetObjectFromSnippetID, "VertexPaintColorSnippetRefs", "GetObjectFromSnippetID", SDK::Params::VertexPaintColorSnippetRefs_GetObjectFromSnippetID)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionGISubSystem, RegisteredDetectTaskCallbackOwnerDestroyed, "VertexPaintDetectionGISubSystem", "RegisteredDetectTaskCallbackOwnerDestroyed", SDK::Params::VertexPaintDetectionGISubSystem_RegisteredDetectTaskCallbackOwnerDestroyed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintDetectionGISubSystem, RegisteredPaintTaskCallbackOwnerDestroyed, "VertexPaintDetectionGISubSystem", "RegisteredPaintTaskCallbackOwnerDestroyed", SDK::Params::VertexPaintDetectionGISubSystem_RegisteredPaintTaskCallbackOwnerDestroyed)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, ClothBeginOverlappingMesh, "VertexPaintDetectionInterface", "ClothBeginOverlappingMesh", SDK::Params::VertexPaintDetectionInterface_ClothBeginOverlappingMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, ClothEndOverlappingMesh, "VertexPaintDetectionInterface", "ClothEndOverlappingMesh", SDK::Params::VertexPaintDetectionInterface_ClothEndOverlappingMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, ColorsAppliedOnActor, "VertexPaintDetectionInterface", "ColorsAppliedOnActor", SDK::Params::VertexPaintDetectionInterface_ColorsAppliedOnActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, DetectTaskFinishedOnRegisteredMeshComponent, "VertexPaintDetectionInterface", "DetectTaskFinishedOnRegisteredMeshComponent", SDK::Params::VertexPaintDetectionInterface_DetectTaskFinishedOnRegisteredMeshComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, GetAllVertexColorsOnlyOnActor, "VertexPaintDetectionInterface", "GetAllVertexColorsOnlyOnActor", SDK::Params::VertexPaintDetectionInterface_GetAllVertexColorsOnlyOnActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, GetClosestVertexDataOnActor, "VertexPaintDetectionInterface", "GetClosestVertexDataOnActor", SDK::Params::VertexPaintDetectionInterface_GetClosestVertexDataOnActor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, GetColorsWithinArea, "VertexPaintDetectionInterface", "GetColorsWithinArea", SDK::Params::VertexPaintDetectionInterface_GetColorsWithinArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, GetSkeletalMeshClothPhysicsSettings, "VertexPaintDetectionInterface", "GetSkeletalMeshClothPhysicsSettings", SDK::Params::VertexPaintDetectionInterface_GetSkeletalMeshClothPhysicsSettings)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, OverrideVertexColorToApply, "VertexPaintDetectionInterface", "OverrideVertexColorToApply", SDK::Params::VertexPaintDetectionInterface_OverrideVertexColorToApply)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, PaintedOnActor_AtLocation, "VertexPaintDetectionInterface", "PaintedOnActor_AtLocation", SDK::Params::VertexPaintDetectionInterface_PaintedOnActor_AtLocation)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, PaintedOnActor_EntireMesh, "VertexPaintDetectionInterface", "PaintedOnActor_EntireMesh", SDK::Params::VertexPaintDetectionInterface_PaintedOnActor_EntireMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, PaintedOnActor_PaintColorSnippet, "VertexPaintDetectionInterface", "PaintedOnActor_PaintColorSnippet", SDK::Params::VertexPaintDetectionInterface_PaintedOnActor_PaintColorSnippet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, PaintedOnActor_SetMeshComponentVertexColors, "VertexPaintDetectionInterface", "PaintedOnActor_SetMeshComponentVertexColors", SDK::Params::VertexPaintDetectionInterface_PaintedOnActor_SetMeshComponentVertexColors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, PaintedOnActor_SetMeshComponentVertexColorsUsingSerializedString, "VertexPaintDetectionInterface", "PaintedOnActor_SetMeshComponentVertexColorsUsingSerializedString", SDK::Params::VertexPaintDetectionInterface_PaintedOnActor_SetMeshComponentVertexColorsUsingSerializedString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, PaintedOnActor_WithinArea, "VertexPaintDetectionInterface", "PaintedOnActor_WithinArea", SDK::Params::VertexPaintDetectionInterface_PaintedOnActor_WithinArea)
+BROADSWORD_UFUNCTION_DESCRIPTOR(IVertexPaintDetectionInterface, PaintTaskFinishedOnRegisteredMeshComponent, "VertexPaintDetectionInterface", "PaintTaskFinishedOnRegisteredMeshComponent", SDK::Params::VertexPaintDetectionInterface_PaintTaskFinishedOnRegisteredMeshComponent)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, AdjustBoxCollisionToFillAreaBetweenTwoLocations, "VertexPaintFunctionLibrary", "AdjustBoxCollisionToFillAreaBetweenTwoLocations", SDK::Params::VertexPaintFunctionLibrary_AdjustBoxCollisionToFillAreaBetweenTwoLocations)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, AsyncLoadAssets, "VertexPaintFunctionLibrary", "AsyncLoadAssets", SDK::Params::VertexPaintFunctionLibrary_AsyncLoadAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, CalcAABBWithoutUniformCheck, "VertexPaintFunctionLibrary", "CalcAABBWithoutUniformCheck", SDK::Params::VertexPaintFunctionLibrary_CalcAABBWithoutUniformCheck)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, CollisionChannelToObjectType, "VertexPaintFunctionLibrary", "CollisionChannelToObjectType", SDK::Params::VertexPaintFunctionLibrary_CollisionChannelToObjectType)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, DoesPhysicsSurfaceBelongToPhysicsSurfaceFamily, "VertexPaintFunctionLibrary", "DoesPhysicsSurfaceBelongToPhysicsSurfaceFamily", SDK::Params::VertexPaintFunctionLibrary_DoesPhysicsSurfaceBelongToPhysicsSurfaceFamily)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, DrawPrimitiveComponentBoundsBox, "VertexPaintFunctionLibrary", "DrawPrimitiveComponentBoundsBox", SDK::Params::VertexPaintFunctionLibrary_DrawPrimitiveComponentBoundsBox)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAllColorSnippetsUnderGroupSnippetAsString, "VertexPaintFunctionLibrary", "GetAllColorSnippetsUnderGroupSnippetAsString", SDK::Params::VertexPaintFunctionLibrary_GetAllColorSnippetsUnderGroupSnippetAsString)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAllMeshColorSnippetsAsString_Wrapper, "VertexPaintFunctionLibrary", "GetAllMeshColorSnippetsAsString_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetAllMeshColorSnippetsAsString_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAllMeshColorSnippetsAsTags_Wrapper, "VertexPaintFunctionLibrary", "GetAllMeshColorSnippetsAsTags_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetAllMeshColorSnippetsAsTags_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAllMeshColorSnippetsTagsUnderTagCategory_Wrapper, "VertexPaintFunctionLibrary", "GetAllMeshColorSnippetsTagsUnderTagCategory_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetAllMeshColorSnippetsTagsUnderTagCategory_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAllPhysicsSurfaces, "VertexPaintFunctionLibrary", "GetAllPhysicsSurfaces", SDK::Params::VertexPaintFunctionLibrary_GetAllPhysicsSurfaces)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAllTagsUnderTagCategory, "VertexPaintFunctionLibrary", "GetAllTagsUnderTagCategory", SDK::Params::VertexPaintFunctionLibrary_GetAllTagsUnderTagCategory)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAllVertexColorChannelsPhysicsSurfaceIsRegisteredTo_Wrapper, "VertexPaintFunctionLibrary", "GetAllVertexColorChannelsPhysicsSurfaceIsRegisteredTo_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetAllVertexColorChannelsPhysicsSurfaceIsRegisteredTo_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAmountOfColorSnippetChildsFromGroupSnippet, "VertexPaintFunctionLibrary", "GetAmountOfColorSnippetChildsFromGroupSnippet", SDK::Params::VertexPaintFunctionLibrary_GetAmountOfColorSnippetChildsFromGroupSnippet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAmountOfLODsToPaintOn, "VertexPaintFunctionLibrary", "GetAmountOfLODsToPaintOn", SDK::Params::VertexPaintFunctionLibrary_GetAmountOfLODsToPaintOn)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAmountOfPaintedColorsForEachChannel, "VertexPaintFunctionLibrary", "GetAmountOfPaintedColorsForEachChannel", SDK::Params::VertexPaintFunctionLibrary_GetAmountOfPaintedColorsForEachChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetAmountOfPaintedColorsForEachChannelAsync, "VertexPaintFunctionLibrary", "GetAmountOfPaintedColorsForEachChannelAsync", SDK::Params::VertexPaintFunctionLibrary_GetAmountOfPaintedColorsForEachChannelAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetCalculateColorsDetectionTasksAmount_Wrapper, "VertexPaintFunctionLibrary", "GetCalculateColorsDetectionTasksAmount_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetCalculateColorsDetectionTasksAmount_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetCalculateColorsPaintTasksAmount_Wrapper, "VertexPaintFunctionLibrary", "GetCalculateColorsPaintTasksAmount_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetCalculateColorsPaintTasksAmount_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetChannelsPhysicsSurfaceIsRegisteredTo, "VertexPaintFunctionLibrary", "GetChannelsPhysicsSurfaceIsRegisteredTo", SDK::Params::VertexPaintFunctionLibrary_GetChannelsPhysicsSurfaceIsRegisteredTo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetClothAssets, "VertexPaintFunctionLibrary", "GetClothAssets", SDK::Params::VertexPaintFunctionLibrary_GetClothAssets)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetColorSnippetReferenceDataAsset, "VertexPaintFunctionLibrary", "GetColorSnippetReferenceDataAsset", SDK::Params::VertexPaintFunctionLibrary_GetColorSnippetReferenceDataAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetColorSnippetVertexColorsAsync, "VertexPaintFunctionLibrary", "GetColorSnippetVertexColorsAsync", SDK::Params::VertexPaintFunctionLibrary_GetColorSnippetVertexColorsAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetComponentBoundsBottomWorldZ, "VertexPaintFunctionLibrary", "GetComponentBoundsBottomWorldZ", SDK::Params::VertexPaintFunctionLibrary_GetComponentBoundsBottomWorldZ)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetComponentBoundsTopWorldZ, "VertexPaintFunctionLibrary", "GetComponentBoundsTopWorldZ", SDK::Params::VertexPaintFunctionLibrary_GetComponentBoundsTopWorldZ)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetMeshColorSnippetChildFromGroupSnippet, "VertexPaintFunctionLibrary", "GetMeshColorSnippetChildFromGroupSnippet", SDK::Params::VertexPaintFunctionLibrary_GetMeshColorSnippetChildFromGroupSnippet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetMeshColorSnippetsTagsInTagCategory_Wrapper, "VertexPaintFunctionLibrary", "GetMeshColorSnippetsTagsInTagCategory_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetMeshColorSnippetsTagsInTagCategory_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetMeshComponentAmountOfVerticesOnLOD, "VertexPaintFunctionLibrary", "GetMeshComponentAmountOfVerticesOnLOD", SDK::Params::VertexPaintFunctionLibrary_GetMeshComponentAmountOfVerticesOnLOD)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetMeshComponentSourceMesh, "VertexPaintFunctionLibrary", "GetMeshComponentSourceMesh", SDK::Params::VertexPaintFunctionLibrary_GetMeshComponentSourceMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetMeshComponentVertexColors_Wrapper, "VertexPaintFunctionLibrary", "GetMeshComponentVertexColors_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetMeshComponentVertexColors_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetMeshComponentVertexColorsAtLOD_Wrapper, "VertexPaintFunctionLibrary", "GetMeshComponentVertexColorsAtLOD_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetMeshComponentVertexColorsAtLOD_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetOptimizationDataAsset, "VertexPaintFunctionLibrary", "GetOptimizationDataAsset", SDK::Params::VertexPaintFunctionLibrary_GetOptimizationDataAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetParentsOfPhysicsSurface_Wrapper, "VertexPaintFunctionLibrary", "GetParentsOfPhysicsSurface_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetParentsOfPhysicsSurface_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetPhysicalMaterialUsingPhysicsSurface_Wrapper, "VertexPaintFunctionLibrary", "GetPhysicalMaterialUsingPhysicsSurface_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetPhysicalMaterialUsingPhysicsSurface_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetPhysicsSurfaceFamilies_Wrapper, "VertexPaintFunctionLibrary", "GetPhysicsSurfaceFamilies_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetPhysicsSurfaceFamilies_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetPhysicsSurfacesRegisteredToMaterial, "VertexPaintFunctionLibrary", "GetPhysicsSurfacesRegisteredToMaterial", SDK::Params::VertexPaintFunctionLibrary_GetPhysicsSurfacesRegisteredToMaterial)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetSubstringAfterLastCharacter, "VertexPaintFunctionLibrary", "GetSubstringAfterLastCharacter", SDK::Params::VertexPaintFunctionLibrary_GetSubstringAfterLastCharacter)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetTheGroupSnippetAChildSnippetBelongsTo, "VertexPaintFunctionLibrary", "GetTheGroupSnippetAChildSnippetBelongsTo", SDK::Params::VertexPaintFunctionLibrary_GetTheGroupSnippetAChildSnippetBelongsTo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetTheMostDominantPhysicsSurface_Wrapper, "VertexPaintFunctionLibrary", "GetTheMostDominantPhysicsSurface_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetTheMostDominantPhysicsSurface_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetVertexPaintMaterialDataAsset, "VertexPaintFunctionLibrary", "GetVertexPaintMaterialDataAsset", SDK::Params::VertexPaintFunctionLibrary_GetVertexPaintMaterialDataAsset)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, GetVertexPaintMaterialInterface_Wrapper, "VertexPaintFunctionLibrary", "GetVertexPaintMaterialInterface_Wrapper", SDK::Params::VertexPaintFunctionLibrary_GetVertexPaintMaterialInterface_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, IsAssetsLoaded, "VertexPaintFunctionLibrary", "IsAssetsLoaded", SDK::Params::VertexPaintFunctionLibrary_IsAssetsLoaded)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, IsMaterialAddedToPaintOnMaterialDataAsset_Wrapper, "VertexPaintFunctionLibrary", "IsMaterialAddedToPaintOnMaterialDataAsset_Wrapper", SDK::Params::VertexPaintFunctionLibrary_IsMaterialAddedToPaintOnMaterialDataAsset_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, IsPlayInEditor, "VertexPaintFunctionLibrary", "IsPlayInEditor", SDK::Params::VertexPaintFunctionLibrary_IsPlayInEditor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, IsWorldValid, "VertexPaintFunctionLibrary", "IsWorldValid", SDK::Params::VertexPaintFunctionLibrary_IsWorldValid)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, MultiSphereTraceForClosestUniqueMeshesAndBones_Wrapper, "VertexPaintFunctionLibrary", "MultiSphereTraceForClosestUniqueMeshesAndBones_Wrapper", SDK::Params::VertexPaintFunctionLibrary_MultiSphereTraceForClosestUniqueMeshesAndBones_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, ObjectTypeToCollisionChannel, "VertexPaintFunctionLibrary", "ObjectTypeToCollisionChannel", SDK::Params::VertexPaintFunctionLibrary_ObjectTypeToCollisionChannel)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, RegisterDetectTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper, "VertexPaintFunctionLibrary", "RegisterDetectTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper", SDK::Params::VertexPaintFunctionLibrary_RegisterDetectTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, RegisterPaintTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper, "VertexPaintFunctionLibrary", "RegisterPaintTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper", SDK::Params::VertexPaintFunctionLibrary_RegisterPaintTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, ReliableFColorToFLinearColor, "VertexPaintFunctionLibrary", "ReliableFColorToFLinearColor", SDK::Params::VertexPaintFunctionLibrary_ReliableFColorToFLinearColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, ReliableFLinearToFColor, "VertexPaintFunctionLibrary", "ReliableFLinearToFColor", SDK::Params::VertexPaintFunctionLibrary_ReliableFLinearToFColor)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, RemoveComponentFromDetectTaskQueue, "VertexPaintFunctionLibrary", "RemoveComponentFromDetectTaskQueue", SDK::Params::VertexPaintFunctionLibrary_RemoveComponentFromDetectTaskQueue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, RemoveComponentFromPaintTaskQueue, "VertexPaintFunctionLibrary", "RemoveComponentFromPaintTaskQueue", SDK::Params::VertexPaintFunctionLibrary_RemoveComponentFromPaintTaskQueue)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, SetChaosClothPhysics, "VertexPaintFunctionLibrary", "SetChaosClothPhysics", SDK::Params::VertexPaintFunctionLibrary_SetChaosClothPhysics)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, SetChaosWheeledVehicleFrictionMultiplier_Wrapper, "VertexPaintFunctionLibrary", "SetChaosWheeledVehicleFrictionMultiplier_Wrapper", SDK::Params::VertexPaintFunctionLibrary_SetChaosWheeledVehicleFrictionMultiplier_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, SetMeshConstantVertexColorsAndEnablesThem, "VertexPaintFunctionLibrary", "SetMeshConstantVertexColorsAndEnablesThem", SDK::Params::VertexPaintFunctionLibrary_SetMeshConstantVertexColorsAndEnablesThem)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, SetSkeletalMeshAndReleaseResources, "VertexPaintFunctionLibrary", "SetSkeletalMeshAndReleaseResources", SDK::Params::VertexPaintFunctionLibrary_SetSkeletalMeshAndReleaseResources)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, SetStaticMeshAndReleaseResources, "VertexPaintFunctionLibrary", "SetStaticMeshAndReleaseResources", SDK::Params::VertexPaintFunctionLibrary_SetStaticMeshAndReleaseResources)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, UnRegisterDetectTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper, "VertexPaintFunctionLibrary", "UnRegisterDetectTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper", SDK::Params::VertexPaintFunctionLibrary_UnRegisterDetectTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, UnRegisterPaintTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper, "VertexPaintFunctionLibrary", "UnRegisterPaintTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper", SDK::Params::VertexPaintFunctionLibrary_UnRegisterPaintTaskCallbacksToObjectFromSpecifiedMeshComponent_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, UpdateChaosClothPhysicsWithExistingColors, "VertexPaintFunctionLibrary", "UpdateChaosClothPhysicsWithExistingColors", SDK::Params::VertexPaintFunctionLibrary_UpdateChaosClothPhysicsWithExistingColors)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, UpdateChaosClothPhysicsWithExistingColorsAsync, "VertexPaintFunctionLibrary", "UpdateChaosClothPhysicsWithExistingColorsAsync", SDK::Params::VertexPaintFunctionLibrary_UpdateChaosClothPhysicsWithExistingColorsAsync)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, VertexPaintDetectionPlugin_GetSkeletalMesh, "VertexPaintFunctionLibrary", "VertexPaintDetectionPlugin_GetSkeletalMesh", SDK::Params::VertexPaintFunctionLibrary_VertexPaintDetectionPlugin_GetSkeletalMesh)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, VertexPaintDetectionPlugin_SortAssetsNamesAlphabetically, "VertexPaintFunctionLibrary", "VertexPaintDetectionPlugin_SortAssetsNamesAlphabetically", SDK::Params::VertexPaintFunctionLibrary_VertexPaintDetectionPlugin_SortAssetsNamesAlphabetically)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintFunctionLibrary, VertexPaintDetectionPlugin_SortStringArrayAlphabetically, "VertexPaintFunctionLibrary", "VertexPaintDetectionPlugin_SortStringArrayAlphabetically", SDK::Params::VertexPaintFunctionLibrary_VertexPaintDetectionPlugin_SortStringArrayAlphabetically)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintOptimizationDataAsset, GetRegisteredSkeletalMeshInfo, "VertexPaintOptimizationDataAsset", "GetRegisteredSkeletalMeshInfo", SDK::Params::VertexPaintOptimizationDataAsset_GetRegisteredSkeletalMeshInfo)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintOptimizationDataAsset, GetSkeletalMeshNumOfLODsToPaint, "VertexPaintOptimizationDataAsset", "GetSkeletalMeshNumOfLODsToPaint", SDK::Params::VertexPaintOptimizationDataAsset_GetSkeletalMeshNumOfLODsToPaint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintOptimizationDataAsset, GetStaticMeshNumOfLODsToPaint, "VertexPaintOptimizationDataAsset", "GetStaticMeshNumOfLODsToPaint", SDK::Params::VertexPaintOptimizationDataAsset_GetStaticMeshNumOfLODsToPaint)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, GetAllVertexColorsOnly_Wrapper, "VertexPaintTasksFunctionLibrary", "GetAllVertexColorsOnly_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_GetAllVertexColorsOnly_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, GetClosestVertexDataOnMesh_Wrapper, "VertexPaintTasksFunctionLibrary", "GetClosestVertexDataOnMesh_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_GetClosestVertexDataOnMesh_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, GetColorsWithinArea_Wrapper, "VertexPaintTasksFunctionLibrary", "GetColorsWithinArea_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_GetColorsWithinArea_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, PaintColorSnippetOnMesh_Wrappers, "VertexPaintTasksFunctionLibrary", "PaintColorSnippetOnMesh_Wrappers", SDK::Params::VertexPaintTasksFunctionLibrary_PaintColorSnippetOnMesh_Wrappers)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, PaintGroupSnippetOnMesh_Wrapper, "VertexPaintTasksFunctionLibrary", "PaintGroupSnippetOnMesh_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_PaintGroupSnippetOnMesh_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, PaintOnEntireMesh_Wrapper, "VertexPaintTasksFunctionLibrary", "PaintOnEntireMesh_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_PaintOnEntireMesh_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, PaintOnMeshAtLocation_Wrapper, "VertexPaintTasksFunctionLibrary", "PaintOnMeshAtLocation_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_PaintOnMeshAtLocation_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, PaintOnMeshWithinArea_Wrapper, "VertexPaintTasksFunctionLibrary", "PaintOnMeshWithinArea_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_PaintOnMeshWithinArea_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, SetMeshComponentVertexColors_Wrapper, "VertexPaintTasksFunctionLibrary", "SetMeshComponentVertexColors_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_SetMeshComponentVertexColors_Wrapper)
+BROADSWORD_UFUNCTION_DESCRIPTOR(UVertexPaintTasksFunctionLibrary, SetMeshComponentVertexColorsUsingSerializedString_Wrapper, "VertexPaintTasksFunctionLibrary", "SetMeshComponentVertexColorsUsingSerializedString_Wrapper", SDK::Params::VertexPaintTasksFunctionLibrary_SetMeshComponentVertexColorsUsingSerializedString_Wrapper)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Weapon_Feet_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Weapon_Feet_classes.hpp"
+#include "../SDK/Weapon_Feet_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Feet_C, BndEvt__Weapon_Feet_Box_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature, "Weapon_Feet_C", "BndEvt__Weapon_Feet_Box_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature", SDK::Params::Weapon_Feet_C_BndEvt__Weapon_Feet_Box_K2Node_ComponentBoundEvent_0_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Feet_C, ExecuteUbergraph_Weapon_Feet, "Weapon_Feet_C", "ExecuteUbergraph_Weapon_Feet", SDK::Params::Weapon_Feet_C_ExecuteUbergraph_Weapon_Feet)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Feet_C, ReceiveBeginPlay, "Weapon_Feet_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Feet_C, UserConstructionScript, "Weapon_Feet_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Weapon_Fists_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Weapon_Fists_classes.hpp"
+#include "../SDK/Weapon_Fists_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Fists_C, BndEvt__Weapon_Fists_Sphere_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature, "Weapon_Fists_C", "BndEvt__Weapon_Fists_Sphere_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature", SDK::Params::Weapon_Fists_C_BndEvt__Weapon_Fists_Sphere_K2Node_ComponentBoundEvent_1_ComponentHitSignature__DelegateSignature)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Fists_C, ExecuteUbergraph_Weapon_Fists, "Weapon_Fists_C", "ExecuteUbergraph_Weapon_Fists", SDK::Params::Weapon_Fists_C_ExecuteUbergraph_Weapon_Fists)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Fists_C, ReceiveBeginPlay, "Weapon_Fists_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Fists_C, UserConstructionScript, "Weapon_Fists_C", "UserConstructionScript", void)
+// clang-format on
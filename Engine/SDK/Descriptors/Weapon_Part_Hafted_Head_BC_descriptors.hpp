@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Weapon_Part_Hafted_Head_BC_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Weapon_Part_Hafted_Head_BC_classes.hpp"
+#include "../SDK/Weapon_Part_Hafted_Head_BC_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Part_Hafted_Head_BC_C, UserConstructionScript, "Weapon_Part_Hafted_Head_BC_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Weapon_Part_Mace_Grip_Tier_Master_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Weapon_Part_Mace_Grip_Tier_Master_classes.hpp"
+#include "../SDK/Weapon_Part_Mace_Grip_Tier_Master_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Part_Mace_Grip_Tier_Master_C, ExecuteUbergraph_Weapon_Part_Mace_Grip_Tier_Master, "Weapon_Part_Mace_Grip_Tier_Master_C", "ExecuteUbergraph_Weapon_Part_Mace_Grip_Tier_Master", SDK::Params::Weapon_Part_Mace_Grip_Tier_Master_C_ExecuteUbergraph_Weapon_Part_Mace_Grip_Tier_Master)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Part_Mace_Grip_Tier_Master_C, ReceiveTick, "Weapon_Part_Mace_Grip_Tier_Master_C", "ReceiveTick", SDK::Params::Weapon_Part_Mace_Grip_Tier_Master_C_ReceiveTick)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Part_Mace_Grip_Tier_Master_C, UserConstructionScript, "Weapon_Part_Mace_Grip_Tier_Master_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Weapon_Sword_Grip_20GS_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Weapon_Sword_Grip_20GS_classes.hpp"
+#include "../SDK/Weapon_Sword_Grip_20GS_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Sword_Grip_20GS_C, UserConstructionScript, "Weapon_Sword_Grip_20GS_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,13 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Weapon_Sword_Grip_Master_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Weapon_Sword_Grip_Master_classes.hpp"
+#include "../SDK/Weapon_Sword_Grip_Master_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWeapon_Sword_Grip_Master_C, UserConstructionScript, "Weapon_Sword_Grip_Master_C", "UserConstructionScript", void)
+// clang-format on
@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Willie_BP_Boss_1_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Willie_BP_Boss_1_classes.hpp"
+#include "../SDK/Willie_BP_Boss_1_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_Boss_1_C, ExecuteUbergraph_Willie_BP_Boss_1, "Willie_BP_Boss_1_C", "ExecuteUbergraph_Willie_BP_Boss_1", SDK::Params::Willie_BP_Boss_1_C_ExecuteUbergraph_Willie_BP_Boss_1)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_Boss_1_C, ReceiveBeginPlay, "Willie_BP_Boss_1_C", "ReceiveBeginPlay", void)
+// clang-format on
@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Willie_BP_DressUp_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Willie_BP_DressUp_classes.hpp"
+#include "../SDK/Willie_BP_DressUp_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_DressUp_C, ExecuteUbergraph_Willie_BP_DressUp, "Willie_BP_DressUp_C", "ExecuteUbergraph_Willie_BP_DressUp", SDK::Params::Willie_BP_DressUp_C_ExecuteUbergraph_Willie_BP_DressUp)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_DressUp_C, ReceiveBeginPlay, "Willie_BP_DressUp_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_DressUp_C, ReceiveTick, "Willie_BP_DressUp_C", "ReceiveTick", SDK::Params::Willie_BP_DressUp_C_ReceiveTick)
+// clang-format on
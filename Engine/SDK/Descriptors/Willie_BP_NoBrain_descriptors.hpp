@@ -0,0 +1,15 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Willie_BP_NoBrain_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Willie_BP_NoBrain_classes.hpp"
+#include "../SDK/Willie_BP_NoBrain_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_NoBrain_C, ExecuteUbergraph_Willie_BP_NoBrain, "Willie_BP_NoBrain_C", "ExecuteUbergraph_Willie_BP_NoBrain", SDK::Params::Willie_BP_NoBrain_C_ExecuteUbergraph_Willie_BP_NoBrain)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_NoBrain_C, ReceiveBeginPlay, "Willie_BP_NoBrain_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_NoBrain_C, ReceiveTick, "Willie_BP_NoBrain_C", "ReceiveTick", SDK::Params::Willie_BP_NoBrain_C_ReceiveTick)
+// clang-format on
@@ -0,0 +1,127 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Willie_BP_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Willie_BP_classes.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Add_Startup_Weapons, "Willie_BP_C", "Add Startup Weapons", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, AI__Unstuck_Jammed_Weapons, "Willie_BP_C", "AI  Unstuck Jammed Weapons", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Ai_Finish_Thrust, "Willie_BP_C", "Ai Finish Thrust", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Assign_L_Weapon_Slot, "Willie_BP_C", "Assign L Weapon Slot", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Assign_R_Weapon_Slot, "Willie_BP_C", "Assign R Weapon Slot", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Attach_L_Hand_To_Offhand_Position, "Willie_BP_C", "Attach L Hand To Offhand Position", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Break_Arm_L, "Willie_BP_C", "Break Arm L", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Break_Arm_R, "Willie_BP_C", "Break Arm R", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Break_Leg_L, "Willie_BP_C", "Break Leg L", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Break_Leg_R, "Willie_BP_C", "Break Leg R", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Break_R_Constraint, "Willie_BP_C", "Break R Constraint", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Call_Minus_Enemy, "Willie_BP_C", "Call Minus Enemy", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Camera_Shake_Timeline__FinishedFunc, "Willie_BP_C", "Camera Shake Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Camera_Shake_Timeline__UpdateFunc, "Willie_BP_C", "Camera Shake Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Check_Available_Weapon_L_in_All_Slots, "Willie_BP_C", "Check Available Weapon L in All Slots", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Check_Available_Weapon_R_in_All_Slots, "Willie_BP_C", "Check Available Weapon R in All Slots", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Check_if_L_Holding_Weapon, "Willie_BP_C", "Check if L Holding Weapon", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Check_if_R_Holding_Weapon, "Willie_BP_C", "Check if R Holding Weapon", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Death, "Willie_BP_C", "Death", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Death_Timeline__FinishedFunc, "Willie_BP_C", "Death Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Death_Timeline__UpdateFunc, "Willie_BP_C", "Death Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Destroy_Willie, "Willie_BP_C", "Destroy Willie", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Disentergrate, "Willie_BP_C", "Disentergrate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Dying, "Willie_BP_C", "Dying", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, End_Arrow_Time_Event, "Willie_BP_C", "End Arrow Time Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Event_Add_Sheathed_Weapon, "Willie_BP_C", "Event Add Sheathed Weapon", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Event_Block_L_OffHand_Grab, "Willie_BP_C", "Event Block L OffHand Grab", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Event_Clear_Sheathed_Weapon_Slots, "Willie_BP_C", "Event Clear Sheathed Weapon Slots", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Event_Slide_Right_Hand_Along_Shaft, "Willie_BP_C", "Event Slide Right Hand Along Shaft", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Event_Versus_Lost, "Willie_BP_C", "Event Versus Lost", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Explode_Head, "Willie_BP_C", "Explode Head", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Fall, "Willie_BP_C", "Fall", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Fallen_Give_Up_TL__FinishedFunc, "Willie_BP_C", "Fallen Give Up TL__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Fallen_Give_Up_TL__UpdateFunc, "Willie_BP_C", "Fallen Give Up TL__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Feet_Rotation_and_Normal, "Willie_BP_C", "Feet Rotation and Normal", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Find_Node_Time_Begin, "Willie_BP_C", "Find Node Time Begin", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Find_Node_Time_End, "Willie_BP_C", "Find Node Time End", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Force_Fall_Down_Event, "Willie_BP_C", "Force Fall Down Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Force_FPP, "Willie_BP_C", "Force FPP", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Force_TPP, "Willie_BP_C", "Force TPP", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Kick_Event, "Willie_BP_C", "Kick Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Kick_L_Timeline__FinishedFunc, "Willie_BP_C", "Kick L Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Kick_L_Timeline__UpdateFunc, "Willie_BP_C", "Kick L Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Kick_R_Timeline__FinishedFunc, "Willie_BP_C", "Kick R Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Kick_R_Timeline__UpdateFunc, "Willie_BP_C", "Kick R Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Kneel_Event, "Willie_BP_C", "Kneel Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, L_Hand_Sheath_Start, "Willie_BP_C", "L Hand Sheath Start", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, L_Step_Timeline__FinishedFunc, "Willie_BP_C", "L Step Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, L_Step_Timeline__UpdateFunc, "Willie_BP_C", "L Step Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Load_Save, "Willie_BP_C", "Load Save", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Load_Save_Give_Up, "Willie_BP_C", "Load Save Give Up", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Move_L_Hand_To_Not_Awkward_Position, "Willie_BP_C", "Move L Hand To Not Awkward Position", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Pick_Up_Left_Event, "Willie_BP_C", "Pick Up Left Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Pick_Up_Right_Event, "Willie_BP_C", "Pick Up Right Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Play_Curse_VO, "Willie_BP_C", "Play Curse VO", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Polearm_Hands_Switch, "Willie_BP_C", "Polearm Hands Switch", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, R_Hand_Sheath_Start, "Willie_BP_C", "R Hand Sheath Start", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, R_Step_Timeline__FinishedFunc, "Willie_BP_C", "R Step Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, R_Step_Timeline__UpdateFunc, "Willie_BP_C", "R Step Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, ReceiveBeginPlay, "Willie_BP_C", "ReceiveBeginPlay", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Release_Grab_L, "Willie_BP_C", "Release Grab L", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Release_Grab_R, "Willie_BP_C", "Release Grab R", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Release_No_Dismember_Bones, "Willie_BP_C", "Release No Dismember Bones", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Release_Offhand, "Willie_BP_C", "Release Offhand", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Remove_Hat, "Willie_BP_C", "Remove Hat", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Rescale_Character, "Willie_BP_C", "Rescale Character", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Blood_Bleed, "Willie_BP_C", "Reset Blood Bleed", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Blood_Splash, "Willie_BP_C", "Reset Blood Splash", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Body_Hit_Sound, "Willie_BP_C", "Reset Body Hit Sound", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Last_Damage_Taken, "Willie_BP_C", "Reset Last Damage Taken", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Latest_Complex_Damage, "Willie_BP_C", "Reset Latest Complex Damage", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Latest_VP_Damage, "Willie_BP_C", "Reset Latest VP Damage", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_OffHand_Locked, "Willie_BP_C", "Reset OffHand Locked", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Parry, "Willie_BP_C", "Reset Parry", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Step_Sound_L, "Willie_BP_C", "Reset Step Sound L", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Step_Sound_R, "Willie_BP_C", "Reset Step Sound R", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Reset_Sustained_Damage, "Willie_BP_C", "Reset Sustained Damage", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Save_Loadout, "Willie_BP_C", "Save Loadout", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Setup_Character_Event, "Willie_BP_C", "Setup Character Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Slomo_Timeline__FinishedFunc, "Willie_BP_C", "Slomo Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Slomo_Timeline__UpdateFunc, "Willie_BP_C", "Slomo Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Snap_Neck, "Willie_BP_C", "Snap Neck", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Spill_Guts, "Willie_BP_C", "Spill Guts", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Stop_Detached_Blood_Emitters, "Willie_BP_C", "Stop Detached Blood Emitters", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Swap_Weapons, "Willie_BP_C", "Swap Weapons", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Thrust_L, "Willie_BP_C", "Thrust L", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Thrust_R, "Willie_BP_C", "Thrust R", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_0__FinishedFunc, "Willie_BP_C", "Timeline_0__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_0__UpdateFunc, "Willie_BP_C", "Timeline_0__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_1__FinishedFunc, "Willie_BP_C", "Timeline_1__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_1__UpdateFunc, "Willie_BP_C", "Timeline_1__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_2__FinishedFunc, "Willie_BP_C", "Timeline_2__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_2__UpdateFunc, "Willie_BP_C", "Timeline_2__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_4__FinishedFunc, "Willie_BP_C", "Timeline_4__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_4__UpdateFunc, "Willie_BP_C", "Timeline_4__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_5__FinishedFunc, "Willie_BP_C", "Timeline_5__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_5__UpdateFunc, "Willie_BP_C", "Timeline_5__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_6__FinishedFunc, "Willie_BP_C", "Timeline_6__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_6__UpdateFunc, "Willie_BP_C", "Timeline_6__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_7__FinishedFunc, "Willie_BP_C", "Timeline_7__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_7__UpdateFunc, "Willie_BP_C", "Timeline_7__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_8__FinishedFunc, "Willie_BP_C", "Timeline_8__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline_8__UpdateFunc, "Willie_BP_C", "Timeline_8__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline__FinishedFunc, "Willie_BP_C", "Timeline__FinishedFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Timeline__UpdateFunc, "Willie_BP_C", "Timeline__UpdateFunc", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Toggle_Invert, "Willie_BP_C", "Toggle Invert", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Un_Kneel_Event, "Willie_BP_C", "Un Kneel Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Unsheath_R_Event, "Willie_BP_C", "Unsheath R Event", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Update_Aim, "Willie_BP_C", "Update Aim", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, UserConstructionScript, "Willie_BP_C", "UserConstructionScript", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, VO_Curse, "Willie_BP_C", "VO Curse", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, VO_Deescalate, "Willie_BP_C", "VO Deescalate", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, VO_Insult, "Willie_BP_C", "VO Insult", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, VO_Interrupt, "Willie_BP_C", "VO Interrupt", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, VO_Plead, "Willie_BP_C", "VO Plead", void)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_BP_C, Wake_Up, "Willie_BP_C", "Wake Up", void)
+// clang-format on
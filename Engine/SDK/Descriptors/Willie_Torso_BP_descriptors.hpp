@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from Willie_Torso_BP_functions.cpp - do not edit
+ */
+
+#include "../../UFunctionDescriptor.hpp"
+#include "../SDK/Willie_Torso_BP_classes.hpp"
+#include "../SDK/Willie_Torso_BP_parameters.hpp"
+
+// clang-format off
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_Torso_BP_C, ExecuteUbergraph_Willie_Torso_BP, "Willie_Torso_BP_C", "ExecuteUbergraph_Willie_Torso_BP", SDK::Params::Willie_Torso_BP_C_ExecuteUbergraph_Willie_Torso_BP)
+BROADSWORD_UFUNCTION_DESCRIPTOR(AWillie_Torso_BP_C, ReceiveBeginPlay, "Willie_Torso_BP_C", "ReceiveBeginPlay", void)
+// clang-format on
@@ -12,6 +12,7 @@
 #define WIN32_LEAN_AND_MEAN
 
 #include <string>
+#include <string_view>
 #include <functional>
 #include <type_traits>
 
@@ -337,18 +338,23 @@ public:
 		return OutputString;
 	}
 	
+	// Broadsword: interned text (Engine/NameCache.hpp) instead of an AppendString call per use
 	std::string ToString() const
 	{
-		std::string OutputString = GetRawString();
+		std::string OutputString(View());
 	
-		size_t pos = OutputString.rfind('/');
-	
-		if (pos == std::string::npos)
-			return OutputString;
+		if (Number > 0)
+		{
+			OutputString += '_';
+			OutputString += std::to_string(Number - 1);
+		}
 	
-		return OutputString.substr(pos + 1);
+		return OutputString;
 	}
 	
+	// Broadsword: ToString() without the number suffix, interned per ComparisonIndex (Engine/NameCache.hpp)
+	std::string_view View() const;
+	
 	bool operator==(const FName& Other) const
 	{
 		return ComparisonIndex == Other.ComparisonIndex && Number == Other.Number;
@@ -14,6 +14,11 @@
 #include "CoreUObject_classes.hpp"
 #include "CoreUObject_parameters.hpp"
 
+#include "../../ObjectIndex.hpp"
+#include "../../ObjectPath.hpp"
+#include "../../FunctionTable.hpp"
+#include "../../ClassHierarchy.hpp"
+
 
 namespace SDK
 {
@@ -23,18 +28,8 @@ namespace SDK
 
 class UObject* UObject::FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)
 {
-	for (int i = 0; i < GObjects->Num(); ++i)
-	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
-		if (Object->HasTypeFlag(RequiredType) && Object->GetName() == Name)
-			return Object;
-	}
-
-	return nullptr;
+	// Broadsword: hashed GObjects index instead of a linear scan
+	return Broadsword::ObjectIndex::Get().FindByName(Name, RequiredType);
 }
 
 
@@ -43,18 +38,8 @@ class UObject* UObject::FindObjectFastImpl(const std::string& Name, EClassCastFl
 
 class UObject* UObject::FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)
 {
-	for (int i = 0; i < GObjects->Num(); ++i)
-	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
-		if (Object->HasTypeFlag(RequiredType) && Object->GetFullName() == FullName)
-			return Object;
-	}
-
-	return nullptr;
+	// Broadsword: hashed GObjects index instead of a linear scan
+	return Broadsword::ObjectIndex::Get().FindByFullName(FullName, RequiredType);
 }
 
 
@@ -63,24 +48,8 @@ class UObject* UObject::FindObjectImpl(const std::string& FullName, EClassCastFl
 
 std::string UObject::GetFullName() const
 {
-	if (this && Class)
-	{
-		std::string Temp;
-
-		for (UObject* NextOuter = Outer; NextOuter; NextOuter = NextOuter->Outer)
-		{
-			Temp = NextOuter->GetName() + "." + Temp;
-		}
-
-		std::string Name = Class->GetName();
-		Name += " ";
-		Name += Temp;
-		Name += GetName();
-
-		return Name;
-	}
-
-	return "None";
+	// Broadsword: cached outer prefixes and interned names instead of rebuilding the path
+	return Broadsword::ObjectPath::Get().GetFullName(this);
 }
 
 
@@ -116,7 +85,8 @@ bool UObject::IsA(EClassCastFlags TypeFlags) const
 
 bool UObject::IsA(class UClass* TypeClass) const
 {
-	return Class->IsSubclassOf(TypeClass);
+	// Broadsword: interval check on the numbered class tree instead of a Super walk
+	return Broadsword::ClassHierarchy::Get().IsA(Class, TypeClass);
 }
 
 
@@ -172,19 +142,8 @@ bool UStruct::IsSubclassOf(const UStruct* Base) const
 
 class UFunction* UClass::GetFunction(const std::string& ClassName, const std::string& FuncName) const
 {
-	for(const UStruct* Clss = this; Clss; Clss = Clss->Super)
-	{
-		if (Clss->GetName() != ClassName)
-			continue;
-			
-		for (UField* Field = Clss->Children; Field; Field = Field->Next)
-		{
-			if(Field->HasTypeFlag(EClassCastFlags::Function) && Field->GetName() == FuncName)
-				return static_cast<class UFunction*>(Field);
-		}
-	}
-
-	return nullptr;
+	// Broadsword: hashed per-class function tables instead of name string comparisons
+	return Broadsword::FunctionTable::Get().Find(this, ClassName, FuncName);
 }
 
 }
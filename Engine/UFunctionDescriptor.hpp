@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+namespace Broadsword {
+
+/**
+ * UFunctionDescriptor - Compile-time description of a generated SDK UFunction
+ *
+ * Keyed by the SDK wrapper itself (&SDK::AWillie_BP_C::Add_Startup_Weapons), a
+ * descriptor names the UClass and UFunction exactly as the engine does
+ * (function names may contain spaces the C++ wrapper name doesn't) and the
+ * generated Params:: struct the function takes.
+ *
+ * Specializations are generated from the SDK into Engine/SDK/Descriptors/
+ * (one header per package) by Tools/GenerateUFunctionDescriptors.py - rerun
+ * it after regenerating the SDK. Using a wrapper without a descriptor is a
+ * compile error.
+ *
+ * A package the SDK dump has no *_parameters.hpp for (Willie_BP, Engine, ...)
+ * only gets descriptors for its functions without parameters, so functions
+ * like ReceiveTick or TakeDamage can't be bound this way - hook them by name.
+ *
+ * Members:
+ * - Class:        SDK class the function is declared on (SDK::UObject for interfaces)
+ * - Params:       SDK::Params:: struct, or void for functions without parameters
+ * - ClassName:    UClass name ("Willie_BP_C")
+ * - FunctionName: UFunction name ("Add Startup Weapons")
+ *
+ * Usage:
+ *   #include "Engine/SDK/Descriptors/Willie_BP_descriptors.hpp"
+ *
+ *   using AddStartupWeapons = UFunctionDescriptor<&SDK::AWillie_BP_C::Add_Startup_Weapons>;
+ *   static_assert(AddStartupWeapons::FunctionName == "Add Startup Weapons");
+ */
+template<auto Function>
+struct UFunctionDescriptor; // Not a generated SDK UFunction (or its descriptor header isn't included)
+
+/**
+ * Satisfied by SDK wrappers whose descriptor is visible
+ */
+template<auto Function>
+concept DescribedUFunction = requires {
+    typename UFunctionDescriptor<Function>::Class;
+    typename UFunctionDescriptor<Function>::Params;
+    UFunctionDescriptor<Function>::ClassName;
+    UFunctionDescriptor<Function>::FunctionName;
+};
+
+} // namespace Broadsword
+
+/**
+ * Declares the descriptor of one SDK wrapper (used by the generated headers)
+ *
+ * @param ClassType SDK class the function is declared on
+ * @param Member    Wrapper name in ClassType
+ * @param UClassName, UFunctionName Engine names (string literals)
+ * @param ParamsType SDK::Params:: struct or void
+ */
+#define BROADSWORD_UFUNCTION_DESCRIPTOR(ClassType, Member, UClassName, UFunctionName, ParamsType)   \
+    template<>                                                                                      \
+    struct Broadsword::UFunctionDescriptor<&SDK::ClassType::Member> {                               \
+        using Class = std::conditional_t<std::is_base_of_v<SDK::UObject, SDK::ClassType>,           \
+                                         SDK::ClassType, SDK::UObject>;                             \
+        using Params = ParamsType;                                                                  \
+        static constexpr std::string_view ClassName = UClassName;                                   \
+        static constexpr std::string_view FunctionName = UFunctionName;                             \
+    };
@@ -1,4 +1,5 @@
 #include "VTableHook.hpp"
+#include <Windows.h>
 
 namespace Broadsword::Foundation
 {
@@ -55,6 +56,23 @@ void VTableHook::Unbind(uint16_t index)
     kiero::unbind(index);
 }
 
+void* VTableHook::SwapSlot(void** vtable, uint16_t index, void* replacement)
+{
+    void** slot = &vtable[index];
+
+    DWORD oldProtect = 0;
+    if (!VirtualProtect(slot, sizeof(void*), PAGE_READWRITE, &oldProtect))
+    {
+        return nullptr;
+    }
+
+    // Pointer-sized aligned store - threads calling through the slot see old or new, never torn
+    void* previous = InterlockedExchangePointer(slot, replacement);
+
+    VirtualProtect(slot, sizeof(void*), oldProtect, &oldProtect);
+    return previous;
+}
+
 kiero::RenderType::Enum VTableHook::ToKieroType(RenderAPI api)
 {
     switch (api)
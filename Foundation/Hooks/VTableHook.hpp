@@ -51,6 +51,10 @@ public:
     // Unbind a hook from a vtable index
     static void Unbind(uint16_t index);
 
+    // Swap one slot of an arbitrary vtable (e.g. a UObject class's ProcessEvent)
+    // Returns the previous entry, or nullptr if the slot couldn't be made writable
+    static void* SwapSlot(void** vtable, uint16_t index, void* replacement);
+
 private:
     static RenderAPI s_DetectedAPI;
     static bool s_Initialized;
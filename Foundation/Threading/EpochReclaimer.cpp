@@ -0,0 +1,205 @@
+#include "EpochReclaimer.hpp"
+
+#include <limits>
+#include <thread>
+
+namespace Broadsword::Foundation
+{
+
+EpochReclaimer& EpochReclaimer::Get()
+{
+    static EpochReclaimer instance;
+    return instance;
+}
+
+EpochReclaimer::~EpochReclaimer()
+{
+    // Process teardown - nobody is reading anymore
+    for (Retired& retired : m_Retired)
+    {
+        retired.deleter(retired.object);
+    }
+}
+
+EpochReclaimer::ThreadState::~ThreadState()
+{
+    if (slot >= 0)
+    {
+        Slot& owned = EpochReclaimer::Get().m_Slots[slot];
+        owned.epoch.store(0, std::memory_order_release);
+        owned.claimed.store(false, std::memory_order_release);
+    }
+}
+
+EpochReclaimer::ThreadState& EpochReclaimer::LocalState()
+{
+    thread_local ThreadState state;
+    return state;
+}
+
+void EpochReclaimer::Enter()
+{
+    ThreadState& state = LocalState();
+    if (state.depth++ > 0)
+    {
+        return;
+    }
+
+    if (state.slot == NoSlot)
+    {
+        state.slot = ClaimSlot();
+    }
+
+    if (state.slot >= 0)
+    {
+        // seq_cst: the slot store must be visible before this thread loads any snapshot
+        m_Slots[state.slot].epoch.store(m_Epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    }
+    else
+    {
+        m_OverflowReaders.fetch_add(1, std::memory_order_seq_cst);
+    }
+}
+
+void EpochReclaimer::Exit()
+{
+    ThreadState& state = LocalState();
+    if (--state.depth > 0)
+    {
+        return;
+    }
+
+    if (state.slot >= 0)
+    {
+        m_Slots[state.slot].epoch.store(0, std::memory_order_release);
+    }
+    else
+    {
+        m_OverflowReaders.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+int32_t EpochReclaimer::ClaimSlot()
+{
+    for (size_t i = 0; i < MaxSlots; i++)
+    {
+        bool expected = false;
+        if (!m_Slots[i].claimed.load(std::memory_order_relaxed) &&
+            m_Slots[i].claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            return static_cast<int32_t>(i);
+        }
+    }
+
+    return OverflowSlot;
+}
+
+void EpochReclaimer::Retire(void* object, void (*deleter)(void*))
+{
+    if (!object)
+    {
+        return;
+    }
+
+    {
+        // Readers that entered at or before this epoch may still hold the object
+        std::lock_guard<std::mutex> lock(m_RetiredMutex);
+        uint64_t epoch = m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+        m_Retired.push_back(Retired{object, deleter, epoch});
+    }
+
+    Collect();
+}
+
+uint64_t EpochReclaimer::OldestActiveEpoch() const
+{
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+    for (const Slot& slot : m_Slots)
+    {
+        uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+        if (epoch != 0 && epoch < oldest)
+        {
+            oldest = epoch;
+        }
+    }
+    return oldest;
+}
+
+size_t EpochReclaimer::Collect()
+{
+    std::vector<Retired> ready;
+
+    {
+        std::lock_guard<std::mutex> lock(m_RetiredMutex);
+        if (m_Retired.empty() || m_OverflowReaders.load(std::memory_order_seq_cst) != 0)
+        {
+            return 0;
+        }
+
+        uint64_t oldest = OldestActiveEpoch();
+
+        size_t kept = 0;
+        for (Retired& retired : m_Retired)
+        {
+            if (retired.epoch < oldest)
+            {
+                ready.push_back(retired);
+            }
+            else
+            {
+                m_Retired[kept++] = retired;
+            }
+        }
+        m_Retired.resize(kept);
+    }
+
+    // Deleters run outside the lock (they may retire more)
+    for (Retired& retired : ready)
+    {
+        retired.deleter(retired.object);
+    }
+
+    return ready.size();
+}
+
+void EpochReclaimer::Synchronize()
+{
+    uint64_t target = m_Epoch.load(std::memory_order_seq_cst);
+    int32_t own = LocalState().slot;
+
+    for (size_t i = 0; i < MaxSlots; i++)
+    {
+        if (static_cast<int32_t>(i) == own)
+        {
+            continue;
+        }
+
+        // Readers that entered after `target` can't see anything retired before this call
+        for (;;)
+        {
+            uint64_t epoch = m_Slots[i].epoch.load(std::memory_order_seq_cst);
+            if (epoch == 0 || epoch >= target)
+            {
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // Overflow readers can't be told apart - wait for all of them (own guard included)
+    uint32_t ownOverflow = (own == OverflowSlot && LocalState().depth > 0) ? 1 : 0;
+    while (m_OverflowReaders.load(std::memory_order_seq_cst) > ownOverflow)
+    {
+        std::this_thread::yield();
+    }
+
+    Collect();
+}
+
+size_t EpochReclaimer::PendingCount() const
+{
+    std::lock_guard<std::mutex> lock(m_RetiredMutex);
+    return m_Retired.size();
+}
+
+} // namespace Broadsword::Foundation
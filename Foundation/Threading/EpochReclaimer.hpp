@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Broadsword::Foundation
+{
+
+// EpochReclaimer - Deferred deletion for lock-free readers (epoch-based reclamation)
+//
+// Readers wrap access to a published snapshot in a Guard; writers swap the snapshot
+// pointer and Retire() the old one. A retired object is deleted once every thread that
+// could still be reading it has left its guard:
+// - Entering a guard publishes the current global epoch in the thread's slot
+// - Retire() tags the object with the epoch and advances it
+// - Collect() deletes objects tagged before the oldest epoch still published
+//
+// Guards nest (only the outermost one touches the slot) and cost two stores. Reader
+// threads get one of MaxSlots cache-line slots on first use; beyond that they share an
+// overflow counter that holds back all reclamation while non-zero.
+//
+// Thread Safety:
+// - Guard, Retire(), Collect() and Synchronize() are callable from any thread
+class EpochReclaimer
+{
+public:
+    static EpochReclaimer& Get();
+
+    // Read-side critical section (RAII, nestable)
+    class Guard
+    {
+    public:
+        Guard() { EpochReclaimer::Get().Enter(); }
+        ~Guard() { EpochReclaimer::Get().Exit(); }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    // Delete `object` with `deleter` once no reader can still hold it
+    void Retire(void* object, void (*deleter)(void*));
+
+    template <typename T>
+    void Retire(T* object)
+    {
+        Retire(object, [](void* pointer) { delete static_cast<T*>(pointer); });
+    }
+
+    // Delete every retired object no reader can still hold - returns the number deleted
+    size_t Collect();
+
+    // Wait until every other thread has left the guards it was in when this was called,
+    // then Collect(). Objects the calling thread itself still guards stay retired.
+    // Don't call while another thread's guard might wait on this thread.
+    void Synchronize();
+
+    // Retired objects not yet deleted
+    size_t PendingCount() const;
+
+private:
+    EpochReclaimer() = default;
+    ~EpochReclaimer();
+
+    // Delete copy/move
+    EpochReclaimer(const EpochReclaimer&) = delete;
+    EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+    EpochReclaimer(EpochReclaimer&&) = delete;
+    EpochReclaimer& operator=(EpochReclaimer&&) = delete;
+
+    static constexpr size_t MaxSlots = 256;
+    static constexpr int32_t NoSlot = -1;
+    static constexpr int32_t OverflowSlot = -2;
+
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> epoch{0}; // 0 = not inside a guard
+        std::atomic<bool> claimed{false};
+    };
+
+    struct Retired
+    {
+        void* object;
+        void (*deleter)(void*);
+        uint64_t epoch;
+    };
+
+    // Per-thread slot, released when the thread exits
+    struct ThreadState
+    {
+        int32_t slot = NoSlot;
+        uint32_t depth = 0;
+
+        ~ThreadState();
+    };
+
+    static ThreadState& LocalState();
+
+    void Enter();
+    void Exit();
+    int32_t ClaimSlot();
+
+    // Oldest epoch still published by a reader (UINT64_MAX if none)
+    uint64_t OldestActiveEpoch() const;
+
+    Slot m_Slots[MaxSlots];
+    std::atomic<uint64_t> m_Epoch{1};
+    std::atomic<uint32_t> m_OverflowReaders{0};
+
+    mutable std::mutex m_RetiredMutex;
+    std::vector<Retired> m_Retired;
+};
+
+} // namespace Broadsword::Foundation
@@ -0,0 +1,104 @@
+#include "GameTask.hpp"
+
+#include <new>
+
+namespace Broadsword::Foundation
+{
+
+namespace
+{
+
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+// Per-thread free lists and bump region - no locking on the hot path
+struct ThreadCache
+{
+    FreeBlock* freeLists[CoroutineFramePool::ClassCount] = {};
+    char* cursor = nullptr;
+    char* end = nullptr;
+
+    // Chunks are intentionally leaked at thread exit: frames carved from them may
+    // still be alive (suspended) and owned by other threads
+};
+
+thread_local ThreadCache t_Cache;
+
+std::atomic<uint64_t> s_LiveFrames{0};
+std::atomic<uint64_t> s_ChunkBytes{0};
+std::atomic<uint64_t> s_HeapFallbacks{0};
+
+size_t ClassIndex(size_t size)
+{
+    return size == 0 ? 0 : (size - 1) / CoroutineFramePool::ClassSize;
+}
+
+} // namespace
+
+void* CoroutineFramePool::Allocate(size_t size)
+{
+    s_LiveFrames.fetch_add(1, std::memory_order_relaxed);
+
+    size_t index = ClassIndex(size);
+    if (index >= ClassCount)
+    {
+        s_HeapFallbacks.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    ThreadCache& cache = t_Cache;
+
+    if (FreeBlock* block = cache.freeLists[index])
+    {
+        cache.freeLists[index] = block->next;
+        return block;
+    }
+
+    size_t blockSize = (index + 1) * ClassSize;
+    if (static_cast<size_t>(cache.end - cache.cursor) < blockSize)
+    {
+        // Remainder of the old chunk is abandoned - at most one block's worth
+        cache.cursor = static_cast<char*>(::operator new(ChunkSize));
+        cache.end = cache.cursor + ChunkSize;
+        s_ChunkBytes.fetch_add(ChunkSize, std::memory_order_relaxed);
+    }
+
+    void* block = cache.cursor;
+    cache.cursor += blockSize;
+    return block;
+}
+
+void CoroutineFramePool::Deallocate(void* ptr, size_t size) noexcept
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    s_LiveFrames.fetch_sub(1, std::memory_order_relaxed);
+
+    size_t index = ClassIndex(size);
+    if (index >= ClassCount)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    ThreadCache& cache = t_Cache;
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->next = cache.freeLists[index];
+    cache.freeLists[index] = block;
+}
+
+CoroutineFramePool::Stats CoroutineFramePool::GetStats()
+{
+    Stats stats;
+    stats.liveFrames = s_LiveFrames.load(std::memory_order_relaxed);
+    stats.chunkBytes = s_ChunkBytes.load(std::memory_order_relaxed);
+    stats.heapFallbacks = s_HeapFallbacks.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace Broadsword::Foundation
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "GameThreadExecutor.hpp"
+#include "TimerWheel.hpp"
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+
+namespace Broadsword::Foundation
+{
+
+// CoroutineFramePool - Size-class pool for coroutine frames
+//
+// Frames are rounded up to 64-byte classes (up to 2 KB) and carved from 64 KB chunks.
+// Each thread keeps its own free lists, so allocation never takes a lock; a frame freed
+// on another thread simply joins that thread's list. Chunks are never returned to the OS,
+// so thousands of short-lived or suspended tasks cost one pointer-pop each.
+// Frames larger than the biggest class fall back to the global heap.
+class CoroutineFramePool
+{
+public:
+    struct Stats
+    {
+        uint64_t liveFrames = 0;     // Frames currently allocated (pooled + heap)
+        uint64_t chunkBytes = 0;     // Bytes reserved in pool chunks across all threads
+        uint64_t heapFallbacks = 0;  // Frames too large for the pool
+    };
+
+    static void* Allocate(size_t size);
+    static void Deallocate(void* ptr, size_t size) noexcept;
+
+    static Stats GetStats();
+
+    static constexpr size_t ClassSize = 64;
+    static constexpr size_t ClassCount = 32; // 64 B .. 2 KB
+    static constexpr size_t ChunkSize = 64 * 1024;
+};
+
+// GameTask - Fire-and-forget coroutine for multi-frame mod logic
+//
+// Replaces hand-rolled state machines in OnFrame:
+//
+//   GameTask SpawnAndEquip() {
+//       auto* npc = SpawnNPC();
+//       co_await Condition([npc] { return IsOnGround(npc); });
+//       co_await Frames(2);
+//       Equip(npc);
+//       co_await Seconds(1.5f);
+//       Taunt(npc);
+//   }
+//
+//   SpawnAndEquip(); // Starts immediately, runs until its first co_await
+//
+// The task starts eagerly on the calling thread and frees its frame when it finishes.
+// Time-based awaitables resume on the game thread (driven by TimerWheel/GameThreadExecutor).
+// An exception escaping the coroutine is rethrown from the next GameThreadExecutor::ProcessQueue().
+class GameTask
+{
+public:
+    struct promise_type
+    {
+        GameTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+
+        void unhandled_exception()
+        {
+            // Surface it where a throwing queued action would surface
+            GameThreadExecutor::Get().QueueAction([error = std::current_exception()]() {
+                std::rethrow_exception(error);
+            });
+        }
+
+        static void* operator new(size_t size) { return CoroutineFramePool::Allocate(size); }
+        static void operator delete(void* ptr, size_t size) noexcept { CoroutineFramePool::Deallocate(ptr, size); }
+    };
+};
+
+namespace Detail
+{
+
+// Run on the game thread: inline if already there, otherwise via the executor
+inline void OnGameThread(std::function<void()> fn)
+{
+    if (GameThreadExecutor::Get().IsGameThread())
+    {
+        fn();
+    }
+    else
+    {
+        GameThreadExecutor::Get().QueueAction(std::move(fn), {GameThreadExecutor::Priority::Critical});
+    }
+}
+
+struct FramesAwaiter
+{
+    uint64_t frames;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) const
+    {
+        uint64_t delay = frames;
+        OnGameThread([handle, delay]() {
+            TimerWheel::Get().AfterFrames(delay, [handle]() { handle.resume(); });
+        });
+    }
+
+    void await_resume() const noexcept {}
+};
+
+struct TimeAwaiter
+{
+    std::chrono::milliseconds delay;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) const
+    {
+        auto ms = delay;
+        OnGameThread([handle, ms]() {
+            TimerWheel::Get().After(ms, [handle]() { handle.resume(); });
+        });
+    }
+
+    void await_resume() const noexcept {}
+};
+
+struct GameThreadAwaiter
+{
+    bool await_ready() const noexcept { return GameThreadExecutor::Get().IsGameThread(); }
+
+    void await_suspend(std::coroutine_handle<> handle) const
+    {
+        GameThreadExecutor::Get().QueueAction([handle]() { handle.resume(); },
+                                              {GameThreadExecutor::Priority::Critical});
+    }
+
+    void await_resume() const noexcept {}
+};
+
+template <typename Pred>
+struct ConditionAwaiter
+{
+    Pred pred;
+    TimerWheel::TimerHandle poll;
+
+    // Checked immediately only when already on the game thread (predicates usually touch the SDK)
+    bool await_ready() { return GameThreadExecutor::Get().IsGameThread() && pred(); }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // The awaiter lives in the suspended frame, so `this` stays valid until resume
+        OnGameThread([this, handle]() {
+            poll = TimerWheel::Get().EveryFrames(1, [this, handle]() {
+                if (pred())
+                {
+                    TimerWheel::Get().Cancel(poll);
+                    handle.resume();
+                }
+            });
+        });
+    }
+
+    void await_resume() const noexcept {}
+};
+
+} // namespace Detail
+
+// Resume on the next frame
+inline Detail::FramesAwaiter NextFrame()
+{
+    return {1};
+}
+
+// Resume after n frames (n = 0 behaves like NextFrame)
+inline Detail::FramesAwaiter Frames(uint64_t n)
+{
+    return {n};
+}
+
+// Resume after t seconds of wall-clock time (1 ms resolution, on the game thread)
+inline Detail::TimeAwaiter Seconds(float t)
+{
+    auto ms = t > 0.0f ? static_cast<int64_t>(t * 1000.0f + 0.5f) : 0;
+    return {std::chrono::milliseconds(ms)};
+}
+
+// Continue on the game thread (no-op if already there)
+inline Detail::GameThreadAwaiter GameThread()
+{
+    return {};
+}
+
+// Resume once pred() returns true, checked once per frame on the game thread
+template <typename Pred>
+Detail::ConditionAwaiter<Pred> Condition(Pred pred)
+{
+    return {std::move(pred), {}};
+}
+
+} // namespace Broadsword::Foundation
@@ -9,41 +9,335 @@ GameThreadExecutor& GameThreadExecutor::Get()
     return instance;
 }
 
-void GameThreadExecutor::QueueAction(std::function<void()> action)
+GameThreadExecutor::GameThreadExecutor()
 {
-    if (action)
+    SetFrameBudget(Priority::Critical, std::chrono::microseconds(0));
+    SetFrameBudget(Priority::Normal, std::chrono::microseconds(2000));
+    SetFrameBudget(Priority::Background, std::chrono::microseconds(500));
+}
+
+GameThreadExecutor::~GameThreadExecutor()
+{
+    Clear();
+}
+
+GameThreadExecutor::ActionNode* GameThreadExecutor::AllocateNode()
+{
+    if (void* slot = m_NodePool.Allocate())
     {
-        m_ActionQueue.push(std::move(action));
+        return ::new (slot) ActionNode();
     }
+
+    m_HeapNodes.fetch_add(1, std::memory_order_relaxed);
+    ActionNode* node = new ActionNode();
+    node->pooled = false;
+    return node;
+}
+
+void GameThreadExecutor::FreeNode(ActionNode* node)
+{
+    if (node->pooled)
+    {
+        node->~ActionNode();
+        m_NodePool.Free(node);
+    }
+    else
+    {
+        delete node;
+    }
+}
+
+void GameThreadExecutor::Enqueue(ActionNode* node, const SubmitOptions& options)
+{
+    Priority priority = options.priority < Priority::Count ? options.priority : Priority::Normal;
+
+    node->enqueuedNs = NowNs();
+    node->owner = options.owner;
+    node->priority = priority;
+
+    m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+    m_ClassCounters[static_cast<size_t>(priority)].backlog.fetch_add(1, std::memory_order_relaxed);
+    m_Queue.Push(node);
 }
 
 void GameThreadExecutor::ProcessQueue()
 {
-    // Process all queued actions
+    m_GameThreadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+    // Snapshot everything queued so far into the per-class lanes
+    // Anything queued from here on (including by the actions below) waits for the next frame
+    Distribute(m_Queue.PopAll());
+
+    Store(m_LastFrameExecuted, 0);
+    Store(m_LastFrameMaxLatencyNs, 0);
+
+    uint64_t frameMaxNs = 0;
+
+    // Highest priority first, each class within its own budget
     // This runs in the Present hook at the game's natural FPS
-    while (!m_ActionQueue.empty())
+    for (size_t i = 0; i < ClassCount; i++)
     {
-        auto action = std::move(m_ActionQueue.front());
-        m_ActionQueue.pop();
+        RunClass(i, frameMaxNs);
+    }
+}
+
+void GameThreadExecutor::Distribute(ActionNode* nodes)
+{
+    while (nodes)
+    {
+        ActionNode* node = nodes;
+        nodes = node->next;
+        node->next = nullptr;
+
+        ClassQueue& cls = m_Classes[static_cast<size_t>(node->priority)];
+
+        // Few distinct owners per class - a linear scan beats hashing here
+        Lane* lane = nullptr;
+        for (Lane& candidate : cls.lanes)
+        {
+            if (candidate.owner == node->owner)
+            {
+                lane = &candidate;
+                break;
+            }
+        }
+
+        if (!lane)
+        {
+            lane = &cls.lanes.emplace_back();
+            lane->owner = node->owner;
+        }
+
+        if (lane->tail)
+        {
+            lane->tail->next = node;
+        }
+        else
+        {
+            lane->head = node;
+        }
+        lane->tail = node;
+        cls.queued++;
+    }
+}
+
+void GameThreadExecutor::RunClass(size_t classIndex, uint64_t& frameMaxNs)
+{
+    ClassQueue& cls = m_Classes[classIndex];
+    ClassCounters& counters = m_ClassCounters[classIndex];
+
+    // Publishes this class's frame metrics even if an action throws
+    struct FrameScope
+    {
+        ClassQueue& cls;
+        ClassCounters& counters;
+        int64_t startNs = NowNs();
+        uint64_t executed = 0;
+        bool overBudget = false;
+
+        ~FrameScope()
+        {
+            Store(counters.lastFrameExecuted, executed);
+            Store(counters.lastFrameDeferred, cls.queued);
+            Store(counters.lastFrameTimeNs, static_cast<uint64_t>(NowNs() - startNs));
+            Add(counters.totalExecuted, executed);
+            Add(counters.totalDeferred, cls.queued);
+            if (overBudget)
+            {
+                Add(counters.framesOverBudget, 1);
+            }
+        }
+    } scope{cls, counters};
+
+    while (!cls.lanes.empty())
+    {
+        // Always make progress, then stop once the budget is spent
+        if (scope.executed > 0 && cls.budgetNs > 0 && NowNs() - scope.startNs >= cls.budgetNs)
+        {
+            scope.overBudget = true;
+            break;
+        }
+
+        if (cls.cursor >= cls.lanes.size())
+        {
+            cls.cursor = 0;
+        }
+
+        // Take one action from the current owner, then move on to the next owner
+        Lane& lane = cls.lanes[cls.cursor];
+        ActionNode* node = lane.head;
+        lane.head = node->next;
+
+        if (lane.head)
+        {
+            cls.cursor++;
+        }
+        else
+        {
+            // Drained - dropping the lane leaves the cursor on the next owner
+            cls.lanes.erase(cls.lanes.begin() + cls.cursor);
+        }
+
+        cls.queued--;
+        scope.executed++;
+        m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
+        counters.backlog.fetch_sub(1, std::memory_order_relaxed);
+
+        int64_t latencyNs = NowNs() - node->enqueuedNs;
+        RecordLatency(latencyNs > 0 ? static_cast<uint64_t>(latencyNs) : 0, frameMaxNs);
+
+        Action action = std::move(node->action);
+        FreeNode(node);
 
         // Execute the action
-        // If it throws, we'll catch it in the caller (Framework main loop)
+        // If it throws, we'll catch it in the caller (Framework main loop);
+        // everything not yet run stays queued for the next frame
         action();
     }
 }
 
+void GameThreadExecutor::SetFrameBudget(Priority priority, std::chrono::microseconds budget)
+{
+    if (priority >= Priority::Count)
+    {
+        return;
+    }
+
+    int64_t budgetNs = std::chrono::duration_cast<std::chrono::nanoseconds>(budget).count();
+    m_Classes[static_cast<size_t>(priority)].budgetNs = budgetNs > 0 ? budgetNs : 0;
+}
+
+std::chrono::microseconds GameThreadExecutor::GetFrameBudget(Priority priority) const
+{
+    if (priority >= Priority::Count)
+    {
+        return std::chrono::microseconds(0);
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::nanoseconds(m_Classes[static_cast<size_t>(priority)].budgetNs));
+}
+
 void GameThreadExecutor::Clear()
 {
     // Clear all pending actions
-    while (!m_ActionQueue.empty())
+    Distribute(m_Queue.PopAll());
+
+    for (size_t i = 0; i < ClassCount; i++)
     {
-        m_ActionQueue.pop();
+        ClassQueue& cls = m_Classes[i];
+
+        for (Lane& lane : cls.lanes)
+        {
+            ActionNode* node = lane.head;
+            while (node)
+            {
+                ActionNode* next = node->next;
+                FreeNode(node);
+                m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
+                m_ClassCounters[i].backlog.fetch_sub(1, std::memory_order_relaxed);
+                node = next;
+            }
+        }
+
+        cls.lanes.clear();
+        cls.cursor = 0;
+        cls.queued = 0;
     }
 }
 
+bool GameThreadExecutor::IsGameThread() const
+{
+    return m_GameThreadId.load(std::memory_order_relaxed) == std::this_thread::get_id();
+}
+
 size_t GameThreadExecutor::PendingCount() const
 {
-    return m_ActionQueue.size();
+    return m_PendingCount.load(std::memory_order_relaxed);
+}
+
+GameThreadExecutor::LatencyStats GameThreadExecutor::GetLatencyStats() const
+{
+    LatencyStats stats;
+    stats.executed = m_Executed.load(std::memory_order_relaxed);
+    stats.totalNs = m_TotalLatencyNs.load(std::memory_order_relaxed);
+    stats.maxNs = m_MaxLatencyNs.load(std::memory_order_relaxed);
+    stats.lastFrameExecuted = m_LastFrameExecuted.load(std::memory_order_relaxed);
+    stats.lastFrameMaxNs = m_LastFrameMaxLatencyNs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+GameThreadExecutor::ClassStats GameThreadExecutor::GetClassStats(Priority priority) const
+{
+    ClassStats stats;
+    if (priority >= Priority::Count)
+    {
+        return stats;
+    }
+
+    const ClassCounters& counters = m_ClassCounters[static_cast<size_t>(priority)];
+    stats.backlog = counters.backlog.load(std::memory_order_relaxed);
+    stats.lastFrameExecuted = counters.lastFrameExecuted.load(std::memory_order_relaxed);
+    stats.lastFrameDeferred = counters.lastFrameDeferred.load(std::memory_order_relaxed);
+    stats.lastFrameTimeNs = counters.lastFrameTimeNs.load(std::memory_order_relaxed);
+    stats.totalExecuted = counters.totalExecuted.load(std::memory_order_relaxed);
+    stats.totalDeferred = counters.totalDeferred.load(std::memory_order_relaxed);
+    stats.framesOverBudget = counters.framesOverBudget.load(std::memory_order_relaxed);
+    return stats;
+}
+
+GameThreadExecutor::AllocationStats GameThreadExecutor::GetAllocationStats() const
+{
+    AllocationStats stats;
+    stats.slabCapacity = m_NodePool.Capacity();
+    stats.nodesInUse = m_NodePool.InUse();
+    stats.heapNodes = m_HeapNodes.load(std::memory_order_relaxed);
+    stats.captureFallbacks = Action::HeapFallbackCount();
+    return stats;
+}
+
+void GameThreadExecutor::ResetLatencyStats()
+{
+    Store(m_Executed, 0);
+    Store(m_TotalLatencyNs, 0);
+    Store(m_MaxLatencyNs, 0);
+    Store(m_LastFrameExecuted, 0);
+    Store(m_LastFrameMaxLatencyNs, 0);
+}
+
+int64_t GameThreadExecutor::NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void GameThreadExecutor::RecordLatency(uint64_t latencyNs, uint64_t& frameMaxNs)
+{
+    Add(m_Executed, 1);
+    Add(m_TotalLatencyNs, latencyNs);
+    Add(m_LastFrameExecuted, 1);
+
+    if (latencyNs > m_MaxLatencyNs.load(std::memory_order_relaxed))
+    {
+        Store(m_MaxLatencyNs, latencyNs);
+    }
+
+    if (latencyNs > frameMaxNs)
+    {
+        frameMaxNs = latencyNs;
+        Store(m_LastFrameMaxLatencyNs, latencyNs);
+    }
+}
+
+// Single writer (game thread) - plain load/store is enough, no RMW needed
+void GameThreadExecutor::Store(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(value, std::memory_order_relaxed);
+}
+
+void GameThreadExecutor::Add(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
 }
 
 } // namespace Broadsword::Foundation
@@ -1,7 +1,15 @@
 #pragma once
 
-#include <functional>
-#include <queue>
+#include "InlineFunction.hpp"
+#include "MPSCQueue.hpp"
+#include "SlabPool.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace Broadsword::Foundation
 {
@@ -12,27 +20,127 @@ namespace Broadsword::Foundation
 // This executor runs in the DirectX Present hook, which is called at the game's natural FPS.
 //
 // NO frame timing, NO sleep, NO hardcoded FPS - just process queue when game renders.
+//
+// QueueAction() is safe to call from any thread (lock-free MPSC submission), so
+// mods can do work on their own threads and hand results back to the game thread.
+//
+// Frame budgeting:
+// - Each action has a priority class (Critical, Normal, Background)
+// - Each class has its own per-frame time budget; whatever doesn't fit carries
+//   over to the next frame instead of stretching the current one
+// - Within a class, actions are grouped by owner (usually the submitting mod) and
+//   run round-robin, so one mod queueing 5,000 actions can't starve the others
+// - Every class makes progress of at least one action per frame
+//
+// Allocation-free in steady state: actions are stored in 64-byte inline callables
+// inside queue nodes recycled through a slab; only captures larger than 64 bytes
+// (or an exhausted slab) touch the heap, and both are counted in GetAllocationStats().
 class GameThreadExecutor
 {
 public:
+    enum class Priority : uint8_t
+    {
+        Critical,   // Default unlimited budget - always drained
+        Normal,     // Default 2 ms per frame
+        Background, // Default 0.5 ms per frame
+        Count
+    };
+
+    struct SubmitOptions
+    {
+        Priority priority = Priority::Normal;
+        const void* owner = nullptr; // Fairness key (e.g. the mod's `this`)
+    };
+
+    // Enqueue-to-execute latency, measured when each action starts running
+    struct LatencyStats
+    {
+        uint64_t executed = 0;          // Actions executed since start
+        uint64_t totalNs = 0;           // Sum of all latencies
+        uint64_t maxNs = 0;             // Worst latency since start
+        uint64_t lastFrameExecuted = 0; // Actions executed by the last ProcessQueue()
+        uint64_t lastFrameMaxNs = 0;    // Worst latency in the last ProcessQueue()
+
+        double AverageNs() const { return executed ? static_cast<double>(totalNs) / executed : 0.0; }
+    };
+
+    // Backlog and deferral metrics for one priority class
+    struct ClassStats
+    {
+        uint64_t backlog = 0;           // Actions waiting (queued + carried over)
+        uint64_t lastFrameExecuted = 0; // Actions run by the last ProcessQueue()
+        uint64_t lastFrameDeferred = 0; // Actions left over by the last ProcessQueue()
+        uint64_t lastFrameTimeNs = 0;   // Time spent in this class by the last ProcessQueue()
+        uint64_t totalExecuted = 0;
+        uint64_t totalDeferred = 0;     // Sum of lastFrameDeferred over all frames
+        uint64_t framesOverBudget = 0;  // Frames where the budget ran out with work left
+    };
+
+    // Queued callable - 64 bytes of inline capture storage
+    using Action = InlineFunction<void(), 64>;
+
+    struct AllocationStats
+    {
+        uint64_t slabCapacity = 0;    // Nodes the slab has grown to
+        uint64_t nodesInUse = 0;      // Slab nodes currently queued
+        uint64_t heapNodes = 0;       // Nodes heap-allocated because the slab was exhausted
+        uint64_t captureFallbacks = 0; // Callables too large for inline storage (all InlineFunctions)
+    };
+
     static GameThreadExecutor& Get();
 
-    // Queue an action to be executed on the next frame
-    void QueueAction(std::function<void()> action);
+    // Queue an action to be executed on a following frame
+    // Accepts any void() callable (lambda, function pointer, std::function, move-only captures)
+    // Thread-safe: may be called from any thread, including from inside a running action
+    template <typename Fn>
+    void QueueAction(Fn&& action)
+    {
+        QueueAction(std::forward<Fn>(action), SubmitOptions{});
+    }
 
-    // Process all queued actions
-    // Called from the Present hook (runs at game's FPS)
+    template <typename Fn>
+    void QueueAction(Fn&& action, const SubmitOptions& options)
+    {
+        Action stored(std::forward<Fn>(action));
+        if (!stored)
+        {
+            return;
+        }
+
+        ActionNode* node = AllocateNode();
+        node->action = std::move(stored);
+        Enqueue(node, options);
+    }
+
+    // Process the actions queued before this call, within each class's budget
+    // Actions queued while processing are not considered until the next call.
+    // Called from the Present hook (runs at game's FPS) - game thread only
     void ProcessQueue();
 
-    // Clear all pending actions
+    // Per-frame time budget for a priority class (0 = unlimited)
+    // Game thread only
+    void SetFrameBudget(Priority priority, std::chrono::microseconds budget);
+    std::chrono::microseconds GetFrameBudget(Priority priority) const;
+
+    // Clear all pending actions (game thread only)
     void Clear();
 
-    // Get number of pending actions
+    // True when called from the thread that runs ProcessQueue()
+    // (false until the first ProcessQueue() call)
+    bool IsGameThread() const;
+
+    // Get number of pending actions (approximate when producers are active)
     size_t PendingCount() const;
 
+    // Metrics (safe to read from any thread)
+    LatencyStats GetLatencyStats() const;
+    ClassStats GetClassStats(Priority priority) const;
+    AllocationStats GetAllocationStats() const;
+    void ResetLatencyStats();
+
 private:
-    GameThreadExecutor() = default;
-    ~GameThreadExecutor() = default;
+    GameThreadExecutor();
+    ~GameThreadExecutor();
 
     // Delete copy/move
     GameThreadExecutor(const GameThreadExecutor&) = delete;
@@ -40,10 +148,75 @@ private:
     GameThreadExecutor(GameThreadExecutor&&) = delete;
     GameThreadExecutor& operator=(GameThreadExecutor&&) = delete;
 
-    std::queue<std::function<void()>> m_ActionQueue;
+    static constexpr size_t ClassCount = static_cast<size_t>(Priority::Count);
+
+    struct ActionNode
+    {
+        ActionNode* next = nullptr;
+        Action action;
+        int64_t enqueuedNs = 0;
+        const void* owner = nullptr;
+        Priority priority = Priority::Normal;
+        bool pooled = true;
+    };
+
+    // FIFO of one owner's carried-over actions within a class
+    struct Lane
+    {
+        const void* owner = nullptr;
+        ActionNode* head = nullptr;
+        ActionNode* tail = nullptr;
+    };
+
+    // Written by the game thread only, relaxed atomics so other threads can read them
+    struct ClassCounters
+    {
+        std::atomic<uint64_t> backlog{0};
+        std::atomic<uint64_t> lastFrameExecuted{0};
+        std::atomic<uint64_t> lastFrameDeferred{0};
+        std::atomic<uint64_t> lastFrameTimeNs{0};
+        std::atomic<uint64_t> totalExecuted{0};
+        std::atomic<uint64_t> totalDeferred{0};
+        std::atomic<uint64_t> framesOverBudget{0};
+    };
+
+    // Game-thread-only scheduling state for one class
+    struct ClassQueue
+    {
+        std::vector<Lane> lanes;
+        size_t cursor = 0;     // Round-robin position, persists across frames
+        size_t queued = 0;     // Actions across all lanes
+        int64_t budgetNs = 0;  // 0 = unlimited
+    };
+
+    static int64_t NowNs();
+
+    ActionNode* AllocateNode();
+    void FreeNode(ActionNode* node);
+    void Enqueue(ActionNode* node, const SubmitOptions& options);
+
+    void Distribute(ActionNode* nodes);
+    void RunClass(size_t classIndex, uint64_t& frameMaxNs);
+    void RecordLatency(uint64_t latencyNs, uint64_t& frameMaxNs);
+
+    static void Store(std::atomic<uint64_t>& counter, uint64_t value);
+    static void Add(std::atomic<uint64_t>& counter, uint64_t value);
+
+    MPSCQueue<ActionNode> m_Queue;
+    SlabPool<ActionNode> m_NodePool;
+    std::atomic<uint64_t> m_HeapNodes{0};
+
+    std::array<ClassQueue, ClassCount> m_Classes;
+    std::array<ClassCounters, ClassCount> m_ClassCounters;
+
+    std::atomic<size_t> m_PendingCount{0};
+    std::atomic<std::thread::id> m_GameThreadId{};
 
-    // NOTE: No mutex needed - ProcessQueue() is only called from Present hook (game thread)
-    // and mods should only queue actions from game thread (OnFrame callbacks)
+    std::atomic<uint64_t> m_Executed{0};
+    std::atomic<uint64_t> m_TotalLatencyNs{0};
+    std::atomic<uint64_t> m_MaxLatencyNs{0};
+    std::atomic<uint64_t> m_LastFrameExecuted{0};
+    std::atomic<uint64_t> m_LastFrameMaxLatencyNs{0};
 };
 
 } // namespace Broadsword::Foundation
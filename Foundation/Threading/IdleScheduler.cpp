@@ -0,0 +1,290 @@
+#include "IdleScheduler.hpp"
+
+#include <exception>
+
+namespace Broadsword::Foundation
+{
+
+IdleScheduler& IdleScheduler::Get()
+{
+    static IdleScheduler instance;
+    return instance;
+}
+
+IdleScheduler::TaskId IdleScheduler::Register(std::string name, std::chrono::milliseconds interval, Slice slice)
+{
+    // At least 1 ms, so a finished task can't spin for the rest of the window
+    int64_t intervalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+    return Add(std::move(name), intervalNs > 1'000'000 ? intervalNs : 1'000'000, false, std::move(slice));
+}
+
+IdleScheduler::TaskId IdleScheduler::Post(std::string name, Slice slice)
+{
+    return Add(std::move(name), 0, true, std::move(slice));
+}
+
+IdleScheduler::TaskId IdleScheduler::Add(std::string name, int64_t intervalNs, bool oneShot, Slice slice)
+{
+    if (!slice)
+    {
+        return 0;
+    }
+
+    Task task;
+    task.id = m_NextId++;
+    task.name = std::move(name);
+    task.slice = std::move(slice);
+    task.intervalNs = intervalNs;
+    task.oneShot = oneShot;
+    task.dueNs = oneShot ? 0 : NowNs() + intervalNs;
+
+    // Slices may register tasks - m_Tasks is indexed (not iterated by reference) in RunIdle,
+    // and the running slice has been moved out of its Task
+    m_Tasks.push_back(std::move(task));
+    return m_Tasks.back().id;
+}
+
+bool IdleScheduler::Unregister(TaskId id)
+{
+    Task* task = Find(id);
+    if (!task)
+    {
+        return false;
+    }
+
+    // Erasing is deferred so RunIdle's indices stay valid
+    task->removed = true;
+    task->slice = nullptr;
+    m_HasRemoved = true;
+
+    if (!m_InRun)
+    {
+        Compact();
+    }
+    return true;
+}
+
+void IdleScheduler::Wake(TaskId id)
+{
+    if (Task* task = Find(id))
+    {
+        task->dueNs = 0;
+    }
+}
+
+void IdleScheduler::BeginPresent()
+{
+    m_PresentBeginNs = NowNs();
+}
+
+void IdleScheduler::RunIdle()
+{
+    int64_t start = NowNs();
+
+    // CPU time of this frame: from the last Present returning to this Present starting
+    // (includes our own idle work last frame, so the budget self-corrects)
+    int64_t slack = 0;
+    if (m_LastPresentReturnNs != 0 && m_PresentBeginNs > m_LastPresentReturnNs)
+    {
+        slack = m_TargetNs - (m_PresentBeginNs - m_LastPresentReturnNs);
+    }
+    m_LastPresentReturnNs = start;
+    m_Stats.lastSlackNs = slack;
+
+    int64_t budget = m_MinBudgetNs;
+    if (slack > 0)
+    {
+        budget += slack / 2;
+        budget = budget < m_MaxBudgetNs ? budget : m_MaxBudgetNs;
+    }
+
+    m_Stats.lastBudgetNs = static_cast<uint64_t>(budget);
+    m_Stats.lastUsedNs = 0;
+
+    if (m_Tasks.empty() || budget <= 0)
+    {
+        return;
+    }
+
+    std::exception_ptr error;
+    bool ranAny = false;
+    size_t idleVisits = 0;
+    int64_t now = start;
+
+    m_InRun = true;
+
+    // Stop once the budget is spent or a full round found nothing due
+    while (now - start < budget && idleVisits < m_Tasks.size())
+    {
+        if (m_Cursor >= m_Tasks.size())
+        {
+            m_Cursor = 0;
+        }
+
+        size_t index = m_Cursor++;
+        if (m_Tasks[index].removed || !IsDue(m_Tasks[index], now))
+        {
+            idleVisits++;
+            continue;
+        }
+        idleVisits = 0;
+
+        // Run the slice from a local: it may register tasks (moving m_Tasks) or unregister
+        // itself, neither of which may destroy the closure while it executes
+        Slice slice = std::move(m_Tasks[index].slice);
+
+        bool more = false;
+        try
+        {
+            more = slice();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+
+        int64_t after = NowNs();
+        int64_t sliceNs = after - now;
+        now = after;
+
+        // Re-index: the slice may have registered tasks (vector growth)
+        Task& task = m_Tasks[index];
+        task.slices++;
+        task.totalNs += static_cast<uint64_t>(sliceNs);
+        task.maxSliceNs = static_cast<uint64_t>(sliceNs) > task.maxSliceNs ? static_cast<uint64_t>(sliceNs) : task.maxSliceNs;
+        m_Stats.slices++;
+        ranAny = true;
+
+        if (task.removed)
+        {
+            continue;
+        }
+        task.slice = std::move(slice);
+
+        task.running = more;
+        if (!more)
+        {
+            if (task.oneShot)
+            {
+                task.removed = true;
+                task.slice = nullptr;
+                m_HasRemoved = true;
+            }
+            else
+            {
+                task.dueNs = now + task.intervalNs;
+            }
+        }
+    }
+
+    m_InRun = false;
+
+    if (m_HasRemoved)
+    {
+        Compact();
+    }
+
+    if (ranAny)
+    {
+        m_Stats.idleWindows++;
+    }
+    m_Stats.lastUsedNs = static_cast<uint64_t>(now - start);
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void IdleScheduler::SetTargetFrameTime(std::chrono::microseconds target)
+{
+    int64_t targetNs = std::chrono::duration_cast<std::chrono::nanoseconds>(target).count();
+    m_TargetNs = targetNs > 0 ? targetNs : 0;
+}
+
+void IdleScheduler::SetBudget(std::chrono::microseconds minBudget, std::chrono::microseconds maxBudget)
+{
+    int64_t minNs = std::chrono::duration_cast<std::chrono::nanoseconds>(minBudget).count();
+    int64_t maxNs = std::chrono::duration_cast<std::chrono::nanoseconds>(maxBudget).count();
+    m_MinBudgetNs = minNs > 0 ? minNs : 0;
+    m_MaxBudgetNs = maxNs > m_MinBudgetNs ? maxNs : m_MinBudgetNs;
+}
+
+std::vector<IdleScheduler::TaskStats> IdleScheduler::GetTaskStats() const
+{
+    std::vector<TaskStats> result;
+    result.reserve(m_Tasks.size());
+
+    int64_t now = NowNs();
+    for (const Task& task : m_Tasks)
+    {
+        if (task.removed)
+        {
+            continue;
+        }
+
+        TaskStats stats;
+        stats.id = task.id;
+        stats.name = task.name;
+        stats.slices = task.slices;
+        stats.totalNs = task.totalNs;
+        stats.maxSliceNs = task.maxSliceNs;
+        stats.pending = IsDue(task, now);
+        result.push_back(std::move(stats));
+    }
+
+    return result;
+}
+
+int64_t IdleScheduler::NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+IdleScheduler::Task* IdleScheduler::Find(TaskId id)
+{
+    for (Task& task : m_Tasks)
+    {
+        if (task.id == id && !task.removed)
+        {
+            return &task;
+        }
+    }
+    return nullptr;
+}
+
+bool IdleScheduler::IsDue(const Task& task, int64_t now) const
+{
+    return task.running || now >= task.dueNs;
+}
+
+void IdleScheduler::Compact()
+{
+    size_t write = 0;
+    for (size_t read = 0; read < m_Tasks.size(); read++)
+    {
+        if (m_Tasks[read].removed)
+        {
+            if (read < m_Cursor && m_Cursor > 0)
+            {
+                m_Cursor--;
+            }
+            continue;
+        }
+
+        if (write != read)
+        {
+            m_Tasks[write] = std::move(m_Tasks[read]);
+        }
+        write++;
+    }
+
+    m_Tasks.resize(write);
+    m_HasRemoved = false;
+}
+
+} // namespace Broadsword::Foundation
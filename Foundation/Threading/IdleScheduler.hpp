@@ -0,0 +1,132 @@
+#pragma once
+
+#include "InlineFunction.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Broadsword::Foundation
+{
+
+// IdleScheduler - Low-priority work run after the original Present returns
+//
+// Everything before oPresent is on the frame's critical path. Housekeeping (config
+// autosave, log/cache maintenance, index refreshes) instead runs right after Present
+// returns, while the GPU is still busy with the frame just submitted:
+// - Every frame gets a small base slice (min budget)
+// - Frames whose CPU time came in under the target frame time get part of the
+//   remaining slack as extra budget, up to the max budget
+// - Tasks are split into slices: a slice returns true if it has more work, and the
+//   scheduler keeps calling it on later idle windows until it returns false
+// - Tasks are visited round-robin, so a long rebuild can't starve autosave
+//
+// Thread Safety:
+// - All methods are game thread only (register from other threads via GameThreadExecutor)
+class IdleScheduler
+{
+public:
+    // One slice of work - return true if more work remains
+    using Slice = InlineFunction<bool(), 64>;
+    using TaskId = uint32_t;
+
+    struct Stats
+    {
+        uint64_t idleWindows = 0;     // RunIdle() calls that had budget and work
+        uint64_t slices = 0;          // Slices executed
+        uint64_t lastBudgetNs = 0;    // Budget granted in the last RunIdle()
+        uint64_t lastUsedNs = 0;      // Time actually spent in the last RunIdle()
+        int64_t lastSlackNs = 0;      // Target minus CPU frame time for the last frame
+    };
+
+    struct TaskStats
+    {
+        TaskId id = 0;
+        std::string name;
+        uint64_t slices = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxSliceNs = 0;
+        bool pending = false; // Has work (mid-run or due)
+    };
+
+    static IdleScheduler& Get();
+
+    // Recurring task: whenever `interval` (minimum 1 ms) has elapsed since it last finished,
+    // its slice is called on idle windows until it returns false
+    TaskId Register(std::string name, std::chrono::milliseconds interval, Slice slice);
+
+    // One-shot task: sliced until it returns false, then removed
+    TaskId Post(std::string name, Slice slice);
+
+    // Remove a task (safe from inside a slice)
+    bool Unregister(TaskId id);
+
+    // Mark a recurring task due now (e.g. after its data changed)
+    void Wake(TaskId id);
+
+    // Record the start of the original Present (measures the frame's CPU time)
+    void BeginPresent();
+
+    // Run idle slices - call right after the original Present returns
+    // A throwing slice ends its current run; the first exception is rethrown at the end
+    void RunIdle();
+
+    // Frame time the game is expected to hit (default 16.667 ms)
+    void SetTargetFrameTime(std::chrono::microseconds target);
+
+    // Base budget every frame gets, and the cap including slack (defaults 0.2 ms / 2 ms)
+    void SetBudget(std::chrono::microseconds minBudget, std::chrono::microseconds maxBudget);
+
+    Stats GetStats() const { return m_Stats; }
+    std::vector<TaskStats> GetTaskStats() const;
+
+private:
+    IdleScheduler() = default;
+    ~IdleScheduler() = default;
+
+    // Delete copy/move
+    IdleScheduler(const IdleScheduler&) = delete;
+    IdleScheduler& operator=(const IdleScheduler&) = delete;
+    IdleScheduler(IdleScheduler&&) = delete;
+    IdleScheduler& operator=(IdleScheduler&&) = delete;
+
+    struct Task
+    {
+        TaskId id = 0;
+        std::string name;
+        Slice slice;
+        int64_t intervalNs = 0;
+        int64_t dueNs = 0;     // Earliest time the next run may start
+        bool oneShot = false;
+        bool running = false;  // Last slice returned true
+        bool removed = false;
+
+        uint64_t slices = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxSliceNs = 0;
+    };
+
+    static int64_t NowNs();
+
+    TaskId Add(std::string name, int64_t intervalNs, bool oneShot, Slice slice);
+    Task* Find(TaskId id);
+    bool IsDue(const Task& task, int64_t now) const;
+    void Compact();
+
+    std::vector<Task> m_Tasks;
+    size_t m_Cursor = 0;
+    TaskId m_NextId = 1;
+    bool m_InRun = false;
+    bool m_HasRemoved = false;
+
+    int64_t m_TargetNs = 16'666'667;
+    int64_t m_MinBudgetNs = 200'000;
+    int64_t m_MaxBudgetNs = 2'000'000;
+
+    int64_t m_LastPresentReturnNs = 0;
+    int64_t m_PresentBeginNs = 0;
+
+    Stats m_Stats;
+};
+
+} // namespace Broadsword::Foundation
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Broadsword::Foundation
+{
+
+namespace Detail
+{
+    inline std::atomic<uint64_t> s_InlineFunctionHeapFallbacks{0};
+}
+
+// InlineFunction - Move-only type-erased callable with fixed inline storage
+//
+// Drop-in for std::function<R(Args...)> on hot queues. Callables up to Capacity bytes
+// (default 64 - room for `this` plus several captured pointers/values) are stored in place,
+// so constructing, moving and destroying one never touches the heap. Larger or
+// throwing-move callables fall back to a heap allocation, counted by HeapFallbackCount().
+//
+// Unlike std::function, move-only captures (std::unique_ptr, etc.) are allowed.
+template <typename Signature, size_t Capacity = 64>
+class InlineFunction;
+
+template <typename R, typename... Args, size_t Capacity>
+class InlineFunction<R(Args...), Capacity>
+{
+public:
+    InlineFunction() noexcept = default;
+    InlineFunction(std::nullptr_t) noexcept {}
+
+    template <typename Fn,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Fn>, InlineFunction> &&
+                                          std::is_invocable_r_v<R, std::decay_t<Fn>&, Args...>>>
+    InlineFunction(Fn&& fn)
+    {
+        using Stored = std::decay_t<Fn>;
+
+        // Empty std::function / null function pointer stay empty
+        if constexpr (std::is_constructible_v<bool, const Stored&>)
+        {
+            if (!static_cast<bool>(fn))
+            {
+                return;
+            }
+        }
+
+        if constexpr (FitsInline<Stored>)
+        {
+            ::new (static_cast<void*>(m_Storage)) Stored(std::forward<Fn>(fn));
+            m_Ops = &InlineOps<Stored>::Table;
+        }
+        else
+        {
+            Detail::s_InlineFunctionHeapFallbacks.fetch_add(1, std::memory_order_relaxed);
+            ::new (static_cast<void*>(m_Storage)) Stored*(new Stored(std::forward<Fn>(fn)));
+            m_Ops = &HeapOps<Stored>::Table;
+        }
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction& operator=(std::nullptr_t) noexcept
+    {
+        Reset();
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction&) = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+
+    ~InlineFunction()
+    {
+        Reset();
+    }
+
+    R operator()(Args... args)
+    {
+        return m_Ops->invoke(m_Storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return m_Ops != nullptr; }
+
+    // True if the callable lives in the inline buffer (no heap allocation)
+    bool IsInline() const noexcept { return m_Ops && m_Ops->isInline; }
+
+    void Reset() noexcept
+    {
+        if (m_Ops)
+        {
+            m_Ops->destroy(m_Storage);
+            m_Ops = nullptr;
+        }
+    }
+
+    // Number of callables (of any InlineFunction type) that didn't fit inline
+    static uint64_t HeapFallbackCount() noexcept
+    {
+        return Detail::s_InlineFunctionHeapFallbacks.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Ops
+    {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*move)(void* dst, void* src) noexcept; // Move-constructs into dst, destroys src
+        void (*destroy)(void* storage) noexcept;
+        bool isInline;
+    };
+
+    template <typename Fn>
+    static constexpr bool FitsInline = sizeof(Fn) <= Capacity &&
+                                       alignof(Fn) <= alignof(std::max_align_t) &&
+                                       std::is_nothrow_move_constructible_v<Fn>;
+
+    template <typename Fn>
+    struct InlineOps
+    {
+        static R Invoke(void* storage, Args&&... args)
+        {
+            return (*static_cast<Fn*>(storage))(std::forward<Args>(args)...);
+        }
+
+        static void Move(void* dst, void* src) noexcept
+        {
+            Fn* from = static_cast<Fn*>(src);
+            ::new (dst) Fn(std::move(*from));
+            from->~Fn();
+        }
+
+        static void Destroy(void* storage) noexcept
+        {
+            static_cast<Fn*>(storage)->~Fn();
+        }
+
+        static constexpr Ops Table{&Invoke, &Move, &Destroy, true};
+    };
+
+    template <typename Fn>
+    struct HeapOps
+    {
+        static R Invoke(void* storage, Args&&... args)
+        {
+            return (**static_cast<Fn**>(storage))(std::forward<Args>(args)...);
+        }
+
+        static void Move(void* dst, void* src) noexcept
+        {
+            ::new (dst) Fn*(*static_cast<Fn**>(src));
+        }
+
+        static void Destroy(void* storage) noexcept
+        {
+            delete *static_cast<Fn**>(storage);
+        }
+
+        static constexpr Ops Table{&Invoke, &Move, &Destroy, false};
+    };
+
+    void MoveFrom(InlineFunction& other) noexcept
+    {
+        if (other.m_Ops)
+        {
+            other.m_Ops->move(m_Storage, other.m_Storage);
+            m_Ops = other.m_Ops;
+            other.m_Ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_Storage[Capacity];
+    const Ops* m_Ops = nullptr;
+};
+
+} // namespace Broadsword::Foundation
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+
+namespace Broadsword::Foundation
+{
+
+// MPSCQueue - Intrusive lock-free multi-producer / single-consumer queue
+//
+// Nodes are owned by the caller and must expose an `Node* next` member.
+// Producers push with a single CAS onto an atomic list head (lock-free, never blocks).
+// The consumer detaches everything published so far with one atomic exchange and
+// gets it back in FIFO order, so draining is a snapshot: nodes pushed while the
+// consumer is working on a batch land in the next batch.
+//
+// No allocation happens inside the queue - lifetime of nodes is up to the user.
+template <typename Node>
+class MPSCQueue
+{
+public:
+    MPSCQueue() = default;
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    // Push a node (any thread)
+    void Push(Node* node)
+    {
+        Node* head = m_Head.load(std::memory_order_relaxed);
+        do
+        {
+            node->next = head;
+        } while (!m_Head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Detach all published nodes and return them oldest-first (consumer thread only)
+    // Returns nullptr if the queue is empty
+    Node* PopAll()
+    {
+        Node* node = m_Head.exchange(nullptr, std::memory_order_acquire);
+
+        // Producers build a LIFO stack - reverse once to restore submission order
+        Node* fifo = nullptr;
+        while (node)
+        {
+            Node* next = node->next;
+            node->next = fifo;
+            fifo = node;
+            node = next;
+        }
+
+        return fifo;
+    }
+
+    // Snapshot check only - may change immediately after returning
+    bool Empty() const
+    {
+        return m_Head.load(std::memory_order_relaxed) == nullptr;
+    }
+
+private:
+    std::atomic<Node*> m_Head{nullptr};
+};
+
+} // namespace Broadsword::Foundation
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace Broadsword::Foundation
+{
+
+// SlabPool - Recycling fixed-size slot allocator, lock-free from any thread
+//
+// Slots are carved from chunks of SlotsPerChunk and never returned to the heap, so once
+// the pool has grown to the steady-state working set, Allocate()/Free() are a single CAS
+// on a free list. The free list head packs a 32-bit slot index with a 32-bit tag, which
+// makes concurrent pops ABA-safe without double-width CAS.
+//
+// Allocate() returns raw storage for one T (construct with placement new) or nullptr once
+// MaxChunks are exhausted - callers fall back to the heap in that case.
+template <typename T, uint32_t SlotsPerChunk = 256, uint32_t MaxChunks = 1024>
+class SlabPool
+{
+public:
+    SlabPool() = default;
+
+    ~SlabPool()
+    {
+        for (auto& chunk : m_Chunks)
+        {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    void* Allocate()
+    {
+        // Recycled slot first
+        uint64_t head = m_FreeHead.load(std::memory_order_acquire);
+        while (Index(head) != Nil)
+        {
+            Slot* slot = SlotAt(Index(head));
+            uint32_t next = slot->next.load(std::memory_order_relaxed);
+
+            if (m_FreeHead.compare_exchange_weak(head, Pack(next, Tag(head) + 1),
+                                                 std::memory_order_acquire, std::memory_order_acquire))
+            {
+                m_InUse.fetch_add(1, std::memory_order_relaxed);
+                return slot->storage;
+            }
+        }
+
+        // Then a fresh one
+        uint32_t index = m_NextFresh.fetch_add(1, std::memory_order_relaxed);
+        if (index >= SlotsPerChunk * MaxChunks)
+        {
+            m_NextFresh.store(SlotsPerChunk * MaxChunks, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        uint32_t chunkIndex = index / SlotsPerChunk;
+        Slot* chunk = m_Chunks[chunkIndex].load(std::memory_order_acquire);
+        if (!chunk)
+        {
+            std::lock_guard<std::mutex> lock(m_GrowMutex);
+            chunk = m_Chunks[chunkIndex].load(std::memory_order_acquire);
+            if (!chunk)
+            {
+                chunk = new Slot[SlotsPerChunk];
+                for (uint32_t i = 0; i < SlotsPerChunk; i++)
+                {
+                    chunk[i].index = chunkIndex * SlotsPerChunk + i;
+                }
+                m_Chunks[chunkIndex].store(chunk, std::memory_order_release);
+                m_ChunkCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        m_InUse.fetch_add(1, std::memory_order_relaxed);
+        return chunk[index % SlotsPerChunk].storage;
+    }
+
+    // ptr must come from Allocate() on this pool (object already destroyed)
+    void Free(void* ptr)
+    {
+        Slot* slot = reinterpret_cast<Slot*>(ptr);
+        uint64_t head = m_FreeHead.load(std::memory_order_relaxed);
+
+        do
+        {
+            slot->next.store(Index(head), std::memory_order_relaxed);
+        } while (!m_FreeHead.compare_exchange_weak(head, Pack(slot->index, Tag(head) + 1),
+                                                   std::memory_order_release, std::memory_order_relaxed));
+
+        m_InUse.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    size_t InUse() const { return m_InUse.load(std::memory_order_relaxed); }
+    size_t Capacity() const { return m_ChunkCount.load(std::memory_order_relaxed) * size_t(SlotsPerChunk); }
+
+private:
+    static constexpr uint32_t Nil = 0xFFFFFFFF;
+
+    struct Slot
+    {
+        // Storage first, so the pointer handed out is also the Slot pointer
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::atomic<uint32_t> next{Nil};
+        uint32_t index = 0;
+    };
+
+    static uint32_t Index(uint64_t packed) { return static_cast<uint32_t>(packed); }
+    static uint32_t Tag(uint64_t packed) { return static_cast<uint32_t>(packed >> 32); }
+    static uint64_t Pack(uint32_t index, uint32_t tag) { return (static_cast<uint64_t>(tag) << 32) | index; }
+
+    Slot* SlotAt(uint32_t index) const
+    {
+        return &m_Chunks[index / SlotsPerChunk].load(std::memory_order_acquire)[index % SlotsPerChunk];
+    }
+
+    std::atomic<uint64_t> m_FreeHead{Pack(Nil, 0)};
+    std::atomic<uint32_t> m_NextFresh{0};
+    std::atomic<size_t> m_InUse{0};
+    std::atomic<size_t> m_ChunkCount{0};
+
+    std::atomic<Slot*> m_Chunks[MaxChunks] = {};
+    std::mutex m_GrowMutex;
+};
+
+} // namespace Broadsword::Foundation
@@ -0,0 +1,371 @@
+#include "TimerWheel.hpp"
+
+#include <bit>
+#include <exception>
+
+namespace Broadsword::Foundation
+{
+
+TimerWheel& TimerWheel::Get()
+{
+    static TimerWheel instance;
+    return instance;
+}
+
+TimerWheel::TimerWheel()
+    : m_Start(std::chrono::steady_clock::now())
+{
+    for (Wheel* wheel : {&m_Frames, &m_Millis})
+    {
+        for (auto& level : wheel->slots)
+        {
+            level.fill(Nil);
+        }
+    }
+}
+
+TimerWheel::TimerHandle TimerWheel::AfterFrames(uint64_t frames, Callback callback, uint64_t intervalFrames)
+{
+    return Schedule(Domain::Frames, frames, intervalFrames, std::move(callback));
+}
+
+TimerWheel::TimerHandle TimerWheel::EveryFrames(uint64_t frames, Callback callback)
+{
+    return Schedule(Domain::Frames, frames, frames > 0 ? frames : 1, std::move(callback));
+}
+
+TimerWheel::TimerHandle TimerWheel::After(std::chrono::milliseconds delay, Callback callback,
+                                          std::chrono::milliseconds interval)
+{
+    uint64_t delayMs = delay.count() > 0 ? static_cast<uint64_t>(delay.count()) : 0;
+    uint64_t intervalMs = interval.count() > 0 ? static_cast<uint64_t>(interval.count()) : 0;
+    return Schedule(Domain::Milliseconds, delayMs, intervalMs, std::move(callback));
+}
+
+TimerWheel::TimerHandle TimerWheel::Every(std::chrono::milliseconds interval, Callback callback)
+{
+    uint64_t intervalMs = interval.count() > 0 ? static_cast<uint64_t>(interval.count()) : 1;
+    return Schedule(Domain::Milliseconds, intervalMs, intervalMs, std::move(callback));
+}
+
+TimerWheel::TimerHandle TimerWheel::Schedule(Domain domain, uint64_t delay, uint64_t interval, Callback callback)
+{
+    if (!callback)
+    {
+        return {};
+    }
+
+    Wheel& wheel = WheelFor(domain);
+
+    uint32_t index = AllocNode();
+    Node& node = m_Nodes[index];
+    node.domain = domain;
+    node.cancelled = false;
+    node.when = wheel.now + (delay > 0 ? delay : 1); // Never fire within the current tick
+    node.interval = interval;
+    node.callback = std::move(callback);
+
+    Link(wheel, index);
+    m_ActiveCount++;
+
+    return {index, node.generation};
+}
+
+bool TimerWheel::Cancel(TimerHandle handle)
+{
+    if (!IsScheduled(handle))
+    {
+        return false;
+    }
+
+    Node& node = m_Nodes[handle.index];
+
+    if (node.state == State::Scheduled)
+    {
+        Unlink(WheelFor(node.domain), handle.index);
+        FreeNode(handle.index);
+    }
+    else
+    {
+        // Due or running - the tick that owns it frees it after the callback returns
+        node.cancelled = true;
+    }
+
+    m_ActiveCount--;
+    return true;
+}
+
+bool TimerWheel::IsScheduled(TimerHandle handle) const
+{
+    if (handle.index >= m_Nodes.size())
+    {
+        return false;
+    }
+
+    const Node& node = m_Nodes[handle.index];
+    return node.generation == handle.generation && node.state != State::Free && !node.cancelled;
+}
+
+void TimerWheel::Tick()
+{
+    Advance(m_Frames, m_Frames.now + 1);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - m_Start);
+    Advance(m_Millis, static_cast<uint64_t>(elapsed.count()));
+}
+
+void TimerWheel::Clear()
+{
+    for (uint32_t i = 0; i < m_Nodes.size(); i++)
+    {
+        Node& node = m_Nodes[i];
+
+        if (node.state == State::Scheduled)
+        {
+            Unlink(WheelFor(node.domain), i);
+            FreeNode(i);
+        }
+        else if (node.state != State::Free)
+        {
+            node.cancelled = true;
+        }
+    }
+
+    m_ActiveCount = 0;
+}
+
+uint32_t TimerWheel::AllocNode()
+{
+    if (m_FreeHead != Nil)
+    {
+        uint32_t index = m_FreeHead;
+        m_FreeHead = m_Nodes[index].next;
+        return index;
+    }
+
+    m_Nodes.emplace_back();
+    return static_cast<uint32_t>(m_Nodes.size() - 1);
+}
+
+void TimerWheel::FreeNode(uint32_t index)
+{
+    Node& node = m_Nodes[index];
+    node.generation++; // Invalidates outstanding handles
+    node.state = State::Free;
+    node.callback = nullptr;
+    node.prev = Nil;
+    node.next = m_FreeHead;
+    m_FreeHead = index;
+}
+
+void TimerWheel::Link(Wheel& wheel, uint32_t index)
+{
+    Node& node = m_Nodes[index];
+
+    // Timers further out than the wheel can represent park in the top level
+    // and are re-linked when they come back around
+    uint64_t delta = node.when > wheel.now ? node.when - wheel.now : 0;
+    if (delta > MaxDelta)
+    {
+        delta = MaxDelta;
+    }
+    uint64_t target = wheel.now + delta;
+
+    uint32_t level = 0;
+    while (level + 1 < LevelCount && delta >= (1ull << (SlotBits * (level + 1))))
+    {
+        level++;
+    }
+    uint32_t slot = static_cast<uint32_t>(target >> (SlotBits * level)) & SlotMask;
+
+    uint32_t& head = wheel.slots[level][slot];
+    node.state = State::Scheduled;
+    node.level = static_cast<uint8_t>(level);
+    node.slot = static_cast<uint8_t>(slot);
+    node.prev = Nil;
+    node.next = head;
+    if (head != Nil)
+    {
+        m_Nodes[head].prev = index;
+    }
+    head = index;
+
+    wheel.occupied[level] |= 1ull << slot;
+    wheel.count++;
+}
+
+void TimerWheel::Unlink(Wheel& wheel, uint32_t index)
+{
+    Node& node = m_Nodes[index];
+
+    if (node.prev != Nil)
+    {
+        m_Nodes[node.prev].next = node.next;
+    }
+    else
+    {
+        wheel.slots[node.level][node.slot] = node.next;
+        if (node.next == Nil)
+        {
+            wheel.occupied[node.level] &= ~(1ull << node.slot);
+        }
+    }
+
+    if (node.next != Nil)
+    {
+        m_Nodes[node.next].prev = node.prev;
+    }
+
+    node.prev = Nil;
+    node.next = Nil;
+    wheel.count--;
+}
+
+void TimerWheel::Advance(Wheel& wheel, uint64_t target)
+{
+    while (wheel.now < target)
+    {
+        // Nothing pending - jump straight to the target
+        if (wheel.count == 0)
+        {
+            wheel.now = target;
+            break;
+        }
+
+        // Skip ticks with nothing to do: the next one is an occupied level-0 slot later in
+        // this rotation, or the end of the rotation (where the upper levels cascade)
+        uint32_t position = static_cast<uint32_t>(wheel.now) & SlotMask;
+        uint64_t ahead = wheel.occupied[0] & ~((2ull << position) - 1);
+        uint64_t next = ahead ? wheel.now - position + static_cast<uint64_t>(std::countr_zero(ahead))
+                              : (wheel.now | SlotMask) + 1;
+        if (next > target)
+        {
+            wheel.now = target;
+            break;
+        }
+
+        wheel.now = next;
+
+        // When a level's index wraps, pull the matching slot of the level above down
+        // (highest level first, so its timers can land in the slots cascaded next)
+        uint32_t wrapped = 0;
+        while (wrapped + 1 < LevelCount && (wheel.now & ((1ull << (SlotBits * (wrapped + 1))) - 1)) == 0)
+        {
+            wrapped++;
+        }
+        for (uint32_t level = wrapped; level > 0; level--)
+        {
+            uint32_t slot = static_cast<uint32_t>(wheel.now >> (SlotBits * level)) & SlotMask;
+            if (wheel.occupied[level] & (1ull << slot))
+            {
+                Cascade(wheel, level, slot);
+            }
+        }
+
+        uint32_t slot = static_cast<uint32_t>(wheel.now) & SlotMask;
+        if (wheel.occupied[0] & (1ull << slot))
+        {
+            Fire(wheel, slot);
+        }
+    }
+}
+
+void TimerWheel::Cascade(Wheel& wheel, uint32_t level, uint32_t slot)
+{
+    uint32_t index = wheel.slots[level][slot];
+    wheel.slots[level][slot] = Nil;
+    wheel.occupied[level] &= ~(1ull << slot);
+
+    while (index != Nil)
+    {
+        uint32_t next = m_Nodes[index].next;
+        wheel.count--;
+        Link(wheel, index);
+        index = next;
+    }
+}
+
+void TimerWheel::Fire(Wheel& wheel, uint32_t slot)
+{
+    // Detach the whole slot first - callbacks may schedule or cancel freely
+    m_Due.clear();
+
+    uint32_t index = wheel.slots[0][slot];
+    wheel.slots[0][slot] = Nil;
+    wheel.occupied[0] &= ~(1ull << slot);
+
+    while (index != Nil)
+    {
+        Node& node = m_Nodes[index];
+        uint32_t next = node.next;
+        node.state = State::Due;
+        node.prev = Nil;
+        node.next = Nil;
+        wheel.count--;
+        m_Due.push_back(index);
+        index = next;
+    }
+
+    // A throwing callback must not strand the rest of the due list -
+    // finish the tick, then rethrow to the caller (Framework main loop)
+    std::exception_ptr error;
+
+    for (uint32_t due : m_Due)
+    {
+        Node& node = m_Nodes[due];
+
+        if (node.cancelled)
+        {
+            FreeNode(due);
+            continue;
+        }
+
+        // Parked beyond the wheel's range - not actually due yet
+        if (node.when > wheel.now)
+        {
+            Link(wheel, due);
+            continue;
+        }
+
+        node.state = State::Running;
+        try
+        {
+            node.callback();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+
+        if (!node.cancelled && node.interval > 0)
+        {
+            // Drift-free: next expiry is based on the scheduled time, not the fire time
+            node.when += node.interval;
+            if (node.when <= wheel.now)
+            {
+                node.when = wheel.now + 1;
+            }
+            Link(wheel, due);
+            continue;
+        }
+
+        if (!node.cancelled)
+        {
+            m_ActiveCount--;
+        }
+        FreeNode(due);
+    }
+
+    m_Due.clear();
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace Broadsword::Foundation
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "InlineFunction.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace Broadsword::Foundation
+{
+
+// TimerWheel - Delayed and recurring tasks on the game thread
+//
+// Replaces "count frames in OnFrame" polling with scheduled callbacks:
+// - Delays in frames (ticked once per Present) or wall-clock milliseconds
+// - One-shot or recurring (fixed interval, drift-free)
+// - Cancellation through generation-checked handles (stale handles are harmless)
+//
+// Implementation: two hierarchical timing wheels (frames, milliseconds), each with
+// 5 levels of 64 slots. Insert and cancel are O(1) (intrusive doubly linked slot lists);
+// a tick only touches the slot that is due plus an occasional cascade from the level
+// above. Advancing jumps over empty ticks: the level-0 occupancy bitmap gives the next
+// due slot, so a catch-up costs one step per occupied slot or 64-tick cascade boundary.
+//
+// Callbacks run inside Tick(), on the game thread. Scheduling and cancelling are
+// game thread only - other threads should go through GameThreadExecutor::QueueAction().
+class TimerWheel
+{
+public:
+    struct TimerHandle
+    {
+        uint32_t index = 0xFFFFFFFF;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != 0xFFFFFFFF; }
+    };
+
+    // Timer callback - 64 bytes of inline capture storage, no allocation per timer
+    using Callback = InlineFunction<void(), 64>;
+
+    static TimerWheel& Get();
+
+    // Run callback after `frames` frames (minimum 1), repeating every `intervalFrames` if non-zero
+    TimerHandle AfterFrames(uint64_t frames, Callback callback, uint64_t intervalFrames = 0);
+
+    // Run callback every `frames` frames (first run after `frames` frames)
+    TimerHandle EveryFrames(uint64_t frames, Callback callback);
+
+    // Run callback after `delay` (1 ms resolution), repeating every `interval` if non-zero
+    TimerHandle After(std::chrono::milliseconds delay, Callback callback,
+                      std::chrono::milliseconds interval = std::chrono::milliseconds(0));
+
+    // Run callback every `interval` (first run after `interval`)
+    TimerHandle Every(std::chrono::milliseconds interval, Callback callback);
+
+    // Cancel a pending timer (safe to call from inside any timer callback, including its own)
+    // Returns false if the handle is stale or the timer already finished
+    bool Cancel(TimerHandle handle);
+
+    // Check if a timer is still pending
+    bool IsScheduled(TimerHandle handle) const;
+
+    // Advance the frame wheel by one frame and the wall-clock wheel to now, firing due timers
+    // Called from the Present hook (runs at game's FPS)
+    void Tick();
+
+    // Cancel everything
+    void Clear();
+
+    // Get number of pending timers
+    size_t ActiveCount() const { return m_ActiveCount; }
+
+private:
+    TimerWheel();
+    ~TimerWheel() = default;
+
+    // Delete copy/move
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    static constexpr uint32_t Nil = 0xFFFFFFFF;
+    static constexpr uint32_t SlotBits = 6;
+    static constexpr uint32_t SlotCount = 1u << SlotBits;
+    static constexpr uint32_t SlotMask = SlotCount - 1;
+    static constexpr uint32_t LevelCount = 5;
+    static constexpr uint64_t MaxDelta = (1ull << (SlotBits * LevelCount)) - 1;
+
+    enum class Domain : uint8_t
+    {
+        Frames,
+        Milliseconds
+    };
+
+    enum class State : uint8_t
+    {
+        Free,
+        Scheduled, // Linked into a wheel slot
+        Due,       // Detached into the current tick's due list
+        Running    // Callback executing
+    };
+
+    struct Node
+    {
+        uint32_t prev = Nil;
+        uint32_t next = Nil;
+        uint32_t generation = 0;
+        State state = State::Free;
+        Domain domain = Domain::Frames;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+        bool cancelled = false;
+        uint64_t when = 0;     // Absolute expiry tick
+        uint64_t interval = 0; // 0 = one-shot
+        Callback callback;
+    };
+
+    struct Wheel
+    {
+        uint64_t now = 0;
+        size_t count = 0;
+        std::array<std::array<uint32_t, SlotCount>, LevelCount> slots;
+        std::array<uint64_t, LevelCount> occupied{}; // Bit per non-empty slot
+    };
+
+    TimerHandle Schedule(Domain domain, uint64_t delay, uint64_t interval, Callback callback);
+
+    uint32_t AllocNode();
+    void FreeNode(uint32_t index);
+
+    void Link(Wheel& wheel, uint32_t index);
+    void Unlink(Wheel& wheel, uint32_t index);
+
+    void Advance(Wheel& wheel, uint64_t target);
+    void Cascade(Wheel& wheel, uint32_t level, uint32_t slot);
+    void Fire(Wheel& wheel, uint32_t slot);
+
+    Wheel& WheelFor(Domain domain) { return domain == Domain::Frames ? m_Frames : m_Millis; }
+
+    // std::deque keeps node addresses stable while callbacks schedule new timers
+    std::deque<Node> m_Nodes;
+    uint32_t m_FreeHead = Nil;
+    size_t m_ActiveCount = 0;
+
+    Wheel m_Frames;
+    Wheel m_Millis;
+
+    std::chrono::steady_clock::time_point m_Start;
+
+    // Reused per tick to avoid allocation
+    std::vector<uint32_t> m_Due;
+};
+
+} // namespace Broadsword::Foundation
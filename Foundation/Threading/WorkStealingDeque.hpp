@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace Broadsword::Foundation
+{
+
+// WorkStealingDeque - Chase-Lev lock-free work-stealing deque
+//
+// The owning worker pushes and pops at the bottom (LIFO, cache-warm);
+// any other thread steals from the top (FIFO, oldest/largest work first).
+// Items are raw pointers owned by the caller. The ring grows on demand;
+// retired rings are kept until destruction since a stealer may still be reading one.
+template <typename T>
+class WorkStealingDeque
+{
+public:
+    explicit WorkStealingDeque(int64_t capacity = 256)
+    {
+        int64_t size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        m_Ring.store(new Ring(size), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque()
+    {
+        delete m_Ring.load(std::memory_order_relaxed);
+        for (Ring* ring : m_Retired)
+        {
+            delete ring;
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner thread only
+    void Push(T* item)
+    {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        Ring* ring = m_Ring.load(std::memory_order_relaxed);
+
+        if (bottom - top > ring->mask)
+        {
+            ring = Grow(ring, top, bottom);
+        }
+
+        ring->Put(bottom, item);
+        m_Bottom.store(bottom + 1, std::memory_order_seq_cst);
+    }
+
+    // Owner thread only - returns nullptr if empty
+    T* Pop()
+    {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        Ring* ring = m_Ring.load(std::memory_order_relaxed);
+        m_Bottom.store(bottom, std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_seq_cst);
+
+        if (top > bottom)
+        {
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = ring->Get(bottom);
+
+        // Last item - race any stealers for it
+        if (top == bottom)
+        {
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                item = nullptr;
+            }
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    // Any thread - returns nullptr if empty or if another thief won the race
+    T* Steal()
+    {
+        int64_t top = m_Top.load(std::memory_order_seq_cst);
+        int64_t bottom = m_Bottom.load(std::memory_order_seq_cst);
+
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        Ring* ring = m_Ring.load(std::memory_order_acquire);
+        T* item = ring->Get(top);
+
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+
+        return item;
+    }
+
+    // Snapshot check only
+    bool Empty() const
+    {
+        return m_Top.load(std::memory_order_relaxed) >= m_Bottom.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Ring
+    {
+        explicit Ring(int64_t size)
+            : mask(size - 1), slots(new std::atomic<T*>[size])
+        {
+        }
+
+        ~Ring() { delete[] slots; }
+
+        T* Get(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void Put(int64_t i, T* item) { slots[i & mask].store(item, std::memory_order_relaxed); }
+
+        int64_t mask;
+        std::atomic<T*>* slots;
+    };
+
+    Ring* Grow(Ring* old, int64_t top, int64_t bottom)
+    {
+        Ring* ring = new Ring((old->mask + 1) * 2);
+        for (int64_t i = top; i < bottom; i++)
+        {
+            ring->Put(i, old->Get(i));
+        }
+
+        m_Retired.push_back(old);
+        m_Ring.store(ring, std::memory_order_release);
+        return ring;
+    }
+
+    // Separate cache lines - thieves hammer top, the owner hammers bottom
+    alignas(64) std::atomic<int64_t> m_Top{0};
+    alignas(64) std::atomic<int64_t> m_Bottom{0};
+    alignas(64) std::atomic<Ring*> m_Ring{nullptr};
+
+    std::vector<Ring*> m_Retired; // Owner thread only
+};
+
+} // namespace Broadsword::Foundation
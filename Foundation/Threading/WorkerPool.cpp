@@ -0,0 +1,704 @@
+#include "WorkerPool.hpp"
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+namespace Broadsword::Foundation
+{
+
+namespace
+{
+
+constexpr uint32_t NoCore = 0xFFFFFFFF;
+
+thread_local WorkerPool* t_Pool = nullptr;
+thread_local uint32_t t_WorkerIndex = 0;
+thread_local uint32_t t_HelperRng = 0x2545F491;
+
+uint32_t NextRandom(uint32_t& state)
+{
+    // xorshift32 - victim selection only needs to be cheap and spread out
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+void ForwardToGameThread(std::exception_ptr error)
+{
+    GameThreadExecutor::Get().QueueAction([error]() {
+        std::rethrow_exception(error);
+    });
+}
+
+} // namespace
+
+WorkerPool& WorkerPool::Get()
+{
+    static WorkerPool instance;
+    return instance;
+}
+
+WorkerPool::~WorkerPool()
+{
+    Stop();
+}
+
+void WorkerPool::Start(const Config& config)
+{
+    if (m_Running.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::vector<uint32_t> cores;
+    for (uint32_t bit = 0; bit < 64; bit++)
+    {
+        if (config.affinityMask & (1ull << bit))
+        {
+            cores.push_back(bit);
+        }
+    }
+
+    uint32_t count = config.workerCount;
+    if (count == 0)
+    {
+        if (!cores.empty())
+        {
+            count = static_cast<uint32_t>(cores.size());
+        }
+        else
+        {
+            uint32_t hardware = std::thread::hardware_concurrency();
+            count = hardware / 4;
+            count = count < 1 ? 1 : (count > 4 ? 4 : count);
+        }
+    }
+
+    // All workers must exist before any thread starts stealing
+    m_Workers.reserve(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto worker = std::make_unique<Worker>();
+        worker->rng = 0x9E3779B9u * (i + 1);
+        m_Workers.push_back(std::move(worker));
+    }
+
+    m_Running.store(true, std::memory_order_release);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t core = cores.empty() ? NoCore : cores[i % cores.size()];
+        m_Workers[i]->thread = std::thread(&WorkerPool::WorkerMain, this, i, core, config.belowNormalPriority);
+    }
+}
+
+void WorkerPool::Stop()
+{
+    if (!m_Running.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    m_WakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+    m_WakeEpoch.notify_all();
+
+    for (auto& worker : m_Workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+
+    // Discard whatever was still queued
+    for (auto& worker : m_Workers)
+    {
+        while (Job* job = worker->deque.Pop())
+        {
+            FreeJob(job);
+        }
+    }
+
+    Job* job = m_Injected.PopAll();
+    while (job)
+    {
+        Job* next = job->next;
+        FreeJob(job);
+        job = next;
+    }
+    m_InjectedCount.store(0, std::memory_order_relaxed);
+
+    m_Workers.clear();
+}
+
+WorkerPool::Job* WorkerPool::AllocateJob()
+{
+    if (void* slot = m_JobPool.Allocate())
+    {
+        return ::new (slot) Job();
+    }
+
+    m_HeapJobs.fetch_add(1, std::memory_order_relaxed);
+    Job* job = new Job();
+    job->pooled = false;
+    return job;
+}
+
+void WorkerPool::FreeJob(Job* job)
+{
+    if (job->pooled)
+    {
+        job->~Job();
+        m_JobPool.Free(job);
+    }
+    else
+    {
+        delete job;
+    }
+}
+
+void WorkerPool::Push(Job* job)
+{
+    if (!IsRunning())
+    {
+        Run(job);
+        return;
+    }
+
+    if (t_Pool == this)
+    {
+        // Spawned from a worker - keep it local, siblings can steal it
+        m_Workers[t_WorkerIndex]->deque.Push(job);
+    }
+    else
+    {
+        m_InjectedCount.fetch_add(1, std::memory_order_seq_cst);
+        m_Injected.Push(job);
+        m_Injections.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Signal();
+}
+
+void WorkerPool::ParallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    size_t count = end - begin;
+    size_t workers = m_Workers.size();
+
+    if (grain == 0)
+    {
+        // ~4 chunks per participating thread balances stealing against overhead
+        grain = count / ((workers + 1) * 4);
+        grain = grain > 0 ? grain : 1;
+    }
+
+    size_t chunks = (count + grain - 1) / grain;
+    if (!IsRunning() || workers == 0 || chunks == 1)
+    {
+        body(begin, end);
+        return;
+    }
+
+    struct Shared
+    {
+        std::atomic<size_t> remaining{0};
+        std::mutex errorMutex;
+        std::exception_ptr error;
+
+        void Fail()
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    } shared;
+
+    shared.remaining.store(chunks - 1, std::memory_order_relaxed);
+
+    for (size_t chunk = 1; chunk < chunks; chunk++)
+    {
+        size_t lo = begin + chunk * grain;
+        size_t hi = end - lo > grain ? lo + grain : end;
+
+        Submit([&shared, &body, lo, hi]() {
+            try
+            {
+                body(lo, hi);
+            }
+            catch (...)
+            {
+                shared.Fail();
+            }
+            shared.remaining.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+
+    // The caller takes the first chunk, then helps with the rest
+    try
+    {
+        body(begin, begin + grain);
+    }
+    catch (...)
+    {
+        shared.Fail();
+    }
+
+    while (shared.remaining.load(std::memory_order_acquire) > 0)
+    {
+        if (!HelpOne())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if (shared.error)
+    {
+        std::rethrow_exception(shared.error);
+    }
+}
+
+bool WorkerPool::HelpOne()
+{
+    Job* job = nullptr;
+
+    if (t_Pool == this)
+    {
+        Worker* self = m_Workers[t_WorkerIndex].get();
+        job = FindJob(self);
+        if (job)
+        {
+            self->executed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        job = TakeInjected(nullptr);
+        if (!job)
+        {
+            job = StealFrom(nullptr, t_HelperRng);
+        }
+        if (job)
+        {
+            m_HelperExecuted.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (!job)
+    {
+        return false;
+    }
+
+    Run(job);
+    return true;
+}
+
+bool WorkerPool::IsWorkerThread() const
+{
+    return t_Pool == this;
+}
+
+WorkerPool::Stats WorkerPool::GetStats() const
+{
+    Stats stats;
+    stats.executed = m_HelperExecuted.load(std::memory_order_relaxed);
+    stats.injected = m_Injections.load(std::memory_order_relaxed);
+    stats.failed = m_Failures.load(std::memory_order_relaxed);
+    stats.heapJobs = m_HeapJobs.load(std::memory_order_relaxed);
+
+    for (const auto& worker : m_Workers)
+    {
+        stats.executed += worker->executed.load(std::memory_order_relaxed);
+        stats.stolen += worker->stolen.load(std::memory_order_relaxed);
+        stats.sleeps += worker->sleeps.load(std::memory_order_relaxed);
+    }
+
+    return stats;
+}
+
+void WorkerPool::WorkerMain(uint32_t index, uint32_t core, bool belowNormal)
+{
+    t_Pool = this;
+    t_WorkerIndex = index;
+
+#ifdef _WIN32
+    if (core != NoCore)
+    {
+        SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1ull << core));
+    }
+    if (belowNormal)
+    {
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+    }
+    SetThreadDescription(GetCurrentThread(), L"Broadsword Worker");
+#else
+    (void)core;
+    (void)belowNormal;
+#endif
+
+    Worker* self = m_Workers[index].get();
+    uint32_t idleSpins = 0;
+
+    while (m_Running.load(std::memory_order_acquire))
+    {
+        if (Job* job = FindJob(self))
+        {
+            Run(job);
+            self->executed.fetch_add(1, std::memory_order_relaxed);
+            idleSpins = 0;
+            continue;
+        }
+
+        // Short spin catches bursts of small jobs without a sleep/wake round trip
+        if (++idleSpins < 64)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Read the epoch before re-checking: any Submit() after this check bumps it,
+        // so wait() returns immediately instead of missing the wake-up
+        uint32_t epoch = m_WakeEpoch.load(std::memory_order_seq_cst);
+        if (HasWork() || !m_Running.load(std::memory_order_acquire))
+        {
+            idleSpins = 0;
+            continue;
+        }
+
+        m_Sleepers.fetch_add(1, std::memory_order_seq_cst);
+        self->sleeps.fetch_add(1, std::memory_order_relaxed);
+        m_WakeEpoch.wait(epoch, std::memory_order_seq_cst);
+        m_Sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        idleSpins = 0;
+    }
+
+    t_Pool = nullptr;
+}
+
+WorkerPool::Job* WorkerPool::FindJob(Worker* self)
+{
+    if (Job* job = self->deque.Pop())
+    {
+        return job;
+    }
+
+    if (Job* job = TakeInjected(self))
+    {
+        return job;
+    }
+
+    return StealFrom(self, self->rng);
+}
+
+WorkerPool::Job* WorkerPool::TakeInjected(Worker* self)
+{
+    if (m_InjectedCount.load(std::memory_order_seq_cst) == 0)
+    {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(m_InjectedConsumer, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        return nullptr;
+    }
+
+    Job* first = m_Injected.PopAll();
+    if (!first)
+    {
+        return nullptr;
+    }
+
+    Job* rest = first->next;
+    first->next = nullptr;
+    m_InjectedCount.fetch_sub(1, std::memory_order_seq_cst);
+
+    if (!rest)
+    {
+        return first;
+    }
+
+    // Workers adopt the whole snapshot (siblings steal from it); helper threads
+    // have no deque, so they put the remainder back
+    while (rest)
+    {
+        Job* next = rest->next;
+        rest->next = nullptr;
+
+        if (self)
+        {
+            m_InjectedCount.fetch_sub(1, std::memory_order_seq_cst);
+            self->deque.Push(rest);
+        }
+        else
+        {
+            m_Injected.Push(rest);
+        }
+
+        rest = next;
+    }
+
+    Signal();
+    return first;
+}
+
+WorkerPool::Job* WorkerPool::StealFrom(Worker* self, uint32_t& rng)
+{
+    size_t count = m_Workers.size();
+    if (count == 0)
+    {
+        return nullptr;
+    }
+
+    size_t start = NextRandom(rng) % count;
+    for (size_t i = 0; i < count; i++)
+    {
+        Worker* victim = m_Workers[(start + i) % count].get();
+        if (victim == self)
+        {
+            continue;
+        }
+
+        if (Job* job = victim->deque.Steal())
+        {
+            if (self)
+            {
+                self->stolen.fetch_add(1, std::memory_order_relaxed);
+            }
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void WorkerPool::Run(Job* job)
+{
+    JobFn fn = std::move(job->fn);
+    FreeJob(job);
+
+    try
+    {
+        fn();
+    }
+    catch (...)
+    {
+        m_Failures.fetch_add(1, std::memory_order_relaxed);
+        ForwardToGameThread(std::current_exception());
+    }
+}
+
+void WorkerPool::Signal()
+{
+    m_WakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_Sleepers.load(std::memory_order_seq_cst) > 0)
+    {
+        m_WakeEpoch.notify_one();
+    }
+}
+
+bool WorkerPool::HasWork() const
+{
+    if (m_InjectedCount.load(std::memory_order_seq_cst) > 0)
+    {
+        return true;
+    }
+
+    for (const auto& worker : m_Workers)
+    {
+        if (!worker->deque.Empty())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// ============================================================================
+// TaskGraph
+// ============================================================================
+
+TaskGraph::TaskGraph()
+    : m_State(std::make_shared<State>())
+{
+}
+
+TaskGraph::NodeId TaskGraph::Add(std::function<void()> work)
+{
+    NodeId id = static_cast<NodeId>(m_State->nodes.size());
+    m_State->nodes.emplace_back().work = std::move(work);
+    return id;
+}
+
+void TaskGraph::Precede(NodeId before, NodeId after)
+{
+    if (before >= m_State->nodes.size() || after >= m_State->nodes.size() || before == after)
+    {
+        return;
+    }
+
+    m_State->nodes[before].successors.push_back(after);
+    m_State->nodes[after].predecessors++;
+}
+
+bool TaskGraph::Run(WorkerPool& pool, std::function<void()> onComplete)
+{
+    State& state = *m_State;
+
+    if (!IsDone() || state.nodes.empty())
+    {
+        return false;
+    }
+
+    std::vector<NodeId> roots;
+    for (NodeId id = 0; id < state.nodes.size(); id++)
+    {
+        Node& node = state.nodes[id];
+        node.pending.store(node.predecessors, std::memory_order_relaxed);
+        if (node.predecessors == 0)
+        {
+            roots.push_back(id);
+        }
+    }
+
+    // Kahn's walk: every node must complete, else a cycle would keep the graph running forever
+    std::vector<uint32_t> indegree(state.nodes.size());
+    for (NodeId id = 0; id < state.nodes.size(); id++)
+    {
+        indegree[id] = state.nodes[id].predecessors;
+    }
+
+    std::vector<NodeId> ready = roots;
+    size_t completed = 0;
+    while (!ready.empty())
+    {
+        NodeId id = ready.back();
+        ready.pop_back();
+        completed++;
+
+        for (NodeId successor : state.nodes[id].successors)
+        {
+            if (--indegree[successor] == 0)
+            {
+                ready.push_back(successor);
+            }
+        }
+    }
+
+    if (completed != state.nodes.size())
+    {
+        return false;
+    }
+
+    state.pool = &pool;
+    state.onComplete = std::move(onComplete);
+    state.error = nullptr;
+    state.remaining.store(static_cast<uint32_t>(state.nodes.size()), std::memory_order_relaxed);
+    state.running.store(true, std::memory_order_release);
+
+    for (NodeId id : roots)
+    {
+        Launch(m_State, id);
+    }
+
+    return true;
+}
+
+void TaskGraph::Wait()
+{
+    while (!IsDone())
+    {
+        if (!m_State->pool || !m_State->pool->HelpOne())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_State->errorMutex);
+    if (m_State->error)
+    {
+        std::rethrow_exception(m_State->error);
+    }
+}
+
+bool TaskGraph::IsDone() const
+{
+    return !m_State->running.load(std::memory_order_acquire);
+}
+
+void TaskGraph::Launch(const std::shared_ptr<State>& state, NodeId id)
+{
+    state->pool->Submit([state, id]() {
+        Execute(state, id);
+    });
+}
+
+void TaskGraph::Execute(const std::shared_ptr<State>& state, NodeId id)
+{
+    Node& node = state->nodes[id];
+
+    try
+    {
+        if (node.work)
+        {
+            node.work();
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(state->errorMutex);
+        if (!state->error)
+        {
+            state->error = std::current_exception();
+        }
+    }
+
+    for (NodeId successor : node.successors)
+    {
+        if (state->nodes[successor].pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Launch(state, successor);
+        }
+    }
+
+    if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
+
+    // Last node - hand off the continuation before marking the graph done,
+    // since a finished graph may be re-run (and its state reused) immediately
+    std::function<void()> onComplete = std::move(state->onComplete);
+    state->onComplete = nullptr;
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(state->errorMutex);
+        error = state->error;
+    }
+
+    state->running.store(false, std::memory_order_release);
+
+    if (onComplete)
+    {
+        if (error)
+        {
+            ForwardToGameThread(error);
+        }
+        else
+        {
+            GameThreadExecutor::Get().QueueAction(std::move(onComplete));
+        }
+    }
+}
+
+} // namespace Broadsword::Foundation
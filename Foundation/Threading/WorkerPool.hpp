@@ -0,0 +1,247 @@
+#pragma once
+
+#include "GameThreadExecutor.hpp"
+#include "InlineFunction.hpp"
+#include "MPSCQueue.hpp"
+#include "SlabPool.hpp"
+#include "WorkStealingDeque.hpp"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Broadsword::Foundation
+{
+
+// WorkerPool - Work-stealing thread pool for CPU-heavy mod work
+//
+// For pathfinding, JSON parsing, analysis over snapshotted data, etc. NEVER touch the
+// SDK from a worker - copy what you need on the game thread, then hand results back
+// with SubmitThen() or GameThreadExecutor::QueueAction(). (ObjectScan is the one
+// exception: it reads GObjects from workers while the game thread blocks in ParallelFor.)
+//
+// Each worker owns a Chase-Lev deque: jobs spawned by a worker stay on it (LIFO), idle
+// workers steal the oldest jobs from others. Submissions from non-worker threads go
+// through a lock-free injection queue. Idle workers sleep on an atomic wait - no polling.
+// Jobs use the same 64-byte inline callables and slab-recycled nodes as GameThreadExecutor.
+//
+// The pool is deliberately small by default (a quarter of the logical cores, 1..4) and
+// can be pinned to specific cores with an affinity mask, so it stays out of the way of
+// the engine's own task graph and render threads.
+class WorkerPool
+{
+public:
+    struct Config
+    {
+        uint32_t workerCount = 0;        // 0 = auto (popcount of affinityMask, else cores / 4, clamped 1..4)
+        uint64_t affinityMask = 0;       // Bit per logical core, 0 = let the OS schedule
+        bool belowNormalPriority = true; // Yield to game threads under contention
+    };
+
+    using JobFn = InlineFunction<void(), 64>;
+
+    struct Stats
+    {
+        uint64_t executed = 0; // Jobs run (by workers and helping threads)
+        uint64_t stolen = 0;   // Jobs taken from another worker's deque
+        uint64_t injected = 0; // Jobs submitted from non-worker threads
+        uint64_t failed = 0;   // Jobs that threw
+        uint64_t sleeps = 0;   // Times a worker went idle
+        uint64_t heapJobs = 0; // Job nodes heap-allocated because the slab was exhausted
+    };
+
+    static WorkerPool& Get();
+
+    // Start worker threads (no-op if already running)
+    void Start(const Config& config);
+
+    // Stop and join all workers; pending jobs are discarded
+    void Stop();
+
+    bool IsRunning() const { return m_Running.load(std::memory_order_acquire); }
+    uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+    // Queue a job on the pool (any thread)
+    // Runs inline if the pool isn't running. An exception escaping the job is
+    // rethrown on the game thread from the next GameThreadExecutor::ProcessQueue().
+    template <typename Fn>
+    void Submit(Fn&& job)
+    {
+        JobFn fn(std::forward<Fn>(job));
+        if (!fn)
+        {
+            return;
+        }
+
+        Job* node = AllocateJob();
+        node->fn = std::move(fn);
+        Push(node);
+    }
+
+    // Run work on the pool, then hand its result to a continuation on the game thread
+    //
+    //   pool.SubmitThen([data] { return FindPath(data); },
+    //                   [this](Path path) { ApplyPath(path); });
+    template <typename Work, typename Then>
+    void SubmitThen(Work work, Then then)
+    {
+        Submit([work = std::move(work), then = std::move(then)]() mutable {
+            using Result = std::invoke_result_t<Work&>;
+            if constexpr (std::is_void_v<Result>)
+            {
+                work();
+                GameThreadExecutor::Get().QueueAction(std::move(then));
+            }
+            else
+            {
+                auto result = std::make_shared<Result>(work());
+                GameThreadExecutor::Get().QueueAction([then = std::move(then), result]() mutable {
+                    then(std::move(*result));
+                });
+            }
+        });
+    }
+
+    // Split [begin, end) into chunks of `grain` (0 = auto) and run body(chunkBegin, chunkEnd)
+    // across the pool. Blocks until done; the calling thread runs chunks too.
+    // The first exception thrown by body is rethrown to the caller.
+    void ParallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+    // Run one pending job on the calling thread if any is available (used while waiting)
+    bool HelpOne();
+
+    // True on one of this pool's worker threads
+    bool IsWorkerThread() const;
+
+    Stats GetStats() const;
+
+private:
+    WorkerPool() = default;
+    ~WorkerPool();
+
+    // Delete copy/move
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) = delete;
+    WorkerPool& operator=(WorkerPool&&) = delete;
+
+    struct Job
+    {
+        Job* next = nullptr; // Injection queue link
+        JobFn fn;
+        bool pooled = true;
+    };
+
+    struct alignas(64) Worker
+    {
+        WorkStealingDeque<Job> deque;
+        std::thread thread;
+        uint32_t rng = 0;
+
+        std::atomic<uint64_t> executed{0};
+        std::atomic<uint64_t> stolen{0};
+        std::atomic<uint64_t> sleeps{0};
+    };
+
+    Job* AllocateJob();
+    void FreeJob(Job* job);
+    void Push(Job* job);
+
+    void WorkerMain(uint32_t index, uint32_t core, bool belowNormal);
+    Job* FindJob(Worker* self);
+    Job* TakeInjected(Worker* self);
+    Job* StealFrom(Worker* self, uint32_t& rng);
+    void Run(Job* job);
+    void Signal();
+    bool HasWork() const;
+
+    std::vector<std::unique_ptr<Worker>> m_Workers;
+    std::atomic<bool> m_Running{false};
+
+    MPSCQueue<Job> m_Injected;
+    std::mutex m_InjectedConsumer; // One worker drains a snapshot at a time (try_lock only)
+    std::atomic<size_t> m_InjectedCount{0};
+
+    SlabPool<Job> m_JobPool;
+    std::atomic<uint64_t> m_HeapJobs{0};
+
+    std::atomic<uint32_t> m_WakeEpoch{0};
+    std::atomic<uint32_t> m_Sleepers{0};
+
+    std::atomic<uint64_t> m_Injections{0};
+    std::atomic<uint64_t> m_Failures{0};
+    std::atomic<uint64_t> m_HelperExecuted{0};
+};
+
+// TaskGraph - Dependency graph of jobs run on a WorkerPool
+//
+//   TaskGraph graph;
+//   auto load  = graph.Add([&] { LoadNavData(); });
+//   auto build = graph.Add([&] { BuildGrid(); });
+//   auto path  = graph.Add([&] { SolvePaths(); });
+//   graph.Precede(load, build);
+//   graph.Precede(build, path);
+//   graph.Run(pool, [this] { OnPathsReady(); }); // Continuation runs on the game thread
+//
+// Nodes whose predecessors have all finished are submitted immediately, so independent
+// branches run in parallel. A graph can be re-run once it has finished.
+class TaskGraph
+{
+public:
+    using NodeId = uint32_t;
+
+    TaskGraph();
+
+    // Add a node (not while running)
+    NodeId Add(std::function<void()> work);
+
+    // `after` starts only once `before` has finished (not while running)
+    void Precede(NodeId before, NodeId after);
+
+    // Launch the graph. onComplete (optional) runs on the game thread when every node is done.
+    // If a node throws, onComplete is skipped and the first exception is rethrown on the game
+    // thread instead (or from Wait()). Returns false if already running, empty, or
+    // the dependencies form a cycle.
+    bool Run(WorkerPool& pool, std::function<void()> onComplete = {});
+
+    // Block until the graph is finished, helping the pool meanwhile
+    // Rethrows the first exception thrown by a node
+    void Wait();
+
+    bool IsDone() const;
+    size_t NodeCount() const { return m_State->nodes.size(); }
+
+private:
+    struct Node
+    {
+        std::function<void()> work;
+        std::vector<NodeId> successors;
+        uint32_t predecessors = 0;
+        std::atomic<uint32_t> pending{0};
+    };
+
+    struct State
+    {
+        std::deque<Node> nodes; // Stable addresses while jobs reference them
+        std::atomic<uint32_t> remaining{0};
+        std::atomic<bool> running{false};
+        std::function<void()> onComplete;
+        WorkerPool* pool = nullptr;
+
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    static void Launch(const std::shared_ptr<State>& state, NodeId id);
+    static void Execute(const std::shared_ptr<State>& state, NodeId id);
+
+    std::shared_ptr<State> m_State;
+};
+
+} // namespace Broadsword::Foundation
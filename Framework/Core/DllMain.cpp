@@ -12,21 +12,35 @@
 
 #include "../../Foundation/Hooks/VTableHook.hpp"
 #include "../../Foundation/Threading/GameThreadExecutor.hpp"
+#include "../../Foundation/Threading/TimerWheel.hpp"
+#include "../../Foundation/Threading/WorkerPool.hpp"
+#include "../../Foundation/Threading/IdleScheduler.hpp"
 #include "../Graphics/RenderBackend.hpp"
 #include "../../Services/Logging/Logger.hpp"
 #include "../../Services/UI/UIContext.hpp"
 #include "../UI/ConsoleWindow.hpp"
 #include "../UI/SettingsWindow.hpp"
 #include "../UI/AboutWindow.hpp"
+#include "../UI/ProfilerWindow.hpp"
 #include "../UI/NotificationManager.hpp"
 #include "../UI/ModMenuUI.hpp"
 #include "ModLoader.hpp"
 #include "ModContext.hpp"
 #include "../World/WorldFacade.hpp"
+#include "../World/ActorTracker.hpp"
 #include "../../Services/EventBus/EventBus.hpp"
 #include "../../Services/EventBus/EventTypes.hpp"
 #include "../../Services/Config/UniversalConfig.hpp"
 #include "../../Engine/ProcessEventHook.hpp"
+#include "../../Engine/ProcessEventStats.hpp"
+#include "../../Engine/CallTreeProfiler.hpp"
+#include "../../Engine/ProcessEventTrace.hpp"
+#include "../../Engine/ProcessEventObservers.hpp"
+#include "../../Engine/ObjectIndex.hpp"
+#include "../../Engine/FunctionTable.hpp"
+#include "../../Engine/ClassHierarchy.hpp"
+#include "../../Engine/PropertyAccess.hpp"
+#include "../../Engine/ParamLayout.hpp"
 #include "../../Services/Input/InputContext.hpp"
 #include "../../ModAPI/HookContext.hpp"
 #include <nlohmann/json.hpp>
@@ -41,10 +55,14 @@ static std::unique_ptr<RenderBackend> g_RenderBackend = nullptr;
 static std::unique_ptr<ConsoleWindow> g_ConsoleWindow = nullptr;
 static std::unique_ptr<SettingsWindow> g_SettingsWindow = nullptr;
 static std::unique_ptr<AboutWindow> g_AboutWindow = nullptr;
+static std::unique_ptr<ProfilerWindow> g_ProfilerWindow = nullptr;
 static std::unique_ptr<ModMenuUI> g_ModMenuUI = nullptr;
 static std::unique_ptr<ModLoader> g_ModLoader = nullptr;
 static std::unique_ptr<WorldFacade> g_WorldFacade = nullptr;
+static std::unique_ptr<ActorTracker> g_ActorTracker = nullptr;
 static std::unique_ptr<EventBus> g_EventBus = nullptr;
+static WorkerPool::Config g_WorkerConfig;
+static std::string g_SavedConfig; // Last Broadsword.json contents written (autosave skips unchanged)
 static std::unique_ptr<InputContext> g_InputContext = nullptr;
 static bool g_Initialized = false;
 static bool g_ShuttingDown = false;
@@ -102,6 +120,43 @@ static PresentFn oPresent = nullptr;
 typedef HRESULT(__stdcall* ResizeBuffersFn)(IDXGISwapChain*, UINT, UINT, UINT, DXGI_FORMAT, UINT);
 static ResizeBuffersFn oResizeBuffers = nullptr;
 
+// Collect framework settings for Broadsword.json (game thread - reads UI state)
+static nlohmann::json BuildFrameworkConfig()
+{
+    nlohmann::json config;
+    UIContext::Get().GetTheme().SaveToConfig(config);
+
+    if (g_ConsoleWindow)
+    {
+        g_ConsoleWindow->SaveToConfig(config);
+    }
+
+    if (g_SettingsWindow)
+    {
+        g_SettingsWindow->SaveToConfig(config);
+    }
+
+    config["workers"] = {
+        {"count", g_WorkerConfig.workerCount},
+        {"affinityMask", g_WorkerConfig.affinityMask},
+        {"belowNormalPriority", g_WorkerConfig.belowNormalPriority}
+    };
+
+    return config;
+}
+
+static bool WriteFrameworkConfig(const std::string& contents)
+{
+    std::ofstream configFile("Broadsword.json");
+    if (!configFile.is_open())
+    {
+        return false;
+    }
+
+    configFile << contents;
+    return configFile.good();
+}
+
 // Present hook - This is our main framework loop!
 static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval, UINT flags)
 {
@@ -203,10 +258,12 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
             g_ConsoleWindow = std::make_unique<ConsoleWindow>();
             g_SettingsWindow = std::make_unique<SettingsWindow>();
             g_AboutWindow = std::make_unique<AboutWindow>();
+            g_ProfilerWindow = std::make_unique<ProfilerWindow>();
             g_ModMenuUI = std::make_unique<ModMenuUI>();
             g_ModMenuUI->SetConsoleWindow(g_ConsoleWindow.get());
             g_ModMenuUI->SetSettingsWindow(g_SettingsWindow.get());
             g_ModMenuUI->SetAboutWindow(g_AboutWindow.get());
+            g_ModMenuUI->SetProfilerWindow(g_ProfilerWindow.get());
 
             // Load window configs after creation
             std::ifstream windowConfigFile(configPath);
@@ -221,6 +278,14 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
                     g_ConsoleWindow->LoadFromConfig(config);
                     g_SettingsWindow->LoadFromConfig(config);
                     if (g_LoggerInitialized) LOG_INFO("Loaded window settings from config");
+
+                    if (config.contains("workers"))
+                    {
+                        const auto& workers = config["workers"];
+                        g_WorkerConfig.workerCount = workers.value("count", g_WorkerConfig.workerCount);
+                        g_WorkerConfig.affinityMask = workers.value("affinityMask", g_WorkerConfig.affinityMask);
+                        g_WorkerConfig.belowNormalPriority = workers.value("belowNormalPriority", g_WorkerConfig.belowNormalPriority);
+                    }
                 }
                 catch (const std::exception& e)
                 {
@@ -235,9 +300,42 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
             ProcessEventHook::Get().Initialize();
             if (g_LoggerInitialized) LOG_INFO("ProcessEvent hook initialized");
 
+            // FindObject/StaticClass lookups go through the GObjects name index
+            ObjectIndex::Get().Initialize();
+
+            // Build per-class UFunction tables in idle time, before SDK wrappers first need them
+            FunctionTable::Get().Initialize();
+
+            // Start worker pool (mods reach it through ModContext::workers)
+            WorkerPool::Get().Start(g_WorkerConfig);
+            if (g_LoggerInitialized) LOG_INFO("WorkerPool started with {} workers", WorkerPool::Get().GetWorkerCount());
+
+            // Autosave settings in idle time (serialize on the game thread, write on a worker)
+            g_SavedConfig = BuildFrameworkConfig().dump(2);
+            IdleScheduler::Get().Register("Config autosave", std::chrono::seconds(30), []() {
+                std::string contents = BuildFrameworkConfig().dump(2);
+                if (contents == g_SavedConfig)
+                {
+                    return false;
+                }
+
+                g_SavedConfig = contents;
+                WorkerPool::Get().Submit([contents = std::move(contents)]() {
+                    if (!WriteFrameworkConfig(contents) && g_LoggerInitialized)
+                    {
+                        LOG_WARN("Config autosave failed to write Broadsword.json");
+                    }
+                });
+                return false;
+            });
+
             // Initialize EventBus
             if (g_LoggerInitialized) LOG_INFO("Initializing EventBus...");
             g_EventBus = std::make_unique<EventBus>();
+            g_EventBus->SetClassMatcher([](const void* actorClass, const void* filterClass) {
+                return ClassHierarchy::Get().IsA(static_cast<const SDK::UClass*>(actorClass),
+                                                 static_cast<const SDK::UClass*>(filterClass));
+            });
             if (g_LoggerInitialized) LOG_INFO("EventBus created");
 
             // Initialize WorldFacade
@@ -245,6 +343,10 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
             g_WorldFacade = std::make_unique<WorldFacade>();
             if (g_LoggerInitialized) LOG_INFO("WorldFacade created");
 
+            // Initialize ActorTracker (emits world/actor/player events)
+            g_ActorTracker = std::make_unique<ActorTracker>(*g_EventBus);
+            if (g_LoggerInitialized) LOG_INFO("ActorTracker created");
+
             // Initialize InputContext
             if (g_LoggerInitialized) LOG_INFO("Initializing InputContext...");
             g_InputContext = std::make_unique<InputContext>();
@@ -320,7 +422,8 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
                     .events = *g_EventBus,
                     .config = stubConfig,
                     .log = Logger::Get(),
-                    .hooks = stubHooks
+                    .hooks = stubHooks,
+                    .workers = WorkerPool::Get()
                 };
 
                 g_ModLoader->RegisterAllMods(modContext);
@@ -342,6 +445,42 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
             }
         }
 
+        // Index objects and number classes created since last frame
+        ObjectIndex::Get().Update();
+        ClassHierarchy::Get().Update();
+
+        // Deliver ProcessEvent calls observed since last frame's FrameStart flush
+        ProcessEventObservers::Get().Flush(ObserverPhase::FrameStart);
+
+        // Diff level actors and emit world/actor/player events
+        // (only once mods are registered, so they observe the initial world load)
+        if (g_ModsRegistered && g_ActorTracker) {
+            try {
+                g_ActorTracker->Update();
+            } catch (const std::exception& e) {
+                if (g_LoggerInitialized) {
+                    LOG_ERROR("Exception in actor tracking: {}", e.what());
+                }
+            } catch (...) {
+                if (g_LoggerInitialized) {
+                    LOG_ERROR("Unknown exception in actor tracking");
+                }
+            }
+        }
+
+        // Fire due timers (delayed/recurring tasks)
+        try {
+            TimerWheel::Get().Tick();
+        } catch (const std::exception& e) {
+            if (g_LoggerInitialized) {
+                LOG_ERROR("Exception in timer callback: {}", e.what());
+            }
+        } catch (...) {
+            if (g_LoggerInitialized) {
+                LOG_ERROR("Unknown exception in timer callback");
+            }
+        }
+
         // Process game thread actions
         GameThreadExecutor::Get().ProcessQueue();
 
@@ -381,6 +520,15 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
             }
         }
 
+        // Deliver observed ProcessEvent calls (worker observers are handed to the pool)
+        ProcessEventObservers::Get().Flush(ObserverPhase::FrameEnd);
+        ProcessEventObservers::Get().Flush(ObserverPhase::Worker);
+
+        // Fold this frame's ProcessEvent counters and call tree, flush the trace (no-op unless profiling)
+        ProcessEventStats::Get().EndFrame();
+        CallTreeProfiler::Get().EndFrame();
+        ProcessEventTrace::Get().EndFrame();
+
         // Start ImGui frame
         ImGui_ImplWin32_NewFrame();
         g_RenderBackend->NewFrame();
@@ -389,6 +537,11 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
         // Always render notifications (even when UI hidden)
         NotificationManager::Get().Render();
 
+        if (g_ProfilerWindow)
+        {
+            g_ProfilerWindow->RenderOverlay();
+        }
+
         // Render framework UI only when ModMenuUI is visible
         if (g_ModMenuUI && g_ModMenuUI->IsVisible())
         {
@@ -410,6 +563,11 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
                     g_AboutWindow->Render();
                 }
 
+                if (g_ProfilerWindow)
+                {
+                    g_ProfilerWindow->Render();
+                }
+
                 // Render mod UIs
                 UIContext::Get().RenderModUIs();
             } catch (const std::exception& e) {
@@ -430,7 +588,23 @@ static HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT syncInterval
         g_RenderBackend->RenderDrawData();
     }
 
-    return oPresent(pSwapChain, syncInterval, flags);
+    IdleScheduler::Get().BeginPresent();
+    HRESULT result = oPresent(pSwapChain, syncInterval, flags);
+
+    // Low-priority work while the GPU is busy with the frame we just submitted
+    try {
+        IdleScheduler::Get().RunIdle();
+    } catch (const std::exception& e) {
+        if (g_LoggerInitialized) {
+            LOG_ERROR("Exception in idle task: {}", e.what());
+        }
+    } catch (...) {
+        if (g_LoggerInitialized) {
+            LOG_ERROR("Unknown exception in idle task");
+        }
+    }
+
+    return result;
 }
 
 // ResizeBuffers hook
@@ -548,28 +722,30 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
         // Small delay to ensure no hooks are executing
         Sleep(100);
 
+        // Restore ProcessEvent vtables before the detour's code is unloaded
+        ProcessEventHook::Get().Shutdown();
+        if (g_LoggerInitialized) LOG_DEBUG("ProcessEvent hook removed");
+
+        ObjectIndex::Get().Shutdown();
+        FunctionTable::Get().Shutdown();
+        ClassHierarchy::Get().Shutdown();
+        PropertyAccess::Get().Clear();
+        ParamLayout::ClearCache();
+
+        // Keep a trace that was still capturing
+        ProcessEventTrace::Get().Stop();
+
+        // Join worker threads before the services their jobs may use go away
+        // (also finishes any in-flight config autosave before the final save below)
+        WorkerPool::Get().Stop();
+        if (g_LoggerInitialized) LOG_DEBUG("WorkerPool stopped");
+
         // Save config before cleanup
         try
         {
             if (g_LoggerInitialized) LOG_INFO("Saving configuration...");
-            nlohmann::json config;
-            UIContext::Get().GetTheme().SaveToConfig(config);
-
-            if (g_ConsoleWindow)
-            {
-                g_ConsoleWindow->SaveToConfig(config);
-            }
-
-            if (g_SettingsWindow)
-            {
-                g_SettingsWindow->SaveToConfig(config);
-            }
-
-            std::ofstream configFile("Broadsword.json");
-            if (configFile.is_open())
+            if (WriteFrameworkConfig(BuildFrameworkConfig().dump(2)))
             {
-                configFile << config.dump(2);
-                configFile.close();
                 if (g_LoggerInitialized) LOG_INFO("Saved config to Broadsword.json");
             }
         }
@@ -584,6 +760,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
         g_ConsoleWindow.reset();
         g_SettingsWindow.reset();
         g_AboutWindow.reset();
+        g_ProfilerWindow.reset();
         NotificationManager::Get().Clear();
         UIContext::Get().Shutdown();
 
@@ -11,6 +11,10 @@ namespace Services {
     class Logger;
 }
 
+namespace Foundation {
+    class WorkerPool;
+}
+
 // Bring Logger into Broadsword namespace for ModContext
 using Logger = Services::Logger;
 
@@ -22,6 +26,7 @@ using Logger = Services::Logger;
  * - Configuration management
  * - Logging
  * - ProcessEvent hook registration
+ * - Background work on the worker pool
  *
  * All references remain valid for the entire lifetime of the mod.
  *
@@ -65,6 +70,15 @@ struct ModContext {
      * - Unhook(hookId)
      */
     HookContext& hooks;
+
+    /**
+     * Work-stealing worker pool for CPU-heavy work off the game thread
+     * - Submit(job) / SubmitThen(work, gameThreadContinuation)
+     * - ParallelFor(begin, end, grain, body)
+     * - TaskGraph::Run(ctx.workers, onComplete)
+     * Workers must never touch the SDK - snapshot data on the game thread first.
+     */
+    Foundation::WorkerPool& workers;
 };
 
 } // namespace Broadsword
@@ -1,5 +1,6 @@
 #include "ModLoader.hpp"
 #include "../../Services/UI/UIContext.hpp"
+#include "../../Foundation/Threading/EpochReclaimer.hpp"
 #include <iostream>
 
 namespace Broadsword {
@@ -115,6 +116,8 @@ void ModLoader::UnloadAll() {
 
         // Unload DLL
         if (loadedMod.hModule) {
+            // Removed hook callbacks live in the mod's code until in-flight ProcessEvent calls drain
+            Foundation::EpochReclaimer::Get().Synchronize();
             FreeLibrary(loadedMod.hModule);
         }
     }
@@ -3,6 +3,7 @@
 #include "ConsoleWindow.hpp"
 #include "SettingsWindow.hpp"
 #include "AboutWindow.hpp"
+#include "ProfilerWindow.hpp"
 #include <algorithm>
 
 namespace Broadsword::Framework {
@@ -40,7 +41,7 @@ void ModMenuUI::Render()
     // Framework options inline at the top
     const float windowWidth = ImGui::GetContentRegionAvail().x;
     const float buttonSpacing = 10.0f;
-    const int numButtons = 3;
+    const int numButtons = 4;
     const float totalSpacing = buttonSpacing * (numButtons - 1);
     const float buttonWidth = (windowWidth - totalSpacing) / numButtons;
 
@@ -176,6 +177,51 @@ void ModMenuUI::Render()
             ImGui::GetColorU32(textColor),
             1.0f
         );
+
+        ImGui::SameLine(0, buttonSpacing);
+    }
+
+    // Profiler button
+    {
+        bool isOpen = m_ProfilerWindow && m_ProfilerWindow->IsVisible();
+        bool isHovered = false;
+
+        ImVec2 textPos = ImGui::GetCursorScreenPos();
+        const char* label = "Profiler";
+        ImVec2 textSize = ImGui::CalcTextSize(label);
+
+        float textX = textPos.x + (buttonWidth - textSize.x) / 2.0f;
+
+        ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
+        ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0, 0, 0, 0));
+        ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0, 0, 0, 0));
+
+        if (ImGui::Button("##Profiler", ImVec2(buttonWidth, textSize.y)))
+        {
+            if (m_ProfilerWindow)
+            {
+                m_ProfilerWindow->SetVisible(!m_ProfilerWindow->IsVisible());
+            }
+        }
+        isHovered = ImGui::IsItemHovered();
+
+        ImGui::PopStyleColor(3);
+
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        ImVec4 textColor = (isOpen || isHovered) ? theme.accent : theme.text;
+
+        if (isOpen || isHovered)
+        {
+            drawList->AddText(ImVec2(textX + 0.5f, textPos.y), ImGui::GetColorU32(textColor), label);
+        }
+        drawList->AddText(ImVec2(textX, textPos.y), ImGui::GetColorU32(textColor), label);
+
+        drawList->AddLine(
+            ImVec2(textX, textPos.y + textSize.y),
+            ImVec2(textX + textSize.x, textPos.y + textSize.y),
+            ImGui::GetColorU32(textColor),
+            1.0f
+        );
     }
 
     ImGui::Spacing();
@@ -8,6 +8,7 @@ namespace Broadsword::Framework {
 class ConsoleWindow;
 class SettingsWindow;
 class AboutWindow;
+class ProfilerWindow;
 
 class ModMenuUI {
 public:
@@ -18,6 +19,7 @@ public:
     void SetConsoleWindow(ConsoleWindow* console) { m_ConsoleWindow = console; }
     void SetSettingsWindow(SettingsWindow* settings) { m_SettingsWindow = settings; }
     void SetAboutWindow(AboutWindow* about) { m_AboutWindow = about; }
+    void SetProfilerWindow(ProfilerWindow* profiler) { m_ProfilerWindow = profiler; }
 
     void SetVisible(bool visible) { m_Visible = visible; }
     bool IsVisible() const { return m_Visible; }
@@ -31,6 +33,7 @@ private:
     ConsoleWindow* m_ConsoleWindow = nullptr;
     SettingsWindow* m_SettingsWindow = nullptr;
     AboutWindow* m_AboutWindow = nullptr;
+    ProfilerWindow* m_ProfilerWindow = nullptr;
 };
 
 } // namespace Broadsword::Framework
@@ -0,0 +1,403 @@
+#include "ProfilerWindow.hpp"
+#include "NotificationManager.hpp"
+#include "../../Engine/ProcessEventStats.hpp"
+#include "../../Engine/ProcessEventTrace.hpp"
+#include <algorithm>
+#include <string>
+
+namespace Broadsword::Framework {
+
+namespace {
+
+constexpr const char* CsvPath = "Broadsword_ProcessEvent.csv";
+constexpr const char* FoldedPath = "Broadsword_CallTree.folded";
+constexpr const char* TracePath = "Broadsword_ProcessEvent.bstrace";
+
+float Micros(uint64_t ns)
+{
+    return static_cast<float>(ns) / 1000.0f;
+}
+
+} // namespace
+
+ProfilerWindow::ProfilerWindow()
+{
+}
+
+void ProfilerWindow::Render()
+{
+    if (!m_Visible)
+    {
+        return;
+    }
+
+    ImGui::SetNextWindowSize(ImVec2(760, 520), ImGuiCond_FirstUseEver);
+
+    if (!ImGui::Begin("ProcessEvent Profiler", &m_Visible))
+    {
+        ImGui::End();
+        return;
+    }
+
+    if (ImGui::BeginTabBar("ProfilerTabs", ImGuiTabBarFlags_None))
+    {
+        if (ImGui::BeginTabItem("Functions"))
+        {
+            RenderFunctionStats();
+            ImGui::EndTabItem();
+        }
+
+        if (ImGui::BeginTabItem("Call Tree"))
+        {
+            RenderCallTree();
+            ImGui::EndTabItem();
+        }
+
+        if (ImGui::BeginTabItem("Trace"))
+        {
+            RenderTrace();
+            ImGui::EndTabItem();
+        }
+
+        ImGui::EndTabBar();
+    }
+
+    ImGui::End();
+}
+
+void ProfilerWindow::RenderFunctionStats()
+{
+    ProcessEventStats& stats = ProcessEventStats::Get();
+
+    bool enabled = ProcessEventStats::IsEnabled();
+    if (ImGui::Checkbox("Record ProcessEvent calls", &enabled))
+    {
+        stats.SetEnabled(enabled);
+    }
+
+    ImGui::SameLine();
+    if (ImGui::Button("Reset"))
+    {
+        stats.Reset();
+    }
+
+    ImGui::SameLine();
+    if (ImGui::Button("Export CSV"))
+    {
+        if (stats.ExportCsv(CsvPath))
+        {
+            NotificationManager::Get().Success("Profiler", std::string("Saved ") + CsvPath);
+        }
+        else
+        {
+            NotificationManager::Get().Error("Profiler", std::string("Could not write ") + CsvPath);
+        }
+    }
+    ImGui::TextDisabled("Times every UFunction call - leave recording off when not profiling");
+
+    ImGui::Text("Frames: %llu  Functions: %zu  Calls last frame: %llu",
+                static_cast<unsigned long long>(stats.GetFrameCount()), stats.GetFunctionCount(),
+                static_cast<unsigned long long>(stats.GetFrameCalls()));
+
+    uint64_t dropped = stats.GetDroppedCalls();
+    if (dropped > 0)
+    {
+        ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.2f, 1.0f),
+                           "%llu calls not recorded - a thread's function table is full, press Reset to free it",
+                           static_cast<unsigned long long>(dropped));
+    }
+
+    const char* sortModes[] = {"Frame time", "Frame calls", "Total time", "Total calls"};
+    ImGui::SetNextItemWidth(160);
+    ImGui::Combo("Sort", &m_SortBy, sortModes, IM_ARRAYSIZE(sortModes));
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(160);
+    ImGui::SliderInt("Top", &m_TopCount, 5, 100);
+
+    ImGui::Separator();
+
+    ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY |
+                                 ImGuiTableFlags_Resizable | ImGuiTableFlags_SizingStretchProp;
+
+    if (ImGui::BeginTable("HotFunctions", 7, tableFlags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Function", ImGuiTableColumnFlags_WidthStretch, 3.0f);
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("Original us");
+        ImGui::TableSetupColumn("Orig p99 us");
+        ImGui::TableSetupColumn("Hook us");
+        ImGui::TableSetupColumn("Hook p99 us");
+        ImGui::TableSetupColumn("Total calls");
+        ImGui::TableHeadersRow();
+
+        auto sort = static_cast<ProcessEventStats::SortBy>(m_SortBy);
+        for (const auto* function : stats.GetTop(static_cast<size_t>(m_TopCount), sort))
+        {
+            ImGui::TableNextRow();
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(function->name.c_str());
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(function->frameCalls));
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", Micros(function->frameOriginalNs));
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", Micros(function->totalOriginal.Percentile(99)));
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", Micros(function->frameHookNs));
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", Micros(function->totalHook.Percentile(99)));
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(function->totalCalls));
+        }
+
+        ImGui::EndTable();
+    }
+}
+
+void ProfilerWindow::RenderCallTree()
+{
+    CallTreeProfiler& profiler = CallTreeProfiler::Get();
+
+    bool enabled = CallTreeProfiler::IsEnabled();
+    if (ImGui::Checkbox("Sample call tree", &enabled))
+    {
+        profiler.SetEnabled(enabled);
+    }
+
+    ImGui::SameLine();
+    ImGui::Checkbox("Overlay", &m_ShowOverlay);
+
+    ImGui::SameLine();
+    if (ImGui::Button("Export folded stacks"))
+    {
+        if (profiler.ExportFolded(FoldedPath))
+        {
+            NotificationManager::Get().Success("Profiler", std::string("Saved ") + FoldedPath);
+        }
+        else
+        {
+            NotificationManager::Get().Error("Profiler", std::string("Could not write ") + FoldedPath);
+        }
+    }
+
+    int interval = static_cast<int>(profiler.GetSampleInterval());
+    ImGui::SetNextItemWidth(200);
+    if (ImGui::SliderInt("Sample every N frames", &interval, 1, 600))
+    {
+        profiler.SetSampleInterval(static_cast<uint32_t>(interval));
+    }
+    ImGui::TextDisabled("Folded stacks load in speedscope or flamegraph.pl (values are exclusive ns)");
+
+    const auto& tree = profiler.GetLastTree();
+    if (tree.empty())
+    {
+        ImGui::TextDisabled("No sample yet");
+        return;
+    }
+
+    ImGui::Text("Frame %llu: %.2f ms in %zu call paths",
+                static_cast<unsigned long long>(profiler.GetLastSampleFrame()),
+                Micros(tree[0].inclusiveNs) / 1000.0f, tree.size() - 1);
+
+    ImGui::Separator();
+
+    // Flame graph
+    const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+    int32_t maxDepth = 0;
+    for (const CallTreeNode& node : tree)
+    {
+        maxDepth = std::max(maxDepth, node.depth);
+    }
+
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImVec2 size(ImGui::GetContentRegionAvail().x, rowHeight * static_cast<float>(std::min(maxDepth + 1, 16)));
+    ImGui::InvisibleButton("##FlameGraph", size);
+    DrawFlameGraph(ImGui::GetWindowDrawList(), origin, size, rowHeight, ImGui::IsItemHovered());
+
+    ImGui::Separator();
+
+    // Tree view
+    ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY |
+                                 ImGuiTableFlags_Resizable;
+
+    if (ImGui::BeginTable("CallTree", 4, tableFlags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Function", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+        ImGui::TableSetupColumn("Incl us", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+        ImGui::TableSetupColumn("Excl us", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+        ImGui::TableHeadersRow();
+
+        RenderTreeNode(tree, 0);
+
+        ImGui::EndTable();
+    }
+}
+
+void ProfilerWindow::RenderTreeNode(const std::vector<CallTreeNode>& tree, int32_t index)
+{
+    const CallTreeNode& node = tree[index];
+
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+
+    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanFullWidth;
+    if (node.children.empty())
+    {
+        flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    }
+    if (index == 0)
+    {
+        flags |= ImGuiTreeNodeFlags_DefaultOpen;
+    }
+
+    ImGui::PushID(index);
+    bool open = ImGui::TreeNodeEx(node.name.c_str(), flags);
+    ImGui::PopID();
+
+    ImGui::TableNextColumn();
+    ImGui::Text("%u", node.calls);
+
+    ImGui::TableNextColumn();
+    ImGui::Text("%.1f", Micros(node.inclusiveNs));
+
+    ImGui::TableNextColumn();
+    ImGui::Text("%.1f", Micros(node.exclusiveNs));
+
+    if (open && !node.children.empty())
+    {
+        for (int32_t child : node.children)
+        {
+            RenderTreeNode(tree, child);
+        }
+        ImGui::TreePop();
+    }
+}
+
+void ProfilerWindow::RenderOverlay()
+{
+    if (!m_ShowOverlay || !CallTreeProfiler::IsEnabled() || CallTreeProfiler::Get().GetLastTree().empty())
+    {
+        return;
+    }
+
+    // Strip along the bottom of the screen, drawn over the game
+    const ImVec2 display = ImGui::GetIO().DisplaySize;
+    const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+    const ImVec2 size(display.x - 20.0f, rowHeight * 8.0f);
+    const ImVec2 origin(10.0f, display.y - size.y - 10.0f);
+
+    ImDrawList* drawList = ImGui::GetForegroundDrawList();
+    drawList->AddRectFilled(origin, ImVec2(origin.x + size.x, origin.y + size.y), IM_COL32(0, 0, 0, 120));
+    DrawFlameGraph(drawList, origin, size, rowHeight, false);
+}
+
+void ProfilerWindow::DrawFlameGraph(ImDrawList* drawList, ImVec2 origin, ImVec2 size, float rowHeight, bool hovered)
+{
+    const auto& tree = CallTreeProfiler::Get().GetLastTree();
+    if (tree.empty() || tree[0].inclusiveNs == 0)
+    {
+        return;
+    }
+
+    const int32_t maxRows = static_cast<int32_t>(size.y / rowHeight);
+    const double scale = static_cast<double>(size.x) / static_cast<double>(tree[0].inclusiveNs);
+    const ImVec2 mouse = ImGui::GetIO().MousePos;
+
+    // Left edge of each node - children start at their parent's edge and follow each other
+    std::vector<double> left(tree.size(), 0.0);
+    std::vector<double> nextChild(tree.size(), 0.0);
+
+    for (size_t i = 0; i < tree.size(); i++)
+    {
+        const CallTreeNode& node = tree[i];
+        if (node.parent >= 0)
+        {
+            left[i] = nextChild[node.parent];
+            nextChild[node.parent] += static_cast<double>(node.inclusiveNs) * scale;
+        }
+        nextChild[i] = left[i];
+
+        const float width = static_cast<float>(static_cast<double>(node.inclusiveNs) * scale);
+        if (node.depth >= maxRows || width < 1.0f)
+        {
+            continue;
+        }
+
+        // Root at the bottom, callees stacked above their callers
+        ImVec2 min(origin.x + static_cast<float>(left[i]), origin.y + size.y - rowHeight * static_cast<float>(node.depth + 1));
+        ImVec2 max(min.x + width, min.y + rowHeight - 1.0f);
+
+        // Warm colors, varied by name so neighbours stand apart
+        uint32_t hash = static_cast<uint32_t>(std::hash<std::string>{}(node.name));
+        ImU32 color = IM_COL32(200 + hash % 55, 80 + (hash >> 8) % 120, 40 + (hash >> 16) % 40, 230);
+        drawList->AddRectFilled(min, max, color);
+
+        if (width > 30.0f)
+        {
+            drawList->PushClipRect(min, max, true);
+            drawList->AddText(ImVec2(min.x + 2.0f, min.y + 2.0f), IM_COL32(0, 0, 0, 255), node.name.c_str());
+            drawList->PopClipRect();
+        }
+
+        if (hovered && mouse.x >= min.x && mouse.x < max.x && mouse.y >= min.y && mouse.y < max.y)
+        {
+            ImGui::SetTooltip("%s\nCalls: %u\nInclusive: %.1f us\nExclusive: %.1f us", node.name.c_str(), node.calls,
+                              Micros(node.inclusiveNs), Micros(node.exclusiveNs));
+        }
+    }
+}
+
+void ProfilerWindow::RenderTrace()
+{
+    ProcessEventTrace& trace = ProcessEventTrace::Get();
+
+    if (ProcessEventTrace::IsEnabled())
+    {
+        if (ImGui::Button("Stop capture"))
+        {
+            trace.Stop();
+            NotificationManager::Get().Success("Profiler", std::string("Saved ") + trace.GetPath());
+        }
+    }
+    else
+    {
+        if (ImGui::Button("Start capture"))
+        {
+            if (!trace.Start(TracePath, m_TraceParams))
+            {
+                NotificationManager::Get().Error("Profiler", std::string("Could not create ") + TracePath);
+            }
+        }
+
+        ImGui::SameLine();
+        ImGui::Checkbox("Capture parameters", &m_TraceParams);
+    }
+    ImGui::TextDisabled("Replay offline with Tools/TraceReplay (parameters make the file much larger)");
+
+    ImGui::Separator();
+
+    if (trace.GetPath().empty())
+    {
+        ImGui::TextDisabled("No capture yet");
+        return;
+    }
+
+    ImGui::Text("File: %s%s", trace.GetPath().c_str(), ProcessEventTrace::IsEnabled() ? " (capturing)" : "");
+    ImGui::Text("Frames: %llu  Calls: %llu  Dropped: %llu",
+                static_cast<unsigned long long>(trace.GetFrameCount()),
+                static_cast<unsigned long long>(trace.GetCallCount()),
+                static_cast<unsigned long long>(trace.GetDroppedCalls()));
+    ImGui::Text("Written: %.2f MB", static_cast<double>(trace.GetBytesWritten()) / (1024.0 * 1024.0));
+}
+
+} // namespace Broadsword::Framework
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../../Engine/CallTreeProfiler.hpp"
+#include <imgui.h>
+#include <vector>
+
+namespace Broadsword::Framework {
+
+class ProfilerWindow {
+public:
+    ProfilerWindow();
+
+    void Render();
+
+    // Flame graph strip over the game (drawn even while the menu is hidden)
+    void RenderOverlay();
+
+    void SetVisible(bool visible) { m_Visible = visible; }
+    bool IsVisible() const { return m_Visible; }
+
+private:
+    void RenderFunctionStats();
+    void RenderCallTree();
+    void RenderTrace();
+    void RenderTreeNode(const std::vector<CallTreeNode>& tree, int32_t index);
+
+    // Last sampled call tree - root along the bottom edge, callees stacked above
+    void DrawFlameGraph(ImDrawList* drawList, ImVec2 origin, ImVec2 size, float rowHeight, bool hovered);
+
+    bool m_Visible = false;
+    bool m_ShowOverlay = false;
+    int m_TopCount = 25;
+    int m_SortBy = 0; // ProcessEventStats::SortBy
+    bool m_TraceParams = false;
+};
+
+} // namespace Broadsword::Framework
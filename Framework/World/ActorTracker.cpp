@@ -0,0 +1,221 @@
+#include "ActorTracker.hpp"
+#include "../../Services/EventBus/EventTypes.hpp"
+
+namespace Broadsword {
+
+void ActorTracker::Update() {
+    SDK::UWorld* world = SDK::UWorld::GetWorld();
+    SDK::ULevel* level = world ? world->PersistentLevel : nullptr;
+
+    // GWorld transition (map travel, main menu, etc.)
+    if (world != m_World || level != m_Level) {
+        ChangeWorld(world, level);
+    }
+
+    if (!m_Level) {
+        return;
+    }
+
+    const auto& actors = m_Level->Actors;
+    const SDK::AActor* const* data = actors.GetDataPtr();
+    int32_t num = actors.Num();
+
+    if (!data || num < 0) {
+        return;
+    }
+
+    if (static_cast<size_t>(num) < m_Slots.size()) {
+        // Engine compacted or swap-removed - index alignment is lost
+        FullResync(data, num);
+    } else {
+        AppendTail(data, num);
+        VerifySlice(data);
+    }
+
+    UpdatePlayer();
+}
+
+void ActorTracker::Reset() {
+    m_World = nullptr;
+    m_Level = nullptr;
+    m_Slots.clear();
+    m_LiveCount = 0;
+    m_VerifyCursor = 0;
+    m_Player = nullptr;
+    m_PlayerDead = false;
+}
+
+void ActorTracker::ChangeWorld(SDK::UWorld* world, SDK::ULevel* level) {
+    SDK::UWorld* oldWorld = m_World;
+    SDK::ULevel* oldLevel = m_Level;
+
+    Reset();
+
+    // Loaded was only emitted once the world had its level
+    if (oldWorld && oldLevel) {
+        OnWorldUnloadedEvent unloaded{oldWorld};
+        m_Events.Emit(unloaded);
+    }
+
+    m_World = world;
+    m_Level = level;
+
+    if (m_World && m_Level) {
+        OnWorldLoadedEvent loaded{m_World};
+        m_Events.Emit(loaded);
+    }
+}
+
+void ActorTracker::AppendTail(const SDK::AActor* const* data, int32_t num) {
+    size_t oldSize = m_Slots.size();
+    if (static_cast<size_t>(num) == oldSize) {
+        return;
+    }
+
+    m_Slots.reserve(num);
+
+    for (size_t i = oldSize; i < static_cast<size_t>(num); i++) {
+        TrackedActor tracked = Track(data[i]);
+        m_Slots.push_back(tracked);
+
+        if (tracked.actor) {
+            m_LiveCount++;
+            EmitSpawned(tracked);
+        }
+    }
+}
+
+void ActorTracker::VerifySlice(const SDK::AActor* const* data) {
+    size_t count = m_Slots.size();
+    if (count == 0 || m_VerifySliceSize == 0) {
+        return;
+    }
+
+    size_t slice = m_VerifySliceSize < count ? m_VerifySliceSize : count;
+
+    for (size_t n = 0; n < slice; n++) {
+        if (m_VerifyCursor >= count) {
+            m_VerifyCursor = 0;
+        }
+
+        size_t i = m_VerifyCursor++;
+        const SDK::AActor* live = data[i];
+        TrackedActor& slot = m_Slots[i];
+
+        if (live == slot.actor) {
+            continue;
+        }
+
+        // Slot was nulled (destroyed) and/or reused by a different actor
+        if (slot.actor) {
+            m_LiveCount--;
+            EmitDestroyed(slot);
+        }
+
+        slot = Track(live);
+
+        if (slot.actor) {
+            m_LiveCount++;
+            EmitSpawned(slot);
+        }
+    }
+}
+
+void ActorTracker::FullResync(const SDK::AActor* const* data, int32_t num) {
+    m_FullResyncs++;
+
+    m_ScratchOld.clear();
+    m_ScratchNew.clear();
+
+    for (const auto& slot : m_Slots) {
+        if (slot.actor) {
+            m_ScratchOld.insert(slot.actor);
+        }
+    }
+
+    for (int32_t i = 0; i < num; i++) {
+        if (data[i]) {
+            m_ScratchNew.insert(data[i]);
+        }
+    }
+
+    std::vector<TrackedActor> oldSlots = std::move(m_Slots);
+    m_Slots.clear();
+    m_Slots.reserve(num);
+    m_LiveCount = 0;
+    m_VerifyCursor = 0;
+
+    for (const auto& slot : oldSlots) {
+        if (slot.actor && !m_ScratchNew.contains(slot.actor)) {
+            EmitDestroyed(slot);
+        }
+    }
+
+    for (int32_t i = 0; i < num; i++) {
+        TrackedActor tracked = Track(data[i]);
+        m_Slots.push_back(tracked);
+
+        if (!tracked.actor) {
+            continue;
+        }
+
+        m_LiveCount++;
+        if (!m_ScratchOld.contains(tracked.actor)) {
+            EmitSpawned(tracked);
+        }
+    }
+}
+
+void ActorTracker::UpdatePlayer() {
+    SDK::AWillie_BP_C* player = nullptr;
+
+    // Direct field walk - avoids the two ProcessEvent calls GetPlayerController/K2_GetPawn cost
+    SDK::UGameInstance* gameInstance = m_World->OwningGameInstance;
+    if (gameInstance && gameInstance->LocalPlayers.IsValidIndex(0)) {
+        SDK::ULocalPlayer* localPlayer = gameInstance->LocalPlayers[0];
+        SDK::APlayerController* controller = localPlayer ? localPlayer->PlayerController : nullptr;
+        SDK::APawn* pawn = controller ? controller->Pawn : nullptr;
+
+        if (pawn == m_Player) {
+            player = m_Player;
+        } else if (pawn && pawn->IsA(SDK::AWillie_BP_C::StaticClass())) {
+            player = static_cast<SDK::AWillie_BP_C*>(pawn);
+        }
+    }
+
+    if (player != m_Player) {
+        m_Player = player;
+        m_PlayerDead = false;
+
+        if (m_Player) {
+            OnPlayerSpawnedEvent spawned{m_Player, m_World};
+            m_Events.Emit(spawned);
+        }
+    }
+
+    if (m_Player && !m_PlayerDead && m_Player->DED) {
+        m_PlayerDead = true;
+
+        OnPlayerDiedEvent died{m_Player, m_World};
+        m_Events.Emit(died);
+    }
+}
+
+void ActorTracker::EmitSpawned(const TrackedActor& tracked) {
+    OnActorSpawnedEvent event{tracked.actor, tracked.actorClass, m_World};
+    m_Events.Emit(event);
+}
+
+void ActorTracker::EmitDestroyed(const TrackedActor& tracked) {
+    OnActorDestroyedEvent event{tracked.actor, tracked.actorClass, m_World};
+    m_Events.Emit(event);
+}
+
+ActorTracker::TrackedActor ActorTracker::Track(const SDK::AActor* actor) {
+    TrackedActor tracked;
+    tracked.actor = const_cast<SDK::AActor*>(actor);
+    tracked.actorClass = actor ? actor->Class : nullptr;
+    return tracked;
+}
+
+} // namespace Broadsword
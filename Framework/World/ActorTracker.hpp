@@ -0,0 +1,114 @@
+#pragma once
+
+#include "../../Engine/SDK/SDK.hpp"
+#include "../../Services/EventBus/EventBus.hpp"
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace Broadsword {
+
+/**
+ * ActorTracker - Incremental differ over UWorld::PersistentLevel->Actors
+ *
+ * Drives the world/actor/player events so mods no longer have to call
+ * GetAllActorsOfClass every frame to discover new actors:
+ * - OnWorldLoadedEvent / OnWorldUnloadedEvent on GWorld or PersistentLevel changes
+ * - OnActorSpawnedEvent / OnActorDestroyedEvent for level actor changes
+ * - OnPlayerSpawnedEvent / OnPlayerDiedEvent for the local player
+ *
+ * Diffing strategy (per frame):
+ * - New actors are appended by the engine, so growth of Actors.Num() is
+ *   handled by visiting only the new tail slots
+ * - Destroyed actors are nulled in place; a rolling verify window of
+ *   GetVerifySliceSize() slots catches them without scanning the whole array
+ * - If the array shrinks (compaction/swap-removal), a hashed pointer
+ *   snapshot is diffed once to resynchronize
+ *
+ * Tracked pointers are only compared, never dereferenced after they leave
+ * the level, so stale actors are safe to report.
+ *
+ * Thread Safety:
+ * - MUST be called from game thread only
+ *
+ * Usage:
+ *   ActorTracker tracker(eventBus);
+ *
+ *   // Once per frame, before OnFrameEvent
+ *   tracker.Update();
+ */
+class ActorTracker {
+public:
+    explicit ActorTracker(EventBus& events) : m_Events(events) {}
+    ~ActorTracker() = default;
+
+    ActorTracker(const ActorTracker&) = delete;
+    ActorTracker& operator=(const ActorTracker&) = delete;
+
+    /**
+     * Diff the current world against the last snapshot and emit events
+     */
+    void Update();
+
+    /**
+     * Forget all tracked state (next Update() re-emits world loaded)
+     */
+    void Reset();
+
+    /**
+     * Number of existing slots re-verified each frame to detect removals
+     *
+     * Larger values detect destroyed actors sooner at a higher per-frame cost.
+     */
+    void SetVerifySliceSize(size_t slots) { m_VerifySliceSize = slots; }
+    size_t GetVerifySliceSize() const { return m_VerifySliceSize; }
+
+    /**
+     * Number of live actors currently tracked
+     */
+    size_t GetTrackedCount() const { return m_LiveCount; }
+
+    /**
+     * Number of hashed full resyncs performed (should stay near zero)
+     */
+    uint64_t GetFullResyncCount() const { return m_FullResyncs; }
+
+private:
+    struct TrackedActor {
+        SDK::AActor* actor = nullptr;
+        SDK::UClass* actorClass = nullptr;
+    };
+
+    void ChangeWorld(SDK::UWorld* world, SDK::ULevel* level);
+    void AppendTail(const SDK::AActor* const* data, int32_t num);
+    void VerifySlice(const SDK::AActor* const* data);
+    void FullResync(const SDK::AActor* const* data, int32_t num);
+    void UpdatePlayer();
+
+    void EmitSpawned(const TrackedActor& tracked);
+    void EmitDestroyed(const TrackedActor& tracked);
+
+    static TrackedActor Track(const SDK::AActor* actor);
+
+    EventBus& m_Events;
+
+    SDK::UWorld* m_World = nullptr;
+    SDK::ULevel* m_Level = nullptr;
+
+    // Mirror of PersistentLevel->Actors (index-aligned)
+    std::vector<TrackedActor> m_Slots;
+    size_t m_LiveCount = 0;
+
+    size_t m_VerifyCursor = 0;
+    size_t m_VerifySliceSize = 256;
+
+    // Scratch sets reused by FullResync to avoid per-call allocation
+    std::unordered_set<const SDK::AActor*> m_ScratchOld;
+    std::unordered_set<const SDK::AActor*> m_ScratchNew;
+    uint64_t m_FullResyncs = 0;
+
+    SDK::AWillie_BP_C* m_Player = nullptr;
+    bool m_PlayerDead = false;
+};
+
+} // namespace Broadsword
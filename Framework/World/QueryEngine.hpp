@@ -2,6 +2,7 @@
 
 #include "../../ModAPI/Result.hpp"
 #include "../../Engine/SDK/SDK.hpp"
+#include "../../Engine/ClassHierarchy.hpp"
 #include <vector>
 #include <functional>
 
@@ -14,7 +15,8 @@ namespace Broadsword {
  * proper type checking and error handling.
  *
  * Features:
- * - Template-based type filtering
+ * - Template-based type filtering by UE class (T::StaticClass() and its
+ *   subclasses, via ClassHierarchy interval checks)
  * - Predicate-based filtering
  * - Single and multi-result queries
  * - Null safety with Result monad
@@ -66,14 +68,16 @@ public:
             return Error::WorldInvalid;
         }
 
+        SDK::UClass* typeClass = T::StaticClass();
+
         // Iterate through actors
         auto& actors = m_World->PersistentLevel->Actors;
         for (int32_t i = 0; i < actors.Num(); i++) {
             SDK::AActor* actor = actors[i];
             if (!actor) continue;
 
-            // Try to cast to requested type
-            T* typedActor = dynamic_cast<T*>(actor);
+            // Check against the requested UE class
+            T* typedActor = As<T>(actor, typeClass);
             if (typedActor) {
                 return typedActor;
             }
@@ -96,12 +100,14 @@ public:
             return results;
         }
 
+        SDK::UClass* typeClass = T::StaticClass();
+
         auto& actors = m_World->PersistentLevel->Actors;
         for (int32_t i = 0; i < actors.Num(); i++) {
             SDK::AActor* actor = actors[i];
             if (!actor) continue;
 
-            T* typedActor = dynamic_cast<T*>(actor);
+            T* typedActor = As<T>(actor, typeClass);
             if (typedActor) {
                 results.push_back(typedActor);
             }
@@ -125,12 +131,14 @@ public:
             return results;
         }
 
+        SDK::UClass* typeClass = T::StaticClass();
+
         auto& actors = m_World->PersistentLevel->Actors;
         for (int32_t i = 0; i < actors.Num(); i++) {
             SDK::AActor* actor = actors[i];
             if (!actor) continue;
 
-            T* typedActor = dynamic_cast<T*>(actor);
+            T* typedActor = As<T>(actor, typeClass);
             if (typedActor && predicate(typedActor)) {
                 results.push_back(typedActor);
             }
@@ -174,6 +182,12 @@ public:
     }
 
 private:
+    // SDK types mirror UE classes, not the C++ types of the game's objects - dynamic_cast can't check them
+    template<typename T>
+    static T* As(SDK::AActor* actor, const SDK::UClass* typeClass) {
+        return ClassHierarchy::Get().IsA(actor, typeClass) ? static_cast<T*>(actor) : nullptr;
+    }
+
     SDK::UWorld* m_World;
 };
 
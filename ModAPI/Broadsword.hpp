@@ -43,6 +43,7 @@
 #include "../Services/EventBus/EventBus.hpp"
 #include "../Services/Config/UniversalConfig.hpp"
 #include "../Services/Logging/Logger.hpp"
+#include "../Foundation/Threading/WorkerPool.hpp"
 #include "../Framework/Core/ModContext.hpp"
 
 // ========================================
@@ -9,20 +9,77 @@ HookContext::~HookContext() {
 
 size_t HookContext::Hook(
     std::string_view functionName,
-    std::function<bool(SDK::UObject*, void*)> callback
+    std::function<bool(SDK::UObject*, void*)> callback,
+    const HookFilter& filter
 ) {
     // Wrap callback to match ProcessEventHook signature
-    auto wrappedCallback = [callback](SDK::UObject* obj, SDK::UFunction* func, void* params) {
+    auto wrappedCallback = [callback](SDK::UObject* obj, SDK::UFunction*, void* params) {
         return callback(obj, params);
     };
 
-    size_t hookId = ProcessEventHook::Get().AddHook(functionName, wrappedCallback);
+    size_t hookId = ProcessEventHook::Get().AddHook(functionName, wrappedCallback, filter);
+    m_RegisteredHooks.push_back(hookId);
+    return hookId;
+}
+
+size_t HookContext::Hook(
+    std::string_view functionName,
+    std::function<bool(SDK::UObject*, ParamView)> callback,
+    const HookFilter& filter
+) {
+    auto wrappedCallback = [callback](SDK::UObject* obj, SDK::UFunction* func, void* params) {
+        return callback(obj, ParamView(&ParamLayout::Get(func), params));
+    };
+
+    size_t hookId = ProcessEventHook::Get().AddHook(functionName, wrappedCallback, filter);
+    m_RegisteredHooks.push_back(hookId);
+    return hookId;
+}
+
+size_t HookContext::HookPost(
+    std::string_view functionName,
+    std::function<void(SDK::UObject*, void*)> callback,
+    const HookFilter& filter
+) {
+    auto wrappedCallback = [callback](SDK::UObject* obj, SDK::UFunction*, void* params) {
+        callback(obj, params);
+    };
+
+    size_t hookId = ProcessEventHook::Get().AddPostHook(functionName, wrappedCallback, filter);
+    m_RegisteredHooks.push_back(hookId);
+    return hookId;
+}
+
+size_t HookContext::HookPost(
+    std::string_view functionName,
+    std::function<void(SDK::UObject*, ParamView)> callback,
+    const HookFilter& filter
+) {
+    auto wrappedCallback = [callback](SDK::UObject* obj, SDK::UFunction* func, void* params) {
+        callback(obj, ParamView(&ParamLayout::Get(func), params));
+    };
+
+    size_t hookId = ProcessEventHook::Get().AddPostHook(functionName, wrappedCallback, filter);
+    m_RegisteredHooks.push_back(hookId);
+    return hookId;
+}
+
+size_t HookContext::Observe(
+    std::string_view functionName,
+    std::function<void(const ObservedCall&)> callback,
+    ObserverPhase phase,
+    const HookFilter& filter
+) {
+    size_t hookId = ProcessEventObservers::Get().Add(functionName, std::move(callback), phase, filter);
     m_RegisteredHooks.push_back(hookId);
     return hookId;
 }
 
 void HookContext::Unhook(size_t hookId) {
-    ProcessEventHook::Get().RemoveHook(hookId);
+    // Observers own their hook
+    if (!ProcessEventObservers::Get().Remove(hookId)) {
+        ProcessEventHook::Get().RemoveHook(hookId);
+    }
 
     // Remove from our list
     auto it = std::remove(m_RegisteredHooks.begin(), m_RegisteredHooks.end(), hookId);
@@ -31,7 +88,9 @@ void HookContext::Unhook(size_t hookId) {
 
 void HookContext::UnhookAll() {
     for (size_t hookId : m_RegisteredHooks) {
-        ProcessEventHook::Get().RemoveHook(hookId);
+        if (!ProcessEventObservers::Get().Remove(hookId)) {
+            ProcessEventHook::Get().RemoveHook(hookId);
+        }
     }
 
     m_RegisteredHooks.clear();
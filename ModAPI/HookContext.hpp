@@ -1,8 +1,13 @@
 #pragma once
 
 #include "../Engine/ProcessEventHook.hpp"
+#include "../Engine/ParamLayout.hpp"
+#include "../Engine/ProcessEventObservers.hpp"
+#include "../Engine/UFunctionDescriptor.hpp"
 #include <functional>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Broadsword {
@@ -16,6 +21,12 @@ namespace Broadsword {
  * Features:
  * - Simple Hook() method with function name and callback
  * - Type-safe parameter casting via template overload
+ * - Post-hooks (HookPost) that run after the original function
+ * - ParamView overloads: parameters, out-params and return value by name
+ * - Typed binding keyed by the SDK function (Hook<&SDK::AWillie_BP_C::Fn>):
+ *   class, function name and Params:: struct checked at compile time
+ * - Declarative filters (class, instance, outer) evaluated before the callback
+ * - Observers (Observe) that copy the call and run later, outside ProcessEvent
  * - Automatic unhook on mod unload
  * - Multiple hooks per function supported
  *
@@ -36,6 +47,31 @@ namespace Broadsword {
  *               params->DamageAmount *= 0.5f; // Reduce damage by 50%
  *               return true;
  *           });
+ *
+ *       // Bound to the SDK function - names and Params:: struct come from its descriptor
+ *       // (#include "Engine/SDK/Descriptors/ABP_Willie_descriptors.hpp")
+ *       ctx.hooks.Hook<&SDK::UABP_Willie_C::BlueprintUpdateAnimation>(
+ *           [this](SDK::UABP_Willie_C* anim, SDK::Params::ABP_Willie_C_BlueprintUpdateAnimation* params) {
+ *               m_AnimDelta = params->DeltaTimeX;
+ *               return true;
+ *           });
+ *
+ *       // Only for the player's Willie - other Willies never reach the callback
+ *       ctx.hooks.Hook("TakeDamage",
+ *           [this](SDK::UObject* obj, void* params) { return true; },
+ *           {.instance = playerWillie});
+ *
+ *       // Observer - counted at frame end, nothing runs inside ProcessEvent
+ *       ctx.hooks.Observe("ReceiveAnyDamage",
+ *           [this](const ObservedCall& call) { m_Hits++; });
+ *
+ *       // Post-hook reading the return value
+ *       ctx.hooks.HookPost("GetHealth",
+ *           [this](SDK::UObject* obj, ParamView params) {
+ *               if (float* health = params.Return<float>()) {
+ *                   m_LastHealth = *health;
+ *               }
+ *           });
  *   }
  *
  *   // In mod OnUnregister:
@@ -54,11 +90,13 @@ public:
      *
      * @param functionName Name of UFunction to hook (e.g., "TakeDamage")
      * @param callback Hook callback (return false to block original)
+     * @param filter Only invoke callback for matching objects (see HookFilter)
      * @return Hook ID for later removal
      */
     size_t Hook(
         std::string_view functionName,
-        std::function<bool(SDK::UObject*, void*)> callback
+        std::function<bool(SDK::UObject*, void*)> callback,
+        const HookFilter& filter = {}
     );
 
     /**
@@ -67,20 +105,198 @@ public:
      * @tparam ParamsType Function parameter struct type
      * @param functionName Name of UFunction to hook
      * @param callback Type-safe hook callback
+     * @param filter Only invoke callback for matching objects (see HookFilter)
      * @return Hook ID for later removal
      */
     template<typename ParamsType>
     size_t Hook(
         std::string_view functionName,
-        std::function<bool(SDK::UObject*, ParamsType*)> callback
+        std::function<bool(SDK::UObject*, ParamsType*)> callback,
+        const HookFilter& filter = {}
     ) {
         // Wrap type-safe callback in generic callback
-        auto wrappedCallback = [callback](SDK::UObject* obj, SDK::UFunction* func, void* params) {
+        auto wrappedCallback = [callback](SDK::UObject* obj, SDK::UFunction*, void* params) {
             auto* typedParams = static_cast<ParamsType*>(params);
             return callback(obj, typedParams);
         };
 
-        size_t hookId = ProcessEventHook::Get().AddHook(functionName, wrappedCallback);
+        size_t hookId = ProcessEventHook::Get().AddHook(functionName, wrappedCallback, filter);
+        m_RegisteredHooks.push_back(hookId);
+        return hookId;
+    }
+
+    /**
+     * Hook a UFunction by name with a ParamView of its parameters
+     *
+     * @param functionName Name of UFunction to hook
+     * @param callback Hook callback (return false to block original)
+     * @param filter Only invoke callback for matching objects (see HookFilter)
+     * @return Hook ID for later removal
+     */
+    size_t Hook(
+        std::string_view functionName,
+        std::function<bool(SDK::UObject*, ParamView)> callback,
+        const HookFilter& filter = {}
+    );
+
+    /**
+     * Post-hook a UFunction by name (runs after the original)
+     *
+     * @param functionName Name of UFunction to hook
+     * @param callback Post-hook callback
+     * @param filter Only invoke callback for matching objects (see HookFilter)
+     * @return Hook ID for later removal
+     */
+    size_t HookPost(
+        std::string_view functionName,
+        std::function<void(SDK::UObject*, void*)> callback,
+        const HookFilter& filter = {}
+    );
+
+    /**
+     * Post-hook a UFunction by name with a ParamView of its parameters
+     *
+     * @param functionName Name of UFunction to hook
+     * @param callback Post-hook callback
+     * @param filter Only invoke callback for matching objects (see HookFilter)
+     * @return Hook ID for later removal
+     */
+    size_t HookPost(
+        std::string_view functionName,
+        std::function<void(SDK::UObject*, ParamView)> callback,
+        const HookFilter& filter = {}
+    );
+
+    /**
+     * Post-hook a UFunction by name with type-safe parameters
+     *
+     * @tparam ParamsType Function parameter struct type
+     * @param functionName Name of UFunction to hook
+     * @param callback Type-safe post-hook callback
+     * @param filter Only invoke callback for matching objects (see HookFilter)
+     * @return Hook ID for later removal
+     */
+    template<typename ParamsType>
+    size_t HookPost(
+        std::string_view functionName,
+        std::function<void(SDK::UObject*, ParamsType*)> callback,
+        const HookFilter& filter = {}
+    ) {
+        auto wrappedCallback = [callback](SDK::UObject* obj, SDK::UFunction*, void* params) {
+            callback(obj, static_cast<ParamsType*>(params));
+        };
+
+        size_t hookId = ProcessEventHook::Get().AddPostHook(functionName, wrappedCallback, filter);
+        m_RegisteredHooks.push_back(hookId);
+        return hookId;
+    }
+
+    /**
+     * Hook a generated SDK function
+     *
+     * The UClass, UFunction name and Params:: struct come from the function's
+     * UFunctionDescriptor (include its Engine/SDK/Descriptors/ header), so a
+     * mismatched callback fails to compile. The callback is stored directly in
+     * the hook - one call through ProcessEventHook's callback, no name lookups.
+     * Only the function declared on the descriptor's class (and overrides of it
+     * in subclasses or implementing classes) is hooked, not same-named
+     * functions of other classes.
+     *
+     * @tparam Function SDK wrapper, e.g. &SDK::AWillie_BP_C::Add_Startup_Weapons
+     * @param callback (Class*, Params*) or (Class*) for functions without
+     *                 parameters; returns bool (false blocks original) or void
+     * @param filter Only invoke callback for matching objects (see HookFilter)
+     * @return Hook ID for later removal
+     */
+    template<auto Function, typename Callback>
+        requires DescribedUFunction<Function>
+    size_t Hook(Callback&& callback, HookFilter filter = {}) {
+        using Descriptor = UFunctionDescriptor<Function>;
+        filter.functionOwner = Descriptor::ClassName;
+
+        auto trampoline = [callback = std::forward<Callback>(callback)](SDK::UObject* obj, SDK::UFunction*, void* params) {
+            if constexpr (std::is_void_v<decltype(Invoke<Descriptor>(callback, obj, params))>) {
+                Invoke<Descriptor>(callback, obj, params);
+                return true;
+            } else {
+                return static_cast<bool>(Invoke<Descriptor>(callback, obj, params));
+            }
+        };
+
+        size_t hookId = ProcessEventHook::Get().AddHook(Descriptor::FunctionName, std::move(trampoline), filter);
+        m_RegisteredHooks.push_back(hookId);
+        return hookId;
+    }
+
+    /**
+     * Post-hook a generated SDK function (runs after the original)
+     *
+     * @tparam Function SDK wrapper, e.g. &SDK::AWillie_BP_C::Add_Startup_Weapons
+     * @param callback (Class*, Params*) or (Class*) for functions without parameters
+     * @param filter Only invoke callback for matching objects (see HookFilter)
+     * @return Hook ID for later removal
+     */
+    template<auto Function, typename Callback>
+        requires DescribedUFunction<Function>
+    size_t HookPost(Callback&& callback, HookFilter filter = {}) {
+        using Descriptor = UFunctionDescriptor<Function>;
+        filter.functionOwner = Descriptor::ClassName;
+
+        auto trampoline = [callback = std::forward<Callback>(callback)](SDK::UObject* obj, SDK::UFunction*, void* params) {
+            Invoke<Descriptor>(callback, obj, params);
+        };
+
+        size_t hookId = ProcessEventHook::Get().AddPostHook(Descriptor::FunctionName, std::move(trampoline), filter);
+        m_RegisteredHooks.push_back(hookId);
+        return hookId;
+    }
+
+    /**
+     * Observe a UFunction by name
+     *
+     * The detour only copies the parameter block and object handle; the
+     * callback runs later at the chosen phase (see ProcessEventObservers).
+     * Observers can't modify parameters or block the original.
+     *
+     * @param functionName Name of UFunction to observe
+     * @param callback Runs once per observed call
+     * @param phase When (and on which thread) the callback runs
+     * @param filter Only queue calls from matching objects (see HookFilter)
+     * @return Hook ID for later removal
+     */
+    size_t Observe(
+        std::string_view functionName,
+        std::function<void(const ObservedCall&)> callback,
+        ObserverPhase phase = ObserverPhase::FrameEnd,
+        const HookFilter& filter = {}
+    );
+
+    /**
+     * Observe a generated SDK function
+     *
+     * @tparam Function SDK wrapper, e.g. &SDK::AWillie_BP_C::Add_Startup_Weapons
+     * @param callback (const ObservedCall&, const Params&) or (const ObservedCall&)
+     *                 for functions without parameters
+     * @param phase When (and on which thread) the callback runs
+     * @param filter Only queue calls from matching objects (see HookFilter)
+     * @return Hook ID for later removal
+     */
+    template<auto Function, typename Callback>
+        requires DescribedUFunction<Function>
+    size_t Observe(Callback&& callback, ObserverPhase phase = ObserverPhase::FrameEnd, HookFilter filter = {}) {
+        using Descriptor = UFunctionDescriptor<Function>;
+        using Params = typename Descriptor::Params;
+        filter.functionOwner = Descriptor::ClassName;
+
+        auto trampoline = [callback = std::forward<Callback>(callback)](const ObservedCall& call) mutable {
+            if constexpr (std::is_void_v<Params>) {
+                callback(call);
+            } else if (const Params* params = call.As<Params>()) {
+                callback(call, *params);
+            }
+        };
+
+        size_t hookId = ProcessEventObservers::Get().Add(Descriptor::FunctionName, std::move(trampoline), phase, filter);
         m_RegisteredHooks.push_back(hookId);
         return hookId;
     }
@@ -100,6 +316,17 @@ public:
     void UnhookAll();
 
 private:
+    // Call a typed callback with the descriptor's object and Params:: types
+    template<typename Descriptor, typename Callback>
+    static decltype(auto) Invoke(Callback& callback, SDK::UObject* obj, void* params) {
+        auto* object = static_cast<typename Descriptor::Class*>(obj);
+        if constexpr (std::is_void_v<typename Descriptor::Params>) {
+            return callback(object);
+        } else {
+            return callback(object, static_cast<typename Descriptor::Params*>(params));
+        }
+    }
+
     std::vector<size_t> m_RegisteredHooks;
 };
 
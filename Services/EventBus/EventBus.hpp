@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
 #include <functional>
 #include <unordered_map>
 #include <vector>
@@ -8,18 +11,95 @@
 
 namespace Broadsword {
 
+/**
+ * Declarative subscription filter
+ *
+ * Every field left at its default matches anything. Non-default fields must
+ * all match the keys reported by the event (see EventFilterKeys below), so a
+ * subscriber with { .actorClass = WillieClass } is never invoked for other
+ * actor classes.
+ *
+ * Fields are opaque pointers/integers so the bus stays independent of the SDK:
+ * - actorClass: SDK::UClass* of the actor the event is about; subclasses match
+ *               too once a class matcher is set (EventBus::SetClassMatcher)
+ * - key:        mod-defined 64-bit key (e.g. a hashed custom event channel)
+ * - world:      SDK::UWorld* the event originated in
+ */
+struct EventFilter {
+    const void* actorClass = nullptr;
+    uint64_t key = 0;
+    const void* world = nullptr;
+
+    bool IsEmpty() const {
+        return actorClass == nullptr && key == 0 && world == nullptr;
+    }
+};
+
+/**
+ * Filter keys carried by an event instance
+ *
+ * Events opt into filtering by providing:
+ *   EventFilterKeys GetFilterKeys() const;
+ *
+ * Events without GetFilterKeys() are only delivered to unfiltered subscribers.
+ */
+using EventFilterKeys = EventFilter;
+
+template<typename Event>
+concept FilterableEvent = requires(const Event& e) {
+    { e.GetFilterKeys() } -> std::convertible_to<EventFilterKeys>;
+};
+
+/**
+ * Base for events that handlers may consume
+ *
+ * Once a handler calls Consume(), lower-priority subscribers are skipped.
+ *
+ * Usage:
+ *   struct OnDamageEvent : ConsumableEvent {
+ *       float amount = 0.0f;
+ *   };
+ */
+struct ConsumableEvent {
+    void Consume() { m_Consumed = true; }
+    bool IsConsumed() const { return m_Consumed; }
+
+private:
+    bool m_Consumed = false;
+};
+
+/**
+ * Options accepted by EventBus::Subscribe
+ *
+ * @field priority Higher priorities run first; equal priorities run in subscription order
+ * @field filter Declarative filter evaluated by the bus before invoking the callback
+ */
+struct SubscribeOptions {
+    int priority = 0;
+    EventFilter filter = {};
+};
+
 /**
  * Generic event bus for publish-subscribe pattern
  *
  * Allows mods to subscribe to events and receive callbacks when those events are emitted.
  * Thread-safe for single-threaded usage (all callbacks execute on game thread).
  *
+ * Subscribers are indexed by their filter (actor class, then key, then world), so
+ * subscribers whose filter cannot match an event are never visited. Dispatch merges
+ * the unfiltered list with the matching buckets in priority order.
+ *
  * Usage:
  *   // Subscribe to an event
  *   size_t id = eventBus.Subscribe<OnFrameEvent>([](OnFrameEvent& e) {
  *       // Handle frame event
  *   });
  *
+ *   // Subscribe with a filter and priority
+ *   eventBus.Subscribe<OnActorSpawnedEvent>(
+ *       [](OnActorSpawnedEvent& e) { ... },
+ *       {.priority = 100, .filter = {.actorClass = SDK::AWillie_BP_C::StaticClass()}});
+ *
  *   // Emit an event
  *   OnFrameEvent event{frame};
  *   eventBus.Emit(event);
@@ -29,63 +109,118 @@ namespace Broadsword {
  */
 class EventBus {
 public:
+    /**
+     * Subclass test for actorClass filters: does actorClass derive from filterClass?
+     */
+    using ClassMatcher = bool (*)(const void* actorClass, const void* filterClass);
+
+    /**
+     * Let actorClass filters match subclasses
+     *
+     * The framework installs ClassHierarchy's check, keeping the bus free of
+     * SDK types. Without a matcher, actorClass filters match the exact class.
+     */
+    void SetClassMatcher(ClassMatcher matcher) {
+        m_ClassMatcher = matcher;
+    }
+
     /**
      * Subscribe to an event type
      *
      * @param callback Function to call when event is emitted
+     * @param options Priority and declarative filter
      * @return Subscription ID for unsubscribing
      */
     template<typename Event>
-    size_t Subscribe(std::function<void(Event&)> callback) {
+    size_t Subscribe(std::function<void(Event&)> callback, const SubscribeOptions& options = {}) {
         size_t id = m_NextId++;
-        auto typeIndex = std::type_index(typeid(Event));
 
-        // Create subscriber list if it doesn't exist
-        if (m_Subscribers.find(typeIndex) == m_Subscribers.end()) {
-            m_Subscribers[typeIndex] = std::make_unique<SubscriberList<Event>>();
-        }
+        Subscriber<Event> subscriber;
+        subscriber.id = id;
+        subscriber.priority = options.priority;
+        subscriber.filter = options.filter;
+        subscriber.callback = std::move(callback);
 
-        // Add callback
-        auto* subscribers = static_cast<SubscriberList<Event>*>(m_Subscribers[typeIndex].get());
-        subscribers->callbacks[id] = callback;
+        auto* subscribers = GetOrCreateList<Event>();
 
+        // Inserting while the list is being walked would invalidate the dispatch cursors
+        if (m_EmitDepth > 0) {
+            subscribers->pendingAdds.push_back(std::move(subscriber));
+            m_HasDeferred = true;
+        } else {
+            subscribers->Insert(std::move(subscriber));
+        }
+
+        subscribers->count++;
         return id;
     }
 
     /**
      * Unsubscribe from an event type
      *
+     * Safe to call from inside a callback; removal is deferred until the
+     * outermost Emit() returns.
+     *
      * @param id Subscription ID returned from Subscribe
      */
     template<typename Event>
     void Unsubscribe(size_t id) {
-        auto typeIndex = std::type_index(typeid(Event));
+        auto it = m_Subscribers.find(std::type_index(typeid(Event)));
+        if (it == m_Subscribers.end()) {
+            return;
+        }
 
-        auto it = m_Subscribers.find(typeIndex);
-        if (it != m_Subscribers.end()) {
-            auto* subscribers = static_cast<SubscriberList<Event>*>(it->second.get());
-            subscribers->callbacks.erase(id);
+        auto* subscribers = static_cast<SubscriberList<Event>*>(it->second.get());
+        if (subscribers->Deactivate(id)) {
+            subscribers->count--;
+            subscribers->dirty = true;
+            if (m_EmitDepth == 0) {
+                subscribers->Purge();
+            } else {
+                m_HasDeferred = true;
+            }
         }
     }
 
     /**
-     * Emit an event to all subscribers
+     * Emit an event to all matching subscribers
+     *
+     * Subscribers run in priority order. If the event derives from
+     * ConsumableEvent, dispatch stops as soon as a handler consumes it.
      *
      * @param event Event instance to emit
      */
     template<typename Event>
     void Emit(Event& event) {
-        auto typeIndex = std::type_index(typeid(Event));
+        auto it = m_Subscribers.find(std::type_index(typeid(Event)));
+        if (it == m_Subscribers.end()) {
+            return;
+        }
 
-        auto it = m_Subscribers.find(typeIndex);
-        if (it != m_Subscribers.end()) {
-            auto* subscribers = static_cast<SubscriberList<Event>*>(it->second.get());
+        auto* subscribers = static_cast<SubscriberList<Event>*>(it->second.get());
 
-            // Call all callbacks for this event type
-            for (auto& [id, callback] : subscribers->callbacks) {
-                callback(event);
-            }
+        // Gather the unfiltered list plus every bucket the event's keys select
+        const std::vector<Subscriber<Event>>* lists[MaxDispatchLists] = {&subscribers->unfiltered};
+        size_t listCount = 1;
+        EventFilterKeys keys{};
+
+        if constexpr (FilterableEvent<Event>) {
+            keys = event.GetFilterKeys();
+            listCount = subscribers->CollectBuckets(keys, m_ClassMatcher, lists);
         }
+
+        // Callbacks may throw; the guard keeps the depth counter balanced
+        struct EmitScope {
+            EventBus& bus;
+            explicit EmitScope(EventBus& b) : bus(b) { bus.m_EmitDepth++; }
+            ~EmitScope() {
+                if (--bus.m_EmitDepth == 0 && bus.m_HasDeferred) {
+                    bus.FlushDeferred();
+                }
+            }
+        } scope(*this);
+
+        Dispatch(event, keys, lists, listCount);
     }
 
     /**
@@ -98,7 +233,7 @@ public:
         auto it = m_Subscribers.find(typeIndex);
         if (it != m_Subscribers.end()) {
             auto* subscribers = static_cast<SubscriberList<Event>*>(it->second.get());
-            return subscribers->callbacks.size();
+            return subscribers->count;
         }
         return 0;
     }
@@ -111,22 +246,210 @@ public:
     }
 
 private:
+    // Unfiltered list, class buckets of the event's class and its superclasses, key and world buckets
+    static constexpr size_t MaxDispatchLists = 24;
+
+    template<typename Event>
+    struct Subscriber {
+        size_t id = 0;
+        int priority = 0;
+        EventFilter filter;
+        std::function<void(Event&)> callback;
+        bool active = true;
+
+        // Dispatch order: higher priority first, then subscription order
+        bool RunsBefore(const Subscriber& other) const {
+            return priority != other.priority ? priority > other.priority : id < other.id;
+        }
+
+        // Secondary dimensions not covered by the bucket the subscriber lives in
+        // (actorClass always picks the bucket - see CollectBuckets)
+        bool Matches(const EventFilterKeys& keys) const {
+            return (filter.key == 0 || filter.key == keys.key) &&
+                   (!filter.world || filter.world == keys.world);
+        }
+    };
+
     // Base class for type-erased subscriber storage
     struct ISubscriberList {
         virtual ~ISubscriberList() = default;
+        virtual void Flush() = 0;
     };
 
-    // Typed subscriber list
+    // Typed subscriber list, indexed by each subscriber's most selective filter field
     template<typename Event>
     struct SubscriberList : ISubscriberList {
-        std::unordered_map<size_t, std::function<void(Event&)>> callbacks;
+        using List = std::vector<Subscriber<Event>>;
+
+        List unfiltered;
+        std::unordered_map<const void*, List> byClass;
+        std::unordered_map<uint64_t, List> byKey;
+        std::unordered_map<const void*, List> byWorld;
+
+        List pendingAdds;
+        size_t count = 0;
+        bool dirty = false;
+
+        List& BucketFor(const EventFilter& filter) {
+            if (filter.actorClass) return byClass[filter.actorClass];
+            if (filter.key != 0) return byKey[filter.key];
+            if (filter.world) return byWorld[filter.world];
+            return unfiltered;
+        }
+
+        void Insert(Subscriber<Event>&& subscriber) {
+            List& list = BucketFor(subscriber.filter);
+            auto pos = std::upper_bound(list.begin(), list.end(), subscriber,
+                [](const Subscriber<Event>& a, const Subscriber<Event>& b) { return a.RunsBefore(b); });
+            list.insert(pos, std::move(subscriber));
+        }
+
+        size_t CollectBuckets(const EventFilterKeys& keys, ClassMatcher classMatcher, const List** lists) const {
+            size_t n = 1;
+            if (keys.actorClass) {
+                if (auto it = byClass.find(keys.actorClass); it != byClass.end()) lists[n++] = &it->second;
+
+                // Buckets of superclasses - one matcher call per distinct filter class.
+                // Matching buckets form one Super chain, which never nears the list limit.
+                if (classMatcher) {
+                    for (const auto& [filterClass, list] : byClass) {
+                        if (n + 2 >= MaxDispatchLists) break;
+                        if (filterClass != keys.actorClass && classMatcher(keys.actorClass, filterClass)) {
+                            lists[n++] = &list;
+                        }
+                    }
+                }
+            }
+            if (keys.key != 0) {
+                if (auto it = byKey.find(keys.key); it != byKey.end()) lists[n++] = &it->second;
+            }
+            if (keys.world) {
+                if (auto it = byWorld.find(keys.world); it != byWorld.end()) lists[n++] = &it->second;
+            }
+            return n;
+        }
+
+        bool Deactivate(size_t id) {
+            auto deactivate = [id](List& list) {
+                for (auto& subscriber : list) {
+                    if (subscriber.id == id && subscriber.active) {
+                        subscriber.active = false;
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            if (deactivate(unfiltered) || deactivate(pendingAdds)) return true;
+            for (auto& [classPtr, list] : byClass) if (deactivate(list)) return true;
+            for (auto& [key, list] : byKey) if (deactivate(list)) return true;
+            for (auto& [world, list] : byWorld) if (deactivate(list)) return true;
+            return false;
+        }
+
+        void Purge() {
+            auto purge = [](List& list) {
+                std::erase_if(list, [](const Subscriber<Event>& s) { return !s.active; });
+            };
+            auto purgeMap = [&purge](auto& map) {
+                for (auto it = map.begin(); it != map.end();) {
+                    purge(it->second);
+                    it = it->second.empty() ? map.erase(it) : std::next(it);
+                }
+            };
+
+            purge(unfiltered);
+            purgeMap(byClass);
+            purgeMap(byKey);
+            purgeMap(byWorld);
+            dirty = false;
+        }
+
+        void Flush() override {
+            for (auto& subscriber : pendingAdds) {
+                if (subscriber.active) {
+                    Insert(std::move(subscriber));
+                }
+            }
+            pendingAdds.clear();
+
+            if (dirty) {
+                Purge();
+            }
+        }
     };
 
+    template<typename Event>
+    SubscriberList<Event>* GetOrCreateList() {
+        auto& slot = m_Subscribers[std::type_index(typeid(Event))];
+        if (!slot) {
+            slot = std::make_unique<SubscriberList<Event>>();
+        }
+        return static_cast<SubscriberList<Event>*>(slot.get());
+    }
+
+    /**
+     * Walk up to MaxDispatchLists priority-sorted lists as one merged sequence
+     */
+    template<typename Event>
+    static void Dispatch(Event& event, const EventFilterKeys& keys,
+                         const std::vector<Subscriber<Event>>* const* lists, size_t listCount) {
+        size_t cursors[MaxDispatchLists] = {};
+
+        while (true) {
+            const Subscriber<Event>* next = nullptr;
+            size_t nextList = 0;
+
+            for (size_t i = 0; i < listCount; i++) {
+                if (cursors[i] >= lists[i]->size()) continue;
+
+                const auto& candidate = (*lists[i])[cursors[i]];
+                if (!next || candidate.RunsBefore(*next)) {
+                    next = &candidate;
+                    nextList = i;
+                }
+            }
+
+            if (!next) {
+                return;
+            }
+            cursors[nextList]++;
+
+            if (!next->active || !next->Matches(keys)) {
+                continue;
+            }
+
+            next->callback(event);
+
+            if constexpr (std::is_base_of_v<ConsumableEvent, Event>) {
+                if (event.IsConsumed()) {
+                    return;
+                }
+            }
+        }
+    }
+
+    void FlushDeferred() {
+        for (auto& [type, list] : m_Subscribers) {
+            list->Flush();
+        }
+        m_HasDeferred = false;
+    }
+
     // Type-erased subscriber storage
     std::unordered_map<std::type_index, std::unique_ptr<ISubscriberList>> m_Subscribers;
 
     // Subscription ID counter
     size_t m_NextId = 1;
+
+    // Nesting depth of Emit() calls; structural changes are deferred while > 0
+    int m_EmitDepth = 0;
+
+    // Set when a Subscribe/Unsubscribe was deferred during Emit()
+    bool m_HasDeferred = false;
+
+    // Subclass test for actorClass filters (nullptr = exact class only)
+    ClassMatcher m_ClassMatcher = nullptr;
 };
 
 } // namespace Broadsword
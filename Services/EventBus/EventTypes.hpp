@@ -1,6 +1,15 @@
 #pragma once
 
 #include "../../ModAPI/Frame.hpp"
+#include "EventBus.hpp"
+
+// Forward declarations (full definitions live in the generated SDK)
+namespace SDK {
+    class UWorld;
+    class UClass;
+    class AActor;
+    class AWillie_BP_C;
+}
 
 namespace Broadsword {
 
@@ -28,44 +37,82 @@ struct OnFrameEvent {
 
 /**
  * Event emitted when a UWorld is loaded
- * To be implemented later
+ *
+ * Emitted by ActorTracker when GWorld (or its PersistentLevel) changes to a
+ * non-null world. Followed by OnActorSpawnedEvent for every actor already in
+ * the level.
  */
 struct OnWorldLoadedEvent {
-    // SDK::UWorld* world;
+    ::SDK::UWorld* world;
+
+    EventFilterKeys GetFilterKeys() const { return {.world = world}; }
 };
 
 /**
  * Event emitted when a UWorld is unloaded
- * To be implemented later
+ *
+ * The world pointer identifies the old world only - it may already be
+ * destroyed and must not be dereferenced. No per-actor destroyed events are
+ * emitted for actors that disappear with the world.
  */
 struct OnWorldUnloadedEvent {
-    // SDK::UWorld* world;
+    ::SDK::UWorld* world;
+
+    EventFilterKeys GetFilterKeys() const { return {.world = world}; }
 };
 
 /**
  * Event emitted when the player is spawned
- * To be implemented later
+ *
+ * Emitted when the local player's pawn changes to a new AWillie_BP_C.
  */
 struct OnPlayerSpawnedEvent {
-    // SDK::AWillie_BP_C* player;
+    ::SDK::AWillie_BP_C* player;
+    ::SDK::UWorld* world;
+
+    EventFilterKeys GetFilterKeys() const { return {.world = world}; }
 };
 
 /**
  * Event emitted when the player dies
- * To be implemented later
+ *
+ * Emitted once when the tracked player's death flag becomes set.
  */
 struct OnPlayerDiedEvent {
-    // SDK::AWillie_BP_C* player;
-    // std::string deathReason;
+    ::SDK::AWillie_BP_C* player;
+    ::SDK::UWorld* world;
+
+    EventFilterKeys GetFilterKeys() const { return {.world = world}; }
 };
 
 /**
  * Event emitted when an actor is spawned
- * To be implemented later
+ *
+ * Filterable by actor class and world:
+ *   ctx.events.Subscribe<OnActorSpawnedEvent>(callback,
+ *       {.filter = {.actorClass = SDK::AWillie_BP_C::StaticClass()}});
  */
 struct OnActorSpawnedEvent {
-    // SDK::AActor* actor;
-    // SDK::UClass* actorClass;
+    ::SDK::AActor* actor;
+    ::SDK::UClass* actorClass;
+    ::SDK::UWorld* world;
+
+    EventFilterKeys GetFilterKeys() const { return {.actorClass = actorClass, .world = world}; }
+};
+
+/**
+ * Event emitted when an actor is removed from the level
+ *
+ * The actor pointer identifies the old actor only - it may already be
+ * destroyed and must not be dereferenced. actorClass is the class recorded
+ * when the actor was first seen.
+ */
+struct OnActorDestroyedEvent {
+    ::SDK::AActor* actor;
+    ::SDK::UClass* actorClass;
+    ::SDK::UWorld* world;
+
+    EventFilterKeys GetFilterKeys() const { return {.actorClass = actorClass, .world = world}; }
 };
 
 } // namespace Broadsword
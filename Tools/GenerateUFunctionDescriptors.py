@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+UFunction Descriptor Generator
+
+Scans the Dumper-7 SDK function wrappers (Engine/SDK/SDK/*_functions.cpp) and
+writes one header per package to Engine/SDK/Descriptors/ declaring a
+Broadsword::UFunctionDescriptor for every wrapper: the engine's class and
+function name plus the Params:: struct, keyed by the wrapper's address.
+
+Rerun after regenerating the SDK:
+    python Tools/GenerateUFunctionDescriptors.py
+"""
+
+import argparse
+import re
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+from typing import List, Optional
+
+# "ReturnType Class::Member(args) [const]" at the start of a line
+DEFINITION = re.compile(r'^[A-Za-z].*?\b([A-Z][A-Za-z0-9_]*)::([A-Za-z_][A-Za-z0-9_]*)\(.*\)( const)?$')
+GET_FUNCTION = re.compile(r'GetFunction\("((?:[^"\\]|\\.)*)", "((?:[^"\\]|\\.)*)"\)')
+PARAMS = re.compile(r'^\s*Params::([A-Za-z0-9_]+) Parms\{\};')
+
+HEADER = """#pragma once
+
+/*
+ * Generated by Tools/GenerateUFunctionDescriptors.py from {source} - do not edit
+ */
+
+{includes}
+
+// clang-format off
+"""
+
+
+@dataclass
+class Descriptor:
+    """One SDK wrapper"""
+    cpp_class: str
+    member: str
+    class_name: str
+    function_name: str
+    params: Optional[str]
+
+
+def parse_functions(path: Path) -> List[Descriptor]:
+    """Collect the wrappers defined in one *_functions.cpp"""
+    lines = path.read_text(encoding='utf-8-sig', errors='replace').splitlines()
+
+    descriptors = []
+    seen = set()
+    duplicates = set()
+
+    i = 0
+    while i < len(lines):
+        match = DEFINITION.match(lines[i])
+        if not match or not lines[i + 1:i + 2] == ['{']:
+            i += 1
+            continue
+
+        cpp_class, member = match.group(1), match.group(2)
+        names = None
+        params = None
+
+        # Body up to the closing brace
+        i += 2
+        while i < len(lines) and lines[i] != '}':
+            if names is None:
+                found = GET_FUNCTION.search(lines[i])
+                if found:
+                    names = (found.group(1), found.group(2))
+            if params is None:
+                found = PARAMS.match(lines[i])
+                if found:
+                    params = found.group(1)
+            i += 1
+
+        if names is None:
+            continue
+
+        # Overloaded wrapper names can't be told apart by address-of
+        key = (cpp_class, member)
+        if key in seen:
+            duplicates.add(key)
+            continue
+        seen.add(key)
+
+        descriptors.append(Descriptor(cpp_class, member, names[0], names[1], params))
+
+    return [d for d in descriptors if (d.cpp_class, d.member) not in duplicates]
+
+
+def render(package: str, descriptors: List[Descriptor], has_parameters: bool) -> str:
+    """Header text for one package"""
+    includes = ['#include "../../UFunctionDescriptor.hpp"',
+                f'#include "../SDK/{package}_classes.hpp"']
+    if has_parameters:
+        includes.append(f'#include "../SDK/{package}_parameters.hpp"')
+
+    out = [HEADER.format(source=f'{package}_functions.cpp', includes='\n'.join(includes))]
+    for d in descriptors:
+        params = f'SDK::Params::{d.params}' if d.params else 'void'
+        out.append(f'BROADSWORD_UFUNCTION_DESCRIPTOR({d.cpp_class}, {d.member}, "{d.class_name}", '
+                   f'"{d.function_name}", {params})\n')
+    out.append('// clang-format on\n')
+    return ''.join(out)
+
+
+def main() -> int:
+    root = Path(__file__).resolve().parent.parent
+
+    parser = argparse.ArgumentParser(description='Generate UFunction descriptors from the SDK')
+    parser.add_argument('--sdk', type=Path, default=root / 'Engine' / 'SDK' / 'SDK',
+                        help='Directory holding the *_functions.cpp files')
+    parser.add_argument('--output', type=Path, default=root / 'Engine' / 'SDK' / 'Descriptors',
+                        help='Directory for the generated headers')
+    args = parser.parse_args()
+
+    sources = sorted(args.sdk.glob('*_functions.cpp'))
+    if not sources:
+        print(f'No *_functions.cpp found in {args.sdk}', file=sys.stderr)
+        return 1
+
+    args.output.mkdir(parents=True, exist_ok=True)
+
+    written = set()
+    total = 0
+    skipped = 0
+    for source in sources:
+        package = source.name[:-len('_functions.cpp')]
+        descriptors = parse_functions(source)
+
+        # A dump without the package's Params:: structs - only parameterless functions can be described
+        has_parameters = (args.sdk / f'{package}_parameters.hpp').exists()
+        if not has_parameters:
+            skipped += sum(1 for d in descriptors if d.params)
+            descriptors = [d for d in descriptors if not d.params]
+
+        if not descriptors:
+            continue
+
+        target = args.output / f'{package}_descriptors.hpp'
+        text = render(package, descriptors, has_parameters)
+        if not target.exists() or target.read_text(encoding='utf-8') != text:
+            target.write_text(text, encoding='utf-8', newline='\n')
+
+        written.add(target.name)
+        total += len(descriptors)
+
+    # Packages that no longer exist
+    for stale in args.output.glob('*_descriptors.hpp'):
+        if stale.name not in written:
+            stale.unlink()
+
+    print(f'{total} descriptors in {len(written)} headers -> {args.output}')
+    if skipped:
+        print(f'{skipped} functions skipped: their package has no *_parameters.hpp')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
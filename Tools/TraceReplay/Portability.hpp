@@ -0,0 +1,14 @@
+#pragma once
+
+// Force-included ahead of every TraceReplay translation unit (see CMakeLists.txt)
+
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#define __int8 char
+#define __int16 short
+#define __int32 int
+#define __int64 long long
@@ -0,0 +1,77 @@
+# Portable copy of the core Dumper-7 SDK headers
+#
+# The generated SDK is written for MSVC. The replay harness only needs
+# Basic + CoreUObject, so those headers are copied into the build tree with
+# the handful of fixes GCC and Clang insist on. Every fix must still match -
+# a regenerated SDK that no longer needs one fails the configure step here
+# instead of silently drifting.
+
+# Replace <match> in the variable <variable>, fail if it isn't there
+# (single arguments, not a list - the patches contain semicolons)
+function(broadsword_sdk_patch VARIABLE MATCH REPLACEMENT)
+    string(FIND "${${VARIABLE}}" "${MATCH}" FOUND)
+    if(FOUND EQUAL -1)
+        message(FATAL_ERROR "PortableSdk: '${MATCH}' not found")
+    endif()
+    string(REPLACE "${MATCH}" "${REPLACEMENT}" PATCHED "${${VARIABLE}}")
+    set(${VARIABLE} "${PATCHED}" PARENT_SCOPE)
+endfunction()
+
+# Write <contents> to <destination>, touching it only when it changed
+function(broadsword_sdk_write DESTINATION CONTENTS)
+    file(WRITE ${DESTINATION}.tmp "${CONTENTS}")
+    configure_file(${DESTINATION}.tmp ${DESTINATION} COPYONLY)
+    file(REMOVE ${DESTINATION}.tmp)
+endfunction()
+
+function(broadsword_portable_sdk SDK_DIR OUTPUT_DIR)
+    foreach(HEADER PropertyFixup.hpp NameCollisions.inl UtfN.hpp UnrealContainers.hpp
+                   SDK/Basic.hpp SDK/CoreUObject_structs.hpp SDK/CoreUObject_classes.hpp)
+        set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${SDK_DIR}/${HEADER})
+    endforeach()
+
+    foreach(HEADER PropertyFixup.hpp NameCollisions.inl SDK/CoreUObject_structs.hpp)
+        file(READ ${SDK_DIR}/${HEADER} CONTENTS)
+        broadsword_sdk_write(${OUTPUT_DIR}/${HEADER} "${CONTENTS}")
+    endforeach()
+
+    file(READ ${SDK_DIR}/SDK/CoreUObject_classes.hpp CONTENTS)
+    # A scoped enum may not be named with 'enum class' outside its declaration
+    broadsword_sdk_patch(CONTENTS "enum class EClassCastFlags                    CastFlags;"
+                                  "EClassCastFlags                               CastFlags;")
+    broadsword_sdk_write(${OUTPUT_DIR}/SDK/CoreUObject_classes.hpp "${CONTENTS}")
+
+    file(READ ${SDK_DIR}/UtfN.hpp CONTENTS)
+    # 'typename' outside a template / missing on a dependent type
+    broadsword_sdk_patch(CONTENTS "typedef typename utf8_iterator" "typedef utf8_iterator")
+    broadsword_sdk_patch(CONTENTS "typedef typename utf16_iterator" "typedef utf16_iterator")
+    broadsword_sdk_patch(CONTENTS "typedef typename utf32_iterator" "typedef utf32_iterator")
+    broadsword_sdk_patch(CONTENTS "sizeof(std::decay<iterator_deref_type>::type)"
+                                  "sizeof(typename std::decay<iterator_deref_type>::type)")
+    broadsword_sdk_write(${OUTPUT_DIR}/UtfN.hpp "${CONTENTS}")
+
+    file(READ ${SDK_DIR}/UnrealContainers.hpp CONTENTS)
+    # Friend templates may not shadow the enclosing class's template parameter
+    broadsword_sdk_patch(CONTENTS "template<typename ArrayElementType>\n\t\tfriend class TAllocatedArray;"
+                                  "template<typename>\n\t\tfriend class TAllocatedArray;")
+    broadsword_sdk_patch(CONTENTS "template<typename SparseArrayElementType>\n\t\tfriend class TSparseArray;"
+                                  "template<typename>\n\t\tfriend class TSparseArray;")
+    # The bit iterator has no operator--
+    broadsword_sdk_patch(CONTENTS "inline TContainerIterator& operator--() { --BitIterator; return *this; }" "")
+    broadsword_sdk_write(${OUTPUT_DIR}/UnrealContainers.hpp "${CONTENTS}")
+
+    file(READ ${SDK_DIR}/SDK/Basic.hpp CONTENTS)
+    # Members of incomplete type (MSVC only diagnoses them when instantiated)
+    broadsword_sdk_patch(CONTENTS "struct InvalidUseOfTDelegate                  TemplateParamIsNotAFunctionSignature;" "")
+    broadsword_sdk_patch(CONTENTS "struct InvalidUseOfTMulticastInlineDelegate   TemplateParamIsNotAFunctionSignature;" "")
+    # UClass is incomplete here
+    broadsword_sdk_patch(CONTENTS "static_cast<UClass*>(BasicFilesImpleUtils::GetObjectByIndex"
+                                  "reinterpret_cast<UClass*>(BasicFilesImpleUtils::GetObjectByIndex")
+    # RF_ flag values go past INT32_MAX
+    broadsword_sdk_patch(CONTENTS "enum class EObjectFlags : int32" "enum class EObjectFlags : uint32")
+    broadsword_sdk_write(${OUTPUT_DIR}/SDK/Basic.hpp "${CONTENTS}")
+
+    # Only the core packages
+    broadsword_sdk_write(${OUTPUT_DIR}/SDK.hpp
+        "#pragma once\n\n#include \"SDK/Basic.hpp\"\n#include \"SDK/CoreUObject_structs.hpp\"\n#include \"SDK/CoreUObject_classes.hpp\"\n")
+endfunction()
@@ -0,0 +1,204 @@
+#include "SyntheticObjects.hpp"
+#include "Foundation/Hooks/VTableHook.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Broadsword::TraceReplay {
+
+namespace {
+
+constexpr size_t VTableSize = 0x100;
+constexpr size_t SerialNumberOffset = 0x10; // Inside FUObjectItem, as ProcessEventHook reads it
+constexpr size_t ParmsSizeOffset = 0xB6;    // Inside UFunction, as ParamLayout::ParmsSize() reads it
+
+void* g_VTable[VTableSize] = {};
+SDK::TUObjectArray g_Objects = {};
+std::vector<SDK::FUObjectItem*> g_Chunks;
+
+std::vector<std::u16string> g_Names;
+std::unordered_map<std::string, int32_t> g_NameIndices;
+
+uint64_t g_OriginalCalls = 0;
+
+int32_t NameIndex(const std::string& name) {
+    auto it = g_NameIndices.find(name);
+    if (it != g_NameIndices.end()) {
+        return it->second;
+    }
+
+    g_Names.emplace_back(name.begin(), name.end());
+    return g_NameIndices.emplace(name, static_cast<int32_t>(g_Names.size() - 1)).first->second;
+}
+
+// Same layout as the engine's FString (TArray<wchar_t>)
+struct StringBuffer {
+    char16_t* data;
+    int32_t count;
+    int32_t capacity;
+};
+
+// FName::AppendString - appends the name and a terminator, like the engine
+void AppendString(const SDK::FName* name, SDK::FString& out) {
+    StringBuffer& buffer = *reinterpret_cast<StringBuffer*>(&out);
+    const std::u16string& text = g_Names[name->ComparisonIndex];
+
+    int32_t start = buffer.count > 0 ? buffer.count - 1 : 0; // Overwrite an existing terminator
+    int32_t length = std::min<int32_t>(static_cast<int32_t>(text.size()), buffer.capacity - start - 1);
+    if (length < 0) {
+        return;
+    }
+
+    std::memcpy(buffer.data + start, text.data(), length * sizeof(char16_t));
+    buffer.data[start + length] = u'\0';
+    buffer.count = start + length + 1;
+}
+
+} // namespace
+
+SyntheticObjects::SyntheticObjects(int32_t capacity) {
+    if (!g_Chunks.empty()) {
+        throw std::logic_error("SyntheticObjects: only one instance per process");
+    }
+
+    g_VTable[SDK::Offsets::ProcessEventIdx] = reinterpret_cast<void*>(&OriginalProcessEvent);
+
+    int32_t chunkCount = (capacity + SDK::TUObjectArray::ElementsPerChunk - 1) / SDK::TUObjectArray::ElementsPerChunk;
+    for (int32_t i = 0; i < chunkCount; i++) {
+        g_Chunks.push_back(static_cast<SDK::FUObjectItem*>(
+            std::calloc(SDK::TUObjectArray::ElementsPerChunk, sizeof(SDK::FUObjectItem))));
+    }
+
+    g_Objects.Objects = g_Chunks.data();
+    g_Objects.MaxElements = chunkCount * SDK::TUObjectArray::ElementsPerChunk;
+    g_Objects.NumElements = 0;
+    g_Objects.MaxChunks = chunkCount;
+    g_Objects.NumChunks = chunkCount;
+
+    SDK::UObject::GObjects.InitManually(&g_Objects);
+    SDK::FName::InitManually(reinterpret_cast<void*>(&AppendString));
+
+    NameIndex("None");
+
+    // The metaclass is its own class
+    m_ClassClass = static_cast<SDK::UClass*>(Allocate(sizeof(SDK::UClass), nullptr, "Class", nullptr));
+    m_ClassClass->Class = m_ClassClass;
+
+    m_FunctionClass = AddClass("Function");
+    m_FunctionClass->CastFlags = SDK::EClassCastFlags::Function;
+}
+
+SyntheticObjects::~SyntheticObjects() {
+    for (void* allocation : m_Allocations) {
+        std::free(allocation);
+    }
+    for (SDK::FUObjectItem* chunk : g_Chunks) {
+        std::free(chunk);
+    }
+    g_Chunks.clear();
+    g_Objects = {};
+}
+
+SDK::UObject* SyntheticObjects::Allocate(size_t size, SDK::UClass* objectClass, const std::string& name,
+                                         SDK::UObject* outer) {
+    int32_t index = g_Objects.NumElements;
+    if (index >= g_Objects.MaxElements) {
+        throw std::length_error("SyntheticObjects: object table is full");
+    }
+
+    void* memory = std::calloc(1, size);
+    m_Allocations.push_back(memory);
+
+    auto* object = static_cast<SDK::UObject*>(memory);
+    object->VTable = g_VTable;
+    object->Index = index;
+    object->Class = objectClass;
+    object->Name.ComparisonIndex = NameIndex(name);
+    object->Name.Number = 0;
+    object->Outer = outer;
+
+    SDK::FUObjectItem& item = g_Chunks[index / SDK::TUObjectArray::ElementsPerChunk][index % SDK::TUObjectArray::ElementsPerChunk];
+    item.Object = object;
+    *reinterpret_cast<int32_t*>(reinterpret_cast<uint8_t*>(&item) + SerialNumberOffset) = 1;
+
+    g_Objects.NumElements = index + 1;
+    return object;
+}
+
+SDK::UClass* SyntheticObjects::AddClass(const std::string& name, SDK::UClass* super) {
+    auto* objectClass = static_cast<SDK::UClass*>(Allocate(sizeof(SDK::UClass), m_ClassClass, name, nullptr));
+    objectClass->Super = super;
+    objectClass->CastFlags = SDK::EClassCastFlags::None;
+    return objectClass;
+}
+
+SDK::UObject* SyntheticObjects::AddObject(SDK::UClass* objectClass, const std::string& name, SDK::UObject* outer) {
+    // Room for whatever a hook filter might read past the UObject header
+    return Allocate(0x100, objectClass, name, outer);
+}
+
+SDK::UFunction* SyntheticObjects::AddFunction(SDK::UObject* outer, const std::string& name, int32_t paramSize) {
+    auto* function = static_cast<SDK::UFunction*>(Allocate(sizeof(SDK::UFunction), m_FunctionClass, name, outer));
+    function->Size = paramSize;
+    auto parmsSize = static_cast<uint16_t>(paramSize);
+    std::memcpy(reinterpret_cast<uint8_t*>(function) + ParmsSizeOffset, &parmsSize, sizeof(parmsSize));
+    return function;
+}
+
+int32_t SyntheticObjects::Num() const {
+    return g_Objects.NumElements;
+}
+
+void SyntheticObjects::ProcessEvent(SDK::UObject* object, SDK::UFunction* function, void* params) {
+    using ProcessEventFunc = void (*)(SDK::UObject*, SDK::UFunction*, void*);
+    reinterpret_cast<ProcessEventFunc>(static_cast<void**>(object->VTable)[SDK::Offsets::ProcessEventIdx])(
+        object, function, params);
+}
+
+void SyntheticObjects::OriginalProcessEvent(SDK::UObject*, SDK::UFunction*, void*) {
+    g_OriginalCalls++;
+}
+
+uint64_t SyntheticObjects::GetOriginalCalls() {
+    return g_OriginalCalls;
+}
+
+} // namespace Broadsword::TraceReplay
+
+// SDK and Foundation functions defined in Windows-only translation units
+
+uintptr_t SDK::InSDKUtils::GetImageBase() {
+    // Places Offsets::ProcessEvent on the synthetic original
+    return reinterpret_cast<uintptr_t>(&Broadsword::TraceReplay::SyntheticObjects::OriginalProcessEvent) -
+           SDK::Offsets::ProcessEvent;
+}
+
+std::string SDK::UObject::GetName() const {
+    return Name.ToString();
+}
+
+bool SDK::UObject::HasTypeFlag(SDK::EClassCastFlags typeFlags) const {
+    return Class && (Class->CastFlags & typeFlags);
+}
+
+bool SDK::UStruct::IsSubclassOf(const SDK::UStruct* base) const {
+    if (!base) {
+        return false;
+    }
+
+    for (const SDK::UStruct* current = this; current; current = current->Super) {
+        if (current == base) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void* Broadsword::Foundation::VTableHook::SwapSlot(void** vtable, uint16_t index, void* replacement) {
+    // Host memory is writable - no page protection to lift
+    void* previous = vtable[index];
+    vtable[index] = replacement;
+    return previous;
+}
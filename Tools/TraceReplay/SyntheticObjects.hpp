@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Engine/SDK/SDK.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Broadsword::TraceReplay {
+
+/**
+ * SyntheticObjects - Stand-in GObjects table and FName pool for host builds
+ *
+ * Installs a single-chunk TUObjectArray as SDK::UObject::GObjects and an
+ * FName::AppendString that reads from a local name pool, so the framework's
+ * ProcessEvent code runs unmodified outside the game. Every object shares one
+ * vtable whose ProcessEvent slot starts out pointing at OriginalProcessEvent;
+ * ProcessEventHook::Initialize() patches it exactly as it would in the game.
+ *
+ * Also provides the SDK/Foundation functions that normally live in
+ * Windows-only translation units (image base, vtable patching, ...).
+ *
+ * One instance per process.
+ */
+class SyntheticObjects {
+public:
+    explicit SyntheticObjects(int32_t capacity);
+    ~SyntheticObjects();
+
+    SyntheticObjects(const SyntheticObjects&) = delete;
+    SyntheticObjects& operator=(const SyntheticObjects&) = delete;
+
+    /**
+     * Create a class object (a UClass whose class is the "Class" metaclass)
+     */
+    SDK::UClass* AddClass(const std::string& name, SDK::UClass* super = nullptr);
+
+    /**
+     * Create an instance of a class
+     */
+    SDK::UObject* AddObject(SDK::UClass* objectClass, const std::string& name, SDK::UObject* outer = nullptr);
+
+    /**
+     * Create a UFunction owned by `outer` with a `paramSize`-byte parameter block
+     */
+    SDK::UFunction* AddFunction(SDK::UObject* outer, const std::string& name, int32_t paramSize);
+
+    int32_t Num() const;
+
+    /**
+     * Call ProcessEvent through the object's vtable (the detour once patched)
+     */
+    static void ProcessEvent(SDK::UObject* object, SDK::UFunction* function, void* params);
+
+    /**
+     * The "engine" ProcessEvent - counts the call and returns
+     */
+    static void OriginalProcessEvent(SDK::UObject* object, SDK::UFunction* function, void* params);
+    static uint64_t GetOriginalCalls();
+
+private:
+    SDK::UObject* Allocate(size_t size, SDK::UClass* objectClass, const std::string& name, SDK::UObject* outer);
+
+    std::vector<void*> m_Allocations;
+    SDK::UClass* m_ClassClass = nullptr;
+    SDK::UClass* m_FunctionClass = nullptr;
+};
+
+} // namespace Broadsword::TraceReplay
@@ -0,0 +1,415 @@
+// TraceReplay - Replays a ProcessEvent trace through the framework's dispatch code
+//
+// Loads a .bstrace captured by ProcessEventTrace, rebuilds its functions and
+// object classes in a SyntheticObjects table, and drives every recorded call
+// through the patched vtable - ProcessEventHook's detour, HookContext
+// callbacks, ProcessEventStats and CallTreeProfiler - as fast as it can.
+// Nested calls are replayed in entry order, each as a top-level call.
+//
+// Usage: TraceReplay <trace.bstrace> [--runs N] [--repeat N] [--hooks N]
+
+#include "SyntheticObjects.hpp"
+#include "Engine/CallTreeProfiler.hpp"
+#include "Engine/ProcessEventHook.hpp"
+#include "Engine/ProcessEventStats.hpp"
+#include "Engine/ProcessEventTrace.hpp"
+#include "ModAPI/HookContext.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Broadsword;
+using namespace Broadsword::TraceReplay;
+
+namespace {
+
+struct TraceFunction {
+    std::string name; // "Outer.Function"
+    uint32_t paramSize = 0;
+    uint64_t calls = 0;
+};
+
+struct TraceCall {
+    uint32_t function;
+    uint32_t objectClass;
+    uint32_t paramOffset; // Into Trace::params
+    uint32_t paramBytes;
+};
+
+struct Trace {
+    bool hasParams = false;
+    std::unordered_map<uint32_t, TraceFunction> functions;
+    std::unordered_map<uint32_t, std::string> classes;
+    std::vector<TraceCall> calls;
+    std::vector<uint32_t> frameStarts; // First call of each frame
+    std::vector<uint8_t> params;
+};
+
+class Reader {
+public:
+    explicit Reader(const std::vector<uint8_t>& data) : m_Data(data) {}
+
+    bool AtEnd() const { return m_Offset >= m_Data.size(); }
+
+    template<typename T>
+    bool Read(T& value) {
+        if (m_Data.size() - m_Offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, m_Data.data() + m_Offset, sizeof(T));
+        m_Offset += sizeof(T);
+        return true;
+    }
+
+    bool ReadName(std::string& name) {
+        uint16_t length = 0;
+        if (!Read(length) || m_Data.size() - m_Offset < length) {
+            return false;
+        }
+        name.assign(reinterpret_cast<const char*>(m_Data.data() + m_Offset), length);
+        m_Offset += length;
+        return true;
+    }
+
+    const uint8_t* Take(size_t size) {
+        if (m_Data.size() - m_Offset < size) {
+            return nullptr;
+        }
+        const uint8_t* bytes = m_Data.data() + m_Offset;
+        m_Offset += size;
+        return bytes;
+    }
+
+    size_t GetOffset() const { return m_Offset; }
+
+private:
+    const std::vector<uint8_t>& m_Data;
+    size_t m_Offset = 0;
+};
+
+bool LoadTrace(const std::string& path, Trace& trace, std::string& error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    Reader reader(data);
+
+    TraceFormat::FileHeader header;
+    if (!reader.Read(header) || header.magic != TraceFormat::Magic) {
+        error = "not a ProcessEvent trace";
+        return false;
+    }
+    if (header.version != TraceFormat::Version) {
+        error = "unsupported trace version " + std::to_string(header.version);
+        return false;
+    }
+    trace.hasParams = (header.flags & TraceFormat::HasParams) != 0;
+
+    while (!reader.AtEnd()) {
+        size_t recordOffset = reader.GetOffset();
+        TraceFormat::Record tag;
+        bool ok = reader.Read(tag);
+
+        switch (ok ? tag : TraceFormat::Record{}) {
+        case TraceFormat::Record::Frame: {
+            uint64_t frame = 0;
+            ok = reader.Read(frame);
+            trace.frameStarts.push_back(static_cast<uint32_t>(trace.calls.size()));
+            break;
+        }
+        case TraceFormat::Record::Function: {
+            uint32_t id = 0;
+            TraceFunction function;
+            ok = reader.Read(id) && reader.Read(function.paramSize) && reader.ReadName(function.name);
+            trace.functions[id] = std::move(function);
+            break;
+        }
+        case TraceFormat::Record::Class: {
+            uint32_t id = 0;
+            std::string name;
+            ok = reader.Read(id) && reader.ReadName(name);
+            trace.classes[id] = std::move(name);
+            break;
+        }
+        case TraceFormat::Record::Call: {
+            TraceFormat::CallRecord record;
+            ok = reader.Read(record) && trace.functions.contains(record.function);
+            const uint8_t* bytes = ok ? reader.Take(record.paramBytes) : nullptr;
+            ok = ok && (bytes || record.paramBytes == 0);
+            if (ok) {
+                trace.functions[record.function].calls++;
+                trace.calls.push_back({record.function, record.objectClass,
+                                       static_cast<uint32_t>(trace.params.size()), record.paramBytes});
+                trace.params.insert(trace.params.end(), bytes, bytes + record.paramBytes);
+            }
+            break;
+        }
+        default:
+            ok = false;
+            break;
+        }
+
+        if (!ok) {
+            // A capture cut short (crash, full disk) - keep what was read
+            std::fprintf(stderr, "Warning: trace is damaged or truncated at byte %zu, replaying %zu calls\n",
+                         recordOffset, trace.calls.size());
+            break;
+        }
+    }
+
+    if (trace.calls.empty()) {
+        error = "trace has no calls";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * A trace call resolved to synthetic objects
+ */
+struct ReplayCall {
+    SDK::UObject* object;
+    SDK::UFunction* function;
+    const uint8_t* params; // Captured bytes, or null
+    uint32_t paramBytes;
+};
+
+class Replay {
+public:
+    Replay(const Trace& trace, SyntheticObjects& objects) : m_Trace(trace) {
+        // One class object and one instance per traced class; id 0 = no object recorded
+        std::unordered_map<std::string, SDK::UClass*> classes;
+        auto classNamed = [&](const std::string& name) {
+            auto it = classes.find(name);
+            if (it == classes.end()) {
+                it = classes.emplace(name, objects.AddClass(name)).first;
+            }
+            return it->second;
+        };
+
+        std::unordered_map<uint32_t, SDK::UObject*> instances;
+        instances[0] = objects.AddObject(classNamed("Object"), "Default__Object");
+        for (const auto& [id, name] : trace.classes) {
+            instances[id] = objects.AddObject(classNamed(name), name + "_0");
+        }
+
+        // "Outer.Function" -> UFunction owned by a class named Outer
+        std::unordered_map<uint32_t, SDK::UFunction*> functions;
+        for (const auto& [id, traced] : trace.functions) {
+            size_t dot = traced.name.rfind('.');
+            SDK::UObject* outer = dot != std::string::npos ? classNamed(traced.name.substr(0, dot)) : nullptr;
+            std::string name = dot != std::string::npos ? traced.name.substr(dot + 1) : traced.name;
+
+            functions[id] = objects.AddFunction(outer, name, static_cast<int32_t>(traced.paramSize));
+            m_MaxParamSize = std::max(m_MaxParamSize, static_cast<size_t>(traced.paramSize));
+        }
+
+        m_Calls.reserve(trace.calls.size());
+        for (const TraceCall& call : trace.calls) {
+            auto instance = instances.find(call.objectClass);
+            m_Calls.push_back({instance != instances.end() ? instance->second : instances[0], functions[call.function],
+                               call.paramBytes > 0 ? trace.params.data() + call.paramOffset : nullptr,
+                               call.paramBytes});
+        }
+    }
+
+    /**
+     * Run the whole trace `repeat` times
+     *
+     * @param detour Call through the vtable (false: straight to the original)
+     * @return Nanoseconds per call
+     */
+    double Run(uint32_t repeat, bool detour) {
+        std::vector<uint8_t> params(std::max<size_t>(m_MaxParamSize, 1));
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint32_t pass = 0; pass < repeat; pass++) {
+            size_t nextFrame = 1;
+            for (size_t i = 0; i < m_Calls.size(); i++) {
+                // Frame boundaries, as DllMain's present hook runs them
+                while (nextFrame < m_Trace.frameStarts.size() && m_Trace.frameStarts[nextFrame] == i) {
+                    ProcessEventStats::Get().EndFrame();
+                    CallTreeProfiler::Get().EndFrame();
+                    nextFrame++;
+                }
+
+                const ReplayCall& call = m_Calls[i];
+                if (call.params) {
+                    std::memcpy(params.data(), call.params, call.paramBytes);
+                }
+
+                if (detour) {
+                    SyntheticObjects::ProcessEvent(call.object, call.function, params.data());
+                } else {
+                    SyntheticObjects::OriginalProcessEvent(call.object, call.function, params.data());
+                }
+            }
+        }
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        return ns / static_cast<double>(m_Calls.size() * repeat);
+    }
+
+    size_t GetCallCount() const { return m_Calls.size(); }
+
+private:
+    const Trace& m_Trace;
+    std::vector<ReplayCall> m_Calls;
+    size_t m_MaxParamSize = 0;
+};
+
+double Best(Replay& replay, uint32_t runs, uint32_t repeat, bool detour) {
+    double best = replay.Run(1, detour); // Warm-up: first-sight resolves, caches
+    for (uint32_t run = 0; run < runs; run++) {
+        best = std::min(best, replay.Run(repeat, detour));
+    }
+    return best;
+}
+
+void PrintRow(const char* label, double ns, double baseline) {
+    if (baseline < 0.0) {
+        std::printf("  %-44s %10.2f %12s\n", label, ns, "-");
+    } else {
+        std::printf("  %-44s %10.2f %12.2f\n", label, ns, ns - baseline);
+    }
+}
+
+int Usage() {
+    std::fprintf(stderr,
+                 "Usage: TraceReplay <trace.bstrace> [--runs N] [--repeat N] [--hooks N]\n"
+                 "  --runs N    Timed runs per configuration, best is reported (default 5)\n"
+                 "  --repeat N  Trace passes per run (default: enough for ~2M calls)\n"
+                 "  --hooks N   Hook the N most-called functions (default: all)\n");
+    return 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        return Usage();
+    }
+
+    std::string path = argv[1];
+    uint32_t runs = 5;
+    uint32_t repeat = 0;
+    size_t hookLimit = SIZE_MAX;
+
+    for (int i = 2; i < argc; i++) {
+        std::string option = argv[i];
+        if (i + 1 >= argc) {
+            return Usage();
+        }
+        unsigned long value = std::strtoul(argv[++i], nullptr, 10);
+
+        if (option == "--runs") {
+            runs = std::max<uint32_t>(static_cast<uint32_t>(value), 1);
+        } else if (option == "--repeat") {
+            repeat = static_cast<uint32_t>(value);
+        } else if (option == "--hooks") {
+            hookLimit = value;
+        } else {
+            return Usage();
+        }
+    }
+
+    Trace trace;
+    std::string error;
+    if (!LoadTrace(path, trace, error)) {
+        std::fprintf(stderr, "TraceReplay: %s\n", error.c_str());
+        return 1;
+    }
+
+    if (repeat == 0) {
+        repeat = static_cast<uint32_t>(std::max<size_t>(1, 2'000'000 / trace.calls.size()));
+    }
+
+    int32_t capacity = static_cast<int32_t>(16 + 2 * trace.classes.size() + 2 * trace.functions.size());
+    SyntheticObjects objects(capacity);
+    Replay replay(trace, objects);
+
+    std::printf("%s: %zu calls, %zu frames, %zu functions, %zu classes%s\n", path.c_str(), trace.calls.size(),
+                trace.frameStarts.size(), trace.functions.size(), trace.classes.size(),
+                trace.hasParams ? ", with parameters" : "");
+    std::printf("Best of %u runs x %u passes\n\n", runs, repeat);
+    std::printf("  %-44s %10s %12s\n", "Configuration", "ns/call", "overhead");
+
+    double baseline = Best(replay, runs, repeat, false);
+    PrintRow("original ProcessEvent (no detour)", baseline, -1.0);
+
+    // Silence the hook's per-hook logging while setting up
+    std::streambuf* coutBuffer = std::cout.rdbuf(nullptr);
+    ProcessEventHook::Get().Initialize();
+    std::cout.rdbuf(coutBuffer);
+
+    PrintRow("detour, no hooks", Best(replay, runs, repeat, true), baseline);
+
+    // Hottest functions first
+    std::vector<const TraceFunction*> hottest;
+    for (const auto& [id, function] : trace.functions) {
+        hottest.push_back(&function);
+    }
+    std::sort(hottest.begin(), hottest.end(), [](const TraceFunction* a, const TraceFunction* b) {
+        return a->calls > b->calls;
+    });
+    hottest.resize(std::min(hottest.size(), hookLimit));
+
+    uint64_t hookCalls = 0;
+    std::vector<std::string> hookedNames;
+    {
+        coutBuffer = std::cout.rdbuf(nullptr);
+
+        HookContext hooks;
+        for (const TraceFunction* function : hottest) {
+            size_t dot = function->name.rfind('.');
+            std::string name = dot != std::string::npos ? function->name.substr(dot + 1) : function->name;
+            if (std::find(hookedNames.begin(), hookedNames.end(), name) != hookedNames.end()) {
+                continue;
+            }
+            hookedNames.push_back(name);
+
+            hooks.Hook(name, [&hookCalls](SDK::UObject*, void*) {
+                hookCalls++;
+                return true;
+            });
+            hooks.HookPost(name, [&hookCalls](SDK::UObject*, void*) { hookCalls++; });
+        }
+
+        std::cout.rdbuf(coutBuffer);
+
+        std::string label = "detour, pre+post hooks on " + std::to_string(hookedNames.size()) + " names";
+        PrintRow(label.c_str(), Best(replay, runs, repeat, true), baseline);
+
+        ProcessEventStats::Get().SetEnabled(true);
+        PrintRow("  + ProcessEventStats", Best(replay, runs, repeat, true), baseline);
+
+        CallTreeProfiler::Get().SetSampleInterval(1);
+        CallTreeProfiler::Get().SetEnabled(true);
+        PrintRow("  + CallTreeProfiler (every frame)", Best(replay, runs, repeat, true), baseline);
+
+        CallTreeProfiler::Get().SetEnabled(false);
+        ProcessEventStats::Get().SetEnabled(false);
+
+        coutBuffer = std::cout.rdbuf(nullptr);
+    }
+
+    ProcessEventHook::Get().Shutdown();
+    std::cout.rdbuf(coutBuffer);
+
+    std::printf("\n%llu original calls, %llu hook callbacks\n",
+                static_cast<unsigned long long>(SyntheticObjects::GetOriginalCalls()),
+                static_cast<unsigned long long>(hookCalls));
+    return 0;
+}